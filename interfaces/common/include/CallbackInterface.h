@@ -9,6 +9,12 @@
 
 #ifndef SWIG
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #endif
@@ -52,5 +58,170 @@ namespace api
         }
     };
 
+#ifndef SWIG
+    /// <summary>
+    /// Delivers sink callbacks in batches of frames and, optionally, from a background thread.
+    /// Each frame the model produces is appended to the current batch; once batchSize frames
+    /// have accumulated, the callback is invoked once with the concatenated buffer, so the
+    /// language boundary (and, for Python directors, the GIL) is crossed once per batch instead
+    /// of once per frame. In asynchronous mode, complete batches are handed to a worker thread
+    /// through a fixed-size single-producer/single-consumer ring with atomic indices, so the
+    /// producer never waits for the callback; if the consumer falls behind and the ring fills
+    /// up, new batches are dropped and counted rather than blocking the producer.
+    /// </summary>
+    template <typename ElementType>
+    class BatchedCallbackDispatcher
+    {
+    public:
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="callback"> The callback to deliver batches to. The caller is responsible
+        /// for keeping it alive for the lifetime of the dispatcher. </param>
+        /// <param name="batchSize"> The number of frames to accumulate before invoking the callback. </param>
+        /// <param name="asynchronous"> If true, deliver batches from a worker thread instead of the
+        /// producer's thread. </param>
+        BatchedCallbackDispatcher(CallbackBase<ElementType>& callback, size_t batchSize, bool asynchronous);
+
+        ~BatchedCallbackDispatcher();
+
+        BatchedCallbackDispatcher(const BatchedCallbackDispatcher&) = delete;
+        BatchedCallbackDispatcher& operator=(const BatchedCallbackDispatcher&) = delete;
+
+        /// <summary> Appends one frame to the current batch, delivering the batch when it is full. </summary>
+        ///
+        /// <param name="frame"> The frame data produced by the model. </param>
+        void ProcessFrame(const std::vector<ElementType>& frame);
+
+        /// <summary> Gets the number of batches dropped because the ring was full (asynchronous mode only). </summary>
+        ///
+        /// <returns> The number of dropped batches. </returns>
+        size_t GetDroppedBatchCount() const { return _droppedBatches; }
+
+    private:
+        void DeliverBatch(std::vector<ElementType>& batch);
+        void ConsumerLoop();
+
+        static constexpr size_t ringCapacity = 8;
+
+        CallbackBase<ElementType>& _callback;
+        size_t _batchSize;
+        bool _asynchronous;
+
+        std::vector<ElementType> _currentBatch;
+        size_t _framesInBatch = 0;
+
+        // Single-producer/single-consumer ring: the producer owns _writeIndex, the consumer
+        // owns _readIndex, and each slot is touched by exactly one side at a time.
+        std::vector<std::vector<ElementType>> _slots;
+        std::atomic<size_t> _writeIndex{ 0 };
+        std::atomic<size_t> _readIndex{ 0 };
+        std::atomic<size_t> _droppedBatches{ 0 };
+        std::atomic<bool> _stopping{ false };
+        std::condition_variable _wakeConsumer;
+        std::mutex _consumerMutex; // only held by the sleeping consumer, never by the producer
+        std::thread _consumerThread;
+    };
+#endif
+
+} // namespace api
+} // namespace ell
+
+#pragma region implementation
+
+#ifndef SWIG
+
+namespace ell
+{
+namespace api
+{
+    template <typename ElementType>
+    BatchedCallbackDispatcher<ElementType>::BatchedCallbackDispatcher(CallbackBase<ElementType>& callback, size_t batchSize, bool asynchronous) :
+        _callback(callback),
+        _batchSize(batchSize < 1 ? 1 : batchSize),
+        _asynchronous(asynchronous)
+    {
+        if (_asynchronous)
+        {
+            _slots.resize(ringCapacity);
+            _consumerThread = std::thread([this] { ConsumerLoop(); });
+        }
+    }
+
+    template <typename ElementType>
+    BatchedCallbackDispatcher<ElementType>::~BatchedCallbackDispatcher()
+    {
+        // Flush any partial batch through the normal path, then let the consumer drain the ring
+        if (_framesInBatch > 0)
+        {
+            DeliverBatch(_currentBatch);
+        }
+        if (_asynchronous)
+        {
+            _stopping = true;
+            _wakeConsumer.notify_one();
+            _consumerThread.join();
+        }
+    }
+
+    template <typename ElementType>
+    void BatchedCallbackDispatcher<ElementType>::ProcessFrame(const std::vector<ElementType>& frame)
+    {
+        _currentBatch.insert(_currentBatch.end(), frame.begin(), frame.end());
+        if (++_framesInBatch == _batchSize)
+        {
+            DeliverBatch(_currentBatch);
+            _currentBatch.clear();
+            _framesInBatch = 0;
+        }
+    }
+
+    template <typename ElementType>
+    void BatchedCallbackDispatcher<ElementType>::DeliverBatch(std::vector<ElementType>& batch)
+    {
+        if (!_asynchronous)
+        {
+            _callback.Run(batch);
+            return;
+        }
+
+        auto writeIndex = _writeIndex.load(std::memory_order_relaxed);
+        if (writeIndex - _readIndex.load(std::memory_order_acquire) == ringCapacity)
+        {
+            // Ring is full: drop the batch rather than block the producer
+            ++_droppedBatches;
+            return;
+        }
+        _slots[writeIndex % ringCapacity].swap(batch);
+        _writeIndex.store(writeIndex + 1, std::memory_order_release);
+        _wakeConsumer.notify_one();
+    }
+
+    template <typename ElementType>
+    void BatchedCallbackDispatcher<ElementType>::ConsumerLoop()
+    {
+        std::vector<ElementType> batch;
+        for (;;)
+        {
+            auto readIndex = _readIndex.load(std::memory_order_relaxed);
+            if (readIndex == _writeIndex.load(std::memory_order_acquire))
+            {
+                if (_stopping)
+                {
+                    return; // ring is drained
+                }
+                std::unique_lock<std::mutex> lock(_consumerMutex);
+                _wakeConsumer.wait_for(lock, std::chrono::milliseconds(10));
+                continue;
+            }
+            batch.swap(_slots[readIndex % ringCapacity]);
+            _readIndex.store(readIndex + 1, std::memory_order_release);
+            _callback.Run(batch);
+            batch.clear();
+        }
+    }
 } // namespace api
 } // namespace ell
+
+#endif // SWIG
+
+#pragma endregion implementation
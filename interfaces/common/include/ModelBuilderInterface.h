@@ -20,6 +20,8 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #endif
@@ -135,6 +137,14 @@ private:
     template <typename ElementType>
     void InternalResetInput(Node node, PortElements input, std::string input_port_name);
 
+    template <typename ElementType>
+    Node FindOrAddConstantNode(Model model, std::vector<ElementType> values, const ell::model::PortMemoryLayout* outputMemoryLayout);
+
+    // Previously added constant nodes, keyed by a hash of their contents. Imported models often
+    // repeat the same tensor (tied embeddings, normalization constants); pooling them here gives
+    // each distinct tensor one shared node, and so one emitted global, per model.
+    std::unordered_map<size_t, std::vector<std::pair<std::weak_ptr<ell::model::Model>, ell::model::Node*>>> _constantPool;
+
 #endif
 
     ell::model::ModelBuilder _modelBuilder;
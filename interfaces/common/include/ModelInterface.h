@@ -50,6 +50,8 @@ namespace ELL_API
 //
 class AutoDataVector;
 class CompiledMap;
+class CompiledMapInvocation;
+class StateSession;
 class Map;
 class InputPort;
 class Model;
@@ -224,8 +226,11 @@ public:
     using Node::GetInputPort;
     using Node::GetOutputPort;
 
+    // batchSize > 1 accumulates that many frames and invokes the callback once with the
+    // concatenated buffer; asynchronous delivers batches from a worker thread so the model's
+    // compute thread never waits for the callback (or, for Python callbacks, for the GIL).
     template <typename ElementType>
-    void RegisterCallback(ell::api::CallbackBase<ElementType>& callback);
+    void RegisterCallback(ell::api::CallbackBase<ElementType>& callback, int batchSize = 1, bool asynchronous = false);
 #ifndef SWIG
     SinkNode() = default;
     SinkNode(ell::model::SinkNodeBase* other, std::shared_ptr<ell::model::Model> model);
@@ -313,6 +318,27 @@ private:
     std::shared_ptr<ell::model::Model> _model;
 };
 
+//
+// MemoryFootprint
+//
+struct MemoryFootprint
+{
+    // total bytes of constant (weight) data held by the model's constant nodes
+    size_t weightBytes = 0;
+
+    // largest number of activation bytes live at once, over all the model's nodes
+    size_t peakActivationBytes = 0;
+
+    // total bytes written to (non-constant) output ports during one evaluation
+    size_t totalActivationBytes = 0;
+
+    // estimated multiply-accumulate operations in one evaluation
+    size_t multiplyAccumulates = 0;
+
+    // multiply-accumulates per byte of weight and activation data
+    double GetArithmeticIntensity() const;
+};
+
 //
 // Map
 //
@@ -346,6 +372,11 @@ public:
     Model GetModel() const;
     void Refine(int iterations);
 
+    // Chains this map's outputs into the given map's inputs, returning a single combined map;
+    // compiling the result runs the whole pipeline as one call, with the intermediate data
+    // staying in the module's buffers instead of round-tripping through the host
+    Map Chain(const Map& second) const;
+
     CompiledMap Compile(const std::string& targetDevice, const std::string& moduleName, const std::string& functionName, const MapCompilerOptions& compilerSettings, const ModelOptimizerOptions& optimizerSettings) const;
 
     // Return true if the model contains a SourceNode.  In this case you need
@@ -355,6 +386,10 @@ public:
     std::string GetMetadataValue(const std::string& key);
     void SetMetadataValue(const std::string& key, const std::string& value);
 
+    // Returns the map's memory footprint and estimated arithmetic cost, most accurate
+    // on refined maps where layers have been lowered to constants and matrix multiplies
+    MemoryFootprint GetMemoryFootprint() const;
+
     std::vector<CallbackInfo> GetSinkCallbackInfo();
     std::vector<CallbackInfo> GetSourceCallbackInfo();
     std::vector<CallbackInfo> GetLagCallbackInfo();
@@ -388,6 +423,69 @@ private:
     TriState _sourceNodeState = TriState::Uninitialized;
 };
 
+//
+// CompiledMapInvocation
+//
+
+// A reusable, bound invocation of a compiled map. Created by CompiledMap::CreateInvocation
+// after jitting has finished, it caches the jitted compute function and the raw input and
+// output buffer pointers, so repeated Compute calls have no per-call setup: no function
+// resolution, no allocation, and no marshalling. The caller owns the bound buffers and must
+// keep them alive for the lifetime of the invocation.
+class CompiledMapInvocation
+{
+public:
+    CompiledMapInvocation() = default;
+
+    // Runs the model, reading from and writing to the bound buffers
+    void Compute();
+
+#ifndef SWIG
+    CompiledMapInvocation(std::shared_ptr<ell::model::IRCompiledMap> map);
+
+    // The buffer byte sizes must match the map's input and output sizes
+    void SetBuffers(const void* input, size_t inputByteSize, void* output, size_t outputByteSize);
+#endif
+
+private:
+    std::shared_ptr<ell::model::IRCompiledMap> _map; // keeps the execution engine alive
+    std::shared_ptr<ell::model::IRCompiledMap::ExecutionContext> _context;
+    const void* _input = nullptr;
+    void* _output = nullptr;
+    size_t _inputByteSize = 0;
+    size_t _outputByteSize = 0;
+};
+
+//
+// StateSession
+//
+
+// A stream session: a private copy of all the stateful node storage in a compiled map (delay
+// lines, sample buffers, recurrent hidden state). Created by CompiledMap::CreateSession.
+// Sessions let one compiled map serve many interleaved input streams: call Activate before
+// computing a stream's next frame, and the previously active stream's state is saved and this
+// stream's state restored, without cloning the map per stream.
+class StateSession
+{
+public:
+    StateSession() = default;
+
+    // Makes this session's state live in the compiled map, saving the currently active
+    // session's state first
+    void Activate();
+
+    // Restores this session to freshly-reset state
+    void Reset();
+
+#ifndef SWIG
+    StateSession(const std::shared_ptr<ell::model::IRCompiledMap>& map, const std::shared_ptr<ell::model::IRCompiledMap::StateSession>& session);
+#endif
+
+private:
+    std::shared_ptr<ell::model::IRCompiledMap> _map; // keeps the execution engine alive
+    std::shared_ptr<ell::model::IRCompiledMap::StateSession> _session;
+};
+
 //
 // CompiledMap
 //
@@ -435,6 +533,14 @@ public:
     std::vector<int> ComputeInt(const std::vector<int>& inputData);
     std::vector<int64_t> ComputeInt64(const std::vector<int64_t>& inputData);
 
+    // Creates a reusable invocation object bound to this map's jitted compute function;
+    // bind input and output buffers to it once, then call its Compute repeatedly
+    CompiledMapInvocation CreateInvocation();
+
+    // Creates a stream session holding a private copy of the map's stateful node storage,
+    // initialized to freshly-reset state; create sessions before computing anything
+    StateSession CreateSession();
+
     void Reset();
 
 private:
@@ -541,11 +647,23 @@ void SourceNode::RegisterCallback(ell::api::CallbackBase<ElementType>& callback)
 }
 
 template <typename ElementType>
-void SinkNode::RegisterCallback(ell::api::CallbackBase<ElementType>& callback)
+void SinkNode::RegisterCallback(ell::api::CallbackBase<ElementType>& callback, int batchSize, bool asynchronous)
 {
     ell::nodes::SinkNode<ElementType>* node = dynamic_cast<ell::nodes::SinkNode<ElementType>*>(GetSinkNode());
     if (node != nullptr)
     {
+        if (batchSize > 1 || asynchronous)
+        {
+            // The dispatcher is kept alive by the sink function stored on the node; its
+            // destructor flushes any partial batch and joins the worker thread.
+            auto dispatcher = std::make_shared<ell::api::BatchedCallbackDispatcher<ElementType>>(callback, static_cast<size_t>(batchSize), asynchronous);
+            std::function<void(const std::vector<ElementType>&)> function([dispatcher](const std::vector<ElementType>& output) {
+                // Note: the caller is responsible for keeping the CallbackBase object alive until this point.
+                dispatcher->ProcessFrame(output);
+            });
+            node->SetSinkFunction(function);
+            return;
+        }
         std::function<void(const std::vector<ElementType>&)> function([&callback](const std::vector<ElementType>& output) {
             // Reason for the const_cast:
             // SWIG warns that the const overload gets shadowed, so CallbackBase only
@@ -172,8 +172,103 @@ def Map_Compute(self, inputData):
 
 Map.Compute = Map_Compute
 del Map_Compute
-    
-    
+
+def _GetNumpyDataType(portType):
+    import ell
+    if portType == ell.nodes.PortType.real:
+        return np.float64
+    elif portType == ell.nodes.PortType.smallReal:
+        return np.float32
+    elif portType == ell.nodes.PortType.integer:
+        return np.int32
+    elif portType == ell.nodes.PortType.bigInt:
+        return np.int64
+    else:
+        raise TypeError("Model has unsupported port type : " + str(portType))
+
+# Zero-copy Compute wrappers built on the buffer protocol (ComputeBuffer)
+def CompiledMap_ComputeNumpy(self, inputData, outputData=None):
+    """
+    ComputeNumpy - zero-copy version of Compute for numpy arrays.
+    The input array is handed to the model by pointer, so a C-contiguous array that
+    already has the model's input dtype (e.g. float32 for a smallReal model) is used
+    in place without any copies; otherwise a converted copy is made first.
+    Returns the output numpy array, allocating one if outputData is not given.
+
+    Parameters
+    ----------
+    inputData: an input numpy array
+    outputData: an optional pre-allocated output numpy array to fill in
+    """
+    inputData = np.ascontiguousarray(inputData, dtype=_GetNumpyDataType(self.GetInputType(0)))
+    if outputData is None:
+        outputData = np.zeros((self.GetOutputShape(0).Size(),), dtype=_GetNumpyDataType(self.GetOutputType(0)))
+    self.ComputeBuffer(inputData, outputData)
+    return outputData
+
+CompiledMap.ComputeNumpy = CompiledMap_ComputeNumpy
+del CompiledMap_ComputeNumpy
+
+def Map_ComputeNumpy(self, inputData, outputData=None):
+    """
+    ComputeNumpy - zero-copy version of Compute for numpy arrays.
+    The input array is handed to the model by pointer, so a C-contiguous array that
+    already has the model's input dtype (e.g. float32 for a smallReal model) is used
+    in place without any copies; otherwise a converted copy is made first.
+    Returns the output numpy array, allocating one if outputData is not given.
+
+    Parameters
+    ----------
+    inputData: an input numpy array
+    outputData: an optional pre-allocated output numpy array to fill in
+    """
+    inputData = np.ascontiguousarray(inputData, dtype=_GetNumpyDataType(self.GetInputType(0)))
+    if outputData is None:
+        outputData = np.zeros((self.GetOutputShape(0).Size(),), dtype=_GetNumpyDataType(self.GetOutputType(0)))
+    self.ComputeBuffer(inputData, outputData)
+    return outputData
+
+Map.ComputeNumpy = Map_ComputeNumpy
+del Map_ComputeNumpy
+
+def CompiledMap_CreateInvocation(self):
+    """
+    CreateInvocation - creates a reusable invocation object bound to this map's jitted
+    compute function, with preallocated numpy input and output buffers of the model's
+    dtypes. Fill invocation.input in place (or pass an array to Run) and call Run
+    repeatedly; each call runs the model with no per-call setup and returns
+    invocation.output.
+    """
+    invocation = self.InternalCreateInvocation()
+    invocation.input = np.zeros((self.GetInputShape(0).Size(),), dtype=_GetNumpyDataType(self.GetInputType(0)))
+    invocation.output = np.zeros((self.GetOutputShape(0).Size(),), dtype=_GetNumpyDataType(self.GetOutputType(0)))
+    invocation.Bind(invocation.input, invocation.output)
+    return invocation
+
+CompiledMap.InternalCreateInvocation = CompiledMap.CreateInvocation
+CompiledMap.CreateInvocation = CompiledMap_CreateInvocation
+del CompiledMap_CreateInvocation
+
+def CompiledMapInvocation_Run(self, inputData=None):
+    """
+    Run - runs the model over the preallocated buffers with zero per-call setup.
+    If inputData is given it is copied into the bound input buffer first; otherwise
+    fill self.input in place beforehand. Returns the bound output array (reused
+    across calls, so copy it if you need to keep it).
+
+    Parameters
+    ----------
+    inputData: an optional input numpy array to copy into the bound input buffer
+    """
+    if inputData is not None:
+        self.input[:] = np.asarray(inputData).ravel()
+    self.Compute()
+    return self.output
+
+CompiledMapInvocation.Run = CompiledMapInvocation_Run
+del CompiledMapInvocation_Run
+
+
 # Map.Compile, parameterized on numpy.dtype
 def Map_Compile(self, targetDevice: 'std::string const &', moduleName: 'std::string const &', functionName: 'std::string const &', compilerOptions: 'MapCompilerOptions const &' = None, optimizerSettings: 'ModelOptimizerOptions const &' = None) -> "ELL_API::CompiledMap< ElementType >":
     """
@@ -266,11 +361,16 @@ def SourceNode_RegisterCallback(self, function):
 SourceNode.RegisterCallback = SourceNode_RegisterCallback
 del SourceNode_RegisterCallback
 
-def SinkNode_RegisterCallback(self, function):
+def SinkNode_RegisterCallback(self, function, batchSize=1, asynchronous=False):
     """
     Register a callback function.  This function will be called when this SinkNode has data to provide.
     The registered function receives a typed Vector argument (ell.math.DoubleVector, FloatVector, etc)
     containing the data.
+    When batchSize is greater than 1, that many frames are accumulated and the function is called
+    once with the concatenated buffer, reducing how often the GIL is acquired. When asynchronous
+    is True, batches are delivered from a worker thread so the model's compute thread never waits
+    on the callback; if the callback falls behind, complete batches are dropped rather than
+    blocking the model.
     """
     outputPort = self.GetOutputPorts().Get()
     portType = outputPort.GetOutputType()
@@ -284,7 +384,7 @@ def SinkNode_RegisterCallback(self, function):
                 self.func(data)
                 return True
         self.wrapper = SinkNodeDoubleCallbackBase(function)  # must stay alive
-        self.RegisterCallbackDouble(self.wrapper)
+        self.RegisterCallbackDouble(self.wrapper, batchSize, asynchronous)
     elif portType == ell.nodes.PortType.smallReal:        
         class SinkNodeFloatCallbackBase(ell.math.FloatCallbackBase):
             def __init__(self, function):
@@ -294,7 +394,7 @@ def SinkNode_RegisterCallback(self, function):
                 self.func(data)
                 return True
         self.wrapper = SinkNodeFloatCallbackBase(function)  # must stay alive
-        self.RegisterCallbackFloat(self.wrapper)
+        self.RegisterCallbackFloat(self.wrapper, batchSize, asynchronous)
     elif portType == ell.nodes.PortType.integer:      
         class SinkNodeIntCallbackBase(ell.math.IntCallbackBase):
             def __init__(self, function):
@@ -304,7 +404,7 @@ def SinkNode_RegisterCallback(self, function):
                 self.func(data)
                 return True
         self.wrapper = SinkNodeIntCallbackBase(function)  # must stay alive
-        self.RegisterCallbackInt(self.wrapper)
+        self.RegisterCallbackInt(self.wrapper, batchSize, asynchronous)
     elif portType == ell.nodes.PortType.bigInt:     
         class SinkNodeInt64CallbackBase(ell.math.Int64CallbackBase):
             def __init__(self, function):
@@ -314,7 +414,7 @@ def SinkNode_RegisterCallback(self, function):
                 self.func(data)
                 return True
         self.wrapper = SinkNodeInt64CallbackBase(function)  # must stay alive
-        self.RegisterCallbackInt64(self.wrapper)
+        self.RegisterCallbackInt64(self.wrapper, batchSize, asynchronous)
     elif portType == ell.nodes.PortType.boolean:
         class SinkNodeInt8CallbackBase(ell.math.Int8CallbackBase):
             def __init__(self, function):
@@ -324,7 +424,7 @@ def SinkNode_RegisterCallback(self, function):
                 self.func(data)
                 return True
         self.wrapper = SinkNodeInt8CallbackBase(function)  # must stay alive
-        self.RegisterCallbackBoolean(self.wrapper)
+        self.RegisterCallbackBoolean(self.wrapper, batchSize, asynchronous)
     else:
         raise Exception("portType {} not supported".format(portType))
 
@@ -581,6 +681,84 @@ std::vector<void*> GetOutputBuffersFromList(std::shared_ptr<ell::model::Map> map
     return args;
 }
 
+// RAII holder for a PEP 3118 buffer view of a Python object (e.g. a numpy array).
+// Requesting a C-contiguous view lets us hand the underlying pointer straight to the map.
+class PyBufferView
+{
+public:
+    PyBufferView(PyObject* object, bool writable)
+    {
+        int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+        if (PyObject_GetBuffer(object, &_view, flags) != 0)
+        {
+            PyErr_Clear();
+            throw std::invalid_argument(writable ? "argument must be a writable C-contiguous buffer (e.g. a numpy array)" : "argument must be a C-contiguous buffer (e.g. a numpy array)");
+        }
+    }
+
+    ~PyBufferView() { PyBuffer_Release(&_view); }
+
+    PyBufferView(const PyBufferView&) = delete;
+    PyBufferView& operator=(const PyBufferView&) = delete;
+
+    void* Data() const { return _view.buf; }
+    size_t NumElements() const { return _view.itemsize > 0 ? static_cast<size_t>(_view.len / _view.itemsize) : 0; }
+    size_t ItemSize() const { return static_cast<size_t>(_view.itemsize); }
+
+    char Format() const
+    {
+        // A null format means unsigned bytes; skip the native byte order prefix if present
+        const char* format = _view.format;
+        if (format == nullptr)
+        {
+            return 'B';
+        }
+        return (format[0] == '@') ? format[1] : format[0];
+    }
+
+private:
+    Py_buffer _view;
+};
+
+void CheckBufferMatchesPort(const PyBufferView& view, ell::model::Port::PortType portType, size_t expectedSize, const char* name)
+{
+    if (view.NumElements() != expectedSize)
+    {
+        throw std::invalid_argument(ell::utilities::FormatString("The %s buffer is the wrong size, expecting %zu elements", name, expectedSize));
+    }
+    bool ok = false;
+    const char* expectedType = "";
+    switch (portType)
+    {
+    case ell::model::Port::PortType::smallReal:
+        ok = (view.Format() == 'f');
+        expectedType = "float32";
+        break;
+    case ell::model::Port::PortType::real:
+        ok = (view.Format() == 'd');
+        expectedType = "float64";
+        break;
+    case ell::model::Port::PortType::integer:
+        ok = (view.ItemSize() == sizeof(int)) && (view.Format() == 'i' || view.Format() == 'l');
+        expectedType = "int32";
+        break;
+    case ell::model::Port::PortType::bigInt:
+        ok = (view.ItemSize() == sizeof(int64_t)) && (view.Format() == 'q' || view.Format() == 'l');
+        expectedType = "int64";
+        break;
+    case ell::model::Port::PortType::boolean:
+        ok = (view.ItemSize() == sizeof(int8_t));
+        expectedType = "int8";
+        break;
+    default:
+        throw std::invalid_argument(ell::utilities::FormatString("The %s port has unsupported type %d", name, (int)portType));
+    }
+    if (!ok)
+    {
+        throw std::invalid_argument(ell::utilities::FormatString("The %s buffer has the wrong element type, expecting '%s'", name, expectedType));
+    }
+}
+
 %}
 
 namespace ELL_API
@@ -598,6 +776,21 @@ namespace ELL_API
         std::vector<void*> outputs = GetOutputBuffersFromList(map, outputList);
         map->ComputeMultiple(inputs, outputs);
     }
+
+    void ComputeBuffer(PyObject* input, PyObject* output)
+    {
+        if (self->HasSourceNodes())
+        {
+            throw std::invalid_argument("Cannot use ComputeBuffer on a model with Source and Sink nodes");
+        }
+        auto map = self->GetInnerMap();
+        PyBufferView inputView(input, false);
+        PyBufferView outputView(output, true);
+        CheckBufferMatchesPort(inputView, map->GetInputType(0), map->GetInputSize(0), "input");
+        CheckBufferMatchesPort(outputView, map->GetOutputType(0), map->GetOutputSize(0), "output");
+        map->SetInputBuffer(0, inputView.Data());
+        map->ComputeInto(outputView.Data());
+    }
 }
 
 %extend CompiledMap 
@@ -613,6 +806,34 @@ namespace ELL_API
         std::vector<void*> outputs = GetOutputBuffersFromList(map, outputList);
         self->GetInnerCompiledMap()->ComputeMultiple(inputs, outputs);
     }
+
+    void ComputeBuffer(PyObject* input, PyObject* output)
+    {
+        if (self->HasSourceNodes())
+        {
+            throw std::invalid_argument("Cannot use ComputeBuffer on a model with Source and Sink nodes, use RegisterCallbacks and Step instead");
+        }
+        auto map = self->GetInnerMap();
+        PyBufferView inputView(input, false);
+        PyBufferView outputView(output, true);
+        CheckBufferMatchesPort(inputView, map->GetInputType(0), map->GetInputSize(0), "input");
+        CheckBufferMatchesPort(outputView, map->GetOutputType(0), map->GetOutputSize(0), "output");
+        auto compiledMap = self->GetInnerCompiledMap();
+        compiledMap->SetInputBuffer(0, inputView.Data());
+        compiledMap->ComputeInto(outputView.Data());
+    }
+}
+
+%extend CompiledMapInvocation
+{
+    void Bind(PyObject* input, PyObject* output)
+    {
+        // The caller owns the arrays and must keep them alive for the lifetime of the
+        // invocation (the CreateInvocation wrapper stores them on the invocation object)
+        PyBufferView inputView(input, false);
+        PyBufferView outputView(output, true);
+        self->SetBuffers(inputView.Data(), inputView.NumElements() * inputView.ItemSize(), outputView.Data(), outputView.NumElements() * outputView.ItemSize());
+    }
 }
 
 }
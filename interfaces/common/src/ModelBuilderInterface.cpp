@@ -27,6 +27,7 @@
 #include <nodes/include/BufferNode.h>
 #include <nodes/include/ClockNode.h>
 #include <nodes/include/ConcatenationNode.h>
+#include <nodes/include/ConstantNode.h>
 #include <nodes/include/DCTNode.h>
 #include <nodes/include/DTWDistanceNode.h>
 #include <nodes/include/DotProductNode.h>
@@ -61,6 +62,7 @@
 
 #include <utilities/include/Boolean.h>
 #include <utilities/include/Exception.h>
+#include <utilities/include/Hash.h>
 
 #include <algorithm>
 
@@ -600,57 +602,76 @@ SourceNode ModelBuilder::AddSourceNode(Model model, PortElements input, PortType
     return SourceNode(newNode, model.GetModel());
 }
 
+template <typename ElementType>
+Node ModelBuilder::FindOrAddConstantNode(Model model, std::vector<ElementType> values, const ell::model::PortMemoryLayout* outputMemoryLayout)
+{
+    auto modelPtr = model.GetModel();
+    auto outputLayout = outputMemoryLayout != nullptr ? *outputMemoryLayout : ell::model::PortMemoryLayout(ell::model::MemoryShape{ static_cast<int>(values.size()) });
+
+    // The content hash is only a first-level filter: candidates are verified element-by-element
+    // (and by layout), so a hash collision can never merge two different tensors
+    size_t contentHash = 0;
+    ell::utilities::HashCombine(contentHash, values.size());
+    for (const auto& value : values)
+    {
+        ell::utilities::HashCombine(contentHash, static_cast<ElementType>(value));
+    }
+    auto& candidates = _constantPool[contentHash];
+    for (const auto& candidate : candidates)
+    {
+        if (candidate.first.lock() != modelPtr)
+        {
+            continue;
+        }
+        auto constantNode = dynamic_cast<ell::nodes::ConstantNode<ElementType>*>(candidate.second);
+        if (constantNode != nullptr && constantNode->GetValues() == values && constantNode->output.GetMemoryLayout() == outputLayout)
+        {
+            return Node(constantNode, modelPtr);
+        }
+    }
+
+    auto newNode = modelPtr->AddNode<ell::nodes::ConstantNode<ElementType>>(values, outputLayout);
+    candidates.emplace_back(modelPtr, newNode);
+    return Node(newNode, modelPtr);
+}
+
 Node ModelBuilder::AddConstantNode(Model model, std::vector<double> values, PortType type)
 {
-    ell::model::Node* newNode = nullptr;
     switch (type)
     {
     case PortType::boolean:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<bool>>(CastVector<bool>(values));
-        break;
+        return FindOrAddConstantNode<bool>(model, CastVector<bool>(values), nullptr);
     case PortType::integer:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<int>>(CastVector<int>(values));
-        break;
+        return FindOrAddConstantNode<int>(model, CastVector<int>(values), nullptr);
     case PortType::bigInt:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<int64_t>>(CastVector<int64_t>(values));
-        break;
+        return FindOrAddConstantNode<int64_t>(model, CastVector<int64_t>(values), nullptr);
     case PortType::real:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<double>>(CastVector<double>(values));
-        break;
+        return FindOrAddConstantNode<double>(model, values, nullptr);
     case PortType::smallReal:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<float>>(CastVector<float>(values));
-        break;
+        return FindOrAddConstantNode<float>(model, CastVector<float>(values), nullptr);
     default:
         throw std::invalid_argument("Error: could not create ConstantNode of the requested type");
     }
-    return Node(newNode, model.GetModel());
 }
 
 Node ModelBuilder::AddConstantNode(Model model, std::vector<double> values, const PortMemoryLayout& outputMemoryLayout, PortType type)
 {
     auto outputLayout = outputMemoryLayout.Get();
-    ell::model::Node* newNode = nullptr;
     switch (type)
     {
     case PortType::boolean:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<bool>>(CastVector<bool>(values), outputLayout);
-        break;
+        return FindOrAddConstantNode<bool>(model, CastVector<bool>(values), &outputLayout);
     case PortType::integer:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<int>>(CastVector<int>(values), outputLayout);
-        break;
+        return FindOrAddConstantNode<int>(model, CastVector<int>(values), &outputLayout);
     case PortType::bigInt:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<int64_t>>(CastVector<int64_t>(values), outputLayout);
-        break;
+        return FindOrAddConstantNode<int64_t>(model, CastVector<int64_t>(values), &outputLayout);
     case PortType::real:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<double>>(values, outputLayout);
-        break;
+        return FindOrAddConstantNode<double>(model, values, &outputLayout);
     case PortType::smallReal:
-        newNode = model.GetModel()->AddNode<ell::nodes::ConstantNode<float>>(CastVector<float>(values), outputLayout);
-        break;
+        return FindOrAddConstantNode<float>(model, CastVector<float>(values), &outputLayout);
     default:
         throw std::invalid_argument("Error: could not create ConstantNode of the requested type");
     }
-    return Node(newNode, model.GetModel());
 }
 
 Node ModelBuilder::AddUnaryOperationNode(Model model, PortElements input, UnaryOperationType op)
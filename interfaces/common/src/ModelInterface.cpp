@@ -813,6 +813,12 @@ void Map::Refine(int iterations)
     _map->Refine(iterations);
 }
 
+Map Map::Chain(const Map& second) const
+{
+    auto chained = std::make_shared<ell::model::Map>(ell::model::ChainMaps(*_map, *second.GetInnerMap()));
+    return Map(chained);
+}
+
 void Map::Load(const std::string& filename)
 {
     ell::common::MapLoadArguments args;
@@ -914,6 +920,23 @@ void Map::SetMetadataValue(const std::string& key, const std::string& value)
     _map->GetMetadata()[key] = value;
 }
 
+double MemoryFootprint::GetArithmeticIntensity() const
+{
+    auto totalBytes = weightBytes + totalActivationBytes;
+    return totalBytes == 0 ? 0.0 : static_cast<double>(multiplyAccumulates) / totalBytes;
+}
+
+MemoryFootprint Map::GetMemoryFootprint() const
+{
+    auto footprint = _map->GetMemoryFootprint();
+    MemoryFootprint result;
+    result.weightBytes = footprint.weightBytes;
+    result.peakActivationBytes = footprint.peakActivationBytes;
+    result.totalActivationBytes = footprint.totalActivationBytes;
+    result.multiplyAccumulates = footprint.multiplyAccumulates;
+    return result;
+}
+
 std::vector<double> Map::ComputeDouble(const AutoDataVector& inputData)
 {
     const ell::data::AutoDataVector& data = *(inputData._impl->_vector);
@@ -971,6 +994,89 @@ CompiledMap Map::Compile(const std::string& targetDevice, const std::string& mod
     return CompiledMap(std::move(compiler), std::move(compiledMap), _map);
 }
 
+//
+// CompiledMapInvocation
+//
+namespace
+{
+    size_t GetPortTypeByteSize(ell::model::Port::PortType type)
+    {
+        switch (type)
+        {
+        case ell::model::Port::PortType::smallReal:
+            return sizeof(float);
+        case ell::model::Port::PortType::real:
+            return sizeof(double);
+        case ell::model::Port::PortType::integer:
+            return sizeof(int);
+        case ell::model::Port::PortType::bigInt:
+            return sizeof(int64_t);
+        case ell::model::Port::PortType::boolean:
+            return sizeof(int8_t);
+        default:
+            throw std::invalid_argument("Error: model has unsupported port type");
+        }
+    }
+} // namespace
+
+CompiledMapInvocation::CompiledMapInvocation(std::shared_ptr<ell::model::IRCompiledMap> map) :
+    _map(map),
+    _context(std::make_shared<ell::model::IRCompiledMap::ExecutionContext>(map->CreateContext())),
+    _inputByteSize(map->GetInputSize(0) * GetPortTypeByteSize(map->GetInput(0)->GetOutputPort().GetType())),
+    _outputByteSize(map->GetOutputSize(0) * GetPortTypeByteSize(map->GetOutput(0).GetType()))
+{
+}
+
+void CompiledMapInvocation::SetBuffers(const void* input, size_t inputByteSize, void* output, size_t outputByteSize)
+{
+    if (inputByteSize != _inputByteSize)
+    {
+        throw std::invalid_argument("Error: input buffer is the wrong size for this map");
+    }
+    if (outputByteSize != _outputByteSize)
+    {
+        throw std::invalid_argument("Error: output buffer is the wrong size for this map");
+    }
+    _input = input;
+    _output = output;
+}
+
+void CompiledMapInvocation::Compute()
+{
+    if (_input == nullptr || _output == nullptr)
+    {
+        throw std::invalid_argument("Error: buffers must be bound before calling Compute on a CompiledMapInvocation");
+    }
+    _context->Compute(_input, _output);
+}
+
+//
+// StateSession
+//
+StateSession::StateSession(const std::shared_ptr<ell::model::IRCompiledMap>& map, const std::shared_ptr<ell::model::IRCompiledMap::StateSession>& session) :
+    _map(map),
+    _session(session)
+{
+}
+
+void StateSession::Activate()
+{
+    if (_map == nullptr)
+    {
+        throw std::invalid_argument("Error: this session was not created by CompiledMap::CreateSession");
+    }
+    _map->SwitchToSession(_session);
+}
+
+void StateSession::Reset()
+{
+    if (_map == nullptr)
+    {
+        throw std::invalid_argument("Error: this session was not created by CompiledMap::CreateSession");
+    }
+    _map->ResetSession(_session);
+}
+
 //
 // CompiledMap
 //
@@ -1110,6 +1216,24 @@ std::vector<int64_t> CompiledMap::ComputeInt64(const std::vector<int64_t>& input
     return {};
 }
 
+CompiledMapInvocation CompiledMap::CreateInvocation()
+{
+    if (_compiledMap == nullptr)
+    {
+        throw std::invalid_argument("Error: no compiled map to create an invocation for");
+    }
+    return CompiledMapInvocation(_compiledMap);
+}
+
+StateSession CompiledMap::CreateSession()
+{
+    if (_compiledMap == nullptr)
+    {
+        throw std::invalid_argument("Error: no compiled map to create a session for");
+    }
+    return StateSession(_compiledMap, _compiledMap->CreateSession());
+}
+
 void CompiledMap::Reset()
 {
     if (_compiledMap != nullptr)
@@ -19,13 +19,15 @@ namespace ell
 {
 namespace common
 {
-    /// <summary> Loads a model from a file, or creates a new one if given an empty filename. </summary>
+    /// <summary> Loads a model from a file, or creates a new one if given an empty filename.
+    /// Files with the ".ellb" extension are read using the compact binary archive format. </summary>
     ///
     /// <param name="filename"> The filename. </param>
     /// <returns> The loaded model. </returns>
     model::Model LoadModel(const std::string& filename);
 
-    /// <summary> Saves a model to a file. </summary>
+    /// <summary> Saves a model to a file. Files with the ".ellb" extension are written using the
+    /// compact binary archive format. </summary>
     ///
     /// <param name="model"> The model. </param>
     /// <param name="filename"> The filename. </param>
@@ -47,7 +49,8 @@ namespace common
     /// <param name="context"> The `SerializationContext` </param>
     void RegisterMapTypes(utilities::SerializationContext& context);
 
-    /// <summary> Loads a map from a file, or creates a new one if given an empty filename. </summary>
+    /// <summary> Loads a map from a file, or creates a new one if given an empty filename.
+    /// Files with the ".ellb" extension are read using the compact binary archive format. </summary>
     ///
     /// <param name="filename"> The filename. </param>
     /// <returns> The loaded map. </returns>
@@ -59,7 +62,8 @@ namespace common
     /// <returns> The loaded map. </returns>
     model::Map LoadMap(const MapLoadArguments& mapLoadArguments);
 
-    /// <summary> Saves a map to a file. </summary>
+    /// <summary> Saves a map to a file. Files with the ".ellb" extension are written using the
+    /// compact binary archive format. </summary>
     ///
     /// <param name="map"> The map. </param>
     /// <param name="filename"> The filename. </param>
@@ -92,19 +96,21 @@ namespace common
 #include <utilities/include/Files.h>
 #include <utilities/include/JsonArchiver.h>
 
+#include <utility>
+
 namespace ell
 {
 namespace common
 {
     // STYLE internal use only from implementation, so not declared in main part of header file
-    template <typename UnarchiverType>
-    model::Map LoadArchivedMap(std::istream& stream)
+    template <typename UnarchiverType, typename SourceType>
+    model::Map LoadArchivedMap(SourceType&& source)
     {
         utilities::SerializationContext context;
         RegisterNodeTypes(context);
         RegisterMapTypes(context);
         AddCustomTypes(context);
-        UnarchiverType unarchiver(stream, context);
+        UnarchiverType unarchiver(std::forward<SourceType>(source), context);
         model::Map map;
         unarchiver.Unarchive(map);
         return map;
@@ -15,6 +15,7 @@
 #include <utilities/include/Optional.h>
 #include <utilities/include/PropertyBag.h>
 
+#include <map>
 #include <string>
 
 namespace ell
@@ -36,6 +37,8 @@ namespace common
 
         // ELL codegen options
         bool profile = false;
+        bool profileHardwareCounters = false;
+        bool profileTelemetry = false;
         bool optimize = true;
         bool useBlas = false;
         bool debug = false;
@@ -47,16 +50,27 @@ namespace common
         int vectorWidth = 4;
         bool parallelize = true;
         bool useThreadPool = true;
+        bool useSharedRuntime = false;
         int maxThreads = 4;
+        emitters::ThreadAffinityPolicy threadAffinityPolicy = emitters::ThreadAffinityPolicy::none;
 
         // optimization options (configurable per-node)
         bool fuseLinearOperations = true;
+        bool fuseBroadcastOperations = true;
         bool optimizeReorderDataNodes = true;
+        bool assignDataLayouts = true;
+        bool eliminateRedundantNodes = true;
         PreferredConvolutionMethod convolutionMethod = PreferredConvolutionMethod::automatic; // known methods: auto, unrolled, simple, diagonal, winograd
+        int winogradTileSize = 2; // output tile size for Winograd convolution (2 or 4)
+        bool useFixedPointFullyConnected = false;
+        double fixedPointInputRange = 1.0; // max absolute input value for fixed-point layers, from calibration
+        bool sparsifyMatrixMultiply = false;
+        double sparseDensityThreshold = 0.25; // max fraction of nonzeros for a matrix to be compiled sparse
 
         // raw options to store in metadata
         std::vector<std::string> modelOptions; // in format "<option-name>,<option-value-string>"
         std::vector<std::string> nodeOptions; // in format "<node-id>,<option-name>,<option-value-string>"
+        std::string convolutionMethodMapFilename; // JSON file mapping node ids to measured-best convolution methods
 
         // target machine options
         std::string target = ""; // known target names: host, mac, linux, windows, pi0, pi3, pi3_64, aarch64, ios
@@ -90,6 +104,15 @@ namespace common
         /// <returns> A `PropertyBag` with relevant options for the model and nodes. </returns>
         utilities::PropertyBag GetOptionsMetadata() const;
 
+        /// <summary> Loads the per-node convolution method map, if a file was given. The file is a
+        /// flat JSON object mapping node ids to method names, for instance
+        /// `{ "1234": "winograd", "1240": "simple" }`, typically distilled from per-node profiler
+        /// measurements. The result is meant to be handed to `MapCompiler::SetNodeOptimizerOptions`,
+        /// so the measured choices apply in a single compile pass without modifying the model. </summary>
+        ///
+        /// <returns> A map from node id to the optimizer options to apply to that node. </returns>
+        std::map<std::string, model::ModelOptimizerOptions> GetConvolutionMethodMap() const;
+
     private:
         utilities::PropertyBag GetModelOptionsMetadata() const;
         utilities::PropertyBag GetNodeOptionsMetadata() const;
@@ -18,32 +18,116 @@
 #include <data/include/SingleLineParsingExampleIterator.h>
 #include <data/include/WeightLabel.h>
 
+#include <algorithm>
+#include <future>
 #include <memory>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace ell
 {
 namespace common
 {
+    namespace
+    {
+        // Parses a whole stream into a dataset, splitting the parsing work across a pool of
+        // worker threads: the lines are read sequentially (I/O bound), contiguous chunks of
+        // them are parsed concurrently (CPU bound, and the dominant cost), and the parsed
+        // examples are spliced back together in line order.
+        template <typename MetadataParserType>
+        auto ParseDatasetParallel(std::istream& stream)
+        {
+            using DataVectorParserType = data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>;
+            using ExampleType = data::ParserExample<DataVectorParserType, MetadataParserType>;
+
+            data::SequentialLineIterator lineIterator(stream);
+            std::vector<data::TextLine> lines;
+            while (lineIterator.IsValid())
+            {
+                lines.push_back(lineIterator.GetTextLine());
+                lineIterator.Next();
+            }
+
+            auto parseLines = [](const data::TextLine* begin, const data::TextLine* end) {
+                std::vector<ExampleType> examples;
+                for (auto current = begin; current != end; ++current)
+                {
+                    // skip lines that contain just whitespace or just a comment
+                    data::TextLine line = *current;
+                    line.TrimLeadingWhitespace();
+                    if (line.IsEndOfContent())
+                    {
+                        continue;
+                    }
+
+                    auto metadata = MetadataParserType::Parse(line);
+                    auto dataVector = DataVectorParserType::Parse(line);
+                    examples.emplace_back(std::move(dataVector), std::move(metadata));
+                }
+                return examples;
+            };
+
+            data::Dataset<ExampleType> dataset;
+
+            const size_t minChunkSize = 1024; // too little parsing work to be worth a thread
+            size_t maxWorkers = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            size_t numWorkers = std::min(maxWorkers, (lines.size() + minChunkSize - 1) / minChunkSize);
+            if (numWorkers <= 1)
+            {
+                for (auto& example : parseLines(lines.data(), lines.data() + lines.size()))
+                {
+                    dataset.AddExample(std::move(example));
+                }
+                return dataset;
+            }
+
+            size_t chunkSize = (lines.size() + numWorkers - 1) / numWorkers;
+            std::vector<std::future<std::vector<ExampleType>>> futures;
+            futures.reserve(numWorkers);
+            for (size_t start = 0; start < lines.size(); start += chunkSize)
+            {
+                size_t end = std::min(start + chunkSize, lines.size());
+                futures.push_back(std::async(std::launch::async, parseLines, lines.data() + start, lines.data() + end));
+            }
+
+            for (auto& future : futures)
+            {
+                for (auto& example : future.get())
+                {
+                    dataset.AddExample(std::move(example));
+                }
+            }
+            return dataset;
+        }
+    } // namespace
 
     data::AutoSupervisedExampleIterator GetAutoSupervisedExampleIterator(std::istream& stream)
     {
-        return GetExampleIterator<data::SequentialLineIterator, data::LabelParser, data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>>(stream);
+        // read ahead on a background thread, so parsing overlaps with disk I/O
+        return data::MakeSingleLineParsingExampleIterator(
+            data::SequentialLineIterator(stream, '\n', true),
+            data::LabelParser(),
+            data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>());
     }
 
     data::AutoSupervisedMultiClassExampleIterator GetAutoSupervisedMultiClassExampleIterator(std::istream& stream)
     {
-        return GetExampleIterator<data::SequentialLineIterator, data::ClassIndexParser, data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>>(stream);
+        // read ahead on a background thread, so parsing overlaps with disk I/O
+        return data::MakeSingleLineParsingExampleIterator(
+            data::SequentialLineIterator(stream, '\n', true),
+            data::ClassIndexParser(),
+            data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>());
     }
 
     data::AutoSupervisedDataset GetDataset(std::istream& stream)
     {
-        return data::MakeDataset(GetExampleIterator<data::SequentialLineIterator, data::LabelParser, data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>>(stream));
+        return ParseDatasetParallel<data::LabelParser>(stream);
     }
 
     data::AutoSupervisedMultiClassDataset GetMultiClassDataset(std::istream& stream)
     {
-        return data::MakeDataset(GetExampleIterator<data::SequentialLineIterator, data::ClassIndexParser, data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>>(stream));
+        return ParseDatasetParallel<data::ClassIndexParser>(stream);
     }
 } // namespace common
 } // namespace ell
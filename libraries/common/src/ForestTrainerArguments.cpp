@@ -32,6 +32,12 @@ namespace common
                          "The number of boosting rounds to perform",
                          "10");
 
+        parser.AddOption(numThreads,
+                         "numThreads",
+                         "nt",
+                         "The number of threads used to evaluate candidate split rules",
+                         1);
+
         parser.AddOption(randomSeed,
                          "randomSeed",
                          "rs",
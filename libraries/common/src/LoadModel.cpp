@@ -34,6 +34,7 @@
 #include <nodes/include/FFTNode.h>
 #include <nodes/include/FilterBankNode.h>
 #include <nodes/include/ForestPredictorNode.h>
+#include <nodes/include/GateNode.h>
 #include <nodes/include/GRUNode.h>
 #include <nodes/include/HammingWindowNode.h>
 #include <nodes/include/IIRFilterNode.h>
@@ -57,6 +58,7 @@
 #include <nodes/include/SimpleConvolutionNode.h>
 #include <nodes/include/SinkNode.h>
 #include <nodes/include/SourceNode.h>
+#include <nodes/include/SparseMatrixVectorMultiplyNode.h>
 #include <nodes/include/SpatialConvolutionNode.h>
 #include <nodes/include/UnaryOperationNode.h>
 #include <nodes/include/UnrolledConvolutionNode.h>
@@ -77,8 +79,10 @@
 #include <predictors/neural/include/TanhActivation.h>
 
 #include <utilities/include/Archiver.h>
+#include <utilities/include/BinaryArchiver.h>
 #include <utilities/include/Files.h>
 #include <utilities/include/JsonArchiver.h>
+#include <utilities/include/MemoryMappedFile.h>
 
 #include <cstdint>
 
@@ -121,6 +125,7 @@ namespace common
         context.GetTypeFactory().AddType<model::Node, nodes::DTWDistanceNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::FastGRNNNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::FFTNode<ElementType>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::GateNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::GRUNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::HammingWindowNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::L2NormSquaredNode<ElementType>>();
@@ -146,6 +151,7 @@ namespace common
         context.GetTypeFactory().AddType<model::Node, nodes::SimpleConvolutionNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::SinkNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::SourceNode<ElementType>>();
+        context.GetTypeFactory().AddType<model::Node, nodes::SparseMatrixVectorMultiplyNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::SpatialConvolutionNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::SumNode<ElementType>>();
         context.GetTypeFactory().AddType<model::Node, nodes::TypeCastNode<bool, ElementType>>();
@@ -298,12 +304,12 @@ namespace common
         context.GetTypeFactory().AddType<model::Map, model::Map>();
     }
 
-    template <typename UnarchiverType>
-    model::Model LoadArchivedModel(std::istream& stream)
+    template <typename UnarchiverType, typename SourceType>
+    model::Model LoadArchivedModel(SourceType&& source)
     {
         SerializationContext context;
         RegisterNodeTypes(context);
-        UnarchiverType unarchiver(stream, context);
+        UnarchiverType unarchiver(std::forward<SourceType>(source), context);
         model::Model model;
         unarchiver.Unarchive(model);
         return model;
@@ -316,6 +322,12 @@ namespace common
         archiver.Archive(obj);
     }
 
+    // models and maps with the ".ellb" extension use the compact binary archive format
+    static bool HasBinaryFileExtension(const std::string& filename)
+    {
+        return GetFileExtension(filename, true) == "ellb";
+    }
+
     model::Model LoadModel(const std::string& filename)
     {
         if (!IsFileReadable(filename))
@@ -323,6 +335,13 @@ namespace common
             throw SystemException(SystemExceptionErrors::fileNotFound);
         }
 
+        if (HasBinaryFileExtension(filename))
+        {
+            // memory-map binary archives so pages are faulted in on demand and clean pages are
+            // shared with other processes reading the same model
+            return LoadArchivedModel<BinaryUnarchiver>(std::make_shared<MemoryMappedFile>(filename));
+        }
+
         auto filestream = OpenIfstream(filename);
         return LoadArchivedModel<JsonUnarchiver>(filestream);
     }
@@ -333,6 +352,14 @@ namespace common
         {
             throw SystemException(SystemExceptionErrors::fileNotWritable);
         }
+
+        if (HasBinaryFileExtension(filename))
+        {
+            auto filestream = OpenBinaryOfstream(filename);
+            SaveArchivedObject<BinaryArchiver>(model, filestream);
+            return;
+        }
+
         auto filestream = OpenOfstream(filename);
         SaveModel(model, filestream);
     }
@@ -418,10 +445,14 @@ namespace common
             throw SystemException(SystemExceptionErrors::fileNotFound, "File not found '" + filename + "'");
         }
 
-        auto filestream = OpenIfstream(filename);
-
         try
         {
+            if (HasBinaryFileExtension(filename))
+            {
+                return LoadArchivedMap<BinaryUnarchiver>(std::make_shared<MemoryMappedFile>(filename));
+            }
+
+            auto filestream = OpenIfstream(filename);
             return LoadArchivedMap<JsonUnarchiver>(filestream);
         }
         catch (const std::exception& ex)
@@ -436,6 +467,14 @@ namespace common
         {
             throw SystemException(SystemExceptionErrors::fileNotWritable);
         }
+
+        if (HasBinaryFileExtension(filename))
+        {
+            auto filestream = OpenBinaryOfstream(filename);
+            SaveArchivedObject<BinaryArchiver>(map, filestream);
+            return;
+        }
+
         auto filestream = OpenOfstream(filename);
         SaveMap(map, filestream);
     }
@@ -9,10 +9,14 @@
 #include "MapCompilerArguments.h"
 
 #include <utilities/include/Archiver.h>
+#include <utilities/include/Exception.h>
 #include <utilities/include/Files.h>
 #include <utilities/include/JsonArchiver.h>
 #include <utilities/include/StringUtil.h>
 
+#include <cctype>
+#include <iterator>
+
 namespace ell
 {
 namespace common
@@ -41,6 +45,20 @@ namespace common
             "Emit profiling code",
             false);
 
+        parser.AddOption(
+            profileHardwareCounters,
+            "profileHardwareCounters",
+            "phc",
+            "Also read hardware performance counters (cache and branch misses) in profile regions (requires profiling; Linux targets only)",
+            false);
+
+        parser.AddOption(
+            profileTelemetry,
+            "profileTelemetry",
+            "ptm",
+            "Emit a telemetry ring buffer that profile regions write per-invocation records into, for continuous monitoring of the deployed model (requires profiling)",
+            false);
+
         parser.AddOption(
             optimize,
             "optimize",
@@ -62,6 +80,13 @@ namespace common
             "Fuse sequences of linear operations with constant coefficients into a single operation",
             true);
 
+        parser.AddOption(
+            fuseBroadcastOperations,
+            "fuseBroadcastOps",
+            "",
+            "Fuse chains of elementwise operations into kernels that make a single pass over the data",
+            true);
+
         parser.AddOption(
             optimizeReorderDataNodes,
             "optimizeReorderDataNodes",
@@ -69,6 +94,20 @@ namespace common
             "Optimize sequences of reordering nodes",
             true);
 
+        parser.AddOption(
+            assignDataLayouts,
+            "assignDataLayouts",
+            "",
+            "Assign memory layouts globally over chains of reorder and elementwise nodes, minimizing reorder traffic",
+            true);
+
+        parser.AddOption(
+            eliminateRedundantNodes,
+            "eliminateRedundantNodes",
+            "",
+            "Remove nodes that don't contribute to the output, and merge duplicate nodes that compute the same value",
+            true);
+
         parser.AddOption(
             convolutionMethod,
             "convolutionMethod",
@@ -81,6 +120,41 @@ namespace common
               { "auto", PreferredConvolutionMethod::automatic } },
             "auto");
 
+        parser.AddOption(
+            winogradTileSize,
+            "winogradTileSize",
+            "",
+            "Set the output tile size for Winograd convolution (2 or 4 --- larger tiles save more multiplies but need more cache)",
+            2);
+
+        parser.AddOption(
+            useFixedPointFullyConnected,
+            "fixedPointFullyConnected",
+            "fpfc",
+            "Replace fully-connected layers with fixed-point (int16) versions, for targets without an FPU",
+            false);
+
+        parser.AddOption(
+            fixedPointInputRange,
+            "fixedPointInputRange",
+            "fpir",
+            "The maximum absolute input value fixed-point layers are calibrated for (can be overridden per node with --nodeOption)",
+            1.0);
+
+        parser.AddOption(
+            sparsifyMatrixMultiply,
+            "sparsifyMatrixMultiply",
+            "",
+            "Compile matrix multiplies with mostly-zero constant matrices (from pruned models) using a compressed-index kernel that skips the zeros",
+            false);
+
+        parser.AddOption(
+            sparseDensityThreshold,
+            "sparseDensityThreshold",
+            "",
+            "The maximum fraction of nonzero entries for a matrix to be compiled sparse (denser matrices stay dense)",
+            0.25);
+
         parser.AddOption(
             modelOptions,
             "modelOption",
@@ -95,6 +169,13 @@ namespace common
             "Add a node-specific option",
             std::vector<std::string>{});
 
+        parser.AddOption(
+            convolutionMethodMapFilename,
+            "convolutionMethodMap",
+            "cmm",
+            "A JSON file mapping node ids to convolution methods (typically from profiler measurements), applied per node in a single compile pass",
+            "");
+
         parser.AddOption(
             enableVectorization,
             "vectorize",
@@ -123,6 +204,13 @@ namespace common
             "Use thread pool for parallelization (if parallelization enabled)",
             true);
 
+        parser.AddOption(
+            useSharedRuntime,
+            "sharedRuntime",
+            "srt",
+            "Emit the thread pool with linkage that lets several emitted modules statically linked into one binary share a single pool of worker threads (all modules must use the same number of threads)",
+            false);
+
         parser.AddOption(
             maxThreads,
             "threads",
@@ -130,6 +218,18 @@ namespace common
             "Maximum num of parallel threads",
             4);
 
+        parser.AddOption(
+            threadAffinityPolicy,
+            "threadAffinity",
+            "ta",
+            "Which cores the thread pool's workers may run on, for big.LITTLE targets (Linux only; requires a target device with big/little core masks)",
+            { { "none", emitters::ThreadAffinityPolicy::none },
+              { "big", emitters::ThreadAffinityPolicy::bigCoresOnly },
+              { "little", emitters::ThreadAffinityPolicy::littleCoresOnly },
+              { "latency", emitters::ThreadAffinityPolicy::bigCoresOnly },
+              { "efficiency", emitters::ThreadAffinityPolicy::littleCoresOnly } },
+            "none");
+
         parser.AddOption(
             debug,
             "debug",
@@ -241,9 +341,13 @@ namespace common
         settings.compilerSettings.useBlas = useBlas;
         settings.compilerSettings.allowVectorInstructions = enableVectorization;
         settings.compilerSettings.parallelize = parallelize;
+        settings.compilerSettings.useSharedRuntime = useSharedRuntime;
+        settings.compilerSettings.threadAffinityPolicy = threadAffinityPolicy;
         settings.compilerSettings.vectorWidth = vectorWidth;
         settings.profile = profile;
         settings.compilerSettings.profile = profile;
+        settings.compilerSettings.profileHardwareCounters = profileHardwareCounters;
+        settings.compilerSettings.profileTelemetry = profileTelemetry;
         settings.compilerSettings.positionIndependentCode = positionIndependentCode;
         settings.compilerSettings.globalValueAlignment = globalValueAlignment;
         settings.compilerSettings.skip_ellcode = skip_ellcode;
@@ -292,8 +396,16 @@ namespace common
     {
         model::ModelOptimizerOptions options;
         options["fuseLinearFunctionNodes"] = fuseLinearOperations;
+        options["fuseBroadcastOperations"] = fuseBroadcastOperations;
         options["optimizeReorderDataNodes"] = optimizeReorderDataNodes;
+        options["assignDataLayouts"] = assignDataLayouts;
+        options["eliminateRedundantNodes"] = eliminateRedundantNodes;
         options["preferredConvolutionMethod"] = convolutionMethod;
+        options["winogradTileSize"] = winogradTileSize;
+        options["useFixedPointFullyConnected"] = useFixedPointFullyConnected;
+        options["fixedPointInputRange"] = fixedPointInputRange;
+        options["sparsifyMatrixMultiply"] = sparsifyMatrixMultiply;
+        options["sparseDensityThreshold"] = sparseDensityThreshold;
 
         auto metadata = GetOptionsMetadata();
         if (metadata.HasEntry("model"))
@@ -304,6 +416,78 @@ namespace common
         return options;
     }
 
+    namespace
+    {
+        // Reads the next JSON token from `text`, starting at `pos`: either a quoted string
+        // (returned without the quotes) or a single punctuation character.
+        std::string GetNextJsonToken(const std::string& text, size_t& pos)
+        {
+            while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+            {
+                ++pos;
+            }
+            if (pos >= text.size())
+            {
+                return "";
+            }
+            if (text[pos] == '"')
+            {
+                auto end = text.find('"', pos + 1);
+                if (end == std::string::npos)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "Unterminated string in convolution method map");
+                }
+                auto token = text.substr(pos + 1, end - pos - 1);
+                pos = end + 1;
+                return token;
+            }
+            return std::string(1, text[pos++]);
+        }
+    } // namespace
+
+    std::map<std::string, model::ModelOptimizerOptions> MapCompilerArguments::GetConvolutionMethodMap() const
+    {
+        std::map<std::string, model::ModelOptimizerOptions> result;
+        if (convolutionMethodMapFilename.empty())
+        {
+            return result;
+        }
+
+        // The map file is a flat JSON object from node id to method name --- parse it directly,
+        // since the archiver's JSON format encodes typed variants
+        auto stream = utilities::OpenIfstream(convolutionMethodMapFilename);
+        std::string text(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        size_t pos = 0;
+        if (GetNextJsonToken(text, pos) != "{")
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "Convolution method map must be a JSON object");
+        }
+        auto token = GetNextJsonToken(text, pos);
+        while (token != "}")
+        {
+            auto nodeId = token;
+            if (GetNextJsonToken(text, pos) != ":")
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "Convolution method map entries must be in the format \"<node-id>\": \"<method>\"");
+            }
+            auto methodName = GetNextJsonToken(text, pos);
+            model::ModelOptimizerOptions options;
+            options["preferredConvolutionMethod"] = utilities::FromString<PreferredConvolutionMethod>(methodName); // throws on unknown method names
+            result[nodeId] = options;
+
+            token = GetNextJsonToken(text, pos);
+            if (token == ",")
+            {
+                token = GetNextJsonToken(text, pos);
+            }
+            else if (token != "}")
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::badStringFormat, "Malformed convolution method map");
+            }
+        }
+        return result;
+    }
+
     bool MapCompilerArguments::HasOptionsMetadata() const
     {
         return !nodeOptions.empty() || !modelOptions.empty();
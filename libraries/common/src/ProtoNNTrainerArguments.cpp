@@ -74,6 +74,12 @@ namespace common
                          "nInnerIter",
                          "Number of inner iterations",
                          1);
+
+        parser.AddOption(numThreads,
+                         "numThreads",
+                         "nt",
+                         "Number of threads used to compute the training objective",
+                         1);
     }
 } // namespace common
 } // namespace ell
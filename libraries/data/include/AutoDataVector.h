@@ -11,6 +11,7 @@
 #define APPROXIMATION_TOLERANCE 1.0e-9
 #define SPARSE_THRESHOLD 0.2
 
+#include "BinaryDataVector.h"
 #include "DataVector.h"
 #include "DenseDataVector.h"
 #include "SparseBinaryDataVector.h"
@@ -358,10 +359,14 @@ namespace data
             {
                 SetInternal<ShortDataVector>(std::move(defaultDataVector));
             }
-            else
+            else if (includesNonBinary)
             {
                 SetInternal<ByteDataVector>(std::move(defaultDataVector));
             }
+            else
+            {
+                SetInternal<BinaryDataVector>(std::move(defaultDataVector));
+            }
         }
 
         // sparse
@@ -0,0 +1,229 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryDataVector.h (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DataVector.h"
+#include "IndexValue.h"
+
+#ifndef BINARYDATAVECTOR_H
+#define BINARYDATAVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    // forward declaration
+    class BinaryDataVector;
+
+    // forward declaration
+    template <IterationPolicy policy>
+    class BinaryDataVectorIterator;
+
+    /// <summary> A dense iterator for BinaryDataVectors. </summary>
+    template <>
+    class BinaryDataVectorIterator<IterationPolicy::all> : public IIndexValueIterator
+    {
+    public:
+        BinaryDataVectorIterator(const BinaryDataVectorIterator<IterationPolicy::all>&) = default;
+
+        BinaryDataVectorIterator(BinaryDataVectorIterator<IterationPolicy::all>&&) = default;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next() { ++_index; }
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> The current iterate. </returns>
+        IndexValue Get() const;
+
+    private:
+        // private ctor that can only be called from the parent class
+        BinaryDataVectorIterator(const uint64_t* bits, size_t numStoredBits, size_t size);
+        friend class BinaryDataVector;
+
+        const uint64_t* _bits;
+        size_t _numStoredBits = 0;
+        size_t _size = 0;
+        size_t _index = 0;
+    };
+
+    /// <summary> A read-only forward iterator over the non-zero entries of a BinaryDataVector. </summary>
+    template <>
+    class BinaryDataVectorIterator<IterationPolicy::skipZeros> : public IIndexValueIterator
+    {
+    public:
+        BinaryDataVectorIterator(const BinaryDataVectorIterator<IterationPolicy::skipZeros>&) = default;
+
+        BinaryDataVectorIterator(BinaryDataVectorIterator<IterationPolicy::skipZeros>&&) = default;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next();
+
+        /// <summary> Returns The current value. </summary>
+        ///
+        /// <returns> An IndexValue. </returns>
+        IndexValue Get() const { return IndexValue{ _index, 1.0 }; }
+
+    private:
+        // private ctor, can only be called from the BinaryDataVector class.
+        BinaryDataVectorIterator(const uint64_t* bits, size_t numStoredBits, size_t size);
+        friend class BinaryDataVector;
+
+        // advances the index to the next set bit, skipping over entire words of zeros
+        void AdvanceToNextSetBit();
+
+        // members
+        const uint64_t* _bits;
+        size_t _size = 0;
+        size_t _index = 0;
+    };
+
+    /// <summary> Implements a dense binary vector as a packed array of bits, using one bit per
+    /// element instead of one byte or more. </summary>
+    class BinaryDataVector : public DataVectorBase<BinaryDataVector>
+    {
+    public:
+        BinaryDataVector() = default;
+
+        BinaryDataVector(BinaryDataVector&& other) = default;
+
+        BinaryDataVector(const BinaryDataVector& other) = delete;
+
+        /// <summary> Constructs a BinaryDataVector from an index value iterator. </summary>
+        ///
+        /// <typeparam name="IndexValueIteratorType"> Type of index value iterator. </typeparam>
+        /// <param name="indexValueIterator"> The index value iterator. </param>
+        template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept = true>
+        BinaryDataVector(IndexValueIteratorType indexValueIterator);
+
+        /// <summary> Constructs a data vector from an initializer list of index value pairs. </summary>
+        ///
+        /// <param name="list"> The initializer list. </param>
+        BinaryDataVector(std::initializer_list<IndexValue> list);
+
+        /// <summary> Constructs a data vector from an initializer list of values. </summary>
+        ///
+        /// <param name="list"> The initializer list of values. </param>
+        BinaryDataVector(std::initializer_list<double> list);
+
+        /// <summary> Constructs a data vector from a vector of index value pairs. </summary>
+        ///
+        /// <param name="list"> The initializer list. </param>
+        BinaryDataVector(std::vector<IndexValue> vec);
+
+        /// <summary> Constructs a data vector from a vector of values. </summary>
+        ///
+        /// <param name="list"> The initializer list of values. </param>
+        BinaryDataVector(std::vector<double> vec);
+
+        template <IterationPolicy policy>
+        using Iterator = BinaryDataVectorIterator<policy>;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of the vector.
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <param name="size"> The prefix size. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator(size_t size) const;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of length PrefixLength().
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator() const;
+
+        /// <summary> Sets the element at the given index to 1.0. Calls to this function must have a
+        /// monotonically increasing argument. The value argument must equal 0.0 or 1.0. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the. </param>
+        /// <param name="value"> The value. </param>
+        void AppendElement(size_t index, double value) override;
+
+        /// <summary>
+        /// A data vector has infinite dimension and ends with a suffix of zeros. This function returns
+        /// the first index in this suffix. Equivalently, the returned value is one plus the index of the
+        /// last non-zero element.
+        /// </summary>
+        ///
+        /// <returns> The first index of the suffix of zeros at the end of this vector. </returns>
+        size_t PrefixLength() const override { return _size; }
+
+        /// <summary> Computes the vector squared 2-norm. </summary>
+        ///
+        /// <returns> The squared 2-norm of the vector. </returns>
+        double Norm2Squared() const override;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        IDataVector::Type GetType() const override { return IDataVector::Type::BinaryDataVector; }
+
+    private:
+        using DataVectorBase<BinaryDataVector>::AppendElements;
+        std::vector<uint64_t> _bits;
+        size_t _size = 0;
+    };
+} // namespace data
+} // namespace ell
+
+#pragma region implementation
+
+#include <utilities/include/Exception.h>
+
+namespace ell
+{
+namespace data
+{
+    template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept>
+    BinaryDataVector::BinaryDataVector(IndexValueIteratorType indexValueIterator)
+    {
+        AppendElements(std::move(indexValueIterator));
+    }
+
+    template <IterationPolicy policy>
+    auto BinaryDataVector::GetIterator(size_t size) const -> Iterator<policy>
+    {
+        return Iterator<policy>(_bits.data(), _size, size);
+    }
+
+    template <IterationPolicy policy>
+    auto BinaryDataVector::GetIterator() const -> Iterator<policy>
+    {
+        return GetIterator<policy>(PrefixLength());
+    }
+} // namespace data
+} // namespace ell
+
+#pragma endregion implementation
+
+#endif // BINARYDATAVECTOR_H
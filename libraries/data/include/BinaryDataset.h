@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryDataset.h (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Dataset.h"
+#include "ExampleIterator.h"
+
+#include <iosfwd>
+#include <string>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary>
+    /// Functions for reading and writing datasets in ELL's binary dataset file format. Unlike the
+    /// text formats, which have to be parsed line by line, a binary dataset file is memory-mapped
+    /// and its examples are materialized directly from the raw feature blocks, so loading streams
+    /// at disk bandwidth.
+    ///
+    /// The file layout is a fixed header, a sequence of example records, and an offset index:
+    ///
+    ///     char[4]     magic "ELLD"
+    ///     uint32      format version (currently 1)
+    ///     uint64      number of examples
+    ///     uint64      byte offset of the offset index
+    ///
+    /// each example record:
+    ///
+    ///     double      weight
+    ///     double      label
+    ///     uint64      number of values
+    ///     double[]    values (the dense prefix of the data vector)
+    ///
+    /// offset index:
+    ///
+    ///     uint64[]    byte offset of each example record, in example order
+    ///
+    /// All values are stored little-endian (the native byte order of every platform ELL targets).
+    /// </summary>
+
+    /// <summary> Writes the examples produced by an iterator to a stream in the binary dataset format. </summary>
+    ///
+    /// <param name="stream"> The binary output stream to write to. </param>
+    /// <param name="exampleIterator"> The example iterator. </param>
+    void WriteBinaryDataset(std::ostream& stream, AutoSupervisedExampleIterator exampleIterator);
+
+    /// <summary> Writes a dataset to a stream in the binary dataset format. </summary>
+    ///
+    /// <param name="stream"> The binary output stream to write to. </param>
+    /// <param name="dataset"> The dataset. </param>
+    void WriteBinaryDataset(std::ostream& stream, const AutoSupervisedDataset& dataset);
+
+    /// <summary> Gets an example iterator that lazily materializes examples from a memory-mapped
+    /// binary dataset file. The mapping is shared by the examples' data and released when the last
+    /// of them is destroyed. </summary>
+    ///
+    /// <param name="filename"> Path of the binary dataset file. </param>
+    ///
+    /// <returns> The example iterator. </returns>
+    AutoSupervisedExampleIterator GetBinaryDatasetExampleIterator(const std::string& filename);
+
+    /// <summary> Gets an example iterator over one shard of a memory-mapped binary dataset file,
+    /// for multi-process data-parallel training. Shard shardIndex visits examples shardIndex,
+    /// shardIndex + shardCount, shardIndex + 2 * shardCount, and so on, so the shardCount shards
+    /// are deterministic, disjoint, and together cover the file exactly once. Each process maps
+    /// the same file, so no example is duplicated in memory or on disk. </summary>
+    ///
+    /// <param name="filename"> Path of the binary dataset file. </param>
+    /// <param name="shardIndex"> Zero-based index of the shard. </param>
+    /// <param name="shardCount"> The total number of shards. </param>
+    ///
+    /// <returns> The example iterator. </returns>
+    AutoSupervisedExampleIterator GetBinaryDatasetShardExampleIterator(const std::string& filename, size_t shardIndex, size_t shardCount);
+
+    /// <summary> Gets an example iterator that visits a memory-mapped binary dataset file in
+    /// approximately shuffled order, holding at most shuffleBufferSize examples in memory. This
+    /// gives SGD-style trainers a decorrelated example order on datasets larger than RAM, where
+    /// loading the dataset and calling RandomPermute is not an option. </summary>
+    ///
+    /// <param name="filename"> Path of the binary dataset file. </param>
+    /// <param name="shuffleBufferSize"> The number of examples to hold in memory. </param>
+    /// <param name="randomSeedString"> The random seed string. </param>
+    ///
+    /// <returns> The example iterator. </returns>
+    AutoSupervisedExampleIterator GetShuffledBinaryDatasetExampleIterator(const std::string& filename, size_t shuffleBufferSize, std::string randomSeedString = "");
+
+    /// <summary> Reads a dataset from a memory-mapped binary dataset file. </summary>
+    ///
+    /// <param name="filename"> Path of the binary dataset file. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    AutoSupervisedDataset ReadBinaryDataset(const std::string& filename);
+
+    /// <summary> Converts a dataset from the sparse or dense text formats to the binary dataset
+    /// format. The examples are streamed through one at a time, so the dataset is never held in
+    /// memory in its entirety. </summary>
+    ///
+    /// <param name="textStream"> The text input stream to parse. </param>
+    /// <param name="binaryStream"> The binary output stream to write to. </param>
+    void ConvertTextToBinaryDataset(std::istream& textStream, std::ostream& binaryStream);
+} // namespace data
+} // namespace ell
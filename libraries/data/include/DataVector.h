@@ -36,6 +36,7 @@ namespace data
             FloatDataVector,
             ShortDataVector,
             ByteDataVector,
+            BinaryDataVector,
             SparseDoubleDataVector,
             SparseFloatDataVector,
             SparseShortDataVector,
@@ -435,6 +436,7 @@ namespace data
 
 #pragma region implementation
 
+#include "BinaryDataVector.h"
 #include "DenseDataVector.h"
 #include "SparseBinaryDataVector.h"
 #include "SparseDataVector.h"
@@ -462,6 +464,9 @@ namespace data
         case Type::ByteDataVector:
             return lambda(static_cast<const ByteDataVector*>(this));
 
+        case Type::BinaryDataVector:
+            return lambda(static_cast<const BinaryDataVector*>(this));
+
         case Type::SparseDoubleDataVector:
             return lambda(static_cast<const SparseDoubleDataVector*>(this));
 
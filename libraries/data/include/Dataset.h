@@ -16,6 +16,7 @@
 #include <utilities/include/AbstractInvoker.h>
 #include <utilities/include/TypeTraits.h>
 
+#include <algorithm>
 #include <functional>
 #include <ostream>
 #include <random>
@@ -54,6 +55,17 @@ namespace data
         template <typename ExampleType>
         ExampleIterator<ExampleType> GetExampleIterator() const;
 
+        /// <summary> Gets an iterator that references the stored examples without copying them, for
+        /// iteration loops that don't need copy semantics. Each reference handed out remains owned
+        /// by the dataset and is only valid for the dataset's lifetime. Unlike GetExampleIterator,
+        /// the requested example type must be exactly the type stored in the dataset. </summary>
+        ///
+        /// <typeparam name="ExampleType"> Example type stored in the dataset. </typeparam>
+        ///
+        /// <returns> The example reference iterator. </returns>
+        template <typename ExampleType>
+        ExampleReferenceIterator<ExampleType> GetExampleReferenceIterator() const;
+
         /// <summary> Returns the number of examples in the dataset. </summary>
         ///
         /// <returns> Number of examples. </returns>
@@ -100,6 +112,35 @@ namespace data
             InternalIteratorType _end;
         };
 
+        /// <summary> Iterator class that visits every shardCount'th example. </summary>
+        template <typename IteratorExampleType>
+        class ShardExampleIterator : public IExampleIterator<IteratorExampleType>
+        {
+        public:
+            using InternalIteratorType = typename std::vector<DatasetExampleType>::const_iterator;
+
+            /// <summary></summary>
+            ShardExampleIterator(InternalIteratorType begin, InternalIteratorType end, size_t stride);
+
+            /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+            ///
+            /// <returns> true if the iterator is currently pointing to a valid iterate. </returns>
+            bool IsValid() const override { return _current < _end; }
+
+            /// <summary> Proceeds to the Next iterate. </summary>
+            void Next() override { _current += std::min(_stride, static_cast<size_t>(_end - _current)); }
+
+            /// <summary> Gets the current example pointer to by the iterator. </summary>
+            ///
+            /// <returns> The example. </returns>
+            IteratorExampleType Get() const override { return _current->template CopyAs<IteratorExampleType>(); }
+
+        private:
+            InternalIteratorType _current;
+            InternalIteratorType _end;
+            size_t _stride;
+        };
+
         Dataset() = default;
 
         Dataset(Dataset&&) = default;
@@ -182,6 +223,18 @@ namespace data
         /// <returns> The example reference iterator. </returns>
         ExampleReferenceIterator<DatasetExampleType> GetExampleReferenceIterator(size_t fromIndex = 0, size_t size = 0) const;
 
+        /// <summary> Returns an iterator over one shard of the dataset, for data-parallel training.
+        /// Shard shardIndex visits examples shardIndex, shardIndex + shardCount, shardIndex + 2 *
+        /// shardCount, and so on, without copying them, so the shardCount shards are deterministic,
+        /// disjoint, and together cover the dataset exactly once. </summary>
+        ///
+        /// <param name="shardIndex"> Zero-based index of the shard. </param>
+        /// <param name="shardCount"> The total number of shards. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = DatasetExampleType>
+        ExampleIterator<IteratorExampleType> GetShard(size_t shardIndex, size_t shardCount) const;
+
         /// <summary> Returns an AnyDataset that represents an interval of examples from this dataset. </summary>
         ///
         /// <param name="firstExample"> Zero-based index of the first example in the AnyDataset. </param>
@@ -320,6 +373,18 @@ namespace data
         return Invoker::Invoke<ExampleIterator<ExampleType>>(getExampleIterator, _pDataset);
     }
 
+    template <typename ExampleType>
+    ExampleReferenceIterator<ExampleType> AnyDataset::GetExampleReferenceIterator() const
+    {
+        auto pDataset = dynamic_cast<const Dataset<ExampleType>*>(_pDataset);
+        if (pDataset == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "requested example type does not match the type stored in the dataset");
+        }
+
+        return pDataset->GetExampleReferenceIterator(_fromIndex, _size);
+    }
+
     template <typename DatasetExampleType>
     template <typename IteratorExampleType>
     Dataset<DatasetExampleType>::DatasetExampleIterator<IteratorExampleType>::DatasetExampleIterator(InternalIteratorType begin, InternalIteratorType end) :
@@ -328,6 +393,15 @@ namespace data
     {
     }
 
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    Dataset<DatasetExampleType>::ShardExampleIterator<IteratorExampleType>::ShardExampleIterator(InternalIteratorType begin, InternalIteratorType end, size_t stride) :
+        _current(begin),
+        _end(end),
+        _stride(stride)
+    {
+    }
+
     template <typename DatasetExampleType>
     Dataset<DatasetExampleType>::Dataset(ExampleIterator<DatasetExampleType> exampleIterator)
     {
@@ -390,6 +464,19 @@ namespace data
         return ExampleReferenceIterator<DatasetExampleType>(_examples.cbegin() + fromIndex, _examples.cbegin() + fromIndex + size);
     }
 
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    ExampleIterator<IteratorExampleType> Dataset<DatasetExampleType>::GetShard(size_t shardIndex, size_t shardCount) const
+    {
+        if (shardCount == 0 || shardIndex >= shardCount)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "shard index must be smaller than the shard count");
+        }
+
+        auto begin = _examples.cbegin() + std::min(shardIndex, _examples.size());
+        return ExampleIterator<IteratorExampleType>(std::make_unique<ShardExampleIterator<IteratorExampleType>>(begin, _examples.cend(), shardCount));
+    }
+
     template <typename DatasetExampleType>
     void Dataset<DatasetExampleType>::AddExample(DatasetExampleType example)
     {
@@ -10,6 +10,8 @@
 #include "IndexValue.h"
 #include "TextLine.h"
 
+#include <vector>
+
 namespace ell
 {
 namespace data
@@ -45,9 +47,15 @@ namespace data
 
     private:
         void ReadEntry(size_t nextIndex);
+        void ParseDense();
         bool _isValid = true;
         TextLine& _textLine;
         IndexValue _currentIndexValue;
+
+        // bulk-parsed values of a dense line
+        bool _isDense = false;
+        std::vector<double> _denseValues;
+        size_t _denseNext = 0;
     };
 } // namespace data
 } // namespace ell
@@ -28,10 +28,22 @@ namespace data
         /// <param name="delim"> The delimiter. </param>
         SequentialLineIterator(std::istream& stream, char delim = '\n');
 
-        SequentialLineIterator(SequentialLineIterator&&) = default;
+        /// <summary> Constructs a sequential line iterator, optionally with asynchronous read-ahead.
+        /// In read-ahead mode a background thread reads lines from the stream into a bounded buffer
+        /// while previously read lines are being consumed, overlapping disk I/O with parsing. The
+        /// stream must not be used elsewhere while the iterator is alive. </summary>
+        ///
+        /// <param name="stream"> The input stream. </param>
+        /// <param name="delim"> The delimiter. </param>
+        /// <param name="readAhead"> True to read ahead on a background thread. </param>
+        SequentialLineIterator(std::istream& stream, char delim, bool readAhead);
+
+        SequentialLineIterator(SequentialLineIterator&&);
 
         SequentialLineIterator(const SequentialLineIterator&) = delete; // this ctor is deleted because a private member of this class cannot be copied
 
+        ~SequentialLineIterator();
+
         /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
         ///
         /// <returns> true if it succeeds, false if it fails. </returns>
@@ -46,10 +58,13 @@ namespace data
         TextLine GetTextLine() const { return _currentLine; }
 
     private:
+        struct ReadAheadBuffer;
+
         std::istream& _stream;
         bool _isValid = true;
         TextLine _currentLine;
         char _delim;
+        std::unique_ptr<ReadAheadBuffer> _readAheadBuffer;
     };
 } // namespace data
 } // namespace ell
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ShufflingExampleIterator.h (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ExampleIterator.h"
+
+#include <utilities/include/RandomEngines.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary>
+    /// An example iterator that approximately shuffles the order of another example iterator using a
+    /// bounded memory budget. The iterator maintains a buffer of examples drawn from the source
+    /// iterator; each iterate is chosen uniformly at random from the buffer and replaced with the
+    /// next source example. A buffer of size k decorrelates example order within a window of k
+    /// examples, without ever materializing the full dataset in memory. Setting the buffer size to
+    /// the dataset size yields a uniform random permutation.
+    /// </summary>
+    ///
+    /// <typeparam name="ExampleType"> Example type. </typeparam>
+    template <typename ExampleType>
+    class ShufflingExampleIterator : public IExampleIterator<ExampleType>
+    {
+    public:
+        /// <summary> Constructs a ShufflingExampleIterator. </summary>
+        ///
+        /// <param name="sourceIterator"> The example iterator whose order is being shuffled. </param>
+        /// <param name="bufferSize"> The number of examples to hold in memory. </param>
+        /// <param name="randomSeedString"> The random seed string. </param>
+        ShufflingExampleIterator(ExampleIterator<ExampleType> sourceIterator, size_t bufferSize, std::string randomSeedString = "");
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if the iterator is valid, false otherwise. </returns>
+        bool IsValid() const override { return !_buffer.empty(); }
+
+        /// <summary> Proceeds to the next example. </summary>
+        void Next() override;
+
+        /// <summary> Gets the current example. </summary>
+        ///
+        /// <returns> An example. </returns>
+        ExampleType Get() const override { return _buffer[_currentIndex]; }
+
+    private:
+        void ChooseCurrentIndex();
+
+        ExampleIterator<ExampleType> _sourceIterator;
+        std::vector<ExampleType> _buffer;
+        std::default_random_engine _random;
+        size_t _currentIndex = 0;
+    };
+
+    /// <summary>
+    /// Helper function that creates a ShufflingExampleIterator from an example iterator and a
+    /// buffer size.
+    /// </summary>
+    ///
+    /// <typeparam name="ExampleType"> Example type. </typeparam>
+    /// <param name="sourceIterator"> The example iterator whose order is being shuffled. </param>
+    /// <param name="bufferSize"> The number of examples to hold in memory. </param>
+    /// <param name="randomSeedString"> The random seed string. </param>
+    ///
+    /// <returns> The shuffling example iterator. </returns>
+    template <typename ExampleType>
+    ExampleIterator<ExampleType> MakeShufflingExampleIterator(ExampleIterator<ExampleType> sourceIterator, size_t bufferSize, std::string randomSeedString = "");
+} // namespace data
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace data
+{
+    template <typename ExampleType>
+    ShufflingExampleIterator<ExampleType>::ShufflingExampleIterator(ExampleIterator<ExampleType> sourceIterator, size_t bufferSize, std::string randomSeedString) :
+        _sourceIterator(std::move(sourceIterator)),
+        _random(utilities::GetRandomEngine(std::move(randomSeedString)))
+    {
+        _buffer.reserve(bufferSize);
+        while (_buffer.size() < bufferSize && _sourceIterator.IsValid())
+        {
+            _buffer.push_back(_sourceIterator.Get());
+            _sourceIterator.Next();
+        }
+        ChooseCurrentIndex();
+    }
+
+    template <typename ExampleType>
+    void ShufflingExampleIterator<ExampleType>::Next()
+    {
+        // replace the example being handed out with the next source example, or shrink the
+        // buffer once the source is exhausted
+        if (_sourceIterator.IsValid())
+        {
+            _buffer[_currentIndex] = _sourceIterator.Get();
+            _sourceIterator.Next();
+        }
+        else
+        {
+            if (_currentIndex != _buffer.size() - 1)
+            {
+                _buffer[_currentIndex] = std::move(_buffer.back());
+            }
+            _buffer.pop_back();
+        }
+        ChooseCurrentIndex();
+    }
+
+    template <typename ExampleType>
+    void ShufflingExampleIterator<ExampleType>::ChooseCurrentIndex()
+    {
+        if (!_buffer.empty())
+        {
+            _currentIndex = std::uniform_int_distribution<size_t>(0, _buffer.size() - 1)(_random);
+        }
+    }
+
+    template <typename ExampleType>
+    ExampleIterator<ExampleType> MakeShufflingExampleIterator(ExampleIterator<ExampleType> sourceIterator, size_t bufferSize, std::string randomSeedString)
+    {
+        auto iterator = std::make_unique<ShufflingExampleIterator<ExampleType>>(std::move(sourceIterator), bufferSize, std::move(randomSeedString));
+        return ExampleIterator<ExampleType>(std::move(iterator));
+    }
+} // namespace data
+} // namespace ell
+
+#pragma endregion implementation
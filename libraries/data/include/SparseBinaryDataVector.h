@@ -337,11 +337,16 @@ namespace data
     {
         double value = 0.0;
 
-        auto iter = _indexList.GetIterator();
-        while (iter.IsValid())
+        auto blockIterator = _indexList.GetBlockIterator();
+        while (blockIterator.IsValid())
         {
-            value += vector[iter.Get()];
-            iter.Next();
+            const size_t* indices = blockIterator.Get();
+            size_t count = blockIterator.Size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                value += vector[indices[i]];
+            }
+            blockIterator.Next();
         }
 
         return value;
@@ -350,19 +355,24 @@ namespace data
     template <typename IndexListType>
     void SparseBinaryDataVectorBase<IndexListType>::AddTo(math::RowVectorReference<double> vector) const
     {
-        auto iter = _indexList.GetIterator();
+        auto blockIterator = _indexList.GetBlockIterator();
         auto size = vector.Size();
 
-        while (iter.IsValid())
+        while (blockIterator.IsValid())
         {
-            auto index = iter.Get();
-            if (index >= size)
+            const size_t* indices = blockIterator.Get();
+            size_t count = blockIterator.Size();
+            for (size_t i = 0; i < count; ++i)
             {
-                return;
-            }
+                auto index = indices[i];
+                if (index >= size)
+                {
+                    return;
+                }
 
-            vector[index] += 1.0;
-            iter.Next();
+                vector[index] += 1.0;
+            }
+            blockIterator.Next();
         }
     }
 } // namespace data
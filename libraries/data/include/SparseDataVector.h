@@ -190,6 +190,24 @@ namespace data
         /// <returns> The first index of the suffix of zeros at the end of this vector. </returns>
         size_t PrefixLength() const override;
 
+        /// <summary> Computes the Dot product. Operates directly on the index list and the
+        /// contiguous value array, processing runs of consecutive indices with a loop that the
+        /// compiler can vectorize. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A double. </returns>
+        double Dot(math::UnorientedConstVectorBase<double> vector) const override;
+
+        /// <summary> Computes the Dot product. Operates directly on the index list and the
+        /// contiguous value array, processing runs of consecutive indices with a loop that the
+        /// compiler can vectorize. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A float. </returns>
+        float Dot(math::UnorientedConstVectorBase<float> vector) const override;
+
         /// <summary> Gets the data vector type (implemented by template specialization). </summary>
         ///
         /// <returns> The data vector type. </returns>
@@ -202,6 +220,10 @@ namespace data
 
     private:
         using DataVectorBase<SparseDataVector<ElementType, IndexListType>>::AppendElements;
+
+        template <typename VectorElementType>
+        VectorElementType DotImpl(math::UnorientedConstVectorBase<VectorElementType> vector) const;
+
         IndexListType _indexList;
         std::vector<ElementType> _values;
     };
@@ -357,6 +379,62 @@ namespace data
         _values.push_back(storedValue);
     }
 
+    template <typename ElementType, typename IndexListType>
+    double SparseDataVector<ElementType, IndexListType>::Dot(math::UnorientedConstVectorBase<double> vector) const
+    {
+        return DotImpl(vector);
+    }
+
+    template <typename ElementType, typename IndexListType>
+    float SparseDataVector<ElementType, IndexListType>::Dot(math::UnorientedConstVectorBase<float> vector) const
+    {
+        return DotImpl(vector);
+    }
+
+    template <typename ElementType, typename IndexListType>
+    template <typename VectorElementType>
+    VectorElementType SparseDataVector<ElementType, IndexListType>::DotImpl(math::UnorientedConstVectorBase<VectorElementType> vector) const
+    {
+        if (!vector.IsContiguous())
+        {
+            return DataVectorBase<SparseDataVector<ElementType, IndexListType>>::Dot(vector);
+        }
+
+        const VectorElementType* data = vector.GetConstDataPointer();
+        const ElementType* values = _values.data();
+        const size_t size = vector.Size();
+
+        VectorElementType result = 0;
+        size_t position = 0;
+        auto indexIterator = _indexList.GetIterator();
+        while (indexIterator.IsValid())
+        {
+            size_t index = indexIterator.Get();
+            if (index >= size)
+            {
+                break;
+            }
+
+            auto run = indexIterator.NumConsecutiveFollowing();
+            if (run > size - 1 - index)
+            {
+                run = size - 1 - index;
+            }
+
+            // the indices index..index+run address consecutive elements of both arrays, so this
+            // loop is a straight multiply-accumulate that the compiler can vectorize
+            for (size_t j = 0; j <= run; ++j)
+            {
+                result += static_cast<VectorElementType>(values[position + j]) * data[index + j];
+            }
+
+            position += run + 1;
+            indexIterator.SkipConsecutive(run);
+            indexIterator.Next();
+        }
+        return result;
+    }
+
     template <typename ElementType, typename IndexListType>
     size_t SparseDataVector<ElementType, IndexListType>::PrefixLength() const
     {
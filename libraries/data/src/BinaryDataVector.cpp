@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryDataVector.cpp (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BinaryDataVector.h"
+
+#include <utilities/include/Exception.h>
+
+namespace ell
+{
+namespace data
+{
+    const size_t bitsPerWord = 8 * sizeof(uint64_t);
+
+    BinaryDataVectorIterator<IterationPolicy::all>::BinaryDataVectorIterator(const uint64_t* bits, size_t numStoredBits, size_t size) :
+        _bits(bits),
+        _numStoredBits(numStoredBits),
+        _size(size)
+    {
+    }
+
+    IndexValue BinaryDataVectorIterator<IterationPolicy::all>::Get() const
+    {
+        if (_index < _numStoredBits && ((_bits[_index / bitsPerWord] >> (_index % bitsPerWord)) & 1) != 0)
+        {
+            return IndexValue{ _index, 1.0 };
+        }
+        return IndexValue{ _index, 0.0 };
+    }
+
+    BinaryDataVectorIterator<IterationPolicy::skipZeros>::BinaryDataVectorIterator(const uint64_t* bits, size_t numStoredBits, size_t size) :
+        _bits(bits),
+        _size(std::min(numStoredBits, size))
+    {
+        AdvanceToNextSetBit();
+    }
+
+    void BinaryDataVectorIterator<IterationPolicy::skipZeros>::Next()
+    {
+        ++_index;
+        AdvanceToNextSetBit();
+    }
+
+    void BinaryDataVectorIterator<IterationPolicy::skipZeros>::AdvanceToNextSetBit()
+    {
+        while (_index < _size)
+        {
+            uint64_t word = _bits[_index / bitsPerWord] >> (_index % bitsPerWord);
+            if (word == 0)
+            {
+                _index = (_index / bitsPerWord + 1) * bitsPerWord;
+                continue;
+            }
+
+            while ((word & 1) == 0)
+            {
+                word >>= 1;
+                ++_index;
+            }
+            return;
+        }
+    }
+
+    BinaryDataVector::BinaryDataVector(std::initializer_list<IndexValue> list)
+    {
+        AppendElements(std::move(list));
+    }
+
+    BinaryDataVector::BinaryDataVector(std::initializer_list<double> list)
+    {
+        AppendElements(std::move(list));
+    }
+
+    BinaryDataVector::BinaryDataVector(std::vector<IndexValue> vec)
+    {
+        AppendElements(std::move(vec));
+    }
+
+    BinaryDataVector::BinaryDataVector(std::vector<double> vec)
+    {
+        AppendElements(std::move(vec));
+    }
+
+    void BinaryDataVector::AppendElement(size_t index, double value)
+    {
+        if (value == 0)
+        {
+            return;
+        }
+
+        if (value != 1)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Input to BinaryDataVector needs to be 0 or 1");
+        }
+
+        if (index < _size)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Can only append values to the end of a data vector");
+        }
+
+        _bits.resize(index / bitsPerWord + 1, 0);
+        _bits[index / bitsPerWord] |= uint64_t{ 1 } << (index % bitsPerWord);
+        _size = index + 1;
+    }
+
+    double BinaryDataVector::Norm2Squared() const
+    {
+        size_t count = 0;
+        for (auto word : _bits)
+        {
+            while (word != 0)
+            {
+                word &= word - 1;
+                ++count;
+            }
+        }
+        return static_cast<double>(count);
+    }
+} // namespace data
+} // namespace ell
@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryDataset.cpp (data)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BinaryDataset.h"
+
+#include "AutoDataVector.h"
+#include "GeneralizedSparseParsingIterator.h"
+#include "SequentialLineIterator.h"
+#include "ShufflingExampleIterator.h"
+#include "SingleLineParsingExampleIterator.h"
+#include "WeightLabel.h"
+
+#include <utilities/include/Exception.h>
+#include <utilities/include/MemoryMappedFile.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    namespace
+    {
+        const char magic[4] = { 'E', 'L', 'L', 'D' };
+        constexpr uint32_t formatVersion = 1;
+        constexpr uint64_t headerSize = sizeof(magic) + sizeof(uint32_t) + 2 * sizeof(uint64_t);
+
+        template <typename ValueType>
+        void WriteScalar(std::ostream& stream, ValueType value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        template <typename ValueType>
+        ValueType ReadScalar(const uint8_t* data)
+        {
+            ValueType value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        using utilities::MemoryMappedFile;
+
+        /// <summary> An example iterator that materializes examples directly from the raw feature
+        /// blocks of a memory-mapped binary dataset file. </summary>
+        class BinaryDatasetExampleIterator : public IExampleIterator<AutoSupervisedExample>
+        {
+        public:
+            BinaryDatasetExampleIterator(std::shared_ptr<MemoryMappedFile> file, uint64_t firstExample = 0, uint64_t stride = 1) :
+                _file(std::move(file)),
+                _stride(stride)
+            {
+                const uint8_t* data = _file->GetData();
+                size_t size = _file->GetSize();
+
+                if (size < headerSize || std::memcmp(data, magic, sizeof(magic)) != 0)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::badData, "not a binary dataset file");
+                }
+                if (ReadScalar<uint32_t>(data + sizeof(magic)) != formatVersion)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::badData, "unsupported binary dataset format version");
+                }
+
+                _numExamples = ReadScalar<uint64_t>(data + sizeof(magic) + sizeof(uint32_t));
+                _indexOffset = ReadScalar<uint64_t>(data + sizeof(magic) + sizeof(uint32_t) + sizeof(uint64_t));
+                if (_indexOffset < headerSize || _indexOffset + _numExamples * sizeof(uint64_t) > size)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::badData, "binary dataset offset index out of bounds");
+                }
+
+                _current = std::min(firstExample, _numExamples);
+            }
+
+            bool IsValid() const override { return _current < _numExamples; }
+
+            void Next() override { _current += std::min(_stride, _numExamples - _current); }
+
+            AutoSupervisedExample Get() const override
+            {
+                const uint8_t* data = _file->GetData();
+                size_t size = _file->GetSize();
+
+                uint64_t offset = ReadScalar<uint64_t>(data + _indexOffset + _current * sizeof(uint64_t));
+                constexpr uint64_t recordHeaderSize = 2 * sizeof(double) + sizeof(uint64_t);
+                if (offset < headerSize || offset + recordHeaderSize > size)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::badData, "binary dataset example record out of bounds");
+                }
+
+                const uint8_t* record = data + offset;
+                double weight = ReadScalar<double>(record);
+                double label = ReadScalar<double>(record + sizeof(double));
+                uint64_t numValues = ReadScalar<uint64_t>(record + 2 * sizeof(double));
+                if (offset + recordHeaderSize + numValues * sizeof(double) > size)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::badData, "binary dataset example record out of bounds");
+                }
+
+                std::vector<double> values(numValues);
+                std::memcpy(values.data(), record + recordHeaderSize, numValues * sizeof(double));
+
+                return AutoSupervisedExample(AutoDataVector(std::move(values)), WeightLabel{ weight, label });
+            }
+
+        private:
+            std::shared_ptr<MemoryMappedFile> _file;
+            uint64_t _numExamples = 0;
+            uint64_t _indexOffset = 0;
+            uint64_t _current = 0;
+            uint64_t _stride = 1;
+        };
+    } // namespace
+
+    void WriteBinaryDataset(std::ostream& stream, AutoSupervisedExampleIterator exampleIterator)
+    {
+        auto base = stream.tellp();
+
+        // header, with the example count and index offset patched in at the end
+        stream.write(magic, sizeof(magic));
+        WriteScalar(stream, formatVersion);
+        WriteScalar(stream, uint64_t{ 0 });
+        WriteScalar(stream, uint64_t{ 0 });
+
+        // example records, streamed through one at a time
+        std::vector<uint64_t> offsets;
+        while (exampleIterator.IsValid())
+        {
+            auto example = exampleIterator.Get();
+            offsets.push_back(static_cast<uint64_t>(stream.tellp() - base));
+
+            const auto& metadata = example.GetMetadata();
+            WriteScalar(stream, metadata.weight);
+            WriteScalar(stream, metadata.label);
+
+            auto values = example.GetDataVector().ToArray();
+            WriteScalar(stream, static_cast<uint64_t>(values.size()));
+            stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+
+            exampleIterator.Next();
+        }
+
+        // offset index
+        uint64_t indexOffset = static_cast<uint64_t>(stream.tellp() - base);
+        stream.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint64_t));
+        auto end = stream.tellp();
+
+        stream.seekp(base + static_cast<std::streamoff>(sizeof(magic) + sizeof(uint32_t)));
+        WriteScalar(stream, static_cast<uint64_t>(offsets.size()));
+        WriteScalar(stream, indexOffset);
+        stream.seekp(end);
+    }
+
+    void WriteBinaryDataset(std::ostream& stream, const AutoSupervisedDataset& dataset)
+    {
+        WriteBinaryDataset(stream, dataset.GetExampleIterator());
+    }
+
+    AutoSupervisedExampleIterator GetBinaryDatasetExampleIterator(const std::string& filename)
+    {
+        auto file = std::make_shared<MemoryMappedFile>(filename);
+        return AutoSupervisedExampleIterator(std::make_unique<BinaryDatasetExampleIterator>(std::move(file)));
+    }
+
+    AutoSupervisedExampleIterator GetBinaryDatasetShardExampleIterator(const std::string& filename, size_t shardIndex, size_t shardCount)
+    {
+        if (shardCount == 0 || shardIndex >= shardCount)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "shard index must be smaller than the shard count");
+        }
+
+        auto file = std::make_shared<MemoryMappedFile>(filename);
+        return AutoSupervisedExampleIterator(std::make_unique<BinaryDatasetExampleIterator>(std::move(file), shardIndex, shardCount));
+    }
+
+    AutoSupervisedExampleIterator GetShuffledBinaryDatasetExampleIterator(const std::string& filename, size_t shuffleBufferSize, std::string randomSeedString)
+    {
+        return MakeShufflingExampleIterator(GetBinaryDatasetExampleIterator(filename), shuffleBufferSize, std::move(randomSeedString));
+    }
+
+    AutoSupervisedDataset ReadBinaryDataset(const std::string& filename)
+    {
+        return MakeDataset(GetBinaryDatasetExampleIterator(filename));
+    }
+
+    void ConvertTextToBinaryDataset(std::istream& textStream, std::ostream& binaryStream)
+    {
+        auto exampleIterator = MakeSingleLineParsingExampleIterator(
+            SequentialLineIterator(textStream),
+            LabelParser(),
+            AutoDataVectorParser<GeneralizedSparseParsingIterator>());
+        WriteBinaryDataset(binaryStream, std::move(exampleIterator));
+    }
+} // namespace data
+} // namespace ell
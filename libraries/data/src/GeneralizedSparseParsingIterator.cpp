@@ -24,6 +24,11 @@ namespace data
         {
             _isValid = false;
         }
+        else if (_textLine.GetString().find(':', _textLine.GetCurrentPosition()) == std::string::npos)
+        {
+            // a line without any ':' holds only dense entries, which can be parsed in one bulk call
+            ParseDense();
+        }
         else
         {
             ReadEntry(0);
@@ -33,6 +38,20 @@ namespace data
 
     void GeneralizedSparseParsingIterator::Next()
     {
+        if (_isDense)
+        {
+            if (_denseNext < _denseValues.size())
+            {
+                _currentIndexValue = IndexValue{ _denseNext, _denseValues[_denseNext] };
+                ++_denseNext;
+            }
+            else
+            {
+                _isValid = false;
+            }
+            return;
+        }
+
         if (_textLine.IsEndOfContent())
         {
             _isValid = false;
@@ -44,6 +63,27 @@ namespace data
         }
     }
 
+    void GeneralizedSparseParsingIterator::ParseDense()
+    {
+        const char* pStr = _textLine.GetString().c_str() + _textLine.GetCurrentPosition();
+        auto begin = pStr;
+        auto result = utilities::ParseFloatSequence(pStr, _denseValues);
+        if (result == utilities::ParseResult::badFormat)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::badFormat, "could not parse value");
+        }
+        _textLine.AdvancePosition(static_cast<size_t>(pStr - begin));
+
+        _isDense = true;
+        if (_denseValues.empty())
+        {
+            _isValid = false;
+            return;
+        }
+        _currentIndexValue = IndexValue{ 0, _denseValues.front() };
+        _denseNext = 1;
+    }
+
     void GeneralizedSparseParsingIterator::ReadEntry(size_t nextIndex)
     {
         std::locale loc;
@@ -10,10 +10,44 @@
 
 #include <utilities/include/Files.h>
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 namespace ell
 {
 namespace data
 {
+    namespace
+    {
+        // how far the reader thread may get ahead of the consumer
+        const size_t maxBufferedLines = 1024;
+    } // namespace
+
+    struct SequentialLineIterator::ReadAheadBuffer
+    {
+        std::mutex mutex;
+        std::condition_variable bufferChanged;
+        std::deque<TextLine> lines;
+        bool endOfStream = false;
+        bool stop = false;
+        std::thread readerThread;
+
+        ~ReadAheadBuffer()
+        {
+            {
+                std::lock_guard<std::mutex> lock{ mutex };
+                stop = true;
+            }
+            bufferChanged.notify_all();
+            if (readerThread.joinable())
+            {
+                readerThread.join();
+            }
+        }
+    };
+
     SequentialLineIterator::SequentialLineIterator(std::istream& stream, char delim) :
         _stream(stream),
         _delim(delim)
@@ -21,8 +55,73 @@ namespace data
         Next();
     }
 
+    SequentialLineIterator::SequentialLineIterator(std::istream& stream, char delim, bool readAhead) :
+        _stream(stream),
+        _delim(delim)
+    {
+        if (readAhead)
+        {
+            _readAheadBuffer = std::make_unique<ReadAheadBuffer>();
+
+            // the thread captures the buffer and the stream, which both stay put when the
+            // iterator itself is moved
+            auto buffer = _readAheadBuffer.get();
+            buffer->readerThread = std::thread([buffer, &stream, delim] {
+                for (;;)
+                {
+                    std::string nextLine;
+                    std::getline(stream, nextLine, delim);
+                    bool failed = stream.fail();
+
+                    std::unique_lock<std::mutex> lock{ buffer->mutex };
+                    if (failed)
+                    {
+                        buffer->endOfStream = true;
+                        break;
+                    }
+
+                    buffer->bufferChanged.wait(lock, [buffer] { return buffer->stop || buffer->lines.size() < maxBufferedLines; });
+                    if (buffer->stop)
+                    {
+                        return;
+                    }
+
+                    buffer->lines.push_back(TextLine(std::move(nextLine)));
+                    lock.unlock();
+                    buffer->bufferChanged.notify_all();
+                }
+                buffer->bufferChanged.notify_all();
+            });
+        }
+
+        Next();
+    }
+
+    // defined here, where ReadAheadBuffer is a complete type
+    SequentialLineIterator::SequentialLineIterator(SequentialLineIterator&&) = default;
+
+    SequentialLineIterator::~SequentialLineIterator() = default;
+
     void SequentialLineIterator::Next()
     {
+        if (_readAheadBuffer != nullptr)
+        {
+            std::unique_lock<std::mutex> lock{ _readAheadBuffer->mutex };
+            _readAheadBuffer->bufferChanged.wait(lock, [this] { return !_readAheadBuffer->lines.empty() || _readAheadBuffer->endOfStream; });
+
+            if (_readAheadBuffer->lines.empty())
+            {
+                _isValid = false;
+                return;
+            }
+
+            _currentLine = std::move(_readAheadBuffer->lines.front());
+            _readAheadBuffer->lines.pop_front();
+            lock.unlock();
+            _readAheadBuffer->bufferChanged.notify_all();
+            return;
+        }
+
         std::string nextLine;
         std::getline(_stream, nextLine, _delim);
 
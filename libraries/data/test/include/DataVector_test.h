@@ -14,5 +14,6 @@ void IDataVectorTests();
 void DataVectorCopyAsTests();
 void AutoDataVectorTest();
 void TransformedDataVectorTest();
+void SparseDotProductTests();
 void IteratorTests();
 } // namespace ell
\ No newline at end of file
@@ -11,5 +11,9 @@
 namespace ell
 {
 void DatasetCastingTests();
+void DatasetReferenceIterationTests();
 void DatasetSerializationTests();
+void BinaryDatasetTests();
+void ShufflingExampleIteratorTests();
+void DatasetShardingTests();
 } // namespace ell
\ No newline at end of file
@@ -12,4 +12,5 @@ namespace ell
 void DataVectorParseTest();
 void AutoDataVectorParseTest();
 void SingleFileParseTest();
+void ReadAheadLineIteratorTest();
 } // namespace ell
\ No newline at end of file
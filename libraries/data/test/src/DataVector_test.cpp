@@ -9,6 +9,7 @@
 #include "DataVector_test.h"
 
 #include <data/include/AutoDataVector.h>
+#include <data/include/BinaryDataVector.h>
 #include <data/include/DataVector.h>
 #include <data/include/DataVectorOperations.h>
 #include <data/include/DenseDataVector.h>
@@ -103,6 +104,7 @@ void IDataVectorTests()
     IDataVectorBinaryTest<data::SparseByteDataVector>();
     IDataVectorBinaryTest<data::AutoDataVector>();
     IDataVectorBinaryTest<data::SparseBinaryDataVector>();
+    IDataVectorBinaryTest<data::BinaryDataVector>();
 }
 
 template <typename DataVectorType1, typename DataVectorType2>
@@ -158,6 +160,7 @@ void DataVectorCopyAsTestDispatch(InitType maxType)
     DataVectorCopyAsTest<DataVectorType, data::SparseShortDataVector>(integeralInit);
     DataVectorCopyAsTest<DataVectorType, data::SparseByteDataVector>(integeralInit);
     DataVectorCopyAsTest<DataVectorType, data::SparseBinaryDataVector>(binaryInit, false);
+    DataVectorCopyAsTest<DataVectorType, data::BinaryDataVector>(binaryInit, false);
 }
 
 void DataVectorCopyAsTests()
@@ -172,6 +175,7 @@ void DataVectorCopyAsTests()
     DataVectorCopyAsTestDispatch<data::SparseShortDataVector>(InitType::integral);
     DataVectorCopyAsTestDispatch<data::SparseByteDataVector>(InitType::integral);
     DataVectorCopyAsTestDispatch<data::SparseBinaryDataVector>(InitType::binary);
+    DataVectorCopyAsTestDispatch<data::BinaryDataVector>(InitType::binary);
 }
 
 void AutoDataVectorTest()
@@ -202,6 +206,9 @@ void AutoDataVectorTest()
 
     data::AutoDataVector v9{ 0, 0, 0, 0, 0, 1, 0, 0, 0 };
     testing::ProcessTest("AutoDataVector ctor", v9.GetInternalType() == data::IDataVector::Type::SparseBinaryDataVector);
+
+    data::AutoDataVector v10{ 1, 0, 1, 1, 0, 1 };
+    testing::ProcessTest("AutoDataVector ctor", v10.GetInternalType() == data::IDataVector::Type::BinaryDataVector);
 }
 
 void TransformedDataVectorTest()
@@ -254,6 +261,41 @@ void IteratorTest()
     testing::ProcessTest("IteratorTest<" + name + ">", std::equal(b.begin(), b.end(), c.begin()));
 }
 
+template <typename DataVectorType>
+void SparseDotProductTest()
+{
+    // mix isolated indices with long consecutive runs, to exercise the run-based dot product
+    DataVectorType u{ { 0, 2 }, { 5, 1 }, { 6, 3 }, { 7, 2 }, { 8, 1 }, { 9, 4 }, { 17, 2 }, { 18, 1 } };
+    auto a = u.ToArray();
+
+    math::RowVector<double> w(25);
+    for (size_t i = 0; i < w.Size(); ++i)
+    {
+        w[i] = static_cast<double>(i) + 0.5;
+    }
+
+    double expected = 0;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        expected += a[i] * w[i];
+    }
+
+    std::string name = typeid(DataVectorType).name();
+    testing::ProcessTest("SparseDotProductTest<" + name + ">", testing::IsEqual(u.Dot(w), expected));
+
+    // a vector that ends in the middle of a run exercises the truncated-run path
+    math::RowVector<double> wShort{ 1, 1, 1, 1, 1, 1, 1, 1 };
+    testing::ProcessTest("SparseDotProductTest<" + name + "> short", testing::IsEqual(u.Dot(wShort), 2.0 + 1.0 + 3.0 + 2.0));
+}
+
+void SparseDotProductTests()
+{
+    SparseDotProductTest<data::SparseDoubleDataVector>();
+    SparseDotProductTest<data::SparseFloatDataVector>();
+    SparseDotProductTest<data::SparseShortDataVector>();
+    SparseDotProductTest<data::SparseByteDataVector>();
+}
+
 void IteratorTests()
 {
     IteratorTest<data::DoubleDataVector>();
@@ -265,5 +307,6 @@ void IteratorTests()
     IteratorTest<data::SparseShortDataVector>();
     IteratorTest<data::SparseByteDataVector>();
     IteratorTest<data::SparseBinaryDataVector>();
+    IteratorTest<data::BinaryDataVector>();
 }
 } // namespace ell
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #include <common/include/DataLoaders.h>
 
+#include <data/include/BinaryDataset.h>
 #include <data/include/Dataset.h>
 
 #include <utilities/include/Files.h>
@@ -71,6 +72,43 @@ void DatasetCastingTests()
     DatasetCastingTestDispatch<data::DenseSupervisedExample>();
 }
 
+void DatasetReferenceIterationTests()
+{
+    data::Dataset<data::AutoSupervisedExample> dataset;
+    dataset.AddExample(GetExample<data::AutoSupervisedExample>());
+    dataset.AddExample(GetExample<data::AutoSupervisedExample>());
+    dataset.AddExample(GetExample<data::AutoSupervisedExample>());
+
+    auto anyDataset = dataset.GetAnyDataset();
+
+    // iterating by reference should visit the stored examples without copying them
+    auto iterator = anyDataset.GetExampleReferenceIterator<data::AutoSupervisedExample>();
+    size_t index = 0;
+    bool sameExamples = true;
+    while (iterator.IsValid())
+    {
+        if (&iterator.Get() != &dataset.GetExample(index))
+        {
+            sameExamples = false;
+        }
+        iterator.Next();
+        ++index;
+    }
+    testing::ProcessTest("DatasetReferenceIterationTest references", sameExamples && index == dataset.NumExamples());
+
+    // requesting a type other than the stored one should throw
+    bool threw = false;
+    try
+    {
+        anyDataset.GetExampleReferenceIterator<data::DenseSupervisedExample>();
+    }
+    catch (const utilities::InputException&)
+    {
+        threw = true;
+    }
+    testing::ProcessTest("DatasetReferenceIterationTest type mismatch", threw);
+}
+
 void DatasetSerializationTests()
 {
     data::Dataset<data::AutoSupervisedExample> dataset1;
@@ -119,4 +157,198 @@ void DatasetSerializationTests()
     }
     testing::ProcessTest(utilities::FormatString("DatasetSerializationTest data %d errors", errors), errors == 0);
 }
+
+void BinaryDatasetTests()
+{
+    data::Dataset<data::AutoSupervisedExample> dataset1;
+    dataset1.AddExample(GetExample<data::AutoSupervisedExample>());
+    dataset1.AddExample(GetExample<data::AutoSupervisedExample>());
+    dataset1.AddExample(GetExample<data::AutoSupervisedExample>());
+
+    // save the dataset in the binary format
+    const std::string filename("dataset1.bin");
+    auto stream = utilities::OpenBinaryOfstream(filename);
+    data::WriteBinaryDataset(stream, dataset1);
+    stream.close();
+
+    // load the dataset through the memory-mapped reader
+    auto dataset2 = data::ReadBinaryDataset(filename);
+
+    testing::ProcessTest("BinaryDatasetTest size", dataset1.NumExamples() == dataset2.NumExamples());
+    testing::ProcessTest("BinaryDatasetTest features", dataset1.NumFeatures() == dataset2.NumFeatures());
+    int errors = 0;
+    if (dataset1.NumExamples() == dataset2.NumExamples() && dataset1.NumFeatures() == dataset2.NumFeatures())
+    {
+        for (size_t i = 0; i < dataset1.NumExamples(); i++)
+        {
+            auto e1 = dataset1.GetExample(i);
+            auto e2 = dataset2.GetExample(i);
+
+            auto sameVector = testing::IsEqual(e1.GetDataVector().ToArray(), e2.GetDataVector().ToArray());
+            auto sameLabel = e1.GetMetadata().label == e2.GetMetadata().label;
+            auto sameWeight = e1.GetMetadata().weight == e2.GetMetadata().weight;
+            if (!(sameVector && sameLabel && sameWeight))
+            {
+                errors++;
+            }
+        }
+    }
+    testing::ProcessTest(utilities::FormatString("BinaryDatasetTest data %d errors", errors), errors == 0);
+
+    // convert the text format to the binary format and make sure the result matches
+    const std::string textFilename("dataset1_convert.txt");
+    auto textOut = utilities::OpenOfstream(textFilename);
+    dataset1.Print(textOut);
+    textOut.close();
+
+    const std::string convertedFilename("dataset1_convert.bin");
+    auto textIn = utilities::OpenIfstream(textFilename);
+    auto binaryOut = utilities::OpenBinaryOfstream(convertedFilename);
+    data::ConvertTextToBinaryDataset(textIn, binaryOut);
+    binaryOut.close();
+
+    auto dataset3 = data::ReadBinaryDataset(convertedFilename);
+    errors = 0;
+    if (dataset1.NumExamples() == dataset3.NumExamples())
+    {
+        for (size_t i = 0; i < dataset1.NumExamples(); i++)
+        {
+            auto e1 = dataset1.GetExample(i);
+            auto e3 = dataset3.GetExample(i);
+
+            auto sameVector = testing::IsEqual(e1.GetDataVector().ToArray(), e3.GetDataVector().ToArray());
+            auto sameLabel = e1.GetMetadata().label == e3.GetMetadata().label;
+            auto sameWeight = e1.GetMetadata().weight == e3.GetMetadata().weight;
+            if (!(sameVector && sameLabel && sameWeight))
+            {
+                errors++;
+            }
+        }
+    }
+    else
+    {
+        errors = static_cast<int>(dataset1.NumExamples());
+    }
+    testing::ProcessTest(utilities::FormatString("BinaryDatasetTest converted data %d errors", errors), errors == 0);
+}
+void ShufflingExampleIteratorTests()
+{
+    const size_t numExamples = 50;
+    data::Dataset<data::AutoSupervisedExample> dataset;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(std::vector<double>{ 1.0, 2.0 }, data::WeightLabel{ 1, static_cast<double>(i) }));
+    }
+
+    const std::string filename("dataset_shuffle.bin");
+    auto stream = utilities::OpenBinaryOfstream(filename);
+    data::WriteBinaryDataset(stream, dataset);
+    stream.close();
+
+    // a shuffled pass must visit every example exactly once
+    auto iterator = data::GetShuffledBinaryDatasetExampleIterator(filename, 16, "seed123");
+    std::vector<size_t> counts(numExamples, 0);
+    std::vector<double> labels;
+    while (iterator.IsValid())
+    {
+        auto example = iterator.Get();
+        auto label = static_cast<size_t>(example.GetMetadata().label);
+        if (label < numExamples)
+        {
+            ++counts[label];
+        }
+        labels.push_back(example.GetMetadata().label);
+        iterator.Next();
+    }
+    bool isPermutation = (labels.size() == numExamples);
+    for (auto count : counts)
+    {
+        isPermutation &= (count == 1);
+    }
+    testing::ProcessTest("ShufflingExampleIteratorTest permutation", isPermutation);
+
+    // and actually change the example order
+    bool isShuffled = false;
+    for (size_t i = 0; i < labels.size(); ++i)
+    {
+        isShuffled |= (labels[i] != static_cast<double>(i));
+    }
+    testing::ProcessTest("ShufflingExampleIteratorTest order", isShuffled);
+}
+
+void DatasetShardingTests()
+{
+    const size_t numExamples = 10;
+    const size_t shardCount = 3;
+    data::Dataset<data::AutoSupervisedExample> dataset;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(std::vector<double>{ 1.0, 2.0 }, data::WeightLabel{ 1, static_cast<double>(i) }));
+    }
+
+    // the shards must be disjoint, strided, and together cover the dataset exactly once
+    std::vector<size_t> counts(numExamples, 0);
+    bool isStrided = true;
+    for (size_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+    {
+        auto iterator = dataset.GetShard(shardIndex, shardCount);
+        size_t expectedLabel = shardIndex;
+        while (iterator.IsValid())
+        {
+            auto label = static_cast<size_t>(iterator.Get().GetMetadata().label);
+            isStrided &= (label == expectedLabel);
+            if (label < numExamples)
+            {
+                ++counts[label];
+            }
+            expectedLabel += shardCount;
+            iterator.Next();
+        }
+    }
+    bool isCover = true;
+    for (auto count : counts)
+    {
+        isCover &= (count == 1);
+    }
+    testing::ProcessTest("DatasetShardingTest cover", isStrided && isCover);
+
+    // an invalid shard index should throw
+    bool threw = false;
+    try
+    {
+        dataset.GetShard(shardCount, shardCount);
+    }
+    catch (const utilities::InputException&)
+    {
+        threw = true;
+    }
+    testing::ProcessTest("DatasetShardingTest invalid shard", threw);
+
+    // sharded iteration over a memory-mapped binary dataset file
+    const std::string filename("dataset_shard.bin");
+    auto stream = utilities::OpenBinaryOfstream(filename);
+    data::WriteBinaryDataset(stream, dataset);
+    stream.close();
+
+    std::fill(counts.begin(), counts.end(), size_t{ 0 });
+    for (size_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+    {
+        auto iterator = data::GetBinaryDatasetShardExampleIterator(filename, shardIndex, shardCount);
+        while (iterator.IsValid())
+        {
+            auto label = static_cast<size_t>(iterator.Get().GetMetadata().label);
+            if (label < numExamples)
+            {
+                ++counts[label];
+            }
+            iterator.Next();
+        }
+    }
+    isCover = true;
+    for (auto count : counts)
+    {
+        isCover &= (count == 1);
+    }
+    testing::ProcessTest("DatasetShardingTest binary cover", isCover);
+}
 } // namespace ell
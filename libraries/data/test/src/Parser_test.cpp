@@ -84,6 +84,7 @@ void DataVectorParseTest()
     GoodFormatTest("Good format test 18", "100\t200#", { 100, 200 });
     GoodFormatTest("Good format test 19", "100\t200#comment 300", { 100, 200 });
     GoodFormatTest("Good format test 20", "100\t200  #  comment 300", { 100, 200 });
+    GoodFormatTest("Good format test 21", "0.12345678901234567890  1.0e-30", { 0.12345678901234567890, 1.0e-30 }); // beyond the fast parse path
 
     BadFormatTest("Bad format test 1", "1.0:10 2:20"); // double valued index
     BadFormatTest("Bad format test 2", "1X:10 2:20"); // bad character in index
@@ -142,4 +143,31 @@ void SingleFileParseTest()
     testing::ProcessTest("SingleFileParse test2", dataset[1].GetMetadata().label == -1 && testing::IsEqual(dataset[1].GetDataVector().ToArray(), { 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 3 }));
     testing::ProcessTest("SingleFileParse test3", dataset[2].GetMetadata().label == 1 && testing::IsEqual(dataset[2].GetDataVector().ToArray(), { 2.7, 0, 0, 0, -0.3, 0, 0, 0, 0, 0, 3.14 }));
 }
+
+void ReadAheadLineIteratorTest()
+{
+    // iterating with background read-ahead must produce the same lines, in the same order
+    std::string string;
+    for (int i = 0; i < 2000; ++i)
+    {
+        string += std::to_string(i) + " 1 2 3\n";
+    }
+
+    std::stringstream stream(string);
+    data::SequentialLineIterator lineIterator(stream, '\n', true);
+
+    int numLines = 0;
+    bool inOrder = true;
+    while (lineIterator.IsValid())
+    {
+        auto line = lineIterator.GetTextLine();
+        int value = 0;
+        line.ParseAdvance(value);
+        inOrder &= (value == numLines);
+        ++numLines;
+        lineIterator.Next();
+    }
+
+    testing::ProcessTest("ReadAheadLineIterator test", inOrder && numLines == 2000);
+}
 } // namespace ell
\ No newline at end of file
@@ -23,13 +23,19 @@ int main()
     DataVectorCopyAsTests();
     AutoDataVectorTest();
     TransformedDataVectorTest();
+    SparseDotProductTests();
     IteratorTests();
     ExampleCopyAsTests();
     DatasetCastingTests();
+    DatasetReferenceIterationTests();
     DatasetSerializationTests();
+    BinaryDatasetTests();
+    ShufflingExampleIteratorTests();
+    DatasetShardingTests();
     DataVectorParseTest();
     AutoDataVectorParseTest();
     SingleFileParseTest();
+    ReadAheadLineIteratorTest();
 
     if (testing::DidTestFail())
     {
@@ -11,6 +11,8 @@
 #include <math/include/Tensor.h>
 #include <math/include/Vector.h>
 
+#include <vector>
+
 namespace ell
 {
 namespace dsp
@@ -43,6 +45,66 @@ namespace dsp
         unrolled,
     };
 
+    /// <summary> The activation function to apply in a fused convolution epilogue. </summary>
+    enum class EpilogueActivation : int
+    {
+        none = 0,
+        relu,
+        leakyRelu
+    };
+
+    /// <summary> An optional bias-and-activation epilogue applied to the convolution output while it is
+    /// still warm in the cache, saving the separate full-tensor passes that running bias and activation
+    /// as standalone layers would cost. </summary>
+    template <typename ValueType>
+    struct ConvolutionEpilogue
+    {
+        /// <summary> Per-filter bias, added to every output of the corresponding filter. Empty means no bias. </summary>
+        std::vector<ValueType> bias;
+
+        /// <summary> The activation function applied after the bias. </summary>
+        EpilogueActivation activation = EpilogueActivation::none;
+
+        /// <summary> The leakage factor, used when `activation` is `leakyRelu`. </summary>
+        ValueType leakyReluLeakage = static_cast<ValueType>(0.01);
+    };
+
+    /// <summary> A rectangular region of a (row x column) plane, used to restrict computation to the
+    /// part of an image that changed between frames. The region applies to all channels. </summary>
+    struct ConvolutionRegion
+    {
+        int rowStart = 0;
+        int numRows = 0;
+        int columnStart = 0;
+        int numColumns = 0;
+    };
+
+    /// <summary> Returns the input-space region read by the receptive fields of a region of output
+    /// elements (the output region dilated by the filter size, in input coordinates). </summary>
+    ///
+    /// <param name="outputRegion"> The region of output elements being computed. </param>
+    /// <param name="filterRows"> The number of rows in the filters. </param>
+    /// <param name="filterColumns"> The number of columns in the filters. </param>
+    /// <param name="stride"> The number of elements to move/jump when sliding over the input. </param>
+    ///
+    /// <returns> The region of the input read when computing `outputRegion`. </returns>
+    ConvolutionRegion GetReceptiveField(const ConvolutionRegion& outputRegion, int filterRows, int filterColumns, int stride);
+
+    /// <summary> Returns the region of output elements whose receptive fields intersect a changed
+    /// region of the input — the elements that must be recomputed after an incremental update.
+    /// The result is clamped to the output extent; recomputing it and leaving the rest of a
+    /// previously-computed output in place yields the same output as a full recompute. </summary>
+    ///
+    /// <param name="dirtyInputRegion"> The region of the input that changed. </param>
+    /// <param name="filterRows"> The number of rows in the filters. </param>
+    /// <param name="filterColumns"> The number of columns in the filters. </param>
+    /// <param name="stride"> The number of elements to move/jump when sliding over the input. </param>
+    /// <param name="outputRows"> The number of rows in the output. </param>
+    /// <param name="outputColumns"> The number of columns in the output. </param>
+    ///
+    /// <returns> The region of the output to recompute. Empty (numRows == 0) if no output is affected. </returns>
+    ConvolutionRegion GetAffectedOutputRegion(const ConvolutionRegion& dirtyInputRegion, int filterRows, int filterColumns, int stride, int outputRows, int outputColumns);
+
     /// <summary> Convolve a 1D input with a 1D filter. </summary>
     ///
     /// <param name="input"> The input. </param>
@@ -76,6 +138,32 @@ namespace dsp
     template <typename ValueType>
     math::ChannelColumnRowTensor<ValueType> Convolve2D(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, ConvolutionMethodOption method = ConvolutionMethodOption::automatic);
 
+    /// <summary> Spatially (in 2D) convolve a 3D image with a stack of 3D filters, applying a fused bias-and-activation epilogue to the output. </summary>
+    ///
+    /// <param name="input"> The input image: a (r x c x d) tensor. </param>
+    /// <param name="filters"> The filters to convolve with. A (nf x fr x fc x d) tensor, reshaped as a ((nf*fr) x fc x d) 3D tensor. </param>
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    /// <param name="stride"> The number of elements to move/jump when sliding over the input. Typically this is 1 to 3. </param>
+    /// <param name="epilogue"> The bias and activation to apply to the convolution output. </param>
+    /// <param name="method"> The convolution algorithm to use. </param>
+    ///
+    /// <returns> A tensor with the result of applying the epilogue to the convolution `input` (*) `filter`
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2D(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, const ConvolutionEpilogue<ValueType>& epilogue, ConvolutionMethodOption method = ConvolutionMethodOption::automatic);
+
+    /// <summary> Spatially (in 2D) convolve a 3D image with a stack of 3D filters, partitioning the filters across worker threads. </summary>
+    ///
+    /// <param name="input"> The input image: a (r x c x d) tensor. </param>
+    /// <param name="filters"> The filters to convolve with. A (nf x fr x fc x d) tensor, reshaped as a ((nf*fr) x fc x d) 3D tensor. </param>
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    /// <param name="stride"> The number of elements to move/jump when sliding over the input. Typically this is 1 to 3. </param>
+    /// <param name="numThreads"> The maximum number of threads to use. Zero means one thread per hardware core. </param>
+    /// <param name="method"> The (single-threaded) convolution algorithm to run on each worker. </param>
+    ///
+    /// <returns> A tensor with the result of the convolution `input` (*) `filter`
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DParallel(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, int numThreads, ConvolutionMethodOption method = ConvolutionMethodOption::automatic);
+
     /// <summary> Convolve a set of 2D images with a corresponding set of 2D filters. </summary>
     ///
     /// <param name="input"> The input image: a (r x c x d) tensor. </param>
@@ -109,6 +197,12 @@ namespace dsp
     extern template math::ChannelColumnRowTensor<float> Convolve2D(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, ConvolutionMethodOption method);
     extern template math::ChannelColumnRowTensor<double> Convolve2D(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, ConvolutionMethodOption method);
 
+    extern template math::ChannelColumnRowTensor<float> Convolve2D(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, const ConvolutionEpilogue<float>& epilogue, ConvolutionMethodOption method);
+    extern template math::ChannelColumnRowTensor<double> Convolve2D(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, const ConvolutionEpilogue<double>& epilogue, ConvolutionMethodOption method);
+
+    extern template math::ChannelColumnRowTensor<float> Convolve2DParallel(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, int numThreads, ConvolutionMethodOption method);
+    extern template math::ChannelColumnRowTensor<double> Convolve2DParallel(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, int numThreads, ConvolutionMethodOption method);
+
     extern template math::ChannelColumnRowTensor<float> Convolve2DDepthwiseSeparable(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, ConvolutionMethodOption method);
     extern template math::ChannelColumnRowTensor<double> Convolve2DDepthwiseSeparable(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, ConvolutionMethodOption method);
 
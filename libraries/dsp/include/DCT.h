@@ -6,6 +6,8 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#pragma once
+
 #include <math/include/MathConstants.h>
 #include <math/include/Matrix.h>
 #include <math/include/MatrixOperations.h>
@@ -22,13 +24,13 @@ namespace dsp
 {
     /// <summary> Compute the discrete cosine transform (DCT-II) coefficient matrix for a given size DCT. </summary>
     ///
-    /// <param name="numFilters"> The number of DCT filters to generate --- the output dimension of a signal processed by this filter matrix. </param>
     /// <param name="windowSize"> The size of the signal to be processed. </param>
+    /// <param name="numFilters"> The number of DCT filters to generate --- the output dimension of a signal processed by this filter matrix. </param>
     /// <param name="normalize"> A flag indicating if the resulting DCT matrix should be orthonormal. </param>
     ///
     /// <returns> The coefficient matrix to multiply by the signal vector. </returns>
     template <typename ValueType>
-    math::RowMatrix<ValueType> GetDCTMatrix(size_t numFilters, size_t windowSize, bool normalize = false);
+    math::RowMatrix<ValueType> GetDCTMatrix(size_t windowSize, size_t numFilters, bool normalize = false);
 
     /// <summary> Compute the discrete cosine transform (DCT-II) of a vector of values, with an existing coefficient matrix. </summary>
     ///
@@ -43,11 +45,55 @@ namespace dsp
     /// <summary> Compute the discrete cosine transform (DCT-II) of a vector of values. </summary>
     ///
     /// <param name="signal"> The vector to compute the DCT of. </param>
+    /// <param name="numFilters"> The number of DCT filters to apply --- the output dimension. </param>
     /// <param name="normalize"> A flag indicating if the resulting DCT matrix should be orthonormal. </param>
     ///
     /// <returns> The DCT of the input signal. </returns>
     template <typename ValueType>
-    math::ColumnVector<ValueType> DCT(math::ConstColumnVectorReference<ValueType> signal, bool normalize = false);
+    math::ColumnVector<ValueType> DCT(math::ConstColumnVectorReference<ValueType> signal, size_t numFilters, bool normalize = false);
+
+    /// <summary> A precomputed DCT-II "plan": the cosine basis for a given size, computed once and stored
+    /// contiguously row-major, so repeated transforms (e.g. one per audio frame) pay only for a short fused
+    /// multiply-accumulate loop. Small filter counts --- the usual 13-40 coefficient MFCC case --- skip the
+    /// general matrix-vector machinery entirely. </summary>
+    template <typename ValueType>
+    class DCTPlan
+    {
+    public:
+        DCTPlan() = default;
+
+        /// <summary> Construct a plan for a given transform size. </summary>
+        ///
+        /// <param name="numFilters"> The number of DCT filters to apply --- the output dimension. </param>
+        /// <param name="windowSize"> The size of the signals to be processed. </param>
+        /// <param name="normalize"> A flag indicating if the DCT basis should be orthonormal. </param>
+        DCTPlan(size_t numFilters, size_t windowSize, bool normalize = false);
+
+        /// <summary> Compute the DCT of a signal. </summary>
+        ///
+        /// <param name="signal"> The vector to compute the DCT of. Must be of length `GetWindowSize()`. </param>
+        ///
+        /// <returns> The DCT of the input signal. </returns>
+        math::ColumnVector<ValueType> Transform(math::ConstColumnVectorReference<ValueType> signal) const;
+
+        /// <summary> Compute the DCT of a signal into a preallocated result vector. </summary>
+        ///
+        /// <param name="signal"> The vector to compute the DCT of. Must be of length `GetWindowSize()`. </param>
+        /// <param name="result"> The vector to write the DCT coefficients into. Must be of length `NumFilters()`. </param>
+        void Transform(math::ConstColumnVectorReference<ValueType> signal, math::ColumnVectorReference<ValueType> result) const;
+
+        /// <summary> Get the cached DCT coefficient matrix. </summary>
+        const math::RowMatrix<ValueType>& GetMatrix() const { return _dctMatrix; }
+
+        /// <summary> Get the number of DCT filters --- the output dimension. </summary>
+        size_t NumFilters() const { return _dctMatrix.NumRows(); }
+
+        /// <summary> Get the size of the signals this plan transforms. </summary>
+        size_t GetWindowSize() const { return _dctMatrix.NumColumns(); }
+
+    private:
+        math::RowMatrix<ValueType> _dctMatrix{ 0, 0 };
+    };
 } // namespace dsp
 } // namespace ell
 
@@ -95,7 +141,7 @@ namespace dsp
     template <typename ValueType>
     math::ColumnVector<ValueType> DCT(math::ConstRowMatrixReference<ValueType> dctMatrix, math::ConstColumnVectorReference<ValueType> signal, bool normalize)
     {
-        math::ColumnVector<ValueType> result(signal.Size());
+        math::ColumnVector<ValueType> result(dctMatrix.NumRows());
         if (normalize)
         {
             throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
@@ -124,6 +170,71 @@ namespace dsp
         return result;
     }
 
+    //
+    // DCTPlan
+    //
+
+    template <typename ValueType>
+    DCTPlan<ValueType>::DCTPlan(size_t numFilters, size_t windowSize, bool normalize) :
+        _dctMatrix(GetDCTMatrix<ValueType>(windowSize, numFilters, normalize))
+    {
+    }
+
+    template <typename ValueType>
+    math::ColumnVector<ValueType> DCTPlan<ValueType>::Transform(math::ConstColumnVectorReference<ValueType> signal) const
+    {
+        math::ColumnVector<ValueType> result(NumFilters());
+        Transform(signal, result);
+        return result;
+    }
+
+    template <typename ValueType>
+    void DCTPlan<ValueType>::Transform(math::ConstColumnVectorReference<ValueType> signal, math::ColumnVectorReference<ValueType> result) const
+    {
+        if (signal.Size() != GetWindowSize() || result.Size() != NumFilters())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "DCTPlan::Transform called with incorrectly-sized arguments");
+        }
+
+        // For the filter counts used by MFCC front ends, a direct fused multiply-accumulate over the
+        // contiguous basis rows beats the general matrix-vector product's call and setup overhead.
+        // Larger transforms (or strided signals) go through the regular gemv path.
+        const size_t smallSizeThreshold = 64;
+        const auto numFilters = NumFilters();
+        const auto windowSize = GetWindowSize();
+        if (numFilters <= smallSizeThreshold && signal.GetIncrement() == 1)
+        {
+            const ValueType* signalData = signal.GetConstDataPointer();
+            const ValueType* matrixData = _dctMatrix.GetConstDataPointer();
+            const size_t rowIncrement = _dctMatrix.GetIncrement();
+            for (size_t k = 0; k < numFilters; ++k)
+            {
+                const ValueType* row = matrixData + k * rowIncrement;
+                ValueType sum0 = 0;
+                ValueType sum1 = 0;
+                ValueType sum2 = 0;
+                ValueType sum3 = 0;
+                size_t n = 0;
+                for (; n + 4 <= windowSize; n += 4)
+                {
+                    sum0 += row[n] * signalData[n];
+                    sum1 += row[n + 1] * signalData[n + 1];
+                    sum2 += row[n + 2] * signalData[n + 2];
+                    sum3 += row[n + 3] * signalData[n + 3];
+                }
+                for (; n < windowSize; ++n)
+                {
+                    sum0 += row[n] * signalData[n];
+                }
+                result[k] = (sum0 + sum1) + (sum2 + sum3);
+            }
+        }
+        else
+        {
+            math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), _dctMatrix.GetConstReference(), signal, static_cast<ValueType>(0.0), result);
+        }
+    }
+
 } // end namespace dsp
 } // namespace ell
 
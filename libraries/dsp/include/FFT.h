@@ -6,12 +6,14 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#pragma once
+
 #include <math/include/MathConstants.h>
 #include <math/include/Vector.h>
 
-#include <utilities/include/Unused.h>
-
 #include <complex>
+#include <map>
+#include <mutex>
 #include <vector>
 
 namespace ell
@@ -75,6 +77,29 @@ namespace dsp
             }
         }
 
+        // Returns the table of twiddle factors w^k = e^(i*pi*k/halfN) for k in [0, halfN). The
+        // tables are computed once per transform size and then reused, since the audio frontend
+        // runs the same transform length over and over.
+        template <typename ValueType>
+        const std::vector<std::complex<ValueType>>& GetTwiddleFactors(size_t halfN)
+        {
+            static std::map<size_t, std::vector<std::complex<ValueType>>> cache;
+            static std::mutex mutex;
+            const ValueType pi = math::Constants<ValueType>::pi;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto& table = cache[halfN];
+            if (table.empty())
+            {
+                table.resize(halfN);
+                for (size_t k = 0; k < halfN; ++k)
+                {
+                    table[k] = std::exp(std::complex<ValueType>(0, pi * k / halfN));
+                }
+            }
+            return table;
+        }
+
         template <typename Iterator>
         void FFT(Iterator begin, Iterator end, Iterator scratch, bool inverse)
         {
@@ -83,7 +108,6 @@ namespace dsp
                 throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
             }
             using ValueType = typename Iterator::value_type::value_type;
-            const ValueType pi = math::Constants<ValueType>::pi;
 
             auto halfN = (end - begin) / 2;
             if (halfN < 1)
@@ -101,10 +125,11 @@ namespace dsp
                 FFT(odds, odds + halfN, scratch, inverse);
             }
 
+            const auto& twiddleFactors = GetTwiddleFactors<ValueType>(halfN);
             for (int k = 0; k < halfN; k++)
             {
                 // w = e^(2*pi*k/N)
-                std::complex<ValueType> w = std::exp(std::complex<ValueType>(0, pi * k / halfN));
+                std::complex<ValueType> w = twiddleFactors[k];
                 auto e = evens[k];
                 auto o = odds[k];
                 auto wo = w * o;
@@ -113,55 +138,52 @@ namespace dsp
             }
         }
 
-        template <typename Iterator, typename ComplexIterator>
-        void FFTReal(Iterator begin, Iterator end, Iterator scratch, ComplexIterator outputBegin, ComplexIterator outputEnd, bool inverse)
+        // Computes the magnitudes of the DFT of a real-valued signal in place. The even and odd
+        // samples are packed into complex values so that only a half-length complex transform
+        // runs, and the full spectrum is then recovered through the conjugate symmetry of a real
+        // transform, which halves the butterflies and the working memory of the complex path.
+        template <typename Iterator>
+        void FFTRealMagnitudes(Iterator begin, Iterator end, bool inverse)
         {
-            UNUSED(outputEnd);
             if (inverse)
             {
                 throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "inverse must be false");
             }
 
             using ValueType = typename Iterator::value_type;
-            const ValueType pi = math::Constants<ValueType>::pi;
 
-            auto halfN = (end - begin) / 2;
+            auto halfN = static_cast<size_t>(end - begin) / 2;
             if (halfN < 1)
             {
                 return; // done
             }
 
-            Deinterleave(begin, end, scratch);
-
-            auto evens = begin;
-            auto odds = begin + halfN;
-            auto complexEvens = outputBegin;
-            auto complexOdds = outputBegin + halfN;
-
-            if (halfN > 1)
+            // pack adjacent sample pairs into complex values and transform at half length
+            std::vector<std::complex<ValueType>> packed(halfN);
+            for (size_t index = 0; index < halfN; ++index)
             {
-                FFTReal(evens, evens + halfN, scratch, complexEvens, complexEvens + halfN, inverse);
-                FFTReal(odds, odds + halfN, scratch, complexOdds, complexOdds + halfN, inverse);
-            }
-            else
-            {
-                // Base case: copy from real to complex
-                for (int index = 0; index < halfN; ++index)
-                {
-                    complexEvens[index] = evens[index];
-                    complexOdds[index] = odds[index];
-                }
+                packed[index] = { begin[2 * index], begin[2 * index + 1] };
             }
-
-            for (int k = 0; k < halfN; k++)
+            std::vector<std::complex<ValueType>> scratch(halfN / 2);
+            FFT(packed.begin(), packed.end(), scratch.begin(), inverse);
+
+            // With this file's e^(+i...) convention, X[k] = E[k] + w^k * O[k], where the
+            // even-sample and odd-sample spectra are E[k] = (Z[k] + conj(Z[halfN-k])) / 2 and
+            // O[k] = -i * (Z[k] - conj(Z[halfN-k])) / 2, and the back half of the spectrum
+            // mirrors the front because X[N-k] = conj(X[k]) for real input.
+            const auto& twiddleFactors = GetTwiddleFactors<ValueType>(halfN);
+            auto size = 2 * halfN;
+            begin[0] = std::abs(packed[0].real() + packed[0].imag());
+            begin[halfN] = std::abs(packed[0].real() - packed[0].imag());
+            for (size_t k = 1; k < halfN; ++k)
             {
-                // w = e^(2*pi*k/N)
-                std::complex<ValueType> w = std::exp(std::complex<ValueType>(0, pi * k / halfN));
-                auto e = complexEvens[k];
-                auto o = complexOdds[k];
-                auto wo = w * o;
-                complexEvens[k] = e + wo; // even
-                complexOdds[k] = e - wo; // odd
+                auto z = packed[k];
+                auto zMirror = std::conj(packed[halfN - k]);
+                auto evenPart = (z + zMirror) * static_cast<ValueType>(0.5);
+                auto oddPart = std::complex<ValueType>(0, static_cast<ValueType>(-0.5)) * (z - zMirror);
+                auto magnitude = std::abs(evenPart + twiddleFactors[k] * oddPart);
+                begin[k] = magnitude;
+                begin[size - k] = magnitude;
             }
         }
     } // namespace detail
@@ -176,28 +198,14 @@ namespace dsp
     template <typename ValueType>
     void FFT(std::vector<ValueType>& input, bool inverse)
     {
-        auto size = input.size();
-        std::vector<ValueType> scratch(size / 2);
-        std::vector<std::complex<ValueType>> output(size);
-        detail::FFTReal(std::begin(input), std::end(input), std::begin(scratch), std::begin(output), std::end(output), inverse);
-        for (size_t index = 0; index < size; ++index)
-        {
-            input[index] = std::abs(output[index]);
-        }
+        detail::FFTRealMagnitudes(std::begin(input), std::end(input), inverse);
     }
 
     template <typename ValueType>
     void FFT(math::RowVector<ValueType>& input, bool inverse)
     {
         using std::begin;
-        auto size = input.Size();
-        math::RowVector<ValueType> scratch(size / 2);
-        std::vector<std::complex<ValueType>> output(size);
-        detail::FFTReal(begin(input), end(input), begin(scratch), begin(output), end(output), inverse);
-        for (size_t index = 0; index < size; ++index)
-        {
-            input[index] = std::abs(output[index]);
-        }
+        detail::FFTRealMagnitudes(begin(input), end(input), inverse);
     }
 } // namespace dsp
 } // namespace ell
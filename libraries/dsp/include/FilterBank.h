@@ -278,6 +278,52 @@ namespace dsp
         size_t _fftSize;
     };
 
+    /// <summary> A stateful evaluator that applies a triangular filter bank to successive frames of frequency
+    /// magnitudes, reusing the per-filter sums from the previous frame and updating only the bins that changed.
+    /// When consecutive frames share most of their spectrum (hop size smaller than the window), this replaces the
+    /// full per-filter dot products with a handful of delta updates. </summary>
+    /// Note: the incremental updates accumulate rounding error over many frames; call `Reset` periodically if
+    /// exact agreement with a full evaluation is needed.
+    template <typename ValueType>
+    class IncrementalFilterBankEvaluator
+    {
+    public:
+        IncrementalFilterBankEvaluator() = default;
+
+        /// <summary> Construct an evaluator for the given filter bank. </summary>
+        /// The active filters are flattened into a bin-major sparse form, so the evaluator doesn't keep a
+        /// reference to the filter bank.
+        ///
+        /// <param name="filterBank"> The filter bank to evaluate. </param>
+        explicit IncrementalFilterBankEvaluator(const TriangleFilterBank& filterBank);
+
+        /// <summary> Apply the filter bank to the real-valued magnitudes of an FFT. </summary>
+        /// The first frame (and any frame whose size differs from the previous one) is evaluated in full;
+        /// subsequent frames update only the filters covering bins whose magnitude changed.
+        ///
+        /// <param name="frequencyMagnitudes"> The array of frequency magnitudes to apply the filters to. </param>
+        ///
+        /// <returns> The filtered array of frequency magnitudes. </returns>
+        const std::vector<ValueType>& FilterFrequencyMagnitudes(const std::vector<ValueType>& frequencyMagnitudes);
+
+        /// <summary> Forget the previous frame, so that the next frame is evaluated in full. </summary>
+        void Reset();
+
+        /// <summary> Indicate whether this evaluator has been constructed from a filter bank. </summary>
+        bool IsInitialized() const { return !_binOffsets.empty(); }
+
+    private:
+        // The active filters' weights, stored bin-major: entries [_binOffsets[k], _binOffsets[k + 1]) hold
+        // the (filter, weight) pairs of the filters whose support covers bin k.
+        std::vector<size_t> _binOffsets;
+        std::vector<size_t> _binFilters;
+        std::vector<ValueType> _binWeights;
+
+        std::vector<ValueType> _previousMagnitudes;
+        std::vector<ValueType> _filterSums;
+        bool _hasPreviousMagnitudes = false;
+    };
+
     // Helper functions
 
     /// <summary> Convert a frequency (in Hz) to the mel scale. </summary>
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Int8Convolution.h (dsp)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <math/include/Tensor.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace ell
+{
+namespace dsp
+{
+    /// <summary> A tensor quantized to 8-bit integers, with the scale needed to recover the original values. </summary>
+    template <typename ValueType>
+    struct Int8QuantizedTensor
+    {
+        /// <summary> The quantized values. Each original value is approximately `values * scale`. </summary>
+        math::ChannelColumnRowTensor<int8_t> values;
+
+        /// <summary> The dequantization scale. </summary>
+        ValueType scale;
+    };
+
+    /// <summary> A stack of convolution filters quantized to 8-bit integers, with one scale per filter. </summary>
+    template <typename ValueType>
+    struct Int8QuantizedFilters
+    {
+        /// <summary> The quantized filter values, in the same ((nf*fr) x fc x d) layout as the full-precision filters. </summary>
+        math::ChannelColumnRowTensor<int8_t> values;
+
+        /// <summary> The per-filter dequantization scales. </summary>
+        std::vector<ValueType> scales;
+    };
+
+    /// <summary> Quantize a tensor to 8-bit integers with a single symmetric scale (maxAbs / 127). </summary>
+    ///
+    /// <param name="tensor"> The tensor to quantize. </param>
+    ///
+    /// <returns> The quantized tensor and its dequantization scale. </returns>
+    template <typename ValueType>
+    Int8QuantizedTensor<ValueType> QuantizeTensorInt8(const math::ConstChannelColumnRowTensorReference<ValueType>& tensor);
+
+    /// <summary> Quantize a stack of convolution filters to 8-bit integers, with a separate symmetric scale per filter. </summary>
+    ///
+    /// <param name="filters"> The filters to quantize. A (nf x fr x fc x d) tensor, reshaped as a ((nf*fr) x fc x d) 3D tensor. </param>
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    ///
+    /// <returns> The quantized filters and their per-filter dequantization scales. </returns>
+    template <typename ValueType>
+    Int8QuantizedFilters<ValueType> QuantizeFiltersInt8(const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters);
+
+    /// <summary> Spatially (in 2D) convolve a quantized 3D image with a stack of quantized 3D filters. </summary>
+    /// The products are accumulated in 32-bit integers and the result is dequantized with the product
+    /// of the signal scale and the per-filter scale.
+    ///
+    /// <param name="signal"> The quantized input image. </param>
+    /// <param name="filters"> The quantized filters to convolve with. </param>
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    /// <param name="stride"> The number of elements to move/jump when sliding over the input. Typically this is 1 to 3. </param>
+    ///
+    /// <returns> A tensor with the dequantized result of the convolution `signal` (*) `filters`. </returns>
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DInt8(const Int8QuantizedTensor<ValueType>& signal, const Int8QuantizedFilters<ValueType>& filters, int numFilters, int stride);
+
+    /// <summary> Spatially (in 2D) convolve a full-precision 3D image with a stack of quantized 3D filters. </summary>
+    /// The signal is quantized on the fly with a single symmetric scale.
+    ///
+    /// <param name="signal"> The input image: a (r x c x d) tensor. </param>
+    /// <param name="filters"> The quantized filters to convolve with. </param>
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    /// <param name="stride"> The number of elements to move/jump when sliding over the input. Typically this is 1 to 3. </param>
+    ///
+    /// <returns> A tensor with the dequantized result of the convolution `signal` (*) `filters`. </returns>
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DInt8(const math::ConstChannelColumnRowTensorReference<ValueType>& signal, const Int8QuantizedFilters<ValueType>& filters, int numFilters, int stride);
+
+    //
+    // Explicit instantiation declarations:
+    //
+    extern template Int8QuantizedTensor<float> QuantizeTensorInt8(const math::ConstChannelColumnRowTensorReference<float>& tensor);
+    extern template Int8QuantizedTensor<double> QuantizeTensorInt8(const math::ConstChannelColumnRowTensorReference<double>& tensor);
+
+    extern template Int8QuantizedFilters<float> QuantizeFiltersInt8(const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters);
+    extern template Int8QuantizedFilters<double> QuantizeFiltersInt8(const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters);
+
+    extern template math::ChannelColumnRowTensor<float> Convolve2DInt8(const Int8QuantizedTensor<float>& signal, const Int8QuantizedFilters<float>& filters, int numFilters, int stride);
+    extern template math::ChannelColumnRowTensor<double> Convolve2DInt8(const Int8QuantizedTensor<double>& signal, const Int8QuantizedFilters<double>& filters, int numFilters, int stride);
+
+    extern template math::ChannelColumnRowTensor<float> Convolve2DInt8(const math::ConstChannelColumnRowTensorReference<float>& signal, const Int8QuantizedFilters<float>& filters, int numFilters, int stride);
+    extern template math::ChannelColumnRowTensor<double> Convolve2DInt8(const math::ConstChannelColumnRowTensorReference<double>& signal, const Int8QuantizedFilters<double>& filters, int numFilters, int stride);
+} // namespace dsp
+} // namespace ell
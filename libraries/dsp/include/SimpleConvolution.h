@@ -78,5 +78,21 @@ namespace dsp
     /// <param name="result"> The tensor to write the result into. </param>
     template <typename ValueType>
     void Convolve2DSimple(math::ConstChannelColumnRowTensorReference<ValueType> input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, math::ChannelColumnRowTensorReference<ValueType> result);
+
+    /// <summary> Spatially convolve a 3D image with a stack of 3D filters, recomputing only a region of the output. </summary>
+    ///
+    /// Recomputes the output elements in `outputRegion` (across all filters), leaving the rest of
+    /// `result` untouched. Used for incremental inference: when only part of the input changed,
+    /// pass the region returned by `GetAffectedOutputRegion` to bring a previously-computed result
+    /// up to date without a full recompute.
+    ///
+    /// <param name="input"> The input image: a (r x c x d) tensor. </param>
+    /// <param name="filters"> The filters to convolve with. A (nf x fr x fc x d) tensor, reshaped as a ((nf*fr) x fc x d) 3D tensor. </param>
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    /// <param name="stride"> The number of elements to move/jump when sliding over the input. Typically this is 1 to 3. </param>
+    /// <param name="outputRegion"> The region of output elements to recompute. </param>
+    /// <param name="result"> The tensor to write the result into. </param>
+    template <typename ValueType>
+    void Convolve2DSimple(math::ConstChannelColumnRowTensorReference<ValueType> input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, const ConvolutionRegion& outputRegion, math::ChannelColumnRowTensorReference<ValueType> result);
 } // namespace dsp
 } // namespace ell
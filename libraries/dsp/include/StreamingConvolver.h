@@ -0,0 +1,257 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     StreamingConvolver.h (dsp)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "FFT.h"
+
+#include <utilities/include/Archiver.h>
+#include <utilities/include/IArchivable.h>
+#include <utilities/include/RingBuffer.h>
+#include <utilities/include/TypeName.h>
+
+#include <complex>
+#include <vector>
+
+namespace ell
+{
+namespace dsp
+{
+    /// <summary> The algorithm a StreamingConvolver uses to process samples. </summary>
+    enum class StreamingConvolutionMethod : int
+    {
+        /// <summary> Choose the algorithm by filter length. </summary>
+        automatic = 0,
+        /// <summary> Direct-form FIR evaluation against a ring-buffered history. </summary>
+        direct,
+        /// <summary> Block FFT (overlap-save) convolution against a cached filter spectrum. </summary>
+        overlapSave,
+    };
+
+    /// <summary> A stateful, streaming version of `Convolve1D`. Samples are accepted incrementally
+    /// and each output of the "valid" convolution of the whole stream with the filter is emitted
+    /// exactly once, so nothing is recomputed when the signal arrives in overlapping hops. Short
+    /// filters run in direct form against a ring-buffered history; long filters run block-by-block
+    /// with the overlap-save FFT method and a precomputed filter spectrum. </summary>
+    template <typename ValueType>
+    class StreamingConvolver : public utilities::IArchivable
+    {
+    public:
+        /// <summary> Construct a streaming convolver for a filter. </summary>
+        ///
+        /// <param name="filter"> The filter to convolve the sample stream with. </param>
+        /// <param name="method"> The algorithm to use, or `automatic` to choose by filter length. </param>
+        StreamingConvolver(std::vector<ValueType> filter, StreamingConvolutionMethod method = StreamingConvolutionMethod::automatic);
+
+        /// <summary> Process new input samples. <summary>
+        ///
+        /// <param name="x"> The new input samples to process. <param>
+        ///
+        /// <returns> The output samples that became available, in order. The first output is emitted
+        /// once the stream covers the filter, and the overlap-save method emits a block of outputs
+        /// each time a block of input completes, so the result can be shorter or longer than `x`. </returns>
+        std::vector<ValueType> FilterSamples(const std::vector<ValueType>& x);
+
+        /// <summary> Reset the internal state of the convolver, as if no samples had been seen. </summary>
+        void Reset();
+
+        /// <summary> Accessor for the filter coefficients. </summary>
+        ///
+        /// <returns> The filter being convolved with the sample stream. </returns>
+        const std::vector<ValueType>& GetFilter() const { return _filter; }
+
+        /// <summary> Accessor for the algorithm in use. </summary>
+        ///
+        /// <returns> The resolved method: `direct` or `overlapSave`, never `automatic`. </returns>
+        StreamingConvolutionMethod GetMethod() const { return _method; }
+
+        /// <summary> Gets the name of this type. </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("StreamingConvolver"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+    protected:
+        void WriteToArchive(utilities::Archiver& archiver) const override;
+        void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+    private:
+        void Initialize(StreamingConvolutionMethod method);
+        void FilterBlock(std::vector<ValueType>& output);
+
+        std::vector<ValueType> _filter;
+        StreamingConvolutionMethod _method = StreamingConvolutionMethod::direct;
+        size_t _samplesSeen = 0;
+
+        // direct form state
+        utilities::RingBuffer<ValueType> _history;
+
+        // overlap-save state: a block holds the last (filter size - 1) samples of the previous
+        // block followed by new input, and the filter spectrum is computed once
+        std::vector<ValueType> _block;
+        size_t _blockPosition = 0;
+        std::vector<std::complex<ValueType>> _filterSpectrum;
+    };
+} // namespace dsp
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace dsp
+{
+    template <typename ValueType>
+    StreamingConvolver<ValueType>::StreamingConvolver(std::vector<ValueType> filter, StreamingConvolutionMethod method) :
+        _filter(std::move(filter)),
+        _history(0)
+    {
+        Initialize(method);
+    }
+
+    template <typename ValueType>
+    void StreamingConvolver<ValueType>::Initialize(StreamingConvolutionMethod method)
+    {
+        // For short filters the per-output cost of direct evaluation is below the per-output
+        // cost of the block FFTs, so only long filters get the overlap-save path.
+        constexpr size_t directFormLimit = 32;
+        if (method == StreamingConvolutionMethod::automatic)
+        {
+            method = _filter.size() < directFormLimit ? StreamingConvolutionMethod::direct : StreamingConvolutionMethod::overlapSave;
+        }
+        _method = method;
+
+        if (_method == StreamingConvolutionMethod::direct)
+        {
+            _history.Resize(_filter.size());
+        }
+        else
+        {
+            // choose the smallest power-of-2 block at least 4x the filter length, so at least
+            // three quarters of each block produces output
+            size_t blockSize = 1;
+            while (blockSize < 4 * _filter.size())
+            {
+                blockSize *= 2;
+            }
+            _block.resize(blockSize);
+
+            // the filter spectrum is the transform of the reversed filter, since `Convolve1D`
+            // correlates the filter with the signal rather than convolving it
+            std::vector<std::complex<ValueType>> spectrum(blockSize);
+            for (size_t index = 0; index < _filter.size(); ++index)
+            {
+                spectrum[index] = _filter[_filter.size() - 1 - index];
+            }
+            FFT(spectrum);
+            _filterSpectrum = std::move(spectrum);
+        }
+        Reset();
+    }
+
+    template <typename ValueType>
+    std::vector<ValueType> StreamingConvolver<ValueType>::FilterSamples(const std::vector<ValueType>& x)
+    {
+        std::vector<ValueType> result;
+        if (_method == StreamingConvolutionMethod::direct)
+        {
+            auto filterSize = _filter.size();
+            result.reserve(x.size());
+            for (auto sample : x)
+            {
+                _history.Append(sample);
+                if (++_samplesSeen < filterSize)
+                {
+                    continue; // the stream doesn't cover the filter yet
+                }
+                ValueType accum = 0;
+                for (size_t index = 0; index < filterSize; ++index)
+                {
+                    accum += _filter[index] * _history[filterSize - 1 - index];
+                }
+                result.push_back(accum);
+            }
+        }
+        else
+        {
+            for (auto sample : x)
+            {
+                _block[_blockPosition++] = sample;
+                if (_blockPosition == _block.size())
+                {
+                    FilterBlock(result);
+                }
+            }
+        }
+        return result;
+    }
+
+    template <typename ValueType>
+    void StreamingConvolver<ValueType>::FilterBlock(std::vector<ValueType>& output)
+    {
+        auto blockSize = _block.size();
+        auto historySize = _filter.size() - 1;
+
+        // circular convolution by pointwise multiplication in the frequency domain; the FFT in
+        // this library uses the e^(+i...) convention, whose inverse is conj(FFT(conj(x))) / N
+        std::vector<std::complex<ValueType>> spectrum(_block.begin(), _block.end());
+        FFT(spectrum);
+        for (size_t index = 0; index < blockSize; ++index)
+        {
+            spectrum[index] = std::conj(spectrum[index] * _filterSpectrum[index]);
+        }
+        FFT(spectrum);
+
+        // the first (filter size - 1) positions are wrapped and discarded; the rest are valid,
+        // except for outputs that would reach back before the start of the stream
+        const ValueType scale = static_cast<ValueType>(1) / blockSize;
+        for (size_t index = historySize; index < blockSize; ++index)
+        {
+            if (++_samplesSeen > historySize)
+            {
+                output.push_back(spectrum[index].real() * scale);
+            }
+        }
+
+        // carry the trailing samples over as the next block's history
+        std::copy(_block.end() - historySize, _block.end(), _block.begin());
+        _blockPosition = historySize;
+    }
+
+    template <typename ValueType>
+    void StreamingConvolver<ValueType>::Reset()
+    {
+        _samplesSeen = 0;
+        _history.Fill(0);
+        std::fill(_block.begin(), _block.end(), 0);
+        _blockPosition = _filter.empty() ? 0 : _filter.size() - 1;
+    }
+
+    template <typename ValueType>
+    void StreamingConvolver<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        archiver["filter"] << _filter;
+        archiver["method"] << static_cast<int>(_method);
+    }
+
+    template <typename ValueType>
+    void StreamingConvolver<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        int method = 0;
+        archiver["filter"] >> _filter;
+        archiver["method"] >> method;
+        Initialize(static_cast<StreamingConvolutionMethod>(method));
+    }
+} // namespace dsp
+} // namespace ell
+
+#pragma endregion implementation
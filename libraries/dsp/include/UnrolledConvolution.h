@@ -10,6 +10,7 @@
 
 #include "Convolution.h"
 
+#include <math/include/Matrix.h>
 #include <math/include/Tensor.h>
 #include <math/include/Vector.h>
 
@@ -17,6 +18,56 @@ namespace ell
 {
 namespace dsp
 {
+    /// <summary> A reusable workspace for unrolled convolution. </summary>
+    ///
+    /// Holds the receptive-field (im2col) matrix and the other scratch buffers used by
+    /// `Convolve2DUnrolled`, so that repeated calls with the same shapes --- per-frame video
+    /// inference, for example --- don't pay for a fresh multi-megabyte allocation on every call.
+    /// For stride-1 convolutions, input rows that are unchanged since the previous call are
+    /// not repacked.
+    template <typename ValueType>
+    class UnrolledConvolutionWorkspace
+    {
+    public:
+        /// <summary> Reshapes an input tensor into the receptive-field matrix, reusing the previous
+        /// packing for input rows that haven't changed since the last call. </summary>
+        ///
+        /// <param name="input"> The input image: a (r x c x d) tensor. </param>
+        /// <param name="filterSize"> The spatial size of the filters. </param>
+        /// <param name="stride"> The number of elements to move/jump when sliding over the input. </param>
+        ///
+        /// <returns> The packed receptive-field matrix. </returns>
+        const math::RowMatrix<ValueType>& PackInput(math::ConstChannelColumnRowTensorReference<ValueType> input, int filterSize, int stride);
+
+        /// <summary> Gets the filter weights reshaped into a matrix usable by the unrolled convolution GEMM call.
+        /// The weights are repacked on every call (their contents may have changed), but into reused storage. </summary>
+        ///
+        /// <param name="filters"> The filters to convolve with. A (nf x fr x fc x d) tensor, reshaped as a ((nf*fr) x fc x d) 3D tensor. </param>
+        ///
+        /// <returns> The reshaped weights matrix. </returns>
+        const math::RowMatrix<ValueType>& GetWeightsMatrix(const math::ConstChannelColumnRowTensorReference<ValueType>& filters);
+
+        /// <summary> Gets a scratch matrix for the convolution output, reusing storage when the dimensions match the previous call. </summary>
+        ///
+        /// <param name="numRows"> The number of rows. </param>
+        /// <param name="numColumns"> The number of columns. </param>
+        ///
+        /// <returns> The scratch matrix. Its contents are undefined. </returns>
+        math::RowMatrix<ValueType>& GetOutputMatrix(size_t numRows, size_t numColumns);
+
+        /// <summary> Discards any cached state, forcing the next `PackInput` call to repack from scratch. </summary>
+        void Reset();
+
+    private:
+        math::RowMatrix<ValueType> _shapedInput{ 0, 0 };
+        math::RowMatrix<ValueType> _weightsMatrix{ 0, 0 };
+        math::RowMatrix<ValueType> _outputMatrix{ 0, 0 };
+        math::ChannelColumnRowTensor<ValueType> _previousInput{ 0, 0, 0 };
+        bool _hasPreviousInput = false;
+        int _filterSize = 0;
+        int _stride = 1;
+    };
+
     /// <summary> Convolve a 1D input with a 1D filter. </summary>
     ///
     /// <param name="input"> The input signal. </param>
@@ -47,6 +98,31 @@ namespace dsp
     template <typename ValueType>
     math::ChannelColumnRowTensor<ValueType> Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride);
 
+    /// <summary> Spatially convolve a 3D image with a stack of 3D filters, using a caller-provided workspace for the scratch buffers. </summary>
+    ///
+    /// <param name="input"> The input image: a (r x c x d) tensor. </param>
+    /// <param name="filters"> The filters to convolve with. A (nf x fr x fc x d) tensor, reshaped as a ((nf*fr) x fc x d) 3D tensor. </param>
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    /// <param name="stride"> The number of elements to move/jump when sliding over the input. Typically this is 1 to 3. </param>
+    /// <param name="workspace"> The workspace holding the scratch buffers, reused across calls. </param>
+    ///
+    /// <returns> A tensor with the result of the convolution `input` (*) `filter`
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, UnrolledConvolutionWorkspace<ValueType>& workspace);
+
+    /// <summary> Spatially convolve a 3D image with a stack of 3D filters, writing the result into a caller-provided
+    /// output tensor. Together with the workspace, this makes repeated convolutions with the same shapes
+    /// allocation-free. </summary>
+    ///
+    /// <param name="input"> The input image: a (r x c x d) tensor. </param>
+    /// <param name="filters"> The filters to convolve with. A (nf x fr x fc x d) tensor, reshaped as a ((nf*fr) x fc x d) 3D tensor. </param>
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    /// <param name="stride"> The number of elements to move/jump when sliding over the input. Typically this is 1 to 3. </param>
+    /// <param name="workspace"> The workspace holding the scratch buffers, reused across calls. </param>
+    /// <param name="output"> [out] The tensor that receives the result of the convolution. </param>
+    template <typename ValueType>
+    void Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, UnrolledConvolutionWorkspace<ValueType>& workspace, math::ChannelColumnRowTensorReference<ValueType> output);
+
     template <typename ValueType>
     void ReceptiveFieldToColumns(math::ConstChannelColumnRowTensorReference<ValueType> input, int filterSize, int stride, math::RowMatrix<ValueType>& shapedInput);
 } // namespace dsp
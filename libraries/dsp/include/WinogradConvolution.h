@@ -30,6 +30,16 @@ namespace dsp
         tilesFirst
     };
 
+    /// <summary> The tunable tiling parameters for 2D Winograd convolution. </summary>
+    struct WinogradTilingParameters
+    {
+        /// <summary> The size of the output tiles --- the number of output values to produce at a time. </summary>
+        int tileSize = 2;
+
+        /// <summary> The number of channels (or filters) processed together in the innermost loops. </summary>
+        int blockSize = 64;
+    };
+
     //
     // Main convolution entry points
     //
@@ -84,6 +94,18 @@ namespace dsp
     template <typename ValueType>
     math::ChannelColumnRowTensor<ValueType> Convolve2DWinograd(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int tileSize, WinogradFilterOrder order = WinogradFilterOrder::tilesFirst);
 
+    /// <summary> Spatially convolve a 3D image with a stack of 3D filters, with user-specified tiling parameters. </summary>
+    ///
+    /// <param name="input"> The input image: a (r x c x d) tensor. </param>
+    /// <param name="filters"> The filters to convolve with. A (nf x fr x fc x d) tensor, reshaped as a ((nf*fr) x fc x d) 3D tensor. </param>
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    /// <param name="tilingParameters"> The tiling parameters to use, typically obtained from `AutotuneWinogradTiling`. </param>
+    /// <param name="order"> The ordering to use for the transformed filters. </param>
+    ///
+    /// <returns> A tensor with the result of the convolution `input` (*) `filter`
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DWinograd(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, const WinogradTilingParameters& tilingParameters, WinogradFilterOrder order = WinogradFilterOrder::tilesFirst);
+
     /// <summary> Spatially convolve a 3D image with a stack of 3D filters, using pre-transformed filter weights. </summary>
     ///
     /// <param name="input"> The input image: a (r x c x d) tensor. </param>
@@ -96,6 +118,19 @@ namespace dsp
     template <typename ValueType>
     math::ChannelColumnRowTensor<ValueType> Convolve2DWinogradPretransformed(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& transformedFilters, int numFilters, int tileSize, int filterSize, WinogradFilterOrder order = WinogradFilterOrder::tilesFirst);
 
+    /// <summary> Spatially convolve a 3D image with a stack of 3D filters, using pre-transformed filter weights and user-specified tiling parameters. </summary>
+    ///
+    /// <param name="input"> The input image: a (r x c x d) tensor. </param>
+    /// <param name="transformedFilters"> The transformed filters to convolve with. This is obtained by calling `GetTransformedFilters` or `TransformFilters()`
+    /// <param name="numFilters"> The number of filters in the `filters` argument. </param>
+    /// <param name="tilingParameters"> The tiling parameters to use, typically obtained from `AutotuneWinogradTiling`. </param>
+    /// <param name="filterSize"> The spatial size of the filters. </param>
+    /// <param name="order"> The ordering to use for the transformed filters. </param>
+    ///
+    /// <returns> A tensor with the result of the convolution `input` (*) `filter`
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DWinogradPretransformed(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& transformedFilters, int numFilters, const WinogradTilingParameters& tilingParameters, int filterSize, WinogradFilterOrder order = WinogradFilterOrder::tilesFirst);
+
     /// <summary> Convolve a set of 2D images with a corresponding set of 2D filters. </summary>
     ///
     /// <param name="input"> The input image: a (r x c x d) tensor. </param>
@@ -150,6 +185,33 @@ namespace dsp
     template <typename ValueType>
     void TransformFilters(const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int tileSize, WinogradFilterOrder order, math::ChannelColumnRowTensorReference<ValueType>& transformedFilters);
 
+    //
+    // Tiling parameter autotuning
+    //
+
+    /// <summary> Gets the tiling parameter combinations supported for a given filter size. </summary>
+    ///
+    /// <param name="filterSize"> The size of the filter. </param>
+    ///
+    /// <returns> The supported tiling parameter combinations, or an empty vector if the filter size isn't supported. </returns>
+    std::vector<WinogradTilingParameters> GetWinogradTilingCandidates(int filterSize);
+
+    /// <summary> Finds the fastest tiling parameters for a given convolution shape by benchmarking the candidates on the host. </summary>
+    ///
+    /// Winners are cached, keyed by the input shape and filter configuration, so repeated calls with the same
+    /// shape only benchmark once. Because the benchmark runs on the host, tuning for a deployment target means
+    /// running the autotuner on that target (or a representative device) and baking the resulting parameters
+    /// into the compiled model.
+    ///
+    /// <param name="inputShape"> The shape of the input image: (r x c x d). </param>
+    /// <param name="numFilters"> The number of filters. </param>
+    /// <param name="filterSize"> The size of the filter. </param>
+    /// <param name="order"> The ordering to use for the transformed filters. </param>
+    ///
+    /// <returns> The tiling parameters with the best measured time. </returns>
+    template <typename ValueType>
+    WinogradTilingParameters AutotuneWinogradTiling(const math::TensorShape& inputShape, int numFilters, int filterSize, WinogradFilterOrder order = WinogradFilterOrder::tilesFirst);
+
     //
     // Winograd convolution implementation functions
     //
@@ -11,10 +11,121 @@
 #include "UnrolledConvolution.h"
 #include "WinogradConvolution.h"
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 namespace ell
 {
 namespace dsp
 {
+    namespace
+    {
+        // Applies a per-filter bias and an activation function to each element of `output`.
+        // The activation is passed as a functor (rather than switching on the enum per element)
+        // so that it gets inlined into the loop.
+        template <typename ValueType, typename ActivationFunction>
+        void ApplyEpilogueLoop(const std::vector<ValueType>& bias, ActivationFunction activation, math::ChannelColumnRowTensor<ValueType>& output)
+        {
+            const bool hasBias = !bias.empty();
+            const auto numRows = output.NumRows();
+            const auto numColumns = output.NumColumns();
+            const auto numChannels = output.NumChannels();
+            for (size_t rowIndex = 0; rowIndex < numRows; ++rowIndex)
+            {
+                for (size_t columnIndex = 0; columnIndex < numColumns; ++columnIndex)
+                {
+                    for (size_t channelIndex = 0; channelIndex < numChannels; ++channelIndex)
+                    {
+                        auto value = output(rowIndex, columnIndex, channelIndex);
+                        if (hasBias)
+                        {
+                            value += bias[channelIndex];
+                        }
+                        output(rowIndex, columnIndex, channelIndex) = activation(value);
+                    }
+                }
+            }
+        }
+
+        template <typename ValueType>
+        void ApplyEpilogue(const ConvolutionEpilogue<ValueType>& epilogue, math::ChannelColumnRowTensor<ValueType>& output)
+        {
+            if (!epilogue.bias.empty() && epilogue.bias.size() != output.NumChannels())
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "Epilogue bias must have one entry per filter");
+            }
+
+            switch (epilogue.activation)
+            {
+            case EpilogueActivation::none:
+                ApplyEpilogueLoop(epilogue.bias, [](ValueType x) { return x; }, output);
+                break;
+            case EpilogueActivation::relu:
+                ApplyEpilogueLoop(epilogue.bias, [](ValueType x) { return x > 0 ? x : static_cast<ValueType>(0); }, output);
+                break;
+            case EpilogueActivation::leakyRelu:
+            {
+                const auto leakage = epilogue.leakyReluLeakage;
+                ApplyEpilogueLoop(epilogue.bias, [leakage](ValueType x) { return x > 0 ? x : leakage * x; }, output);
+                break;
+            }
+            default:
+                throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
+            }
+        }
+    } // namespace
+
+    //
+    // Region arithmetic for incremental recomputation
+    //
+
+    ConvolutionRegion GetReceptiveField(const ConvolutionRegion& outputRegion, int filterRows, int filterColumns, int stride)
+    {
+        if (outputRegion.numRows == 0 || outputRegion.numColumns == 0)
+        {
+            return {};
+        }
+        ConvolutionRegion result;
+        result.rowStart = outputRegion.rowStart * stride;
+        result.numRows = (outputRegion.numRows - 1) * stride + filterRows;
+        result.columnStart = outputRegion.columnStart * stride;
+        result.numColumns = (outputRegion.numColumns - 1) * stride + filterColumns;
+        return result;
+    }
+
+    namespace
+    {
+        // Output index o reads input indices [o*stride, o*stride + filterExtent - 1], so its
+        // receptive field intersects dirty input indices [start, start + count - 1] iff
+        // ceil((start - filterExtent + 1) / stride) <= o <= floor((start + count - 1) / stride)
+        void GetAffectedOutputExtent(int start, int count, int filterExtent, int stride, int outputExtent, int& outputStart, int& outputCount)
+        {
+            int first = (start - filterExtent + 1 + (stride - 1)) / stride; // truncation never rounds below the true ceiling here
+            int last = (start + count - 1) / stride;
+            first = std::max(first, 0);
+            last = std::min(last, outputExtent - 1);
+            outputStart = first;
+            outputCount = std::max(last - first + 1, 0);
+        }
+    } // namespace
+
+    ConvolutionRegion GetAffectedOutputRegion(const ConvolutionRegion& dirtyInputRegion, int filterRows, int filterColumns, int stride, int outputRows, int outputColumns)
+    {
+        if (dirtyInputRegion.numRows == 0 || dirtyInputRegion.numColumns == 0)
+        {
+            return {};
+        }
+        ConvolutionRegion result;
+        GetAffectedOutputExtent(dirtyInputRegion.rowStart, dirtyInputRegion.numRows, filterRows, stride, outputRows, result.rowStart, result.numRows);
+        GetAffectedOutputExtent(dirtyInputRegion.columnStart, dirtyInputRegion.numColumns, filterColumns, stride, outputColumns, result.columnStart, result.numColumns);
+        if (result.numRows == 0 || result.numColumns == 0)
+        {
+            return {};
+        }
+        return result;
+    }
+
     //
     // Functions
     //
@@ -66,6 +177,70 @@ namespace dsp
         throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
     }
 
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2D(const math::ConstChannelColumnRowTensorReference<ValueType>& signal, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, const ConvolutionEpilogue<ValueType>& epilogue, ConvolutionMethodOption method)
+    {
+        // Apply the bias and activation in a single pass over the freshly-computed output, while it
+        // is still warm in the cache. Running them as separate layers would read and write the whole
+        // activation tensor twice more.
+        auto result = Convolve2D(signal, filters, numFilters, stride, method);
+        ApplyEpilogue(epilogue, result);
+        return result;
+    }
+
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DParallel(const math::ConstChannelColumnRowTensorReference<ValueType>& signal, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, int numThreads, ConvolutionMethodOption method)
+    {
+        // Validate up front --- the workers run the single-threaded dispatcher, and an exception
+        // escaping a worker thread would terminate the process.
+        if (method == ConvolutionMethodOption::diagonal || (method == ConvolutionMethodOption::winograd && stride != 1))
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
+        }
+
+        if (numThreads <= 0)
+        {
+            numThreads = static_cast<int>(std::thread::hardware_concurrency());
+        }
+        numThreads = std::min(numThreads, numFilters);
+
+        // Partial-depth ("grouped") filters pick their input channels based on their global filter
+        // index, which a filter-range partition would break --- handle them on the serial path.
+        if (numThreads < 2 || filters.NumChannels() != signal.NumChannels())
+        {
+            return Convolve2D(signal, filters, numFilters, stride, method);
+        }
+
+        const auto filterRows = static_cast<int>(filters.NumRows()) / numFilters;
+        const auto filterColumns = static_cast<int>(filters.NumColumns());
+        const auto filterChannels = static_cast<int>(filters.NumChannels());
+        const auto numOutputRows = (static_cast<int>(signal.NumRows()) - filterRows + 1) / stride;
+        const auto numOutputColumns = (static_cast<int>(signal.NumColumns()) - filterColumns + 1) / stride;
+        math::ChannelColumnRowTensor<ValueType> output(numOutputRows, numOutputColumns, numFilters);
+
+        // Partition the filters into contiguous ranges, one per worker. Each worker runs the
+        // single-threaded algorithm on its range and writes its own channel slice of the output.
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads);
+        for (int threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            const int firstFilter = (numFilters * threadIndex) / numThreads;
+            const int lastFilter = (numFilters * (threadIndex + 1)) / numThreads;
+            threads.emplace_back([&, firstFilter, lastFilter] {
+                const int filterCount = lastFilter - firstFilter;
+                auto filterSlice = filters.GetSubTensor(firstFilter * filterRows, 0, 0, filterCount * filterRows, filterColumns, filterChannels);
+                auto result = Convolve2D(signal, filterSlice, filterCount, stride, method);
+                auto outputSlice = output.GetSubTensor(0, 0, firstFilter, numOutputRows, numOutputColumns, filterCount);
+                outputSlice.CopyFrom(result);
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        return output;
+    }
+
     template <typename ValueType>
     math::ChannelColumnRowTensor<ValueType> Convolve2DDepthwiseSeparable(const math::ConstChannelColumnRowTensorReference<ValueType>& signal, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, ConvolutionMethodOption method)
     {
@@ -107,6 +282,12 @@ namespace dsp
     template math::ChannelColumnRowTensor<float> Convolve2D(const math::ConstChannelColumnRowTensorReference<float>& signal, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, ConvolutionMethodOption method);
     template math::ChannelColumnRowTensor<double> Convolve2D(const math::ConstChannelColumnRowTensorReference<double>& signal, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, ConvolutionMethodOption method);
 
+    template math::ChannelColumnRowTensor<float> Convolve2D(const math::ConstChannelColumnRowTensorReference<float>& signal, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, const ConvolutionEpilogue<float>& epilogue, ConvolutionMethodOption method);
+    template math::ChannelColumnRowTensor<double> Convolve2D(const math::ConstChannelColumnRowTensorReference<double>& signal, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, const ConvolutionEpilogue<double>& epilogue, ConvolutionMethodOption method);
+
+    template math::ChannelColumnRowTensor<float> Convolve2DParallel(const math::ConstChannelColumnRowTensorReference<float>& signal, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, int numThreads, ConvolutionMethodOption method);
+    template math::ChannelColumnRowTensor<double> Convolve2DParallel(const math::ConstChannelColumnRowTensorReference<double>& signal, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, int numThreads, ConvolutionMethodOption method);
+
     template math::ChannelColumnRowTensor<float> Convolve2DDepthwiseSeparable(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, ConvolutionMethodOption method);
     template math::ChannelColumnRowTensor<double> Convolve2DDepthwiseSeparable(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, ConvolutionMethodOption method);
 
@@ -307,9 +307,101 @@ namespace dsp
         InitializeBins();
     }
 
+    //
+    // IncrementalFilterBankEvaluator
+    //
+
+    template <typename ValueType>
+    IncrementalFilterBankEvaluator<ValueType>::IncrementalFilterBankEvaluator(const TriangleFilterBank& filterBank)
+    {
+        const size_t numBins = filterBank.GetWindowSize() / 2;
+        const auto beginFilter = filterBank.GetBeginFilter();
+        const auto endFilter = filterBank.GetEndFilter();
+
+        // Count the filters covering each bin, then fill the entries in bin-major order
+        std::vector<size_t> binCounts(numBins, 0);
+        for (size_t filterIndex = beginFilter; filterIndex < endFilter; ++filterIndex)
+        {
+            auto filter = filterBank.GetFilter(filterIndex);
+            const auto end = std::min(filter.GetEnd(), numBins);
+            for (size_t k = filter.GetStart(); k < end; ++k)
+            {
+                ++binCounts[k];
+            }
+        }
+
+        _binOffsets.resize(numBins + 1);
+        _binOffsets[0] = 0;
+        for (size_t k = 0; k < numBins; ++k)
+        {
+            _binOffsets[k + 1] = _binOffsets[k] + binCounts[k];
+        }
+
+        _binFilters.resize(_binOffsets[numBins]);
+        _binWeights.resize(_binOffsets[numBins]);
+        std::vector<size_t> binPositions(_binOffsets.begin(), _binOffsets.end() - 1);
+        for (size_t filterIndex = beginFilter; filterIndex < endFilter; ++filterIndex)
+        {
+            auto filter = filterBank.GetFilter(filterIndex);
+            const auto end = std::min(filter.GetEnd(), numBins);
+            for (size_t k = filter.GetStart(); k < end; ++k)
+            {
+                _binFilters[binPositions[k]] = filterIndex - beginFilter;
+                _binWeights[binPositions[k]] = static_cast<ValueType>(filter[k]);
+                ++binPositions[k];
+            }
+        }
+
+        _filterSums.resize(endFilter - beginFilter);
+    }
+
+    template <typename ValueType>
+    const std::vector<ValueType>& IncrementalFilterBankEvaluator<ValueType>::FilterFrequencyMagnitudes(const std::vector<ValueType>& frequencyMagnitudes)
+    {
+        const size_t numBins = std::min(frequencyMagnitudes.size(), _binOffsets.size() - 1);
+        if (!_hasPreviousMagnitudes || frequencyMagnitudes.size() != _previousMagnitudes.size())
+        {
+            std::fill(_filterSums.begin(), _filterSums.end(), static_cast<ValueType>(0));
+            for (size_t k = 0; k < numBins; ++k)
+            {
+                const auto magnitude = frequencyMagnitudes[k];
+                for (size_t entry = _binOffsets[k]; entry < _binOffsets[k + 1]; ++entry)
+                {
+                    _filterSums[_binFilters[entry]] += magnitude * _binWeights[entry];
+                }
+            }
+            _previousMagnitudes = frequencyMagnitudes;
+            _hasPreviousMagnitudes = true;
+            return _filterSums;
+        }
+
+        // Each changed bin contributes its delta to the few filters whose support covers it
+        for (size_t k = 0; k < numBins; ++k)
+        {
+            if (frequencyMagnitudes[k] != _previousMagnitudes[k])
+            {
+                const auto delta = frequencyMagnitudes[k] - _previousMagnitudes[k];
+                for (size_t entry = _binOffsets[k]; entry < _binOffsets[k + 1]; ++entry)
+                {
+                    _filterSums[_binFilters[entry]] += delta * _binWeights[entry];
+                }
+                _previousMagnitudes[k] = frequencyMagnitudes[k];
+            }
+        }
+        return _filterSums;
+    }
+
+    template <typename ValueType>
+    void IncrementalFilterBankEvaluator<ValueType>::Reset()
+    {
+        _hasPreviousMagnitudes = false;
+    }
+
     //
     // Explicit instantiations
     //
+    template class IncrementalFilterBankEvaluator<float>;
+    template class IncrementalFilterBankEvaluator<double>;
     template std::vector<float> TriangleFilterBank::FilterFrequencyMagnitudes<float>(const std::vector<float>&) const;
     template std::vector<double> TriangleFilterBank::FilterFrequencyMagnitudes<double>(const std::vector<double>&) const;
     template std::vector<float> TriangleFilterBank::FilterFourierCoefficients(const std::vector<std::complex<float>>& fourierCoefficients) const;
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Int8Convolution.cpp (dsp)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Int8Convolution.h"
+
+#include <utilities/include/Exception.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ell
+{
+namespace dsp
+{
+    namespace
+    {
+        // Integer dot product over a contiguous run of channel values, accumulated in 32 bits.
+        // The four independent accumulators mirror the full-precision channel kernel and give the
+        // compiler a loop shape it can turn into widening-multiply SIMD arithmetic on targets that
+        // have it.
+        int32_t ChannelDotInt8(const int8_t* signal, const int8_t* filter, int count)
+        {
+            int32_t sum0 = 0;
+            int32_t sum1 = 0;
+            int32_t sum2 = 0;
+            int32_t sum3 = 0;
+            int index = 0;
+            for (; index + 4 <= count; index += 4)
+            {
+                sum0 += static_cast<int32_t>(signal[index]) * filter[index];
+                sum1 += static_cast<int32_t>(signal[index + 1]) * filter[index + 1];
+                sum2 += static_cast<int32_t>(signal[index + 2]) * filter[index + 2];
+                sum3 += static_cast<int32_t>(signal[index + 3]) * filter[index + 3];
+            }
+            for (; index < count; ++index)
+            {
+                sum0 += static_cast<int32_t>(signal[index]) * filter[index];
+            }
+            return (sum0 + sum1) + (sum2 + sum3);
+        }
+
+        // Returns the largest absolute value in a subtensor, walked by index so that it works on
+        // non-contiguous references.
+        template <typename TensorReferenceType>
+        double GetMaxAbsValue(const TensorReferenceType& tensor, size_t firstRow, size_t numRows)
+        {
+            double maxAbs = 0;
+            for (size_t rowIndex = firstRow; rowIndex < firstRow + numRows; ++rowIndex)
+            {
+                for (size_t columnIndex = 0; columnIndex < tensor.NumColumns(); ++columnIndex)
+                {
+                    for (size_t channelIndex = 0; channelIndex < tensor.NumChannels(); ++channelIndex)
+                    {
+                        maxAbs = std::max(maxAbs, std::abs(static_cast<double>(tensor(rowIndex, columnIndex, channelIndex))));
+                    }
+                }
+            }
+            return maxAbs;
+        }
+
+        // Quantizes a range of rows of `input` into the same rows of `output`, using the given scale.
+        template <typename ValueType>
+        void QuantizeRows(const math::ConstChannelColumnRowTensorReference<ValueType>& input, size_t firstRow, size_t numRows, ValueType scale, math::ChannelColumnRowTensor<int8_t>& output)
+        {
+            const auto invScale = scale == 0 ? static_cast<ValueType>(0) : 1 / scale;
+            for (size_t rowIndex = firstRow; rowIndex < firstRow + numRows; ++rowIndex)
+            {
+                for (size_t columnIndex = 0; columnIndex < input.NumColumns(); ++columnIndex)
+                {
+                    for (size_t channelIndex = 0; channelIndex < input.NumChannels(); ++channelIndex)
+                    {
+                        auto scaled = std::round(static_cast<double>(input(rowIndex, columnIndex, channelIndex) * invScale));
+                        scaled = std::min(127.0, std::max(-127.0, scaled));
+                        output(rowIndex, columnIndex, channelIndex) = static_cast<int8_t>(scaled);
+                    }
+                }
+            }
+        }
+    } // namespace
+
+    template <typename ValueType>
+    Int8QuantizedTensor<ValueType> QuantizeTensorInt8(const math::ConstChannelColumnRowTensorReference<ValueType>& tensor)
+    {
+        Int8QuantizedTensor<ValueType> result{ { tensor.NumRows(), tensor.NumColumns(), tensor.NumChannels() }, 0 };
+        result.scale = static_cast<ValueType>(GetMaxAbsValue(tensor, 0, tensor.NumRows()) / 127.0);
+        QuantizeRows(tensor, 0, tensor.NumRows(), result.scale, result.values);
+        return result;
+    }
+
+    template <typename ValueType>
+    Int8QuantizedFilters<ValueType> QuantizeFiltersInt8(const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters)
+    {
+        const auto filterRows = filters.NumRows() / numFilters;
+        Int8QuantizedFilters<ValueType> result{ { filters.NumRows(), filters.NumColumns(), filters.NumChannels() }, {} };
+        result.scales.resize(numFilters);
+
+        // Each filter gets its own symmetric scale, so a filter with small weights doesn't lose
+        // precision to a filter with large ones.
+        for (int filterIndex = 0; filterIndex < numFilters; ++filterIndex)
+        {
+            auto scale = static_cast<ValueType>(GetMaxAbsValue(filters, filterIndex * filterRows, filterRows) / 127.0);
+            result.scales[filterIndex] = scale;
+            QuantizeRows(filters, filterIndex * filterRows, filterRows, scale, result.values);
+        }
+        return result;
+    }
+
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DInt8(const Int8QuantizedTensor<ValueType>& signal, const Int8QuantizedFilters<ValueType>& filters, int numFilters, int stride)
+    {
+        const auto& signalValues = signal.values;
+        const auto& filterValues = filters.values;
+        if (filterValues.NumChannels() != signalValues.NumChannels())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Int8 convolution requires the filter depth to match the number of signal channels");
+        }
+
+        const auto numChannels = static_cast<int>(signalValues.NumChannels());
+        const auto filterRows = static_cast<int>(filterValues.NumRows()) / numFilters;
+        const auto filterColumns = static_cast<int>(filterValues.NumColumns());
+        const auto outputRows = (static_cast<int>(signalValues.NumRows()) - filterRows + 1) / stride;
+        const auto outputColumns = (static_cast<int>(signalValues.NumColumns()) - filterColumns + 1) / stride;
+        math::ChannelColumnRowTensor<ValueType> result(outputRows, outputColumns, numFilters);
+
+        // Channels are the minor dimension, so each (row, column) tap is a contiguous run of
+        // numChannels values in both the signal and the filter. Walk raw pointers and hand the
+        // contiguous runs to the integer channel kernel, dequantizing once per output value.
+        const int8_t* signalData = signalValues.GetConstDataPointer();
+        const int8_t* filterData = filterValues.GetConstDataPointer();
+        const int signalColumnIncrement = static_cast<int>(signalValues.GetIncrement1());
+        const int signalRowIncrement = static_cast<int>(signalValues.GetIncrement2());
+        const int filterColumnIncrement = static_cast<int>(filterValues.GetIncrement1());
+        const int filterRowIncrement = static_cast<int>(filterValues.GetIncrement2());
+
+        for (int filterIndex = 0; filterIndex < numFilters; ++filterIndex)
+        {
+            const auto outputScale = signal.scale * filters.scales[filterIndex];
+            const int8_t* filterStart = filterData + (filterIndex * filterRows) * filterRowIncrement;
+            for (int rowIndex = 0; rowIndex < outputRows; ++rowIndex)
+            {
+                for (int columnIndex = 0; columnIndex < outputColumns; ++columnIndex)
+                {
+                    int32_t accum = 0;
+                    for (int filterRow = 0; filterRow < filterRows; ++filterRow)
+                    {
+                        const int8_t* signalRow = signalData + (rowIndex * stride + filterRow) * signalRowIncrement + (columnIndex * stride) * signalColumnIncrement;
+                        const int8_t* filterRowStart = filterStart + filterRow * filterRowIncrement;
+                        for (int filterColumn = 0; filterColumn < filterColumns; ++filterColumn)
+                        {
+                            accum += ChannelDotInt8(signalRow + filterColumn * signalColumnIncrement, filterRowStart + filterColumn * filterColumnIncrement, numChannels);
+                        }
+                    }
+                    result(rowIndex, columnIndex, filterIndex) = accum * outputScale;
+                }
+            }
+        }
+        return result;
+    }
+
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DInt8(const math::ConstChannelColumnRowTensorReference<ValueType>& signal, const Int8QuantizedFilters<ValueType>& filters, int numFilters, int stride)
+    {
+        return Convolve2DInt8(QuantizeTensorInt8(signal), filters, numFilters, stride);
+    }
+
+    //
+    // Explicit instantiation definitions:
+    //
+    template Int8QuantizedTensor<float> QuantizeTensorInt8(const math::ConstChannelColumnRowTensorReference<float>& tensor);
+    template Int8QuantizedTensor<double> QuantizeTensorInt8(const math::ConstChannelColumnRowTensorReference<double>& tensor);
+
+    template Int8QuantizedFilters<float> QuantizeFiltersInt8(const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters);
+    template Int8QuantizedFilters<double> QuantizeFiltersInt8(const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters);
+
+    template math::ChannelColumnRowTensor<float> Convolve2DInt8(const Int8QuantizedTensor<float>& signal, const Int8QuantizedFilters<float>& filters, int numFilters, int stride);
+    template math::ChannelColumnRowTensor<double> Convolve2DInt8(const Int8QuantizedTensor<double>& signal, const Int8QuantizedFilters<double>& filters, int numFilters, int stride);
+
+    template math::ChannelColumnRowTensor<float> Convolve2DInt8(const math::ConstChannelColumnRowTensorReference<float>& signal, const Int8QuantizedFilters<float>& filters, int numFilters, int stride);
+    template math::ChannelColumnRowTensor<double> Convolve2DInt8(const math::ConstChannelColumnRowTensorReference<double>& signal, const Int8QuantizedFilters<double>& filters, int numFilters, int stride);
+} // namespace dsp
+} // namespace ell
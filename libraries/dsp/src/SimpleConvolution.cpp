@@ -8,14 +8,40 @@
 
 #include "SimpleConvolution.h"
 
-#include <math/include/VectorOperations.h>
-
 #include <utilities/include/Unused.h>
 
 namespace ell
 {
 namespace dsp
 {
+    namespace
+    {
+        // Dot product over a contiguous run of channel values. The four independent accumulators
+        // keep the multiply-add latency off the critical path and give the compiler a loop shape
+        // it can turn into SIMD arithmetic on targets that have it.
+        template <typename ValueType>
+        ValueType ChannelDot(const ValueType* signal, const ValueType* filter, int count)
+        {
+            ValueType sum0 = 0;
+            ValueType sum1 = 0;
+            ValueType sum2 = 0;
+            ValueType sum3 = 0;
+            int index = 0;
+            for (; index + 4 <= count; index += 4)
+            {
+                sum0 += signal[index] * filter[index];
+                sum1 += signal[index + 1] * filter[index + 1];
+                sum2 += signal[index + 2] * filter[index + 2];
+                sum3 += signal[index + 3] * filter[index + 3];
+            }
+            for (; index < count; ++index)
+            {
+                sum0 += signal[index] * filter[index];
+            }
+            return (sum0 + sum1) + (sum2 + sum3);
+        }
+    } // namespace
+
     //
     // 1D
     //
@@ -76,32 +102,50 @@ namespace dsp
 
     template <typename ValueType>
     void Convolve2DSimple(math::ConstChannelColumnRowTensorReference<ValueType> signal, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, math::ChannelColumnRowTensorReference<ValueType> result)
+    {
+        ConvolutionRegion fullRegion{ 0, static_cast<int>(result.NumRows()), 0, static_cast<int>(result.NumColumns()) };
+        Convolve2DSimple(signal, filters, numFilters, stride, fullRegion, result);
+    }
+
+    template <typename ValueType>
+    void Convolve2DSimple(math::ConstChannelColumnRowTensorReference<ValueType> signal, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, const ConvolutionRegion& outputRegion, math::ChannelColumnRowTensorReference<ValueType> result)
     {
         const auto numChannels = static_cast<int>(signal.NumChannels());
         const auto filterRows = static_cast<int>(filters.NumRows()) / numFilters;
         const auto filterColumns = static_cast<int>(filters.NumColumns());
         const auto numFilterChannels = static_cast<int>(filters.NumChannels());
-        const auto outputRows = static_cast<int>(result.NumRows());
-        const auto outputColumns = static_cast<int>(result.NumColumns());
+        const auto outputRowEnd = outputRegion.rowStart + outputRegion.numRows;
+        const auto outputColumnEnd = outputRegion.columnStart + outputRegion.numColumns;
+
+        // Channels are the minor dimension of a ChannelColumnRowTensor, so each (row, column) tap
+        // is a contiguous run of numFilterChannels values in both the signal and the filter. Walk
+        // raw pointers instead of building tensor slices per tap, and hand the contiguous runs to
+        // the unrolled channel kernel.
+        const ValueType* signalData = signal.GetConstDataPointer();
+        const ValueType* filterData = filters.GetConstDataPointer();
+        const int signalColumnIncrement = static_cast<int>(signal.GetIncrement1());
+        const int signalRowIncrement = static_cast<int>(signal.GetIncrement2());
+        const int filterColumnIncrement = static_cast<int>(filters.GetIncrement1());
+        const int filterRowIncrement = static_cast<int>(filters.GetIncrement2());
 
         for (int filterIndex = 0; filterIndex < numFilters; ++filterIndex)
         {
             const int channelStart = (filterIndex * numFilterChannels) % numChannels;
             const auto filterOffset = filterIndex * filterRows;
-            for (int rowIndex = 0; rowIndex < outputRows; ++rowIndex)
+            for (int rowIndex = outputRegion.rowStart; rowIndex < outputRowEnd; ++rowIndex)
             {
-                for (int columnIndex = 0; columnIndex < outputColumns; ++columnIndex)
+                for (int columnIndex = outputRegion.columnStart; columnIndex < outputColumnEnd; ++columnIndex)
                 {
                     const int inputRowIndex = rowIndex * stride;
                     const int inputColumnIndex = columnIndex * stride;
                     ValueType accum = 0;
                     for (int filterRowIndex = 0; filterRowIndex < filterRows; ++filterRowIndex)
                     {
+                        const ValueType* signalRow = signalData + (inputRowIndex + filterRowIndex) * signalRowIncrement + inputColumnIndex * signalColumnIncrement + channelStart;
+                        const ValueType* filterRow = filterData + (filterOffset + filterRowIndex) * filterRowIncrement;
                         for (int filterColumnIndex = 0; filterColumnIndex < filterColumns; ++filterColumnIndex)
                         {
-                            auto signalVector = signal.GetSubTensor(inputRowIndex + filterRowIndex, inputColumnIndex + filterColumnIndex, channelStart, 1, 1, numFilterChannels).template GetSlice<math::Dimension::channel>(0, 0);
-                            auto filterVector = filters.template GetSlice<math::Dimension::channel>(filterOffset + filterRowIndex, filterColumnIndex);
-                            accum += math::Dot(signalVector, filterVector);
+                            accum += ChannelDot(signalRow + filterColumnIndex * signalColumnIncrement, filterRow + filterColumnIndex * filterColumnIncrement, numFilterChannels);
                         }
                     }
                     result(rowIndex, columnIndex, filterIndex) = accum;
@@ -147,5 +191,8 @@ namespace dsp
 
     template void Convolve2DSimple(math::ConstChannelColumnRowTensorReference<float> signal, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, math::ChannelColumnRowTensorReference<float> result);
     template void Convolve2DSimple(math::ConstChannelColumnRowTensorReference<double> signal, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, math::ChannelColumnRowTensorReference<double> result);
+
+    template void Convolve2DSimple(math::ConstChannelColumnRowTensorReference<float> signal, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, const ConvolutionRegion& outputRegion, math::ChannelColumnRowTensorReference<float> result);
+    template void Convolve2DSimple(math::ConstChannelColumnRowTensorReference<double> signal, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, const ConvolutionRegion& outputRegion, math::ChannelColumnRowTensorReference<double> result);
 } // namespace dsp
 } // namespace ell
@@ -12,6 +12,8 @@
 
 #include <utilities/include/Unused.h>
 
+#include <algorithm>
+
 namespace ell
 {
 namespace dsp
@@ -19,12 +21,9 @@ namespace dsp
     namespace
     {
         template <typename ValueType>
-        math::RowMatrix<ValueType> ComputeWeightsMatrix(const math::ConstChannelColumnRowTensorReference<ValueType>& weightsTensor)
+        void FillWeightsMatrix(const math::ConstChannelColumnRowTensorReference<ValueType>& weightsTensor, math::RowMatrix<ValueType>& weightsMatrix)
         {
-            const auto numChannels = weightsTensor.NumChannels();
             const auto filterSize = static_cast<int>(weightsTensor.NumColumns());
-            const auto numFilters = weightsTensor.NumRows() / filterSize;
-            math::RowMatrix<ValueType> weightsMatrix{ numFilters, filterSize * filterSize * numChannels };
 
             // Reshape the weights
             auto flattened = weightsTensor.ReferenceAsMatrix();
@@ -42,6 +41,16 @@ namespace dsp
                     }
                 }
             }
+        }
+
+        template <typename ValueType>
+        math::RowMatrix<ValueType> ComputeWeightsMatrix(const math::ConstChannelColumnRowTensorReference<ValueType>& weightsTensor)
+        {
+            const auto numChannels = weightsTensor.NumChannels();
+            const auto filterSize = weightsTensor.NumColumns();
+            const auto numFilters = weightsTensor.NumRows() / filterSize;
+            math::RowMatrix<ValueType> weightsMatrix{ numFilters, filterSize * filterSize * numChannels };
+            FillWeightsMatrix(weightsTensor, weightsMatrix);
             return weightsMatrix;
         }
     } // namespace
@@ -131,6 +140,146 @@ namespace dsp
         }
     }
 
+    //
+    // Workspace
+    //
+
+    template <typename ValueType>
+    const math::RowMatrix<ValueType>& UnrolledConvolutionWorkspace<ValueType>::PackInput(math::ConstChannelColumnRowTensorReference<ValueType> input, int filterSize, int stride)
+    {
+        const auto numChannels = static_cast<int>(input.NumChannels());
+        const auto fieldVolumeSize = filterSize * filterSize * numChannels;
+        const auto numInputRows = static_cast<int>(input.NumRows());
+        const auto numOutputRows = (numInputRows - filterSize + 1) / stride;
+        const auto numOutputColumns = (static_cast<int>(input.NumColumns()) - filterSize + 1) / stride;
+
+        const bool sameConfiguration = _hasPreviousInput && _filterSize == filterSize && _stride == stride &&
+                                       input.NumRows() == _previousInput.NumRows() && input.NumColumns() == _previousInput.NumColumns() && input.NumChannels() == _previousInput.NumChannels();
+        if (static_cast<int>(_shapedInput.NumRows()) != fieldVolumeSize || static_cast<int>(_shapedInput.NumColumns()) != numOutputRows * numOutputColumns)
+        {
+            _shapedInput = math::RowMatrix<ValueType>(fieldVolumeSize, numOutputRows * numOutputColumns);
+        }
+
+        // Rows can only be compared (and skipped) cheaply when each input row is a contiguous run of memory
+        const bool contiguousRows = input.GetIncrement1() == input.NumChannels();
+        if (!sameConfiguration || stride != 1 || !contiguousRows)
+        {
+            ReceptiveFieldToColumns(input, filterSize, stride, _shapedInput);
+            _previousInput = math::ChannelColumnRowTensor<ValueType>(input);
+            _hasPreviousInput = true;
+            _filterSize = filterSize;
+            _stride = stride;
+            return _shapedInput;
+        }
+
+        // Incremental repack: find the input rows that changed since the previous call and repack
+        // only the receptive-field entries that read them. With stride 1, input row r feeds output
+        // rows r-filterSize+1 through r.
+        const auto rowSize = input.NumColumns() * input.NumChannels();
+        for (int inputRow = 0; inputRow < numInputRows; ++inputRow)
+        {
+            const ValueType* currentRow = input.GetConstDataPointer() + inputRow * input.GetIncrement2();
+            ValueType* previousRow = _previousInput.GetDataPointer() + inputRow * _previousInput.GetIncrement2();
+            if (std::equal(currentRow, currentRow + rowSize, previousRow))
+            {
+                continue;
+            }
+            std::copy(currentRow, currentRow + rowSize, previousRow);
+
+            for (int fieldRow = 0; fieldRow < filterSize; ++fieldRow)
+            {
+                const int outputRow = inputRow - fieldRow;
+                if (outputRow < 0 || outputRow >= numOutputRows)
+                {
+                    continue;
+                }
+                for (int fieldColumn = 0; fieldColumn < filterSize; ++fieldColumn)
+                {
+                    for (int channel = 0; channel < numChannels; ++channel)
+                    {
+                        const int f = (fieldRow * filterSize + fieldColumn) * numChannels + channel;
+                        for (int w = 0; w < numOutputColumns; ++w)
+                        {
+                            _shapedInput(f, outputRow * numOutputColumns + w) = input(inputRow, w + fieldColumn, channel);
+                        }
+                    }
+                }
+            }
+        }
+        return _shapedInput;
+    }
+
+    template <typename ValueType>
+    const math::RowMatrix<ValueType>& UnrolledConvolutionWorkspace<ValueType>::GetWeightsMatrix(const math::ConstChannelColumnRowTensorReference<ValueType>& filters)
+    {
+        const auto numChannels = filters.NumChannels();
+        const auto filterSize = filters.NumColumns();
+        const auto numFilters = filters.NumRows() / filterSize;
+        const auto fieldVolumeSize = filterSize * filterSize * numChannels;
+        if (_weightsMatrix.NumRows() != numFilters || _weightsMatrix.NumColumns() != fieldVolumeSize)
+        {
+            _weightsMatrix = math::RowMatrix<ValueType>(numFilters, fieldVolumeSize);
+        }
+        FillWeightsMatrix(filters, _weightsMatrix);
+        return _weightsMatrix;
+    }
+
+    template <typename ValueType>
+    math::RowMatrix<ValueType>& UnrolledConvolutionWorkspace<ValueType>::GetOutputMatrix(size_t numRows, size_t numColumns)
+    {
+        if (_outputMatrix.NumRows() != numRows || _outputMatrix.NumColumns() != numColumns)
+        {
+            _outputMatrix = math::RowMatrix<ValueType>(numRows, numColumns);
+        }
+        return _outputMatrix;
+    }
+
+    template <typename ValueType>
+    void UnrolledConvolutionWorkspace<ValueType>::Reset()
+    {
+        _hasPreviousInput = false;
+    }
+
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, UnrolledConvolutionWorkspace<ValueType>& workspace)
+    {
+        const auto filterSize = static_cast<int>(filters.NumColumns());
+        const auto numOutputRows = (static_cast<int>(input.NumRows()) - filterSize + 1) / stride;
+        const auto numOutputColumns = (static_cast<int>(input.NumColumns()) - filterSize + 1) / stride;
+
+        math::ChannelColumnRowTensor<ValueType> output{ static_cast<size_t>(numOutputRows), static_cast<size_t>(numOutputColumns), static_cast<size_t>(numFilters) };
+        Convolve2DUnrolled(input, filters, numFilters, stride, workspace, output);
+        return output;
+    }
+
+    template <typename ValueType>
+    void Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, int stride, UnrolledConvolutionWorkspace<ValueType>& workspace, math::ChannelColumnRowTensorReference<ValueType> output)
+    {
+        const auto filterSize = static_cast<int>(filters.NumColumns());
+        const auto numOutputRows = (static_cast<int>(input.NumRows()) - filterSize + 1) / stride;
+        const auto numOutputColumns = (static_cast<int>(input.NumColumns()) - filterSize + 1) / stride;
+
+        const auto& shapedInput = workspace.PackInput(input, filterSize, stride);
+        const auto& weightsMatrix = workspace.GetWeightsMatrix(filters);
+        auto& outputMatrix = workspace.GetOutputMatrix(numFilters, numOutputRows * numOutputColumns);
+
+        math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), weightsMatrix, shapedInput, static_cast<ValueType>(0.0), outputMatrix);
+
+        // Re-shape the output into the output tensor
+        for (int i = 0; i < numOutputRows; i++)
+        {
+            for (int j = 0; j < numOutputColumns; j++)
+            {
+                for (int k = 0; k < numFilters; k++)
+                {
+                    int row = k;
+                    int column = (i * numOutputColumns) + j;
+                    output(i, j, k) = outputMatrix(row, column);
+                }
+            }
+        }
+    }
+
     // Basic entry points
     template math::RowVector<float> Convolve1DUnrolled(const math::RowVector<float>& input, const math::RowVector<float>& filter);
     template math::RowVector<double> Convolve1DUnrolled(const math::RowVector<double>& input, const math::RowVector<double>& filter);
@@ -141,7 +290,16 @@ namespace dsp
     template math::ChannelColumnRowTensor<float> Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride);
     template math::ChannelColumnRowTensor<double> Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride);
 
+    template math::ChannelColumnRowTensor<float> Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, UnrolledConvolutionWorkspace<float>& workspace);
+    template math::ChannelColumnRowTensor<double> Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, UnrolledConvolutionWorkspace<double>& workspace);
+
+    template void Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int stride, UnrolledConvolutionWorkspace<float>& workspace, math::ChannelColumnRowTensorReference<float> output);
+    template void Convolve2DUnrolled(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int stride, UnrolledConvolutionWorkspace<double>& workspace, math::ChannelColumnRowTensorReference<double> output);
+
     template void ReceptiveFieldToColumns(math::ConstChannelColumnRowTensorReference<float> input, int filterSize, int stride, math::RowMatrix<float>& shapedInput);
     template void ReceptiveFieldToColumns(math::ConstChannelColumnRowTensorReference<double> input, int filterSize, int stride, math::RowMatrix<double>& shapedInput);
+
+    template class UnrolledConvolutionWorkspace<float>;
+    template class UnrolledConvolutionWorkspace<double>;
 } // namespace dsp
 } // namespace ell
@@ -15,11 +15,17 @@
 
 #include <utilities/include/Debug.h>
 #include <utilities/include/Exception.h>
+#include <utilities/include/MillisecondTimer.h>
 #include <utilities/include/Unused.h>
 
 #include <array>
 #include <cassert>
 #include <initializer_list>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
 
 //
 // Table of contents for this file:
@@ -1507,22 +1513,72 @@ namespace dsp
     // each tile
     //
 
+    // The block size is a template parameter of FixedWinograd2D, so each supported value costs a
+    // template instantiation --- keep the set of cases here in sync with GetWinogradTilingCandidates().
+    template <typename ValueType, int tileSize, int filterSize>
+    void DispatchWinogradFiltersFirst(const math::ConstChannelColumnRowTensorReference<ValueType>& input,
+                                      const math::ConstChannelColumnRowTensorReference<ValueType>& transformedFilters,
+                                      int numFilters,
+                                      int blockSize,
+                                      math::ChannelColumnRowTensor<ValueType>& output)
+    {
+        switch (blockSize)
+        {
+        case 16:
+            FixedWinograd2D<ValueType, tileSize, filterSize, 16>::Convolve2DWinogradFiltersFirst(input, transformedFilters, numFilters, output);
+            break;
+        case 64:
+            FixedWinograd2D<ValueType, tileSize, filterSize, 64>::Convolve2DWinogradFiltersFirst(input, transformedFilters, numFilters, output);
+            break;
+        case 256:
+            FixedWinograd2D<ValueType, tileSize, filterSize, 256>::Convolve2DWinogradFiltersFirst(input, transformedFilters, numFilters, output);
+            break;
+        default:
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
+        }
+    }
+
+    template <typename ValueType, int tileSize, int filterSize>
+    void DispatchWinogradTilesFirst(const math::ConstChannelColumnRowTensorReference<ValueType>& input,
+                                    const math::ConstChannelColumnRowTensorReference<ValueType>& transformedFilters,
+                                    int numFilters,
+                                    int blockSize,
+                                    math::ChannelColumnRowTensor<ValueType>& transformedInputScratch,
+                                    math::ChannelColumnRowTensor<ValueType>& transformedOutputScratch,
+                                    math::ChannelColumnRowTensor<ValueType>& output)
+    {
+        switch (blockSize)
+        {
+        case 16:
+            FixedWinograd2D<ValueType, tileSize, filterSize, 16>::Convolve2DWinogradTilesFirst(input, transformedFilters, numFilters, transformedInputScratch, transformedOutputScratch, output);
+            break;
+        case 64:
+            FixedWinograd2D<ValueType, tileSize, filterSize, 64>::Convolve2DWinogradTilesFirst(input, transformedFilters, numFilters, transformedInputScratch, transformedOutputScratch, output);
+            break;
+        case 256:
+            FixedWinograd2D<ValueType, tileSize, filterSize, 256>::Convolve2DWinogradTilesFirst(input, transformedFilters, numFilters, transformedInputScratch, transformedOutputScratch, output);
+            break;
+        default:
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
+        }
+    }
+
     template <typename ValueType>
     void Convolve2DWinogradFiltersFirst(const math::ConstChannelColumnRowTensorReference<ValueType>& input,
                                         const math::ConstChannelColumnRowTensorReference<ValueType>& transformedFilters,
                                         int numFilters,
                                         int tileSize,
                                         int filterSize,
+                                        int blockSize,
                                         math::ChannelColumnRowTensor<ValueType>& output)
     {
-        constexpr int blockSize = 64;
         if (tileSize == 2 && filterSize == 3)
         {
-            FixedWinograd2D<ValueType, 2, 3, blockSize>::Convolve2DWinogradFiltersFirst(input, transformedFilters, numFilters, output);
+            DispatchWinogradFiltersFirst<ValueType, 2, 3>(input, transformedFilters, numFilters, blockSize, output);
         }
         else if (tileSize == 4 && filterSize == 3)
         {
-            FixedWinograd2D<ValueType, 4, 3, blockSize>::Convolve2DWinogradFiltersFirst(input, transformedFilters, numFilters, output);
+            DispatchWinogradFiltersFirst<ValueType, 4, 3>(input, transformedFilters, numFilters, blockSize, output);
         }
         else
         {
@@ -1541,18 +1597,18 @@ namespace dsp
                                       int numFilters,
                                       int tileSize,
                                       int filterSize,
+                                      int blockSize,
                                       math::ChannelColumnRowTensor<ValueType>& transformedInputScratch,
                                       math::ChannelColumnRowTensor<ValueType>& transformedOutputScratch,
                                       math::ChannelColumnRowTensor<ValueType>& output)
     {
-        constexpr int blockSize = 64;
         if (tileSize == 2 && filterSize == 3)
         {
-            FixedWinograd2D<ValueType, 2, 3, blockSize>::Convolve2DWinogradTilesFirst(input, transformedFilters, numFilters, transformedInputScratch, transformedOutputScratch, output);
+            DispatchWinogradTilesFirst<ValueType, 2, 3>(input, transformedFilters, numFilters, blockSize, transformedInputScratch, transformedOutputScratch, output);
         }
         else if (tileSize == 4 && filterSize == 3)
         {
-            FixedWinograd2D<ValueType, 4, 3, blockSize>::Convolve2DWinogradTilesFirst(input, transformedFilters, numFilters, transformedInputScratch, transformedOutputScratch, output);
+            DispatchWinogradTilesFirst<ValueType, 4, 3>(input, transformedFilters, numFilters, blockSize, transformedInputScratch, transformedOutputScratch, output);
         }
         else
         {
@@ -1609,9 +1665,27 @@ namespace dsp
         return Convolve2DWinogradPretransformed(input, transformedFilters, numFilters, tileSize, filterSize, order);
     }
 
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DWinograd(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, const WinogradTilingParameters& tilingParameters, WinogradFilterOrder order)
+    {
+        const auto filterSize = static_cast<int>(filters.NumRows()) / numFilters;
+        assert(filterSize == static_cast<int>(filters.NumColumns()) && "Filters must be square");
+
+        auto transformedFilters = GetTransformedFilters(filters, numFilters, tilingParameters.tileSize, order);
+        return Convolve2DWinogradPretransformed(input, transformedFilters, numFilters, tilingParameters, filterSize, order);
+    }
+
     template <typename ValueType>
     math::ChannelColumnRowTensor<ValueType> Convolve2DWinogradPretransformed(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& transformedFilters, int numFilters, int tileSize, int filterSize, WinogradFilterOrder order)
     {
+        return Convolve2DWinogradPretransformed(input, transformedFilters, numFilters, WinogradTilingParameters{ tileSize, 64 }, filterSize, order);
+    }
+
+    template <typename ValueType>
+    math::ChannelColumnRowTensor<ValueType> Convolve2DWinogradPretransformed(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& transformedFilters, int numFilters, const WinogradTilingParameters& tilingParameters, int filterSize, WinogradFilterOrder order)
+    {
+        const auto tileSize = tilingParameters.tileSize;
+        const auto blockSize = tilingParameters.blockSize;
         const auto numOutputRows = static_cast<int>(input.NumRows()) - filterSize + 1;
         const auto numOutputColumns = static_cast<int>(input.NumColumns()) - filterSize + 1;
         const auto numChannels = static_cast<int>(input.NumChannels());
@@ -1621,14 +1695,14 @@ namespace dsp
         {
         case WinogradFilterOrder::filtersFirst:
         {
-            Convolve2DWinogradFiltersFirst(input, transformedFilters, numFilters, tileSize, filterSize, output);
+            Convolve2DWinogradFiltersFirst(input, transformedFilters, numFilters, tileSize, filterSize, blockSize, output);
         }
         break;
         case WinogradFilterOrder::tilesFirst:
         {
             auto transformedInputScratch = AllocateScratchInput<ValueType>(numOutputRows, numOutputColumns, numChannels, tileSize, filterSize, order);
             auto transformedOutputScratch = AllocateScratchOutput<ValueType>(numOutputRows, numOutputColumns, numFilters, tileSize, filterSize, order);
-            Convolve2DWinogradTilesFirst(input, transformedFilters, numFilters, tileSize, filterSize, transformedInputScratch, transformedOutputScratch, output);
+            Convolve2DWinogradTilesFirst(input, transformedFilters, numFilters, tileSize, filterSize, blockSize, transformedInputScratch, transformedOutputScratch, output);
         }
         break;
         default:
@@ -1638,6 +1712,75 @@ namespace dsp
         return output;
     }
 
+    //
+    // Tiling parameter autotuning
+    //
+
+    std::vector<WinogradTilingParameters> GetWinogradTilingCandidates(int filterSize)
+    {
+        if (filterSize != 3)
+        {
+            return {};
+        }
+
+        // Every combination here must have a matching case in the dispatch functions above.
+        return { { 2, 16 }, { 2, 64 }, { 2, 256 }, { 4, 16 }, { 4, 64 }, { 4, 256 } };
+    }
+
+    template <typename ValueType>
+    WinogradTilingParameters AutotuneWinogradTiling(const math::TensorShape& inputShape, int numFilters, int filterSize, WinogradFilterOrder order)
+    {
+        using namespace std::string_literals;
+        using Key = std::tuple<size_t, size_t, size_t, int, int, int>;
+        static std::map<Key, WinogradTilingParameters> cache;
+        static std::mutex cacheMutex;
+
+        Key key{ inputShape.NumRows(), inputShape.NumColumns(), inputShape.NumChannels(), numFilters, filterSize, static_cast<int>(order) };
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            auto cacheEntry = cache.find(key);
+            if (cacheEntry != cache.end())
+            {
+                return cacheEntry->second;
+            }
+        }
+
+        auto candidates = GetWinogradTilingCandidates(filterSize);
+        if (candidates.empty())
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "Winograd autotuning not implemented for filter size "s + std::to_string(filterSize));
+        }
+
+        // Benchmark each candidate on zero-valued data with the requested shape --- only the shape
+        // affects the timing, not the contents.
+        math::ChannelColumnRowTensor<ValueType> input(inputShape.NumRows(), inputShape.NumColumns(), inputShape.NumChannels());
+        math::ChannelColumnRowTensor<ValueType> filters(static_cast<size_t>(numFilters) * filterSize, filterSize, inputShape.NumChannels());
+
+        constexpr int numRuns = 3;
+        auto best = candidates.front();
+        auto bestTime = std::numeric_limits<std::chrono::milliseconds::rep>::max();
+        for (const auto& candidate : candidates)
+        {
+            // One untimed run to warm the caches (and transform the filters) before measuring
+            Convolve2DWinograd(input, filters, numFilters, candidate, order);
+            utilities::MillisecondTimer timer;
+            for (int run = 0; run < numRuns; ++run)
+            {
+                Convolve2DWinograd(input, filters, numFilters, candidate, order);
+            }
+            auto elapsed = timer.Elapsed();
+            if (elapsed < bestTime)
+            {
+                bestTime = elapsed;
+                best = candidate;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cache[key] = best;
+        return best;
+    }
+
     // filters is a numFilters x filterSize x filterSize tensor
     template <typename ValueType>
     math::ChannelColumnRowTensor<ValueType> Convolve2DWinogradDepthwiseSeparable(const math::ConstChannelColumnRowTensorReference<ValueType>& input, const math::ConstChannelColumnRowTensorReference<ValueType>& filters, int numFilters, WinogradFilterOrder order)
@@ -1699,10 +1842,18 @@ namespace dsp
     // Basic tensor-valued 2D entry points
     template math::ChannelColumnRowTensor<float> Convolve2DWinograd(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, WinogradFilterOrder order);
     template math::ChannelColumnRowTensor<float> Convolve2DWinograd(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, int tileSize, WinogradFilterOrder order);
+    template math::ChannelColumnRowTensor<float> Convolve2DWinograd(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, const WinogradTilingParameters& tilingParameters, WinogradFilterOrder order);
     template math::ChannelColumnRowTensor<float> Convolve2DWinogradPretransformed(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& transformedFilters, int numFilters, int tileSize, int filterSize, WinogradFilterOrder order);
+    template math::ChannelColumnRowTensor<float> Convolve2DWinogradPretransformed(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& transformedFilters, int numFilters, const WinogradTilingParameters& tilingParameters, int filterSize, WinogradFilterOrder order);
     template math::ChannelColumnRowTensor<double> Convolve2DWinograd(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, WinogradFilterOrder order);
     template math::ChannelColumnRowTensor<double> Convolve2DWinograd(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, int tileSize, WinogradFilterOrder order);
+    template math::ChannelColumnRowTensor<double> Convolve2DWinograd(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& filters, int numFilters, const WinogradTilingParameters& tilingParameters, WinogradFilterOrder order);
     template math::ChannelColumnRowTensor<double> Convolve2DWinogradPretransformed(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& transformedFilters, int numFilters, int tileSize, int filterSize, WinogradFilterOrder order);
+    template math::ChannelColumnRowTensor<double> Convolve2DWinogradPretransformed(const math::ConstChannelColumnRowTensorReference<double>& input, const math::ConstChannelColumnRowTensorReference<double>& transformedFilters, int numFilters, const WinogradTilingParameters& tilingParameters, int filterSize, WinogradFilterOrder order);
+
+    // Tiling parameter autotuning
+    template WinogradTilingParameters AutotuneWinogradTiling<float>(const math::TensorShape& inputShape, int numFilters, int filterSize, WinogradFilterOrder order);
+    template WinogradTilingParameters AutotuneWinogradTiling<double>(const math::TensorShape& inputShape, int numFilters, int filterSize, WinogradFilterOrder order);
 
     // Depthwise-separable versions
     template math::ChannelColumnRowTensor<float> Convolve2DWinogradDepthwiseSeparable(const math::ConstChannelColumnRowTensorReference<float>& input, const math::ConstChannelColumnRowTensorReference<float>& filters, int numFilters, WinogradFilterOrder order);
@@ -38,6 +38,30 @@ void TestConv2D(ell::dsp::ConvolutionMethodOption algorithm);
 template <typename ValueType>
 void TestConv2DVsSimple(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, ell::dsp::ConvolutionMethodOption algorithm);
 
+// Parameterized Winograd tiling and its autotuner
+template <typename ValueType>
+void TestConv2DWinogradTiling(int numRows, int numColumns, int numChannels, int filterSize, int numFilters);
+
+// Unrolled convolution with a reusable workspace
+template <typename ValueType>
+void TestConv2DUnrolledWorkspace(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride);
+
+// Incremental recomputation of a changed region
+template <typename ValueType>
+void TestConv2DIncremental(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride);
+
+// Multithreaded convolution
+template <typename ValueType>
+void TestConv2DParallelVsSimple(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, int numThreads, ell::dsp::ConvolutionMethodOption algorithm);
+
+// Convolution with a fused bias-and-activation epilogue
+template <typename ValueType>
+void TestConv2DEpilogue(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, ell::dsp::ConvolutionMethodOption algorithm);
+
+// Quantized int8 convolution
+template <typename ValueType>
+void TestConv2DInt8(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride);
+
 // Depthwise-separable 2D (multiple "flat" 2D in parallel)
 template <typename ValueType>
 void TestConv2DSeparable(ell::dsp::ConvolutionMethodOption algorithm);
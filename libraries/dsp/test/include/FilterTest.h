@@ -8,6 +8,10 @@
 
 #pragma once
 
+#include <dsp/include/StreamingConvolver.h>
+
+#include <cstddef>
+
 template <typename ValueType>
 void TestIIRFilter();
 
@@ -16,3 +20,6 @@ void TestIIRFilterMultiSample();
 
 template <typename ValueType>
 void TestIIRFilterImpulse();
+
+template <typename ValueType>
+void TestStreamingConvolver(size_t filterSize, ell::dsp::StreamingConvolutionMethod method);
@@ -9,4 +9,5 @@
 #pragma once
 
 void TestMelFilterBank();
+void TestIncrementalMelFilterBank();
 void TestMelFilterBank2();
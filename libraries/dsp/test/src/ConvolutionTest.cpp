@@ -11,6 +11,10 @@
 #include "DSPTestUtilities.h"
 
 #include <dsp/include/Convolution.h>
+#include <dsp/include/Int8Convolution.h>
+#include <dsp/include/SimpleConvolution.h>
+#include <dsp/include/UnrolledConvolution.h>
+#include <dsp/include/WinogradConvolution.h>
 
 #include <math/include/MathConstants.h>
 #include <math/include/Tensor.h>
@@ -22,6 +26,7 @@
 
 #include <utilities/include/MillisecondTimer.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iostream>
@@ -252,6 +257,228 @@ void TestConv2DVsSimple(int numRows, int numColumns, int numChannels, int filter
     }
 }
 
+template <typename ValueType>
+void TestConv2DWinogradTiling(int numRows, int numColumns, int numChannels, int filterSize, int numFilters)
+{
+    using Tensor = math::ChannelColumnRowTensor<ValueType>;
+
+    Tensor signal(numRows, numColumns, numChannels);
+    Tensor filters(numFilters * filterSize, filterSize, numChannels);
+
+    FillInputTensor(signal);
+    FillFiltersTensor(filters, numFilters);
+
+    auto reference = Convolve2D(signal, filters, numFilters, 1, dsp::ConvolutionMethodOption::simple);
+
+    // The tile size 4 transform matrices have larger entries than the tile size 2 ones, so allow
+    // a little more rounding error than the other convolution tests
+    const auto tilingEpsilon = static_cast<ValueType>(1e-4);
+
+    // Every candidate tiling must produce the same result as simple convolution
+    auto candidates = dsp::GetWinogradTilingCandidates(filterSize);
+    testing::ProcessTest("Testing Winograd tiling candidates exist", !candidates.empty());
+    for (const auto& candidate : candidates)
+    {
+        auto result = Convolve2DWinograd(signal, filters, numFilters, candidate, dsp::WinogradFilterOrder::tilesFirst);
+        bool ok = testing::ProcessTest("Testing Winograd convolution with tiling parameters", reference.IsEqual(result, tilingEpsilon));
+        if (!ok)
+        {
+            std::cout << "Incorrect result for Winograd convolution with tile size " << candidate.tileSize
+                      << ", block size " << candidate.blockSize << " on input of size " << signal.NumRows() << " x " << signal.NumColumns() << " x " << signal.NumChannels() << std::endl;
+        }
+    }
+
+    // The autotuner returns one of the supported candidates, and returns the same answer from its cache
+    math::TensorShape inputShape{ signal.NumRows(), signal.NumColumns(), signal.NumChannels() };
+    auto tuned = dsp::AutotuneWinogradTiling<ValueType>(inputShape, numFilters, filterSize);
+    bool supported = false;
+    for (const auto& candidate : candidates)
+    {
+        supported = supported || (candidate.tileSize == tuned.tileSize && candidate.blockSize == tuned.blockSize);
+    }
+    testing::ProcessTest("Testing Winograd autotuner returns a supported candidate", supported);
+
+    auto cached = dsp::AutotuneWinogradTiling<ValueType>(inputShape, numFilters, filterSize);
+    testing::ProcessTest("Testing Winograd autotuner cache", cached.tileSize == tuned.tileSize && cached.blockSize == tuned.blockSize);
+}
+
+template <typename ValueType>
+void TestConv2DUnrolledWorkspace(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride)
+{
+    using Tensor = math::ChannelColumnRowTensor<ValueType>;
+
+    Tensor signal(numRows, numColumns, numChannels);
+    Tensor filters(numFilters * filterSize, filterSize, numChannels);
+
+    FillInputTensor(signal);
+    FillFiltersTensor(filters, numFilters);
+
+    dsp::UnrolledConvolutionWorkspace<ValueType> workspace;
+
+    // First call packs from scratch
+    auto reference = Convolve2D(signal, filters, numFilters, stride, dsp::ConvolutionMethodOption::simple);
+    auto result = Convolve2DUnrolled(signal, filters, numFilters, stride, workspace);
+    testing::ProcessTest("Testing unrolled convolution with workspace", reference.IsEqual(result, static_cast<ValueType>(epsilon)));
+
+    // Modify a few input rows and convolve again --- the incremental repack must pick up the changes
+    for (int columnIndex = 0; columnIndex < numColumns; ++columnIndex)
+    {
+        for (int channelIndex = 0; channelIndex < numChannels; ++channelIndex)
+        {
+            signal(0, columnIndex, channelIndex) += static_cast<ValueType>(1);
+            signal(numRows / 2, columnIndex, channelIndex) -= static_cast<ValueType>(1);
+        }
+    }
+    reference = Convolve2D(signal, filters, numFilters, stride, dsp::ConvolutionMethodOption::simple);
+    result = Convolve2DUnrolled(signal, filters, numFilters, stride, workspace);
+    testing::ProcessTest("Testing unrolled convolution workspace incremental repack", reference.IsEqual(result, static_cast<ValueType>(epsilon)));
+
+    // A reset workspace gives the same answer
+    workspace.Reset();
+    result = Convolve2DUnrolled(signal, filters, numFilters, stride, workspace);
+    testing::ProcessTest("Testing unrolled convolution workspace reset", reference.IsEqual(result, static_cast<ValueType>(epsilon)));
+}
+
+template <typename ValueType>
+void TestConv2DIncremental(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride)
+{
+    using Tensor = math::ChannelColumnRowTensor<ValueType>;
+
+    Tensor signal(numRows, numColumns, numChannels);
+    Tensor filters(numFilters * filterSize, filterSize, numChannels);
+
+    FillInputTensor(signal);
+    FillFiltersTensor(filters, numFilters);
+
+    // "Keyframe": compute the full output
+    auto result = Convolve2D(signal, filters, numFilters, stride, dsp::ConvolutionMethodOption::simple);
+
+    // Change a small interior patch of the input
+    dsp::ConvolutionRegion dirty{ numRows / 3, 2, numColumns / 3, 3 };
+    for (int rowIndex = dirty.rowStart; rowIndex < dirty.rowStart + dirty.numRows; ++rowIndex)
+    {
+        for (int columnIndex = dirty.columnStart; columnIndex < dirty.columnStart + dirty.numColumns; ++columnIndex)
+        {
+            for (int channelIndex = 0; channelIndex < numChannels; ++channelIndex)
+            {
+                signal(rowIndex, columnIndex, channelIndex) += static_cast<ValueType>(1);
+            }
+        }
+    }
+    auto reference = Convolve2D(signal, filters, numFilters, stride, dsp::ConvolutionMethodOption::simple);
+
+    // Recomputing just the affected output elements in place must match a full recompute
+    auto affected = dsp::GetAffectedOutputRegion(dirty, filterSize, filterSize, stride, static_cast<int>(result.NumRows()), static_cast<int>(result.NumColumns()));
+    testing::ProcessTest("Testing affected output region is a proper subset", affected.numRows > 0 && affected.numRows < static_cast<int>(result.NumRows()) && affected.numColumns > 0 && affected.numColumns < static_cast<int>(result.NumColumns()));
+    Convolve2DSimple(signal, filters, numFilters, stride, affected, result);
+    testing::ProcessTest("Testing incremental convolution result", reference.IsEqual(result, static_cast<ValueType>(epsilon)));
+
+    // The receptive field of the affected outputs covers the dirty input patch
+    auto halo = dsp::GetReceptiveField(affected, filterSize, filterSize, stride);
+    bool covered = halo.rowStart <= dirty.rowStart && halo.rowStart + halo.numRows >= dirty.rowStart + dirty.numRows && halo.columnStart <= dirty.columnStart && halo.columnStart + halo.numColumns >= dirty.columnStart + dirty.numColumns;
+    testing::ProcessTest("Testing receptive field covers the dirty region", covered);
+}
+
+template <typename ValueType>
+void TestConv2DParallelVsSimple(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, int numThreads, dsp::ConvolutionMethodOption algorithm)
+{
+    using Tensor = math::ChannelColumnRowTensor<ValueType>;
+
+    Tensor signal(numRows, numColumns, numChannels);
+    Tensor filters(numFilters * filterSize, filterSize, numChannels);
+
+    FillInputTensor(signal);
+    FillFiltersTensor(filters, numFilters);
+
+    auto reference = Convolve2D(signal, filters, numFilters, stride, dsp::ConvolutionMethodOption::simple);
+    auto result = Convolve2DParallel(signal, filters, numFilters, stride, numThreads, algorithm);
+
+    bool ok = testing::ProcessTest("Testing parallel convolution result", reference.IsEqual(result, static_cast<ValueType>(epsilon)));
+    if (!ok)
+    {
+        std::cout << "Incorrect result for parallel " << GetConvAlgName(algorithm) << " convolution with " << numThreads
+                  << " threads on input of size " << signal.NumRows() << " x " << signal.NumColumns() << " x " << signal.NumChannels() << std::endl;
+    }
+}
+
+template <typename ValueType>
+void TestConv2DEpilogue(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, dsp::ConvolutionMethodOption algorithm)
+{
+    using Tensor = math::ChannelColumnRowTensor<ValueType>;
+
+    Tensor signal(numRows, numColumns, numChannels);
+    Tensor filters(numFilters * filterSize, filterSize, numChannels);
+
+    FillInputTensor(signal);
+    FillFiltersTensor(filters, numFilters);
+
+    dsp::ConvolutionEpilogue<ValueType> epilogue;
+    epilogue.bias.resize(numFilters);
+    for (int filterIndex = 0; filterIndex < numFilters; ++filterIndex)
+    {
+        epilogue.bias[filterIndex] = static_cast<ValueType>(0.5 * (filterIndex % 5) - 1.0);
+    }
+
+    // Compute the unfused reference: convolve, then bias, then activation as separate passes
+    auto reference = Convolve2D(signal, filters, numFilters, stride, dsp::ConvolutionMethodOption::simple);
+    for (size_t rowIndex = 0; rowIndex < reference.NumRows(); ++rowIndex)
+    {
+        for (size_t columnIndex = 0; columnIndex < reference.NumColumns(); ++columnIndex)
+        {
+            for (size_t channelIndex = 0; channelIndex < reference.NumChannels(); ++channelIndex)
+            {
+                auto value = reference(rowIndex, columnIndex, channelIndex) + epilogue.bias[channelIndex];
+                reference(rowIndex, columnIndex, channelIndex) = value > 0 ? value : epilogue.leakyReluLeakage * value;
+            }
+        }
+    }
+
+    epilogue.activation = dsp::EpilogueActivation::leakyRelu;
+    auto result = Convolve2D(signal, filters, numFilters, stride, epilogue, algorithm);
+
+    bool ok = testing::ProcessTest("Testing fused convolution epilogue", reference.IsEqual(result, static_cast<ValueType>(epsilon)));
+    if (!ok)
+    {
+        std::cout << "Incorrect result for fused " << GetConvAlgName(algorithm) << " convolution epilogue on input of size "
+                  << signal.NumRows() << " x " << signal.NumColumns() << " x " << signal.NumChannels() << std::endl;
+    }
+}
+
+template <typename ValueType>
+void TestConv2DInt8(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride)
+{
+    using Tensor = math::ChannelColumnRowTensor<ValueType>;
+
+    Tensor signal(numRows, numColumns, numChannels);
+    Tensor filters(numFilters * filterSize, filterSize, numChannels);
+
+    FillInputTensor(signal);
+    FillFiltersTensor(filters, numFilters);
+
+    auto reference = Convolve2D(signal, filters, numFilters, stride, dsp::ConvolutionMethodOption::simple);
+
+    auto quantizedFilters = dsp::QuantizeFiltersInt8(filters, numFilters);
+    auto quantizedSignal = dsp::QuantizeTensorInt8(signal);
+    auto result = Convolve2DInt8(quantizedSignal, quantizedFilters, numFilters, stride);
+
+    // Each of the (filterSize * filterSize * numChannels) products can be off by about half a
+    // quantization step in each operand, so bound the error by the accumulation length times the
+    // per-product error.
+    auto maxFilterScale = *std::max_element(quantizedFilters.scales.begin(), quantizedFilters.scales.end());
+    auto tolerance = filterSize * filterSize * numChannels * (quantizedSignal.scale + maxFilterScale);
+
+    bool ok = testing::ProcessTest("Testing int8 convolution result", reference.IsEqual(result, static_cast<ValueType>(tolerance)));
+    if (!ok)
+    {
+        std::cout << "Incorrect result for int8 convolution on input of size "
+                  << signal.NumRows() << " x " << signal.NumColumns() << " x " << signal.NumChannels() << std::endl;
+    }
+
+    // The convenience overload quantizes the signal itself and must give the same answer
+    auto result2 = Convolve2DInt8(signal.GetConstReference(), quantizedFilters, numFilters, stride);
+    testing::ProcessTest("Testing int8 convolution signal quantization", result2.IsEqual(result, static_cast<ValueType>(epsilon)));
+}
+
 // Depthwise-separable
 template <typename ValueType>
 void TestConv2DSeparableVsSimple(int numRows, int numColumns, int numChannels, int filterSize, int stride, dsp::ConvolutionMethodOption algorithm)
@@ -329,6 +556,18 @@ template void TestConv2D<float>(dsp::ConvolutionMethodOption);
 template void TestConv2D<double>(dsp::ConvolutionMethodOption);
 template void TestConv2DVsSimple<float>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, dsp::ConvolutionMethodOption algorithm);
 template void TestConv2DVsSimple<double>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, dsp::ConvolutionMethodOption algorithm);
+template void TestConv2DWinogradTiling<float>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters);
+template void TestConv2DWinogradTiling<double>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters);
+template void TestConv2DUnrolledWorkspace<float>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride);
+template void TestConv2DUnrolledWorkspace<double>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride);
+template void TestConv2DIncremental<float>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride);
+template void TestConv2DIncremental<double>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride);
+template void TestConv2DParallelVsSimple<float>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, int numThreads, dsp::ConvolutionMethodOption algorithm);
+template void TestConv2DParallelVsSimple<double>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, int numThreads, dsp::ConvolutionMethodOption algorithm);
+template void TestConv2DEpilogue<float>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, dsp::ConvolutionMethodOption algorithm);
+template void TestConv2DEpilogue<double>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride, dsp::ConvolutionMethodOption algorithm);
+template void TestConv2DInt8<float>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride);
+template void TestConv2DInt8<double>(int numRows, int numColumns, int numChannels, int filterSize, int numFilters, int stride);
 
 // Depthwise-separable (i.e., multiple 2D in parallel)
 template void TestConv2DSeparable<float>(dsp::ConvolutionMethodOption);
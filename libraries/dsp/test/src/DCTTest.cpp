@@ -15,6 +15,7 @@
 
 #include <testing/include/testing.h>
 
+#include <cmath>
 #include <iostream>
 #include <type_traits>
 #include <vector>
@@ -82,6 +83,34 @@ void TestDCTMatrix(const std::vector<std::vector<double>>& refMatrixValues, bool
     }
 }
 
+void TestDCTPlan(size_t numFilters, size_t windowSize)
+{
+    const float epsilon = 1e-4f;
+
+    math::ColumnVector<float> signal(windowSize);
+    for (size_t n = 0; n < windowSize; ++n)
+    {
+        signal[n] = static_cast<float>(std::sin(0.2 * n) + 0.5 * std::cos(0.05 * n));
+    }
+
+    DCTPlan<float> plan(numFilters, windowSize);
+    auto result = plan.Transform(signal);
+
+    // Compare against a direct evaluation of the basis
+    auto dctMatrix = GetDCTMatrix<float>(windowSize, numFilters);
+    math::ColumnVector<float> reference(numFilters);
+    for (size_t k = 0; k < numFilters; ++k)
+    {
+        float sum = 0;
+        for (size_t n = 0; n < windowSize; ++n)
+        {
+            sum += dctMatrix(k, n) * signal[n];
+        }
+        reference[k] = sum;
+    }
+    testing::ProcessTest("Testing DCT plan", reference.IsEqual(result, epsilon));
+}
+
 void TestDCT()
 {
     TestDCTMatrix(dct_precomputed);
@@ -96,6 +125,11 @@ void TestDCT()
     TestDCTMatrix(GetDCTReference_II_norm_64(), true);
     TestDCTMatrix(GetDCTReference_II_norm_128(), true);
 
+    // cached-plan DCT (the small MFCC case and a size beyond the fast-path threshold)
+    TestDCTPlan(13, 64);
+    TestDCTPlan(40, 512);
+    TestDCTPlan(128, 128);
+
     // test vs. librosa (DCT-III)
     // Disabling these tests for now --- librosa computes the DCT-III, and we compute DCT-II.
     // Once we add normalization and inverse, we will be able to generate DCT-III matrices to test against.
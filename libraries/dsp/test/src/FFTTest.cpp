@@ -28,7 +28,9 @@ using namespace dsp;
 template <typename ValueType>
 void TestFFT(size_t N)
 {
-    const ValueType epsilon = static_cast<ValueType>(1e-6);
+    // The real-valued path runs a packed half-length transform, so its rounding differs from
+    // the complex path by a margin that grows with the transform length.
+    const ValueType epsilon = static_cast<ValueType>(1e-7 * N);
     math::RowVector<ValueType> signal(N);
     std::vector<std::complex<ValueType>> complexSignal(N, 1.0);
 
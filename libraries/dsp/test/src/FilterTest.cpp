@@ -6,10 +6,15 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <dsp/include/Convolution.h>
 #include <dsp/include/IIRFilter.h>
+#include <dsp/include/StreamingConvolver.h>
+
+#include <math/include/Vector.h>
 
 #include <testing/include/testing.h>
 
+#include <cmath>
 #include <iostream>
 #include <vector>
 
@@ -57,6 +62,62 @@ void TestIIRFilterImpulse()
     testing::ProcessTest("Testing FIR filtering of impulse signal", testing::IsEqual(y, bCoeffs, epsilon));
 }
 
+template <typename ValueType>
+void TestStreamingConvolver(size_t filterSize, StreamingConvolutionMethod method)
+{
+    const ValueType epsilon = static_cast<ValueType>(1e-4);
+    const size_t signalSize = 250;
+
+    math::RowVector<ValueType> signal(signalSize);
+    math::RowVector<ValueType> filter(filterSize);
+    for (size_t index = 0; index < signalSize; ++index)
+    {
+        signal[index] = std::sin(static_cast<ValueType>(index) * static_cast<ValueType>(0.3));
+    }
+    for (size_t index = 0; index < filterSize; ++index)
+    {
+        filter[index] = std::cos(static_cast<ValueType>(index) * static_cast<ValueType>(0.7));
+    }
+    auto reference = Convolve1D(signal, filter, ConvolutionMethodOption::simple);
+
+    // feed the signal in uneven hops and collect whatever outputs become available
+    StreamingConvolver<ValueType> convolver(filter.ToArray(), method);
+    std::vector<ValueType> result;
+    size_t position = 0;
+    size_t hop = 1;
+    while (position < signalSize)
+    {
+        auto chunkSize = std::min(hop, signalSize - position);
+        auto chunk = std::vector<ValueType>(signal.GetConstDataPointer() + position, signal.GetConstDataPointer() + position + chunkSize);
+        auto emitted = convolver.FilterSamples(chunk);
+        result.insert(result.end(), emitted.begin(), emitted.end());
+        position += chunkSize;
+        hop = hop % 13 + 1;
+    }
+
+    // the overlap-save method holds back a partial block at the end of the stream
+    bool success = result.size() <= reference.Size();
+    for (size_t index = 0; index < result.size(); ++index)
+    {
+        success = success && testing::IsEqual(result[index], reference[index], epsilon);
+    }
+    if (method == StreamingConvolutionMethod::direct)
+    {
+        success = success && result.size() == reference.Size();
+    }
+    testing::ProcessTest("Testing streaming convolver vs Convolve1D", success);
+
+    // resetting and replaying the stream reproduces the same outputs
+    convolver.Reset();
+    auto replayed = convolver.FilterSamples(signal.ToArray());
+    success = replayed.size() == result.size();
+    for (size_t index = 0; index < replayed.size(); ++index)
+    {
+        success = success && testing::IsEqual(replayed[index], result[index], epsilon);
+    }
+    testing::ProcessTest("Testing streaming convolver reset", success);
+}
+
 //
 // Explicit instantiations
 //
@@ -68,3 +129,6 @@ template void TestIIRFilterMultiSample<double>();
 
 template void TestIIRFilterImpulse<float>();
 template void TestIIRFilterImpulse<double>();
+
+template void TestStreamingConvolver<float>(size_t, StreamingConvolutionMethod);
+template void TestStreamingConvolver<double>(size_t, StreamingConvolutionMethod);
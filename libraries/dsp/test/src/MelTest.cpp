@@ -14,6 +14,7 @@
 
 #include <testing/include/testing.h>
 
+#include <cmath>
 #include <iostream>
 #include <vector>
 
@@ -55,6 +56,45 @@ void TestMelFilterBank()
     VerifyMelFilterBank(sampleRate, fftSize, windowSize, numFilters, GetReferenceCepstrumCoefficients());
 }
 
+void TestIncrementalMelFilterBank()
+{
+    using namespace std::string_literals;
+    const double epsilon = 1e-6;
+
+    const size_t numFilters = 40;
+    const size_t windowSize = 512;
+    const size_t fftSize = 512;
+    const double sampleRate = 16000;
+    const size_t numFrames = 5;
+
+    auto m = MelFilterBank(windowSize, sampleRate, fftSize, numFilters);
+    IncrementalFilterBankEvaluator<double> evaluator(m);
+
+    // Feed a series of frames where only some of the bins change, the way overlapping
+    // analysis windows behave, and compare against a full evaluation of each frame
+    std::vector<double> magnitudes(windowSize / 2);
+    for (size_t k = 0; k < magnitudes.size(); ++k)
+    {
+        magnitudes[k] = std::sin(0.1 * k) + 1.5;
+    }
+    for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+    {
+        for (size_t k = frameIndex; k < magnitudes.size(); k += 7)
+        {
+            magnitudes[k] = std::cos(0.3 * k + frameIndex) + 1.5;
+        }
+        auto reference = m.FilterFrequencyMagnitudes(magnitudes);
+        auto result = evaluator.FilterFrequencyMagnitudes(magnitudes);
+        testing::ProcessTest("Testing incremental Mel filter bank frame "s + std::to_string(frameIndex), testing::IsEqual(result, reference, epsilon));
+    }
+
+    // A reset evaluator gives the same answer as a full evaluation
+    evaluator.Reset();
+    auto reference = m.FilterFrequencyMagnitudes(magnitudes);
+    auto result = evaluator.FilterFrequencyMagnitudes(magnitudes);
+    testing::ProcessTest("Testing incremental Mel filter bank reset", testing::IsEqual(result, reference, epsilon));
+}
+
 void TestMelFilterBank2()
 {
     VerifyMelFilterBank(16000, 512, 512, 128, GetMelReference_16000_512_128());
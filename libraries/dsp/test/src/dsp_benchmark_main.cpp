@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     dsp_benchmark_main.cpp (dsp)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DSPTestUtilities.h"
+
+#include <dsp/include/Convolution.h>
+#include <dsp/include/FFT.h>
+#include <dsp/include/FilterBank.h>
+
+#include <math/include/Tensor.h>
+#include <math/include/Vector.h>
+
+#include <utilities/include/MillisecondTimer.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ell;
+
+// Each benchmark prints one JSON object per line, so the output can be collected per commit:
+// {"benchmark": "...", "iterations": N, "time_ms": <per iteration>, "gflops": X} (or "gb_per_sec" for
+// bandwidth-bound cases)
+
+namespace
+{
+template <typename Function>
+double TimeBenchmark(Function function, size_t repetitions)
+{
+    // warm up
+    function();
+    function();
+
+    utilities::MillisecondTimer timer;
+    for (size_t t = 0; t < repetitions; ++t)
+    {
+        function();
+    }
+    return timer.Elapsed();
+}
+
+void ReportBenchmark(const std::string& name, size_t repetitions, double totalMilliseconds, double flopsPerIteration, double bytesPerIteration)
+{
+    auto seconds = totalMilliseconds / 1000.0;
+    std::cout << "{\"benchmark\": \"" << name << "\", \"iterations\": " << repetitions << ", \"time_ms\": " << totalMilliseconds / repetitions;
+    if (flopsPerIteration > 0 && seconds > 0)
+    {
+        std::cout << ", \"gflops\": " << (flopsPerIteration * repetitions) / seconds / 1.0e9;
+    }
+    if (bytesPerIteration > 0 && seconds > 0)
+    {
+        std::cout << ", \"gb_per_sec\": " << (bytesPerIteration * repetitions) / seconds / 1.0e9;
+    }
+    std::cout << "}" << std::endl;
+}
+} // namespace
+
+template <typename ValueType>
+void BenchmarkConv2D(size_t numRows, size_t numColumns, size_t numChannels, size_t filterSize, size_t numFilters, size_t repetitions, dsp::ConvolutionMethodOption algorithm)
+{
+    math::ChannelColumnRowTensor<ValueType> signal(numRows, numColumns, numChannels);
+    math::ChannelColumnRowTensor<ValueType> filters(numFilters * filterSize, filterSize, numChannels);
+    signal.Fill(static_cast<ValueType>(0.5));
+    filters.Fill(static_cast<ValueType>(0.25));
+
+    auto time = TimeBenchmark([&]() {
+        volatile auto result = Convolve2D(signal, filters, static_cast<int>(numFilters), algorithm);
+    },
+                              repetitions);
+
+    auto outputRows = numRows - filterSize + 1;
+    auto outputColumns = numColumns - filterSize + 1;
+    double flops = 2.0 * outputRows * outputColumns * numFilters * filterSize * filterSize * numChannels;
+    std::string name = "Convolve2D<float>[" + std::to_string(numRows) + "x" + std::to_string(numColumns) + "x" + std::to_string(numChannels) + ", " + std::to_string(filterSize) + "x" + std::to_string(filterSize) + "x" + std::to_string(numFilters) + ", " + GetConvAlgName(algorithm) + "]";
+    ReportBenchmark(name, repetitions, time, flops, 0);
+}
+
+template <typename ValueType>
+void BenchmarkFFT(size_t size, size_t repetitions)
+{
+    std::vector<ValueType> source(size);
+    for (size_t index = 0; index < size; ++index)
+    {
+        source[index] = std::sin(0.1 * index);
+    }
+
+    std::vector<ValueType> buffer(size);
+    auto time = TimeBenchmark([&]() {
+        buffer = source; // refresh the input; repeated in-place FFTs would overflow
+        dsp::FFT(buffer);
+    },
+                              repetitions);
+
+    // the usual operation-count estimate for a radix-2 real FFT
+    double flops = 5.0 * size * std::log2(static_cast<double>(size));
+    ReportBenchmark("FFT<float>[" + std::to_string(size) + "]", repetitions, time, flops, 0);
+}
+
+void BenchmarkMelFilterBank(size_t windowSize, size_t numFilters, size_t repetitions)
+{
+    const double sampleRate = 16000;
+    auto filterBank = dsp::MelFilterBank(windowSize, sampleRate, windowSize, numFilters);
+
+    std::vector<float> magnitudes(windowSize / 2);
+    for (size_t index = 0; index < magnitudes.size(); ++index)
+    {
+        magnitudes[index] = static_cast<float>(std::sin(0.1 * index) + 1.5);
+    }
+
+    auto time = TimeBenchmark([&]() {
+        volatile auto result = filterBank.FilterFrequencyMagnitudes(magnitudes).size();
+    },
+                              repetitions);
+
+    double bytes = (magnitudes.size() + numFilters) * sizeof(float);
+    ReportBenchmark("MelFilterBank<float>[" + std::to_string(windowSize) + ", " + std::to_string(numFilters) + " filters]", repetitions, time, 0, bytes);
+}
+
+int main(int argc, char* argv[])
+{
+    // an optional argument scales the repetition counts, for slower or faster machines
+    size_t repetitionScale = 1;
+    if (argc > 1)
+    {
+        repetitionScale = static_cast<size_t>(atoi(argv[1]));
+        if (repetitionScale < 1)
+        {
+            repetitionScale = 1;
+        }
+    }
+
+    // 2D convolution, across the available algorithms, at a small and a large shape
+    for (auto algorithm : { dsp::ConvolutionMethodOption::simple, dsp::ConvolutionMethodOption::unrolled, dsp::ConvolutionMethodOption::winograd })
+    {
+        BenchmarkConv2D<float>(34, 34, 8, 3, 8, 100 * repetitionScale, algorithm);
+        BenchmarkConv2D<float>(66, 66, 32, 3, 32, 10 * repetitionScale, algorithm);
+        BenchmarkConv2D<float>(130, 130, 64, 3, 64, repetitionScale, algorithm);
+    }
+
+    // FFT, over a sweep of power-of-two sizes
+    for (size_t size = 64; size <= 8192; size *= 4)
+    {
+        BenchmarkFFT<float>(size, 1000 * repetitionScale);
+    }
+
+    // Mel filter banks, over typical window and filter-count shapes
+    BenchmarkMelFilterBank(256, 13, 100000 * repetitionScale);
+    BenchmarkMelFilterBank(512, 40, 100000 * repetitionScale);
+    BenchmarkMelFilterBank(1024, 80, 100000 * repetitionScale);
+
+    return 0;
+}
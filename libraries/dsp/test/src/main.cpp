@@ -70,6 +70,14 @@ void DspTest(const std::string& path)
     TestConv2DVsSimple<float>(121, 81, 8, 3, 16, 2, ConvolutionMethodOption::unrolled);
     TestConv2DVsSimple<float>(60, 40, 64, 3, 128, 2, ConvolutionMethodOption::unrolled);
 
+    // Unrolled, with a reusable workspace
+    TestConv2DUnrolledWorkspace<float>(31, 23, 8, 3, 16, 1);
+    TestConv2DUnrolledWorkspace<float>(31, 23, 8, 3, 16, 2);
+
+    // Incremental recomputation of a changed region
+    TestConv2DIncremental<float>(31, 23, 8, 3, 16, 1);
+    TestConv2DIncremental<float>(31, 23, 8, 3, 16, 2);
+
     // Winograd
     TestConv2D<float>(ConvolutionMethodOption::winograd);
     TestConv2DVsSimple<float>(4, 4, 1, 3, 1, 1, ConvolutionMethodOption::winograd);
@@ -82,6 +90,23 @@ void DspTest(const std::string& path)
     TestConv2DVsSimple<float>(60, 40, 64, 3, 128, 1, ConvolutionMethodOption::winograd);
     TestConv2DVsSimple<float>(129, 129, 128, 3, 128, 1, ConvolutionMethodOption::winograd);
 
+    // Winograd tiling parameters and autotuner
+    TestConv2DWinogradTiling<float>(31, 23, 8, 3, 16);
+
+    // Parallel dispatch
+    TestConv2DParallelVsSimple<float>(31, 23, 8, 3, 16, 1, 4, ConvolutionMethodOption::simple);
+    TestConv2DParallelVsSimple<float>(31, 23, 8, 3, 16, 2, 4, ConvolutionMethodOption::unrolled);
+    TestConv2DParallelVsSimple<float>(31, 23, 8, 3, 16, 1, 3, ConvolutionMethodOption::winograd);
+    TestConv2DParallelVsSimple<float>(31, 23, 8, 3, 16, 1, 0, ConvolutionMethodOption::simple);
+
+    // Fused bias-and-activation epilogue
+    TestConv2DEpilogue<float>(31, 23, 8, 3, 16, 1, ConvolutionMethodOption::simple);
+    TestConv2DEpilogue<float>(31, 23, 8, 3, 16, 1, ConvolutionMethodOption::winograd);
+
+    // Quantized int8 convolution
+    TestConv2DInt8<float>(31, 23, 8, 3, 16, 1);
+    TestConv2DInt8<float>(31, 23, 8, 3, 16, 2);
+
     // Depthwise-separable 2D convolution
     // Winograd
     TestConv2DSeparable<float>(ConvolutionMethodOption::winograd);
@@ -105,6 +130,10 @@ void DspTest(const std::string& path)
     TestIIRFilter<float>();
     TestIIRFilterMultiSample<float>();
     TestIIRFilterImpulse<float>();
+    TestStreamingConvolver<float>(5, StreamingConvolutionMethod::direct);
+    TestStreamingConvolver<float>(40, StreamingConvolutionMethod::overlapSave);
+    TestStreamingConvolver<double>(5, StreamingConvolutionMethod::overlapSave);
+    TestStreamingConvolver<double>(40, StreamingConvolutionMethod::automatic);
 
     // Window functions
     TestHammingWindow<float>();
@@ -116,6 +145,7 @@ void DspTest(const std::string& path)
 
     // Mel filterbank
     TestMelFilterBank();
+    TestIncrementalMelFilterBank();
     // TestMelFilterBank2(); // Commented out because our implementation rounds filter centers to integer locations, and the reference (librosa) doesn't
 
     // DCT
@@ -19,5 +19,11 @@ namespace emittable_functions
 
     void SimpleDepthwiseSeparableConvolve2D(value::Tensor signal, value::Tensor filter, value::Scalar rowStride,
                                             value::Scalar columnStride, value::Tensor output);
+
+    // Specialization for strides known at emit time: index math is folded and the filter
+    // loop is unrolled. The Scalar-stride overload dispatches here automatically when its
+    // stride arguments are emit-time constants.
+    void SimpleDepthwiseSeparableConvolve2D(value::Tensor signal, value::Tensor filter, int rowStride,
+                                            int columnStride, value::Tensor output);
 } // namespace emittable_functions
 } // namespace ell
@@ -37,6 +37,15 @@ namespace emittable_functions
                                             Scalar columnStride,
                                             Tensor output)
     {
+        // The tensor extents are always emit-time constants (they come from the layouts), so
+        // the strides are the only thing keeping this generic. If the caller passed constants,
+        // hand off to the specialized version instead of emitting runtime index math
+        if (rowStride.GetValue().IsConstant() && columnStride.GetValue().IsConstant())
+        {
+            SimpleDepthwiseSeparableConvolve2D(signal, filter, rowStride.Get<int>(), columnStride.Get<int>(), output);
+            return;
+        }
+
         // Change to For once we have emittable For for 0 to Value
         ForRange(static_cast<int>(signal.Channels()), [&](auto depth) {
             auto slicedInputMatrix = signal.Slice(Slice::All, Slice::All, depth);
@@ -61,5 +70,41 @@ namespace emittable_functions
             });
         });
     }
+
+    // Constant-stride specialization: with the strides bound at emit time the input index
+    // computation constant-folds (and disappears entirely for unit strides), and the filter
+    // row loop -- whose extent is a small emit-time constant -- is unrolled into
+    // straight-line dot products
+    void SimpleDepthwiseSeparableConvolve2D(Tensor signal,
+                                            Tensor filter,
+                                            int rowStride,
+                                            int columnStride,
+                                            Tensor output)
+    {
+        const int filterRows = static_cast<int>(filter.Rows());
+        ForRange(static_cast<int>(signal.Channels()), [&](auto depth) {
+            auto slicedInputMatrix = signal.Slice(Slice::All, Slice::All, depth);
+            auto slicedOutputMatrix = output.Slice(Slice::All, Slice::All, depth);
+            auto slicedFilterMatrix = filter.Slice(Slice::All, Slice::All, depth);
+
+            ForRange(static_cast<int>(output.Rows()), [&](auto outRow) {
+                ForRange(static_cast<int>(output.Columns()), [&](auto outColumn) {
+                    const auto inputRow = rowStride == 1 ? outRow : outRow * rowStride;
+                    const auto inputColumn = columnStride == 1 ? outColumn : outColumn * columnStride;
+
+                    // Set the initial value to 0
+                    slicedOutputMatrix(outRow, outColumn) = Cast(0, output.Type());
+                    // Accumulate along values
+                    for (int filterRow = 0; filterRow < filterRows; ++filterRow)
+                    {
+                        auto filterVec = slicedFilterMatrix.Row(filterRow);
+                        auto inputVec = slicedInputMatrix.Row(inputRow + filterRow).SubVector(inputColumn, filter.Columns());
+
+                        slicedOutputMatrix(outRow, outColumn) += Dot(inputVec, filterVec);
+                    }
+                });
+            });
+        });
+    }
 } // namespace emittable_functions
 } // namespace ell
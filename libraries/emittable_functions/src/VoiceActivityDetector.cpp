@@ -21,6 +21,38 @@ namespace ell
 {
 namespace emittable_functions
 {
+    namespace
+    {
+        // Weighted sum of the window, written as four independent partial sums over a strided loop
+        // so the LLVM vectorizer can keep the accumulators in vector lanes (e.g. NEON on Cortex-A53)
+        Scalar WeightedEnergy(Vector data, Vector weights)
+        {
+            auto dataType = data.GetType();
+            constexpr int blockSize = 4;
+            int size = static_cast<int>(data.Size());
+            int numFullBlocks = size / blockSize;
+
+            Vector partials = Allocate(dataType, MemoryLayout({ blockSize }));
+            ForRange(0, numFullBlocks * blockSize, blockSize, [&](Scalar base) {
+                for (int j = 0; j < blockSize; ++j)
+                {
+                    partials[j] += data[base + j] * weights[base + j];
+                }
+            });
+
+            Scalar result = Allocate(dataType, ScalarLayout);
+            for (int j = 0; j < blockSize; ++j)
+            {
+                result += partials[j];
+            }
+            for (int i = numFullBlocks * blockSize; i < size; ++i)
+            {
+                result += data[i] * weights[i];
+            }
+            return result;
+        }
+    } // namespace
+
     class ActivityTracker
     {
         Scalar _lastLevel;
@@ -306,11 +338,27 @@ namespace emittable_functions
         _impl->_time = StaticAllocate("time", int64_t{ 0 });
 
         auto dataType = data.GetType();
-        Vector weights = GetWeights();
+
+        // Cast the constant message weights at compile time, so no per-frame conversion pass is emitted
+        const auto& doubleWeights = GetWeights();
+        Vector weights;
+        if (dataType == ValueType::Float)
+        {
+            weights = std::vector<float>(doubleWeights.begin(), doubleWeights.end());
+        }
+        else if (dataType == ValueType::Double)
+        {
+            weights = doubleWeights;
+        }
+        else
+        {
+            weights = Cast(Vector(doubleWeights), dataType);
+        }
+
         Scalar windowSize = Cast(_impl->_windowSize, dataType);
         Scalar frameDuration = Cast(_impl->_frameDuration, dataType);
 
-        auto level = Dot(data, Cast(weights, dataType));
+        auto level = WeightedEnergy(data, weights);
 
         level /= windowSize;
 
@@ -17,5 +17,6 @@ namespace ell
 {
 
 void test_simpleDepthwiseSeparableConvolve2D();
+void test_simpleDepthwiseSeparableConvolve2DConstantStrides();
 
 } // namespace ell
@@ -79,4 +79,41 @@ void test_simpleDepthwiseSeparableConvolve2D()
     InvokeForContext<TestLLVMContext>(PrintIR);
 }
 
+void test_simpleDepthwiseSeparableConvolve2DConstantStrides()
+{
+    auto input = std::vector<double>{ 1, 2, 3, 4, 5, 6, 1, 1, 1, 2, 3, 4, 9, 8, 7, 1, 2, 3 };
+    auto filter = std::vector<double>{ 1, 2, 2, 1, 1, 1, -1, 0 };
+    auto expected = std::vector<double>{ 18, 24, 17, 20, -4, -1, 16, 13 };
+
+    Tensor inputTensor({ input, MemoryLayout({ 2, 3, 3 }, DimensionOrder(ChannelMajorTensorOrder)) });
+    Tensor filterTensor({ filter, MemoryLayout({ 2, 2, 2 }, DimensionOrder(ChannelMajorTensorOrder)) });
+    Tensor outputTensor(GlobalAllocate("result_test_SimpleDepthwiseSeparableConvolve2DConstantStrides",
+                                       ValueType::Double,
+                                       MemoryLayout({ 2, 2, 2 }, DimensionOrder(ChannelMajorTensorOrder))));
+
+    math::ColumnRowChannelTensor<double> expectedTensor(2, 2, 2, expected);
+
+    // The strides are bound at emit time, so the emitted function only takes the tensors
+    auto convolve2D = DeclareFunction("testSimpleDepthwiseSeparableConvolve2DConstantStrides")
+                          .Parameters(inputTensor, filterTensor, outputTensor)
+                          .Define([](Tensor signal, Tensor filter, Tensor output) {
+                              SimpleDepthwiseSeparableConvolve2D(signal, filter, 1, 1, output);
+                          });
+
+    InvokeForContext<ComputeContext>([&] {
+        bool ok = true;
+        convolve2D(inputTensor, filterTensor, outputTensor);
+        For(outputTensor, [&](Scalar row, Scalar col, Scalar channel) {
+            int rowInt = row.Get<int>(), colInt = col.Get<int>(), channelInt = channel.Get<int>();
+            double expected = expectedTensor(rowInt, colInt, channelInt);
+            double actual = outputTensor(row, col, channel).Get<double>();
+
+            ok &= testing::IsEqual(expected, actual);
+        });
+        testing::ProcessTest("Testing DepthwiseSeparableConvolve2D with constant strides", ok);
+    });
+
+    InvokeForContext<TestLLVMContext>(PrintIR);
+}
+
 } // namespace ell
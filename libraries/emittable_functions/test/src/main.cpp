@@ -48,6 +48,7 @@ int main(int argc, char* argv[])
             TestIIRFilter();
 
             test_simpleDepthwiseSeparableConvolve2D();
+            test_simpleDepthwiseSeparableConvolve2DConstantStrides();
         }
     }
     catch (const Exception& exception)
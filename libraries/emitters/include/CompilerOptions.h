@@ -28,6 +28,17 @@ namespace emitters
 
     std::string ToString(BlasType t);
 
+    /// <summary> Core placement policies for the emitted thread pool's workers on heterogeneous
+    /// (big.LITTLE) targets. </summary>
+    enum class ThreadAffinityPolicy
+    {
+        none = 0, /// <summary> Leave thread placement to the kernel scheduler. </summary>
+        bigCoresOnly, /// <summary> Pin workers to the big (performance) cores, for latency. </summary>
+        littleCoresOnly /// <summary> Pin workers to the little (efficiency) cores, for power. </summary>
+    };
+
+    std::string ToString(ThreadAffinityPolicy t);
+
     /// <summary> Standard compiler switches. </summary>
     struct CompilerOptions
     {
@@ -52,18 +63,50 @@ namespace emitters
         /// <summary> Emit profiling code, </summary>
         bool profile = false;
 
+        /// <summary> Also read hardware performance counters (cache and branch misses, via perf_event)
+        /// in emitted profile regions. Only has an effect when profiling is enabled and the target is Linux. </summary>
+        bool profileHardwareCounters = false;
+
+        /// <summary> Emit a telemetry ring buffer that profile regions write per-invocation records into,
+        /// for continuous monitoring of deployed models. Only has an effect when profiling is enabled. </summary>
+        bool profileTelemetry = false;
+
         /// <summary> Enable ELL's parallelization. </summary>
         bool parallelize = false;
 
         /// <summary> Use thread pool for parallelization (if parallelization enabled). </summary>
         bool useThreadPool = true;
 
+        /// <summary> Run emitted async tasks as queued one-shot continuations, executed to
+        /// completion by a scheduler loop on the waiting thread, instead of spawning threads.
+        /// For targets where thread creation and context-switch overhead exceeds the cost of
+        /// small task bodies; takes precedence over the thread pool when parallelization is
+        /// enabled. </summary>
+        bool useContinuationTasks = false;
+
+        /// <summary> Emit the thread pool's globals and functions with linkonce_odr linkage under
+        /// module-independent names, so that several emitted modules statically linked into one binary
+        /// share a single pool of worker threads instead of each creating their own. All modules linked
+        /// together must be compiled with the same maxThreads setting. </summary>
+        bool useSharedRuntime = false;
+
         /// <summary> Maximum num of parallel threads. </summary>
         int maxThreads = 4;
 
+        /// <summary> Which cores the emitted thread pool's workers may run on. Only has an effect on
+        /// Linux targets whose TargetDevice has big/little core masks; the emitted
+        /// <module>_SetThreadAffinity function can override the policy's mask at runtime. </summary>
+        ThreadAffinityPolicy threadAffinityPolicy = ThreadAffinityPolicy::none;
+
         /// <summary> Allow emitting more efficient code that isn't necessarily IEEE-754 compatible. </summary>
         bool useFastMath = true;
 
+        /// <summary> Replace compiled sigmoid/tanh activation functions with a branch-free table-based approximation instead of calling exp. </summary>
+        bool approximateActivationFunctions = false;
+
+        /// <summary> Maximum absolute error allowed from the activation function approximation. </summary>
+        double activationFunctionTolerance = 1e-3;
+
         /// <summary> Allow printing of diagnostic messages from the compiled model. </summary>
         bool includeDiagnosticInfo = false;
 
@@ -77,6 +120,12 @@ namespace emitters
         /// <summary> Explicitly unroll loops in certain cases. </summary>
         bool unrollLoops = false;
 
+        /// <summary> Emit software prefetch hints in loops that walk memory with large strides. </summary>
+        bool enablePrefetch = false;
+
+        /// <summary> Number of loop iterations ahead to prefetch (when prefetch emission is enabled). </summary>
+        int prefetchDistance = 8;
+
         /// <summary> Emit inline code for common operations. </summary>
         bool inlineOperators = true;
 
@@ -108,5 +157,8 @@ namespace utilities
 {
     template <>
     emitters::BlasType FromString<emitters::BlasType>(const std::string& s);
+
+    template <>
+    emitters::ThreadAffinityPolicy FromString<emitters::ThreadAffinityPolicy>(const std::string& s);
 }
 } // namespace ell
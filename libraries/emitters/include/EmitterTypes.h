@@ -32,6 +32,8 @@ namespace emitters
         Int32,
         ///<summary> 64 bit signed integer </summary>
         Int64,
+        ///<summary> 2 byte floating point </summary>
+        Float16,
         ///<summary> 4 byte floating point </summary>
         Float,
         ///<summary> 8 byte floating point </summary>
@@ -51,6 +53,8 @@ namespace emitters
         Int32Pointer,
         ///<summary> Pointer to an Int64 </summary>
         Int64Pointer,
+        ///<summary> Pointer to a Float16 </summary>
+        Float16Pointer,
         ///<summary> Pointer to a Float </summary>
         FloatPointer,
         ///<summary> Pointer to a Double </summary>
@@ -70,6 +74,8 @@ namespace emitters
         Int32PointerPointer,
         ///<summary> Pointer to a pointer to an Int64 </summary>
         Int64PointerPointer,
+        ///<summary> Pointer to a pointer to a Float16 </summary>
+        Float16PointerPointer,
         ///<summary> Pointer to a pointer to a Float </summary>
         FloatPointerPointer,
         ///<summary> Pointer to a pointer to a Double </summary>
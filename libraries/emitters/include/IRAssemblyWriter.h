@@ -14,6 +14,9 @@
 #include <llvm/Target/TargetMachine.h> // for CodeGenFileType
 #include <llvm/Target/TargetOptions.h> // for FloatABI::ABIType and FPOpFusion::FpOpFusionMode
 
+#include <string>
+#include <vector>
+
 namespace ell
 {
 namespace emitters
@@ -63,5 +66,21 @@ namespace emitters
 
     /// <summary> Compile the given module to the given stream </summary>
     void GenerateMachineCode(llvm::raw_ostream& os, IRModuleEmitter& module, ModuleOutputFormat format, const MachineCodeOutputOptions& options);
+
+    /// <summary>
+    /// Compile the given module to a set of machine code files, splitting it into per-function
+    /// partitions and running codegen for the partitions in parallel on a thread pool. Partition `n`
+    /// is written to `filePathPrefix` + ".n" + the format's extension, and the resulting object files
+    /// can be linked together in place of the single file the serial path produces.
+    /// </summary>
+    ///
+    /// <param name="filePathPrefix"> The prefix for the output file paths. </param>
+    /// <param name="module"> The module to compile. </param>
+    /// <param name="format"> The format of the output (must be assembly or objectCode). </param>
+    /// <param name="options"> Options to control how machine code is generated. </param>
+    /// <param name="numTasks"> The number of partitions to split the module into. </param>
+    ///
+    /// <returns> The paths of the files written. </returns>
+    std::vector<std::string> GenerateMachineCodeParallel(const std::string& filePathPrefix, IRModuleEmitter& module, ModuleOutputFormat format, const MachineCodeOutputOptions& options, int numTasks);
 } // namespace emitters
 } // namespace ell
@@ -74,12 +74,17 @@ namespace emitters
         LLVMValue _returnValue = nullptr;
 
         bool UsePthreads() const { return _usePthreads; }
+        bool UseContinuations() const { return _useContinuations; }
         LLVMFunction GetPthreadWrapper(llvm::StructType* argsStructType);
 
         bool _usePthreads = false;
+        bool _useContinuations = false;
 
         // For pthreads implementation
         LLVMValue _pthread = nullptr;
+
+        // For continuation-scheduler implementation
+        LLVMValue _resultSlot = nullptr;
     };
 
     /// <summary> Waits for all given tasks to finish </summary>
@@ -930,6 +930,17 @@ namespace emitters
         /// <returns> Pointer to the resulting llvm::StoreInst. </returns>
         llvm::StoreInst* Store(LLVMValue pPointer, LLVMValue pValue);
 
+        /// <summary> Sets whether subsequently-emitted store instructions are tagged with the non-temporal
+        /// hint, telling the backend to use streaming stores that bypass the cache where available. </summary>
+        ///
+        /// <param name="enabled"> `true` to tag emitted stores as non-temporal. </param>
+        void SetNonTemporalStoreHint(bool enabled) { _nonTemporalStores = enabled; }
+
+        /// <summary> Indicates whether emitted store instructions are currently tagged as non-temporal. </summary>
+        ///
+        /// <returns> `true` if emitted stores are tagged as non-temporal. </returns>
+        bool GetNonTemporalStoreHint() const { return _nonTemporalStores; }
+
         /// <summary> Emits instruction to create a stack variable. </summary>
         ///
         /// <param name="type"> The variable type. </param>
@@ -1135,6 +1146,7 @@ namespace emitters
         mutable llvm::IRBuilder<> _irBuilder; // IRBuilder API
         IRValueTable _stringLiterals; // String literals are emitted as constants. We have to track them ourselves to prevent dupes.
         LLVMValue _pZeroLiteral = nullptr;
+        bool _nonTemporalStores = false;
         std::unordered_map<std::string, llvm::StructType*> _structs;
     };
 
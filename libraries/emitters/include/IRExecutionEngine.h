@@ -23,6 +23,7 @@ namespace ell
 namespace emitters
 {
     class IRModuleEmitter;
+    class IRObjectCache;
 
     /// <summary> Function signature for a basic function that takes no input and returns no output </summary>
     typedef void (*DynamicFunction)(void);
@@ -124,6 +125,17 @@ namespace emitters
         /// <summary> Resolve and run the default Main function, if any. </summary>
         void RunMain();
 
+        /// <summary>
+        /// Enable the persistent object cache, storing compiled object code in the given directory.
+        /// When the same module is jitted again (keyed by its IR and target triple), the cached
+        /// object is loaded instead of re-running optimization and instruction selection, which
+        /// turns cold-start jitting into a file load plus relocation. Must be called before the
+        /// first function or global lookup.
+        /// </summary>
+        ///
+        /// <param name="cacheDirectory"> The directory to store cached object files in. </param>
+        void SetObjectCacheDirectory(const std::string& cacheDirectory);
+
     private:
         void EnsureEngine();
         void EnsureClockGetTime();
@@ -132,6 +144,7 @@ namespace emitters
 
         std::unique_ptr<llvm::EngineBuilder> _pBuilder;
         std::unique_ptr<llvm::ExecutionEngine> _pEngine;
+        std::unique_ptr<IRObjectCache> _objectCache;
     };
 } // namespace emitters
 } // namespace ell
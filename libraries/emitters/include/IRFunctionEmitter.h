@@ -74,7 +74,10 @@ namespace emitters
             /// <summary> This indicates that the parameter or return pointer is dereferenceable.
             /// This attribute may only be applied to pointer typed parameters. A pointer that is
             /// dereferenceable can be loaded from speculatively without a risk of trapping. </summary>
-            Dereferenceable
+            Dereferenceable,
+            /// <summary> This indicates the minimum byte alignment of the parameter's pointer.
+            /// This attribute may only be applied to pointer typed parameters. </summary>
+            Alignment
         };
 
         /// <summary> Query if this IRFunctionEmitter is valid. </summary>
@@ -790,6 +793,15 @@ namespace emitters
         /// <returns> Pointer to the emitted variable. </returns>
         llvm::AllocaInst* EmittedVariable(VariableType type, const std::string& name);
 
+        /// <summary> Return an emitted stack array of the given size and assign it a name. </summary>
+        ///
+        /// <param name="type"> The array entry type. </param>
+        /// <param name="size"> The array size. </param>
+        /// <param name="name"> The variable name. </param>
+        ///
+        /// <returns> Pointer to the emitted array. </returns>
+        llvm::AllocaInst* EmittedVariable(VariableType type, int size, const std::string& name);
+
         ///
         /// Load and Store
         ///
@@ -1116,6 +1128,26 @@ namespace emitters
         /// <param name="body"> A function that emits the body of the loop. </param>
         void For(const std::string& tag, LLVMValue beginValue, LLVMValue endValue, LLVMValue increment, ForLoopBodyFunction body);
 
+        /// <summary> Emits a for loop that repeats a given number of times, with explicit unrolling directives.
+        /// Use this for loops with tiny trip counts or loop-carried dependences where the schedule that
+        /// benchmarks best is known, instead of relying on LLVM's heuristics. </summary>
+        ///
+        /// <param name="count"> The number of iterations to make. </param>
+        /// <param name="unrollInfo"> The unrolling directives to attach to the loop. </param>
+        /// <param name="body"> A function that emits the body of the loop. </param>
+        void For(int count, const LoopUnrollInfo& unrollInfo, ForLoopBodyFunction body);
+
+        /// <summary> Emits a for loop counting from a begin value up to (but not including) a constant end value
+        /// with a given increment, with explicit unrolling directives. </summary>
+        ///
+        /// <param name="tag"> Tag to use when naming the basic block regions </param>
+        /// <param name="beginValue"> The starting value of the loop iterator. </param>
+        /// <param name="endValue"> The ending value of the loop iterator. </param>
+        /// <param name="increment"> The increment for the iterator. </param>
+        /// <param name="unrollInfo"> The unrolling directives to attach to the loop. </param>
+        /// <param name="body"> A function that emits the body of the loop. </param>
+        void For(const std::string& tag, int beginValue, int endValue, int increment, const LoopUnrollInfo& unrollInfo, ForLoopBodyFunction body);
+
         //
         // Extended for loops
         //
@@ -1518,6 +1550,24 @@ namespace emitters
         template <typename ValueType>
         void MemorySet(LLVMValue pDestinationPointer, LLVMValue pDestinationOffset, LLVMValue value, LLVMValue count);
 
+        /// <summary> Emits a software prefetch hint for the memory at the given address. Nodes that walk
+        /// large tensors with a non-unit stride can call this from their loop bodies with an offset of the
+        /// stride times the `prefetchDistance` compiler option, to request the data a few iterations ahead.
+        /// Nothing is emitted unless the `enablePrefetch` compiler option is set. </summary>
+        ///
+        /// <param name="pPointer"> Pointer to the base address to prefetch. </param>
+        /// <param name="offset"> Offset (in elements) from the base address. </param>
+        void Prefetch(LLVMValue pPointer, int offset = 0);
+
+        /// <summary> Emits a software prefetch hint for the memory at the given address. Nodes that walk
+        /// large tensors with a non-unit stride can call this from their loop bodies with an offset of the
+        /// stride times the `prefetchDistance` compiler option, to request the data a few iterations ahead.
+        /// Nothing is emitted unless the `enablePrefetch` compiler option is set. </summary>
+        ///
+        /// <param name="pPointer"> Pointer to the base address to prefetch. </param>
+        /// <param name="pOffset"> Offset (in elements) from the base address. </param>
+        void Prefetch(LLVMValue pPointer, LLVMValue pOffset);
+
         /// <summary> Inserts arbitrary function-level metadata into generated IR code. </summary>
         ///
         /// <param name="tag"> The tag of the metadata to set. </param>
@@ -1779,6 +1829,12 @@ namespace emitters
         /// <param name=options> A `CompilerOptions` object containing the options to use for this function. </param]>
         void SetCompilerOptions(const CompilerOptions& parameters);
 
+        /// <summary> Set the fast-math flags applied to floating-point operations subsequently emitted into this function. </summary>
+        ///
+        /// <param name="allowFastMath"> If true, allow fused multiply-add contraction and reassociation of the emitted
+        /// arithmetic; if false, emit strict IEEE-754 operations (appropriate for accumulation-sensitive code). </param>
+        void SetFastMathFlags(bool allowFastMath);
+
         /// <summary> Get the current LLVM context. </summary>
         ///
         /// <returns> The LLVMContext being used. </returns>
@@ -20,6 +20,20 @@ namespace emitters
 {
     class IRFunctionEmitter;
 
+    /// <summary> Explicit unrolling directives for an emitted loop. </summary>
+    struct LoopUnrollInfo
+    {
+        /// <summary> Unroll the loop by this factor (0 leaves the decision to LLVM). </summary>
+        int unrollFactor = 0;
+
+        /// <summary> Fully unroll the loop if its trip count is known and at most this many iterations (0 disables). </summary>
+        int fullUnrollBelow = 0;
+
+        /// <summary> Apply unroll-and-jam instead of plain unrolling: iterations of this loop are unrolled and the
+        /// resulting copies of its inner loop are fused, which hides the latency of loop-carried dependences. </summary>
+        bool unrollAndJam = false;
+    };
+
     /// <summary> Base class for loop emitters. </summary>
     class IRLoopEmitter
     {
@@ -28,7 +42,7 @@ namespace emitters
 
     protected:
         IRLoopEmitter(IRFunctionEmitter& functionEmitter);
-        void AddLoopMetadata(llvm::BranchInst* branch, bool unroll, bool parallel);
+        void AddLoopMetadata(llvm::BranchInst* branch, bool unroll, bool parallel, const LoopUnrollInfo& unrollInfo = {}, int tripCount = -1);
 
         IRFunctionEmitter& _functionEmitter; // Loop written into this function
     };
@@ -41,7 +55,8 @@ namespace emitters
         ///
         /// <param name="functionEmitter"> The function emitter. </param>
         /// <param name="tag"> Optional, tag to use when naming the basic block regions </param>
-        IRForLoopEmitter(IRFunctionEmitter& functionEmitter, const std::string& tag = "");
+        /// <param name="unrollInfo"> Optional, explicit unrolling directives to attach to the loop </param>
+        IRForLoopEmitter(IRFunctionEmitter& functionEmitter, const std::string& tag = "", const LoopUnrollInfo& unrollInfo = {});
 
         /// <summary> Gets the block containing the body of the for loop. </summary>
         ///
@@ -107,6 +122,8 @@ namespace emitters
         llvm::BasicBlock* _pAfterBlock = nullptr; // When the loop is done, we branch to this block
         LLVMValue _pIterationVariable = nullptr;
         std::string _tag;
+        LoopUnrollInfo _unrollInfo;
+        int _tripCount = -1; // the loop's trip count, if known when the loop is emitted
     };
 
     /// <summary> Class that simplifies while loop creation. Used internally by IRFunctionEmitter. </summary>
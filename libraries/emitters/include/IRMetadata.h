@@ -41,6 +41,9 @@ namespace emitters
     /// <summary> Indicates the Predict function that should be wrapped by SWIG. </summary>
     static const std::string c_predictFunctionTagName = "ell.fn.predict";
 
+    /// <summary> Indicates a runtime helper function that may be inlined into its callers during optimization. </summary>
+    static const std::string c_runtimeHelperFunctionTagName = "ell.fn.runtimeHelper";
+
     /// <summary> Indicates a function that should be wrapped by SWIG. </summary>
     static const std::string c_swigFunctionTagName = "ell.fn.swig";
 
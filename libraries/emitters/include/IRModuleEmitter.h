@@ -39,6 +39,7 @@
 #include <memory>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -127,6 +128,24 @@ namespace emitters
         /// <summary> End your reset function created with BeginResetFunction. </summary>
         void EndResetFunction() { EndFunction(); }
 
+        /// <summary> Register a mutable global variable as part of the model's streaming state
+        /// (delay lines, sample buffers, recurrent hidden state, etc.). The compiled map uses this
+        /// registry to snapshot and restore state when switching between stream sessions. </summary>
+        ///
+        /// <param name="stateVariable"> The global variable holding the state. </param>
+        void RegisterModelStateVariable(llvm::GlobalVariable* stateVariable);
+
+        /// <summary> Register a mutable global variable as part of the model's streaming state.
+        /// The value must be an emitted global variable. </summary>
+        ///
+        /// <param name="stateVariable"> The emitted global variable holding the state. </param>
+        void RegisterModelStateVariable(LLVMValue stateVariable);
+
+        /// <summary> Get the registered model state variables. </summary>
+        ///
+        /// <returns> The global variables registered via RegisterModelStateVariable. </returns>
+        const std::vector<llvm::GlobalVariable*>& GetModelStateVariables() const { return _modelStateVariables; }
+
         /// <summary> Begins an IR function with no arguments and directs subsequent commands to it. </summary>
         ///
         /// <param name="functionName"> The name of the function. </param>
@@ -236,6 +255,14 @@ namespace emitters
         template <typename ValueType>
         llvm::GlobalVariable* ConstantArray(const std::string& name, const std::vector<ValueType>& value);
 
+        /// <summary> Enable or disable constant-data pooling. When enabled, constants with
+        /// identical initializers share a single global, regardless of the names they were
+        /// emitted under. Used when compiling several variants of a model into one module, so
+        /// the variants share one copy of the weights. </summary>
+        ///
+        /// <param name="pool"> true to pool constant data. </param>
+        void SetPoolConstantData(bool pool) { _poolConstantData = pool; }
+
         /// <summary> Emit a named global variable of the given type. </summary>
         ///
         /// <param name="type"> The variable type. </param>
@@ -528,6 +555,19 @@ namespace emitters
         /// <param name="options"> Options to control how machine code is generated during output. </params>
         void WriteToFile(const std::string& filePath, ModuleOutputFormat format, const MachineCodeOutputOptions& options);
 
+        /// <summary>
+        /// Output the compiled module as a set of machine code files, splitting the module into
+        /// per-function partitions and running codegen for the partitions in parallel. Partition `n` is
+        /// written to `filePathPrefix` + ".n" + the format's extension.
+        /// </summary>
+        ///
+        /// <param name="filePathPrefix"> The prefix for the output file paths. </param>
+        /// <param name="format"> The format of the output (must be assembly or objectCode). </param>
+        /// <param name="numTasks"> The number of partitions to split the module into. </param>
+        ///
+        /// <returns> The paths of the files written. </returns>
+        std::vector<std::string> WriteToFiles(const std::string& filePathPrefix, ModuleOutputFormat format, int numTasks);
+
         /// <summary> Output the compiled module to an output stream with the given format. </summary>
         ///
         /// <param name="stream"> The stream to write to. </param>
@@ -774,6 +814,10 @@ namespace emitters
         template <typename T>
         LLVMValue EmitGlobalVector(InitializedVectorVariable<T>& var);
 
+        /// Emit IR for a stack-allocated vector.
+        template <typename T>
+        LLVMValue EmitLocalVector(VectorVariable<T>& var);
+
         /// Emit IR for a reference to an element in a vector.
         template <typename T>
         LLVMValue EmitRef(VectorElementVariable<T>& var);
@@ -829,8 +873,14 @@ namespace emitters
         // Info to modify how code is written out
         std::vector<std::pair<std::string, std::string>> _preprocessorDefinitions;
         std::vector<std::string> _resetFunctions;
+        std::vector<llvm::GlobalVariable*> _modelStateVariables;
         std::map<std::string, FunctionDeclaration> _functions;
 
+        // Constant-data pooling: llvm uniques constants within a context, so initializer
+        // identity is pointer identity
+        bool _poolConstantData = false;
+        std::unordered_map<llvm::Constant*, llvm::GlobalVariable*> _constantDataPool;
+
         ell::utilities::CallbackRegistry<float> _floatCallbacks;
         ell::utilities::CallbackRegistry<double> _doubleCallbacks;
         ell::utilities::CallbackRegistry<int> _intCallbacks;
@@ -967,6 +1017,12 @@ namespace emitters
             _globals.Add(var.EmittedName(), pVal);
             break;
 
+        case VariableScope::local:
+            // Stack-allocated in the current function; unlike a global vector, the contents are
+            // not zero-initialized
+            pVal = EmitLocalVector<T>(static_cast<VectorVariable<T>&>(var));
+            break;
+
         default:
             throw EmitterException(EmitterError::variableScopeNotSupported);
         }
@@ -1033,6 +1089,13 @@ namespace emitters
         return GlobalArray(var.EmittedName(), var.Data());
     }
 
+    template <typename T>
+    LLVMValue IRModuleEmitter::EmitLocalVector(VectorVariable<T>& var)
+    {
+        auto& currentFunction = GetCurrentFunction();
+        return currentFunction.EmittedVariable(var.Type(), var.Dimension(), var.EmittedName());
+    }
+
     template <typename T>
     LLVMValue IRModuleEmitter::EmitRef(VectorElementVariable<T>& var)
     {
@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     IRObjectCache.h (emitters)
+//  Authors:  Umesh Madan
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include <string>
+
+namespace ell
+{
+namespace emitters
+{
+    /// <summary>
+    /// A persistent, disk-backed object cache for the execution engine. Compiled object code is
+    /// keyed by a hash of the module IR and its target triple, so a process that jits the same
+    /// module again (e.g. on its next startup) loads the cached object instead of re-running
+    /// optimization and instruction selection.
+    /// </summary>
+    class IRObjectCache : public llvm::ObjectCache
+    {
+    public:
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="cacheDirectory"> The directory to store cached object files in. Created if
+        /// it doesn't already exist. </param>
+        IRObjectCache(const std::string& cacheDirectory);
+
+        /// <summary> Called by the execution engine when an object has been compiled; saves it to disk. </summary>
+        ///
+        /// <param name="module"> The module that was compiled. </param>
+        /// <param name="objectBuffer"> The compiled object code. </param>
+        void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef objectBuffer) override;
+
+        /// <summary> Called by the execution engine before compiling a module; returns the cached
+        /// object code if present, or nullptr to force compilation. </summary>
+        ///
+        /// <param name="module"> The module about to be compiled. </param>
+        ///
+        /// <returns> The cached object buffer, or nullptr on a cache miss. </returns>
+        std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+    private:
+        std::string GetCacheFilePath(const llvm::Module* module) const;
+
+        std::string _cacheDirectory;
+    };
+} // namespace emitters
+} // namespace ell
@@ -31,6 +31,14 @@ namespace emitters
         /// <summary> Add common optimizations to the optimizer pipeline. </summary>
         void AddStandardPasses();
 
+        /// <summary> Add an aggressive inlining and re-vectorization pipeline to run after the standard passes.
+        /// Runtime helper functions (those tagged with `c_runtimeHelperFunctionTagName`) at or below the given size
+        /// are marked always-inline so their bodies get folded into the node functions that call them, and the loop
+        /// and vectorization passes are re-run so loops that contained helper calls get another chance to vectorize. </summary>
+        ///
+        /// <param name="maxHelperInstructionCount"> Maximum number of instructions a helper may have and still be inlined. </param>
+        void AddRuntimeInliningPasses(int maxHelperInstructionCount = 64);
+
         /// <summary> Optimize the given function. </summary>
         ///
         /// <param name="pFunction"> pointer to the function to optimize. </param>
@@ -29,6 +29,9 @@ namespace emitters
             numTasks(numTasks) {}
 
         int numTasks = 0; // The number of tasks to break the loop into. '0' is the special 'auto' flag
+        int minIterationsPerTask = 0; // The minimum number of iterations worth assigning to a task (the "grain size").
+                                      // Loops with a compile-time trip count get fewer tasks (or run serially) rather
+                                      // than create tasks smaller than this. '0' is the special 'auto' flag
     };
 
     /// <summary> Class that simplifies parallel for loop creation. </summary>
@@ -37,6 +37,29 @@ namespace emitters
         /// <summary> Gets the LLVM type for a pointer to the `timespec` structure on the current target. </summary>
         LLVMType GetTimespecPointerType();
 
+        //
+        // perf_event performance counters (Linux-only)
+        //
+
+        /// <summary> Indicates if the perf_event API is available on the current target. </summary>
+        bool IsPerfEventAvailable() const;
+
+        /// <summary> Gets the LLVM type for the `perf_event_attr` structure. This uses the original
+        /// 64-byte (PERF_ATTR_SIZE_VER0) layout, which every kernel with perf_event support accepts. </summary>
+        llvm::StructType* GetPerfEventAttrType();
+
+        /// <summary> Gets the `perf_event_open` syscall number for the current target. There is no libc
+        /// wrapper for perf_event_open, so callers invoke it via `syscall()`. </summary>
+        int GetPerfEventOpenSyscallNumber() const;
+
+        /// <summary> Gets an LLVMFunction representing the syscall function. </summary>
+        /// long syscall(long number, ...);
+        LLVMFunction GetSyscallFunction();
+
+        /// <summary> Gets an LLVMFunction representing the read function. </summary>
+        /// ssize_t read(int fd, void* buffer, size_t count);
+        LLVMFunction GetReadFunction();
+
         //
         // pthreads
         //
@@ -76,6 +99,17 @@ namespace emitters
         /// pthread_t pthread_self(void);
         LLVMFunction GetPthreadSelfFunction();
 
+        // pthreads -- thread affinity (Linux-only)
+
+        /// <summary> Indicates if thread affinity control (pthread_setaffinity_np) is available on the current target. </summary>
+        bool IsThreadAffinityAvailable() const;
+
+        /// <summary> Gets an LLVMFunction representing the pthread_setaffinity_np function. The cpu set
+        /// is passed as an untyped pointer plus a byte size, so callers can use any prefix of the
+        /// kernel's cpu_set_t (e.g. a single 64-bit mask covering cpus 0-63). </summary>
+        /// int pthread_setaffinity_np(pthread_t thread, size_t cpusetsize, const cpu_set_t* cpuset);
+        LLVMFunction GetPthreadSetAffinityNpFunction();
+
         // pthreads -- synchronization functions
 
         /// <summary> Gets an LLVMFunction representing the pthread_mutex_init function. </summary>
@@ -175,6 +209,7 @@ namespace emitters
 
         // Cached types
         llvm::StructType* _timespecType = nullptr;
+        llvm::StructType* _perfEventAttrType = nullptr;
     };
 } // namespace emitters
 } // namespace ell
@@ -18,12 +18,28 @@
 // External API for profiling functions
 extern "C" {
 
-/// <summary> A struct that holds information about a profile region. </summary>
+/// <summary> A struct that holds information about a profile region. The hardware counter fields
+/// are only filled in when hardware-counter profiling is enabled and supported by the target;
+/// otherwise they read as zero. </summary>
 struct ProfileRegionInfo
 {
     int64_t count;
     double totalTime;
+    int64_t cacheMisses;
+    int64_t branchMisses;
     const char* name;
+    const char* tag;
+};
+
+/// <summary> A fixed-size record written to the telemetry ring buffer each time a profile region
+/// exits. A monitoring process drains the ring to compute rolling statistics (rates, moving-average
+/// latencies) without interrupting the model. </summary>
+struct ProfileTelemetryRecord
+{
+    int32_t regionIndex;
+    int32_t reserved;
+    double timestamp; // region exit time, in ms (same clock as ProfileRegionInfo::totalTime)
+    double duration; // time spent in the region for this visit, in ms
 };
 }
 
@@ -31,8 +47,9 @@ namespace ell
 {
 namespace emitters
 {
-    // import ProfileRegionInfo into this namespace
+    // import ProfileRegionInfo and ProfileTelemetryRecord into this namespace
     using ::ProfileRegionInfo;
+    using ::ProfileTelemetryRecord;
 
     class IRFunctionEmitter;
     class IRModuleEmitter;
@@ -46,7 +63,12 @@ namespace emitters
     {
     public:
         /// <summary> Constructor. </summary>
-        IRProfileRegion(IRFunctionEmitter& function, const std::string& name);
+        ///
+        /// <param name="function"> The function containing the code to be profiled. </param>
+        /// <param name="name"> The name of the region. </param>
+        /// <param name="tag"> An optional grouping tag (typically the source layer or submodel id)
+        /// used to aggregate related regions. If empty, the profiler's current region tag is used. </param>
+        IRProfileRegion(IRFunctionEmitter& function, const std::string& name, const std::string& tag = "");
 
         /// <summary> Enter the profiling region: increment the visit count and begin timing. </summary>
         void Enter();
@@ -65,11 +87,17 @@ namespace emitters
         IRLocalScalar GetIndex() const { return _index; }
         IRLocalScalar GetStartTime() const { return _startTime; }
         void SetStartTime(const IRLocalScalar& time) { _startTime = time; }
+        IRLocalScalar GetStartCacheMisses() const { return _startCacheMisses; }
+        void SetStartCacheMisses(const IRLocalScalar& value) { _startCacheMisses = value; }
+        IRLocalScalar GetStartBranchMisses() const { return _startBranchMisses; }
+        void SetStartBranchMisses(const IRLocalScalar& value) { _startBranchMisses = value; }
 
         IRFunctionEmitter& _function;
         IRProfiler& _profiler;
         IRLocalScalar _index;
         IRLocalScalar _startTime;
+        IRLocalScalar _startCacheMisses;
+        IRLocalScalar _startBranchMisses;
     };
 
     /// <summary>
@@ -83,7 +111,8 @@ namespace emitters
         ///
         /// <param name="function"> The function containing the code to be profiled. </param>
         /// <param name="name"> The name of the region to create. </param>
-        IRProfileRegionBlock(IRFunctionEmitter& function, const std::string& name);
+        /// <param name="tag"> An optional grouping tag (typically the source layer or submodel id). </param>
+        IRProfileRegionBlock(IRFunctionEmitter& function, const std::string& name, const std::string& tag = "");
 
         IRProfileRegionBlock(const IRProfileRegionBlock&) = delete;
         IRProfileRegionBlock(IRProfileRegionBlock&&) = default;
@@ -126,6 +155,56 @@ namespace emitters
         /// <returns> The name of the emitted "ResetRegionProfilingInfo" function. </returns>
         std::string GetResetRegionProfilingInfoFunctionName() const;
 
+        /// <summary> Set the tag given to subsequently-created regions that don't specify one.
+        /// The map compiler sets this to the source layer (ancestor) id of the node being
+        /// compiled, so regions created inside refined nodes aggregate back to their original
+        /// layer. </summary>
+        ///
+        /// <param name="tag"> The tag to apply, or the empty string to clear it. </param>
+        void SetCurrentRegionTag(const std::string& tag) { _currentRegionTag = tag; }
+
+        /// <summary> Get the tag currently applied to new regions. </summary>
+        const std::string& GetCurrentRegionTag() const { return _currentRegionTag; }
+
+        /// <summary> Enable or disable reading hardware performance counters (cache and branch misses,
+        /// via perf_event) when entering and exiting profile regions. Only has an effect when profiling
+        /// is enabled and the target supports perf_event (Linux); elsewhere the counter fields in
+        /// `ProfileRegionInfo` stay zero. </summary>
+        ///
+        /// <param name="enabled"> Whether profile regions should read hardware counters. </param>
+        void SetHardwareCountersEnabled(bool enabled) { _hardwareCountersEnabled = enabled; }
+
+        /// <summary> Indicates if profile regions will read hardware performance counters. </summary>
+        bool AreHardwareCountersEnabled() const;
+
+        /// <summary> Enable or disable the telemetry ring buffer. When enabled, every profile region
+        /// exit appends a fixed-size `ProfileTelemetryRecord` to a ring buffer that a monitoring
+        /// process can drain through the emitted "GetTelemetryBuffer" / "GetTelemetryWritePosition"
+        /// functions, without stopping the model. The single writer just stores the record and bumps
+        /// a monotonic write index, so the per-record overhead is a handful of stores. Must be set
+        /// before `Init()` is called; only has an effect when profiling is enabled. </summary>
+        ///
+        /// <param name="enabled"> Whether profile regions should write telemetry records. </param>
+        void SetTelemetryEnabled(bool enabled) { _telemetryEnabled = enabled; }
+
+        /// <summary> Indicates if profile regions will write telemetry records. </summary>
+        bool IsTelemetryEnabled() const { return _profilingEnabled && _telemetryEnabled; }
+
+        /// <summary> Get the name of the emitted "GetTelemetryBuffer" function. </summary>
+        ///
+        /// <returns> The name of the emitted "GetTelemetryBuffer" function. </returns>
+        std::string GetGetTelemetryBufferFunctionName() const;
+
+        /// <summary> Get the name of the emitted "GetTelemetryCapacity" function. </summary>
+        ///
+        /// <returns> The name of the emitted "GetTelemetryCapacity" function. </returns>
+        std::string GetGetTelemetryCapacityFunctionName() const;
+
+        /// <summary> Get the name of the emitted "GetTelemetryWritePosition" function. </summary>
+        ///
+        /// <returns> The name of the emitted "GetTelemetryWritePosition" function. </returns>
+        std::string GetGetTelemetryWritePositionFunctionName() const;
+
     private:
         friend IRProfileRegion;
 
@@ -134,7 +213,7 @@ namespace emitters
         IRLocalScalar GetCurrentTime(IRFunctionEmitter& function);
 
         // Actual implementations of the functions in IRProfileRegion
-        void InitRegion(IRProfileRegion& region, const std::string& desiredName);
+        void InitRegion(IRProfileRegion& region, const std::string& desiredName, const std::string& tag);
         void EnterRegion(IRProfileRegion& region);
         void ExitRegion(IRProfileRegion& region);
         void ResetRegionCounts(IRFunctionEmitter& function, const IRLocalScalar& regionIndex);
@@ -160,17 +239,42 @@ namespace emitters
         LLVMValue GetNumRegions(emitters::IRFunctionEmitter& function);
         LLVMValue GetRegionPointer(emitters::IRFunctionEmitter& function, LLVMValue index);
 
+        // Hardware performance counter support
+        IRLocalScalar ReadPerfCounter(emitters::IRFunctionEmitter& function, int counterIndex);
+        void CreatePerfCounterData();
+        LLVMFunction GetInitPerfCountersFunction();
+        LLVMFunction GetReadPerfCounterFunction();
+
+        // Telemetry ring buffer support
+        void WriteTelemetryRecord(emitters::IRFunctionEmitter& function, const IRLocalScalar& regionIndex, const IRLocalScalar& timestamp, const IRLocalScalar& duration);
+        void CreateTelemetryData();
+        LLVMFunction GetWriteTelemetryRecordFunction();
+        void EmitGetTelemetryBufferFunction();
+        void EmitGetTelemetryCapacityFunction();
+        void EmitGetTelemetryWritePositionFunction();
+
         emitters::IRModuleEmitter* _module = nullptr;
         bool _profilingEnabled = false;
+        bool _hardwareCountersEnabled = false;
+        bool _telemetryEnabled = false;
 
         std::unordered_set<std::string> _regionNames;
+        std::string _currentRegionTag;
 
         // Cache these often-used functions so we don't have to keep looking them up by name
         LLVMFunction _getNumRegionsFunction = nullptr;
         LLVMFunction _getRegionBufferFunction = nullptr;
+        LLVMFunction _initPerfCountersFunction = nullptr;
+        LLVMFunction _readPerfCounterFunction = nullptr;
+        LLVMFunction _writeTelemetryRecordFunction = nullptr;
 
         llvm::StructType* _profileRegionType = nullptr;
+        llvm::StructType* _telemetryRecordType = nullptr;
         llvm::GlobalVariable* _profileRegionsArray = nullptr;
+        llvm::GlobalVariable* _perfCounterFds = nullptr;
+        llvm::GlobalVariable* _perfCountersInitialized = nullptr;
+        llvm::GlobalVariable* _telemetryRecords = nullptr;
+        llvm::GlobalVariable* _telemetryWriteIndex = nullptr;
         int _regionCount = 0;
     };
 } // namespace emitters
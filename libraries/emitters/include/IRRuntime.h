@@ -14,6 +14,9 @@
 
 #include <utilities/include/Exception.h>
 
+#include <functional>
+#include <string>
+
 namespace ell
 {
 namespace emitters
@@ -173,6 +176,28 @@ namespace emitters
         /// <summary> Get the string compare function </summary>
         LLVMFunction GetStringCompareFunction();
 
+        //
+        // SIMD width dispatch
+        //
+
+        /// <summary> Get the function returning the widest SIMD register width (in bytes) usable on the CPU at runtime. </summary>
+        ///
+        /// <returns> An LLVM function pointer to the function. </returns>
+        LLVMFunction GetVectorWidthFunction();
+
+        /// <summary> Emit one variant of a vectorized function per SIMD register width (128, 256, and 512 bits), plus a
+        /// dispatcher with the same signature that calls the widest variant the CPU supports, through a lazily-resolved
+        /// function pointer (an ifunc-style dispatch that works on all our targets). On non-x86 targets only the
+        /// 128-bit variant is emitted and the dispatcher calls it directly. </summary>
+        ///
+        /// <param name="functionName"> The name of the dispatcher function. </param>
+        /// <param name="returnType"> The return type of the function. </param>
+        /// <param name="arguments"> The arguments to the function. </param>
+        /// <param name="emitBody"> A callback that emits the body of one variant, given the SIMD register width in bytes. </param>
+        ///
+        /// <returns> An LLVM function pointer to the dispatcher. </returns>
+        LLVMFunction EmitVectorWidthDispatchedFunction(const std::string& functionName, VariableType returnType, const NamedVariableTypeList& arguments, std::function<void(IRFunctionEmitter& function, int vectorWidthBytes)> emitBody);
+
         //
         // Posix functions
         //
@@ -198,6 +223,9 @@ namespace emitters
         LLVMFunction GetDotProductIntFunction();
         LLVMFunction GetDotProductFloatFunction();
 
+        // SIMD width dispatch
+        LLVMFunction EmitVectorWidthFunction();
+
         // Matrix math (BLAS or native)
         LLVMFunction GetSGEMVFunction(bool useBlas);
         LLVMFunction GetSGEMMFunction(bool useBlas);
@@ -213,6 +241,7 @@ namespace emitters
         LLVMFunction _dotProductFunction = nullptr;
         LLVMFunction _getCurrentTimeFunction = nullptr;
         LLVMFunction _stringCompareFunction = nullptr;
+        LLVMFunction _vectorWidthFunction = nullptr;
     };
 } // namespace emitters
 } // namespace ell
@@ -140,12 +140,15 @@ namespace emitters
         /// <returns> A task array object representing the running tasks. </param>
         IRThreadPoolTaskArray& StartTasks(IRFunctionEmitter& function, LLVMFunction taskFunction, const std::vector<std::vector<LLVMValue>>& arguments);
 
-        /// <summary> Pop a task off the task queue, waiting for one to become available if necessary. </summary>
+        /// <summary> Pop a task off the task queue, waiting for one to become available if necessary.
+        /// Workers claim tasks from their own range first, and steal from other workers' ranges when
+        /// their own is exhausted. </summary>
         ///
         /// <param name="function"> The function currently being emitted into. </param>
+        /// <param name="workerId"> The index of the worker thread asking for a task. </param>
         ///
         /// <returns> The next task in the queue. </param>
-        IRThreadPoolTask PopNextTask(IRFunctionEmitter& function);
+        IRThreadPoolTask PopNextTask(IRFunctionEmitter& function, LLVMValue workerId);
 
         /// <summary> Wait for all tasks to finish. </summary>
         ///
@@ -160,9 +163,8 @@ namespace emitters
     private:
         friend class IRThreadPool;
         IRThreadPoolTaskQueue(); // create an empty queue
-        void Initialize(IRFunctionEmitter& function); // initializes the task array
+        void Initialize(IRFunctionEmitter& function, size_t numWorkers); // initializes the task array and the per-worker task ranges
         LLVMValue GetDataStruct() { return _queueData; }
-        LLVMValue DecrementCountField(IRFunctionEmitter& function, LLVMValue fieldPtr);
         llvm::StructType* GetTaskQueueDataType(IRModuleEmitter& module) const;
 
         // Accessors for fields
@@ -174,11 +176,14 @@ namespace emitters
         void SetShutdownFlag(IRFunctionEmitter& function);
         LLVMValue GetShutdownFlag(IRFunctionEmitter& function) const;
         void SetInitialCount(IRFunctionEmitter& function, LLVMValue newValue);
-        LLVMValue DecrementUnscheduledTasks(IRFunctionEmitter& function);
         LLVMValue DecrementUnfinishedTasks(IRFunctionEmitter& function);
         LLVMValue IsEmpty(IRFunctionEmitter& function) const;
         LLVMValue IsFinished(IRFunctionEmitter& function) const;
 
+        // Per-worker task ranges (for work stealing)
+        LLVMValue GetTaskRangePointer(IRFunctionEmitter& function, LLVMValue workerIndex);
+        void TryClaimTask(IRFunctionEmitter& function, LLVMValue workerId, LLVMValue taskIndexVar);
+
         bool IsInitialized() const;
         void NotifyWaitingClients(IRFunctionEmitter& function);
         void LockQueueMutex(IRFunctionEmitter& function);
@@ -195,6 +200,8 @@ namespace emitters
             shutdownFlag
         };
         LLVMValue _queueData = nullptr; // a struct with the above fields
+        size_t _numWorkers = 0;
+        llvm::GlobalVariable* _taskRanges = nullptr; // per-worker [head, tail) task ranges, each packed into a single 64-bit word so it can be read and updated atomically
         IRThreadPoolTaskArray _tasks;
     };
 
@@ -228,11 +235,17 @@ namespace emitters
         bool IsInitialized() const;
         void AddGlobalInitializer();
         void AddGlobalFinalizer();
+        void AddThreadAffinityFunction(); // emits the affinity mask global and the function applying it to the workers
+        void AddThreadAffinityOverride(); // emits the public <module>_SetThreadAffinity function
         LLVMFunction GetWorkerThreadFunction();
 
         IRModuleEmitter& _module;
         size_t _maxThreads = 0;
+        llvm::GlobalVariable* _isInited = nullptr; // global flag guarding thread creation and shutdown
         llvm::GlobalVariable* _threads = nullptr; // global array of pthread_t
+        llvm::GlobalVariable* _workerThreadIds = nullptr; // global array of int32 worker indices, passed to the worker threads on creation
+        llvm::GlobalVariable* _affinityMask = nullptr; // global int64 cpu mask for the worker threads (0 == no affinity)
+        LLVMFunction _applyAffinityFunction = nullptr; // applies the mask to all worker threads
 
         // task queue
         IRThreadPoolTaskQueue _taskQueue;
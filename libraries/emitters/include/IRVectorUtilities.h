@@ -14,6 +14,11 @@
 
 #include <utilities/include/TypeTraits.h>
 
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 namespace ell
 {
 namespace emitters
@@ -52,6 +57,103 @@ namespace emitters
     /// <returns> The sum of the elements in the given vector </returns>
     template <typename ValueType>
     LLVMValue HorizontalVectorSum(IRFunctionEmitter& function, LLVMValue vectorValue);
+
+    /// <summary> Compute the elementwise maximum of two floating-point values </summary>
+    ///
+    /// The operands may be scalars or vectors of the same shape. Emits a compare-and-select,
+    /// which LLVM lowers to the native SIMD max instruction where one is available.
+    ///
+    /// <typeparam name="ValueType"> The element type of the operands </typeparam>
+    /// <param name="function"> The function being emitted </param>
+    /// <param name="value1"> The first operand </param>
+    /// <param name="value2"> The second operand </param>
+    ///
+    /// <returns> The elementwise maximum of the two operands </returns>
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType> = true>
+    LLVMValue VectorMax(IRFunctionEmitter& function, LLVMValue value1, LLVMValue value2);
+
+    /// <summary> Compute the maximum of the entries in a vector </summary>
+    ///
+    /// Emits explicit vector code to compute the maximum, analogously to `HorizontalVectorSum`:
+    /// the vector is recursively split in half and the halves are combined with `VectorMax`.
+    ///
+    /// <typeparam name="ValueType"> The element type of the vector </typeparam>
+    /// <param name="function"> The function being emitted </param>
+    /// <param name="vectorValue"> The value to find the maximum element of </param>
+    ///
+    /// <returns> The maximum of the elements in the given vector </returns>
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType> = true>
+    LLVMValue HorizontalVectorMax(IRFunctionEmitter& function, LLVMValue vectorValue);
+
+    /// <summary> Compute the elementwise minimum of two floating-point values </summary>
+    ///
+    /// The operands may be scalars or vectors of the same shape. Emits a compare-and-select,
+    /// which LLVM lowers to the native SIMD min instruction where one is available.
+    ///
+    /// <typeparam name="ValueType"> The element type of the operands </typeparam>
+    /// <param name="function"> The function being emitted </param>
+    /// <param name="value1"> The first operand </param>
+    /// <param name="value2"> The second operand </param>
+    ///
+    /// <returns> The elementwise minimum of the two operands </returns>
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType> = true>
+    LLVMValue VectorMin(IRFunctionEmitter& function, LLVMValue value1, LLVMValue value2);
+
+    //
+    // Elementwise transcendental functions
+    //
+    // These emit branch-free polynomial approximations as straight-line IR, so they work on
+    // scalars and on vectors of any width and make no libm calls. Accuracy is a few ulps for
+    // float and roughly 1e-13 relative for double -- plenty for neural network inference, but
+    // use the scalar runtime functions when full libm accuracy matters.
+    //
+
+    /// <summary> Compute the elementwise exponential of a floating-point value </summary>
+    ///
+    /// The argument is clamped to the range where the result stays finite and normalized, so
+    /// out-of-range arguments saturate instead of producing infinities.
+    ///
+    /// <typeparam name="ValueType"> The element type of the operand </typeparam>
+    /// <param name="function"> The function being emitted </param>
+    /// <param name="x"> The operand, a scalar or vector of floating-point type </param>
+    ///
+    /// <returns> The elementwise exponential of the operand </returns>
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType> = true>
+    LLVMValue VectorExp(IRFunctionEmitter& function, LLVMValue x);
+
+    /// <summary> Compute the elementwise natural logarithm of a floating-point value </summary>
+    ///
+    /// The argument is clamped below to the smallest positive normalized value, so zero and
+    /// negative arguments produce the (large, negative) logarithm of that value instead of
+    /// -infinity or NaN.
+    ///
+    /// <typeparam name="ValueType"> The element type of the operand </typeparam>
+    /// <param name="function"> The function being emitted </param>
+    /// <param name="x"> The operand, a scalar or vector of floating-point type </param>
+    ///
+    /// <returns> The elementwise natural logarithm of the operand </returns>
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType> = true>
+    LLVMValue VectorLog(IRFunctionEmitter& function, LLVMValue x);
+
+    /// <summary> Compute the elementwise hyperbolic tangent of a floating-point value </summary>
+    ///
+    /// <typeparam name="ValueType"> The element type of the operand </typeparam>
+    /// <param name="function"> The function being emitted </param>
+    /// <param name="x"> The operand, a scalar or vector of floating-point type </param>
+    ///
+    /// <returns> The elementwise hyperbolic tangent of the operand </returns>
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType> = true>
+    LLVMValue VectorTanh(IRFunctionEmitter& function, LLVMValue x);
+
+    /// <summary> Compute the elementwise logistic sigmoid of a floating-point value </summary>
+    ///
+    /// <typeparam name="ValueType"> The element type of the operand </typeparam>
+    /// <param name="function"> The function being emitted </param>
+    /// <param name="x"> The operand, a scalar or vector of floating-point type </param>
+    ///
+    /// <returns> The elementwise logistic sigmoid of the operand </returns>
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType> = true>
+    LLVMValue VectorSigmoid(IRFunctionEmitter& function, LLVMValue x);
 } // namespace emitters
 } // namespace ell
 
@@ -137,6 +239,219 @@ namespace emitters
         auto half2 = emitter.GetIRBuilder().CreateExtractElement(vectorValue, static_cast<uint64_t>(1));
         return function.Operator(emitters::GetAddForValueType<ValueType>(), half1, half2);
     }
+
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType>>
+    LLVMValue VectorMax(IRFunctionEmitter& function, LLVMValue value1, LLVMValue value2)
+    {
+        auto comparison = function.Comparison(TypedComparison::greaterThanFloat, value1, value2);
+        return function.Select(comparison, value1, value2);
+    }
+
+    // Like HorizontalVectorSum, runs in logN time by recursively splitting the vector in half
+    // and taking the elementwise maximum of the halves.
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType>>
+    LLVMValue HorizontalVectorMax(IRFunctionEmitter& function, LLVMValue vectorValue)
+    {
+        LLVMType type = vectorValue->getType();
+
+        // Allow calling HorizontalVectorMax to be a no-op on a scalar
+        if (!type->isVectorTy())
+        {
+            return vectorValue;
+        }
+
+        llvm::VectorType* vecType = llvm::cast<llvm::VectorType>(type);
+        if (vecType == nullptr)
+        {
+            throw EmitterException(EmitterError::valueTypeNotSupported);
+        }
+
+        int vectorSize = vecType->getNumElements();
+        IREmitter& emitter = function.GetEmitter();
+
+        // Take care of the edge case of 1-element vectors
+        if (vectorSize == 1)
+        {
+            return emitter.GetIRBuilder().CreateExtractElement(vectorValue, static_cast<uint64_t>(0));
+        }
+
+        // Repeatedly split the vector into two halves, and take the elementwise max of the two halves
+        while (vectorSize > 2)
+        {
+            auto undef = llvm::UndefValue::get(vectorValue->getType()); // This undef is to tell LLVM we don't care what goes in the second operand of the shufflevector instruction
+            if (vectorSize % 2 != 0)
+            {
+                throw EmitterException(EmitterError::valueTypeNotSupported); // vectorSize must be a power of 2
+            }
+            std::vector<uint32_t> elementIndices1;
+            std::vector<uint32_t> elementIndices2;
+            for (int index = 0; index < vectorSize / 2; ++index)
+            {
+                elementIndices1.push_back(index); // Collect indices [0, vectorSize/2)
+                elementIndices2.push_back((vectorSize / 2) + index); // Collect indices [vectorSize/2, vectorSize)
+            }
+            auto half1 = emitter.GetIRBuilder().CreateShuffleVector(vectorValue, undef, elementIndices1); // Extract elements [0, vectorSize/2)
+            auto half2 = emitter.GetIRBuilder().CreateShuffleVector(vectorValue, undef, elementIndices2); // Extract elements [vectorSize/2, vectorSize)
+            vectorValue = VectorMax<ValueType>(function, half1, half2);
+            vectorSize /= 2;
+        }
+
+        if (vectorSize != 2)
+        {
+            throw EmitterException(EmitterError::valueTypeNotSupported);
+        }
+        auto half1 = emitter.GetIRBuilder().CreateExtractElement(vectorValue, static_cast<uint64_t>(0));
+        auto half2 = emitter.GetIRBuilder().CreateExtractElement(vectorValue, static_cast<uint64_t>(1));
+        return VectorMax<ValueType>(function, half1, half2);
+    }
+
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType>>
+    LLVMValue VectorMin(IRFunctionEmitter& function, LLVMValue value1, LLVMValue value2)
+    {
+        auto comparison = function.Comparison(TypedComparison::lessThanFloat, value1, value2);
+        return function.Select(comparison, value1, value2);
+    }
+
+    namespace detail
+    {
+        // Returns the integer type with the same shape as the given floating-point type:
+        // i32 for float, i64 for double, and vectors thereof
+        inline LLVMType GetMatchingIntType(LLVMType type)
+        {
+            const unsigned numBits = type->getScalarType()->isFloatTy() ? 32 : 64;
+            LLVMType intType = llvm::IntegerType::get(type->getContext(), numBits);
+            if (type->isVectorTy())
+            {
+                return llvm::VectorType::get(intType, llvm::cast<llvm::VectorType>(type)->getNumElements());
+            }
+            return intType;
+        }
+
+        // Evaluates a polynomial with the given coefficients (highest degree first) at x,
+        // using Horner's scheme
+        template <typename ValueType>
+        LLVMValue EvaluatePolynomial(IRFunctionEmitter& function, LLVMValue x, const std::vector<double>& coefficients)
+        {
+            auto type = x->getType();
+            LLVMValue result = llvm::ConstantFP::get(type, coefficients[0]);
+            for (size_t index = 1; index < coefficients.size(); ++index)
+            {
+                result = function.Operator(GetMultiplyForValueType<ValueType>(), result, x);
+                result = function.Operator(GetAddForValueType<ValueType>(), result, llvm::ConstantFP::get(type, coefficients[index]));
+            }
+            return result;
+        }
+    } // namespace detail
+
+    // Standard range-reduction scheme: write x = n*ln(2) + r with n an integer and
+    // |r| <= ln(2)/2, evaluate e^r with a polynomial, and scale the result by 2^n by
+    // constructing the bit pattern of the power of two directly.
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType>>
+    LLVMValue VectorExp(IRFunctionEmitter& function, LLVMValue x)
+    {
+        constexpr bool isFloat = std::is_same<ValueType, float>::value;
+        constexpr double maxArg = isFloat ? 88.0 : 708.0; // conservative: e^(+/-maxArg) neither overflows nor denormalizes
+        constexpr int mantissaBits = isFloat ? 23 : 52;
+        constexpr int exponentBias = isFloat ? 127 : 1023;
+        constexpr double log2e = 1.44269504088896340736;
+        constexpr double ln2Hi = 0.693145751953125; // ln(2) split into a short-mantissa high part...
+        constexpr double ln2Lo = 1.42860682030941723212e-6; // ...and a low-order correction, so r = x - n*ln(2) stays accurate
+
+        auto& builder = function.GetEmitter().GetIRBuilder();
+        auto type = x->getType();
+        auto intType = detail::GetMatchingIntType(type);
+
+        x = VectorMax<ValueType>(function, x, llvm::ConstantFP::get(type, -maxArg));
+        x = VectorMin<ValueType>(function, x, llvm::ConstantFP::get(type, maxArg));
+
+        // n = round(x / ln(2)), rounding by offsetting away from zero and truncating
+        auto scaled = function.Operator(GetMultiplyForValueType<ValueType>(), x, llvm::ConstantFP::get(type, log2e));
+        auto isNegative = function.Comparison(TypedComparison::lessThanFloat, scaled, llvm::Constant::getNullValue(type));
+        auto roundOffset = function.Select(isNegative, llvm::ConstantFP::get(type, -0.5), llvm::ConstantFP::get(type, 0.5));
+        auto n = builder.CreateFPToSI(function.Operator(GetAddForValueType<ValueType>(), scaled, roundOffset), intType);
+        auto nFloat = builder.CreateSIToFP(n, type);
+
+        // r = x - n*ln(2), subtracted in two pieces for accuracy
+        auto r = function.Operator(GetSubtractForValueType<ValueType>(), x, function.Operator(GetMultiplyForValueType<ValueType>(), nFloat, llvm::ConstantFP::get(type, ln2Hi)));
+        r = function.Operator(GetSubtractForValueType<ValueType>(), r, function.Operator(GetMultiplyForValueType<ValueType>(), nFloat, llvm::ConstantFP::get(type, ln2Lo)));
+
+        // e^r on |r| <= ln(2)/2 via its Taylor series (the truncation error is below a float
+        // ulp at degree 6 and ~1e-13 relative at degree 10)
+        const auto coefficients = isFloat ? std::vector<double>{ 1.0 / 720, 1.0 / 120, 1.0 / 24, 1.0 / 6, 0.5, 1.0, 1.0 }
+                                          : std::vector<double>{ 1.0 / 3628800, 1.0 / 362880, 1.0 / 40320, 1.0 / 5040, 1.0 / 720, 1.0 / 120, 1.0 / 24, 1.0 / 6, 0.5, 1.0, 1.0 };
+        auto p = detail::EvaluatePolynomial<ValueType>(function, r, coefficients);
+
+        // 2^n, built by placing the biased exponent into the exponent field of a floating-point value
+        auto exponentBits = builder.CreateShl(builder.CreateAdd(n, llvm::ConstantInt::get(intType, exponentBias)), llvm::ConstantInt::get(intType, mantissaBits));
+        auto powerOfTwo = builder.CreateBitCast(exponentBits, type);
+        return function.Operator(GetMultiplyForValueType<ValueType>(), p, powerOfTwo);
+    }
+
+    // Decomposes x = 2^e * m with m in [sqrt(2)/2, sqrt(2)) by pulling the exponent field
+    // apart, then computes log(m) = 2*atanh((m-1)/(m+1)) with a polynomial in the (small)
+    // quantity s = (m-1)/(m+1).
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType>>
+    LLVMValue VectorLog(IRFunctionEmitter& function, LLVMValue x)
+    {
+        constexpr bool isFloat = std::is_same<ValueType, float>::value;
+        constexpr int mantissaBits = isFloat ? 23 : 52;
+        constexpr int exponentBias = isFloat ? 127 : 1023;
+        constexpr double ln2 = 0.6931471805599453094;
+        constexpr double sqrt2 = 1.4142135623730950488;
+        const uint64_t mantissaMask = (uint64_t{ 1 } << mantissaBits) - 1;
+        const uint64_t oneBits = uint64_t{ exponentBias } << mantissaBits; // the bit pattern of 1.0
+
+        auto& builder = function.GetEmitter().GetIRBuilder();
+        auto type = x->getType();
+        auto intType = detail::GetMatchingIntType(type);
+
+        // Clamp below to the smallest positive normalized value so zero and negative
+        // arguments yield a large negative result rather than -inf or NaN
+        x = VectorMax<ValueType>(function, x, llvm::ConstantFP::get(type, static_cast<double>(std::numeric_limits<ValueType>::min())));
+
+        // Split off the exponent and normalize the mantissa to [1, 2)
+        auto bits = builder.CreateBitCast(x, intType);
+        auto e = builder.CreateSub(builder.CreateLShr(bits, llvm::ConstantInt::get(intType, mantissaBits)), llvm::ConstantInt::get(intType, exponentBias));
+        auto m = builder.CreateBitCast(builder.CreateOr(builder.CreateAnd(bits, llvm::ConstantInt::get(intType, mantissaMask)), llvm::ConstantInt::get(intType, oneBits)), type);
+
+        // Center the mantissa around 1 (m in [sqrt(2)/2, sqrt(2))) so the series converges quickly
+        auto adjust = function.Comparison(TypedComparison::greaterThanFloat, m, llvm::ConstantFP::get(type, sqrt2));
+        m = function.Select(adjust, function.Operator(GetMultiplyForValueType<ValueType>(), m, llvm::ConstantFP::get(type, 0.5)), m);
+        e = function.Select(adjust, builder.CreateAdd(e, llvm::ConstantInt::get(intType, 1)), e);
+        auto eFloat = builder.CreateSIToFP(e, type);
+
+        // log(m) = 2*atanh(s) = 2*s*(1 + s^2/3 + s^4/5 + ...), with s = (m-1)/(m+1), |s| < 0.172
+        auto s = function.Operator(GetDivideForValueType<ValueType>(),
+                                   function.Operator(GetSubtractForValueType<ValueType>(), m, llvm::ConstantFP::get(type, 1.0)),
+                                   function.Operator(GetAddForValueType<ValueType>(), m, llvm::ConstantFP::get(type, 1.0)));
+        auto s2 = function.Operator(GetMultiplyForValueType<ValueType>(), s, s);
+        const auto coefficients = isFloat ? std::vector<double>{ 1.0 / 9, 1.0 / 7, 1.0 / 5, 1.0 / 3, 1.0 }
+                                          : std::vector<double>{ 1.0 / 17, 1.0 / 15, 1.0 / 13, 1.0 / 11, 1.0 / 9, 1.0 / 7, 1.0 / 5, 1.0 / 3, 1.0 };
+        auto p = detail::EvaluatePolynomial<ValueType>(function, s2, coefficients);
+        auto logM = function.Operator(GetMultiplyForValueType<ValueType>(), llvm::ConstantFP::get(type, 2.0), function.Operator(GetMultiplyForValueType<ValueType>(), s, p));
+
+        // log(x) = e*ln(2) + log(m)
+        return function.Operator(GetAddForValueType<ValueType>(), function.Operator(GetMultiplyForValueType<ValueType>(), eFloat, llvm::ConstantFP::get(type, ln2)), logM);
+    }
+
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType>>
+    LLVMValue VectorTanh(IRFunctionEmitter& function, LLVMValue x)
+    {
+        // tanh(x) = 1 - 2/(e^(2x) + 1); the clamp inside VectorExp makes the tails saturate to +/-1
+        auto type = x->getType();
+        auto e2x = VectorExp<ValueType>(function, function.Operator(GetMultiplyForValueType<ValueType>(), x, llvm::ConstantFP::get(type, 2.0)));
+        auto quotient = function.Operator(GetDivideForValueType<ValueType>(), llvm::ConstantFP::get(type, 2.0), function.Operator(GetAddForValueType<ValueType>(), e2x, llvm::ConstantFP::get(type, 1.0)));
+        return function.Operator(GetSubtractForValueType<ValueType>(), llvm::ConstantFP::get(type, 1.0), quotient);
+    }
+
+    template <typename ValueType, utilities::IsFloatingPoint<ValueType>>
+    LLVMValue VectorSigmoid(IRFunctionEmitter& function, LLVMValue x)
+    {
+        // sigmoid(x) = 1/(1 + e^(-x))
+        auto type = x->getType();
+        auto expNegX = VectorExp<ValueType>(function, function.Operator(GetMultiplyForValueType<ValueType>(), x, llvm::ConstantFP::get(type, -1.0)));
+        return function.Operator(GetDivideForValueType<ValueType>(), llvm::ConstantFP::get(type, 1.0), function.Operator(GetAddForValueType<ValueType>(), expNegX, llvm::ConstantFP::get(type, 1.0)));
+    }
 } // namespace emitters
 } // namespace ell
 
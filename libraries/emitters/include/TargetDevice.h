@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace ell
@@ -25,6 +26,14 @@ namespace emitters
         std::string features = "";
         size_t numBits = 0;
 
+        /// <summary> Bitmask of the big (performance) cores on heterogeneous (big.LITTLE) devices,
+        /// where bit n corresponds to logical cpu n. Zero when unknown or homogeneous. </summary>
+        uint64_t bigCoreMask = 0;
+
+        /// <summary> Bitmask of the little (efficiency) cores on heterogeneous (big.LITTLE) devices,
+        /// where bit n corresponds to logical cpu n. Zero when unknown or homogeneous. </summary>
+        uint64_t littleCoreMask = 0;
+
         /// <summary> Helper function to test whether the TargetDevice has a particular feature </summary>
         /// <remarks> If this is filled in by LLVM for the host target, the possible features are target dependent
         /// and include, but are not limited to, the following:
@@ -47,8 +56,45 @@ namespace emitters
 
         /// <summary> Indicates if the target device is a macOS system </summary>
         bool IsMacOS() const;
+
+        /// <summary> Indicates if the target device is an x86 (32- or 64-bit) processor </summary>
+        bool IsX86() const;
+
+        /// <summary> The preferred byte alignment for buffers on this device: a cache line, or the widest
+        /// vector register if that is larger. </summary>
+        size_t GetPreferredAlignment() const;
     };
 
+    /// <summary> Performance-relevant capabilities of a target device, used to choose kernel
+    /// implementations and blocking parameters when cross-compiling for a named device.
+    /// A zero (or false) field means the capability is unknown or absent. </summary>
+    struct DeviceCapabilities
+    {
+        /// <summary> Size of the per-core L1 data cache, in bytes. </summary>
+        size_t l1DataCacheSize = 0;
+
+        /// <summary> Size of the L2 cache, in bytes. </summary>
+        size_t l2CacheSize = 0;
+
+        /// <summary> Width of the widest usable SIMD register, in bytes. </summary>
+        size_t simdRegisterBytes = 0;
+
+        /// <summary> True if the device has fused multiply-add instructions. </summary>
+        bool hasFusedMultiplyAdd = false;
+
+        /// <summary> Number of cores. </summary>
+        int numCores = 0;
+
+        /// <summary> The preferred vector width, in elements of the given size --- one full SIMD
+        /// register, or 1 when the device has no usable SIMD unit. </summary>
+        int GetVectorWidth(size_t elementSize) const { return simdRegisterBytes >= elementSize ? static_cast<int>(simdRegisterBytes / elementSize) : 1; }
+    };
+
+    /// <summary> Look up the capabilities of a target device: from a table of known cpus when the
+    /// device names one, otherwise derived from its architecture and feature string. Fields that
+    /// can't be determined are left zero. </summary>
+    DeviceCapabilities GetDeviceCapabilities(const TargetDevice& targetDevice);
+
     /// <summary> Create a TargetDevice from a device name. </summary>
     TargetDevice GetTargetDevice(std::string deviceName);
 
@@ -37,6 +37,21 @@ namespace emitters
         }
     }
 
+    std::string ToString(ThreadAffinityPolicy t)
+    {
+        switch (t)
+        {
+        case ThreadAffinityPolicy::none:
+            return "none";
+        case ThreadAffinityPolicy::bigCoresOnly:
+            return "bigCoresOnly";
+        case ThreadAffinityPolicy::littleCoresOnly:
+            return "littleCoresOnly";
+        default:
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument);
+        }
+    }
+
     /// <summary> Constructor from a property bag </summary>
     CompilerOptions::CompilerOptions(const utilities::PropertyBag& properties)
     {
@@ -61,16 +76,25 @@ namespace emitters
 
         optimize = properties.GetOrParseEntry("optimize", optimize);
         unrollLoops = properties.GetOrParseEntry("unrollLoops", unrollLoops);
+        enablePrefetch = properties.GetOrParseEntry<bool>("enablePrefetch", enablePrefetch);
+        prefetchDistance = properties.GetOrParseEntry<int>("prefetchDistance", prefetchDistance);
         inlineOperators = properties.GetOrParseEntry<bool>("inlineOperators", inlineOperators);
         allowVectorInstructions = properties.GetOrParseEntry<bool>("allowVectorInstructions", allowVectorInstructions);
         vectorWidth = properties.GetOrParseEntry<int>("vectorWidth", vectorWidth);
         useBlas = properties.GetOrParseEntry<bool>("useBlas", useBlas);
         profile = properties.GetOrParseEntry<bool>("profile", profile);
+        profileHardwareCounters = properties.GetOrParseEntry<bool>("profileHardwareCounters", profileHardwareCounters);
+        profileTelemetry = properties.GetOrParseEntry<bool>("profileTelemetry", profileTelemetry);
         includeDiagnosticInfo = properties.GetOrParseEntry<bool>("includeDiagnosticInfo", includeDiagnosticInfo);
         parallelize = properties.GetOrParseEntry<bool>("parallelize", parallelize);
         useThreadPool = properties.GetOrParseEntry<bool>("useThreadPool", useThreadPool);
+        useContinuationTasks = properties.GetOrParseEntry<bool>("useContinuationTasks", useContinuationTasks);
+        useSharedRuntime = properties.GetOrParseEntry<bool>("useSharedRuntime", useSharedRuntime);
         maxThreads = properties.GetOrParseEntry<int>("maxThreads", maxThreads);
+        threadAffinityPolicy = properties.GetOrParseEntry<ThreadAffinityPolicy>("threadAffinityPolicy", threadAffinityPolicy);
         useFastMath = properties.GetOrParseEntry<bool>("useFastMath", useFastMath);
+        approximateActivationFunctions = properties.GetOrParseEntry<bool>("approximateActivationFunctions", approximateActivationFunctions);
+        activationFunctionTolerance = properties.GetOrParseEntry<double>("activationFunctionTolerance", activationFunctionTolerance);
         debug = properties.GetOrParseEntry<bool>("debug", debug);
         globalValueAlignment = properties.GetOrParseEntry<int>("globalValueAlignment", globalValueAlignment);
         skip_ellcode = properties.GetOrParseEntry<bool>("skip_ellcode", skip_ellcode);
@@ -78,6 +102,17 @@ namespace emitters
         if (properties.HasEntry("deviceName"))
         {
             targetDevice = GetTargetDevice(properties.GetEntry<std::string>("deviceName"));
+
+            // unless it was given explicitly, size the vector units from the device's SIMD
+            // registers (in single-precision elements)
+            if (!properties.HasEntry("vectorWidth"))
+            {
+                auto capabilities = GetDeviceCapabilities(targetDevice);
+                if (capabilities.simdRegisterBytes != 0)
+                {
+                    vectorWidth = capabilities.GetVectorWidth(sizeof(float));
+                }
+            }
         }
     }
 
@@ -99,5 +134,23 @@ namespace utilities
         
         return it->second;
     }
+
+    template <>
+    emitters::ThreadAffinityPolicy FromString<emitters::ThreadAffinityPolicy>(const std::string& s)
+    {
+        // "latency" and "efficiency" are aliases describing the intent of the placement
+        static std::map<std::string, emitters::ThreadAffinityPolicy> nameMap = { { "none", emitters::ThreadAffinityPolicy::none },
+                                                                                 { "bigCoresOnly", emitters::ThreadAffinityPolicy::bigCoresOnly },
+                                                                                 { "latency", emitters::ThreadAffinityPolicy::bigCoresOnly },
+                                                                                 { "littleCoresOnly", emitters::ThreadAffinityPolicy::littleCoresOnly },
+                                                                                 { "efficiency", emitters::ThreadAffinityPolicy::littleCoresOnly } };
+        auto it = nameMap.find(s);
+        if (it == nameMap.end())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Unknown ThreadAffinityPolicy");
+        }
+
+        return it->second;
+    }
 } // namespace utilities
 } // namespace ell
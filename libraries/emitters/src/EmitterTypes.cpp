@@ -318,6 +318,8 @@ namespace emitters
             return VariableType::Int32Pointer;
         case VariableType::Int64:
             return VariableType::Int64Pointer;
+        case VariableType::Float16:
+            return VariableType::Float16Pointer;
         case VariableType::Float:
             return VariableType::FloatPointer;
         case VariableType::Double:
@@ -344,6 +346,8 @@ namespace emitters
             return VariableType::Int32;
         case VariableType::Int64Pointer:
             return VariableType::Int64;
+        case VariableType::Float16Pointer:
+            return VariableType::Float16;
         case VariableType::FloatPointer:
             return VariableType::Float;
         case VariableType::DoublePointer:
@@ -489,6 +493,7 @@ namespace emitters
         case VariableType::Int16:
         case VariableType::Int32:
         case VariableType::Int64:
+        case VariableType::Float16:
         case VariableType::Float:
         case VariableType::Double:
             return true;
@@ -18,10 +18,12 @@
 #include "IRModuleEmitter.h"
 
 #include <utilities/include/Logger.h>
+#include <utilities/include/TaskPool.h>
 
 #include <llvm/ADT/Triple.h>
 #include <llvm/Analysis/TargetLibraryInfo.h>
 
+#include <llvm/Bitcode/BitcodeReader.h>
 #include <llvm/Bitcode/BitcodeWriter.h>
 
 #include <llvm/CodeGen/MachineModuleInfo.h>
@@ -39,14 +41,22 @@
 
 #include <llvm/Pass.h>
 
+#include <llvm/Support/Error.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/TargetRegistry.h>
 #include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/ToolOutputFile.h>
 #include <llvm/Support/raw_os_ostream.h>
 
 #include <llvm/Target/TargetMachine.h>
 
+#include <llvm/Transforms/Utils/Cloning.h>
+#include <llvm/Transforms/Utils/SplitModule.h>
+
+#include <algorithm>
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -83,6 +93,133 @@ namespace emitters
             options.MCOptions.PreserveAsmComments = true; // Note: not the default
             return options;
         }
+
+        // Verify the given module, throwing if verification fails (or just logging, if the options say not to verify)
+        void VerifyModule(llvm::Module& module, const MachineCodeOutputOptions& ellOptions)
+        {
+            std::stringstream sstr;
+            llvm::raw_os_ostream out(sstr);
+            auto verifyResult = llvm::verifyModule(module, &out);
+            if (verifyResult)
+            {
+                auto errorString = sstr.str();
+                if (ellOptions.verifyModule)
+                {
+                    throw EmitterException(EmitterError::unexpected, "Module verification failed.\n\n" + errorString);
+                }
+                else
+                {
+                    Log() << "Warning: Module failed verification\n\n"
+                          << errorString << EOL;
+                }
+            }
+        }
+
+        // Run the target-specific optimization and codegen passes on the given module and write the requested
+        // output format to the stream. The module's target triple must already be set; its data layout is
+        // updated to match the target machine.
+        void EmitModuleMachineCode(llvm::Module& module, ModuleOutputFormat outputFormat, const MachineCodeOutputOptions& ellOptions, llvm::raw_ostream& os)
+        {
+            // Get the target-specific parser.
+            std::string error;
+            const llvm::Target* target = llvm::TargetRegistry::lookupTarget(module.getTargetTriple(), error);
+            if (!target)
+            {
+                throw EmitterException(EmitterError::unexpected, std::string("Couldn't create target ") + error);
+            }
+
+            llvm::TargetOptions targetOptions = MakeTargetOptions();
+            targetOptions.MCOptions.AsmVerbose = ellOptions.verboseOutput;
+            targetOptions.FloatABIType = ellOptions.floatABI;
+            targetOptions.AllowFPOpFusion = ellOptions.floatFusionMode;
+            targetOptions.UnsafeFPMath = ellOptions.unsafeFPMath ? 1 : 0;
+            targetOptions.NoInfsFPMath = ellOptions.noInfsFPMath ? 1 : 0;
+            targetOptions.NoNaNsFPMath = ellOptions.noNaNsFPMath ? 1 : 0;
+            targetOptions.NoSignedZerosFPMath = ellOptions.noSignedZerosFPMath ? 1 : 0;
+
+            OutputRelocationModel relocModel = ellOptions.relocModel;
+            llvm::CodeModel::Model codeModel = llvm::CodeModel::Small; // If this code gets run during JIT, we may have to change to medium/large
+
+            std::unique_ptr<llvm::TargetMachine> targetMachine(target->createTargetMachine(module.getTargetTriple(),
+                                                                                           ellOptions.targetDevice.cpu,
+                                                                                           ellOptions.targetDevice.features,
+                                                                                           targetOptions,
+                                                                                           relocModel,
+                                                                                           codeModel,
+                                                                                           ellOptions.optimizationLevel));
+
+            if (!targetMachine)
+            {
+                throw EmitterException(EmitterError::unexpected, "Unable to allocate target machine");
+            }
+
+            // Build up all of the passes that we want to apply to the module
+            llvm::legacy::PassManager passManager;
+
+            // Get a targetLibraryInfo describing the library functions available for this triple,
+            // and any special processing we might want to do. For instance, if we want to
+            // disable all builtin library functions, do this: `targetLibraryInfo.disableAllFunctions();`
+            llvm::TargetLibraryInfoImpl targetLibraryInfo(llvm::Triple(module.getTargetTriple()));
+
+            // ...and add it to the pass manager, so various optimizations can be done
+            passManager.add(new llvm::TargetLibraryInfoWrapperPass(targetLibraryInfo));
+
+            // Set the data layout of the module to match the target machine
+            module.setDataLayout(targetMachine->createDataLayout());
+
+            // Override function attributes based on cpu and features
+            if (!ellOptions.targetDevice.cpu.empty() || !ellOptions.targetDevice.features.empty())
+            {
+                SetFunctionAttributes(ellOptions.targetDevice.cpu, ellOptions.targetDevice.features, module);
+            }
+
+            // Set up passes to emit code to a memory stream
+            llvm::SmallVector<char, 0> buffer;
+            llvm::raw_svector_ostream bufferedStream(buffer);
+            if (IsMachineCodeFormat(outputFormat))
+            {
+                MachineCodeType fileType = MachineCodeType::CGFT_Null;
+                switch (outputFormat)
+                {
+                case ModuleOutputFormat::assembly:
+                    fileType = MachineCodeType::CGFT_AssemblyFile;
+                    break;
+                case ModuleOutputFormat::objectCode:
+                    fileType = MachineCodeType::CGFT_ObjectFile;
+                    break;
+                default:
+                    throw EmitterException(EmitterError::notSupported);
+                }
+
+                if (targetMachine->addPassesToEmitFile(passManager, bufferedStream, nullptr, fileType, ellOptions.verifyModule))
+                {
+                    throw EmitterException(EmitterError::unexpected, "target does not support generation of this file type!");
+                }
+            }
+
+            // Finally, run the passes to emit code to the straem
+            passManager.run(module); // run() returns a bool indicating if the module was modified (true if it was)
+
+            if (!IsMachineCodeFormat(outputFormat))
+            {
+                switch (outputFormat)
+                {
+                case ModuleOutputFormat::bitcode:
+                    llvm::WriteBitcodeToFile(module, os);
+                    break;
+                case ModuleOutputFormat::ir:
+                    module.print(os, nullptr);
+                    break;
+                default:
+                    throw EmitterException(EmitterError::notSupported);
+                }
+            }
+            else
+            {
+                // Write memory buffer to our output stream
+                os << buffer;
+            }
+        }
     } // namespace
 
     //
@@ -107,134 +244,102 @@ namespace emitters
     {
         llvm::Module& module = *(moduleEmitter.GetLLVMModule());
 
-        llvm::LLVMContext context;
-        context.setDiscardValueNames(false); // Don't throw away names of non-global values
-
-        std::stringstream sstr;
-        llvm::raw_os_ostream out(sstr);
-        auto verifyResult = llvm::verifyModule(module, &out);
-        if (verifyResult)
-        {
-            auto errorString = sstr.str();
-            if (ellOptions.verifyModule)
-            {
-                throw EmitterException(EmitterError::unexpected, "Module verification failed.\n\n" + errorString);
-            }
-            else
-            {
-                Log() << "Warning: Module failed verification\n\n"
-                      << errorString << EOL;
-            }
-        }
+        VerifyModule(module, ellOptions);
 
         // Set the triple for the module, and retrieve it as a Triple object
         auto targetTripleStr = ellOptions.targetDevice.triple.empty() ? llvm::sys::getDefaultTargetTriple() : ellOptions.targetDevice.triple;
         module.setTargetTriple(llvm::Triple::normalize(targetTripleStr));
 
-        // Get the target-specific parser.
-        std::string error;
-        const llvm::Target* target = llvm::TargetRegistry::lookupTarget(module.getTargetTriple(), error);
-        if (!target)
+        EmitModuleMachineCode(module, outputFormat, ellOptions, os);
+
+        if (moduleEmitter.GetDiagnosticHandler().HadError())
         {
-            throw EmitterException(EmitterError::unexpected, std::string("Couldn't create target ") + error);
+            throw EmitterException(EmitterError::unexpected, "Error compiling module");
         }
+    }
 
-        llvm::TargetOptions targetOptions = MakeTargetOptions();
-        targetOptions.MCOptions.AsmVerbose = ellOptions.verboseOutput;
-        targetOptions.FloatABIType = ellOptions.floatABI;
-        targetOptions.AllowFPOpFusion = ellOptions.floatFusionMode;
-        targetOptions.UnsafeFPMath = ellOptions.unsafeFPMath ? 1 : 0;
-        targetOptions.NoInfsFPMath = ellOptions.noInfsFPMath ? 1 : 0;
-        targetOptions.NoNaNsFPMath = ellOptions.noNaNsFPMath ? 1 : 0;
-        targetOptions.NoSignedZerosFPMath = ellOptions.noSignedZerosFPMath ? 1 : 0;
-
-        OutputRelocationModel relocModel = ellOptions.relocModel;
-        llvm::CodeModel::Model codeModel = llvm::CodeModel::Small; // If this code gets run during JIT, we may have to change to medium/large
-
-        std::unique_ptr<llvm::TargetMachine> targetMachine(target->createTargetMachine(module.getTargetTriple(),
-                                                                                       ellOptions.targetDevice.cpu,
-                                                                                       ellOptions.targetDevice.features,
-                                                                                       targetOptions,
-                                                                                       relocModel,
-                                                                                       codeModel,
-                                                                                       ellOptions.optimizationLevel));
-
-        if (!targetMachine)
+    //
+    // GenerateMachineCodeParallel
+    //
+    std::vector<std::string> GenerateMachineCodeParallel(const std::string& filePathPrefix, IRModuleEmitter& moduleEmitter, ModuleOutputFormat outputFormat, const MachineCodeOutputOptions& ellOptions, int numTasks)
+    {
+        if (!IsMachineCodeFormat(outputFormat))
         {
-            throw EmitterException(EmitterError::unexpected, "Unable to allocate target machine");
+            throw EmitterException(EmitterError::notSupported, "Parallel codegen only supports assembly and object code output");
         }
+        numTasks = std::max(numTasks, 1);
 
-        // Build up all of the passes that we want to apply to the module
-        llvm::legacy::PassManager passManager;
-
-        // Get a targetLibraryInfo describing the library functions available for this triple,
-        // and any special processing we might want to do. For instance, if we want to
-        // disable all builtin library functions, do this: `targetLibraryInfo.disableAllFunctions();`
-        llvm::TargetLibraryInfoImpl targetLibraryInfo(llvm::Triple(module.getTargetTriple()));
-
-        // ...and add it to the pass manager, so various optimizations can be done
-        passManager.add(new llvm::TargetLibraryInfoWrapperPass(targetLibraryInfo));
-
-        // Set the data layout of the module to match the target machine
-        module.setDataLayout(targetMachine->createDataLayout());
+        llvm::Module& module = *(moduleEmitter.GetLLVMModule());
+        VerifyModule(module, ellOptions);
 
-        // Override function attributes based on cpu and features
-        if (!ellOptions.targetDevice.cpu.empty() || !ellOptions.targetDevice.features.empty())
+        // Work on a clone of the module, so the codegen passes' modifications don't leak back into the emitter
+        auto clonedModule = llvm::CloneModule(module);
+        auto targetTripleStr = ellOptions.targetDevice.triple.empty() ? llvm::sys::getDefaultTargetTriple() : ellOptions.targetDevice.triple;
+        clonedModule->setTargetTriple(llvm::Triple::normalize(targetTripleStr));
+
+        // Split the module into partitions, each holding a subset of the functions with cross-partition
+        // references turned into external declarations, and serialize each partition to a bitcode buffer.
+        // The buffers get re-parsed into per-task LLVMContexts below: LLVM contexts (and the modules that
+        // live in them) can't be shared between threads.
+        std::vector<std::string> partitionBitcode;
+        llvm::SplitModule(std::move(clonedModule), numTasks, [&partitionBitcode](std::unique_ptr<llvm::Module> partition) {
+            llvm::SmallVector<char, 0> buffer;
+            llvm::raw_svector_ostream bufferedStream(buffer);
+            llvm::WriteBitcodeToFile(*partition, bufferedStream);
+            partitionBitcode.emplace_back(buffer.begin(), buffer.end());
+        },
+                          /*PreserveLocals=*/true);
+
+        const std::string extension = (ModuleOutputFormat::objectCode == outputFormat) ? ".o" : ".s";
+        std::vector<std::string> filenames;
+        for (size_t index = 0; index < partitionBitcode.size(); ++index)
         {
-            SetFunctionAttributes(ellOptions.targetDevice.cpu, ellOptions.targetDevice.features, module);
+            filenames.push_back(filePathPrefix + "." + std::to_string(index) + extension);
         }
 
-        // Set up passes to emit code to a memory stream
-        llvm::SmallVector<char, 0> buffer;
-        llvm::raw_svector_ostream bufferedStream(buffer);
-        if (IsMachineCodeFormat(outputFormat))
+        auto& taskPool = utilities::TaskPool::GetDefault();
+        std::vector<std::future<void>> futures;
+        for (size_t index = 0; index < partitionBitcode.size(); ++index)
         {
-            MachineCodeType fileType = MachineCodeType::CGFT_Null;
-            switch (outputFormat)
-            {
-            case ModuleOutputFormat::assembly:
-                fileType = MachineCodeType::CGFT_AssemblyFile;
-                break;
-            case ModuleOutputFormat::objectCode:
-                fileType = MachineCodeType::CGFT_ObjectFile;
-                break;
-            default:
-                throw EmitterException(EmitterError::notSupported);
-            }
+            futures.push_back(taskPool.Submit([&partitionBitcode, &filenames, &ellOptions, outputFormat, index]() {
+                llvm::LLVMContext context;
+                context.setDiscardValueNames(false); // Don't throw away names of non-global values
 
-            if (targetMachine->addPassesToEmitFile(passManager, bufferedStream, nullptr, fileType, ellOptions.verifyModule))
-            {
-                throw EmitterException(EmitterError::unexpected, "target does not support generation of this file type!");
-            }
-        }
+                auto buffer = llvm::MemoryBuffer::getMemBuffer(partitionBitcode[index], "", false);
+                auto partition = llvm::parseBitcodeFile(buffer->getMemBufferRef(), context);
+                if (!partition)
+                {
+                    throw EmitterException(EmitterError::unexpected, "Error parsing module partition bitcode: " + llvm::toString(partition.takeError()));
+                }
 
-        // Finally, run the passes to emit code to the straem
-        passManager.run(module); // run() returns a bool indicating if the module was modified (true if it was)
+                std::error_code error;
+                llvm::ToolOutputFile out(filenames[index], error, llvm::sys::fs::F_None);
+                if (error)
+                {
+                    throw LLVMException(error);
+                }
 
-        if (!IsMachineCodeFormat(outputFormat))
-        {
-            switch (outputFormat)
-            {
-            case ModuleOutputFormat::bitcode:
-                llvm::WriteBitcodeToFile(module, os);
-                break;
-            case ModuleOutputFormat::ir:
-                module.print(os, nullptr);
-                break;
-            default:
-                throw EmitterException(EmitterError::notSupported);
-            }
+                EmitModuleMachineCode(**partition, outputFormat, ellOptions, out.os());
+
+                if (out.os().has_error())
+                {
+                    throw EmitterException(EmitterError::writeStreamFailed);
+                }
+                out.keep();
+            }));
         }
-        else
+
+        // Wait for the codegen tasks, re-throwing any exception they raised
+        for (auto& future : futures)
         {
-            // Write memory buffer to our output stream
-            os << buffer;
+            future.get();
         }
 
         if (moduleEmitter.GetDiagnosticHandler().HadError())
         {
             throw EmitterException(EmitterError::unexpected, "Error compiling module");
         }
+        return filenames;
     }
 } // namespace emitters
 } // namespace ell
@@ -17,13 +17,106 @@ namespace ell
 {
 namespace emitters
 {
+    namespace
+    {
+        // The continuation mode backs tasks with a module-level queue of pending one-shot
+        // continuations: parallel arrays of wrapped task function pointers, argument structs,
+        // and return-value slots, plus a count. Spawning a task appends an entry (or runs it
+        // on the spot if the queue is full), and waiting runs every pending entry to
+        // completion in a single scheduler loop on the waiting thread. The emitted task
+        // bodies have no suspension points, so each continuation is resumed exactly once.
+        // The queue is not thread-safe: it assumes the single-caller model the rest of the
+        // emitted global state (e.g. the port buffers) already requires.
+        const int continuationQueueCapacity = 64;
+
+        void EmitContinuationSchedulerFunctions(IRModuleEmitter& module)
+        {
+            auto enqueueFunctionName = module.GetModuleName() + "_EnqueueContinuation";
+            if (module.HasFunction(enqueueFunctionName))
+            {
+                return;
+            }
+
+            auto& context = module.GetLLVMContext();
+            auto int8PtrType = llvm::Type::getInt8PtrTy(context);
+            auto int8PtrPtrType = int8PtrType->getPointerTo();
+            auto voidType = module.GetIREmitter().Type(VariableType::Void);
+            auto taskFunctionType = llvm::FunctionType::get(int8PtrType, { int8PtrType }, false);
+
+            auto functionsQueue = module.GlobalArray(module.GetModuleName() + "_continuationFunctions", int8PtrType, continuationQueueCapacity);
+            auto argumentsQueue = module.GlobalArray(module.GetModuleName() + "_continuationArguments", int8PtrType, continuationQueueCapacity);
+            auto resultsQueue = module.GlobalArray(module.GetModuleName() + "_continuationResults", int8PtrPtrType, continuationQueueCapacity);
+            auto countGlobal = module.Global(VariableType::Int32, module.GetModuleName() + "_continuationCount");
+
+            // Record a wrapped task to run later; if the queue is full, run it on the spot
+            {
+                auto function = module.BeginFunction(enqueueFunctionName, voidType, NamedLLVMTypeList{ { "taskFunction", int8PtrType }, { "arguments", int8PtrType }, { "result", int8PtrPtrType } });
+                auto arguments = function.Arguments().begin();
+                auto taskFunction = &(*arguments++);
+                auto taskArguments = &(*arguments++);
+                auto taskResult = &(*arguments);
+
+                auto count = function.Load(countGlobal);
+                auto hasRoom = function.Comparison(TypedComparison::lessThan, count, function.Literal(continuationQueueCapacity));
+                function.If(hasRoom, [&](IRFunctionEmitter& fn) {
+                      fn.Store(fn.PointerOffset(functionsQueue, count), taskFunction);
+                      fn.Store(fn.PointerOffset(argumentsQueue, count), taskArguments);
+                      fn.Store(fn.PointerOffset(resultsQueue, count), taskResult);
+                      fn.Store(countGlobal, fn.Operator(TypedOperator::add, count, fn.Literal(1)));
+                  })
+                    .Else([&](IRFunctionEmitter& fn) {
+                        auto functionPtr = fn.BitCast(taskFunction, taskFunctionType->getPointerTo());
+                        auto& irBuilder = fn.GetEmitter().GetIRBuilder();
+                        auto returnValue = irBuilder.CreateCall(taskFunctionType, functionPtr, { taskArguments });
+                        fn.Store(taskResult, returnValue);
+                    });
+                function.Return();
+                module.EndFunction();
+            }
+
+            // The scheduler loop: pop and run pending continuations until the queue is empty
+            {
+                auto function = module.BeginFunction(module.GetModuleName() + "_RunPendingContinuations", voidType);
+                function.While([countGlobal](IRFunctionEmitter& fn) {
+                    return fn.Comparison(TypedComparison::greaterThan, fn.Load(countGlobal), fn.Literal(0));
+                },
+                               [&](IRFunctionEmitter& fn) {
+                                   auto index = fn.Operator(TypedOperator::subtract, fn.Load(countGlobal), fn.Literal(1));
+                                   fn.Store(countGlobal, index);
+                                   auto taskFunction = fn.Load(fn.PointerOffset(functionsQueue, index));
+                                   auto taskArguments = fn.Load(fn.PointerOffset(argumentsQueue, index));
+                                   auto taskResult = fn.Load(fn.PointerOffset(resultsQueue, index));
+                                   auto functionPtr = fn.BitCast(taskFunction, taskFunctionType->getPointerTo());
+                                   auto& irBuilder = fn.GetEmitter().GetIRBuilder();
+                                   auto returnValue = irBuilder.CreateCall(taskFunctionType, functionPtr, { taskArguments });
+                                   fn.Store(taskResult, returnValue);
+                               });
+                function.Return();
+                module.EndFunction();
+            }
+        }
+
+        LLVMFunction GetContinuationEnqueueFunction(IRModuleEmitter& module)
+        {
+            EmitContinuationSchedulerFunctions(module);
+            return module.GetFunction(module.GetModuleName() + "_EnqueueContinuation");
+        }
+
+        LLVMFunction GetContinuationSchedulerFunction(IRModuleEmitter& module)
+        {
+            EmitContinuationSchedulerFunctions(module);
+            return module.GetFunction(module.GetModuleName() + "_RunPendingContinuations");
+        }
+    } // namespace
+
     IRAsyncTask::IRAsyncTask(IRFunctionEmitter& owningFunction, LLVMFunction taskFunction, const std::vector<LLVMValue>& arguments) :
         _taskFunction(taskFunction),
         _arguments(arguments)
     {
         const auto& compilerParameters = owningFunction.GetModule().GetCompilerOptions();
-        _usePthreads = compilerParameters.parallelize && !compilerParameters.targetDevice.IsWindows();
-        if (UsePthreads())
+        _useContinuations = compilerParameters.parallelize && compilerParameters.useContinuationTasks;
+        _usePthreads = compilerParameters.parallelize && !compilerParameters.useContinuationTasks && !compilerParameters.targetDevice.IsWindows();
+        if (UsePthreads() || UseContinuations())
         {
             Run(owningFunction);
         }
@@ -58,6 +151,20 @@ namespace emitters
             auto errCode = function.PthreadCreate(_pthread, nullAttr, pthreadWrapperFunction, function.CastPointer(taskArg, int8PtrType));
             UNUSED(errCode);
         }
+        else if (UseContinuations())
+        {
+            // Package the arguments the same way as the pthread path, but queue the wrapped
+            // task for the scheduler loop instead of spawning a thread. The argument struct
+            // and result slot are stack variables, so the task must be waited on (and thereby
+            // run) within this function -- the same lifetime the pthread path requires.
+            auto taskArgType = GetTaskArgStructType(module, _taskFunction);
+            auto taskArg = function.Variable(taskArgType, "taskArg");
+            function.FillStruct(taskArg, _arguments);
+            _resultSlot = function.Variable(int8PtrType, "taskResult");
+            auto wrapperFunction = GetTaskWrapperFunction(module, _taskFunction);
+            auto enqueueFunction = GetContinuationEnqueueFunction(module);
+            function.Call(enqueueFunction, { function.CastPointer(wrapperFunction, int8PtrType), function.CastPointer(taskArg, int8PtrType), _resultSlot });
+        }
         else
         {
             _returnValue = function.Call(_taskFunction, _arguments);
@@ -75,6 +182,14 @@ namespace emitters
             UNUSED(errCode);
             _returnValue = functionEmitter.Load(returnValuePtr);
         }
+        else if (UseContinuations())
+        {
+            // Run every pending continuation to completion on this thread; this task is among
+            // them, unless it already ran because the queue overflowed or an earlier wait
+            // drained it
+            functionEmitter.Call(GetContinuationSchedulerFunction(functionEmitter.GetModule()), IRValueList{});
+            _returnValue = functionEmitter.Load(_resultSlot);
+        }
         else
         {
             Run(functionEmitter);
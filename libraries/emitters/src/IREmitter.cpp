@@ -14,6 +14,7 @@
 #include <utilities/include/Logger.h>
 
 #include <llvm/IR/InstrTypes.h>
+#include <llvm/IR/Metadata.h>
 #include <llvm/Support/raw_os_ostream.h>
 
 #include <algorithm>
@@ -121,6 +122,12 @@ namespace emitters
             return GetBaseVariableType(VariableType::Int64)->getPointerTo();
         case VariableType::Int64PointerPointer:
             return GetBaseVariableType(VariableType::Int64)->getPointerTo()->getPointerTo();
+        case VariableType::Float16:
+            return GetBaseVariableType(type);
+        case VariableType::Float16Pointer:
+            return GetBaseVariableType(VariableType::Float16)->getPointerTo();
+        case VariableType::Float16PointerPointer:
+            return GetBaseVariableType(VariableType::Float16)->getPointerTo()->getPointerTo();
         case VariableType::Float:
             return GetBaseVariableType(type);
         case VariableType::FloatPointer:
@@ -273,6 +280,7 @@ namespace emitters
         case VariableType::Int32:
         case VariableType::Int64:
             return Integer(type, 0);
+        case VariableType::Float16:
         case VariableType::Float:
         case VariableType::Double:
             return Literal(0.0);
@@ -1022,7 +1030,13 @@ namespace emitters
     {
         assert(pPointer != nullptr);
         assert(pValue != nullptr);
-        return _irBuilder.CreateStore(pValue, pPointer);
+        auto store = _irBuilder.CreateStore(pValue, pPointer);
+        if (_nonTemporalStores)
+        {
+            auto metadata = llvm::MDNode::get(_llvmContext, llvm::ConstantAsMetadata::get(_irBuilder.getInt32(1)));
+            store->setMetadata(llvm::LLVMContext::MD_nontemporal, metadata);
+        }
+        return store;
     }
 
     llvm::AllocaInst* IREmitter::StackAllocate(VariableType type)
@@ -1157,6 +1171,8 @@ namespace emitters
             return _irBuilder.getInt32Ty();
         case VariableType::Int64:
             return _irBuilder.getInt64Ty();
+        case VariableType::Float16:
+            return _irBuilder.getHalfTy();
         case VariableType::Float:
             return _irBuilder.getFloatTy();
         case VariableType::Double:
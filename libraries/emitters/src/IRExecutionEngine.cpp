@@ -8,6 +8,7 @@
 
 #include "IRExecutionEngine.h"
 #include "IRModuleEmitter.h"
+#include "IRObjectCache.h"
 
 #include <utilities/include/TypeAliases.h>
 
@@ -151,12 +152,25 @@ namespace emitters
         mainFunction();
     }
 
+    void IRExecutionEngine::SetObjectCacheDirectory(const std::string& cacheDirectory)
+    {
+        if (_pEngine)
+        {
+            throw EmitterException(EmitterError::badFunctionArguments, "SetObjectCacheDirectory must be called before the first function lookup");
+        }
+        _objectCache = std::make_unique<IRObjectCache>(cacheDirectory);
+    }
+
     void IRExecutionEngine::EnsureEngine()
     {
         if (!_pEngine)
         {
             auto pEngine = _pBuilder->create();
             _pEngine.reset(pEngine);
+            if (_objectCache)
+            {
+                _pEngine->setObjectCache(_objectCache.get());
+            }
             PerformInitialization();
         }
     }
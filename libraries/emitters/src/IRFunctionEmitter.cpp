@@ -126,6 +126,8 @@ namespace emitters
                 return llvm::Attribute::get(context, llvm::Attribute::AttrKind::NoAlias);
             case IRFunctionEmitter::Attributes::Dereferenceable:
                 return llvm::Attribute::getWithDereferenceableBytes(context, std::any_cast<uint64_t>(extra));
+            case IRFunctionEmitter::Attributes::Alignment:
+                return llvm::Attribute::getWithAlignment(context, std::any_cast<uint64_t>(extra));
             }
         }
     } // namespace
@@ -787,6 +789,18 @@ namespace emitters
         return result;
     }
 
+    llvm::AllocaInst* IRFunctionEmitter::EmittedVariable(VariableType type, int size, const std::string& name)
+    {
+        auto result = ExecuteInEntryBlock([this, type, size, &name] {
+            auto variable = GetEmitter().StackAllocate(type, static_cast<size_t>(size));
+            variable->setName(name);
+            return variable;
+        });
+
+        _locals.Add(name, result);
+        return result;
+    }
+
     llvm::AllocaInst* IRFunctionEmitter::Variable(VariableType type, int size)
     {
         return ExecuteInEntryBlock([this, type, size] {
@@ -1123,6 +1137,27 @@ namespace emitters
         loop.End();
     }
 
+    void IRFunctionEmitter::For(int count, const LoopUnrollInfo& unrollInfo, std::function<void(IRFunctionEmitter&, IRLocalScalar)> body)
+    {
+        if (count < 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "For loop count must be >= 0");
+        }
+        For(std::string{}, 0, count, 1, unrollInfo, body);
+    }
+
+    void IRFunctionEmitter::For(const std::string& tag, int beginValue, int endValue, int increment, const LoopUnrollInfo& unrollInfo, std::function<void(IRFunctionEmitter&, IRLocalScalar)> body)
+    {
+        if (endValue < beginValue)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "For loop begin must be <= end");
+        }
+        auto loop = IRForLoopEmitter(*this, tag, unrollInfo);
+        loop.Begin(beginValue, endValue, increment);
+        body(*this, LocalScalar(loop.LoadIterationVariable()));
+        loop.End();
+    }
+
     //
     // Extended for loops
     //
@@ -1357,7 +1392,7 @@ namespace emitters
     IRTaskArray IRFunctionEmitter::StartTasks(LLVMFunction taskFunction, const std::vector<std::vector<LLVMValue>>& arguments)
     {
         auto compilerSettings = GetCompilerOptions();
-        if (compilerSettings.parallelize && compilerSettings.useThreadPool && !compilerSettings.targetDevice.IsWindows())
+        if (compilerSettings.parallelize && compilerSettings.useThreadPool && !compilerSettings.useContinuationTasks && !compilerSettings.targetDevice.IsWindows())
         {
             auto& threadPool = GetModule().GetThreadPool();
             return threadPool.AddTasks(*this, taskFunction, arguments);
@@ -1398,6 +1433,23 @@ namespace emitters
         Call(FreeFnName, CastPointer(pValue, VariableType::BytePointer));
     }
 
+    void IRFunctionEmitter::Prefetch(LLVMValue pPointer, int offset)
+    {
+        Prefetch(pPointer, Literal(offset));
+    }
+
+    void IRFunctionEmitter::Prefetch(LLVMValue pPointer, LLVMValue pOffset)
+    {
+        if (!GetCompilerOptions().enablePrefetch)
+        {
+            return;
+        }
+        auto prefetchFunction = GetModule().GetRuntime().GetPrefetchFunction();
+        auto address = CastPointer(PointerOffset(pPointer, pOffset), VariableType::BytePointer);
+        // llvm.prefetch(address, rw = read, locality = keep in all cache levels, cache type = data)
+        Call(prefetchFunction, { address, Literal(0), Literal(3), Literal(1) });
+    }
+
     LLVMValue IRFunctionEmitter::Print(const std::string& text)
     {
         return Printf({ Literal(text) });
@@ -1800,6 +1852,18 @@ namespace emitters
         _options = options;
     }
 
+    void IRFunctionEmitter::SetFastMathFlags(bool allowFastMath)
+    {
+        // The flags apply to floating-point operations emitted from here on, until they're changed again
+        llvm::FastMathFlags flags;
+        if (allowFastMath)
+        {
+            flags.setAllowContract(true);
+            flags.setAllowReassoc();
+        }
+        GetEmitter().GetIRBuilder().setFastMathFlags(flags);
+    }
+
     llvm::LLVMContext& IRFunctionEmitter::GetLLVMContext()
     {
         return _pModuleEmitter->GetLLVMContext();
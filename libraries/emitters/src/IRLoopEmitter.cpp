@@ -44,12 +44,31 @@ namespace emitters
         {
             return { llvm::MDString::get(context, "llvm.loop.disable_nonforced") };
         }
+
+        std::array<llvm::Metadata*, 1> GenerateFullUnrollMetadata(llvm::LLVMContext& context)
+        {
+            return { llvm::MDString::get(context, "llvm.loop.unroll.full") };
+        }
+
+        std::array<llvm::Metadata*, 2> GenerateUnrollAndJamMetadata(llvm::LLVMContext& context)
+        {
+            return { llvm::MDString::get(context, "llvm.loop.unroll_and_jam.enable"),
+                     llvm::ConstantAsMetadata::get(llvm::ConstantInt::get(
+                         llvm::Type::getInt1Ty(context), true)) };
+        }
+
+        std::array<llvm::Metadata*, 2> GenerateUnrollCountMetadata(llvm::LLVMContext& context, const char* name, int count)
+        {
+            return { llvm::MDString::get(context, name),
+                     llvm::ConstantAsMetadata::get(llvm::ConstantInt::get(
+                         llvm::Type::getInt32Ty(context), count)) };
+        }
     } // namespace
 
     IRLoopEmitter::IRLoopEmitter(IRFunctionEmitter& functionEmitter) :
         _functionEmitter(functionEmitter) {}
 
-    void IRLoopEmitter::AddLoopMetadata(llvm::BranchInst* branch, bool unroll, bool vectorize)
+    void IRLoopEmitter::AddLoopMetadata(llvm::BranchInst* branch, bool unroll, bool vectorize, const LoopUnrollInfo& unrollInfo, int tripCount)
     {
         // Add metadata
         auto& context = _functionEmitter.GetEmitter().GetContext();
@@ -59,7 +78,29 @@ namespace emitters
         auto tempNode = llvm::MDNode::getTemporary(context, {});
         metadataElements.push_back(tempNode.get());
 
-        if (vectorize)
+        const bool fullUnroll = unrollInfo.fullUnrollBelow > 0 && tripCount >= 0 && tripCount <= unrollInfo.fullUnrollBelow;
+        const bool hasUnrollDirective = fullUnroll || unrollInfo.unrollFactor > 0 || unrollInfo.unrollAndJam;
+        if (hasUnrollDirective)
+        {
+            // An explicit schedule from the loop's author overrides the default hints
+            if (fullUnroll)
+            {
+                metadataElements.push_back(llvm::MDNode::get(context, GenerateFullUnrollMetadata(context)));
+            }
+            else if (unrollInfo.unrollAndJam)
+            {
+                metadataElements.push_back(llvm::MDNode::get(context, GenerateUnrollAndJamMetadata(context)));
+                if (unrollInfo.unrollFactor > 0)
+                {
+                    metadataElements.push_back(llvm::MDNode::get(context, GenerateUnrollCountMetadata(context, "llvm.loop.unroll_and_jam.count", unrollInfo.unrollFactor)));
+                }
+            }
+            else
+            {
+                metadataElements.push_back(llvm::MDNode::get(context, GenerateUnrollCountMetadata(context, "llvm.loop.unroll.count", unrollInfo.unrollFactor)));
+            }
+        }
+        else if (vectorize)
         {
             metadataElements.push_back(llvm::MDNode::get(context, GenerateVectorizeMetadata(context)));
             if (unroll)
@@ -72,7 +113,7 @@ namespace emitters
             metadataElements.push_back(llvm::MDNode::get(context, GenerateUnrollMetadata(context)));
         }
 
-        if (unroll || vectorize)
+        if (unroll || vectorize || hasUnrollDirective)
         {
             metadataElements.push_back(llvm::MDNode::get(context, GenerateDisableNonforcedMetadata(context)));
         }
@@ -91,9 +132,10 @@ namespace emitters
     // _pAfterBlock -- branch to this block when done
     //
 
-    IRForLoopEmitter::IRForLoopEmitter(IRFunctionEmitter& functionEmitter, const std::string& tag) :
+    IRForLoopEmitter::IRForLoopEmitter(IRFunctionEmitter& functionEmitter, const std::string& tag, const LoopUnrollInfo& unrollInfo) :
         IRLoopEmitter(functionEmitter),
-        _tag(tag)
+        _tag(tag),
+        _unrollInfo(unrollInfo)
     {}
 
     void IRForLoopEmitter::CreateBlocks()
@@ -112,6 +154,10 @@ namespace emitters
 
     llvm::BasicBlock* IRForLoopEmitter::Begin(int iStartAt, int iMaxValue, int stepSize)
     {
+        if (stepSize > 0 && iMaxValue >= iStartAt)
+        {
+            _tripCount = (iMaxValue - iStartAt + stepSize - 1) / stepSize;
+        }
         return Begin(_functionEmitter.Literal(iStartAt), _functionEmitter.Literal(iMaxValue), _functionEmitter.Literal(stepSize));
     }
 
@@ -157,7 +203,7 @@ namespace emitters
 
         bool unroll = false;
         bool vectorize = true;
-        AddLoopMetadata(branchInst, unroll, vectorize);
+        AddLoopMetadata(branchInst, unroll, vectorize, _unrollInfo, _tripCount);
     }
 
     void IRForLoopEmitter::EmitIncrement(LLVMValue pIncrementValue)
@@ -61,6 +61,8 @@ namespace emitters
             DeclarePrintf();
         }
 
+        _profiler->SetHardwareCountersEnabled(parameters.profileHardwareCounters);
+        _profiler->SetTelemetryEnabled(parameters.profileTelemetry);
         _profiler->Init();
     }
 
@@ -127,6 +129,23 @@ namespace emitters
         return function;
     }
 
+    void IRModuleEmitter::RegisterModelStateVariable(llvm::GlobalVariable* stateVariable)
+    {
+        if (stateVariable == nullptr)
+        {
+            throw EmitterException(EmitterError::badFunctionArguments, "RegisterModelStateVariable requires an emitted global variable");
+        }
+        if (std::find(_modelStateVariables.begin(), _modelStateVariables.end(), stateVariable) == _modelStateVariables.end())
+        {
+            _modelStateVariables.push_back(stateVariable);
+        }
+    }
+
+    void IRModuleEmitter::RegisterModelStateVariable(LLVMValue stateVariable)
+    {
+        RegisterModelStateVariable(llvm::dyn_cast_or_null<llvm::GlobalVariable>(stateVariable));
+    }
+
     IRFunctionEmitter& IRModuleEmitter::BeginFunction(const std::string& functionName, VariableType returnType)
     {
         _functions[functionName] = FunctionDeclaration(functionName, returnType);
@@ -481,17 +500,36 @@ namespace emitters
     // This function has the actual implementation for all the above Global/GlobalArray() methods
     llvm::GlobalVariable* IRModuleEmitter::AddGlobal(const std::string& name, LLVMType pType, llvm::Constant* pInitial, bool isConst, bool isThreadLocal)
     {
+        if (_poolConstantData && isConst && pInitial != nullptr)
+        {
+            auto existing = _constantDataPool.find(pInitial);
+            if (existing != _constantDataPool.end() && existing->second->getValueType() == pType)
+            {
+                return existing->second;
+            }
+        }
+
         CompilerOptions options = GetCompilerOptions();
         _llvmModule->getOrInsertGlobal(name, pType);
         auto global = _llvmModule->getNamedGlobal(name);
-        global->setAlignment(options.globalValueAlignment);
+
+        // Align to at least a cache line / the widest vector register, so vector loads and stores on the
+        // buffer don't have to assume it's unaligned
+        auto alignment = std::max(static_cast<size_t>(options.globalValueAlignment), options.targetDevice.GetPreferredAlignment());
+        global->setAlignment(static_cast<unsigned>(alignment));
         global->setInitializer(pInitial);
         global->setConstant(isConst);
         global->setExternallyInitialized(false);
         global->setLinkage(llvm::GlobalValue::LinkageTypes::InternalLinkage);
         global->setThreadLocal(isThreadLocal);
         assert(llvm::isa<llvm::GlobalVariable>(global));
-        return llvm::cast<llvm::GlobalVariable>(global);
+        auto result = llvm::cast<llvm::GlobalVariable>(global);
+
+        if (_poolConstantData && isConst && pInitial != nullptr)
+        {
+            _constantDataPool[pInitial] = result;
+        }
+        return result;
     }
 
     //
@@ -800,6 +838,29 @@ namespace emitters
         out.keep();
     }
 
+    std::vector<std::string> IRModuleEmitter::WriteToFiles(const std::string& filePathPrefix, ModuleOutputFormat format, int numTasks)
+    {
+        auto options = GetMachineCodeOutputOptions();
+        const auto& params = GetCompilerOptions();
+
+        if (options.targetDevice.triple.empty())
+        {
+            options.targetDevice.triple = params.targetDevice.triple;
+        }
+
+        if (options.targetDevice.cpu.empty())
+        {
+            options.targetDevice.cpu = params.targetDevice.cpu;
+        }
+
+        if (options.targetDevice.features.empty())
+        {
+            options.targetDevice.features = params.targetDevice.features;
+        }
+
+        return GenerateMachineCodeParallel(filePathPrefix, *this, format, options, numTasks);
+    }
+
     void IRModuleEmitter::WriteToStream(std::ostream& stream, ModuleOutputFormat format)
     {
         auto options = GetMachineCodeOutputOptions();
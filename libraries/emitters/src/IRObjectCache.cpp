@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     IRObjectCache.cpp (emitters)
+//  Authors:  Umesh Madan
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "IRObjectCache.h"
+
+#include <utilities/include/Files.h>
+
+#include <llvm/IR/Module.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/raw_ostream.h>
+
+namespace ell
+{
+namespace emitters
+{
+    IRObjectCache::IRObjectCache(const std::string& cacheDirectory) :
+        _cacheDirectory(cacheDirectory)
+    {
+        utilities::EnsureDirectoryExists(_cacheDirectory);
+    }
+
+    void IRObjectCache::notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef objectBuffer)
+    {
+        auto path = GetCacheFilePath(module);
+        std::error_code error;
+        llvm::raw_fd_ostream stream(path, error, llvm::sys::fs::F_None);
+        if (!error)
+        {
+            stream.write(objectBuffer.getBufferStart(), objectBuffer.getBufferSize());
+        }
+        // A failure to write just means the next load pays full codegen again.
+    }
+
+    std::unique_ptr<llvm::MemoryBuffer> IRObjectCache::getObject(const llvm::Module* module)
+    {
+        auto path = GetCacheFilePath(module);
+        auto buffer = llvm::MemoryBuffer::getFile(path);
+        if (!buffer)
+        {
+            return nullptr;
+        }
+        return std::move(buffer.get());
+    }
+
+    std::string IRObjectCache::GetCacheFilePath(const llvm::Module* module) const
+    {
+        // Key the cache on the module IR and the target triple, so a change to either the model
+        // or the target invalidates the entry.
+        std::string moduleText;
+        llvm::raw_string_ostream textStream(moduleText);
+        module->print(textStream, nullptr);
+        textStream.flush();
+
+        llvm::MD5 hasher;
+        hasher.update(moduleText);
+        hasher.update(module->getTargetTriple());
+        llvm::MD5::MD5Result result;
+        hasher.final(result);
+
+        return utilities::JoinPaths(_cacheDirectory, result.digest().str().str() + ".o");
+    }
+} // namespace emitters
+} // namespace ell
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "IROptimizer.h"
+#include "IRMetadata.h"
 #include "IRModuleEmitter.h"
 #include "LLVMInclude.h"
 
@@ -17,9 +18,12 @@
 #include <llvm/IR/Module.h>
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/Transforms/IPO.h>
+#include <llvm/Transforms/IPO/AlwaysInliner.h>
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
+#include <llvm/Transforms/InstCombine/InstCombine.h>
 #include <llvm/Transforms/Scalar.h>
 #include <llvm/Transforms/Scalar/GVN.h>
+#include <llvm/Transforms/Vectorize.h>
 
 #include <memory>
 
@@ -79,6 +83,38 @@ namespace emitters
 
         builder.populateFunctionPassManager(_functionPasses);
         builder.populateModulePassManager(_modulePasses);
+
+        // The unroll-and-jam pass isn't part of the default pipeline; add it so loops emitted with an
+        // explicit unroll-and-jam directive (see LoopUnrollInfo) actually get transformed
+        _modulePasses.add(llvm::createLoopUnrollAndJamPass(builder.OptLevel));
+    }
+
+    void IROptimizer::AddRuntimeInliningPasses(int maxHelperInstructionCount)
+    {
+        // Mark the small runtime helpers always-inline so the inliner folds them into their callers,
+        // instead of leaving calls that block vectorization of the surrounding loops
+        for (const auto& helper : GetFunctionsWithTag(_module, c_runtimeHelperFunctionTagName))
+        {
+            auto function = helper.function;
+            if (function->isDeclaration() || function->hasFnAttribute(llvm::Attribute::NoInline))
+            {
+                continue;
+            }
+            if (static_cast<int>(function->getInstructionCount()) <= maxHelperInstructionCount)
+            {
+                function->addFnAttr(llvm::Attribute::AlwaysInline);
+            }
+        }
+        _modulePasses.add(llvm::createAlwaysInlinerLegacyPass());
+
+        // Re-run the loop optimization and vectorization passes over the merged code
+        _modulePasses.add(llvm::createInstructionCombiningPass());
+        _modulePasses.add(llvm::createLoopRotatePass());
+        _modulePasses.add(llvm::createLICMPass());
+        _modulePasses.add(llvm::createLoopVectorizePass());
+        _modulePasses.add(llvm::createSLPVectorizerPass());
+        _modulePasses.add(llvm::createInstructionCombiningPass());
+        _modulePasses.add(llvm::createCFGSimplificationPass());
     }
 
     void IROptimizer::BeginOptimizeFunctions()
@@ -12,12 +12,20 @@
 #include "IRMath.h"
 #include "IRModuleEmitter.h"
 
+#include <algorithm>
 #include <vector>
 
 namespace ell
 {
 namespace emitters
 {
+    namespace
+    {
+        // Minimum number of loop iterations a task gets by default --- tasks smaller than this
+        // tend to lose their speedup to task-dispatch overhead.
+        constexpr int defaultMinIterationsPerTask = 4;
+    } // namespace
+
     IRParallelForLoopEmitter::IRParallelForLoopEmitter(IRFunctionEmitter& functionEmitter) :
         _functionEmitter(functionEmitter) {}
 
@@ -29,9 +37,17 @@ namespace emitters
 
         auto compilerSettings = _functionEmitter.GetCompilerOptions();
         ParallelLoopOptions newOptions = options;
+        if (newOptions.minIterationsPerTask == 0)
+        {
+            newOptions.minIterationsPerTask = defaultMinIterationsPerTask;
+        }
         if (newOptions.numTasks == 0)
         {
-            newOptions.numTasks = std::min(numIterations, compilerSettings.maxThreads);
+            // Static partitioning: one contiguous block of iterations per worker, but never break
+            // the loop into tasks smaller than the grain size --- small loops get fewer tasks, and
+            // a loop that only merits one task is emitted as an ordinary serial loop instead
+            auto maxUsefulTasks = std::max(numIterations / newOptions.minIterationsPerTask, 1);
+            newOptions.numTasks = std::min(std::min(numIterations, maxUsefulTasks), compilerSettings.maxThreads);
         }
         EmitLoop(_functionEmitter.LocalScalar<int32_t>(begin), _functionEmitter.LocalScalar<int32_t>(end), _functionEmitter.LocalScalar<int32_t>(increment), newOptions, capturedValues, body);
     }
@@ -80,6 +80,81 @@ namespace emitters
         return GetTimespecType()->getPointerTo();
     }
 
+    //
+    // perf_event performance counters
+    //
+    bool IRPosixRuntime::IsPerfEventAvailable() const
+    {
+        // perf_event is a Linux-only kernel API
+        return _module.GetCompilerOptions().targetDevice.IsLinux();
+    }
+
+    llvm::StructType* IRPosixRuntime::GetPerfEventAttrType()
+    {
+        if (_perfEventAttrType != nullptr)
+        {
+            return _perfEventAttrType;
+        }
+
+        auto& context = _module.GetLLVMContext();
+        auto int32Type = llvm::Type::getInt32Ty(context);
+        auto int64Type = llvm::Type::getInt64Ty(context);
+
+        // The original (PERF_ATTR_SIZE_VER0) layout of perf_event_attr --- 64 bytes in total. The
+        // fields past `config` are only broken out far enough to reach the flags bitfield:
+        // { u32 type, u32 size, u64 config, u64 sample_period, u64 sample_type, u64 read_format,
+        //   u64 flags, u32 wakeup_events + u32 bp_type, u64 bp_addr }
+        _perfEventAttrType = llvm::StructType::create(context, { int32Type, int32Type, int64Type, int64Type, int64Type, int64Type, int64Type, int64Type, int64Type }, "perf_event_attr");
+        return _perfEventAttrType;
+    }
+
+    int IRPosixRuntime::GetPerfEventOpenSyscallNumber() const
+    {
+        auto targetDevice = _module.GetCompilerOptions().targetDevice;
+        assert(targetDevice.IsLinux() && "perf_event only available on Linux");
+
+        auto triple = targetDevice.triple.empty() ? llvm::sys::getDefaultTargetTriple() : targetDevice.triple;
+        if ((triple.find("armv6") != std::string::npos) || (triple.find("armv7") != std::string::npos))
+        {
+            // Raspbian (32-bit, pi0 or pi3)
+            return 364;
+        }
+        else if (triple.find("aarch64") != std::string::npos)
+        {
+            // Linaro (64-bit)
+            return 241;
+        }
+        else if (triple.find("x86_64") != std::string::npos)
+        {
+            // Linux 64-bit generic
+            return 298;
+        }
+        else
+        {
+            assert(false && "Unknown Linux architecture");
+            return -1;
+        }
+    }
+
+    LLVMFunction IRPosixRuntime::GetSyscallFunction()
+    {
+        // Signature: long syscall(long number, ...);
+        auto longType = GetPointerSizedIntType();
+        auto functionType = llvm::FunctionType::get(longType, { longType }, true);
+        return static_cast<LLVMFunction>(_module.GetLLVMModule()->getOrInsertFunction("syscall", functionType));
+    }
+
+    LLVMFunction IRPosixRuntime::GetReadFunction()
+    {
+        // Signature: ssize_t read(int fd, void* buffer, size_t count);
+        auto& context = _module.GetLLVMContext();
+        auto intType = GetIntType();
+        auto int8PtrType = llvm::Type::getInt8PtrTy(context);
+        auto sizeType = GetPointerSizedIntType();
+        auto functionType = llvm::FunctionType::get(sizeType, { intType, int8PtrType, sizeType }, false);
+        return static_cast<LLVMFunction>(_module.GetLLVMModule()->getOrInsertFunction("read", functionType));
+    }
+
     //
     // pthreads -- types
     //
@@ -333,6 +408,28 @@ namespace emitters
         return static_cast<LLVMFunction>(_module.GetLLVMModule()->getOrInsertFunction("pthread_self", functionType));
     }
 
+    //
+    // pthreads -- thread affinity
+    //
+
+    bool IRPosixRuntime::IsThreadAffinityAvailable() const
+    {
+        // pthread_setaffinity_np is a glibc extension over the Linux-only sched_setaffinity syscall
+        return _module.GetCompilerOptions().targetDevice.IsLinux();
+    }
+
+    LLVMFunction IRPosixRuntime::GetPthreadSetAffinityNpFunction()
+    {
+        // Signature: int pthread_setaffinity_np(pthread_t thread, size_t cpusetsize, const cpu_set_t* cpuset);
+        auto& context = _module.GetLLVMContext();
+        auto intType = GetIntType();
+        auto sizeType = GetPointerSizedIntType();
+        auto int8PtrType = llvm::Type::getInt8PtrTy(context);
+        auto pthreadType = GetPthreadType();
+        auto functionType = llvm::FunctionType::get(intType, { pthreadType, sizeType, int8PtrType }, false);
+        return static_cast<LLVMFunction>(_module.GetLLVMModule()->getOrInsertFunction("pthread_setaffinity_np", functionType));
+    }
+
     //
     // pthreads -- synchronization functions
     //
@@ -11,6 +11,8 @@
 #include "IRFunctionEmitter.h"
 #include "IRMetadata.h"
 #include "IRModuleEmitter.h"
+#include "IRPosixRuntime.h"
+#include "IRRuntime.h"
 #include "LLVMUtilities.h"
 
 #include <utilities/include/UniqueId.h>
@@ -31,15 +33,38 @@ namespace emitters
         {
             count = 0,
             totalTime = 1,
-            name = 2
+            cacheMisses = 2,
+            branchMisses = 3,
+            name = 4,
+            tag = 5
         };
+
+        // perf_event constants (from linux/perf_event.h)
+        constexpr int perfTypeHardware = 0; // PERF_TYPE_HARDWARE
+        constexpr int64_t perfCountHwCacheMisses = 3; // PERF_COUNT_HW_CACHE_MISSES
+        constexpr int64_t perfCountHwBranchMisses = 5; // PERF_COUNT_HW_BRANCH_MISSES
+        constexpr int64_t perfFlagsExcludeKernel = 0x60; // exclude_kernel | exclude_hv
+        constexpr int perfEventAttrSize = 64; // PERF_ATTR_SIZE_VER0
+        constexpr int numPerfCounters = 2; // cache misses and branch misses
+
+        enum class TelemetryRecordFields
+        {
+            regionIndex = 0,
+            reserved = 1,
+            timestamp = 2,
+            duration = 3
+        };
+
+        // Number of records in the telemetry ring buffer. At 32 bytes per record this is 32KB of
+        // statically-allocated memory, enough to hold several full model invocations between drains.
+        constexpr int telemetryRingCapacity = 1024;
     }
 
     //
     // IRProfileRegionBlock
     //
-    IRProfileRegionBlock::IRProfileRegionBlock(IRFunctionEmitter& function, const std::string& name) :
-        _region(function, name)
+    IRProfileRegionBlock::IRProfileRegionBlock(IRFunctionEmitter& function, const std::string& name, const std::string& tag) :
+        _region(function, name, tag)
     {
         _region.Enter();
     }
@@ -52,14 +77,16 @@ namespace emitters
     //
     // IRProfileRegion
     //
-    IRProfileRegion::IRProfileRegion(IRFunctionEmitter& function, const std::string& name) :
+    IRProfileRegion::IRProfileRegion(IRFunctionEmitter& function, const std::string& name, const std::string& tag) :
         _function(function),
         _profiler(function.GetModule().GetProfiler()),
         _index(function.LocalScalar()),
-        _startTime(function.LocalScalar())
+        _startTime(function.LocalScalar()),
+        _startCacheMisses(function.LocalScalar()),
+        _startBranchMisses(function.LocalScalar())
     {
         _index = _profiler.CreateRegion(_function);
-        _profiler.InitRegion(*this, name);
+        _profiler.InitRegion(*this, name, tag);
     }
 
     // Private constructor for use by IRProfiler
@@ -67,7 +94,9 @@ namespace emitters
         _function(function),
         _profiler(profiler),
         _index(index),
-        _startTime(function.LocalScalar())
+        _startTime(function.LocalScalar()),
+        _startCacheMisses(function.LocalScalar()),
+        _startBranchMisses(function.LocalScalar())
     {
     }
 
@@ -123,6 +152,21 @@ namespace emitters
         return GetNamespacePrefix() + "_ResetRegionProfilingInfo";
     }
 
+    std::string IRProfiler::GetGetTelemetryBufferFunctionName() const
+    {
+        return GetNamespacePrefix() + "_GetTelemetryBuffer";
+    }
+
+    std::string IRProfiler::GetGetTelemetryCapacityFunctionName() const
+    {
+        return GetNamespacePrefix() + "_GetTelemetryCapacity";
+    }
+
+    std::string IRProfiler::GetGetTelemetryWritePositionFunctionName() const
+    {
+        return GetNamespacePrefix() + "_GetTelemetryWritePosition";
+    }
+
     std::string IRProfiler::GetNamespacePrefix() const
     {
         return _module->GetModuleName();
@@ -139,7 +183,7 @@ namespace emitters
         return function.LocalScalar(time);
     }
 
-    void IRProfiler::InitRegion(IRProfileRegion& region, const std::string& desiredName)
+    void IRProfiler::InitRegion(IRProfileRegion& region, const std::string& desiredName, const std::string& tag)
     {
         if (!_profilingEnabled)
             return;
@@ -153,6 +197,12 @@ namespace emitters
         // Set the name
         auto namePtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::name));
         function.Store(namePtr, function.Literal(regionName));
+
+        // Set the grouping tag, falling back to the profiler's current tag (typically the source
+        // layer of the node being compiled).
+        auto regionTag = tag.empty() ? _currentRegionTag : tag;
+        auto tagPtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::tag));
+        function.Store(tagPtr, function.Literal(regionTag));
     }
 
     void IRProfiler::EnterRegion(IRProfileRegion& region)
@@ -171,6 +221,14 @@ namespace emitters
         auto countPtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::count));
         auto count = function.LocalScalar(function.Load(countPtr));
         function.Store(countPtr, count + static_cast<int64_t>(1));
+
+        // Read the hardware counter baselines last, so the bookkeeping above isn't attributed to the region
+        if (AreHardwareCountersEnabled())
+        {
+            function.Call(GetInitPerfCountersFunction(), {});
+            region.SetStartCacheMisses(ReadPerfCounter(function, 0));
+            region.SetStartBranchMisses(ReadPerfCounter(function, 1));
+        }
     }
 
     void IRProfiler::ExitRegion(IRProfileRegion& region)
@@ -178,15 +236,37 @@ namespace emitters
         if (!_profilingEnabled)
             return;
 
-        // Increment stored time
         auto& function = region.GetFunction();
         auto regionPtr = GetRegionPointer(function, region.GetIndex());
+
+        // Read the hardware counters first, so the time bookkeeping below isn't attributed to the region
+        if (AreHardwareCountersEnabled())
+        {
+            auto cacheMissesPtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::cacheMisses));
+            auto storedCacheMisses = function.LocalArray(cacheMissesPtr);
+            storedCacheMisses[0] = storedCacheMisses[0] + (ReadPerfCounter(function, 0) - region.GetStartCacheMisses());
+
+            auto branchMissesPtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::branchMisses));
+            auto storedBranchMisses = function.LocalArray(branchMissesPtr);
+            storedBranchMisses[0] = storedBranchMisses[0] + (ReadPerfCounter(function, 1) - region.GetStartBranchMisses());
+
+            region.SetStartCacheMisses(function.LocalScalar());
+            region.SetStartBranchMisses(function.LocalScalar());
+        }
+
+        // Increment stored time
         auto timePtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::totalTime));
         auto startTime = region.GetStartTime();
-        auto newTime = GetCurrentTime(function) - startTime;
+        auto endTime = GetCurrentTime(function);
+        auto newTime = endTime - startTime;
         auto storedTime = function.LocalArray(timePtr);
         storedTime[0] = storedTime[0] + newTime;
 
+        if (IsTelemetryEnabled())
+        {
+            WriteTelemetryRecord(function, region.GetIndex(), endTime, newTime);
+        }
+
         // reset start time to "unassigned"
         region.SetStartTime(function.LocalScalar());
     }
@@ -196,12 +276,16 @@ namespace emitters
         if (!_profilingEnabled)
             return;
 
-        // Reset stored time and count
+        // Reset stored time, count, and hardware counters
         auto regionPtr = GetRegionPointer(function, regionIndex);
         auto countPtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::count));
         auto timePtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::totalTime));
+        auto cacheMissesPtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::cacheMisses));
+        auto branchMissesPtr = function.GetStructFieldPointer(regionPtr, static_cast<size_t>(RegionInfoFields::branchMisses));
         function.StoreZero(countPtr);
         function.StoreZero(timePtr);
+        function.StoreZero(cacheMissesPtr);
+        function.StoreZero(branchMissesPtr);
     }
 
     std::string IRProfiler::GetUniqueRegionName(const std::string& desiredName) const
@@ -234,14 +318,23 @@ namespace emitters
         assert(_profilingEnabled);
         auto& context = _module->GetLLVMContext();
 
+        auto int32Type = llvm::Type::getInt32Ty(context);
         auto int64Type = llvm::Type::getInt64Ty(context);
         auto doubleType = llvm::Type::getDoubleTy(context);
         auto int8PtrType = llvm::Type::getInt8PtrTy(context);
 
         // ProfileRegionInfo struct fields
-        emitters::NamedLLVMTypeList infoFields = { { "count", int64Type }, { "totalTime", doubleType }, { "name", int8PtrType } };
+        emitters::NamedLLVMTypeList infoFields = { { "count", int64Type }, { "totalTime", doubleType }, { "cacheMisses", int64Type }, { "branchMisses", int64Type }, { "name", int8PtrType }, { "tag", int8PtrType } };
         _profileRegionType = _module->GetOrCreateStruct(GetNamespacePrefix() + "_ProfileRegionInfo", infoFields);
         _module->IncludeTypeInHeader(_profileRegionType->getName());
+
+        if (_telemetryEnabled)
+        {
+            // ProfileTelemetryRecord struct fields
+            emitters::NamedLLVMTypeList recordFields = { { "regionIndex", int32Type }, { "reserved", int32Type }, { "timestamp", doubleType }, { "duration", doubleType } };
+            _telemetryRecordType = _module->GetOrCreateStruct(GetNamespacePrefix() + "_ProfileTelemetryRecord", recordFields);
+            _module->IncludeTypeInHeader(_telemetryRecordType->getName());
+        }
     }
 
     void IRProfiler::EmitProfilerFunctions()
@@ -255,6 +348,14 @@ namespace emitters
         EmitGetNumRegionsFunction();
         EmitGetRegionProfilingInfoFunction();
         EmitResetRegionProfilingInfoFunction();
+
+        if (_telemetryEnabled)
+        {
+            CreateTelemetryData();
+            EmitGetTelemetryBufferFunction();
+            EmitGetTelemetryCapacityFunction();
+            EmitGetTelemetryWritePositionFunction();
+        }
     }
 
     void IRProfiler::CreateRegionData()
@@ -395,5 +496,188 @@ namespace emitters
         auto regionPtr = function.PointerOffset(regions, index);
         return regionPtr;
     }
+
+    //
+    // Hardware performance counters
+    //
+    bool IRProfiler::AreHardwareCountersEnabled() const
+    {
+        return _profilingEnabled && _hardwareCountersEnabled && _module->GetRuntime().GetPosixEmitter().IsPerfEventAvailable();
+    }
+
+    IRLocalScalar IRProfiler::ReadPerfCounter(emitters::IRFunctionEmitter& function, int counterIndex)
+    {
+        auto value = function.Call(GetReadPerfCounterFunction(), { function.Literal<int>(counterIndex) });
+        return function.LocalScalar(value);
+    }
+
+    void IRProfiler::CreatePerfCounterData()
+    {
+        if (_perfCounterFds != nullptr)
+        {
+            return;
+        }
+
+        auto& context = _module->GetLLVMContext();
+        auto int32Type = llvm::Type::getInt32Ty(context);
+        _perfCounterFds = _module->GlobalArray(GetNamespacePrefix() + "_profilePerfCounterFds", int32Type, numPerfCounters);
+        _perfCountersInitialized = _module->Global(VariableType::Int32, GetNamespacePrefix() + "_profilePerfCountersInitialized");
+    }
+
+    LLVMFunction IRProfiler::GetInitPerfCountersFunction()
+    {
+        if (_initPerfCountersFunction == nullptr)
+        {
+            CreatePerfCounterData();
+
+            auto& posixRuntime = _module->GetRuntime().GetPosixEmitter();
+            auto attrType = posixRuntime.GetPerfEventAttrType();
+            auto syscallFunction = posixRuntime.GetSyscallFunction();
+            auto syscallNumber = posixRuntime.GetPerfEventOpenSyscallNumber();
+            auto longType = syscallFunction->getFunctionType()->getParamType(0);
+
+            auto function = _module->BeginFunction(GetNamespacePrefix() + "_InitProfilePerfCounters", VariableType::Void);
+
+            auto initialized = function.LocalScalar(function.Load(_perfCountersInitialized));
+            function.If(TypedComparison::equals, initialized, function.Literal<int>(0), [&](IRFunctionEmitter& function) {
+                function.Store(_perfCountersInitialized, function.Literal<int>(1));
+
+                const int64_t configs[numPerfCounters] = { perfCountHwCacheMisses, perfCountHwBranchMisses };
+                auto attrVar = function.Variable(attrType, "attr");
+                for (int index = 0; index < numPerfCounters; ++index)
+                {
+                    function.StoreZero(attrVar);
+                    function.Store(function.GetStructFieldPointer(attrVar, 0), function.Literal<int>(perfTypeHardware));
+                    function.Store(function.GetStructFieldPointer(attrVar, 1), function.Literal<int>(perfEventAttrSize));
+                    function.Store(function.GetStructFieldPointer(attrVar, 2), function.Literal<int64_t>(configs[index]));
+
+                    // Only count user-space events, so the counters work under the default perf_event_paranoid setting
+                    function.Store(function.GetStructFieldPointer(attrVar, 6), function.Literal<int64_t>(perfFlagsExcludeKernel));
+
+                    // perf_event_open(&attr, pid = 0 (this thread), cpu = -1 (any), group_fd = -1, flags = 0)
+                    // The syscall arguments are passed as varargs, so widen the int arguments to `long`
+                    auto zero = function.CastValue(function.Literal<int>(0), longType);
+                    auto minusOne = function.CastValue(function.Literal<int>(-1), longType);
+                    auto fd = function.Call(syscallFunction, { function.CastValue(function.Literal<int>(syscallNumber), longType), attrVar, zero, minusOne, minusOne, zero });
+
+                    // On failure the fd is -1, and subsequent reads of the counter harmlessly return zero
+                    function.Store(function.PointerOffset(_perfCounterFds, function.Literal<int>(index)), function.CastValue(fd, VariableType::Int32));
+                }
+            });
+
+            _module->EndFunction();
+            _initPerfCountersFunction = function.GetFunction();
+        }
+        return _initPerfCountersFunction;
+    }
+
+    LLVMFunction IRProfiler::GetReadPerfCounterFunction()
+    {
+        if (_readPerfCounterFunction == nullptr)
+        {
+            CreatePerfCounterData();
+
+            auto& context = _module->GetLLVMContext();
+            auto int8PtrType = llvm::Type::getInt8PtrTy(context);
+            auto int64Type = llvm::Type::getInt64Ty(context);
+            auto readFunction = _module->GetRuntime().GetPosixEmitter().GetReadFunction();
+            auto sizeType = readFunction->getFunctionType()->getParamType(2);
+
+            const emitters::NamedVariableTypeList parameters = { { "counterIndex", emitters::VariableType::Int32 } };
+            auto function = _module->BeginFunction(GetNamespacePrefix() + "_ReadProfilePerfCounter", VariableType::Int64, parameters);
+
+            // If the read fails (e.g., perf_event_open failed at init time), the zero stays in place
+            auto valueVar = function.Variable(int64Type, "value");
+            function.StoreZero(valueVar);
+
+            auto counterIndex = function.GetFunctionArgument("counterIndex");
+            auto fd = function.Load(function.PointerOffset(_perfCounterFds, counterIndex));
+            function.Call(readFunction, { fd, function.CastPointer(valueVar, int8PtrType), function.CastValue(function.Literal<int>(8), sizeType) });
+            function.Return(function.Load(valueVar));
+            _module->EndFunction();
+            _readPerfCounterFunction = function.GetFunction();
+        }
+        return _readPerfCounterFunction;
+    }
+
+    //
+    // Telemetry ring buffer
+    //
+    void IRProfiler::WriteTelemetryRecord(emitters::IRFunctionEmitter& function, const IRLocalScalar& regionIndex, const IRLocalScalar& timestamp, const IRLocalScalar& duration)
+    {
+        function.Call(GetWriteTelemetryRecordFunction(), { regionIndex, timestamp, duration });
+    }
+
+    void IRProfiler::CreateTelemetryData()
+    {
+        assert(_telemetryRecordType != nullptr);
+        _telemetryRecords = _module->GlobalArray(GetNamespacePrefix() + "_telemetryRecords", _telemetryRecordType, telemetryRingCapacity);
+        _telemetryWriteIndex = _module->Global(VariableType::Int32, GetNamespacePrefix() + "_telemetryWriteIndex");
+    }
+
+    LLVMFunction IRProfiler::GetWriteTelemetryRecordFunction()
+    {
+        if (_writeTelemetryRecordFunction == nullptr)
+        {
+            assert(_telemetryRecords != nullptr);
+
+            const emitters::NamedVariableTypeList parameters = { { "regionIndex", VariableType::Int32 }, { "timestamp", VariableType::Double }, { "duration", VariableType::Double } };
+            auto function = _module->BeginFunction(GetNamespacePrefix() + "_WriteTelemetryRecord", VariableType::Void, parameters);
+
+            auto regionIndex = function.GetFunctionArgument("regionIndex");
+            auto timestamp = function.GetFunctionArgument("timestamp");
+            auto duration = function.GetFunctionArgument("duration");
+
+            // The write index is a monotonic record count; the ring slot is its value mod the
+            // capacity. Readers keep their own cursor and compare it with the write index to detect
+            // new (or overwritten) records.
+            auto writeIndex = function.LocalScalar(function.Load(_telemetryWriteIndex));
+            auto slot = writeIndex % telemetryRingCapacity;
+            auto recordPtr = function.PointerOffset(_telemetryRecords, slot);
+            function.Store(function.GetStructFieldPointer(recordPtr, static_cast<size_t>(TelemetryRecordFields::regionIndex)), regionIndex);
+            function.Store(function.GetStructFieldPointer(recordPtr, static_cast<size_t>(TelemetryRecordFields::timestamp)), timestamp);
+            function.Store(function.GetStructFieldPointer(recordPtr, static_cast<size_t>(TelemetryRecordFields::duration)), duration);
+
+            // Publish the record by bumping the write index after the stores. There's a single
+            // writer (the model thread), so no synchronization is needed; a concurrent reader can
+            // at worst see a torn record at the head of the ring, which it detects by re-checking
+            // the write index after reading.
+            function.Store(_telemetryWriteIndex, writeIndex + 1);
+            _module->EndFunction();
+            _writeTelemetryRecordFunction = function.GetFunction();
+        }
+        return _writeTelemetryRecordFunction;
+    }
+
+    void IRProfiler::EmitGetTelemetryBufferFunction()
+    {
+        assert(_telemetryRecords != nullptr);
+        assert(_telemetryRecordType != nullptr);
+        auto returnType = _telemetryRecordType->getPointerTo();
+
+        auto function = _module->BeginFunction(GetGetTelemetryBufferFunctionName(), returnType);
+        function.IncludeInHeader();
+
+        auto castPtr = function.CastPointer(_telemetryRecords, returnType);
+        function.Return(castPtr);
+        _module->EndFunction();
+    }
+
+    void IRProfiler::EmitGetTelemetryCapacityFunction()
+    {
+        auto function = _module->BeginFunction(GetGetTelemetryCapacityFunctionName(), VariableType::Int32);
+        function.IncludeInHeader();
+        function.Return(function.Literal(telemetryRingCapacity));
+        _module->EndFunction();
+    }
+
+    void IRProfiler::EmitGetTelemetryWritePositionFunction()
+    {
+        assert(_telemetryWriteIndex != nullptr);
+        auto function = _module->BeginFunction(GetGetTelemetryWritePositionFunctionName(), VariableType::Int32);
+        function.IncludeInHeader();
+        function.Return(function.Load(_telemetryWriteIndex));
+        _module->EndFunction();
+    }
 } // namespace emitters
 } // namespace ell
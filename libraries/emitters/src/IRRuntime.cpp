@@ -13,6 +13,8 @@
 
 #include <utilities/include/Unused.h>
 
+#include <llvm/IR/InlineAsm.h>
+
 namespace ell
 {
 namespace emitters
@@ -62,6 +64,7 @@ namespace emitters
 
             function.Return(function.Literal<int>(0));
             module.EndFunction();
+            module.InsertFunctionMetadata(function.GetFunction(), c_runtimeHelperFunctionTagName);
             return function.GetFunction();
         }
 
@@ -120,6 +123,7 @@ namespace emitters
             function.Return(function.Literal<int>(0));
 
             module.EndFunction();
+            module.InsertFunctionMetadata(function.GetFunction(), c_runtimeHelperFunctionTagName);
             return function.GetFunction();
         }
 
@@ -180,6 +184,7 @@ namespace emitters
         function.Return();
         _module.EndFunction();
 
+        _module.InsertFunctionMetadata(function.GetFunction(), c_runtimeHelperFunctionTagName);
         return function.GetFunction();
     }
 
@@ -203,6 +208,7 @@ namespace emitters
         function.DotProduct(&count, &leftValue, &rightValue, &result);
         function.Return();
         _module.EndFunction();
+        _module.InsertFunctionMetadata(function.GetFunction(), c_runtimeHelperFunctionTagName);
         return function.GetFunction();
     }
 
@@ -582,11 +588,138 @@ namespace emitters
 
             function.Return(function.Load(result));
             _module.EndFunction();
+            _module.InsertFunctionMetadata(function.GetFunction(), c_runtimeHelperFunctionTagName);
             _stringCompareFunction = function.GetFunction();
         }
         return _stringCompareFunction;
     }
 
+    LLVMFunction IRRuntime::GetVectorWidthFunction()
+    {
+        if (_vectorWidthFunction == nullptr)
+        {
+            _vectorWidthFunction = EmitVectorWidthFunction();
+        }
+        return _vectorWidthFunction;
+    }
+
+    LLVMFunction IRRuntime::EmitVectorWidthFunction()
+    {
+        auto function = _module.BeginFunction(GetNamespacePrefix() + "_GetVectorWidth", VariableType::Int32);
+        if (_module.GetCompilerOptions().targetDevice.IsX86())
+        {
+            auto& context = _module.GetLLVMContext();
+            auto& irBuilder = function.GetEmitter().GetIRBuilder();
+            auto int32Type = llvm::Type::getInt32Ty(context);
+
+            auto cpuidResultType = llvm::StructType::get(context, { int32Type, int32Type, int32Type, int32Type });
+            auto cpuidFunctionType = llvm::FunctionType::get(cpuidResultType, { int32Type, int32Type }, false);
+            auto cpuidAsm = llvm::InlineAsm::get(cpuidFunctionType, "cpuid", "={ax},={bx},={cx},={dx},{ax},{cx}", false);
+
+            auto xgetbvResultType = llvm::StructType::get(context, { int32Type, int32Type });
+            auto xgetbvFunctionType = llvm::FunctionType::get(xgetbvResultType, { int32Type }, false);
+            auto xgetbvAsm = llvm::InlineAsm::get(xgetbvFunctionType, "xgetbv", "={ax},={dx},{cx}", false);
+
+            auto width = function.Variable(VariableType::Int32, "width");
+            function.Store(width, function.Literal<int>(16)); // 128-bit SSE registers are the baseline on x86
+
+            auto maxLeaf = function.LocalScalar(irBuilder.CreateExtractValue(irBuilder.CreateCall(cpuidAsm, { function.Literal<int>(0), function.Literal<int>(0) }), 0));
+            auto leaf1Ecx = function.LocalScalar(irBuilder.CreateExtractValue(irBuilder.CreateCall(cpuidAsm, { function.Literal<int>(1), function.Literal<int>(0) }), 2));
+
+            // Wide registers are only usable if the CPU has them *and* the OS saves their state across
+            // context switches, so check OSXSAVE/AVX and then the XCR0 enable bits from xgetbv
+            const int osxsaveAndAvxBits = (1 << 27) | (1 << 28);
+            auto osxsaveAndAvx = (leaf1Ecx & function.LocalScalar<int>(osxsaveAndAvxBits)) == osxsaveAndAvxBits;
+            function.If(maxLeaf >= 7 && osxsaveAndAvx, [width, cpuidAsm, xgetbvAsm, &irBuilder](IRFunctionEmitter& function) {
+                auto xcr0 = function.LocalScalar(irBuilder.CreateExtractValue(irBuilder.CreateCall(xgetbvAsm, { function.Literal<int>(0) }), 0));
+                auto leaf7Ebx = function.LocalScalar(irBuilder.CreateExtractValue(irBuilder.CreateCall(cpuidAsm, { function.Literal<int>(7), function.Literal<int>(0) }), 1));
+
+                auto ymmEnabled = (xcr0 & function.LocalScalar<int>(0x6)) == 0x6;
+                auto hasAvx2 = (leaf7Ebx & function.LocalScalar<int>(1 << 5)) != 0;
+                function.If(ymmEnabled && hasAvx2, [width](IRFunctionEmitter& function) {
+                    function.Store(width, function.Literal<int>(32));
+                });
+
+                auto zmmEnabled = (xcr0 & function.LocalScalar<int>(0xe6)) == 0xe6;
+                auto hasAvx512f = (leaf7Ebx & function.LocalScalar<int>(1 << 16)) != 0;
+                function.If(zmmEnabled && hasAvx512f, [width](IRFunctionEmitter& function) {
+                    function.Store(width, function.Literal<int>(64));
+                });
+            });
+            function.Return(function.Load(width));
+        }
+        else
+        {
+            // No runtime dispatch off x86; report the baseline 128-bit (e.g. NEON-sized) registers
+            function.Return(function.Literal<int>(16));
+        }
+        _module.EndFunction();
+        _module.InsertFunctionMetadata(function.GetFunction(), c_runtimeHelperFunctionTagName);
+        return function.GetFunction();
+    }
+
+    LLVMFunction IRRuntime::EmitVectorWidthDispatchedFunction(const std::string& functionName, VariableType returnType, const NamedVariableTypeList& arguments, std::function<void(IRFunctionEmitter& function, int vectorWidthBytes)> emitBody)
+    {
+        // One variant per SIMD register width the target may support at runtime
+        std::vector<int> variantWidths = _module.GetCompilerOptions().targetDevice.IsX86() ? std::vector<int>{ 16, 32, 64 } : std::vector<int>{ 16 };
+        std::vector<LLVMFunction> variants;
+        for (auto variantWidth : variantWidths)
+        {
+            auto variantFunction = _module.BeginFunction(functionName + "_simd" + std::to_string(variantWidth * 8), returnType, arguments);
+            emitBody(variantFunction, variantWidth);
+            _module.EndFunction();
+            variants.push_back(variantFunction.GetFunction());
+        }
+
+        auto widthFunction = GetVectorWidthFunction();
+
+        auto function = _module.BeginFunction(functionName, returnType, arguments);
+        std::vector<LLVMValue> callArguments;
+        for (auto& argument : function.Arguments())
+        {
+            callArguments.push_back(&argument);
+        }
+
+        LLVMValue result = nullptr;
+        if (variants.size() == 1)
+        {
+            result = function.Call(variants[0], callArguments);
+        }
+        else
+        {
+            // Resolve a global function pointer to the widest variant the processor supports the first
+            // time through, and call through it from then on
+            auto& irBuilder = function.GetEmitter().GetIRBuilder();
+            auto variantFunctionType = variants[0]->getFunctionType();
+            auto variantPointerType = variantFunctionType->getPointerTo();
+            auto implPointer = _module.Global(variantPointerType, functionName + "_impl");
+
+            auto needsResolving = irBuilder.CreateICmpEQ(function.Load(implPointer), function.NullPointer(variantPointerType));
+            function.If(needsResolving, [widthFunction, implPointer, &variants, &variantWidths](IRFunctionEmitter& function) {
+                auto width = function.LocalScalar(function.Call(widthFunction, std::vector<LLVMValue>{}));
+                LLVMValue chosenVariant = variants[0];
+                for (size_t index = 1; index < variants.size(); ++index)
+                {
+                    chosenVariant = function.Select(width >= variantWidths[index], variants[index], chosenVariant);
+                }
+                function.Store(implPointer, chosenVariant);
+            });
+
+            result = irBuilder.CreateCall(variantFunctionType, function.Load(implPointer), callArguments);
+        }
+
+        if (returnType == VariableType::Void)
+        {
+            function.Return();
+        }
+        else
+        {
+            function.Return(result);
+        }
+        _module.EndFunction();
+        return function.GetFunction();
+    }
+
     LLVMTypeList GetLLVMTypes(IREmitter& emitter, const NamedVariableTypeList& argTypes)
     {
         LLVMTypeList llvmTypes;
@@ -23,6 +23,50 @@ namespace ell
 {
 namespace emitters
 {
+    namespace
+    {
+        // Atomic operations emitted directly via the IR builder --- the task-claiming fast path
+        // below modifies the queue state without holding the queue mutex.
+        LLVMValue AtomicLoad(IRFunctionEmitter& function, LLVMValue ptr, unsigned alignment)
+        {
+            auto load = function.GetEmitter().GetIRBuilder().CreateLoad(ptr);
+            load->setAtomic(llvm::AtomicOrdering::SequentiallyConsistent);
+            load->setAlignment(alignment);
+            return load;
+        }
+
+        void AtomicStore(IRFunctionEmitter& function, LLVMValue ptr, LLVMValue value, unsigned alignment)
+        {
+            auto store = function.GetEmitter().GetIRBuilder().CreateStore(value, ptr);
+            store->setAtomic(llvm::AtomicOrdering::SequentiallyConsistent);
+            store->setAlignment(alignment);
+        }
+
+        LLVMValue AtomicFetchAdd(IRFunctionEmitter& function, LLVMValue ptr, LLVMValue value)
+        {
+            return function.GetEmitter().GetIRBuilder().CreateAtomicRMW(llvm::AtomicRMWInst::Add, ptr, value, llvm::AtomicOrdering::SequentiallyConsistent);
+        }
+
+        LLVMValue AtomicCompareExchange(IRFunctionEmitter& function, LLVMValue ptr, LLVMValue expected, LLVMValue desired)
+        {
+            auto& irBuilder = function.GetEmitter().GetIRBuilder();
+            auto result = irBuilder.CreateAtomicCmpXchg(ptr, expected, desired, llvm::AtomicOrdering::SequentiallyConsistent, llvm::AtomicOrdering::SequentiallyConsistent);
+            return irBuilder.CreateExtractValue(result, 1); // the "success" flag
+        }
+
+        // With the shared runtime option, the pool's globals and functions are emitted identically
+        // (and under the same module-independent names) by every module, and marked linkonce_odr so
+        // the linker folds them to a single copy --- one set of worker threads and one task queue
+        // per binary, no matter how many emitted modules are linked in.
+        void ApplySharedRuntimeLinkage(IRModuleEmitter& module, llvm::GlobalValue* value)
+        {
+            if (module.GetCompilerOptions().useSharedRuntime)
+            {
+                value->setLinkage(llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage);
+            }
+        }
+    } // namespace
+
     //
     // IRThreadPool
     //
@@ -35,13 +79,28 @@ namespace emitters
     void IRThreadPool::Initialize()
     {
         _maxThreads = _module.GetCompilerOptions().maxThreads;
+        auto& context = _module.GetLLVMContext();
         auto pthreadType = _module.GetRuntime().GetPosixEmitter().GetPthreadType();
+        auto int32Type = llvm::Type::getInt32Ty(context);
 
-        // Create global array to hold pthread objects
+        // Create global arrays to hold pthread objects and the worker indices passed to them
         _threads = _module.GlobalArray("taskThreads", pthreadType, _maxThreads);
+        _workerThreadIds = _module.GlobalArray("workerThreadIds", int32Type, _maxThreads);
+        ApplySharedRuntimeLinkage(_module, _threads);
+        ApplySharedRuntimeLinkage(_module, _workerThreadIds);
+
+        if (_module.GetRuntime().GetPosixEmitter().IsThreadAffinityAvailable())
+        {
+            AddThreadAffinityFunction();
+        }
 
         AddGlobalInitializer();
         AddGlobalFinalizer();
+
+        if (_applyAffinityFunction != nullptr)
+        {
+            AddThreadAffinityOverride();
+        }
     }
 
     void IRThreadPool::AddGlobalInitializer()
@@ -50,25 +109,35 @@ namespace emitters
         auto& context = _module.GetLLVMContext();
         auto boolType = llvm::Type::getInt1Ty(context);
         auto int8PtrType = llvm::Type::getInt8PtrTy(context);
-        auto isInitedVar = _module.Global(boolType, "isInitialized"); // initialized to false
+        _isInited = _module.Global(boolType, "isInitialized"); // initialized to false
+        ApplySharedRuntimeLinkage(_module, _isInited);
 
         auto initThreadPoolFunction = _module.BeginFunction("initThreadPool", VariableType::Void);
         {
             // Check if task not initialized
-            auto notInited = initThreadPoolFunction.LogicalNot(initThreadPoolFunction.Load(isInitedVar));
-            initThreadPoolFunction.If(notInited, [this, int8PtrType, &isInitedVar](auto& initThreadPoolFunction) {
-                initThreadPoolFunction.Store(isInitedVar, initThreadPoolFunction.TrueBit());
-                _taskQueue.Initialize(initThreadPoolFunction);
+            auto notInited = initThreadPoolFunction.LogicalNot(initThreadPoolFunction.Load(_isInited));
+            initThreadPoolFunction.If(notInited, [this, int8PtrType](auto& initThreadPoolFunction) {
+                initThreadPoolFunction.Store(_isInited, initThreadPoolFunction.TrueBit());
+                _taskQueue.Initialize(initThreadPoolFunction, _maxThreads);
 
                 auto workerThreadFunction = this->GetWorkerThreadFunction(); // STYLE gcc bug requires `this->` inside generic lambda (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=67274)
                 llvm::ConstantPointerNull* nullAttr = initThreadPoolFunction.NullPointer(int8PtrType);
                 initThreadPoolFunction.For(_maxThreads, [this, int8PtrType, nullAttr, workerThreadFunction](auto& initThreadPoolFunction, LLVMValue index) {
                     auto threadPtr = initThreadPoolFunction.PointerOffset(_threads, index);
-                    initThreadPoolFunction.PthreadCreate(threadPtr, nullAttr, workerThreadFunction, initThreadPoolFunction.CastPointer(_taskQueue.GetDataStruct(), int8PtrType));
+                    auto threadIdPtr = initThreadPoolFunction.PointerOffset(_workerThreadIds, index);
+                    initThreadPoolFunction.Store(threadIdPtr, index);
+                    initThreadPoolFunction.PthreadCreate(threadPtr, nullAttr, workerThreadFunction, initThreadPoolFunction.CastPointer(threadIdPtr, int8PtrType));
                 });
+
+                // Pin the new workers according to the affinity mask (a no-op when the mask is zero)
+                if (_applyAffinityFunction != nullptr)
+                {
+                    initThreadPoolFunction.Call("applyThreadAffinity");
+                }
             });
         }
         _module.EndFunction();
+        ApplySharedRuntimeLinkage(_module, initThreadPoolFunction.GetFunction());
         _module.AddInitializationFunction(initThreadPoolFunction);
     }
 
@@ -77,12 +146,85 @@ namespace emitters
         // Create individual threads (in a global_ctors function)
         auto shutDownThreadPoolFunction = _module.BeginFunction("shutDownThreadPool", VariableType::Void);
         {
-            ShutDown(shutDownThreadPoolFunction);
+            // Guard on the init flag so the finalizer is idempotent: with the shared runtime,
+            // the folded copy is invoked once per module's destructor-list entry
+            shutDownThreadPoolFunction.If(shutDownThreadPoolFunction.Load(_isInited), [this](IRFunctionEmitter& shutDownThreadPoolFunction) {
+                shutDownThreadPoolFunction.Store(_isInited, shutDownThreadPoolFunction.FalseBit());
+                ShutDown(shutDownThreadPoolFunction);
+            });
         }
         _module.EndFunction();
+        ApplySharedRuntimeLinkage(_module, shutDownThreadPoolFunction.GetFunction());
         _module.AddFinalizationFunction(shutDownThreadPoolFunction);
     }
 
+    void IRThreadPool::AddThreadAffinityFunction()
+    {
+        auto& context = _module.GetLLVMContext();
+        auto int8PtrType = llvm::Type::getInt8PtrTy(context);
+        auto& posixRuntime = _module.GetRuntime().GetPosixEmitter();
+
+        // Choose the initial mask from the compile-time policy and the target's core topology.
+        // Zero means "no affinity": placement stays with the kernel scheduler until the emitted
+        // <module>_SetThreadAffinity function supplies a mask at runtime.
+        const auto& options = _module.GetCompilerOptions();
+        int64_t initialMask = 0;
+        switch (options.threadAffinityPolicy)
+        {
+        case ThreadAffinityPolicy::bigCoresOnly:
+            initialMask = static_cast<int64_t>(options.targetDevice.bigCoreMask);
+            break;
+        case ThreadAffinityPolicy::littleCoresOnly:
+            initialMask = static_cast<int64_t>(options.targetDevice.littleCoreMask);
+            break;
+        case ThreadAffinityPolicy::none:
+            break;
+        }
+
+        _affinityMask = _module.Global<int64_t>("threadAffinityMask", initialMask);
+        ApplySharedRuntimeLinkage(_module, _affinityMask);
+
+        auto applyAffinityFunction = _module.BeginFunction("applyThreadAffinity", VariableType::Void);
+        {
+            auto mask = applyAffinityFunction.Load(_affinityMask);
+            auto hasMask = applyAffinityFunction.Comparison(TypedComparison::notEquals, mask, applyAffinityFunction.Literal<int64_t>(0));
+            applyAffinityFunction.If(hasMask, [this, int8PtrType, &posixRuntime](auto& applyAffinityFunction) {
+                auto setAffinityFunction = posixRuntime.GetPthreadSetAffinityNpFunction();
+
+                // The mask global doubles as the cpu_set_t: the kernel accepts any prefix of the
+                // full set, and the targets we pin on (Linux on ARM/x86) are little-endian, so an
+                // int64 covers cpus 0-63
+                auto cpuSetSizeType = llvm::cast<llvm::IntegerType>(setAffinityFunction->getFunctionType()->getParamType(1));
+                auto cpuSetSize = static_cast<LLVMValue>(llvm::ConstantInt::get(cpuSetSizeType, sizeof(int64_t)));
+                auto cpuSetPtr = applyAffinityFunction.CastPointer(_affinityMask, int8PtrType);
+                applyAffinityFunction.For(_maxThreads, [this, setAffinityFunction, cpuSetSize, cpuSetPtr](auto& applyAffinityFunction, LLVMValue index) {
+                    auto thread = applyAffinityFunction.Load(applyAffinityFunction.PointerOffset(_threads, index));
+                    applyAffinityFunction.Call(setAffinityFunction, { thread, cpuSetSize, cpuSetPtr });
+                });
+            });
+        }
+        _module.EndFunction();
+        ApplySharedRuntimeLinkage(_module, applyAffinityFunction.GetFunction());
+        _applyAffinityFunction = applyAffinityFunction.GetFunction();
+    }
+
+    void IRThreadPool::AddThreadAffinityOverride()
+    {
+        // Public runtime override: store the new mask and re-pin the workers if they exist.
+        // Calling it before the pool is initialized just records the mask for the pool to apply
+        // when the workers are created.
+        auto setThreadAffinityFunction = _module.BeginFunction(_module.GetModuleName() + "_SetThreadAffinity", VariableType::Void, NamedVariableTypeList{ { "mask", VariableType::Int64 } });
+        setThreadAffinityFunction.IncludeInHeader();
+        {
+            auto mask = setThreadAffinityFunction.GetFunctionArgument("mask");
+            setThreadAffinityFunction.Store(_affinityMask, mask);
+            setThreadAffinityFunction.If(setThreadAffinityFunction.Load(_isInited), [](IRFunctionEmitter& setThreadAffinityFunction) {
+                setThreadAffinityFunction.Call("applyThreadAffinity");
+            });
+        }
+        _module.EndFunction();
+    }
+
     IRThreadPoolTaskArray& IRThreadPool::AddTasks(IRFunctionEmitter& function, LLVMFunction taskFunction, const std::vector<std::vector<LLVMValue>>& arguments)
     {
         // Call Initialize() the first time we're called --- this adds global init code to the module
@@ -118,10 +260,15 @@ namespace emitters
 
         auto workerThreadFunction = _module.BeginFunction("WorkerThreadFunction", int8PtrType, { int8PtrType });
         {
+            // The thread argument is a pointer to this worker's index
+            auto arguments = workerThreadFunction.Arguments().begin();
+            auto threadIdArg = &(*arguments);
+            auto workerId = workerThreadFunction.Load(workerThreadFunction.CastPointer(threadIdArg, llvm::Type::getInt32PtrTy(context)));
+
             auto notDoneVar = workerThreadFunction.Variable(boolType, "notDone");
             workerThreadFunction.Store(notDoneVar, workerThreadFunction.TrueBit());
-            workerThreadFunction.While(notDoneVar, [this, notDoneVar](IRFunctionEmitter& workerThreadFunction) {
-                auto task = _taskQueue.PopNextTask(workerThreadFunction);
+            workerThreadFunction.While(notDoneVar, [this, notDoneVar, workerId](IRFunctionEmitter& workerThreadFunction) {
+                auto task = _taskQueue.PopNextTask(workerThreadFunction, workerId);
                 // check for a poison "null" task, indicating we should break out of the loop and terminate the thread
                 workerThreadFunction.If(
                                         workerThreadFunction.Operator(TypedOperator::logicalOr, task.IsNull(workerThreadFunction), _taskQueue.GetShutdownFlag(workerThreadFunction)),
@@ -131,13 +278,14 @@ namespace emitters
                     .Else([this, &task](IRFunctionEmitter& workerThreadFunction) {
                         task.Run(workerThreadFunction);
 
-                        // Decrement count of unfinished tasks
-                        _taskQueue.LockQueueMutex(workerThreadFunction);
+                        // Decrement count of unfinished tasks (atomically; no lock needed)
                         auto unfinishedCount = _taskQueue.DecrementUnfinishedTasks(workerThreadFunction);
-                        _taskQueue.UnlockQueueMutex(workerThreadFunction);
 
-                        // if zero, signal client cond var
+                        // if zero, signal client cond var. Locking and unlocking the mutex first
+                        // ensures any client is either asleep or has already seen the new count.
                         workerThreadFunction.If(workerThreadFunction.Comparison(TypedComparison::equals, unfinishedCount, workerThreadFunction.Literal<int>(0)), [this](auto& workerThreadFunction) {
+                            _taskQueue.LockQueueMutex(workerThreadFunction);
+                            _taskQueue.UnlockQueueMutex(workerThreadFunction);
                             _taskQueue.NotifyWaitingClients(workerThreadFunction);
                         });
                     });
@@ -146,6 +294,7 @@ namespace emitters
             workerThreadFunction.Return(workerThreadFunction.NullPointer(int8PtrType));
         }
         _module.EndFunction();
+        ApplySharedRuntimeLinkage(_module, workerThreadFunction.GetFunction());
         return workerThreadFunction.GetFunction();
     }
 
@@ -164,7 +313,7 @@ namespace emitters
         // Note: we can't initialize ourselves here, for ordering reasons.
     }
 
-    void IRThreadPoolTaskQueue::Initialize(IRFunctionEmitter& function)
+    void IRThreadPoolTaskQueue::Initialize(IRFunctionEmitter& function, size_t numWorkers)
     {
         if (_queueData != nullptr)
         {
@@ -175,10 +324,16 @@ namespace emitters
         // Get types
         auto& context = module.GetLLVMContext();
         auto int8PtrType = llvm::Type::getInt8PtrTy(context);
+        auto int64Type = llvm::Type::getInt64Ty(context);
         auto taskQueueDataType = GetTaskQueueDataType(module);
 
-        // Allocate a data struct
-        _queueData = module.Global(taskQueueDataType, "taskQueueData");
+        // Allocate a data struct and the per-worker task ranges
+        auto queueData = module.Global(taskQueueDataType, "taskQueueData");
+        ApplySharedRuntimeLinkage(module, queueData);
+        _queueData = queueData;
+        _numWorkers = numWorkers;
+        _taskRanges = module.GlobalArray("taskRangeData", int64Type, numWorkers);
+        ApplySharedRuntimeLinkage(module, _taskRanges);
 
         // Get pointers to the fields
         auto queueMutex = function.GetStructFieldPointer(_queueData, static_cast<int>(Fields::queueMutex));
@@ -212,6 +367,18 @@ namespace emitters
         LockQueueMutex(function);
         _tasks.SetTasks(function, taskFunction, arguments);
         SetInitialCount(function, function.Literal<int>(numTasks));
+
+        // Partition the tasks into contiguous per-worker ranges; once a worker's own range is
+        // exhausted it will steal from the others'. Each range is a [head, tail) pair packed
+        // into a single 64-bit word so a stale read can never see a half-updated range.
+        for (size_t workerIndex = 0; workerIndex < _numWorkers; ++workerIndex)
+        {
+            auto begin = static_cast<int64_t>((numTasks * workerIndex) / _numWorkers);
+            auto end = static_cast<int64_t>((numTasks * (workerIndex + 1)) / _numWorkers);
+            auto packedRange = function.Literal((end << 32) | begin);
+            AtomicStore(function, function.PointerOffset(_taskRanges, function.Literal<int>(workerIndex)), packedRange, 8);
+        }
+
         function.PthreadCondBroadcast(GetWorkAvailableConditionVariablePointer(function));
         UnlockQueueMutex(function);
         return GetTaskArray();
@@ -222,34 +389,84 @@ namespace emitters
         function.PthreadCondBroadcast(GetWorkFinishedConditionVariablePointer(function));
     }
 
-    IRThreadPoolTask IRThreadPoolTaskQueue::PopNextTask(IRFunctionEmitter& function)
+    IRThreadPoolTask IRThreadPoolTaskQueue::PopNextTask(IRFunctionEmitter& function, LLVMValue workerId)
     {
         assert(IsInitialized());
 
         auto& module = function.GetModule();
         auto& context = module.GetLLVMContext();
         auto boolType = llvm::Type::getInt1Ty(context);
+        auto int32Type = llvm::Type::getInt32Ty(context);
 
-        auto isEmptyVar = function.Variable(boolType, "isEmpty");
+        auto taskIndexVar = function.Variable(int32Type, "claimedTaskIndex");
+        auto searchingVar = function.Variable(boolType, "searching");
         auto queueMutex = GetQueueMutexPointer(function);
         auto workAvailableCondVar = GetWorkAvailableConditionVariablePointer(function);
 
-        LockQueueMutex(function);
-        function.Store(isEmptyVar, function.Operator(TypedOperator::logicalAnd, IsEmpty(function), function.Operator(UnaryOperatorType::logicalNot, GetShutdownFlag(function))));
-        function.While(isEmptyVar, [=](auto& function) {
-            // Wait on the condition variable
-            function.PthreadCondWait(workAvailableCondVar, queueMutex);
-
-            // update while loop exit condition
-            function.Store(isEmptyVar, function.Operator(TypedOperator::logicalAnd, this->IsEmpty(function), function.Operator(UnaryOperatorType::logicalNot, this->GetShutdownFlag(function))));
+        function.Store(taskIndexVar, function.Literal<int>(-1));
+        function.Store(searchingVar, function.TrueBit());
+        function.While(searchingVar, [=](auto& function) {
+            // Try to claim a task without taking the queue mutex
+            this->TryClaimTask(function, workerId, taskIndexVar); // STYLE gcc bug requires `this->` inside generic lambda (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=67274)
+            auto claimedTask = function.Comparison(TypedComparison::greaterThanOrEquals, function.Load(taskIndexVar), function.Literal<int>(0));
+            function.If(claimedTask, [=](auto& function) {
+                function.Store(searchingVar, function.FalseBit());
+            })
+                .Else([=](auto& function) {
+                    // Nothing to claim anywhere --- sleep until more work arrives (or exit on shutdown)
+                    this->LockQueueMutex(function);
+                    function.If(this->GetShutdownFlag(function), [=](auto& function) {
+                        function.Store(searchingVar, function.FalseBit());
+                    })
+                        .Else([=](auto& function) {
+                            // Re-check under the mutex; if work arrived between the claim attempt
+                            // and taking the lock, just go around and claim it
+                            function.If(this->IsEmpty(function), [=](auto& function) {
+                                function.PthreadCondWait(workAvailableCondVar, queueMutex);
+                            });
+                        });
+                    this->UnlockQueueMutex(function);
+                });
         });
 
-        // At loop exit, mutex is locked. Now decrement _count, unlock mutex, and return task at index _count
-        auto newCount = DecrementUnscheduledTasks(function);
-        UnlockQueueMutex(function);
+        // Get task from task array --- passing in a negative number (which is what happens on shutdown) returns a null task
+        return _tasks.GetTask(function, function.Load(taskIndexVar));
+    }
+
+    LLVMValue IRThreadPoolTaskQueue::GetTaskRangePointer(IRFunctionEmitter& function, LLVMValue workerIndex)
+    {
+        assert(IsInitialized());
+        return function.PointerOffset(_taskRanges, workerIndex);
+    }
+
+    void IRThreadPoolTaskQueue::TryClaimTask(IRFunctionEmitter& function, LLVMValue workerId, LLVMValue taskIndexVar)
+    {
+        assert(IsInitialized());
+        auto unscheduledCountPtr = function.GetStructFieldPointer(_queueData, static_cast<int>(Fields::unscheduledCount));
 
-        // Get task from task array --- passing in a negative number (which is what happens if the array was empty) returns a null task
-        return _tasks.GetTask(function, newCount);
+        // Probe each worker's task range, starting with our own. The probes are unrolled here ---
+        // the number of workers is a compile-time constant.
+        for (size_t probe = 0; probe < _numWorkers; ++probe)
+        {
+            auto queueIndex = function.Operator(TypedOperator::moduloSigned, function.Operator(TypedOperator::add, workerId, function.Literal<int>(probe)), function.Literal<int>(_numWorkers));
+            auto rangePtr = GetTaskRangePointer(function, queueIndex);
+            auto notClaimedYet = function.Comparison(TypedComparison::lessThan, function.Load(taskIndexVar), function.Literal<int>(0));
+            function.If(notClaimedYet, [=](auto& function) {
+                auto packedRange = AtomicLoad(function, rangePtr, 8);
+                auto head = function.Operator(TypedOperator::logicalAnd, packedRange, function.Literal(static_cast<int64_t>(0xffffffff)));
+                auto tail = function.Operator(TypedOperator::logicalShiftRight, packedRange, function.Literal(static_cast<int64_t>(32)));
+                function.If(function.Comparison(TypedComparison::lessThan, head, tail), [=](auto& function) {
+                    // Claim the head entry by bumping the head; if another thread got there
+                    // first, the exchange fails and we just keep looking
+                    auto newPackedRange = function.Operator(TypedOperator::add, packedRange, function.Literal(static_cast<int64_t>(1)));
+                    auto success = AtomicCompareExchange(function, rangePtr, packedRange, newPackedRange);
+                    function.If(success, [=](auto& function) {
+                        function.Store(taskIndexVar, function.CastValue(head, VariableType::Int32));
+                        AtomicFetchAdd(function, unscheduledCountPtr, function.Literal<int>(-1));
+                    });
+                });
+            });
+        }
     }
 
     bool IRThreadPoolTaskQueue::IsInitialized() const
@@ -271,10 +488,12 @@ namespace emitters
 
     void IRThreadPoolTaskQueue::ShutDown(IRFunctionEmitter& function)
     {
+        // Set the flag and wake up the threads so they see it is time to shutdown. Holding the
+        // mutex here ensures no thread can check the flag and then sleep through the broadcast.
+        LockQueueMutex(function);
         SetShutdownFlag(function);
-
-        // Now wake up the threads so they see it is time to shutdown.
         function.PthreadCondBroadcast(GetWorkAvailableConditionVariablePointer(function));
+        UnlockQueueMutex(function);
         // Now PopNextTask will emit null tasks
     }
 
@@ -331,14 +550,14 @@ namespace emitters
     {
         assert(IsInitialized());
         auto fieldPtr = function.GetStructFieldPointer(_queueData, static_cast<int>(Fields::unscheduledCount));
-        return function.Load(fieldPtr);
+        return AtomicLoad(function, fieldPtr, 4); // written without the mutex held, so read atomically
     }
 
     LLVMValue IRThreadPoolTaskQueue::GetUnfinishedCount(IRFunctionEmitter& function) const
     {
         assert(IsInitialized());
         auto fieldPtr = function.GetStructFieldPointer(_queueData, static_cast<int>(Fields::unfinishedCount));
-        return function.Load(fieldPtr);
+        return AtomicLoad(function, fieldPtr, 4); // written without the mutex held, so read atomically
     }
 
     void IRThreadPoolTaskQueue::SetInitialCount(IRFunctionEmitter& function, LLVMValue numTasks)
@@ -348,29 +567,12 @@ namespace emitters
         function.Store(function.GetStructFieldPointer(_queueData, static_cast<int>(Fields::unfinishedCount)), numTasks);
     }
 
-    LLVMValue IRThreadPoolTaskQueue::DecrementCountField(IRFunctionEmitter& function, LLVMValue fieldPtr)
-    {
-        auto count = function.Load(fieldPtr);
-        auto newCount = function.Operator(TypedOperator::subtract, count, function.Literal<int>(1));
-        auto isNotZero = function.Comparison(TypedComparison::notEquals, count, function.Literal<int>(0));
-        function.If(isNotZero, [=](auto& function) {
-            function.Store(fieldPtr, newCount);
-        });
-        return newCount;
-    }
-
-    LLVMValue IRThreadPoolTaskQueue::DecrementUnscheduledTasks(IRFunctionEmitter& function)
-    {
-        assert(IsInitialized());
-        auto fieldPtr = function.GetStructFieldPointer(_queueData, static_cast<int>(Fields::unscheduledCount));
-        return DecrementCountField(function, fieldPtr);
-    }
-
     LLVMValue IRThreadPoolTaskQueue::DecrementUnfinishedTasks(IRFunctionEmitter& function)
     {
         assert(IsInitialized());
         auto fieldPtr = function.GetStructFieldPointer(_queueData, static_cast<int>(Fields::unfinishedCount));
-        return DecrementCountField(function, fieldPtr);
+        auto oldCount = AtomicFetchAdd(function, fieldPtr, function.Literal<int>(-1));
+        return function.Operator(TypedOperator::subtract, oldCount, function.Literal<int>(1));
     }
 
     LLVMValue IRThreadPoolTaskQueue::GetShutdownFlag(IRFunctionEmitter& function) const
@@ -466,7 +668,9 @@ namespace emitters
         auto taskArrayDataType = GetTaskArrayDataType(module);
 
         // Allocate our data struct
-        _taskArrayData = module.Global(taskArrayDataType, "taskArrayData");
+        auto taskArrayData = module.Global(taskArrayDataType, "taskArrayData");
+        ApplySharedRuntimeLinkage(module, taskArrayData);
+        _taskArrayData = taskArrayData;
     }
 
     llvm::StructType* IRThreadPoolTaskArray::GetTaskArrayDataType(IRModuleEmitter& module) // TODO: come up with a naming convention for "class" structs like this
@@ -78,6 +78,8 @@ namespace emitters
                 return VariableType::DoublePointer;
             case VariableType::Float:
                 return VariableType::FloatPointer;
+            case VariableType::Float16:
+                return VariableType::Float16Pointer;
             case VariableType::Byte:
                 return VariableType::BytePointer;
             case VariableType::Int16:
@@ -104,6 +106,10 @@ namespace emitters
             {
                 return VariableType::Float;
             }
+            else if (type->isHalfTy())
+            {
+                return VariableType::Float16;
+            }
             else if (type->isIntegerTy())
             {
                 switch (type->getIntegerBitWidth())
@@ -18,6 +18,7 @@
 #include <llvm/Target/TargetMachine.h>
 
 #include <map>
+#include <thread>
 
 namespace ell
 {
@@ -101,6 +102,16 @@ namespace emitters
              } }
         };
 
+        // Capabilities of the cpus named above, for kernel selection and blocking parameters.
+        // Fields: L1 data cache, L2 cache, SIMD register width (bytes), fused multiply-add, cores.
+        const std::map<std::string, DeviceCapabilities> KnownCpuCapabilitiesMap = {
+            { c_pi0Cpu, { 16 * 1024, 128 * 1024, 0, false, 1 } }, // arm1136jf-s: VFP only, no NEON
+            { c_pi3Cpu, { 32 * 1024, 512 * 1024, 16, true, 4 } }, // cortex-a53: NEON with vfpv4 FMA
+            { c_orangePi0Cpu, { 32 * 1024, 512 * 1024, 16, true, 4 } }, // cortex-a7: NEON with vfpv4 FMA
+            { "cortex-m0", { 0, 0, 0, false, 1 } },
+            { "cortex-m4", { 0, 0, 0, false, 1 } }
+        };
+
         const std::map<std::string, std::function<void(TargetDevice&)>> KnownTargetDeviceCpuMap = {
             { "cortex-m0", [](TargetDevice& targetDevice) {
                  targetDevice.triple = "armv6m-unknown-none-eabi";
@@ -150,6 +161,88 @@ namespace emitters
         return tripleObj.getOS() == llvm::Triple::MacOSX || tripleObj.getOS() == llvm::Triple::Darwin;
     }
 
+    bool TargetDevice::IsX86() const
+    {
+        auto tripleObj = GetNormalizedTriple(triple);
+        return tripleObj.getArch() == llvm::Triple::x86 || tripleObj.getArch() == llvm::Triple::x86_64;
+    }
+
+    size_t TargetDevice::GetPreferredAlignment() const
+    {
+        auto tripleObj = GetNormalizedTriple(triple);
+        switch (tripleObj.getArch())
+        {
+        case llvm::Triple::arm:
+        case llvm::Triple::armeb:
+        case llvm::Triple::thumb:
+        case llvm::Triple::thumbeb:
+            return 32; // cache line size on the older 32-bit ARM cores we target
+        default:
+            return 64; // cache line size on x86 and 64-bit ARM, and the widest (512-bit) vector register
+        }
+    }
+
+    DeviceCapabilities GetDeviceCapabilities(const TargetDevice& targetDevice)
+    {
+        auto it = KnownCpuCapabilitiesMap.find(targetDevice.cpu);
+        if (it != KnownCpuCapabilitiesMap.end())
+        {
+            return it->second;
+        }
+
+        // Unknown cpu: derive what we can from the architecture and feature string. For the host
+        // target the feature string is filled in by LLVM, so the SIMD fields are exact.
+        DeviceCapabilities capabilities;
+        auto tripleObj = GetNormalizedTriple(targetDevice.triple);
+        switch (tripleObj.getArch())
+        {
+        case llvm::Triple::x86:
+        case llvm::Triple::x86_64:
+            // SSE2 baseline with typical cache sizes; wider registers and FMA from the feature string
+            capabilities.l1DataCacheSize = 32 * 1024;
+            capabilities.l2CacheSize = 256 * 1024;
+            capabilities.simdRegisterBytes = 16;
+            if (targetDevice.HasFeature("avx512f"))
+            {
+                capabilities.simdRegisterBytes = 64;
+            }
+            else if (targetDevice.HasFeature("avx"))
+            {
+                capabilities.simdRegisterBytes = 32;
+            }
+            capabilities.hasFusedMultiplyAdd = targetDevice.HasFeature("fma");
+            break;
+        case llvm::Triple::aarch64:
+        case llvm::Triple::aarch64_be:
+            // every 64-bit ARM core has NEON with fused multiply-add
+            capabilities.l1DataCacheSize = 32 * 1024;
+            capabilities.l2CacheSize = 512 * 1024;
+            capabilities.simdRegisterBytes = 16;
+            capabilities.hasFusedMultiplyAdd = true;
+            break;
+        case llvm::Triple::arm:
+        case llvm::Triple::armeb:
+        case llvm::Triple::thumb:
+        case llvm::Triple::thumbeb:
+            if (targetDevice.HasFeature("neon"))
+            {
+                capabilities.l1DataCacheSize = 32 * 1024;
+                capabilities.l2CacheSize = 512 * 1024;
+                capabilities.simdRegisterBytes = 16;
+                capabilities.hasFusedMultiplyAdd = targetDevice.HasFeature("vfp4");
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (targetDevice.deviceName == "host")
+        {
+            capabilities.numCores = static_cast<int>(std::thread::hardware_concurrency());
+        }
+        return capabilities;
+    }
+
     TargetDevice GetTargetDevice(std::string deviceName)
     {
         TargetDevice target;
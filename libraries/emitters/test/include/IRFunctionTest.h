@@ -10,4 +10,5 @@
 void TestIRAddFunction();
 void TestCompilableFunction();
 void TestStringCompareFunction();
+void TestVectorWidthDispatchedFunction();
 void TestAllocaPlacement();
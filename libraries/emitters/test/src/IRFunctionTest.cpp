@@ -144,6 +144,30 @@ void TestStringCompareFunction()
                              testing::IsEqual(z, 1));
 }
 
+void TestVectorWidthDispatchedFunction()
+{
+    CompilerOptions options;
+    IRModuleEmitter module("VectorWidthDispatchModule", options);
+
+    NamedVariableTypeList args;
+    args.push_back({ "x", VariableType::Int32 });
+    auto dispatcher = module.GetRuntime().EmitVectorWidthDispatchedFunction("ScaleByVectorWidth", VariableType::Int32, args, [](IRFunctionEmitter& function, int vectorWidthBytes) {
+        auto x = function.LocalScalar(function.GetFunctionArgument("x"));
+        function.Return(x * vectorWidthBytes);
+    });
+    std::string name = dispatcher->getName();
+
+    IRExecutionEngine executionEngine(std::move(module));
+    auto compiledFunction = executionEngine.GetFunction<int(int)>(name);
+
+    // The dispatcher must pick one of the emitted variants (one per SIMD register width) and keep
+    // calling it once the function pointer has been resolved
+    int first = compiledFunction(3);
+    int second = compiledFunction(3);
+    bool validWidth = (first == 3 * 16) || (first == 3 * 32) || (first == 3 * 64);
+    testing::ProcessTest("Testing vector width dispatched function", validWidth && testing::IsEqual(first, second));
+}
+
 void TestAllocaPlacement()
 {
     CompilerOptions options;
@@ -61,6 +61,7 @@ void TestIRFunction()
     TestIRAddFunction();
     TestCompilableFunction();
     TestStringCompareFunction();
+    TestVectorWidthDispatchedFunction();
     TestAllocaPlacement();
 }
 
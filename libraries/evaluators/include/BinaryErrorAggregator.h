@@ -26,6 +26,11 @@ namespace evaluators
         /// <param name="weight"> The weight. </param>
         void Update(double prediction, double label, double weight);
 
+        /// <summary> Adds the contents of another aggregator to this one. </summary>
+        ///
+        /// <param name="other"> The other aggregator. </param>
+        void Merge(const BinaryErrorAggregator& other);
+
         /// <summary> Returns the current value. </summary>
         ///
         /// <returns> The current value. </returns>
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BucketedAUCAggregator.h (evaluators)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace evaluators
+{
+    /// <summary> An evaluation aggregator that computes a streaming approximation of AUC. Instead of
+    /// buffering every prediction and sorting, predictions are accumulated into a fixed-resolution
+    /// score histogram, so the aggregator uses constant memory and can process an unbounded stream.
+    /// Two aggregators with the same bucket configuration can be merged, which makes the computation
+    /// shardable. The approximation treats predictions that fall into the same bucket as ties, and
+    /// ties are resolved pessimistically, consistent with AUCAggregator. </summary>
+    class BucketedAUCAggregator
+    {
+    public:
+        /// <summary> Constructs an instance of BucketedAUCAggregator. </summary>
+        ///
+        /// <param name="numBuckets"> The number of histogram buckets; more buckets give a finer approximation. </param>
+        /// <param name="minScore"> The prediction value mapped to the first bucket; smaller predictions are clamped. </param>
+        /// <param name="maxScore"> The prediction value mapped to the last bucket; larger predictions are clamped. </param>
+        BucketedAUCAggregator(size_t numBuckets = 1000, double minScore = -1.0, double maxScore = 1.0);
+
+        /// <summary> Updates this aggregator. </summary>
+        ///
+        /// <param name="prediction"> The real valued prediction. </param>
+        /// <param name="label"> The label. </param>
+        /// <param name="weight"> The weight. </param>
+        void Update(double prediction, double label, double weight);
+
+        /// <summary> Adds the contents of another aggregator with the same bucket configuration to this one. </summary>
+        ///
+        /// <param name="other"> The other aggregator. </param>
+        void Merge(const BucketedAUCAggregator& other);
+
+        /// <summary> Returns the current value. </summary>
+        ///
+        /// <returns> The current value. </returns>
+        std::vector<double> GetResult() const;
+
+        /// <summary> Resets the aggregator to its initial state. </summary>
+        void Reset();
+
+        /// <summary> Gets a header that describes the values of this aggregator. </summary>
+        ///
+        /// <returns> The header string vector. </returns>
+        std::vector<std::string> GetValueNames() const;
+
+    private:
+        size_t GetBucketIndex(double prediction) const;
+
+        double _minScore;
+        double _maxScore;
+        std::vector<double> _positiveWeights;
+        std::vector<double> _negativeWeights;
+    };
+} // namespace evaluators
+} // namespace ell
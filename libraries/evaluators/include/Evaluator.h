@@ -15,9 +15,12 @@
 
 #include <utilities/include/FunctionUtils.h>
 
+#include <algorithm>
 #include <functional>
+#include <future>
 #include <memory>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace ell
@@ -54,6 +57,10 @@ namespace evaluators
     {
         size_t evaluationFrequency;
         bool addZeroEvaluation;
+
+        // number of threads used to evaluate the dataset; each thread aggregates a contiguous shard
+        // of the examples and the shards are merged in order, so the result does not depend on timing
+        size_t numThreads = 1;
     };
 
     /// <summary> Implements an evaluator that holds a data set and a set of evaluation aggregators. </summary>
@@ -145,6 +152,12 @@ namespace evaluators
         template <std::size_t... Sequence>
         void DispatchUpdate(double prediction, double label, double weight, std::index_sequence<Sequence...>);
 
+        template <std::size_t... Sequence>
+        static void DispatchUpdate(std::tuple<AggregatorTypes...>& aggregatorTuple, double prediction, double label, double weight, std::index_sequence<Sequence...>);
+
+        template <std::size_t... Sequence>
+        void DispatchMerge(std::tuple<AggregatorTypes...>& other, std::index_sequence<Sequence...>);
+
         template <std::size_t... Sequence>
         void Aggregate(std::index_sequence<Sequence...>);
 
@@ -181,6 +194,17 @@ namespace ell
 {
 namespace evaluators
 {
+    /// <summary> Detects whether a predictor type has a batched Predict overload that takes a dataset. </summary>
+    template <typename PredictorType, typename DatasetType, typename = void>
+    struct HasBatchedPredict : std::false_type
+    {
+    };
+
+    template <typename PredictorType, typename DatasetType>
+    struct HasBatchedPredict<PredictorType, DatasetType, std::void_t<decltype(std::declval<const PredictorType&>().Predict(std::declval<const DatasetType&>()))>> : std::true_type
+    {
+    };
+
     template <typename PredictorType, typename... AggregatorTypes>
     Evaluator<PredictorType, AggregatorTypes...>::Evaluator(const data::AnyDataset& anyDataset, const EvaluatorParameters& evaluatorParameters, AggregatorTypes... aggregators) :
         _dataset(anyDataset),
@@ -204,18 +228,76 @@ namespace evaluators
             return;
         }
 
-        auto iterator = _dataset.GetExampleReferenceIterator();
+        size_t numExamples = _dataset.NumExamples();
+        size_t numThreads = std::min(std::max<size_t>(_evaluatorParameters.numThreads, 1), std::max<size_t>(numExamples, 1));
+        if (numThreads > 1)
+        {
+            // each thread runs its own copy of the predictor over a contiguous shard of the
+            // examples with its own copy of the aggregators; the shards are then merged in order.
+            // The predictor is copied because concurrent calls to const Predict on one shared
+            // instance are not an established contract across predictor types (some maintain
+            // internal caches)
+            std::vector<std::tuple<AggregatorTypes...>> shardAggregators(numThreads, _aggregatorTuple);
+            std::vector<std::future<void>> futures;
+            size_t blockSize = numExamples / numThreads;
+            size_t remainder = numExamples % numThreads;
+            size_t start = 0;
+            for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+            {
+                size_t size = blockSize + (threadIndex < remainder ? 1 : 0);
+                futures.push_back(std::async(std::launch::async, [this, predictor, &shardAggregators, threadIndex, start, size] {
+                    auto& aggregators = shardAggregators[threadIndex];
+                    for (size_t index = start; index < start + size; ++index)
+                    {
+                        const auto& example = _dataset.GetExample(index);
+
+                        double weight = example.GetMetadata().weight;
+                        double label = example.GetMetadata().label;
+                        double prediction = predictor.Predict(example.GetDataVector());
+
+                        DispatchUpdate(aggregators, prediction, label, weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
+                    }
+                }));
+                start += size;
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+            for (auto& aggregators : shardAggregators)
+            {
+                DispatchMerge(aggregators, std::make_index_sequence<sizeof...(AggregatorTypes)>());
+            }
+        }
+        else if constexpr (HasBatchedPredict<PredictorType, data::Dataset<ExampleType>>::value)
+        {
+            // predictors with a batched Predict evaluate the whole dataset at once
+            auto predictions = predictor.Predict(_dataset);
+            for (size_t index = 0; index < _dataset.NumExamples(); ++index)
+            {
+                const auto& example = _dataset.GetExample(index);
 
-        while (iterator.IsValid())
+                double weight = example.GetMetadata().weight;
+                double label = example.GetMetadata().label;
+
+                DispatchUpdate(static_cast<double>(predictions[index]), label, weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
+            }
+        }
+        else
         {
-            const auto& example = iterator.Get();
+            auto iterator = _dataset.GetExampleReferenceIterator();
 
-            double weight = example.GetMetadata().weight;
-            double label = example.GetMetadata().label;
-            double prediction = predictor.Predict(example.GetDataVector());
+            while (iterator.IsValid())
+            {
+                const auto& example = iterator.Get();
 
-            DispatchUpdate(prediction, label, weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
-            iterator.Next();
+                double weight = example.GetMetadata().weight;
+                double label = example.GetMetadata().label;
+                double prediction = predictor.Predict(example.GetDataVector());
+
+                DispatchUpdate(prediction, label, weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
+                iterator.Next();
+            }
         }
         Aggregate(std::make_index_sequence<sizeof...(AggregatorTypes)>());
     }
@@ -277,7 +359,7 @@ namespace evaluators
     template <typename PredictorType, typename... AggregatorTypes>
     void Evaluator<PredictorType, AggregatorTypes...>::EvaluateZero()
     {
-        auto iterator = _dataset.GetExampleIterator();
+        auto iterator = _dataset.GetExampleReferenceIterator();
 
         while (iterator.IsValid())
         {
@@ -345,6 +427,23 @@ namespace evaluators
         // [this, prediction, label, weight]() { std::get<Sequence>(_aggregatorTuple).Update(prediction, label, weight); }...); // GCC bug prevents compilation
     }
 
+    template <typename PredictorType, typename... AggregatorTypes>
+    template <std::size_t... Sequence>
+    void Evaluator<PredictorType, AggregatorTypes...>::DispatchUpdate(std::tuple<AggregatorTypes...>& aggregatorTuple, double prediction, double label, double weight, std::index_sequence<Sequence...>)
+    {
+        // Call (X.Update(), 0) for each X in aggregatorTuple
+        ElementUpdaterParameters params{ prediction, label, weight };
+        utilities::InOrderFunctionEvaluator(ElementUpdater<AggregatorType<Sequence>>(std::get<Sequence>(aggregatorTuple), params)...);
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    template <std::size_t... Sequence>
+    void Evaluator<PredictorType, AggregatorTypes...>::DispatchMerge(std::tuple<AggregatorTypes...>& other, std::index_sequence<Sequence...>)
+    {
+        // Call X.Merge(Y) for each X in _aggregatorTuple and the corresponding Y in other
+        (std::get<Sequence>(_aggregatorTuple).Merge(std::get<Sequence>(other)), ...);
+    }
+
     template <typename PredictorType, typename... AggregatorTypes>
     template <std::size_t... Sequence>
     void Evaluator<PredictorType, AggregatorTypes...>::Aggregate(std::index_sequence<Sequence...>)
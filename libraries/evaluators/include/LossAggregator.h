@@ -34,6 +34,11 @@ namespace evaluators
         /// <param name="weight"> The weight. </param>
         void Update(double prediction, double label, double weight);
 
+        /// <summary> Adds the contents of another aggregator to this one. </summary>
+        ///
+        /// <param name="other"> The other aggregator. </param>
+        void Merge(const LossAggregator<LossFunctionType>& other);
+
         /// <summary> Returns the current value. </summary>
         ///
         /// <returns> The current value. </returns>
@@ -78,6 +83,13 @@ namespace evaluators
         _sumWeightedLosses += weight * loss;
     }
 
+    template <typename LossFunctionType>
+    void LossAggregator<LossFunctionType>::Merge(const LossAggregator<LossFunctionType>& other)
+    {
+        _sumWeights += other._sumWeights;
+        _sumWeightedLosses += other._sumWeightedLosses;
+    }
+
     template <typename LossFunctionType>
     std::vector<double> LossAggregator<LossFunctionType>::GetResult() const
     {
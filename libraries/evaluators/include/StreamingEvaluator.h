@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     StreamingEvaluator.h (evaluators)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Evaluator.h"
+
+#include <data/include/Example.h>
+
+#include <utilities/include/Exception.h>
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace ell
+{
+namespace evaluators
+{
+    /// <summary>
+    /// Implements an evaluator over a bounded window of recent examples, for tracking rolling
+    /// accuracy over an unbounded prediction stream. Unlike Evaluator, it does not hold a dataset:
+    /// examples are pushed in one at a time and only the most recent windowSize of them are
+    /// retained, so memory use is O(windowSize) no matter how long the stream runs. Each
+    /// evaluation runs the predictor over the current window. The aggregators keep their Merge
+    /// operation, so windows tracked on different devices can still be combined.
+    /// </summary>
+    ///
+    /// <typeparam name="PredictorType"> The predictor type. </typeparam>
+    /// <typeparam name="AggregatorTypes"> The aggregator types. </typeparam>
+    template <typename PredictorType, typename... AggregatorTypes>
+    class StreamingEvaluator : public IEvaluator<PredictorType>
+    {
+    public:
+        // the type of example used by this evaluator
+        using ExampleType = data::Example<typename PredictorType::DataVectorType, data::WeightLabel>;
+
+        /// <summary> Constructs an instance of StreamingEvaluator with a given window size and given aggregators. </summary>
+        ///
+        /// <param name="windowSize"> The number of most recent examples to retain. </param>
+        /// <param name="evaluatorParameters"> The evaluation parameters (addZeroEvaluation is ignored, since the window starts out empty). </param>
+        /// <param name="aggregators"> The aggregators. </param>
+        StreamingEvaluator(size_t windowSize, const EvaluatorParameters& evaluatorParameters, AggregatorTypes... aggregators);
+
+        /// <summary> Adds an example to the window, evicting the oldest retained example if the window is full. </summary>
+        ///
+        /// <param name="example"> The example. </param>
+        void AddExample(ExampleType example);
+
+        /// <summary> Gets the number of examples currently in the window. </summary>
+        ///
+        /// <returns> The number of retained examples, at most the window size. </returns>
+        size_t NumExamples() const { return _window.size(); }
+
+        /// <summary> Runs the given predictor on the current window, invokes each of the aggregators on the output, and logs the result. </summary>
+        ///
+        /// <param name="predictor"> The predictor. </param>
+        void Evaluate(const PredictorType& predictor) override;
+
+        /// <summary> Gets the goodness of the most recent evaluation, according to the first aggregator. </summary>
+        ///
+        /// <returns> The goodness of the most recent evaluation. </returns>
+        double GetGoodness() const override;
+
+        /// <summary> Returns a vector of names that describe the evaluation values represented in this StreamingEvaluator. </summary>
+        ///
+        /// <returns> A vector of names. </returns>
+        std::vector<std::vector<std::string>> GetValueNames() const;
+
+        /// <summary> Returns a constant reference to a datastructure V, where V[i][j][k] is the k'th value
+        /// produced by the j'th aggregator on the i'th evaluation. </summary>
+        ///
+        /// <returns> A reference to the evaluation values. </returns>
+        const std::vector<std::vector<std::vector<double>>>& GetValues() const { return _values; }
+
+        /// <summary> Prints the logged evaluations to an output stream. </summary>
+        ///
+        /// <param name="os"> [in,out] The output stream. </param>
+        void Print(std::ostream& os) const override;
+
+    private:
+        template <std::size_t... Sequence>
+        void DispatchUpdate(double prediction, double label, double weight, std::index_sequence<Sequence...>);
+
+        template <std::size_t... Sequence>
+        void Aggregate(std::index_sequence<Sequence...>);
+
+        template <std::size_t... Sequence>
+        std::vector<std::vector<std::string>> DispatchGetValueNames(std::index_sequence<Sequence...>) const;
+
+        // member variables
+        size_t _windowSize;
+        EvaluatorParameters _evaluatorParameters;
+        size_t _evaluateCounter = 0;
+
+        // ring buffer of the most recent examples: grows up to _windowSize, then _oldest marks the
+        // next slot to overwrite
+        std::vector<ExampleType> _window;
+        size_t _oldest = 0;
+
+        typename std::tuple<AggregatorTypes...> _aggregatorTuple;
+        std::vector<std::vector<std::vector<double>>> _values;
+    };
+
+    /// <summary> Makes a streaming evaluator. </summary>
+    ///
+    /// <typeparam name="PredictorType"> The predictor type. </typeparam>
+    /// <typeparam name="AggregatorTypes"> The Aggregator types. </typeparam>
+    /// <param name="windowSize"> The number of most recent examples to retain. </param>
+    /// <param name="evaluatorParameters"> The evaluation parameters. </param>
+    /// <param name="aggregators"> The aggregators. </param>
+    ///
+    /// <returns> A shared_ptr to a StreamingEvaluator. </returns>
+    template <typename PredictorType, typename... AggregatorTypes>
+    std::shared_ptr<StreamingEvaluator<PredictorType, AggregatorTypes...>> MakeStreamingEvaluator(size_t windowSize, const EvaluatorParameters& evaluatorParameters, AggregatorTypes... aggregators);
+} // namespace evaluators
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace evaluators
+{
+    template <typename PredictorType, typename... AggregatorTypes>
+    StreamingEvaluator<PredictorType, AggregatorTypes...>::StreamingEvaluator(size_t windowSize, const EvaluatorParameters& evaluatorParameters, AggregatorTypes... aggregators) :
+        _windowSize(windowSize),
+        _evaluatorParameters(evaluatorParameters),
+        _aggregatorTuple(std::make_tuple(aggregators...))
+    {
+        static_assert(sizeof...(AggregatorTypes) > 0, "StreamingEvaluator must contain at least one aggregator");
+
+        if (_windowSize == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "StreamingEvaluator window size must be positive");
+        }
+        _window.reserve(_windowSize);
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    void StreamingEvaluator<PredictorType, AggregatorTypes...>::AddExample(ExampleType example)
+    {
+        if (_window.size() < _windowSize)
+        {
+            _window.push_back(std::move(example));
+        }
+        else
+        {
+            _window[_oldest] = std::move(example);
+            _oldest = (_oldest + 1) % _windowSize;
+        }
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    void StreamingEvaluator<PredictorType, AggregatorTypes...>::Evaluate(const PredictorType& predictor)
+    {
+        ++_evaluateCounter;
+        if (_evaluateCounter % _evaluatorParameters.evaluationFrequency != 0)
+        {
+            return;
+        }
+
+        for (const auto& example : _window)
+        {
+            double weight = example.GetMetadata().weight;
+            double label = example.GetMetadata().label;
+            double prediction = predictor.Predict(example.GetDataVector());
+
+            DispatchUpdate(prediction, label, weight, std::make_index_sequence<sizeof...(AggregatorTypes)>());
+        }
+        Aggregate(std::make_index_sequence<sizeof...(AggregatorTypes)>());
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    double StreamingEvaluator<PredictorType, AggregatorTypes...>::GetGoodness() const
+    {
+        if (_values.size() == 0)
+        {
+            return 0.0;
+        }
+        return _values.back()[0][0];
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    void StreamingEvaluator<PredictorType, AggregatorTypes...>::Print(std::ostream& os) const
+    {
+        auto originalPrecision = os.precision(6);
+        auto originalFlags = os.setf(std::ios::fixed);
+
+        PrintVector(os, FlattenJaggedVector(GetValueNames()));
+
+        for (const auto& values : _values)
+        {
+            os << std::endl;
+            PrintVector(os, FlattenJaggedVector(values));
+        }
+
+        os.setf(originalFlags);
+        os.precision(originalPrecision);
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    template <std::size_t... Sequence>
+    void StreamingEvaluator<PredictorType, AggregatorTypes...>::DispatchUpdate(double prediction, double label, double weight, std::index_sequence<Sequence...>)
+    {
+        // Call X.Update() for each X in _aggregatorTuple
+        (std::get<Sequence>(_aggregatorTuple).Update(prediction, label, weight), ...);
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    template <std::size_t... Sequence>
+    void StreamingEvaluator<PredictorType, AggregatorTypes...>::Aggregate(std::index_sequence<Sequence...>)
+    {
+        // Call X.GetResult() for each X in _aggregatorTuple
+        _values.push_back({ std::get<Sequence>(_aggregatorTuple).GetResult()... });
+
+        // Call X.Reset() for each X in _aggregatorTuple
+        (std::get<Sequence>(_aggregatorTuple).Reset(), ...);
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    std::vector<std::vector<std::string>> StreamingEvaluator<PredictorType, AggregatorTypes...>::GetValueNames() const
+    {
+        return DispatchGetValueNames(std::make_index_sequence<sizeof...(AggregatorTypes)>());
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    template <std::size_t... Sequence>
+    std::vector<std::vector<std::string>> StreamingEvaluator<PredictorType, AggregatorTypes...>::DispatchGetValueNames(std::index_sequence<Sequence...>) const
+    {
+        return { std::get<Sequence>(_aggregatorTuple).GetValueNames()... };
+    }
+
+    template <typename PredictorType, typename... AggregatorTypes>
+    std::shared_ptr<StreamingEvaluator<PredictorType, AggregatorTypes...>> MakeStreamingEvaluator(size_t windowSize, const EvaluatorParameters& evaluatorParameters, AggregatorTypes... aggregators)
+    {
+        return std::make_shared<StreamingEvaluator<PredictorType, AggregatorTypes...>>(windowSize, evaluatorParameters, aggregators...);
+    }
+} // namespace evaluators
+} // namespace ell
+
+#pragma endregion implementation
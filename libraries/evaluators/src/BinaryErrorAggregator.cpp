@@ -38,6 +38,14 @@ namespace evaluators
         }
     }
 
+    void BinaryErrorAggregator::Merge(const BinaryErrorAggregator& other)
+    {
+        _sumTruePositives += other._sumTruePositives;
+        _sumTrueNegatives += other._sumTrueNegatives;
+        _sumFalsePositives += other._sumFalsePositives;
+        _sumFalseNegatives += other._sumFalseNegatives;
+    }
+
     std::vector<double> BinaryErrorAggregator::GetResult() const
     {
         double allFalse = _sumFalsePositives + _sumFalseNegatives;
@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BucketedAUCAggregator.cpp (evaluators)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BucketedAUCAggregator.h"
+
+#include <utilities/include/Exception.h>
+
+#include <algorithm>
+
+namespace ell
+{
+namespace evaluators
+{
+    BucketedAUCAggregator::BucketedAUCAggregator(size_t numBuckets, double minScore, double maxScore) :
+        _minScore(minScore),
+        _maxScore(maxScore),
+        _positiveWeights(numBuckets),
+        _negativeWeights(numBuckets)
+    {
+        if (numBuckets == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "number of buckets must be positive");
+        }
+        if (!(minScore < maxScore))
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "min score must be smaller than max score");
+        }
+    }
+
+    void BucketedAUCAggregator::Update(double prediction, double label, double weight)
+    {
+        size_t bucketIndex = GetBucketIndex(prediction);
+        if (label <= 0)
+        {
+            _negativeWeights[bucketIndex] += weight;
+        }
+        else
+        {
+            _positiveWeights[bucketIndex] += weight;
+        }
+    }
+
+    void BucketedAUCAggregator::Merge(const BucketedAUCAggregator& other)
+    {
+        if (other._positiveWeights.size() != _positiveWeights.size() || other._minScore != _minScore || other._maxScore != _maxScore)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "can only merge aggregators with the same bucket configuration");
+        }
+
+        for (size_t i = 0; i < _positiveWeights.size(); ++i)
+        {
+            _positiveWeights[i] += other._positiveWeights[i];
+            _negativeWeights[i] += other._negativeWeights[i];
+        }
+    }
+
+    std::vector<double> BucketedAUCAggregator::GetResult() const
+    {
+        // collect statistics, visiting buckets in increasing score order; positives in a bucket get
+        // credit only for negatives in strictly smaller buckets, which is the pessimistic tie
+        // handling used by AUCAggregator
+        double sumPositiveWeights = 0.0;
+        double sumNegativeWeights = 0.0;
+        double sumOrderedWeights = 0.0;
+
+        for (size_t i = 0; i < _positiveWeights.size(); ++i)
+        {
+            sumPositiveWeights += _positiveWeights[i];
+            sumOrderedWeights += sumNegativeWeights * _positiveWeights[i];
+            sumNegativeWeights += _negativeWeights[i];
+        }
+
+        // calcluate the AUC
+        double auc = 0.0;
+        if (sumPositiveWeights > 0 && sumNegativeWeights > 0)
+        {
+            auc = sumOrderedWeights / sumPositiveWeights / sumNegativeWeights;
+        }
+
+        return { auc };
+    }
+
+    void BucketedAUCAggregator::Reset()
+    {
+        std::fill(_positiveWeights.begin(), _positiveWeights.end(), 0.0);
+        std::fill(_negativeWeights.begin(), _negativeWeights.end(), 0.0);
+    }
+
+    std::vector<std::string> BucketedAUCAggregator::GetValueNames() const
+    {
+        return { "AUC" };
+    }
+
+    size_t BucketedAUCAggregator::GetBucketIndex(double prediction) const
+    {
+        if (prediction <= _minScore)
+        {
+            return 0;
+        }
+        if (prediction >= _maxScore)
+        {
+            return _positiveWeights.size() - 1;
+        }
+        // the min guards against floating point rounding pushing a score just below the max into a bucket past the end
+        return std::min(static_cast<size_t>((prediction - _minScore) / (_maxScore - _minScore) * _positiveWeights.size()), _positiveWeights.size() - 1);
+    }
+} // namespace evaluators
+} // namespace ell
@@ -13,14 +13,18 @@
 #include <predictors/include/LinearPredictor.h>
 
 #include <evaluators/include/AUCAggregator.h>
+#include <evaluators/include/BucketedAUCAggregator.h>
 #include <evaluators/include/Evaluator.h>
 #include <evaluators/include/LossAggregator.h>
+#include <evaluators/include/StreamingEvaluator.h>
 
 #include <functions/include/SquaredLoss.h>
 
 #include <testing/include/testing.h>
 
 #include <iostream>
+#include <tuple>
+#include <vector>
 
 namespace ell
 {
@@ -44,5 +48,67 @@ void TestEvaluators()
     std::cout << "\n";
     std::cout << "Goodness: " << evaluator->GetGoodness() << std::endl;
     testing::ProcessTest("Evaluator sanity check", !testing::IsEqual(evaluator->GetGoodness(), 0.0, 1e-8));
+
+    // parallel evaluation shards the dataset across threads and merges per-thread aggregators;
+    // the results must match the serial evaluation
+    data::DenseSupervisedDataset largerDataset;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        double x = 0.02 * i - 1.0;
+        largerDataset.AddExample(ExampleType{ { x, -x }, data::WeightLabel{ 1.0, (i % 3 == 0) ? 1.0 : -1.0 } });
+    }
+    evaluators::EvaluatorParameters serialParams{ 1, false };
+    evaluators::EvaluatorParameters parallelParams{ 1, false, 4 };
+    auto serialEvaluator = evaluators::MakeEvaluator<predictors::LinearPredictor<double>>(largerDataset.GetAnyDataset(), serialParams, evaluators::BinaryErrorAggregator(), evaluators::AUCAggregator(), evaluators::MakeLossAggregator(functions::SquaredLoss()));
+    auto parallelEvaluator = evaluators::MakeEvaluator<predictors::LinearPredictor<double>>(largerDataset.GetAnyDataset(), parallelParams, evaluators::BinaryErrorAggregator(), evaluators::AUCAggregator(), evaluators::MakeLossAggregator(functions::SquaredLoss()));
+    serialEvaluator->Evaluate(predictor);
+    parallelEvaluator->Evaluate(predictor);
+    testing::ProcessTest("Parallel evaluator", testing::IsEqual(parallelEvaluator->GetGoodness(), serialEvaluator->GetGoodness(), 1e-12));
+
+    // the bucketed streaming AUC must agree with the exact AUC when predictions land in distinct buckets
+    evaluators::AUCAggregator exactAUC;
+    evaluators::BucketedAUCAggregator bucketedAUC(100, -1.0, 1.0);
+    std::vector<std::tuple<double, double, double>> updates{ { -0.9, -1.0, 1.0 }, { -0.5, 1.0, 2.0 }, { -0.1, -1.0, 1.0 }, { 0.3, 1.0, 1.0 }, { 0.7, -1.0, 0.5 }, { 0.9, 1.0, 1.0 } };
+    for (const auto& update : updates)
+    {
+        exactAUC.Update(std::get<0>(update), std::get<1>(update), std::get<2>(update));
+        bucketedAUC.Update(std::get<0>(update), std::get<1>(update), std::get<2>(update));
+    }
+    testing::ProcessTest("Bucketed AUC aggregator", testing::IsEqual(bucketedAUC.GetResult()[0], exactAUC.GetResult()[0], 1e-8));
+
+    // merging two shards must give the same result as aggregating everything in one shard
+    evaluators::BucketedAUCAggregator shardA(100, -1.0, 1.0);
+    evaluators::BucketedAUCAggregator shardB(100, -1.0, 1.0);
+    for (size_t i = 0; i < updates.size(); ++i)
+    {
+        auto& shard = (i % 2 == 0) ? shardA : shardB;
+        shard.Update(std::get<0>(updates[i]), std::get<1>(updates[i]), std::get<2>(updates[i]));
+    }
+    shardA.Merge(shardB);
+    testing::ProcessTest("Bucketed AUC aggregator merge", testing::IsEqual(shardA.GetResult()[0], bucketedAUC.GetResult()[0], 1e-12));
+
+    // a streaming evaluator fed past its window capacity must agree with a plain evaluator
+    // over just the examples it retained
+    const size_t windowSize = 3;
+    using StreamExampleType = data::AutoSupervisedDataset::DatasetExampleType;
+    auto streamingEvaluator = evaluators::MakeStreamingEvaluator<predictors::LinearPredictor<double>>(windowSize, evaluators::EvaluatorParameters{ 1, false }, evaluators::BinaryErrorAggregator(), evaluators::MakeLossAggregator(functions::SquaredLoss()));
+    std::vector<StreamExampleType> stream;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        double x = 0.5 * i - 1.0;
+        stream.push_back(StreamExampleType{ { x, -0.5 * x }, data::WeightLabel{ 1.0, (i % 2 == 0) ? 1.0 : -1.0 } });
+        streamingEvaluator->AddExample(stream.back());
+    }
+    testing::ProcessTest("Streaming evaluator window size", streamingEvaluator->NumExamples() == windowSize);
+
+    data::AutoSupervisedDataset retainedDataset;
+    for (size_t i = stream.size() - windowSize; i < stream.size(); ++i)
+    {
+        retainedDataset.AddExample(stream[i]);
+    }
+    auto retainedEvaluator = evaluators::MakeEvaluator<predictors::LinearPredictor<double>>(retainedDataset.GetAnyDataset(), evaluators::EvaluatorParameters{ 1, false }, evaluators::BinaryErrorAggregator(), evaluators::MakeLossAggregator(functions::SquaredLoss()));
+    streamingEvaluator->Evaluate(predictor);
+    retainedEvaluator->Evaluate(predictor);
+    testing::ProcessTest("Streaming evaluator window", testing::IsEqual(streamingEvaluator->GetGoodness(), retainedEvaluator->GetGoodness(), 1e-12));
 }
 } // namespace ell
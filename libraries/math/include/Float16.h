@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Float16.h (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary>
+    /// A 16-bit IEEE 754 floating point storage type. Values are stored in half precision, which
+    /// halves the memory footprint and bandwidth of weight storage, but all arithmetic takes place
+    /// in single precision: reading a Float16 converts it to float and assigning a float rounds it
+    /// to the nearest representable half (ties to even). Values whose magnitude exceeds the half
+    /// precision range become infinite, and values that are too small to represent flush to zero.
+    /// </summary>
+    class Float16
+    {
+    public:
+        Float16() = default;
+
+        /// <summary> Constructs a Float16 by rounding a float to the nearest representable half. </summary>
+        ///
+        /// <param name="value"> The single precision value to store. </param>
+        Float16(float value);
+
+        /// <summary> Converts the stored value to single precision. </summary>
+        ///
+        /// <returns> The stored value, as a float. </returns>
+        operator float() const;
+
+        /// @{
+        /// <summary> Compound assignment operators. The operation is performed in single precision
+        /// and the result is rounded back to half precision. </summary>
+        ///
+        /// <param name="value"> The right-hand-side operand. </param>
+        ///
+        /// <returns> A reference to this Float16. </returns>
+        Float16& operator+=(float value);
+        Float16& operator-=(float value);
+        Float16& operator*=(float value);
+        Float16& operator/=(float value);
+        /// @}
+
+        /// <summary> Constructs a Float16 from a raw half precision bit pattern. </summary>
+        ///
+        /// <param name="bits"> The bit pattern. </param>
+        ///
+        /// <returns> A Float16 that stores the given bit pattern. </returns>
+        static Float16 FromBits(uint16_t bits);
+
+        /// <summary> Gets the raw half precision bit pattern. </summary>
+        ///
+        /// <returns> The bit pattern. </returns>
+        uint16_t GetBits() const { return _bits; }
+
+    private:
+        uint16_t _bits = 0;
+    };
+} // namespace math
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace math
+{
+    namespace Internal
+    {
+        inline uint16_t FloatToHalfBits(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+            uint32_t exponent = (bits >> 23) & 0xff;
+            uint32_t mantissa = bits & 0x7fffff;
+
+            if (exponent == 0xff)
+            {
+                // infinity or NaN - preserve the NaN payload's top bits, and make sure a NaN stays a NaN
+                return sign | 0x7c00 | (mantissa != 0 ? (0x200 | (mantissa >> 13)) : 0);
+            }
+
+            int halfExponent = static_cast<int>(exponent) - 127 + 15;
+            if (halfExponent >= 0x1f)
+            {
+                // overflow - round to infinity
+                return sign | 0x7c00;
+            }
+
+            if (halfExponent <= 0)
+            {
+                if (halfExponent < -11)
+                {
+                    // too small for a subnormal - flush to zero
+                    return sign;
+                }
+
+                // subnormal - shift the mantissa (with its implicit leading bit) into place and round to nearest even
+                mantissa |= 0x800000;
+                uint32_t shift = static_cast<uint32_t>(14 - halfExponent);
+                uint16_t result = sign | static_cast<uint16_t>(mantissa >> shift);
+                uint32_t remainder = mantissa & ((1u << shift) - 1);
+                uint32_t halfway = 1u << (shift - 1);
+                if (remainder > halfway || (remainder == halfway && (result & 1) != 0))
+                {
+                    ++result;
+                }
+                return result;
+            }
+
+            // normal - drop the low 13 mantissa bits and round to nearest even (a carry out of the
+            // mantissa correctly increments the exponent, including a carry into infinity)
+            uint16_t result = sign | static_cast<uint16_t>(halfExponent << 10) | static_cast<uint16_t>(mantissa >> 13);
+            uint32_t remainder = mantissa & 0x1fff;
+            if (remainder > 0x1000 || (remainder == 0x1000 && (result & 1) != 0))
+            {
+                ++result;
+            }
+            return result;
+        }
+
+        inline float HalfBitsToFloat(uint16_t halfBits)
+        {
+            uint32_t sign = static_cast<uint32_t>(halfBits & 0x8000) << 16;
+            uint32_t exponent = (halfBits >> 10) & 0x1f;
+            uint32_t mantissa = halfBits & 0x3ff;
+
+            uint32_t bits;
+            if (exponent == 0x1f)
+            {
+                // infinity or NaN
+                bits = sign | 0x7f800000 | (mantissa << 13);
+            }
+            else if (exponent == 0)
+            {
+                if (mantissa == 0)
+                {
+                    // zero
+                    bits = sign;
+                }
+                else
+                {
+                    // subnormal - normalize, since every half subnormal is a normal float
+                    int floatExponent = 1;
+                    while ((mantissa & 0x400) == 0)
+                    {
+                        mantissa <<= 1;
+                        --floatExponent;
+                    }
+                    mantissa &= 0x3ff;
+                    bits = sign | (static_cast<uint32_t>(floatExponent - 15 + 127) << 23) | (mantissa << 13);
+                }
+            }
+            else
+            {
+                // normal
+                bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+            }
+
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    } // namespace Internal
+
+    inline Float16::Float16(float value) :
+        _bits(Internal::FloatToHalfBits(value))
+    {
+    }
+
+    inline Float16::operator float() const
+    {
+        return Internal::HalfBitsToFloat(_bits);
+    }
+
+    inline Float16& Float16::operator+=(float value)
+    {
+        *this = static_cast<float>(*this) + value;
+        return *this;
+    }
+
+    inline Float16& Float16::operator-=(float value)
+    {
+        *this = static_cast<float>(*this) - value;
+        return *this;
+    }
+
+    inline Float16& Float16::operator*=(float value)
+    {
+        *this = static_cast<float>(*this) * value;
+        return *this;
+    }
+
+    inline Float16& Float16::operator/=(float value)
+    {
+        *this = static_cast<float>(*this) / value;
+        return *this;
+    }
+
+    inline Float16 Float16::FromBits(uint16_t bits)
+    {
+        Float16 result;
+        result._bits = bits;
+        return result;
+    }
+} // namespace math
+} // namespace ell
+
+#pragma endregion implementation
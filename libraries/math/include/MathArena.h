@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MathArena.h (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary>
+    /// A scoped bump allocator for math temporaries. While a `MathArena` is alive, containers that
+    /// use `ArenaAllocator` carve their storage out of the arena's contiguous block instead of
+    /// calling into the global allocator, and individual deallocations are no-ops. A hot loop can
+    /// call `Reset()` once per iteration to reclaim all of its temporaries at once.
+    ///
+    /// Arenas nest: constructing a second arena makes it the current one until it is destroyed.
+    /// Containers allocated from an arena must not outlive it. If an arena fills up, allocations
+    /// fall back to the heap and are freed normally.
+    /// </summary>
+    class MathArena
+    {
+    public:
+        /// <summary> Constructor. Makes this the current arena for the calling thread. </summary>
+        ///
+        /// <param name="capacity"> The size of the arena's block, in bytes. </param>
+        explicit MathArena(size_t capacity) :
+            _buffer(new char[capacity]),
+            _capacity(capacity),
+            _previous(CurrentArena())
+        {
+            CurrentArena() = this;
+        }
+
+        /// <summary> Destructor. Restores the previously-current arena. </summary>
+        ~MathArena() { CurrentArena() = _previous; }
+
+        MathArena(const MathArena&) = delete;
+        MathArena& operator=(const MathArena&) = delete;
+
+        /// <summary> Reclaims all memory allocated from the arena since construction or the last reset. </summary>
+        void Reset() { _offset = 0; }
+
+        /// <summary> Gets the size of the arena's block, in bytes. </summary>
+        size_t Capacity() const { return _capacity; }
+
+        /// <summary> Gets the number of bytes currently allocated from the arena. </summary>
+        size_t Used() const { return _offset; }
+
+        /// <summary> Allocates memory from the arena, or returns nullptr if the request doesn't fit. </summary>
+        ///
+        /// <param name="size"> The number of bytes to allocate. </param>
+        /// <param name="alignment"> The required alignment, which must be a power of two. </param>
+        ///
+        /// <returns> A pointer to the allocated memory, or nullptr if the arena is full. </returns>
+        void* Allocate(size_t size, size_t alignment)
+        {
+            size_t start = (_offset + alignment - 1) & ~(alignment - 1);
+            if (start + size > _capacity)
+            {
+                return nullptr;
+            }
+            _offset = start + size;
+            return _buffer.get() + start;
+        }
+
+        /// <summary> Indicates if the given pointer came from this arena's block. </summary>
+        bool Owns(const void* p) const
+        {
+            return p >= _buffer.get() && p < _buffer.get() + _capacity;
+        }
+
+        /// <summary> Gets the current arena for the calling thread, or nullptr if none is active. </summary>
+        static MathArena* GetCurrent() { return CurrentArena(); }
+
+    private:
+        static MathArena*& CurrentArena()
+        {
+            thread_local MathArena* current = nullptr;
+            return current;
+        }
+
+        // Walks the stack of active arenas looking for the one that owns the given pointer
+        static MathArena* FindOwner(const void* p)
+        {
+            for (MathArena* arena = CurrentArena(); arena != nullptr; arena = arena->_previous)
+            {
+                if (arena->Owns(p))
+                {
+                    return arena;
+                }
+            }
+            return nullptr;
+        }
+
+        template <typename ElementType>
+        friend struct ArenaAllocator;
+
+        std::unique_ptr<char[]> _buffer;
+        size_t _capacity;
+        size_t _offset = 0;
+        MathArena* _previous = nullptr;
+    };
+
+    /// <summary>
+    /// A standard-library-compatible allocator that draws from the calling thread's current
+    /// `MathArena`. When no arena is active (or the arena is full) it falls back to the heap, so
+    /// containers using it behave correctly either way. Use it as the allocator parameter of
+    /// `Matrix` or `Tensor` for temporaries in hot loops.
+    /// </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type to allocate. </typeparam>
+    template <typename ElementType>
+    struct ArenaAllocator
+    {
+        using value_type = ElementType;
+
+        ArenaAllocator() = default;
+
+        template <typename OtherElementType>
+        ArenaAllocator(const ArenaAllocator<OtherElementType>&)
+        {}
+
+        ElementType* allocate(size_t count)
+        {
+            auto arena = MathArena::GetCurrent();
+            if (arena != nullptr)
+            {
+                void* p = arena->Allocate(count * sizeof(ElementType), alignof(ElementType));
+                if (p != nullptr)
+                {
+                    return static_cast<ElementType*>(p);
+                }
+            }
+            return static_cast<ElementType*>(::operator new(count * sizeof(ElementType)));
+        }
+
+        void deallocate(ElementType* p, size_t /*count*/)
+        {
+            // Arena memory is reclaimed wholesale by MathArena::Reset or destruction
+            if (MathArena::FindOwner(p) == nullptr)
+            {
+                ::operator delete(p);
+            }
+        }
+    };
+
+    template <typename ElementType, typename OtherElementType>
+    bool operator==(const ArenaAllocator<ElementType>&, const ArenaAllocator<OtherElementType>&)
+    {
+        return true;
+    }
+
+    template <typename ElementType, typename OtherElementType>
+    bool operator!=(const ArenaAllocator<ElementType>&, const ArenaAllocator<OtherElementType>&)
+    {
+        return false;
+    }
+} // namespace math
+} // namespace ell
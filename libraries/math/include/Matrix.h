@@ -13,6 +13,8 @@
 
 #include <cstddef>
 #include <limits>
+#include <memory>
+#include <vector>
 
 namespace ell
 {
@@ -528,7 +530,8 @@ namespace math
     ///
     /// <typeparam name="ElementType"> Matrix Element type. </typeparam>
     /// <typeparam name="layout"> Matrix layout. </typeparam>
-    template <typename ElementType, MatrixLayout layout>
+    /// <typeparam name="AllocatorType"> The allocator used for the matrix storage (e.g. `ArenaAllocator` for temporaries). </typeparam>
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType = std::allocator<ElementType>>
     class Matrix : public MatrixReference<ElementType, layout>
     {
     public:
@@ -549,7 +552,7 @@ namespace math
         /// <param name="numRows"> Number of rows in the matrix. </param>
         /// <param name="numColumns"> Number of columns in the matrix. </param>
         /// <param name="list"> A list of elements. These elements are expected to be in the layout order of this matrix's layout type. </param>
-        Matrix(size_t numRows, size_t numColumns, const std::vector<ElementType>& data);
+        Matrix(size_t numRows, size_t numColumns, const std::vector<ElementType, AllocatorType>& data);
 
         /// <summary> Constructs a matrix from an vector. The vector has
         /// (numRows * numColumns) number of elements. </summary>
@@ -557,12 +560,12 @@ namespace math
         /// <param name="numRows"> Number of rows in the matrix. </param>
         /// <param name="numColumns"> Number of columns in the matrix. </param>
         /// <param name="list"> A list of elements. These elements are expected to be in the layout order of this matrix's layout type. </param>
-        Matrix(size_t numRows, size_t numColumns, std::vector<ElementType>&& data);
+        Matrix(size_t numRows, size_t numColumns, std::vector<ElementType, AllocatorType>&& data);
 
         /// <summary> Move Constructor. </summary>
         ///
         /// <param name="other"> [in,out] The matrix being moved. </param>
-        Matrix(Matrix<ElementType, layout>&& other);
+        Matrix(Matrix<ElementType, layout, AllocatorType>&& other);
 
         /// <summary> Copy Constructor. </summary>
         ///
@@ -572,7 +575,7 @@ namespace math
         /// <summary> Copy Constructor. </summary>
         ///
         /// <param name="other"> The matrix being copied. </param>
-        Matrix(const Matrix<ElementType, layout>& other);
+        Matrix(const Matrix<ElementType, layout, AllocatorType>& other);
 
         /// <summary> Copies a matrix of the opposite layout. </summary>
         ///
@@ -587,22 +590,22 @@ namespace math
         /// <param name="other"> The other matrix. </param>
         ///
         /// <returns> A reference to this matrix. </returns>
-        Matrix<ElementType, layout>& operator=(Matrix<ElementType, layout> other);
+        Matrix<ElementType, layout, AllocatorType>& operator=(Matrix<ElementType, layout, AllocatorType> other);
 
         /// <summary> Returns a copy of the contents of the Matrix. </summary>
         ///
         /// <returns> A std::vector with a copy of the contents of the Matrix. </returns>
-        std::vector<ElementType> ToArray() const { return _data; }
+        std::vector<ElementType> ToArray() const { return { _data.begin(), _data.end() }; }
 
         /// <summary> Swaps the contents of this matrix with the contents of another matrix. </summary>
         ///
         /// <param name="other"> [in,out] The other matrix. </param>
-        void Swap(Matrix<ElementType, layout>& other);
+        void Swap(Matrix<ElementType, layout, AllocatorType>& other);
 
         /// @}
 
     private:
-        std::vector<ElementType> _data;
+        std::vector<ElementType, AllocatorType> _data;
     };
 
     /// <summary> A class that implements helper functions for archiving/unarchiving Matrix instances. </summary>
@@ -960,9 +963,32 @@ namespace math
             throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Matrix dimensions are not the same.");
         }
 
-        for (size_t i = 0; i < other.NumRows(); ++i)
+        // Copy in square blocks small enough for a source block and a destination block to fit
+        // in the L1 cache together, so the matrix that is traversed against its layout only
+        // strides within a block.
+        constexpr size_t blockSize = 32;
+        const size_t numRows = this->NumRows();
+        const size_t numColumns = this->NumColumns();
+        const size_t rowIncrement = this->GetRowIncrement();
+        const size_t columnIncrement = this->GetColumnIncrement();
+        const size_t otherRowIncrement = other.GetRowIncrement();
+        const size_t otherColumnIncrement = other.GetColumnIncrement();
+        auto data = GetDataPointer();
+        auto otherData = other.GetConstDataPointer();
+        for (size_t blockRow = 0; blockRow < numRows; blockRow += blockSize)
         {
-            GetRow(i).CopyFrom(other.GetRow(i));
+            const size_t rowEnd = std::min(blockRow + blockSize, numRows);
+            for (size_t blockColumn = 0; blockColumn < numColumns; blockColumn += blockSize)
+            {
+                const size_t columnEnd = std::min(blockColumn + blockSize, numColumns);
+                for (size_t i = blockRow; i < rowEnd; ++i)
+                {
+                    for (size_t j = blockColumn; j < columnEnd; ++j)
+                    {
+                        data[i * rowIncrement + j * columnIncrement] = otherData[i * otherRowIncrement + j * otherColumnIncrement];
+                    }
+                }
+            }
         }
     }
 
@@ -1050,16 +1076,16 @@ namespace math
     // Matrix
     //
 
-    template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>::Matrix(size_t numRows, size_t numColumns) :
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    Matrix<ElementType, layout, AllocatorType>::Matrix(size_t numRows, size_t numColumns) :
         MatrixReference<ElementType, layout>(nullptr, numRows, numColumns),
         _data(numRows * numColumns)
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>::Matrix(std::initializer_list<std::initializer_list<ElementType>> list) :
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    Matrix<ElementType, layout, AllocatorType>::Matrix(std::initializer_list<std::initializer_list<ElementType>> list) :
         MatrixReference<ElementType, layout>(nullptr, list.size(), list.begin()->size()),
         _data(list.size() * list.begin()->size())
     {
@@ -1082,40 +1108,40 @@ namespace math
         }
     }
 
-    template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>::Matrix(size_t numRows, size_t numColumns, const std::vector<ElementType>& data) :
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    Matrix<ElementType, layout, AllocatorType>::Matrix(size_t numRows, size_t numColumns, const std::vector<ElementType, AllocatorType>& data) :
         MatrixReference<ElementType, layout>(nullptr, numRows, numColumns),
         _data(data)
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>::Matrix(size_t numRows, size_t numColumns, std::vector<ElementType>&& data) :
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    Matrix<ElementType, layout, AllocatorType>::Matrix(size_t numRows, size_t numColumns, std::vector<ElementType, AllocatorType>&& data) :
         MatrixReference<ElementType, layout>(nullptr, numRows, numColumns),
         _data(std::move(data))
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>::Matrix(Matrix<ElementType, layout>&& other) :
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    Matrix<ElementType, layout, AllocatorType>::Matrix(Matrix<ElementType, layout, AllocatorType>&& other) :
         MatrixReference<ElementType, layout>(nullptr, other.NumRows(), other.NumColumns()),
         _data(std::move(other._data))
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>::Matrix(const Matrix<ElementType, layout>& other) :
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    Matrix<ElementType, layout, AllocatorType>::Matrix(const Matrix<ElementType, layout, AllocatorType>& other) :
         MatrixReference<ElementType, layout>(nullptr, other.NumRows(), other.NumColumns()),
         _data(other._data)
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>::Matrix(ConstMatrixReference<ElementType, layout> other) :
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    Matrix<ElementType, layout, AllocatorType>::Matrix(ConstMatrixReference<ElementType, layout> other) :
         MatrixReference<ElementType, layout>(nullptr, other.NumRows(), other.NumColumns()),
         _data(other.NumRows() * other.NumColumns())
     {
@@ -1129,8 +1155,8 @@ namespace math
         }
     }
 
-    template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>::Matrix(ConstMatrixReference<ElementType, TransposeMatrixLayout<layout>::value> other) :
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    Matrix<ElementType, layout, AllocatorType>::Matrix(ConstMatrixReference<ElementType, TransposeMatrixLayout<layout>::value> other) :
         MatrixReference<ElementType, layout>(nullptr, other.NumRows(), other.NumColumns()),
         _data(other.NumRows() * other.NumColumns())
     {
@@ -1144,15 +1170,15 @@ namespace math
         }
     }
 
-    template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>& Matrix<ElementType, layout>::operator=(Matrix<ElementType, layout> other)
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    Matrix<ElementType, layout, AllocatorType>& Matrix<ElementType, layout, AllocatorType>::operator=(Matrix<ElementType, layout, AllocatorType> other)
     {
         Swap(other);
         return *this;
     }
 
-    template <typename ElementType, MatrixLayout layout>
-    void Matrix<ElementType, layout>::Swap(Matrix<ElementType, layout>& other)
+    template <typename ElementType, MatrixLayout layout, typename AllocatorType>
+    void Matrix<ElementType, layout, AllocatorType>::Swap(Matrix<ElementType, layout, AllocatorType>& other)
     {
         MatrixReference<ElementType, layout>::Swap(other);
         std::swap(_data, other._data);
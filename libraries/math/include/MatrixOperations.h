@@ -15,6 +15,7 @@
 #include "BlasWrapper.h"
 #endif
 
+#include <algorithm>
 #include <ostream>
 #include <string>
 
@@ -298,6 +299,26 @@ namespace math
     template <ImplementationType implementation = ImplementationType::openBlas, typename ElementType, MatrixLayout layout>
     void MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layout> matrix, ConstColumnVectorReference<ElementType> vectorA, ElementType scalarB, ColumnVectorReference<ElementType> vectorB);
 
+    /// <summary> Fused pair of matrix vector multiplications that share an output,
+    /// vectorC = scalarA * (matrixA * vectorA + matrixB * vectorB) + scalarC * vectorC.
+    /// Recurrent layers use this to apply their stacked input and hidden weights in a single pass
+    /// per timestep: the native implementation computes both dot products for each output element
+    /// before writing it, so the output is read and written once instead of twice. </summary>
+    ///
+    /// <typeparam name="implementation"> The implementation. </typeparam>
+    /// <typeparam name="ElementType"> Matrix and vector element type. </typeparam>
+    /// <typeparam name="layoutA"> Matrix layout of first matrix. </typeparam>
+    /// <typeparam name="layoutB"> Matrix layout of second matrix. </typeparam>
+    /// <param name="scalarA"> The scalar that multiplies both matrix vector products. </param>
+    /// <param name="matrixA"> The first matrix. </param>
+    /// <param name="vectorA"> The column vector that multiplies the first matrix from the right. </param>
+    /// <param name="matrixB"> The second matrix, with the same number of rows as the first. </param>
+    /// <param name="vectorB"> The column vector that multiplies the second matrix from the right. </param>
+    /// <param name="scalarC"> The scalar that multiplies vectorC. </param>
+    /// <param name="vectorC"> A column vector, multiplied by scalarC and used to store the result. </param>
+    template <ImplementationType implementation = ImplementationType::openBlas, typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+    void MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstColumnVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layoutB> matrixB, ConstColumnVectorReference<ElementType> vectorB, ElementType scalarC, ColumnVectorReference<ElementType> vectorC);
+
     /// <summary> Generalized (left-side) matrix row-vector multiplication, vectorB = scalarA * vectorA * matrix + scalarB * vectorB. </summary>
     ///
     /// <typeparam name="implementation"> The implementation. </typeparam>
@@ -326,6 +347,61 @@ namespace math
     template <ImplementationType implementation = ImplementationType::openBlas, typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB, MatrixLayout layoutC>
     void MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstMatrixReference<ElementType, layoutB> matrixB, ElementType scalarC, MatrixReference<ElementType, layoutC> matrixC);
 
+    /// <summary> Generalized matrix matrix multiplication with runtime transpose flags,
+    /// matrixC = scalarA * op(matrixA) * op(matrixB) + scalarC * matrixC, where op transposes its
+    /// argument when the corresponding flag is set. The transposed operands are lightweight views of
+    /// the original matrices (including sub-matrix views), so no copies are made. </summary>
+    ///
+    /// <typeparam name="implementation"> The implementation. </typeparam>
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layoutA"> Matrix layout of first matrix. </typeparam>
+    /// <typeparam name="layoutB"> Matrix layout of second matrix. </typeparam>
+    /// <typeparam name="layoutC"> Matrix layout of result matrix. </typeparam>
+    /// <param name="scalarA"> The scalar that multiplies the first matrix. </param>
+    /// <param name="transposeA"> Whether to transpose the first matrix. </param>
+    /// <param name="matrixA"> The first matrix. </param>
+    /// <param name="transposeB"> Whether to transpose the second matrix. </param>
+    /// <param name="matrixB"> The second matrix. </param>
+    /// <param name="scalarC"> The scalar that multiplies the third matrix. </param>
+    /// <param name="matrixC"> A third matrix, multiplied by scalarC and used to store the result. </param>
+    template <ImplementationType implementation = ImplementationType::openBlas, typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB, MatrixLayout layoutC>
+    void MultiplyScaleAddUpdate(ElementType scalarA, MatrixTranspose transposeA, ConstMatrixReference<ElementType, layoutA> matrixA, MatrixTranspose transposeB, ConstMatrixReference<ElementType, layoutB> matrixB, ElementType scalarC, MatrixReference<ElementType, layoutC> matrixC);
+
+    /// <summary> Generalized matrix matrix multiplication for small matrices whose dimensions are known at
+    /// compile time, matrixC = scalarA * matrixA * matrixB + scalarC * matrixC. All loop bounds are
+    /// compile-time constants, so the loops fully unroll and vectorize, and no BLAS dispatch takes place. </summary>
+    ///
+    /// <typeparam name="numRows"> Number of rows of matrixA and matrixC. </typeparam>
+    /// <typeparam name="innerDimension"> Number of columns of matrixA and rows of matrixB. </typeparam>
+    /// <typeparam name="numColumns"> Number of columns of matrixB and matrixC. </typeparam>
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layoutA"> Matrix layout of first matrix. </typeparam>
+    /// <typeparam name="layoutB"> Matrix layout of second matrix. </typeparam>
+    /// <typeparam name="layoutC"> Matrix layout of result matrix. </typeparam>
+    /// <param name="scalarA"> The scalar that multiplies the first matrix. </param>
+    /// <param name="matrixA"> The first matrix. </param>
+    /// <param name="matrixB"> The second matrix. </param>
+    /// <param name="scalarC"> The scalar that multiplies the third matrix. </param>
+    /// <param name="matrixC"> A third matrix, multiplied by scalarC and used to store the result. </param>
+    template <size_t numRows, size_t innerDimension, size_t numColumns, typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB, MatrixLayout layoutC>
+    void FixedMultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstMatrixReference<ElementType, layoutB> matrixB, ElementType scalarC, MatrixReference<ElementType, layoutC> matrixC);
+
+    /// <summary> Generalized matrix column-vector multiplication for small matrices whose dimensions are
+    /// known at compile time, vectorB = scalarA * matrix * vectorA + scalarB * vectorB. All loop bounds
+    /// are compile-time constants, so the loops fully unroll and vectorize, and no BLAS dispatch takes place. </summary>
+    ///
+    /// <typeparam name="numRows"> Number of rows of the matrix and elements of vectorB. </typeparam>
+    /// <typeparam name="numColumns"> Number of columns of the matrix and elements of vectorA. </typeparam>
+    /// <typeparam name="ElementType"> Matrix and vector element type. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    /// <param name="scalarA"> The scalar that multiplies the matrix. </param>
+    /// <param name="matrix"> The matrix. </param>
+    /// <param name="vectorA"> The column vector that multiplies the matrix from the right. </param>
+    /// <param name="scalarB"> The scalar that multiplies vectorB. </param>
+    /// <param name="vectorB"> A column vector, multiplied by scalarB and used to store the result. </param>
+    template <size_t numRows, size_t numColumns, typename ElementType, MatrixLayout layout>
+    void FixedMultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layout> matrix, ConstColumnVectorReference<ElementType> vectorA, ElementType scalarB, ColumnVectorReference<ElementType> vectorB);
+
     /// <summary> Matrix matrix element wise multiplication, matrixC = matrixA .* matrixB. </summary>
     ///
     /// <typeparam name="ElementType"> Matrix element type. </typeparam>
@@ -386,6 +462,9 @@ namespace math
             template <typename ElementType, MatrixLayout layout>
             static void MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layout> matrix, ConstColumnVectorReference<ElementType> vectorA, ElementType scalarB, ColumnVectorReference<ElementType> vectorB);
 
+            template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+            static void MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstColumnVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layoutB> matrixB, ConstColumnVectorReference<ElementType> vectorB, ElementType scalarC, ColumnVectorReference<ElementType> vectorC);
+
             template <typename ElementType, MatrixLayout layout>
             static void MultiplyScaleAddUpdate(ElementType scalarA, ConstRowVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layout> matrix, ElementType scalarB, RowVectorReference<ElementType> vectorB);
 
@@ -405,6 +484,9 @@ namespace math
             template <typename ElementType, MatrixLayout layout>
             static void MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layout> matrix, ConstColumnVectorReference<ElementType> vectorA, ElementType scalarB, ColumnVectorReference<ElementType> vectorB);
 
+            template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+            static void MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstColumnVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layoutB> matrixB, ConstColumnVectorReference<ElementType> vectorB, ElementType scalarC, ColumnVectorReference<ElementType> vectorC);
+
             template <typename ElementType, MatrixLayout layout>
             static void MultiplyScaleAddUpdate(ElementType scalarA, ConstRowVectorReference<ElementType> vectorA, const ConstMatrixReference<ElementType, layout> matrix, ElementType scalarB, RowVectorReference<ElementType> vectorB);
 
@@ -995,6 +1077,14 @@ namespace math
         Internal::MatrixOperations<implementation>::MultiplyScaleAddUpdate(scalarA, matrix, vectorA, scalarB, vectorB);
     }
 
+    template <ImplementationType implementation, typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+    void MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstColumnVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layoutB> matrixB, ConstColumnVectorReference<ElementType> vectorB, ElementType scalarC, ColumnVectorReference<ElementType> vectorC)
+    {
+        DEBUG_CHECK_SIZES(matrixA.NumColumns() != vectorA.Size() || matrixB.NumColumns() != vectorB.Size() || matrixA.NumRows() != vectorC.Size() || matrixB.NumRows() != vectorC.Size(), "Incompatible matrix vector sizes.");
+
+        Internal::MatrixOperations<implementation>::MultiplyScaleAddUpdate(scalarA, matrixA, vectorA, matrixB, vectorB, scalarC, vectorC);
+    }
+
     template <ImplementationType implementation, typename ElementType, MatrixLayout layout>
     void MultiplyScaleAddUpdate(ElementType scalarA, ConstRowVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layout> matrix, ElementType scalarB, RowVectorReference<ElementType> vectorB)
     {
@@ -1011,6 +1101,68 @@ namespace math
         Internal::MatrixOperations<implementation>::MultiplyScaleAddUpdate(scalarA, matrixA, matrixB, scalarC, matrixC);
     }
 
+    template <ImplementationType implementation, typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB, MatrixLayout layoutC>
+    void MultiplyScaleAddUpdate(ElementType scalarA, MatrixTranspose transposeA, ConstMatrixReference<ElementType, layoutA> matrixA, MatrixTranspose transposeB, ConstMatrixReference<ElementType, layoutB> matrixB, ElementType scalarC, MatrixReference<ElementType, layoutC> matrixC)
+    {
+        if (transposeA == MatrixTranspose::noTranspose)
+        {
+            if (transposeB == MatrixTranspose::noTranspose)
+            {
+                MultiplyScaleAddUpdate<implementation>(scalarA, matrixA, matrixB, scalarC, matrixC);
+            }
+            else
+            {
+                MultiplyScaleAddUpdate<implementation>(scalarA, matrixA, matrixB.Transpose(), scalarC, matrixC);
+            }
+        }
+        else
+        {
+            if (transposeB == MatrixTranspose::noTranspose)
+            {
+                MultiplyScaleAddUpdate<implementation>(scalarA, matrixA.Transpose(), matrixB, scalarC, matrixC);
+            }
+            else
+            {
+                MultiplyScaleAddUpdate<implementation>(scalarA, matrixA.Transpose(), matrixB.Transpose(), scalarC, matrixC);
+            }
+        }
+    }
+
+    template <size_t numRows, size_t innerDimension, size_t numColumns, typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB, MatrixLayout layoutC>
+    void FixedMultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstMatrixReference<ElementType, layoutB> matrixB, ElementType scalarC, MatrixReference<ElementType, layoutC> matrixC)
+    {
+        DEBUG_CHECK_SIZES(matrixA.NumRows() != numRows || matrixA.NumColumns() != innerDimension || matrixB.NumRows() != innerDimension || matrixB.NumColumns() != numColumns || matrixC.NumRows() != numRows || matrixC.NumColumns() != numColumns, "Incompatible matrix sizes.");
+
+        for (size_t i = 0; i < numRows; ++i)
+        {
+            for (size_t j = 0; j < numColumns; ++j)
+            {
+                ElementType dot = 0;
+                for (size_t k = 0; k < innerDimension; ++k)
+                {
+                    dot += matrixA(i, k) * matrixB(k, j);
+                }
+                matrixC(i, j) = scalarA * dot + scalarC * matrixC(i, j);
+            }
+        }
+    }
+
+    template <size_t numRows, size_t numColumns, typename ElementType, MatrixLayout layout>
+    void FixedMultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layout> matrix, ConstColumnVectorReference<ElementType> vectorA, ElementType scalarB, ColumnVectorReference<ElementType> vectorB)
+    {
+        DEBUG_CHECK_SIZES(matrix.NumRows() != numRows || matrix.NumColumns() != numColumns || vectorA.Size() != numColumns || vectorB.Size() != numRows, "Incompatible matrix vector sizes.");
+
+        for (size_t i = 0; i < numRows; ++i)
+        {
+            ElementType dot = 0;
+            for (size_t j = 0; j < numColumns; ++j)
+            {
+                dot += matrix(i, j) * vectorA[j];
+            }
+            vectorB[i] = scalarA * dot + scalarB * vectorB[i];
+        }
+    }
+
     template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
     void ElementwiseMultiplySet(ConstMatrixReference<ElementType, layoutA> matrixA, ConstMatrixReference<ElementType, layoutB> matrixB, MatrixReference<ElementType, layoutA> matrixC)
     {
@@ -1084,6 +1236,17 @@ namespace math
             }
         }
 
+        template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+        void MatrixOperations<ImplementationType::native>::MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstColumnVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layoutB> matrixB, ConstColumnVectorReference<ElementType> vectorB, ElementType scalarC, ColumnVectorReference<ElementType> vectorC)
+        {
+            for (size_t i = 0; i < vectorC.Size(); ++i)
+            {
+                auto rowA = matrixA.GetRow(i);
+                auto rowB = matrixB.GetRow(i);
+                vectorC[i] = scalarA * (Dot(rowA, vectorA) + Dot(rowB, vectorB)) + scalarC * vectorC[i];
+            }
+        }
+
         template <typename ElementType, MatrixLayout layout>
         void MatrixOperations<ImplementationType::native>::MultiplyScaleAddUpdate(ElementType scalarA, ConstRowVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layout> matrix, ElementType scalarB, RowVectorReference<ElementType> vectorB)
         {
@@ -1093,13 +1256,44 @@ namespace math
         template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB, MatrixLayout layoutC>
         void MatrixOperations<ImplementationType::native>::MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstMatrixReference<ElementType, layoutB> matrixB, ElementType scalarB, MatrixReference<ElementType, layoutC> matrixC)
         {
-            for (size_t i = 0; i < matrixA.NumRows(); ++i)
+            const size_t numRows = matrixA.NumRows();
+            const size_t numColumns = matrixB.NumColumns();
+            const size_t innerDimension = matrixA.NumColumns();
+
+            // Scale C up front so the tiled loops below can accumulate into it in any order
+            for (size_t i = 0; i < numRows; ++i)
+            {
+                for (size_t j = 0; j < numColumns; ++j)
+                {
+                    matrixC(i, j) *= scalarB;
+                }
+            }
+
+            // Cache-tiled i-k-j traversal: each (tile of A) x (tile of B) product updates a tile
+            // of C that stays resident in cache, and the innermost loop walks consecutive columns
+            // of B and C so the compiler can vectorize it.
+            constexpr size_t tileSize = 64;
+            for (size_t kTile = 0; kTile < innerDimension; kTile += tileSize)
             {
-                for (size_t j = 0; j < matrixB.NumColumns(); ++j)
+                const size_t kEnd = std::min(kTile + tileSize, innerDimension);
+                for (size_t iTile = 0; iTile < numRows; iTile += tileSize)
                 {
-                    auto row = matrixA.GetRow(i);
-                    auto column = matrixB.GetColumn(j);
-                    matrixC(i, j) = scalarA * Dot(row, column) + scalarB * matrixC(i, j);
+                    const size_t iEnd = std::min(iTile + tileSize, numRows);
+                    for (size_t jTile = 0; jTile < numColumns; jTile += tileSize)
+                    {
+                        const size_t jEnd = std::min(jTile + tileSize, numColumns);
+                        for (size_t i = iTile; i < iEnd; ++i)
+                        {
+                            for (size_t k = kTile; k < kEnd; ++k)
+                            {
+                                const ElementType value = scalarA * matrixA(i, k);
+                                for (size_t j = jTile; j < jEnd; ++j)
+                                {
+                                    matrixC(i, j) += value * matrixB(k, j);
+                                }
+                            }
+                        }
+                    }
                 }
             }
         }
@@ -1121,6 +1315,14 @@ namespace math
             Blas::Gemv(matrix.GetLayout(), MatrixTranspose::noTranspose, static_cast<int>(matrix.NumRows()), static_cast<int>(matrix.NumColumns()), scalarA, matrix.GetConstDataPointer(), static_cast<int>(matrix.GetIncrement()), vectorA.GetConstDataPointer(), static_cast<int>(vectorA.GetIncrement()), scalarB, vectorB.GetDataPointer(), static_cast<int>(vectorB.GetIncrement()));
         }
 
+        template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+        void MatrixOperations<ImplementationType::openBlas>::MultiplyScaleAddUpdate(ElementType scalarA, ConstMatrixReference<ElementType, layoutA> matrixA, ConstColumnVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layoutB> matrixB, ConstColumnVectorReference<ElementType> vectorB, ElementType scalarC, ColumnVectorReference<ElementType> vectorC)
+        {
+            // BLAS has no fused dual GEMV; let the first call apply scalarC and the second accumulate
+            MultiplyScaleAddUpdate(scalarA, matrixA, vectorA, scalarC, vectorC);
+            MultiplyScaleAddUpdate(scalarA, matrixB, vectorB, static_cast<ElementType>(1), vectorC);
+        }
+
         template <typename ElementType, MatrixLayout layout>
         void MatrixOperations<ImplementationType::openBlas>::MultiplyScaleAddUpdate(ElementType scalarA, ConstRowVectorReference<ElementType> vectorA, ConstMatrixReference<ElementType, layout> matrix, ElementType scalarB, RowVectorReference<ElementType> vectorB)
         {
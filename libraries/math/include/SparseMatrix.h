@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrix.h (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <utilities/include/Debug.h>
+#include <utilities/include/Exception.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary>
+    /// A sparse matrix in compressed sparse row (CSR) form. Only the nonzero entries are stored,
+    /// so memory footprint and matrix-vector multiplication time scale with the number of nonzeros
+    /// rather than with the matrix dimensions.
+    /// </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    template <typename ElementType>
+    class SparseMatrix
+    {
+    public:
+        SparseMatrix() = default;
+
+        /// <summary> Constructs a SparseMatrix from a dense matrix, keeping only the nonzero entries. </summary>
+        ///
+        /// <typeparam name="layout"> The layout of the dense matrix. </typeparam>
+        /// <param name="matrix"> The dense matrix to compress. </param>
+        template <MatrixLayout layout>
+        explicit SparseMatrix(ConstMatrixReference<ElementType, layout> matrix);
+
+        /// \name Accessor Functions
+        /// @{
+
+        /// <summary> Gets the number of rows. </summary>
+        ///
+        /// <returns> The number of rows. </returns>
+        size_t NumRows() const { return _numRows; }
+
+        /// <summary> Gets the number of columns. </summary>
+        ///
+        /// <returns> The number of columns. </returns>
+        size_t NumColumns() const { return _numColumns; }
+
+        /// <summary> Gets the number of stored nonzero entries. </summary>
+        ///
+        /// <returns> The number of nonzeros. </returns>
+        size_t NumNonzeros() const { return _values.size(); }
+
+        /// <summary> Gets the fraction of entries that are nonzero. </summary>
+        ///
+        /// <returns> The density, in the range [0, 1]. </returns>
+        double GetDensity() const;
+
+        /// <summary> Gets the row offsets array. Entry i is the index in the values and column
+        /// index arrays where row i begins, and the last entry is the total number of nonzeros. </summary>
+        ///
+        /// <returns> The row offsets array, of size NumRows() + 1. </returns>
+        const std::vector<size_t>& GetRowOffsets() const { return _rowOffsets; }
+
+        /// <summary> Gets the column index of each stored nonzero entry, in row order. </summary>
+        ///
+        /// <returns> The column indices array, of size NumNonzeros(). </returns>
+        const std::vector<size_t>& GetColumnIndices() const { return _columnIndices; }
+
+        /// <summary> Gets the value of each stored nonzero entry, in row order. </summary>
+        ///
+        /// <returns> The values array, of size NumNonzeros(). </returns>
+        const std::vector<ElementType>& GetValues() const { return _values; }
+
+        /// @}
+
+        /// <summary> Expands the matrix back into dense form. </summary>
+        ///
+        /// <returns> A row major dense matrix with the same entries. </returns>
+        RowMatrix<ElementType> ToDense() const;
+
+    private:
+        size_t _numRows = 0;
+        size_t _numColumns = 0;
+        std::vector<size_t> _rowOffsets = { 0 };
+        std::vector<size_t> _columnIndices;
+        std::vector<ElementType> _values;
+    };
+
+    /// <summary> Converts a dense matrix to compressed sparse row form if it is sparse enough. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layout"> The layout of the dense matrix. </typeparam>
+    /// <param name="matrix"> The dense matrix to compress. </param>
+    /// <param name="maxDensity"> The largest fraction of nonzero entries for which the conversion takes place. </param>
+    ///
+    /// <returns> The CSR form of the matrix, or an empty optional if the matrix is denser than maxDensity. </returns>
+    template <typename ElementType, MatrixLayout layout>
+    std::optional<SparseMatrix<ElementType>> TryCompress(ConstMatrixReference<ElementType, layout> matrix, double maxDensity);
+
+    /// <summary> Generalized sparse matrix vector multiplication, vectorB = scalarA * matrixA * vectorA + scalarB * vectorB. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix and vector element type. </typeparam>
+    /// <param name="scalarA"> The scalar that multiplies the matrix. </param>
+    /// <param name="matrixA"> The sparse matrix. </param>
+    /// <param name="vectorA"> The column vector that multiplies the matrix on the right. </param>
+    /// <param name="scalarB"> The scalar that multiplies vectorB. </param>
+    /// <param name="vectorB"> A column vector, multiplied by scalarB and used to store the result. </param>
+    template <typename ElementType>
+    void MultiplyScaleAddUpdate(ElementType scalarA, const SparseMatrix<ElementType>& matrixA, ConstColumnVectorReference<ElementType> vectorA, ElementType scalarB, ColumnVectorReference<ElementType> vectorB);
+} // namespace math
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace math
+{
+    template <typename ElementType>
+    template <MatrixLayout layout>
+    SparseMatrix<ElementType>::SparseMatrix(ConstMatrixReference<ElementType, layout> matrix) :
+        _numRows(matrix.NumRows()),
+        _numColumns(matrix.NumColumns())
+    {
+        _rowOffsets.reserve(_numRows + 1);
+        for (size_t i = 0; i < _numRows; ++i)
+        {
+            for (size_t j = 0; j < _numColumns; ++j)
+            {
+                auto value = matrix(i, j);
+                if (value != 0)
+                {
+                    _columnIndices.push_back(j);
+                    _values.push_back(value);
+                }
+            }
+            _rowOffsets.push_back(_values.size());
+        }
+    }
+
+    template <typename ElementType>
+    double SparseMatrix<ElementType>::GetDensity() const
+    {
+        if (_numRows == 0 || _numColumns == 0)
+        {
+            return 0;
+        }
+        return static_cast<double>(NumNonzeros()) / static_cast<double>(_numRows * _numColumns);
+    }
+
+    template <typename ElementType>
+    RowMatrix<ElementType> SparseMatrix<ElementType>::ToDense() const
+    {
+        RowMatrix<ElementType> result(_numRows, _numColumns);
+        for (size_t i = 0; i < _numRows; ++i)
+        {
+            for (size_t k = _rowOffsets[i]; k < _rowOffsets[i + 1]; ++k)
+            {
+                result(i, _columnIndices[k]) = _values[k];
+            }
+        }
+        return result;
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    std::optional<SparseMatrix<ElementType>> TryCompress(ConstMatrixReference<ElementType, layout> matrix, double maxDensity)
+    {
+        SparseMatrix<ElementType> sparse(matrix);
+        if (sparse.GetDensity() > maxDensity)
+        {
+            return std::nullopt;
+        }
+        return sparse;
+    }
+
+    template <typename ElementType>
+    void MultiplyScaleAddUpdate(ElementType scalarA, const SparseMatrix<ElementType>& matrixA, ConstColumnVectorReference<ElementType> vectorA, ElementType scalarB, ColumnVectorReference<ElementType> vectorB)
+    {
+        DEBUG_CHECK_SIZES(matrixA.NumColumns() != vectorA.Size() || matrixA.NumRows() != vectorB.Size(), "Incompatible matrix and vectors sizes.");
+
+        const auto& rowOffsets = matrixA.GetRowOffsets();
+        const size_t* columnIndices = matrixA.GetColumnIndices().data();
+        const ElementType* values = matrixA.GetValues().data();
+        for (size_t i = 0; i < matrixA.NumRows(); ++i)
+        {
+            // accumulate in pairs - the indexed loads prevent the compiler from vectorizing this
+            // loop, but two independent accumulators still overlap the multiply-add latency
+            size_t begin = rowOffsets[i];
+            size_t end = rowOffsets[i + 1];
+            ElementType evenSum = 0;
+            ElementType oddSum = 0;
+            for (size_t k = begin; k + 1 < end; k += 2)
+            {
+                evenSum += values[k] * vectorA[columnIndices[k]];
+                oddSum += values[k + 1] * vectorA[columnIndices[k + 1]];
+            }
+            if ((end - begin) % 2 != 0)
+            {
+                evenSum += values[end - 1] * vectorA[columnIndices[end - 1]];
+            }
+            vectorB[i] = scalarA * (evenSum + oddSum) + scalarB * vectorB[i];
+        }
+    }
+} // namespace math
+} // namespace ell
+
+#pragma endregion implementation
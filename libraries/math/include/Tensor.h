@@ -17,6 +17,7 @@
 #include <array>
 #include <cmath>
 #include <initializer_list>
+#include <memory>
 #include <ostream>
 #include <tuple>
 #include <vector>
@@ -804,7 +805,8 @@ namespace math
     /// (increment of 1). </typeparam>
     /// <typeparam name="dimension1"> Identity of the tensor dimension with a minor memory increment. </typeparam>
     /// <typeparam name="dimension2"> Identity of the tensor dimension with a major memory increment. </typeparam>
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    /// <typeparam name="AllocatorType"> The allocator used for the tensor storage (e.g. `ArenaAllocator` for temporaries). </typeparam>
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType = std::allocator<ElementType>>
     class Tensor : public TensorReference<ElementType, dimension0, dimension1, dimension2>
     {
     public:
@@ -827,7 +829,7 @@ namespace math
         /// <param name="numColumns"> Number of columns. </param>
         /// <param name="numChannels"> Number of channels. </param>
         /// <param name="data"> Vector of data elements that will be copied to this Tensor. </param>
-        Tensor(size_t numRows, size_t numColumns, size_t numChannels, const std::vector<ElementType>& data);
+        Tensor(size_t numRows, size_t numColumns, size_t numChannels, const std::vector<ElementType, AllocatorType>& data);
 
         /// <summary> Constructs a tensor of the given shape with the specified data. </summary>
         ///
@@ -835,7 +837,7 @@ namespace math
         /// <param name="numColumns"> Number of columns. </param>
         /// <param name="numChannels"> Number of channels. </param>
         /// <param name="data"> Vector of data elements that will be moved to this Tensor. </param>
-        Tensor(size_t numRows, size_t numColumns, size_t numChannels, std::vector<ElementType>&& data);
+        Tensor(size_t numRows, size_t numColumns, size_t numChannels, std::vector<ElementType, AllocatorType>&& data);
 
         /// <summary> Constructs a the zero tensor of given shape. </summary>
         ///
@@ -845,7 +847,7 @@ namespace math
         /// <summary> Copy Constructor. </summary>
         ///
         /// <param name="other"> The other tensor. </param>
-        Tensor(const Tensor<ElementType, dimension0, dimension1, dimension2>& other);
+        Tensor(const Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>& other);
 
         /// <summary> Copies a tensor of a different layout. </summary>
         ///
@@ -866,23 +868,23 @@ namespace math
         /// <param name="other"> The other tensor. </param>
         ///
         /// <returns> A reference to this tensor. </returns>
-        Tensor<ElementType, dimension0, dimension1, dimension2>& operator=(Tensor<ElementType, dimension0, dimension1, dimension2> other);
+        Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>& operator=(Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType> other);
 
         /// <summary> Returns a copy of the contents of the Tensor. </summary>
         ///
         /// <returns> A std::vector with a copy of the contents of the Tensor. </returns>
-        std::vector<ElementType> ToArray() const { return _data; }
+        std::vector<ElementType> ToArray() const { return { _data.begin(), _data.end() }; }
 
         /// <summary> Swaps the contents of this tensor with the contents of another tensor. </summary>
         ///
         /// <param name="other"> [in,out] The other tensor. </param>
-        void Swap(Tensor<ElementType, dimension0, dimension1, dimension2>& other);
+        void Swap(Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>& other);
 
         /// @}
 
     private:
         using ConstTensorRef = ConstTensorReference<ElementType, dimension0, dimension1, dimension2>;
-        std::vector<ElementType> _data;
+        std::vector<ElementType, AllocatorType> _data;
     };
 
     /// <summary> A class that implements helper functions for archiving/unarchiving Tensor instances. </summary>
@@ -1650,55 +1652,55 @@ namespace math
     // Tensor
     //
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor() :
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
+    Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::Tensor() :
         Tensor(TensorShape{ 0, 0, 0 })
     {
     }
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(size_t numRows, size_t numColumns, size_t numChannels) :
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
+    Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::Tensor(size_t numRows, size_t numColumns, size_t numChannels) :
         TensorRef(TensorShape(numRows, numColumns, numChannels)),
         _data(numRows * numColumns * numChannels)
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(size_t numRows, size_t numColumns, size_t numChannels, const std::vector<ElementType>& data) :
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
+    Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::Tensor(size_t numRows, size_t numColumns, size_t numChannels, const std::vector<ElementType, AllocatorType>& data) :
         TensorRef(TensorShape{ numRows, numColumns, numChannels }),
         _data(data)
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(size_t numRows, size_t numColumns, size_t numChannels, std::vector<ElementType>&& data) :
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
+    Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::Tensor(size_t numRows, size_t numColumns, size_t numChannels, std::vector<ElementType, AllocatorType>&& data) :
         TensorRef(TensorShape{ numRows, numColumns, numChannels }),
         _data(std::move(data))
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(TensorShape shape) :
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
+    Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::Tensor(TensorShape shape) :
         TensorRef(shape),
         _data(shape.Size())
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(const Tensor<ElementType, dimension0, dimension1, dimension2>& other) :
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
+    Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::Tensor(const Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>& other) :
         TensorRef(other),
         _data(other._data)
     {
         this->_pData = _data.data();
     }
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
     template <Dimension otherDimension0, Dimension otherDimension1, Dimension otherDimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(ConstTensorReference<ElementType, otherDimension0, otherDimension1, otherDimension2> other) :
+    Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::Tensor(ConstTensorReference<ElementType, otherDimension0, otherDimension1, otherDimension2> other) :
         TensorRef(TensorShape{ other.NumRows(), other.NumColumns(), other.NumChannels() }),
         _data(other.Size())
     {
@@ -1706,8 +1708,8 @@ namespace math
         this->CopyFrom(other);
     }
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(std::initializer_list<std::initializer_list<std::initializer_list<ElementType>>> list) :
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
+    Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::Tensor(std::initializer_list<std::initializer_list<std::initializer_list<ElementType>>> list) :
         TensorRef(TensorShape{ list.size(), list.begin()->size(), list.begin()->begin()->size() }),
         _data(list.size() * list.begin()->size() * list.begin()->begin()->size())
     {
@@ -1738,15 +1740,15 @@ namespace math
         }
     }
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>& Tensor<ElementType, dimension0, dimension1, dimension2>::operator=(Tensor<ElementType, dimension0, dimension1, dimension2> other)
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
+    Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>& Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::operator=(Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType> other)
     {
         Swap(other);
         return *this;
     }
 
-    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    void Tensor<ElementType, dimension0, dimension1, dimension2>::Swap(Tensor<ElementType, dimension0, dimension1, dimension2>& other)
+    template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2, typename AllocatorType>
+    void Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>::Swap(Tensor<ElementType, dimension0, dimension1, dimension2, AllocatorType>& other)
     {
         TensorRef::Swap(other);
         std::swap(_data, other._data);
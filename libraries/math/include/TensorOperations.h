@@ -15,8 +15,11 @@
 #include <utilities/include/Debug.h>
 #include <utilities/include/Exception.h>
 
+#include <algorithm>
 #include <ostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace ell
 {
@@ -227,6 +230,114 @@ namespace math
     /// <param name="tensor"> The tensor. </param>
     template <Dimension vectorOrientation, ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension0, Dimension dimension1>
     void ScaleAddUpdate(UnorientedConstVectorBase<ElementType> scale, UnorientedConstVectorBase<ElementType> bias, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> tensor);
+
+    //
+    // Parallel variants of the update operations above. Each one partitions the outermost tensor
+    // dimension across worker threads when the tensor is large enough to justify it (the slices
+    // processed by different threads occupy disjoint memory), and runs serially otherwise.
+    //
+
+    /// <summary> Multiplies a tensor by a scalar in parallel, tensor *= scalar. </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+    /// <param name="scalar"> The scalar that multiplies the tensor. </param>
+    /// <param name="tensor"> The tensor which the scalar multiplies. </param>
+    template <ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    void ParallelScaleUpdate(ElementType scalar, TensorReference<ElementType, dimension0, dimension1, dimension2> tensor);
+
+    /// <summary> Multiplies each slice in a Tensor with the corresponding vector element, in parallel. </summary>
+    ///
+    /// <typeparam name="vectorOrientation"> The orientation in which to apply the vector. </typeparam>
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+    /// <param name="vector"> The vector </param>
+    /// <param name="tensor"> The tensor. </param>
+    template <Dimension vectorOrientation, ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension0, Dimension dimension2>
+    void ParallelScaleUpdate(UnorientedConstVectorBase<ElementType> vector, TensorReference<ElementType, dimension0, vectorOrientation, dimension2> tensor);
+
+    /// <summary> Multiplies each slice in a Tensor with the corresponding vector element, in parallel. </summary>
+    ///
+    /// <typeparam name="vectorOrientation"> The orientation in which to apply the vector. </typeparam>
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+    /// <param name="vector"> The vector </param>
+    /// <param name="tensor"> The tensor. </param>
+    template <Dimension vectorOrientation, ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension0, Dimension dimension1>
+    void ParallelScaleUpdate(UnorientedConstVectorBase<ElementType> vector, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> tensor);
+
+    /// <summary> Adds a scalar to a tensor in parallel, tensor += scalar. </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+    /// <param name="scalar"> The scalar being added. </param>
+    /// <param name="tensor"> The tensor to which the scalar is added. </param>
+    template <ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    void ParallelAddUpdate(ElementType scalar, TensorReference<ElementType, dimension0, dimension1, dimension2> tensor);
+
+    /// <summary> Adds each vector element to the corresponding Tensor slice, in parallel. </summary>
+    ///
+    /// <typeparam name="vectorOrientation"> The orientation in which to apply the vector. </typeparam>
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+    /// <param name="vector"> The vector </param>
+    /// <param name="tensor"> The tensor. </param>
+    template <Dimension vectorOrientation, ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension0, Dimension dimension2>
+    void ParallelAddUpdate(UnorientedConstVectorBase<ElementType> vector, TensorReference<ElementType, dimension0, vectorOrientation, dimension2> tensor);
+
+    /// <summary> Adds each vector element to the corresponding Tensor slice, in parallel. </summary>
+    ///
+    /// <typeparam name="vectorOrientation"> The orientation in which to apply the vector. </typeparam>
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+    /// <param name="vector"> The vector </param>
+    /// <param name="tensor"> The tensor. </param>
+    template <Dimension vectorOrientation, ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension0, Dimension dimension1>
+    void ParallelAddUpdate(UnorientedConstVectorBase<ElementType> vector, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> tensor);
+
+    /// <summary> Applies the transformation M = scale[i] * M + bias[i] to each Tensor slice, in parallel. </summary>
+    ///
+    /// <typeparam name="vectorOrientation"> The orientation in which to apply the vectors. </typeparam>
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+    /// <param name="scale"> The vector of elements that multiply the Tensor slices </param>
+    /// <param name="bias"> The vector of elements to add to the Tensor slices </param>
+    /// <param name="tensor"> The tensor. </param>
+    template <Dimension vectorOrientation, ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension1, Dimension dimension2>
+    void ParallelScaleAddUpdate(UnorientedConstVectorBase<ElementType> scale, UnorientedConstVectorBase<ElementType> bias, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> tensor);
+
+    /// <summary> Applies the transformation M = scale[i] * M + bias[i] to each Tensor slice, in parallel. </summary>
+    ///
+    /// <typeparam name="vectorOrientation"> The orientation in which to apply the vectors. </typeparam>
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension2"> The third dimension in the Tensor layout. </typeparam>
+    /// <param name="scale"> The vector of elements that multiply the Tensor slices </param>
+    /// <param name="bias"> The vector of elements to add to the Tensor slices </param>
+    /// <param name="tensor"> The tensor. </param>
+    template <Dimension vectorOrientation, ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension0, Dimension dimension2>
+    void ParallelScaleAddUpdate(UnorientedConstVectorBase<ElementType> scale, UnorientedConstVectorBase<ElementType> bias, TensorReference<ElementType, dimension0, vectorOrientation, dimension2> tensor);
+
+    /// <summary> Applies the transformation M = scale[i] * M + bias[i] to each Tensor slice, in parallel. </summary>
+    ///
+    /// <typeparam name="vectorOrientation"> The orientation in which to apply the vectors. </typeparam>
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <typeparam name="dimension0"> The first dimension in the Tensor layout. </typeparam>
+    /// <typeparam name="dimension1"> The second dimension in the Tensor layout. </typeparam>
+    /// <param name="scale"> The vector of elements that multiply the Tensor slices </param>
+    /// <param name="bias"> The vector of elements to add to the Tensor slices </param>
+    /// <param name="tensor"> The tensor. </param>
+    template <Dimension vectorOrientation, ImplementationType implementation = ImplementationType::openBlas, typename ElementType, Dimension dimension0, Dimension dimension1>
+    void ParallelScaleAddUpdate(UnorientedConstVectorBase<ElementType> scale, UnorientedConstVectorBase<ElementType> bias, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> tensor);
 } // namespace math
 } // namespace ell
 
@@ -443,6 +554,138 @@ namespace math
             }
         }
     }
+
+    //
+    // Parallel variants
+    //
+
+    namespace Internal
+    {
+        // Tensors smaller than this (in elements) aren't worth spinning up threads for
+        constexpr size_t parallelTensorThreshold = 1 << 14;
+
+        template <typename FunctionType>
+        void ParallelForEachIndex(size_t count, size_t totalElements, FunctionType function)
+        {
+            size_t numThreads = std::min<size_t>(std::thread::hardware_concurrency(), count);
+            if (totalElements < parallelTensorThreshold || numThreads < 2)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    function(i);
+                }
+                return;
+            }
+
+            std::vector<std::thread> threads;
+            threads.reserve(numThreads);
+            for (size_t thread = 0; thread < numThreads; ++thread)
+            {
+                size_t begin = count * thread / numThreads;
+                size_t end = count * (thread + 1) / numThreads;
+                threads.emplace_back([begin, end, &function] {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        function(i);
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    } // namespace Internal
+
+    template <ImplementationType implementation, typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    void ParallelScaleUpdate(ElementType scalar, TensorReference<ElementType, dimension0, dimension1, dimension2> tensor)
+    {
+        Internal::ParallelForEachIndex(tensor.NumPrimarySlices(), tensor.Size(), [&](size_t i) {
+            ScaleUpdate<implementation>(scalar, tensor.GetPrimarySlice(i));
+        });
+    }
+
+    template <Dimension vectorOrientation, ImplementationType implementation, typename ElementType, Dimension dimension0, Dimension dimension2>
+    void ParallelScaleUpdate(UnorientedConstVectorBase<ElementType> vector, TensorReference<ElementType, dimension0, vectorOrientation, dimension2> tensor)
+    {
+        Internal::ParallelForEachIndex(vector.Size(), tensor.Size(), [&](size_t i) {
+            math::ScaleUpdate<implementation>(vector[i], tensor.template GetSlice<dimension0, dimension2>(i));
+        });
+    }
+
+    template <Dimension vectorOrientation, ImplementationType implementation, typename ElementType, Dimension dimension0, Dimension dimension1>
+    void ParallelScaleUpdate(UnorientedConstVectorBase<ElementType> vector, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> tensor)
+    {
+        Internal::ParallelForEachIndex(vector.Size(), tensor.Size(), [&](size_t i) {
+            math::ScaleUpdate<implementation>(vector[i], tensor.template GetSlice<dimension0, dimension1>(i));
+        });
+    }
+
+    template <ImplementationType implementation, typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    void ParallelAddUpdate(ElementType scalar, TensorReference<ElementType, dimension0, dimension1, dimension2> tensor)
+    {
+        Internal::ParallelForEachIndex(tensor.NumPrimarySlices(), tensor.Size(), [&](size_t i) {
+            AddUpdate<implementation>(scalar, tensor.GetPrimarySlice(i));
+        });
+    }
+
+    template <Dimension vectorOrientation, ImplementationType implementation, typename ElementType, Dimension dimension0, Dimension dimension2>
+    void ParallelAddUpdate(UnorientedConstVectorBase<ElementType> vector, TensorReference<ElementType, dimension0, vectorOrientation, dimension2> tensor)
+    {
+        DEBUG_CHECK_SIZES(vector.Size() != tensor.GetSize1(), "vector and tensor dimensions must be the same");
+
+        Internal::ParallelForEachIndex(vector.Size(), tensor.Size(), [&](size_t i) {
+            AddUpdate<implementation>(vector[i], tensor.template GetSlice<dimension0, dimension2>(i));
+        });
+    }
+
+    template <Dimension vectorOrientation, ImplementationType implementation, typename ElementType, Dimension dimension0, Dimension dimension1>
+    void ParallelAddUpdate(UnorientedConstVectorBase<ElementType> vector, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> tensor)
+    {
+        DEBUG_CHECK_SIZES(vector.Size() != tensor.GetSize2(), "vector and tensor dimensions must be the same");
+
+        Internal::ParallelForEachIndex(vector.Size(), tensor.Size(), [&](size_t i) {
+            AddUpdate<implementation>(vector[i], tensor.template GetSlice<dimension0, dimension1>(i));
+        });
+    }
+
+    template <Dimension vectorOrientation, ImplementationType implementation, typename ElementType, Dimension dimension1, Dimension dimension2>
+    void ParallelScaleAddUpdate(UnorientedConstVectorBase<ElementType> scale, UnorientedConstVectorBase<ElementType> bias, TensorReference<ElementType, vectorOrientation, dimension1, dimension2> tensor)
+    {
+        DEBUG_CHECK_SIZES(scale.Size() != tensor.GetSize0() || bias.Size() != tensor.GetSize0(), "vectors and tensor dimensions must be the same");
+
+        Internal::ParallelForEachIndex(tensor.GetSize2(), tensor.Size(), [&](size_t i) {
+            auto M = tensor.GetPrimarySlice(i);
+            for (size_t j = 0; j < tensor.GetSize1(); ++j)
+            {
+                auto u = M.GetColumn(j);
+                for (size_t k = 0; k < tensor.GetSize0(); ++k)
+                {
+                    u[k] = scale[k] * u[k] + bias[k];
+                }
+            }
+        });
+    }
+
+    template <Dimension vectorOrientation, ImplementationType implementation, typename ElementType, Dimension dimension0, Dimension dimension2>
+    void ParallelScaleAddUpdate(UnorientedConstVectorBase<ElementType> scale, UnorientedConstVectorBase<ElementType> bias, TensorReference<ElementType, dimension0, vectorOrientation, dimension2> tensor)
+    {
+        DEBUG_CHECK_SIZES(scale.Size() != tensor.GetSize1(), "vector and tensor dimensions must be the same");
+
+        Internal::ParallelForEachIndex(scale.Size(), tensor.Size(), [&](size_t i) {
+            ScaleAddUpdate<implementation>(scale[i], OnesMatrix(), bias[i], tensor.template GetSlice<dimension0, dimension2>(i));
+        });
+    }
+
+    template <Dimension vectorOrientation, ImplementationType implementation, typename ElementType, Dimension dimension0, Dimension dimension1>
+    void ParallelScaleAddUpdate(UnorientedConstVectorBase<ElementType> scale, UnorientedConstVectorBase<ElementType> bias, TensorReference<ElementType, dimension0, dimension1, vectorOrientation> tensor)
+    {
+        DEBUG_CHECK_SIZES(scale.Size() != tensor.GetSize2(), "vector and tensor dimensions must be the same");
+
+        Internal::ParallelForEachIndex(scale.Size(), tensor.Size(), [&](size_t i) {
+            ScaleAddUpdate<implementation>(scale[i], OnesMatrix(), bias[i], tensor.template GetSlice<dimension0, dimension1>(i));
+        });
+    }
 } // namespace math
 } // namespace ell
 
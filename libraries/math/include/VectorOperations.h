@@ -1129,6 +1129,32 @@ namespace math
         {
             const ElementType* pVectorAData = vectorA.GetConstDataPointer();
             const ElementType* pVectorBData = vectorB.GetConstDataPointer();
+
+            if (vectorA.GetIncrement() == 1 && vectorB.GetIncrement() == 1)
+            {
+                // contiguous data: unroll with four independent accumulators, so that the additions
+                // don't form a single serial dependency chain and the loop vectorizes
+                size_t size = vectorA.Size();
+                ElementType sum0 = 0;
+                ElementType sum1 = 0;
+                ElementType sum2 = 0;
+                ElementType sum3 = 0;
+                size_t i = 0;
+                for (; i + 4 <= size; i += 4)
+                {
+                    sum0 += pVectorAData[i] * pVectorBData[i];
+                    sum1 += pVectorAData[i + 1] * pVectorBData[i + 1];
+                    sum2 += pVectorAData[i + 2] * pVectorBData[i + 2];
+                    sum3 += pVectorAData[i + 3] * pVectorBData[i + 3];
+                }
+                for (; i < size; ++i)
+                {
+                    sum0 += pVectorAData[i] * pVectorBData[i];
+                }
+                result = (sum0 + sum1) + (sum2 + sum3);
+                return;
+            }
+
             const ElementType* pVectorAEnd = pVectorAData + vectorA.GetIncrement() * vectorA.Size();
             result = 0;
 
@@ -1156,6 +1182,18 @@ namespace math
         void UnaryVectorUpdateImplementation(VectorReference<ElementType, orientation> vector, BinaryOperation unaryOperation)
         {
             ElementType* pData = vector.GetDataPointer();
+
+            if (vector.GetIncrement() == 1)
+            {
+                // contiguous data: an indexed loop with unit stride, which the compiler can vectorize
+                size_t size = vector.Size();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    unaryOperation(pData[i]);
+                }
+                return;
+            }
+
             const ElementType* pEnd = pData + vector.GetIncrement() * vector.Size();
 
             while (pData < pEnd)
@@ -1170,6 +1208,18 @@ namespace math
         {
             ElementType* pVectorBData = vectorB.GetDataPointer();
             const ElementType* pVectorAData = vectorA.GetConstDataPointer();
+
+            if (vectorA.GetIncrement() == 1 && vectorB.GetIncrement() == 1)
+            {
+                // contiguous data: an indexed loop with unit stride, which the compiler can vectorize
+                size_t size = vectorB.Size();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    binaryOperation(pVectorAData[i], pVectorBData[i]);
+                }
+                return;
+            }
+
             const ElementType* pVectorBEnd = pVectorBData + vectorB.GetIncrement() * vectorB.Size();
 
             while (pVectorBData < pVectorBEnd)
@@ -1186,6 +1236,18 @@ namespace math
             ElementType* pOutputData = output.GetDataPointer();
             const ElementType* pVectortAData = vectorA.GetConstDataPointer();
             const ElementType* pVectorBData = vectorB.GetConstDataPointer();
+
+            if (vectorA.GetIncrement() == 1 && vectorB.GetIncrement() == 1 && output.GetIncrement() == 1)
+            {
+                // contiguous data: an indexed loop with unit stride, which the compiler can vectorize
+                size_t size = output.Size();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    trinaryOperation(pVectortAData[i], pVectorBData[i], pOutputData[i]);
+                }
+                return;
+            }
+
             const ElementType* pOutputEnd = pOutputData + output.GetIncrement() * output.Size();
 
             while (pOutputData < pOutputEnd)
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Float16_test.h (math_test)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <testing/include/testing.h>
+
+#include <math/include/Float16.h>
+#include <math/include/Vector.h>
+
+#include <cmath>
+
+using namespace ell;
+
+void TestFloat16Conversion();
+
+void TestFloat16Arithmetic();
+
+void TestFloat16VectorStorage();
+
+#pragma region implementation
+
+inline void TestFloat16Conversion()
+{
+    // values that are exactly representable in half precision round-trip unchanged
+    bool exactRoundTrip = static_cast<float>(math::Float16(1.0f)) == 1.0f &&
+                          static_cast<float>(math::Float16(-2.5f)) == -2.5f &&
+                          static_cast<float>(math::Float16(0.09375f)) == 0.09375f &&
+                          static_cast<float>(math::Float16(65504.0f)) == 65504.0f &&
+                          static_cast<float>(math::Float16(5.9604644775390625e-8f)) == 5.9604644775390625e-8f &&
+                          static_cast<float>(math::Float16(0.0f)) == 0.0f;
+
+    // values that exceed the half precision range become infinite, and values
+    // that are too small to represent flush to zero
+    bool rangeHandling = std::isinf(static_cast<float>(math::Float16(100000.0f))) &&
+                         std::isinf(static_cast<float>(math::Float16(-100000.0f))) &&
+                         static_cast<float>(math::Float16(1.0e-8f)) == 0.0f;
+
+    // values between representable halves round to the nearest, ties to even
+    bool rounding = static_cast<float>(math::Float16(1.0001f)) == 1.0f &&
+                    static_cast<float>(math::Float16(1.00048828125f)) == 1.0f &&
+                    static_cast<float>(math::Float16(1.0009765f)) == 1.0009765625f;
+
+    // the storage really is two bytes
+    bool storageSize = sizeof(math::Float16) == 2;
+
+    testing::ProcessTest("Float16 conversion", exactRoundTrip && rangeHandling && rounding && storageSize);
+}
+
+inline void TestFloat16Arithmetic()
+{
+    // arithmetic on Float16 operands takes place in single precision
+    math::Float16 a = 0.5f;
+    math::Float16 b = 2.0f;
+    bool expressions = a + b == 2.5f && a * b == 1.0f && b / a == 4.0f && a - b == -1.5f;
+
+    // compound assignment rounds the single precision result back to half precision
+    math::Float16 c = 1.0f;
+    c += 0.25f;
+    c *= 2.0f;
+    c -= 0.5f;
+    c /= 4.0f;
+    bool compound = static_cast<float>(c) == 0.5f;
+
+    // accumulating in single precision retains increments that half precision would drop
+    float accumulator = static_cast<float>(math::Float16(2048.0f));
+    accumulator += 1.0f; // 2049 is not representable in half precision
+    bool accumulate = accumulator == 2049.0f && static_cast<float>(math::Float16(accumulator)) == 2048.0f;
+
+    testing::ProcessTest("Float16 arithmetic", expressions && compound && accumulate);
+}
+
+inline void TestFloat16VectorStorage()
+{
+    math::RowVector<math::Float16> u{ 0.5f, 1.0f, 2.0f, -1.5f };
+    math::RowVector<float> v{ 2.0f, -1.0f, 0.25f, 4.0f };
+
+    // dot product with half precision weights and a single precision accumulator
+    float result = 0;
+    for (size_t i = 0; i < u.Size(); ++i)
+    {
+        result += u[i] * v[i];
+    }
+
+    testing::ProcessTest("Float16 Vector storage", result == -5.5f && u[2] == 2.0f);
+}
+
+#pragma endregion implementation
@@ -9,6 +9,7 @@
 
 #include <testing/include/testing.h>
 
+#include <math/include/MathArena.h>
 #include <math/include/Matrix.h>
 #include <math/include/MatrixOperations.h>
 #include <math/include/Vector.h>
@@ -58,6 +59,9 @@ void TestMatrixIsContiguous();
 template <typename ElementType>
 void TestMatrixToArray();
 
+template <typename ElementType>
+void TestMathArena();
+
 template <typename ElementType, math::MatrixLayout layout>
 void TestMatrixSwap();
 
@@ -184,12 +188,21 @@ void TestMatrixColumnwiseSum();
 template <typename ElementType, math::MatrixLayout layout, math::ImplementationType implementation>
 void TestMatrixVectorMultiplyScaleAddUpdate();
 
+template <typename ElementType, math::MatrixLayout layout, math::ImplementationType implementation>
+void TestMatrixVectorMultiplyScaleAddUpdateFused();
+
 template <typename ElementType, math::MatrixLayout layout, math::ImplementationType implementation>
 void TestVectorMatrixMultiplyScaleAddUpdate();
 
 template <typename ElementType, math::MatrixLayout layout1, math::MatrixLayout layout2, math::MatrixLayout layout3, math::ImplementationType implementation>
 void TestMatrixMatrixMultiplyScaleAddUpdate();
 
+template <typename ElementType, math::MatrixLayout layout1, math::MatrixLayout layout2, math::MatrixLayout layout3, math::ImplementationType implementation>
+void TestMatrixMatrixMultiplyScaleAddUpdateTranspose();
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestMatrixFixedMultiplyScaleAddUpdate();
+
 template <typename ElementType, math::MatrixLayout layout>
 void TestMatrixElementwiseMultiplySet();
 
@@ -427,6 +440,35 @@ void TestMatrixToArray()
     testing::ProcessTest("Matrix::ToArray", M.ToArray() == v && Sm.ToArray() == u && N.ToArray() == x && Sn.ToArray() == y);
 }
 
+template <typename ElementType>
+void TestMathArena()
+{
+    math::MathArena arena(4096);
+
+    size_t usedBefore = arena.Used();
+    math::Matrix<ElementType, math::MatrixLayout::rowMajor, math::ArenaAllocator<ElementType>> M(4, 4);
+    bool allocatedFromArena = arena.Used() > usedBefore && arena.Owns(M.GetConstDataPointer());
+
+    M.Fill(2);
+    math::Matrix<ElementType, math::MatrixLayout::rowMajor, math::ArenaAllocator<ElementType>> N(M);
+    bool copyCorrect = N == M;
+
+    size_t usedBeforeReset = arena.Used();
+    arena.Reset();
+    bool resetReclaims = arena.Used() == 0 && usedBeforeReset > 0;
+
+    // With no arena active, the allocator falls back to the heap
+    ElementType* heapBlock = nullptr;
+    {
+        math::MathArena tiny(sizeof(ElementType)); // too small for the request below
+        math::ArenaAllocator<ElementType> allocator;
+        heapBlock = allocator.allocate(16);
+        bool fallsBack = !tiny.Owns(heapBlock);
+        allocator.deallocate(heapBlock, 16);
+        testing::ProcessTest("MathArena", allocatedFromArena && copyCorrect && resetReclaims && fallsBack);
+    }
+}
+
 template <typename ElementType, math::MatrixLayout layout>
 void TestMatrixSwap()
 {
@@ -1437,6 +1479,42 @@ void TestMatrixVectorMultiplyScaleAddUpdate()
     testing::ProcessTest(implementationName + "::MultiplyScaleAddUpdate(scalar, Matrix, Vector, scalar, Vector)", u == r && w == r);
 }
 
+template <typename ElementType, math::MatrixLayout layout, math::ImplementationType implementation>
+void TestMatrixVectorMultiplyScaleAddUpdateFused()
+{
+    auto implementationName = math::Internal::MatrixOperations<implementation>::GetImplementationName();
+
+    math::Matrix<ElementType, layout> M{
+        { 1, 0 },
+        { 0, 1 },
+        { 2, 2 }
+    };
+
+    math::Matrix<ElementType, layout> N{
+        { 1, 0, 3 },
+        { 0, 1, -1 },
+        { 2, 0, 1 }
+    };
+
+    math::ColumnVector<ElementType> v{ 3, 4 };
+    math::ColumnVector<ElementType> x{ 1, 0, 2 };
+
+    ElementType s = 2;
+    ElementType t = 3;
+
+    // compute the fused result and the same quantity with two separate multiplications
+    math::ColumnVector<ElementType> u{ 1, 1, 0 };
+    math::MultiplyScaleAddUpdate<implementation>(s, M, v, N, x, t, u);
+
+    math::ColumnVector<ElementType> w{ 1, 1, 0 };
+    math::MultiplyScaleAddUpdate<implementation>(s, M, v, t, w);
+    math::MultiplyScaleAddUpdate<implementation>(s, N, x, static_cast<ElementType>(1), w);
+
+    math::ColumnVector<ElementType> r{ 23, 7, 36 };
+
+    testing::ProcessTest(implementationName + "::MultiplyScaleAddUpdate(scalar, Matrix, Vector, Matrix, Vector, scalar, Vector)", u == r && w == r);
+}
+
 template <typename ElementType, math::MatrixLayout layout, math::ImplementationType implementation>
 void TestVectorMatrixMultiplyScaleAddUpdate()
 {
@@ -1521,6 +1599,97 @@ void TestMatrixMatrixMultiplyScaleAddUpdate()
     testing::ProcessTest(implementationName + "::MultiplyScaleAddUpdate(scalar, Matrix, Matrix, scalar, Matrix)", C == R && CCC == R);
 }
 
+template <typename ElementType, math::MatrixLayout layout1, math::MatrixLayout layout2, math::MatrixLayout layout3, math::ImplementationType implementation>
+void TestMatrixMatrixMultiplyScaleAddUpdateTranspose()
+{
+    auto implementationName = math::Internal::MatrixOperations<implementation>::GetImplementationName();
+
+    math::Matrix<ElementType, layout1> A{
+        { 1, 2 },
+        { 3, 1 },
+        { 2, 0 }
+    };
+
+    // the transpose of A, stored explicitly
+    math::Matrix<ElementType, layout1> At{
+        { 1, 3, 2 },
+        { 2, 1, 0 }
+    };
+
+    math::Matrix<ElementType, layout2> B{
+        { 3, 4, 5, 6 },
+        { 8, 9, 10, 11 }
+    };
+
+    // the transpose of B, stored explicitly
+    math::Matrix<ElementType, layout2> Bt{
+        { 3, 8 },
+        { 4, 9 },
+        { 5, 10 },
+        { 6, 11 }
+    };
+
+    const auto noTranspose = math::MatrixTranspose::noTranspose;
+    const auto transpose = math::MatrixTranspose::transpose;
+
+    math::Matrix<ElementType, layout3> C1(A.NumRows(), B.NumColumns());
+    C1.Fill(1);
+    math::MultiplyScaleAddUpdate<implementation>(static_cast<ElementType>(1), noTranspose, A, noTranspose, B, static_cast<ElementType>(-1), C1);
+
+    math::Matrix<ElementType, layout3> C2(A.NumRows(), B.NumColumns());
+    C2.Fill(1);
+    math::MultiplyScaleAddUpdate<implementation>(static_cast<ElementType>(1), noTranspose, A, transpose, Bt, static_cast<ElementType>(-1), C2);
+
+    math::Matrix<ElementType, layout3> C3(A.NumRows(), B.NumColumns());
+    C3.Fill(1);
+    math::MultiplyScaleAddUpdate<implementation>(static_cast<ElementType>(1), transpose, At, noTranspose, B, static_cast<ElementType>(-1), C3);
+
+    math::Matrix<ElementType, layout3> C4(A.NumRows(), B.NumColumns());
+    C4.Fill(1);
+    math::MultiplyScaleAddUpdate<implementation>(static_cast<ElementType>(1), transpose, At, transpose, Bt, static_cast<ElementType>(-1), C4);
+
+    math::Matrix<ElementType, layout3> R{
+        { 18, 21, 24, 27 },
+        { 16, 20, 24, 28 },
+        { 5, 7, 9, 11 }
+    };
+
+    testing::ProcessTest(implementationName + "::MultiplyScaleAddUpdate(scalar, transpose, Matrix, transpose, Matrix, scalar, Matrix)", C1 == R && C2 == R && C3 == R && C4 == R);
+}
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestMatrixFixedMultiplyScaleAddUpdate()
+{
+    math::Matrix<ElementType, layout> A{
+        { 1, 2 },
+        { 3, 1 },
+        { 2, 0 }
+    };
+
+    math::Matrix<ElementType, layout> B{
+        { 3, 4, 5, 6 },
+        { 8, 9, 10, 11 }
+    };
+
+    math::Matrix<ElementType, layout> C(A.NumRows(), B.NumColumns());
+    C.Fill(1);
+    math::FixedMultiplyScaleAddUpdate<3, 2, 4>(static_cast<ElementType>(1), A, B, static_cast<ElementType>(-1), C);
+
+    math::Matrix<ElementType, layout> R{
+        { 18, 21, 24, 27 },
+        { 16, 20, 24, 28 },
+        { 5, 7, 9, 11 }
+    };
+
+    math::ColumnVector<ElementType> u{ 1, 1, 0 };
+    math::ColumnVector<ElementType> w{ 1, 1 };
+    math::FixedMultiplyScaleAddUpdate<2, 3>(static_cast<ElementType>(2), A.Transpose(), u, static_cast<ElementType>(-1), w);
+
+    math::ColumnVector<ElementType> v{ 7, 5 };
+
+    testing::ProcessTest("FixedMultiplyScaleAddUpdate", C == R && w == v);
+}
+
 template <typename ElementType, math::MatrixLayout layout>
 void TestMatrixElementwiseMultiplySet()
 {
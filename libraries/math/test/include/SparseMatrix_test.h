@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrix_test.h (math_test)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <testing/include/testing.h>
+
+#include <math/include/Matrix.h>
+#include <math/include/MatrixOperations.h>
+#include <math/include/SparseMatrix.h>
+
+using namespace ell;
+
+template <typename ElementType>
+void TestSparseMatrixCompress();
+
+template <typename ElementType>
+void TestSparseMatrixMultiplyScaleAddUpdate();
+
+#pragma region implementation
+
+template <typename ElementType>
+void TestSparseMatrixCompress()
+{
+    math::RowMatrix<ElementType> M{
+        { 1, 0, 0, 2 },
+        { 0, 0, 0, 0 },
+        { 0, 3, 0, 0 }
+    };
+
+    math::SparseMatrix<ElementType> S(M.GetConstReference());
+    bool structure = S.NumRows() == 3 && S.NumColumns() == 4 && S.NumNonzeros() == 3 &&
+                     S.GetRowOffsets() == std::vector<size_t>{ 0, 2, 2, 3 } &&
+                     S.GetColumnIndices() == std::vector<size_t>{ 0, 3, 1 } &&
+                     S.GetValues() == std::vector<ElementType>{ 1, 2, 3 };
+    bool roundTrip = S.ToDense() == M;
+
+    // conversion from a column major view stores the same entries
+    math::ColumnMatrix<ElementType> N(M);
+    math::SparseMatrix<ElementType> T(N.GetConstReference());
+    bool layouts = T.ToDense() == M;
+
+    // the density threshold admits this matrix at 0.25 density but not below
+    bool threshold = math::TryCompress(M.GetConstReference(), 0.25).has_value() &&
+                     !math::TryCompress(M.GetConstReference(), 0.2).has_value();
+
+    testing::ProcessTest("SparseMatrix compress", structure && roundTrip && layouts && threshold);
+}
+
+template <typename ElementType>
+void TestSparseMatrixMultiplyScaleAddUpdate()
+{
+    math::RowMatrix<ElementType> M{
+        { 1, 0, 0, 2 },
+        { 0, 0, 0, 0 },
+        { 0, 3, 0, -1 }
+    };
+    math::SparseMatrix<ElementType> S(M.GetConstReference());
+    math::ColumnVector<ElementType> v{ 1, 2, 3, 4 };
+    ElementType s = 2;
+    ElementType t = 3;
+
+    math::ColumnVector<ElementType> u{ 1, 1, 2 };
+    math::MultiplyScaleAddUpdate(s, S, v.GetConstReference(), t, u);
+
+    math::ColumnVector<ElementType> w{ 1, 1, 2 };
+    math::MultiplyScaleAddUpdate<math::ImplementationType::native>(s, M.GetConstReference(), v.GetConstReference(), t, w);
+
+    testing::ProcessTest("SparseMatrix MultiplyScaleAddUpdate", u == w);
+}
+
+#pragma endregion implementation
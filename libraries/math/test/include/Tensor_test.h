@@ -106,6 +106,9 @@ void TestTensorVectorMultiply();
 template <typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2, math::ImplementationType implementation>
 void TestTensorVectorScaleAddUpdate();
 
+template <typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2, math::ImplementationType implementation>
+void TestTensorParallelUpdate();
+
 #pragma region implementation
 
 #include <math/include/TensorOperations.h>
@@ -907,4 +910,35 @@ void TestTensorArchiver()
     testing::ProcessTest("void TestTensorArchiver(), write and read tensor", Ta == T);
 }
 
+template <typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2, math::ImplementationType implementation>
+void TestTensorParallelUpdate()
+{
+    // Large enough to cross the parallelization threshold
+    auto T = math::Tensor<ElementType, dimension0, dimension1, dimension2>(32, 32, 32);
+    auto S = math::Tensor<ElementType, dimension0, dimension1, dimension2>(32, 32, 32);
+    T.Fill(1);
+    S.Fill(1);
+
+    math::ParallelScaleUpdate<implementation>(static_cast<ElementType>(2), T);
+    math::ScaleUpdate<implementation>(static_cast<ElementType>(2), S);
+    bool scaleCorrect = T == S;
+
+    math::ParallelAddUpdate<implementation>(static_cast<ElementType>(3), T);
+    math::AddUpdate<implementation>(static_cast<ElementType>(3), S);
+    bool addCorrect = T == S;
+
+    math::Vector<ElementType, math::VectorOrientation::row> scale(32);
+    math::Vector<ElementType, math::VectorOrientation::row> bias(32);
+    for (size_t i = 0; i < 32; ++i)
+    {
+        scale[i] = static_cast<ElementType>(i % 5);
+        bias[i] = static_cast<ElementType>(i % 3);
+    }
+    math::ParallelScaleAddUpdate<math::Dimension::channel, implementation>(scale, bias, T);
+    math::ScaleAddUpdate<math::Dimension::channel, implementation>(scale, bias, S);
+    bool scaleAddCorrect = T == S;
+
+    testing::ProcessTest("void TestTensorParallelUpdate()", scaleCorrect && addCorrect && scaleAddCorrect);
+}
+
 #pragma endregion implementation
@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     math_benchmark.h (math_test)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <math/include/Matrix.h>
+
+#include <string>
+
+// Each benchmark prints one JSON object per line, so the output can be collected per commit:
+// {"benchmark": "...", "iterations": N, "time_ms": <per iteration>, "gflops": X} (or "gb_per_sec" for
+// bandwidth-bound cases)
+
+template <typename ElementType>
+void BenchmarkVectorScaleAddUpdate(size_t size, size_t repetitions, std::string seed = "123ABC");
+
+template <typename ElementType, ell::math::MatrixLayout layout>
+void BenchmarkMatrixVectorMultiplyScaleAddUpdate(size_t numRows, size_t numColumns, size_t repetitions, std::string seed = "123ABC");
+
+template <typename ElementType, ell::math::MatrixLayout layoutA, ell::math::MatrixLayout layoutB>
+void BenchmarkMatrixMatrixMultiplyScaleAddUpdate(size_t numRows, size_t numColumns, size_t numColumns2, size_t repetitions, std::string seed = "123ABC");
+
+#pragma region implementation
+
+#include <math/include/MatrixOperations.h>
+#include <math/include/Vector.h>
+#include <math/include/VectorOperations.h>
+
+#include <utilities/include/MillisecondTimer.h>
+#include <utilities/include/RandomEngines.h>
+
+#include <iostream>
+#include <random>
+
+using namespace ell;
+
+template <typename Function>
+double TimeBenchmark(Function function, size_t repetitions)
+{
+    // warm up
+    function();
+    function();
+
+    utilities::MillisecondTimer timer;
+    for (size_t t = 0; t < repetitions; ++t)
+    {
+        function();
+    }
+    return timer.Elapsed();
+}
+
+inline void ReportBenchmark(const std::string& name, size_t repetitions, double totalMilliseconds, double flopsPerIteration, double bytesPerIteration)
+{
+    auto seconds = totalMilliseconds / 1000.0;
+    std::cout << "{\"benchmark\": \"" << name << "\", \"iterations\": " << repetitions << ", \"time_ms\": " << totalMilliseconds / repetitions;
+    if (flopsPerIteration > 0 && seconds > 0)
+    {
+        std::cout << ", \"gflops\": " << (flopsPerIteration * repetitions) / seconds / 1.0e9;
+    }
+    if (bytesPerIteration > 0 && seconds > 0)
+    {
+        std::cout << ", \"gb_per_sec\": " << (bytesPerIteration * repetitions) / seconds / 1.0e9;
+    }
+    std::cout << "}" << std::endl;
+}
+
+template <typename ElementType>
+std::string BenchmarkTypeName()
+{
+    return std::is_same<ElementType, float>::value ? "float" : "double";
+}
+
+template <typename ElementType>
+void BenchmarkVectorScaleAddUpdate(size_t size, size_t repetitions, std::string seed)
+{
+    auto engine = utilities::GetRandomEngine(seed);
+    std::uniform_real_distribution<ElementType> uniform(-1, 1);
+    auto generator = [&]() { return uniform(engine); };
+
+    math::RowVector<ElementType> v(size);
+    v.Generate(generator);
+    math::RowVector<ElementType> u(size);
+    u.Generate(generator);
+
+    ElementType scalar = static_cast<ElementType>(-7.3);
+    auto time = TimeBenchmark([&]() { math::ScaleAddUpdate(scalar, v, static_cast<ElementType>(1.0), u); }, repetitions);
+
+    // two reads and one write per element
+    double bytes = 3.0 * size * sizeof(ElementType);
+    ReportBenchmark("ScaleAddUpdate<" + BenchmarkTypeName<ElementType>() + ">[" + std::to_string(size) + "]", repetitions, time, 2.0 * size, bytes);
+}
+
+template <typename ElementType, math::MatrixLayout layout>
+void BenchmarkMatrixVectorMultiplyScaleAddUpdate(size_t numRows, size_t numColumns, size_t repetitions, std::string seed)
+{
+    auto engine = utilities::GetRandomEngine(seed);
+    std::uniform_real_distribution<ElementType> uniform(-1, 1);
+    auto generator = [&]() { return uniform(engine); };
+
+    math::Matrix<ElementType, layout> M(numRows, numColumns);
+    M.Generate(generator);
+    math::ColumnVector<ElementType> v(numColumns);
+    v.Generate(generator);
+    math::ColumnVector<ElementType> u(numRows);
+    u.Generate(generator);
+
+    ElementType one = 1.0;
+    auto time = TimeBenchmark([&]() { math::MultiplyScaleAddUpdate(one, M, v, one, u); }, repetitions);
+
+    double flops = 2.0 * numRows * numColumns;
+    std::string layoutName = layout == math::MatrixLayout::rowMajor ? "rowMajor" : "columnMajor";
+    ReportBenchmark("MultiplyScaleAddUpdate<" + BenchmarkTypeName<ElementType>() + ">[" + std::to_string(numRows) + "x" + std::to_string(numColumns) + ", " + layoutName + ", vector]", repetitions, time, flops, 0);
+}
+
+template <typename ElementType, math::MatrixLayout layoutA, math::MatrixLayout layoutB>
+void BenchmarkMatrixMatrixMultiplyScaleAddUpdate(size_t numRows, size_t numColumns, size_t numColumns2, size_t repetitions, std::string seed)
+{
+    auto engine = utilities::GetRandomEngine(seed);
+    std::uniform_real_distribution<ElementType> uniform(-1, 1);
+    auto generator = [&]() { return uniform(engine); };
+
+    math::Matrix<ElementType, layoutA> A(numRows, numColumns);
+    A.Generate(generator);
+    math::Matrix<ElementType, layoutB> B(numColumns, numColumns2);
+    B.Generate(generator);
+    math::Matrix<ElementType, layoutA> C(numRows, numColumns2);
+    C.Generate(generator);
+
+    ElementType one = 1.0;
+    auto time = TimeBenchmark([&]() { math::MultiplyScaleAddUpdate(one, A, B, one, C); }, repetitions);
+
+    double flops = 2.0 * numRows * numColumns * numColumns2;
+    auto layoutName = [](math::MatrixLayout layout) { return layout == math::MatrixLayout::rowMajor ? std::string("rowMajor") : std::string("columnMajor"); };
+    ReportBenchmark("MultiplyScaleAddUpdate<" + BenchmarkTypeName<ElementType>() + ">[" + std::to_string(numRows) + "x" + std::to_string(numColumns) + "x" + std::to_string(numColumns2) + ", " + layoutName(layoutA) + "*" + layoutName(layoutB) + ", matrix]", repetitions, time, flops, 0);
+}
+
+#pragma endregion implementation
@@ -6,7 +6,9 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "Float16_test.h"
 #include "Matrix_test.h"
+#include "SparseMatrix_test.h"
 #include "Tensor_test.h"
 #include "Vector_test.h"
 #include "math_profile.h"
@@ -119,6 +121,7 @@ void RunTripleLayoutMatrixImplementationTests()
     TestMatrixScaleAddSetOneMatrixScalar<ElementType, layout1, layout2, layout3, implementation>();
     TestMatrixScaleAddSetScalarMatrixScalar<ElementType, layout1, layout2, layout3, implementation>();
     TestMatrixMatrixMultiplyScaleAddUpdate<ElementType, layout1, layout2, layout3, implementation>();
+    TestMatrixMatrixMultiplyScaleAddUpdateTranspose<ElementType, layout1, layout2, layout3, implementation>();
 }
 
 template <typename ElementType, math::MatrixLayout layout1, math::MatrixLayout layout2, math::ImplementationType implementation>
@@ -147,6 +150,7 @@ void RunLayoutMatrixImplementationTests()
     TestMatrixAddUpdateZero<ElementType, layout, implementation>();
     TestMatrixScaleAddUpdateScalarOnesMatrix<ElementType, layout, implementation>();
     TestMatrixVectorMultiplyScaleAddUpdate<ElementType, layout, implementation>();
+    TestMatrixVectorMultiplyScaleAddUpdateFused<ElementType, layout, implementation>();
     TestVectorMatrixMultiplyScaleAddUpdate<ElementType, layout, implementation>();
     TestVectorVectorOuter<ElementType, layout, implementation>();
 
@@ -192,6 +196,7 @@ void RunLayoutMatrixTests()
     TestMatrixDivideEqualsOperator<ElementType, layout>();
     TestMatrixRowwiseSum<ElementType, layout>();
     TestMatrixColumnwiseSum<ElementType, layout>();
+    TestMatrixFixedMultiplyScaleAddUpdate<ElementType, layout>();
     TestMatrixElementwiseMultiplySet<ElementType, layout>();
     TestMatrixRowwiseCumulativeSumUpdate<ElementType, layout>();
     TestMatrixColumnwiseCumulativeSumUpdate<ElementType, layout>();
@@ -215,6 +220,7 @@ void RunMatrixTests()
     TestMatrixGetRowIncrement<ElementType>();
     TestMatrixGetColumnIncrement<ElementType>();
     TestMatrixToArray<ElementType>();
+    TestMathArena<ElementType>();
     TestMatrixGetMajorVector<ElementType>();
 
     RunLayoutMatrixTests<ElementType, math::MatrixLayout::columnMajor>();
@@ -227,6 +233,7 @@ void RunLayoutTensorImplementationTests()
     TestTensorVectorMultiply<ElementType, dimension0, dimension1, dimension2, implementation>();
     TestTensorVectorAddUpdate<ElementType, dimension0, dimension1, dimension2, implementation>();
     TestTensorVectorScaleAddUpdate<ElementType, dimension0, dimension1, dimension2, implementation>();
+    TestTensorParallelUpdate<ElementType, dimension0, dimension1, dimension2, implementation>();
 }
 
 template <typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
@@ -275,6 +282,15 @@ void RunTensorTests()
 
 int main()
 {
+    TestFloat16Conversion();
+    TestFloat16Arithmetic();
+    TestFloat16VectorStorage();
+
+    TestSparseMatrixCompress<float>();
+    TestSparseMatrixCompress<double>();
+    TestSparseMatrixMultiplyScaleAddUpdate<float>();
+    TestSparseMatrixMultiplyScaleAddUpdate<double>();
+
     RunVectorTests<float>();
     RunVectorTests<double>();
 
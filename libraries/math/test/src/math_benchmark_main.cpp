@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     math_benchmark_main.cpp (math)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "math_benchmark.h"
+
+#include <cstdlib>
+
+using namespace ell;
+
+template <typename ElementType>
+void RunBenchmarks(size_t repetitionScale)
+{
+    constexpr auto row = math::MatrixLayout::rowMajor;
+    constexpr auto column = math::MatrixLayout::columnMajor;
+
+    BenchmarkVectorScaleAddUpdate<ElementType>(1000, 10000 * repetitionScale);
+    BenchmarkVectorScaleAddUpdate<ElementType>(100000, 1000 * repetitionScale);
+    BenchmarkVectorScaleAddUpdate<ElementType>(10000000, 10 * repetitionScale);
+
+    BenchmarkMatrixVectorMultiplyScaleAddUpdate<ElementType, row>(256, 256, 1000 * repetitionScale);
+    BenchmarkMatrixVectorMultiplyScaleAddUpdate<ElementType, row>(1024, 1024, 100 * repetitionScale);
+    BenchmarkMatrixVectorMultiplyScaleAddUpdate<ElementType, column>(1024, 1024, 100 * repetitionScale);
+
+    BenchmarkMatrixMatrixMultiplyScaleAddUpdate<ElementType, row, row>(64, 64, 64, 1000 * repetitionScale);
+    BenchmarkMatrixMatrixMultiplyScaleAddUpdate<ElementType, row, row>(256, 256, 256, 20 * repetitionScale);
+    BenchmarkMatrixMatrixMultiplyScaleAddUpdate<ElementType, row, row>(512, 512, 512, 4 * repetitionScale);
+    BenchmarkMatrixMatrixMultiplyScaleAddUpdate<ElementType, row, column>(512, 512, 512, 4 * repetitionScale);
+}
+
+int main(int argc, char* argv[])
+{
+    // an optional argument scales the repetition counts, for slower or faster machines
+    size_t repetitionScale = 1;
+    if (argc > 1)
+    {
+        repetitionScale = static_cast<size_t>(atoi(argv[1]));
+        if (repetitionScale < 1)
+        {
+            repetitionScale = 1;
+        }
+    }
+
+    RunBenchmarks<float>(repetitionScale);
+    RunBenchmarks<double>(repetitionScale);
+
+    return 0;
+}
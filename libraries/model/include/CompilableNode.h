@@ -38,6 +38,12 @@ namespace model
         /// <summary> Indicates if this node is able to compile itself to code. </summary>
         bool IsCompilable(const MapCompiler* compiler) const override { return true; }
 
+        /// <summary> Indicates if this node may compute its output directly in its input's buffer.
+        /// Nodes whose output elements depend only on the corresponding elements of their (single)
+        /// input -- elementwise operations -- can return true to let the compiler alias the two
+        /// buffers when the input has no other consumers. </summary>
+        virtual bool CanOperateInPlace() const { return false; }
+
     protected:
         CompilableNode(const std::vector<InputPortBase*>& inputs, const std::vector<OutputPortBase*>& outputs) :
             Node(inputs, outputs) {}
@@ -105,6 +111,11 @@ namespace model
         // for the node's compute function.
         virtual void CallNodeFunction(IRMapCompiler& compiler, emitters::IRFunctionEmitter& currentFunction);
 
+        // Emits code for dispatching the function that implements this node as an asynchronous task, so that
+        // independent branches of the model run concurrently. Used in place of `CallNodeFunction` when the
+        // `parallelizeBranches` compiler option is set; dependent nodes wait for the task before reading its results.
+        virtual void StartNodeFunctionTask(IRMapCompiler& compiler, emitters::IRFunctionEmitter& currentFunction);
+
     private:
         const std::string _nodeFunctionPrefix = "_Node__";
         const char _badIdentifierChars[3] = { '<', '>', ',' };
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompiledMapLoader.h (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <string>
+
+namespace ell
+{
+namespace model
+{
+    /// <summary>
+    /// Loads a shared library produced by IRCompiledMap::WriteSharedLibrary and binds its predict
+    /// and model API symbols. This class has no dependency on the emitters library or LLVM, so a
+    /// serving process can link just this loader and run precompiled models.
+    /// </summary>
+    class CompiledMapLoader
+    {
+    public:
+        /// <summary> Load a compiled model library and bind its exported functions. </summary>
+        ///
+        /// <param name="libraryPath"> The path of the shared library to load. </param>
+        /// <param name="moduleName"> The module name the model was compiled with (used to find the
+        /// model API functions, e.g. "ELL"). </param>
+        /// <param name="predictFunctionName"> The name of the predict function the model was
+        /// compiled with (e.g. "predict"). </param>
+        CompiledMapLoader(const std::string& libraryPath, const std::string& moduleName = "ELL", const std::string& predictFunctionName = "predict");
+
+        CompiledMapLoader(const CompiledMapLoader&) = delete;
+        CompiledMapLoader& operator=(const CompiledMapLoader&) = delete;
+        CompiledMapLoader(CompiledMapLoader&& other);
+
+        ~CompiledMapLoader();
+
+        /// <summary> Run the model on a single example, reading from and writing to caller-owned
+        /// buffers of the model's input and output types. </summary>
+        ///
+        /// <param name="context"> The context object passed through to any callbacks. </param>
+        /// <param name="input"> A pointer to the input example. </param>
+        /// <param name="output"> A pointer to a buffer for the output. </param>
+        void Compute(void* context, const void* input, void* output) const { _predictFunction(context, input, output); }
+
+        /// <summary> Get the size of the indicated model input. </summary>
+        ///
+        /// <param name="index"> The index of the input. </param>
+        int GetInputSize(int index = 0) const { return _getInputSizeFunction(index); }
+
+        /// <summary> Get the size of the indicated model output. </summary>
+        ///
+        /// <param name="index"> The index of the output. </param>
+        int GetOutputSize(int index = 0) const { return _getOutputSizeFunction(index); }
+
+        /// <summary> Reset any model state. </summary>
+        void Reset() const;
+
+    private:
+        void* ResolveSymbol(const std::string& name, bool required) const;
+
+        void* _library = nullptr;
+        void (*_predictFunction)(void*, const void*, void*) = nullptr;
+        int (*_getInputSizeFunction)(int) = nullptr;
+        int (*_getOutputSizeFunction)(int) = nullptr;
+        void (*_resetFunction)() = nullptr;
+    };
+} // namespace model
+} // namespace ell
@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     GateNodeBase.h (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CompilableNode.h"
+#include "InputPort.h"
+
+namespace ell
+{
+namespace model
+{
+    /// <summary> Base class for nodes that gate the execution of part of a model. </summary>
+    ///
+    /// A gate node passes its data input through unchanged, but tells the compiler that the nodes
+    /// reachable only through it are conditional: the emitted code executes them only when the
+    /// gate's condition is true, skipping the whole region with a branch otherwise. The output
+    /// buffers of skipped nodes hold unspecified values, so any result read outside the gated
+    /// region must be merged through a node that selects on the same condition (for example, a
+    /// `MultiplexerNode`). When computing a map in the interpreter the gated nodes always run, which
+    /// yields the same observable outputs as the compiled code once the results pass through the
+    /// merge.
+    class GateNodeBase : public CompilableNode
+    {
+    public:
+        /// <summary> Gets the port holding the condition controlling the gated region. </summary>
+        ///
+        /// <returns> The condition port. </returns>
+        virtual const InputPortBase& GetConditionPort() const = 0;
+
+    protected:
+        using CompilableNode::CompilableNode;
+    };
+} // namespace model
+} // namespace ell
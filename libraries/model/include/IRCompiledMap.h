@@ -23,6 +23,7 @@
 #include <utilities/include/Boolean.h>
 #include <utilities/include/TypeName.h>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <ostream>
@@ -40,9 +41,58 @@ namespace model
         using Boolean = utilities::Boolean;
 
     public:
+        /// <summary> A lightweight per-invocation handle for a compiled map. Each context holds its
+        /// own callback-context pointer and calls directly into the jitted compute function, so
+        /// several contexts can run concurrently on different threads while sharing one copy of
+        /// the module's weights. Note that models with mutable node state (e.g. recurrent nodes)
+        /// still share that state across contexts. </summary>
+        class ExecutionContext
+        {
+        public:
+            /// <summary> Run the model on a single example, reading the input from and writing the
+            /// output to caller-owned buffers of the map's input and output types. </summary>
+            ///
+            /// <param name="input"> A pointer to the input example. </param>
+            /// <param name="output"> A pointer to a buffer for the output. </param>
+            void Compute(const void* input, void* output) { _computeFunction(_context, input, output); }
+
+            /// <summary> Set the context object passed to the jitted compute function. </summary>
+            void SetContext(void* context) { _context = context; }
+
+            /// <summary> Get the context object passed to the jitted compute function. </summary>
+            void* GetContext() const { return _context; }
+
+        private:
+            friend class IRCompiledMap;
+            using RawComputeFunction = void (*)(void*, const void*, void*);
+            ExecutionContext(RawComputeFunction computeFunction, void* context) :
+                _computeFunction(computeFunction),
+                _context(context) {}
+
+            RawComputeFunction _computeFunction;
+            void* _context = nullptr;
+        };
+
+        /// <summary> A stream session: a private copy of all the stateful node storage in the map
+        /// (delay lines, sample buffers, recurrent hidden and cell state). Sessions let one
+        /// compiled map serve many interleaved input streams: switching sessions swaps the state
+        /// globals in the jitted module with a pair of memcpys instead of cloning the map (and its
+        /// weights) per stream. Obtain sessions from CreateSession. </summary>
+        class StateSession
+        {
+        public:
+            StateSession() = default;
+
+        private:
+            friend class IRCompiledMap;
+            const IRCompiledMap* _owner = nullptr;
+            std::vector<std::vector<uint8_t>> _state; // one snapshot per registered state variable
+        };
+
         IRCompiledMap(const IRCompiledMap&) = delete;
         IRCompiledMap(IRCompiledMap&& other);
         IRCompiledMap& operator=(const IRCompiledMap&) = delete;
+        ~IRCompiledMap() override;
 
         /// <summary> Clone the compiled model </summary>
         IRCompiledMap Clone();
@@ -58,6 +108,19 @@ namespace model
         /// <param name="format"> The format to write out </param>
         void WriteCode(const std::string& filePath, emitters::ModuleOutputFormat format) const override;
 
+        /// <summary>
+        /// Output the compiled model as a set of machine code files, splitting the module into
+        /// per-function partitions and running codegen for the partitions in parallel. Partition `n` is
+        /// written to `filePathPrefix` + ".n" + the format's extension.
+        /// </summary>
+        ///
+        /// <param name="filePathPrefix"> The prefix for the output file paths </param>
+        /// <param name="format"> The format to write out (must be assembly or objectCode) </param>
+        /// <param name="numTasks"> The number of partitions to split the module into </param>
+        ///
+        /// <returns> The paths of the files written </returns>
+        std::vector<std::string> WriteCodeParallel(const std::string& filePathPrefix, emitters::ModuleOutputFormat format, int numTasks) const;
+
         /// <summary> Output a 'C'-style function prototype for the compiled function </summary>
         ///
         /// <param name="filePath"> The path to the file to write </param>
@@ -81,6 +144,14 @@ namespace model
         /// <returns> A string with the function prototype </returns>
         std::string GetCodeHeaderString() const override;
 
+        /// <summary> Emit the compiled model as a self-contained shared library (.so) that exports
+        /// the predict function and model API functions with C linkage. The resulting library can
+        /// be loaded with CompiledMapLoader, so serving processes need no LLVM at all. Only
+        /// supported on POSIX hosts with a system C compiler available. </summary>
+        ///
+        /// <param name="filePath"> The path of the shared library to write. </param>
+        void WriteSharedLibrary(const std::string& filePath) const;
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -110,6 +181,12 @@ namespace model
         // Node profiling support
         //
 
+        /// <summary> Set the profiling sampling interval: only every Nth invocation is
+        /// instrumented. An interval of 1 (the default) profiles every call. </summary>
+        ///
+        /// <param name="interval"> the sampling interval, clamped to at least 1. </param>
+        void SetProfilingInterval(int interval);
+
         /// <summary> Get a pointer to the performance counters struct for the whole model. </summary>
         PerformanceCounters* GetModelPerformanceCounters();
 
@@ -163,6 +240,21 @@ namespace model
         /// <summary> Reset the performance counters for all the node types to zero. </summary>
         void ResetNodeTypeProfilingInfo();
 
+        //
+        // Memory stats support
+        //
+
+        /// <summary> Get a pointer to the memory stats struct for the model. The values are
+        /// compile-time constants describing the emitted module: total global buffer bytes, planned
+        /// peak intermediate buffer bytes, and the largest static stack frame. </summary>
+        ModelMemoryStats* GetMemoryStats();
+
+        /// <summary> Get the bytes of global buffer allocated for a node's output ports. Nodes whose
+        /// outputs reuse another node's dead buffer report zero new bytes. </summary>
+        ///
+        /// <param name="nodeIndex"> the index of the node. </param>
+        int64_t GetNodeMemoryUsage(int nodeIndex);
+
         //
         // Low-level region profiling support
         //
@@ -178,6 +270,27 @@ namespace model
         /// <summary> Reset the performance summary for the model to zero. </summary>
         void ResetRegionProfilingInfo();
 
+        /// <summary> Print per-layer totals, aggregating all profile regions that share a grouping
+        /// tag (the source layer id assigned during compilation). </summary>
+        ///
+        /// <param name="stream"> The stream to print the totals to. </param>
+        void PrintRegionLayerTotals(std::ostream& stream);
+
+        //
+        // Telemetry ring buffer support
+        //
+
+        /// <summary> Get a pointer to the telemetry ring buffer that profile regions write
+        /// per-invocation records into (only present when compiled with telemetry enabled). </summary>
+        emitters::ProfileTelemetryRecord* GetTelemetryBuffer();
+
+        /// <summary> Get the number of records the telemetry ring buffer can hold. </summary>
+        int GetTelemetryCapacity();
+
+        /// <summary> Get the monotonic count of telemetry records written so far. The last
+        /// `min(position, capacity)` records are available in the ring. </summary>
+        int GetTelemetryWritePosition();
+
         //
         // Just-in-time compilation functions
         //
@@ -200,6 +313,81 @@ namespace model
         /// <param name="outputs"> A vector containing all the output buffers. </param>
         void ComputeMultiple(const std::vector<void*>& inputs, const std::vector<void*>& outputs) override;
 
+        /// <summary> Run the model over a batch of examples in a single call. The input and output
+        /// buffers must contain batchSize densely-packed examples of the map's input and output
+        /// types and sizes. The whole batch is processed inside the jitted module, amortizing
+        /// per-call overhead across the batch. </summary>
+        ///
+        /// <param name="inputs"> A pointer to batchSize packed input examples. </param>
+        /// <param name="outputs"> A pointer to a buffer for batchSize packed output examples. </param>
+        /// <param name="batchSize"> The number of examples in the batch. </param>
+        void ComputeBatch(const void* inputs, void* outputs, int batchSize);
+
+        /// <summary> Create an execution context for this map. Contexts are cheap to create and
+        /// allow concurrent invocation from multiple threads without cloning the map (and its
+        /// weights) per thread. The context inherits the map's current callback context pointer.
+        /// </summary>
+        ///
+        /// <returns> A new execution context bound to this map's jitted compute function. </returns>
+        ExecutionContext CreateContext();
+
+        //
+        // Stream sessions
+        //
+
+        /// <summary> Create a new stream session holding a private copy of all the stateful node
+        /// storage in this map, initialized to freshly-reset state. Create sessions before running
+        /// the map, so the initial state snapshot is pristine. The new session is not active until
+        /// SwitchToSession is called. </summary>
+        ///
+        /// <returns> A new session initialized to the map's initial state. </returns>
+        std::shared_ptr<StateSession> CreateSession();
+
+        /// <summary> Make the given session's state live in the jitted module. The currently
+        /// active session's state (if any) is saved into that session first, so streams can be
+        /// interleaved by switching back and forth. Switching copies only the registered state
+        /// variables, not the map's weights, so it is cheap enough to do per input frame.
+        /// Sessions are inherently serial: only one session's state is live at a time, so callers
+        /// interleaving streams from multiple threads must serialize switch-and-compute pairs. </summary>
+        ///
+        /// <param name="session"> The session to make active. </param>
+        void SwitchToSession(const std::shared_ptr<StateSession>& session);
+
+        /// <summary> Restore a session to freshly-reset state, as if it had just been created.
+        /// If the session is currently active, the live state in the jitted module is reset
+        /// too. </summary>
+        ///
+        /// <param name="session"> The session to reset. </param>
+        void ResetSession(const std::shared_ptr<StateSession>& session);
+
+        /// <summary> Computes the map's output from the buffer given to SetInputBuffer, writing the
+        /// result into a caller-owned buffer. The jitted compute function reads and writes the
+        /// caller's memory directly, with no intermediate copies. </summary>
+        ///
+        /// <param name="output"> A pointer to the caller-owned output buffer. </param>
+        void ComputeInto(void* output) override;
+
+        //
+        // Asynchronous invocation
+        //
+
+        /// <summary> Callback invoked on the worker thread when an asynchronous request completes.
+        /// The output pointer is only valid for the duration of the callback. </summary>
+        using AsyncCallback = std::function<void(void* output)>;
+
+        /// <summary> Submit an input for asynchronous computation. The input is copied into an
+        /// internal staging buffer before this returns, so the caller's buffer can immediately be
+        /// reused (e.g. to capture the next frame while the current one computes). Requests are
+        /// processed in submission order on a single worker thread, and the completion callback
+        /// runs on that thread. </summary>
+        ///
+        /// <param name="input"> A pointer to the input example; copied before returning. </param>
+        /// <param name="callback"> The completion callback. </param>
+        void SubmitAsync(const void* input, AsyncCallback callback);
+
+        /// <summary> Block until all submitted asynchronous requests have completed. </summary>
+        void WaitForPendingRequests();
+
         /// <summary> Reset any model state. </summary>
         void Reset() override;
 
@@ -249,7 +437,23 @@ namespace model
         std::variant<ComputeFunction<bool>, ComputeFunction<int>, ComputeFunction<int64_t>, ComputeFunction<float>, ComputeFunction<double>> _computeInputFunction;
         std::variant<Vector<bool>, Vector<int>, Vector<int64_t>, Vector<float>, Vector<double>> _cachedOutput;
         std::function<void(void*, void* const*, void* const*)> _computeDispatchFunction;
+        std::function<void(void*, const void*, void*, int32_t)> _computeBatchFunction;
+        ExecutionContext::RawComputeFunction _rawComputeFunction = nullptr;
+
+        struct AsyncState;
+        std::unique_ptr<AsyncState> _asyncState;
         std::function<void()> _resetFunction;
+
+        struct StateVariableBinding
+        {
+            void* address;
+            size_t byteSize;
+        };
+        void EnsureSessionState();
+        std::vector<StateVariableBinding> _stateVariables;
+        std::vector<std::vector<uint8_t>> _initialState;
+        std::shared_ptr<StateSession> _activeSession;
+        bool _sessionStateResolved = false;
     };
 } // namespace model
 } // namespace ell
@@ -326,9 +530,14 @@ namespace model
             }
 
             _computeInputFunction = computeFunction;
+            _rawComputeFunction = reinterpret_cast<ExecutionContext::RawComputeFunction>(functionPointer);
+
             functionPointer = _executionEngine->ResolveFunctionAddress(_functionName + "_dispatch");
             _computeDispatchFunction = reinterpret_cast<void(*)(void*, void* const*, void* const*)>(functionPointer);
 
+            functionPointer = _executionEngine->ResolveFunctionAddress(_functionName + "_batch");
+            _computeBatchFunction = reinterpret_cast<void (*)(void*, const void*, void*, int32_t)>(functionPointer);
+
             functionPointer = _executionEngine->ResolveFunctionAddress(_moduleName + "_Reset");
             _resetFunction = reinterpret_cast<void(*)()>(functionPointer);
         }
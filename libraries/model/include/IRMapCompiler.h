@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "GateNodeBase.h"
 #include "IRCompiledMap.h"
 #include "InputPort.h"
 #include "MapCompiler.h"
@@ -15,12 +16,16 @@
 #include "NodeMap.h"
 #include "OutputPort.h"
 
+#include <emitters/include/IRIfEmitter.h>
 #include <emitters/include/IRModuleEmitter.h>
+#include <emitters/include/IRTask.h>
 #include <emitters/include/LLVMUtilities.h>
 
 #include <utilities/include/Logger.h>
 
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ell
@@ -53,6 +58,29 @@ namespace model
         /// <param name="functionName"> The name of the function to evaluate the map </param>
         IRCompiledMap Compile(Map map);
 
+        /// <summary> Compile several variants of a model (e.g. the same model imported at
+        /// different input resolutions) into a single module. Each variant gets its own fully
+        /// shape-specialized predict function, identical constant data (the weights) is shared
+        /// between them, and a `<name>_variant` dispatch function selects the variant matching
+        /// a runtime input size. The first map is the primary one: it is emitted under the
+        /// usual predict name and is the one the returned CompiledMap runs. </summary>
+        ///
+        /// <param name="maps"> The map variants to compile; all must have a single input and
+        /// distinct input sizes. </param>
+        IRCompiledMap CompileMultiVariant(std::vector<Map> maps);
+
+        /// <summary> Compile several operating points of a model (e.g. a high-accuracy and a
+        /// low-power variant of the same network) into a single module. Each point gets its own
+        /// fully specialized `<name>_point<i>` function, identical constant data is shared
+        /// between them, and the public predict function dispatches to the point selected by
+        /// an emitted `<module>_SetOperatingPoint(int)` call. The selection is read once per
+        /// predict call, so a switch takes effect on the next inference, never mid-inference.
+        /// The first map is point 0, the default, and backs the returned CompiledMap. </summary>
+        ///
+        /// <param name="maps"> The operating points to compile; all must have identical input
+        /// and output sizes, since callers switch between them without changing their buffers. </param>
+        IRCompiledMap CompileOperatingPoints(std::vector<Map> maps);
+
         /// <summary> Gets the compiler parameters being used by the IR emitter. </summary>
         ///
         /// <returns> The CompilerOptions struct used by the IR emitter to control code generation. </returns>
@@ -147,6 +175,20 @@ namespace model
         /// <returns> The generated name. </returns>
         std::string GetGlobalName(const Node& node, const std::string& baseName) const;
 
+        /// <summary> Wait for any outstanding asynchronous node tasks computing this node's inputs. </summary>
+        ///
+        /// <param name="function"> The function currently being emitted into. </param>
+        /// <param name="node"> The node about to be compiled. </param>
+        void WaitForNodeTasks(emitters::IRFunctionEmitter& function, const Node& node);
+
+        /// <summary> Dispatch a node's function as an asynchronous task, so that independent branches of the model run concurrently. </summary>
+        ///
+        /// <param name="function"> The function currently being emitted into. </param>
+        /// <param name="node"> The node being compiled. </param>
+        /// <param name="nodeFunction"> The emitted function for the node. </param>
+        /// <param name="arguments"> The arguments to the node function. </param>
+        void StartNodeTask(emitters::IRFunctionEmitter& function, const Node& node, emitters::LLVMFunction nodeFunction, const std::vector<emitters::LLVMValue>& arguments);
+
     protected:
         void OnBeginCompileModel(const Model& model) override;
         void OnEndCompileModel(const Model& model) override;
@@ -164,10 +206,14 @@ namespace model
     private:
         NodeMap<emitters::IRBlockRegion*>& GetCurrentNodeBlocks();
         const Node* GetUniqueParent(const Node& node);
+        void WaitForAllNodeTasks(emitters::IRFunctionEmitter& function);
         void RefineAndOptimize(Map& map);
         bool TryMergeNodeIntoRegion(emitters::IRBlockRegion* pDestination, const Node& src);
 
         void EmitPredictDispatchFunction(const Map& map);
+        void EmitPredictBatchFunction(const Map& map);
+        void EmitVariantDispatchFunction();
+        void EmitOperatingPointFunctions();
         void EmitGetInputSizeFunction(const Map& map);
         void EmitGetOutputSizeFunction(const Map& map);
         void EmitGetSinkOutputSizeFunction(const Map& map);
@@ -185,6 +231,27 @@ namespace model
 
         // stack of node regions
         std::vector<NodeMap<emitters::IRBlockRegion*>> _nodeRegions;
+
+        // shape-specialized predict variants, dispatched on input size
+        struct PredictVariant
+        {
+            std::string functionName;
+            int inputSize;
+        };
+        std::vector<PredictVariant> _predictVariants;
+
+        // operating-point predict variants (same shapes, different accuracy/cost), selected
+        // between inferences by the emitted SetOperatingPoint function; entry 0 is the default
+        std::vector<std::string> _operatingPointFunctions;
+
+        // outstanding asynchronous node tasks, waited on by their dependents as they're compiled
+        std::unordered_map<const Node*, emitters::IRTask> _nodeTasks;
+
+        // conditionally-executed nodes: each entry maps a node to the gates whose conditions must
+        // all be true for the node to run (see `GateNodeBase`)
+        void FindGatedNodes(const Model& model);
+        std::unordered_map<const Node*, std::vector<const GateNodeBase*>> _gatedNodes;
+        std::unique_ptr<emitters::IRIfEmitter> _gatedRegionEmitter;
     };
 } // namespace model
 } // namespace ell
@@ -33,6 +33,14 @@ struct PerformanceCounters
     int count;
     double totalTime;
 };
+
+/// <summary> A struct that holds summary information about the compiled model's memory usage </summary>
+struct ModelMemoryStats
+{
+    int64_t globalBufferBytes; // total bytes of global intermediate (port output) buffers in the module
+    int64_t peakIntermediateBytes; // planned peak bytes of intermediate buffers live at once (equals globalBufferBytes when buffer reuse is off)
+    int64_t peakStackScratchBytes; // largest static stack frame among the emitted functions
+};
 }
 
 namespace ell
@@ -45,7 +53,8 @@ namespace emitters
 
 namespace model
 {
-    // import NodeInfo and PerformanceCounters into our namespace
+    // import NodeInfo, PerformanceCounters, and ModelMemoryStats into our namespace
+    using ::ModelMemoryStats;
     using ::NodeInfo;
     using ::PerformanceCounters;
     class Model;
@@ -85,6 +94,7 @@ namespace model
         void Init(emitters::IRFunctionEmitter& function);
         void Start(emitters::IRFunctionEmitter& function, emitters::LLVMValue startTime);
         void End(emitters::IRFunctionEmitter& function, emitters::LLVMValue startTime);
+        void End(emitters::IRFunctionEmitter& function, emitters::LLVMValue startTime, emitters::LLVMValue endTime);
         void Reset(emitters::IRFunctionEmitter& function);
 
         emitters::IRModuleEmitter* _module = nullptr;
@@ -106,6 +116,7 @@ namespace model
         void Init(emitters::IRFunctionEmitter& function);
         void Start(emitters::IRFunctionEmitter& function, emitters::LLVMValue startTime);
         void End(emitters::IRFunctionEmitter& function, emitters::LLVMValue endTime);
+        void End(emitters::IRFunctionEmitter& function, emitters::LLVMValue startTime, emitters::LLVMValue endTime);
         void Reset(emitters::IRFunctionEmitter& function);
 
         friend class ModelProfiler;
@@ -174,6 +185,16 @@ namespace model
         /// <summary> Emit the runtime API functions for querying model performance. </summary>
         void EmitModelProfilerFunctions();
 
+        /// <summary> Emit the runtime API functions for querying the model's memory usage. The values
+        /// are compile-time constants: buffer sizes come from the map compiler's allocator and the
+        /// scratch size from the emitted functions' static stack frames, so the instrumentation adds
+        /// no runtime cost. </summary>
+        ///
+        /// <param name="globalBufferBytes"> Total bytes of global intermediate buffers in the module. </param>
+        /// <param name="peakIntermediateBytes"> Planned peak bytes of intermediate buffers live at once. </param>
+        /// <param name="nodeBufferBytes"> Bytes of newly-allocated global buffer per node. </param>
+        void EmitMemoryStatsFunctions(size_t globalBufferBytes, size_t peakIntermediateBytes, const std::map<const Node*, size_t>& nodeBufferBytes);
+
     private:
         void CreateStructTypes();
         void AllocateNodeData();
@@ -183,6 +204,7 @@ namespace model
         NodePerformanceEmitter& GetTypePerformanceCountersForNode(const Node& node);
 
         void EmitGetNumNodeTypesFunction();
+        void EmitSetProfilingIntervalFunction();
 
         void EmitGetModelPerformanceCountersFunction();
         void EmitPrintModelProfilingInfoFunction();
@@ -198,6 +220,10 @@ namespace model
         void EmitPrintNodeTypeProfilingInfoFunction();
         void EmitResetNodeTypeProfilingInfoFunction();
 
+        void EmitGetMemoryStatsFunction(size_t globalBufferBytes, size_t peakIntermediateBytes);
+        void EmitGetNodeMemoryUsageFunction(const std::map<const Node*, size_t>& nodeBufferBytes);
+        int64_t GetPeakStackScratchBytes() const;
+
         emitters::LLVMValue CallGetCurrentTime(emitters::IRFunctionEmitter& function);
 
         emitters::IRModuleEmitter* _module = nullptr;
@@ -215,6 +241,24 @@ namespace model
         llvm::GlobalVariable* _nodeTypeInfoArray = nullptr;
         llvm::GlobalVariable* _nodeTypePerformanceCountersArray = nullptr;
 
+        // Memory stats: filled in with compile-time constants at the end of compilation
+        llvm::StructType* _memoryStatsType = nullptr;
+        llvm::GlobalVariable* _memoryStatsArray = nullptr;
+        llvm::GlobalVariable* _nodeMemoryUsageArray = nullptr;
+
+        // The node-index order used by the info and performance counter arrays
+        std::map<const Node*, int> _nodeIndices;
+
+        // Sampling state: only every Nth invocation is instrumented. The interval lives in an
+        // emitted global so it can be changed at runtime via <prefix>_SetProfilingInterval.
+        llvm::GlobalVariable* _profilingInterval = nullptr;
+        llvm::GlobalVariable* _profilingActive = nullptr;
+        llvm::GlobalVariable* _profilingInvocationCount = nullptr;
+
+        // Stack slots holding the start times for the current sampled invocation.
+        emitters::LLVMValue _modelStartTimeVar = nullptr;
+        emitters::LLVMValue _nodeStartTimeVar = nullptr;
+
         // Performance counter emitters for model
         PerformanceCountersEmitter _modelPerformanceCounters;
 
@@ -28,6 +28,7 @@
 #include <value/include/EmitterContext.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <unordered_map>
@@ -54,6 +55,32 @@ namespace model
         SinkNode
     };
 
+    /// <summary> A summary of a map's memory footprint and arithmetic cost, produced by
+    /// `Map::GetMemoryFootprint`. </summary>
+    struct MapMemoryFootprint
+    {
+        /// <summary> Total bytes of constant (weight) data held by the model's constant nodes. </summary>
+        size_t weightBytes = 0;
+
+        /// <summary> The largest number of activation bytes live at once: the maximum over the
+        /// model's nodes of the node's combined input and output sizes. </summary>
+        size_t peakActivationBytes = 0;
+
+        /// <summary> Total bytes written to (non-constant) output ports during one evaluation of
+        /// the map. </summary>
+        size_t totalActivationBytes = 0;
+
+        /// <summary> Estimated number of multiply-accumulate operations in one evaluation of the
+        /// map, counted per node type from the port sizes. </summary>
+        size_t multiplyAccumulates = 0;
+
+        /// <summary> Gets the arithmetic intensity of the map: multiply-accumulates per byte of
+        /// weight and activation data. </summary>
+        ///
+        /// <returns> The arithmetic intensity, or 0 if the map moves no data. </returns>
+        double GetArithmeticIntensity() const;
+    };
+
     /// <summary> Class that wraps a model and its designated outputs </summary>
     class Map : public utilities::IArchivable
     {
@@ -111,6 +138,27 @@ namespace model
         /// <summary> Reset the state of the model </summary>
         void Reset();
 
+        /// <summary> Computes a content hash of the map, covering the model's archived structure
+        /// and weights along with the mapped inputs and outputs. </summary>
+        ///
+        /// <returns> The content hash. </returns>
+        uint64_t ComputeHash() const;
+
+        /// <summary> Computes the map's memory footprint and estimated arithmetic cost. Weight
+        /// bytes are summed over the model's constant nodes and multiply-accumulates are counted
+        /// per node type, so the result is most accurate on refined models, where neural network
+        /// layers have been lowered to explicit constants and matrix multiplies. </summary>
+        ///
+        /// <returns> The map's memory footprint. </returns>
+        MapMemoryFootprint GetMemoryFootprint() const { return ComputeMemoryFootprint(_model); }
+
+        /// <summary> Computes the memory footprint and estimated arithmetic cost of a model that
+        /// hasn't been wrapped in a map. </summary>
+        ///
+        /// <param name="model"> The model to analyze. </param>
+        /// <returns> The model's memory footprint. </returns>
+        static MapMemoryFootprint ComputeMemoryFootprint(const Model& model);
+
         /// <summary> Returns the number of inputs to the map </summary>
         ///
         /// <returns> The number of inputs to the map </returns>
@@ -426,7 +474,25 @@ namespace model
         /// <param name="outputs"> A vector containing all the output buffers. </param>
         virtual void ComputeMultiple(const std::vector<void*>& inputs, const std::vector<void*>& outputs);
 
+        /// <summary> Lends a caller-owned input buffer to the map. The buffer must hold the map's
+        /// input type in the input's memory layout and must stay valid until the next compute
+        /// call finishes. Compiled maps read the buffer directly without copying; the interpreted
+        /// path still copies it into the input node at compute time. </summary>
+        ///
+        /// <param name="index"> The index of the input. </param>
+        /// <param name="input"> A pointer to the caller-owned input buffer. </param>
+        virtual void SetInputBuffer(int index, const void* input);
+
+        /// <summary> Computes the map's output from the buffers given to SetInputBuffer, writing
+        /// the result into a caller-owned buffer of the output type and size. Compiled maps write
+        /// the output directly without copying. </summary>
+        ///
+        /// <param name="output"> A pointer to the caller-owned output buffer. </param>
+        virtual void ComputeInto(void* output);
+
     protected:
+        const void* GetInputBuffer(size_t index) const { return index < _borrowedInputs.size() ? _borrowedInputs[index] : nullptr; }
+
         template <typename DataVectorType, typename ElementsType, data::IsDataVector<DataVectorType> Concept = true>
         void SetInputValue(InputNodeBase* node, const DataVectorType& inputValues);
 
@@ -476,9 +542,22 @@ namespace model
         std::unordered_map<std::string, const OutputPortBase*> _outputsMap;
         utilities::PropertyBag _metadata;
 
+        std::vector<const void*> _borrowedInputs;
+
         value::ComputeContext _computeContext{ "map_compute" };
     };
 
+    /// <summary> Chains two maps output-to-input into a single map: the second map's inputs are
+    /// grafted directly onto the first map's outputs, so when the combined map is compiled the
+    /// whole pipeline executes as one call and the intermediate data never leaves the module's
+    /// buffers. The maps' outputs and inputs must correspond pairwise in type and size. </summary>
+    ///
+    /// <param name="first"> The map that runs first. </param>
+    /// <param name="second"> The map whose inputs consume the first map's outputs. </param>
+    ///
+    /// <returns> A map with the first map's inputs and the second map's outputs. </returns>
+    Map ChainMaps(const Map& first, const Map& second);
+
     /// <summary> A serialization context used during Map deserialization. Wraps an existing `ModelSerializationContext` </summary>
     class MapSerializationContext : public ModelSerializationContext
     {
@@ -21,6 +21,7 @@
 #include <utilities/include/UniqueNameList.h>
 
 #include <cassert>
+#include <map>
 #include <stack>
 #include <string>
 #include <unordered_map>
@@ -29,6 +30,7 @@ namespace ell
 {
 namespace model
 {
+    class CompilableNode;
     class Map;
     class Model;
     class Node;
@@ -80,6 +82,15 @@ namespace model
         /// <returns> The ModelOptimizerOptions struct used by the map compiler to control code generation. </returns>
         ModelOptimizerOptions GetModelOptimizerOptions(const Node& node) const;
 
+        /// <summary> Sets optimization parameters to use for a specific node, overriding the global
+        /// parameters. This lets a caller apply measured per-layer choices (for instance, a
+        /// convolution-method map from a profiling run) in a single compile pass, without writing
+        /// them into the model. Options set in the node's own metadata still take precedence. </summary>
+        ///
+        /// <param name="nodeId"> The id of the node the options apply to. </param>
+        /// <param name="options"> The options to use for that node. </param>
+        void SetNodeOptimizerOptions(const std::string& nodeId, const ModelOptimizerOptions& options);
+
         //
         // Routines for Node implementers
         //
@@ -108,6 +119,18 @@ namespace model
         /// <summary> Associate the given variable with the output port. </summary>
         void SetVariableForPort(const Port& port, emitters::Variable* pVar);
 
+        /// <summary> Gets the planned peak size, in bytes, of the intermediate port buffers.
+        /// Only meaningful when the `reuseIntermediateBuffers` compiler option is enabled. </summary>
+        size_t GetPlannedPeakMemory() const { return _plannedPeakMemory; }
+
+        /// <summary> Gets the total size, in bytes, of the global intermediate port buffers allocated
+        /// for the model. </summary>
+        size_t GetTotalBufferMemory() const { return _totalBufferMemory; }
+
+        /// <summary> Gets the bytes of newly-allocated global buffer attributed to each node's output
+        /// ports. Nodes whose outputs reuse another node's dead buffer contribute zero new bytes. </summary>
+        const std::map<const Node*, size_t>& GetNodeBufferMemory() const { return _nodeBufferMemory; }
+
     protected:
         MapCompiler(const MapCompilerOptions& settings, const ModelOptimizerOptions& optimizerOptions);
 
@@ -144,15 +167,34 @@ namespace model
         friend class CompilableNode;
 
         void CompileNodes(Model& model);
+        void TryAllocateInPlace(const CompilableNode& node);
+        void RecordBufferAllocation(const OutputPortBase& port, emitters::VariableType varType);
+        void ComputePortLiveness(const Model& model);
+        void ReleaseCompletedPortVariables(const Node& node);
         emitters::Variable* AllocatePortFunctionArgument(emitters::ModuleEmitter& emitter, const OutputPortBase& port, emitters::ArgumentFlags argDirection, ell::utilities::UniqueNameList& uniqueNameScope);
         emitters::Variable* AllocatePortFunctionArgument(emitters::ModuleEmitter& emitter, const PortElementBase& element, emitters::ArgumentFlags argDirection, ell::utilities::UniqueNameList& uniqueNameScope);
 
         MapCompilerOptions _parameters;
         ModelOptimizerOptions _optimizerOptions;
+        std::unordered_map<std::string, ModelOptimizerOptions> _nodeOptimizerOptions; // per-node overrides, keyed by node id
 
         // map from ports to runtime variables, for all ports in the model
         // stored as a stack, with the top of the stack being the innermost scope
         std::vector<std::unordered_map<const Port*, emitters::Variable*>> _portToVarMaps; // Do we need separate elementToVarMaps?
+
+        // buffers of at most this many elements become stack allocations in the predict function
+        int _stackAllocateBufferThreshold = 0;
+
+        // liveness information and free-variable pool used to reuse intermediate port buffers
+        bool _reuseBuffers = false;
+        std::unordered_map<const OutputPortBase*, const Node*> _portLastUse;
+        std::vector<emitters::Variable*> _freeVariablePool;
+        size_t _currentPlannedMemory = 0;
+        size_t _plannedPeakMemory = 0;
+
+        // memory accounting for the emitted global buffers, by node
+        size_t _totalBufferMemory = 0;
+        std::map<const Node*, size_t> _nodeBufferMemory;
     };
 } // namespace model
 } // namespace ell
@@ -181,6 +223,7 @@ namespace model
         }
 
         pModuleEmitter->AllocateVariable(*pVar);
+        RecordBufferAllocation(port, varType);
         SetVariableForPort(port, pVar);
         return pVar;
     }
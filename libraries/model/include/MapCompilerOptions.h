@@ -36,9 +36,14 @@ namespace model
         std::string sinkFunctionName;
         bool verifyJittedModule = true;
         bool profile = false;
+        bool reuseIntermediateBuffers = false;
+        bool parallelizeBranches = false; // dispatch independent node functions as concurrent tasks
+        bool minimizeMemoryNodeOrder = false; // choose a topological compile order that minimizes peak live intermediate memory
+        int stackAllocateBufferThreshold = 0; // stack-allocate intermediate buffers of at most this many elements instead of emitting module globals (0 disables); stack buffers are not zero-initialized
 
         // per-node options
         bool inlineNodes = false;
+        int parallelizeCostThreshold = 100000; // minimum estimated number of arithmetic ops in a node before it is automatically parallelized
 
         // lower-level emitters settings
         emitters::CompilerOptions compilerSettings;
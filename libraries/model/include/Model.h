@@ -12,12 +12,15 @@
 #include "OutputPort.h"
 #include "PortElements.h"
 
+#include <utilities/include/ArenaAllocator.h>
 #include <utilities/include/IArchivable.h>
 #include <utilities/include/IIterator.h>
 #include <utilities/include/PropertyBag.h>
 
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <new>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -216,6 +219,12 @@ namespace model
         /// <summary> Reset the state of the model </summary>
         void Reset();
 
+        /// <summary> Computes a content hash of the model: two models with the same archived
+        /// structure and weights get the same hash. </summary>
+        ///
+        /// <returns> The content hash. </returns>
+        uint64_t ComputeHash() const;
+
         /// <summary>
         /// Visits all the nodes in the model in dependency order. No nodes will be visited until all
         /// its inputs have first been visited.
@@ -380,16 +389,29 @@ namespace model
         template <typename ValueType>
         friend class InputPort;
         friend class ModelTransformer;
+        friend class ModelEditor;
         friend class Map;
         friend void swap(Model& a, Model& b);
 
         using IDToNodeMap = std::map<Node::NodeId, std::shared_ptr<Node>, std::less<Node::NodeId>>;
         struct ModelData
         {
+            // The arena holds the storage for nodes created via AddNode, so that nodes created together are
+            // adjacent in memory. It must be declared before the node map: members are destroyed in reverse
+            // declaration order, so the nodes' destructors run before their storage is released.
+            utilities::ArenaAllocator nodeArena;
+
             // The id->node map acts both as the main container that holds the shared pointers to nodes, and as the index
             // to look nodes up by id.
             // We keep it sorted by id to make visiting all nodes deterministically ordered
             IDToNodeMap idToNodeMap;
+
+            // Cached result of a full-model dependency-order traversal, so repeated Visit calls don't
+            // redo the topological sort. Node insertions append to it (a new node can only depend on
+            // nodes that already exist); edits that rewire existing ports invalidate it.
+            mutable std::vector<const Node*> visitOrder;
+            mutable bool visitOrderValid = false;
+
             utilities::PropertyBag metadata;
         };
 
@@ -399,6 +421,10 @@ namespace model
         const OutputPortBase& AddSliceNode(const PortRange& inputRange);
         const OutputPortBase& AddSpliceNode(const std::vector<const OutputPortBase*>& outputPorts);
         Node* AddExistingNode(std::unique_ptr<Node> node);
+        Node* AddArenaNode(Node* node);
+        Node* RegisterNode(std::shared_ptr<Node> node);
+        const std::vector<const Node*>& GetVisitOrder() const;
+        void InvalidateVisitOrder() const;
         void EnsureNodeHasUniqueId(Node& node);
         void Verify() const;
         void VerifyNodes() const;
@@ -516,12 +542,12 @@ namespace model
     template <typename NodeType, typename... Args>
     NodeType* Model::AddNode(Args&&... args)
     {
-        auto node = std::make_unique<NodeType>(detail::ModelNodeRouter::ConvertPortElementsArg(*this, std::forward<Args>(args))...);
-        auto result = node.get();
+        auto storage = _data->nodeArena.Allocate(sizeof(NodeType), alignof(NodeType));
+        auto result = new (storage) NodeType(detail::ModelNodeRouter::ConvertPortElementsArg(*this, std::forward<Args>(args))...);
 
         detail::LogNewNode(result);
 
-        AddExistingNode(std::move(node));
+        AddArenaNode(result);
         return result;
     }
 
@@ -615,12 +641,16 @@ namespace model
     // Visitors
     //
 
-    // Visits the entire model
+    // Visits the entire model, in an order cached across calls
     template <typename Visitor>
     void Model::Visit(Visitor&& visitor) const
     {
-        std::vector<const OutputPortBase*> emptyVec;
-        VisitSubmodel(emptyVec, visitor);
+        // index-based loop, in case the visitor adds nodes (they get appended to the order)
+        const auto& order = GetVisitOrder();
+        for (size_t index = 0; index < order.size(); ++index)
+        {
+            visitor(*order[index]);
+        }
     }
 
     // Visits just the parts necessary to compute output node
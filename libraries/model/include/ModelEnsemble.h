@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ModelEnsemble.h (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "IRCompiledMap.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ell
+{
+namespace model
+{
+    /// <summary> Runs a set of compiled maps on one shared pool of scheduler threads, so deploying
+    /// several models on a device doesn't multiply per-model threads and queues. Each model is
+    /// registered under a name with a priority; submitted invocations are dispatched
+    /// highest-priority-first (FIFO within a priority), and invocations of the same model are
+    /// serialized so the map's internal state is never raced. Pairs with the useSharedRuntime
+    /// compiler option, which lets the emitted modules themselves share one worker thread pool
+    /// when statically linked together. </summary>
+    class ModelEnsemble
+    {
+    public:
+        /// <summary> The callback invoked when a submitted invocation finishes. The output pointer
+        /// is only valid for the duration of the call. </summary>
+        using InvocationCallback = std::function<void(const void* output)>;
+
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="numThreads"> The number of scheduler threads shared by all models. </param>
+        ModelEnsemble(int numThreads = 1);
+
+        ~ModelEnsemble();
+
+        ModelEnsemble(const ModelEnsemble&) = delete;
+        ModelEnsemble& operator=(const ModelEnsemble&) = delete;
+
+        /// <summary> Adds a compiled map to the ensemble. Finishes jitting the map up front, so
+        /// submissions have no first-call cost. </summary>
+        ///
+        /// <param name="name"> The name invocations are submitted under. </param>
+        /// <param name="map"> The compiled map to add. </param>
+        /// <param name="priority"> The model's priority; lower values are dispatched first. </param>
+        void AddModel(const std::string& name, std::shared_ptr<IRCompiledMap> map, int priority);
+
+        /// <summary> Submits an invocation of a model. The input is copied, so the caller's buffer
+        /// may be reused immediately; the callback runs on a scheduler thread. </summary>
+        ///
+        /// <param name="name"> The name the model was added under. </param>
+        /// <param name="input"> A pointer to an input example of the map's input type and size. </param>
+        /// <param name="callback"> The callback invoked with the output when the invocation finishes. </param>
+        void SubmitAsync(const std::string& name, const void* input, InvocationCallback callback);
+
+        /// <summary> Waits until all submitted invocations have finished. </summary>
+        void WaitForPendingInvocations();
+
+        /// <summary> Gets the number of models in the ensemble. </summary>
+        ///
+        /// <returns> The number of models. </returns>
+        size_t NumModels() const { return _models.size(); }
+
+    private:
+        struct ModelEntry
+        {
+            std::shared_ptr<IRCompiledMap> map;
+            std::unique_ptr<IRCompiledMap::ExecutionContext> context;
+            int priority = 0;
+            size_t inputByteSize = 0;
+            std::vector<char> output; // scratch output buffer, guarded by computeMutex
+            std::mutex computeMutex; // serializes invocations of this model
+        };
+
+        struct Invocation
+        {
+            ModelEntry* entry;
+            std::vector<char> input;
+            InvocationCallback callback;
+        };
+
+        void WorkerLoop();
+
+        std::map<std::string, ModelEntry> _models; // only modified by AddModel, under _queueMutex
+
+        // Pending invocations ordered by (priority, submission sequence): the scheduler always
+        // takes the first entry, so higher-priority models run first and same-priority
+        // invocations run in submission order
+        std::map<std::pair<int, uint64_t>, Invocation> _pending;
+        uint64_t _nextSequence = 0;
+        size_t _activeInvocations = 0;
+        bool _done = false;
+        std::mutex _queueMutex;
+        std::condition_variable _wakeup;
+        std::condition_variable _drained;
+        std::vector<std::thread> _workers;
+    };
+} // namespace model
+} // namespace ell
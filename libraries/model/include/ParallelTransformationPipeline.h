@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ParallelTransformationPipeline.h (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Transformation.h"
+
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace model
+{
+    /// <summary> A transformation that runs a sequence of transformations over a submodel, processing
+    /// independent regions of the graph concurrently.
+    ///
+    /// The submodel is partitioned into its weakly connected components. Components share no edges, so
+    /// a transformation applied to one can't observe or rewrite another, and each component can be
+    /// copied to a private model, run through the whole pipeline on a worker thread, and then merged
+    /// back into a single result model. A submodel with a single component (the common case for
+    /// a simple feed-forward model) is transformed in place on the calling thread, with no copies. </summary>
+    class ParallelTransformationPipeline : public Transformation
+    {
+    public:
+        ParallelTransformationPipeline() = default;
+
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="transformations"> The transformations to run, in order. The pipeline doesn't
+        ///   take ownership; the transformations must outlive it. </param>
+        explicit ParallelTransformationPipeline(std::vector<const Transformation*> transformations);
+
+        /// <summary> Appends a transformation to the pipeline. </summary>
+        ///
+        /// <param name="transformation"> The transformation to add. The pipeline doesn't take ownership. </param>
+        void AddTransformation(const Transformation* transformation);
+
+        /// <summary> Runs the pipeline over each independent region of the submodel, concurrently when
+        /// there is more than one region. </summary>
+        Submodel Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const override;
+
+        /// <summary> Gets the name of this type. </summary>
+        std::string GetRuntimeTypeName() const override { return "ParallelTransformationPipeline"; }
+
+        /// <summary> Splits a submodel into its weakly connected components. Each returned submodel
+        /// covers one component's nodes, with the original submodel's inputs and outputs that fall in
+        /// that component (for a whole-model submodel, a component's outputs are the ports nothing
+        /// consumes). Returns the submodel itself if it has fewer than two components. </summary>
+        ///
+        /// <param name="submodel"> The submodel to partition. </param>
+        ///
+        /// <returns> A vector of disjoint submodels over the original model. </returns>
+        static std::vector<Submodel> PartitionSubmodel(const Submodel& submodel);
+
+    private:
+        Submodel TransformRegion(const Submodel& region, ModelTransformer& transformer, const TransformContext& context) const;
+
+        std::vector<const Transformation*> _transformations;
+    };
+} // namespace model
+} // namespace ell
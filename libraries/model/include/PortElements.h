@@ -17,6 +17,7 @@
 
 #include <utilities/include/Exception.h>
 #include <utilities/include/IArchivable.h>
+#include <utilities/include/SmallVector.h>
 
 #include <algorithm>
 #include <deque>
@@ -240,7 +241,7 @@ namespace model
 
         private:
             friend class PortElementsBase;
-            Iterator(const std::vector<PortRange>& ranges);
+            Iterator(const utilities::SmallVector<PortRange, 1>& ranges);
 
             std::deque<PortRange> _ranges;
             size_t _index = 0;
@@ -322,8 +323,8 @@ namespace model
 
         /// <summary> Gets a vector of range objects </summary>
         ///
-        /// <returns> A std::vector of PortRange objects </returns>
-        const std::vector<PortRange>& GetRanges() const { return _ranges; }
+        /// <returns> A vector of PortRange objects </returns>
+        const utilities::SmallVector<PortRange, 1>& GetRanges() const { return _ranges; }
 
         /// <summary> Reserves space for the given number of ranges </summary>
         ///
@@ -376,8 +377,9 @@ namespace model
         void ReadFromArchive(utilities::Unarchiver& archiver) override;
 
     private:
-        std::vector<PortRange> _ranges;
+        utilities::SmallVector<PortRange, 1> _ranges;
         size_t _size = 0;
+        bool _isCanonical = true;
     };
 
     /// <summary> Represents a statically-typed set of values from one or more output ports </summary>
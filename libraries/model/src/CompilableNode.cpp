@@ -40,6 +40,11 @@ namespace model
 
         emitters::IRModuleEmitter& moduleEmitter = irCompiler->GetModule();
         auto& enclosingFunction = moduleEmitter.GetCurrentFunction();
+
+        // If any of this node's inputs are being computed by still-outstanding asynchronous tasks,
+        // wait for them to finish before using their results
+        irCompiler->WaitForNodeTasks(enclosingFunction, *this);
+
         if (ShouldCompileInline() || compiler.GetMapCompilerOptions(*this).inlineNodes)
         {
             Log() << "Inlining node " << DiagnosticString(*this) << " into function " << enclosingFunction.GetFunctionName() << ", currently in block " << enclosingFunction.GetCurrentBlock()->getName().str() << EOL;
@@ -85,6 +90,19 @@ namespace model
                     function.SetCompilerOptions(compiler.GetMapCompilerOptions(*this).compilerSettings);
                     function.SetAttributeForArguments(emitters::IRFunctionEmitter::Attributes::NoAlias);
 
+                    // The port buffers passed into node functions are globals emitted at the target's
+                    // preferred alignment, so tell LLVM it can use aligned vector loads and stores on them
+                    auto bufferAlignment = static_cast<uint64_t>(compiler.GetMapCompilerOptions(*this).compilerSettings.targetDevice.GetPreferredAlignment());
+                    size_t argIndex = 0;
+                    for (auto& argument : function.Arguments())
+                    {
+                        if (argument.getType()->isPointerTy())
+                        {
+                            function.SetAttributeForArgument(argIndex, emitters::IRFunctionEmitter::Attributes::Alignment, bufferAlignment);
+                        }
+                        ++argIndex;
+                    }
+
                     irCompiler->NewNodeRegion(*this);
                     Compile(*irCompiler, function);
                     irCompiler->TryMergeNodeRegion(*this);
@@ -99,7 +117,14 @@ namespace model
 
             // Call function for node
             irCompiler->NewNodeRegion(*this);
-            CallNodeFunction(*irCompiler, enclosingFunction);
+            if (compiler.GetMapCompilerOptions(*this).parallelizeBranches)
+            {
+                StartNodeFunctionTask(*irCompiler, enclosingFunction);
+            }
+            else
+            {
+                CallNodeFunction(*irCompiler, enclosingFunction);
+            }
             irCompiler->TryMergeNodeRegion(*this);
         }
     }
@@ -260,5 +285,19 @@ namespace model
         currentFunction.Call(function, args);
         Log() << "Emitting call to node function " << functionName << EOL;
     }
+
+    void CompilableNode::StartNodeFunctionTask(IRMapCompiler& compiler, emitters::IRFunctionEmitter& currentFunction)
+    {
+        auto functionName = GetCompiledFunctionName();
+        auto function = compiler.GetModule().GetFunction(functionName);
+        if (function == nullptr)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "Error: node function not found.");
+        }
+
+        auto args = GetNodeFunctionArguments(compiler, currentFunction);
+        compiler.StartNodeTask(currentFunction, *this, function, args);
+        Log() << "Dispatching node function " << functionName << " as an asynchronous task" << EOL;
+    }
 } // namespace model
 } // namespace ell
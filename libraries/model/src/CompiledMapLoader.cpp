@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompiledMapLoader.cpp (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CompiledMapLoader.h"
+
+#include <utilities/include/Exception.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace ell
+{
+namespace model
+{
+    CompiledMapLoader::CompiledMapLoader(const std::string& libraryPath, const std::string& moduleName, const std::string& predictFunctionName)
+    {
+#ifdef WIN32
+        _library = static_cast<void*>(LoadLibraryA(libraryPath.c_str()));
+#else
+        _library = dlopen(libraryPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif
+        if (_library == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "unable to load compiled model library: " + libraryPath);
+        }
+
+        _predictFunction = reinterpret_cast<void (*)(void*, const void*, void*)>(ResolveSymbol(predictFunctionName, true));
+        _getInputSizeFunction = reinterpret_cast<int (*)(int)>(ResolveSymbol(moduleName + "_GetInputSize", true));
+        _getOutputSizeFunction = reinterpret_cast<int (*)(int)>(ResolveSymbol(moduleName + "_GetOutputSize", true));
+        _resetFunction = reinterpret_cast<void (*)()>(ResolveSymbol(moduleName + "_Reset", false));
+    }
+
+    CompiledMapLoader::CompiledMapLoader(CompiledMapLoader&& other) :
+        _library(other._library),
+        _predictFunction(other._predictFunction),
+        _getInputSizeFunction(other._getInputSizeFunction),
+        _getOutputSizeFunction(other._getOutputSizeFunction),
+        _resetFunction(other._resetFunction)
+    {
+        other._library = nullptr;
+    }
+
+    CompiledMapLoader::~CompiledMapLoader()
+    {
+        if (_library != nullptr)
+        {
+#ifdef WIN32
+            FreeLibrary(static_cast<HMODULE>(_library));
+#else
+            dlclose(_library);
+#endif
+        }
+    }
+
+    void CompiledMapLoader::Reset() const
+    {
+        if (_resetFunction != nullptr)
+        {
+            _resetFunction();
+        }
+    }
+
+    void* CompiledMapLoader::ResolveSymbol(const std::string& name, bool required) const
+    {
+#ifdef WIN32
+        auto result = reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(_library), name.c_str()));
+#else
+        auto result = dlsym(_library, name.c_str());
+#endif
+        if (result == nullptr && required)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "compiled model library is missing symbol: " + name);
+        }
+        return result;
+    }
+} // namespace model
+} // namespace ell
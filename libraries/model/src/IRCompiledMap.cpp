@@ -19,11 +19,20 @@
 #include <utilities/include/Exception.h>
 #include <utilities/include/Files.h>
 #include <utilities/include/TypeAliases.h>
+#include <utilities/include/Unused.h>
 
 #include <llvm/Transforms/Utils/Cloning.h>
 
-#include <sstream>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <thread>
 
 extern "C" {
     // This is implementing the Source and SinkNode callback thunks which are used to provide support for std::function callbacks.
@@ -41,6 +50,55 @@ namespace model
 {
     using namespace utilities;
 
+    namespace
+    {
+        size_t GetPortTypeSize(Port::PortType type)
+        {
+            switch (type)
+            {
+            case Port::PortType::boolean:
+                return sizeof(bool);
+            case Port::PortType::integer:
+                return sizeof(int);
+            case Port::PortType::bigInt:
+                return sizeof(int64_t);
+            case Port::PortType::smallReal:
+                return sizeof(float);
+            case Port::PortType::real:
+                return sizeof(double);
+            default:
+                throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+            }
+        }
+    } // namespace
+
+    // Per-map state for the asynchronous submission API: a single worker thread draining a queue
+    // of staged inputs. Kept out of the header so the map's interface stays free of threading types.
+    struct IRCompiledMap::AsyncState
+    {
+        std::thread worker;
+        std::mutex mutex;
+        std::condition_variable wakeup;
+        std::condition_variable drained;
+        std::queue<std::pair<std::vector<char>, AsyncCallback>> pending;
+        std::vector<char> output;
+        size_t activeRequests = 0;
+        bool done = false;
+    };
+
+    IRCompiledMap::~IRCompiledMap()
+    {
+        if (_asyncState)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_asyncState->mutex);
+                _asyncState->done = true;
+            }
+            _asyncState->wakeup.notify_all();
+            _asyncState->worker.join();
+        }
+    }
+
     IRCompiledMap::IRCompiledMap(IRCompiledMap&& other) :
         CompiledMap(std::move(other)),
         _module(other._module),
@@ -112,12 +170,172 @@ namespace model
         _computeDispatchFunction(InternalGetContext(), inputs.data(), outputs.data());
     }
 
+    void IRCompiledMap::ComputeBatch(const void* inputs, void* outputs, int batchSize)
+    {
+        FinishJitting();
+        _computeBatchFunction(InternalGetContext(), inputs, outputs, batchSize);
+    }
+
+    IRCompiledMap::ExecutionContext IRCompiledMap::CreateContext()
+    {
+        FinishJitting();
+        return ExecutionContext(_rawComputeFunction, InternalGetContext());
+    }
+
+    void IRCompiledMap::ComputeInto(void* output)
+    {
+        auto input = GetInputBuffer(0);
+        if (input == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "SetInputBuffer must be called before calling ComputeInto");
+        }
+        FinishJitting();
+        _rawComputeFunction(InternalGetContext(), input, output);
+    }
+
+    void IRCompiledMap::SubmitAsync(const void* input, AsyncCallback callback)
+    {
+        FinishJitting();
+        if (!_asyncState)
+        {
+            _asyncState = std::make_unique<AsyncState>();
+            _asyncState->output.resize(GetOutputSize(0) * GetPortTypeSize(GetOutput(0).GetType()));
+            auto state = _asyncState.get();
+            _asyncState->worker = std::thread([this, state] {
+                std::unique_lock<std::mutex> lock(state->mutex);
+                for (;;)
+                {
+                    state->wakeup.wait(lock, [state] { return state->done || !state->pending.empty(); });
+                    if (state->pending.empty())
+                    {
+                        return; // done flag set and queue drained
+                    }
+                    auto job = std::move(state->pending.front());
+                    state->pending.pop();
+                    lock.unlock();
+                    _rawComputeFunction(InternalGetContext(), job.first.data(), state->output.data());
+                    job.second(state->output.data());
+                    lock.lock();
+                    --state->activeRequests;
+                    if (state->activeRequests == 0)
+                    {
+                        state->drained.notify_all();
+                    }
+                }
+            });
+        }
+
+        auto inputBytes = GetInputSize(0) * GetPortTypeSize(GetInput(0)->GetOutputPort().GetType());
+        std::vector<char> staged(inputBytes);
+        std::memcpy(staged.data(), input, inputBytes);
+        {
+            std::lock_guard<std::mutex> lock(_asyncState->mutex);
+            _asyncState->pending.emplace(std::move(staged), std::move(callback));
+            ++_asyncState->activeRequests;
+        }
+        _asyncState->wakeup.notify_one();
+    }
+
+    void IRCompiledMap::WaitForPendingRequests()
+    {
+        if (_asyncState)
+        {
+            std::unique_lock<std::mutex> lock(_asyncState->mutex);
+            _asyncState->drained.wait(lock, [state = _asyncState.get()] { return state->activeRequests == 0; });
+        }
+    }
+
     void IRCompiledMap::Reset()
     {
         FinishJitting();
         _resetFunction();
     }
 
+    void IRCompiledMap::EnsureSessionState()
+    {
+        if (_sessionStateResolved)
+        {
+            return;
+        }
+        FinishJitting();
+        const auto& dataLayout = _module.GetTargetDataLayout();
+        for (auto stateVariable : _module.GetModelStateVariables())
+        {
+            auto name = stateVariable->getName().str();
+            auto address = _executionEngine->GetGlobalValueAddress(name);
+            if (address == 0)
+            {
+                throw emitters::EmitterException(emitters::EmitterError::unexpected, "Could not resolve the address of model state variable " + name);
+            }
+            auto byteSize = static_cast<size_t>(dataLayout.getTypeStoreSize(stateVariable->getValueType()));
+            _stateVariables.push_back({ reinterpret_cast<void*>(address), byteSize });
+
+            // capture the pristine state so new and reset sessions start from it
+            std::vector<uint8_t> snapshot(byteSize);
+            std::memcpy(snapshot.data(), reinterpret_cast<const void*>(address), byteSize);
+            _initialState.push_back(std::move(snapshot));
+        }
+        _sessionStateResolved = true;
+    }
+
+    std::shared_ptr<IRCompiledMap::StateSession> IRCompiledMap::CreateSession()
+    {
+        EnsureSessionState();
+        auto session = std::make_shared<StateSession>();
+        session->_owner = this;
+        session->_state = _initialState;
+        return session;
+    }
+
+    void IRCompiledMap::SwitchToSession(const std::shared_ptr<StateSession>& session)
+    {
+        if (session == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::nullReference, "SwitchToSession requires a session");
+        }
+        if (session->_owner != this)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "The session does not belong to this map");
+        }
+        if (session == _activeSession)
+        {
+            return;
+        }
+        EnsureSessionState();
+        if (_activeSession)
+        {
+            for (size_t index = 0; index < _stateVariables.size(); ++index)
+            {
+                std::memcpy(_activeSession->_state[index].data(), _stateVariables[index].address, _stateVariables[index].byteSize);
+            }
+        }
+        for (size_t index = 0; index < _stateVariables.size(); ++index)
+        {
+            std::memcpy(_stateVariables[index].address, session->_state[index].data(), _stateVariables[index].byteSize);
+        }
+        _activeSession = session;
+    }
+
+    void IRCompiledMap::ResetSession(const std::shared_ptr<StateSession>& session)
+    {
+        if (session == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::nullReference, "ResetSession requires a session");
+        }
+        if (session->_owner != this)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "The session does not belong to this map");
+        }
+        session->_state = _initialState;
+        if (session == _activeSession)
+        {
+            for (size_t index = 0; index < _stateVariables.size(); ++index)
+            {
+                std::memcpy(_stateVariables[index].address, _initialState[index].data(), _stateVariables[index].byteSize);
+            }
+        }
+    }
+
     void IRCompiledMap::SetComputeFunction()
     {
         switch (GetInput(0)->GetOutputPort().GetType())
@@ -292,6 +510,30 @@ namespace model
         return std::get<Vector<double>>(_cachedOutput);
     }
 
+    void IRCompiledMap::WriteSharedLibrary(const std::string& filePath) const
+    {
+#ifdef WIN32
+        UNUSED(filePath);
+        throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented, "WriteSharedLibrary is only supported on POSIX hosts");
+#else
+        // Emit a position-independent object file and let the system compiler driver link it into
+        // a shared library, so no platform-specific linker logic lives here.
+        emitters::MachineCodeOutputOptions options;
+        options.targetDevice = _module.GetCompilerOptions().targetDevice;
+        options.relocModel = emitters::OutputRelocationModel::PIC_;
+
+        auto objectPath = filePath + ".o";
+        WriteCode(objectPath, emitters::ModuleOutputFormat::objectCode, options);
+        auto command = "cc -shared -o \"" + filePath + "\" \"" + objectPath + "\"";
+        auto result = std::system(command.c_str());
+        std::remove(objectPath.c_str());
+        if (result != 0)
+        {
+            throw emitters::EmitterException(emitters::EmitterError::writeStreamFailed, "failed to link shared library: " + command);
+        }
+#endif
+    }
+
     void IRCompiledMap::WriteCode(const std::string& filePath) const
     {
         _module.WriteToFile(filePath);
@@ -307,6 +549,11 @@ namespace model
         _module.WriteToFile(filePath, format, options);
     }
 
+    std::vector<std::string> IRCompiledMap::WriteCodeParallel(const std::string& filePathPrefix, emitters::ModuleOutputFormat format, int numTasks) const
+    {
+        return _module.WriteToFiles(filePathPrefix, format, numTasks);
+    }
+
     void IRCompiledMap::WriteCodeHeader(const std::string& filePath, emitters::ModuleOutputFormat format) const
     {
         auto stream = utilities::OpenOfstream(filePath);
@@ -339,6 +586,13 @@ namespace model
     // Profiling support
     //
 
+    void IRCompiledMap::SetProfilingInterval(int interval)
+    {
+        auto& jitter = GetJitter();
+        auto fn = reinterpret_cast<void (*)(int)>(jitter.GetFunctionAddress(_moduleName + "_SetProfilingInterval"));
+        fn(interval);
+    }
+
     void IRCompiledMap::PrintModelProfilingInfo()
     {
         auto& jitter = GetJitter();
@@ -430,6 +684,23 @@ namespace model
         return fn(nodeIndex);
     }
 
+    //
+    // Memory stats support
+    //
+    ModelMemoryStats* IRCompiledMap::GetMemoryStats()
+    {
+        auto& jitter = GetJitter();
+        auto fn = reinterpret_cast<ModelMemoryStats* (*)()>(jitter.GetFunctionAddress(_moduleName + "_GetMemoryStats"));
+        return fn();
+    }
+
+    int64_t IRCompiledMap::GetNodeMemoryUsage(int nodeIndex)
+    {
+        auto& jitter = GetJitter();
+        auto fn = reinterpret_cast<int64_t (*)(int)>(jitter.GetFunctionAddress(_moduleName + "_GetNodeMemoryUsage"));
+        return fn(nodeIndex);
+    }
+
     //
     // Low-level region profiling support
     //
@@ -447,6 +718,32 @@ namespace model
         return fn(regionIndex);
     }
 
+    void IRCompiledMap::PrintRegionLayerTotals(std::ostream& stream)
+    {
+        // Aggregate region counts and times by their grouping tag, preserving first-seen order.
+        std::vector<std::string> tagOrder;
+        std::map<std::string, std::pair<int64_t, double>> totals;
+        auto numRegions = GetNumProfileRegions();
+        for (int index = 0; index < numRegions; ++index)
+        {
+            auto info = GetRegionProfilingInfo(index);
+            std::string tag = (info->tag != nullptr && info->tag[0] != '\0') ? info->tag : "<untagged>";
+            if (totals.find(tag) == totals.end())
+            {
+                tagOrder.push_back(tag);
+            }
+            auto& entry = totals[tag];
+            entry.first += info->count;
+            entry.second += info->totalTime;
+        }
+
+        for (const auto& tag : tagOrder)
+        {
+            const auto& entry = totals[tag];
+            stream << "Layer[" << tag << "]:\ttime: " << entry.second << " ms\tcount: " << entry.first << "\n";
+        }
+    }
+
     void IRCompiledMap::ResetRegionProfilingInfo()
     {
         auto& jitter = GetJitter();
@@ -454,6 +751,30 @@ namespace model
         fn();
     }
 
+    //
+    // Telemetry ring buffer support
+    //
+    emitters::ProfileTelemetryRecord* IRCompiledMap::GetTelemetryBuffer()
+    {
+        auto& jitter = GetJitter();
+        auto fn = reinterpret_cast<ProfileTelemetryRecord* (*)()>(jitter.GetFunctionAddress(_moduleName + "_GetTelemetryBuffer"));
+        return fn();
+    }
+
+    int IRCompiledMap::GetTelemetryCapacity()
+    {
+        auto& jitter = GetJitter();
+        auto fn = reinterpret_cast<int (*)()>(jitter.GetFunctionAddress(_moduleName + "_GetTelemetryCapacity"));
+        return fn();
+    }
+
+    int IRCompiledMap::GetTelemetryWritePosition()
+    {
+        auto& jitter = GetJitter();
+        auto fn = reinterpret_cast<int (*)()>(jitter.GetFunctionAddress(_moduleName + "_GetTelemetryWritePosition"));
+        return fn();
+    }
+
     void IRCompiledMap::ResolveCallbacks()
     {
         auto list = GetModule().GetCallbackFunctionNames();
@@ -23,6 +23,7 @@
 #include <nodes/include/SinkNode.h>
 #include <nodes/include/SourceNode.h>
 
+#include <utilities/include/Exception.h>
 #include <utilities/include/Logger.h>
 #include <utilities/include/StringUtil.h>
 
@@ -30,6 +31,7 @@
 
 #include <memory>
 #include <tuple>
+#include <unordered_set>
 #include <vector>
 
 namespace ell
@@ -98,9 +100,24 @@ namespace model
             CompileMap(map, GetPredictFunctionName());
         }
 
+        // If operating-point variants were compiled into this module, the public predict
+        // becomes a dispatcher switching between them, so the API wrappers emitted below
+        // also go through the selected point
+        if (!_operatingPointFunctions.empty())
+        {
+            EmitOperatingPointFunctions();
+        }
+
         // Emit runtime model APIs
         EmitModelAPIFunctions(map);
 
+        // If other shape-specialized variants were compiled into this module, emit the
+        // function dispatching between them
+        if (!_predictVariants.empty())
+        {
+            EmitVariantDispatchFunction();
+        }
+
         if (GetMapCompilerOptions().compilerSettings.optimize)
         {
             // Save callback declarations in case they get optimized away
@@ -113,6 +130,7 @@ namespace model
 
             emitters::IROptimizer optimizer(_moduleEmitter);
             optimizer.AddStandardPasses();
+            optimizer.AddRuntimeInliningPasses();
             _moduleEmitter.Optimize(optimizer);
 
             // Reinsert callback declarations after optimization
@@ -126,6 +144,107 @@ namespace model
         return IRCompiledMap(std::move(map), GetMapCompilerOptions().mapFunctionName, GetMapCompilerOptions(), _moduleEmitter, GetMapCompilerOptions().verifyJittedModule);
     }
 
+    IRCompiledMap IRMapCompiler::CompileMultiVariant(std::vector<Map> maps)
+    {
+        if (maps.empty())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "CompileMultiVariant requires at least one map");
+        }
+
+        // Share a single copy of identical constant data (the weights) between the variants
+        GetModule().SetPoolConstantData(true);
+
+        // Record the variants for the dispatch function. The input size is what the dispatcher
+        // switches on, so the variants must be distinguishable by it.
+        _predictVariants.clear();
+        _predictVariants.push_back({ GetPredictFunctionName(), static_cast<int>(maps[0].GetInputSize()) });
+        for (size_t index = 1; index < maps.size(); ++index)
+        {
+            _predictVariants.push_back({ GetPredictFunctionName() + "_variant" + std::to_string(index), static_cast<int>(maps[index].GetInputSize()) });
+        }
+        for (size_t i = 0; i < _predictVariants.size(); ++i)
+        {
+            for (size_t j = i + 1; j < _predictVariants.size(); ++j)
+            {
+                if (_predictVariants[i].inputSize == _predictVariants[j].inputSize)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "CompileMultiVariant requires maps with distinct input sizes");
+                }
+            }
+        }
+
+        // Compile the secondary variants into the module, each fully specialized to its own shapes
+        for (size_t index = 1; index < maps.size(); ++index)
+        {
+            auto& map = maps[index];
+            Log() << "Compiling variant " << index << " of map" << EOL;
+            RefineAndOptimize(map);
+            map.RenameCallbacks(GetMapCompilerOptions().sourceFunctionName, GetMapCompilerOptions().sinkFunctionName);
+            _profiler = { GetModule(), map.GetModel(), false }; // profiling, if enabled, covers only the primary variant
+
+            ContextGuard<LLVMContext> guard(_moduleEmitter);
+            CompileMap(map, _predictVariants[index].functionName);
+        }
+
+        // The primary variant goes through the usual path, which also emits the model API
+        // functions and the variant dispatch function
+        return Compile(std::move(maps[0]));
+    }
+
+    IRCompiledMap IRMapCompiler::CompileOperatingPoints(std::vector<Map> maps)
+    {
+        if (maps.empty())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "CompileOperatingPoints requires at least one map");
+        }
+
+        // One artifact, one interface: every operating point must accept and produce the same
+        // shapes, since callers switch between them without changing their buffers
+        for (size_t index = 1; index < maps.size(); ++index)
+        {
+            bool sameInterface = maps[index].NumInputs() == maps[0].NumInputs() && maps[index].NumOutputs() == maps[0].NumOutputs();
+            for (size_t i = 0; sameInterface && i < maps[0].NumInputs(); ++i)
+            {
+                sameInterface = maps[index].GetInputSize(i) == maps[0].GetInputSize(i);
+            }
+            for (size_t i = 0; sameInterface && i < maps[0].NumOutputs(); ++i)
+            {
+                sameInterface = maps[index].GetOutputSize(i) == maps[0].GetOutputSize(i);
+            }
+            if (!sameInterface)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "CompileOperatingPoints requires maps with identical input and output sizes");
+            }
+        }
+
+        // Share a single copy of identical constant data between the points, so layers left
+        // unchanged between the variants pay for their weights only once
+        GetModule().SetPoolConstantData(true);
+
+        _operatingPointFunctions.clear();
+        for (size_t index = 0; index < maps.size(); ++index)
+        {
+            _operatingPointFunctions.push_back(GetPredictFunctionName() + "_point" + std::to_string(index));
+        }
+
+        // Compile the secondary points into the module, each fully specialized
+        for (size_t index = 1; index < maps.size(); ++index)
+        {
+            auto& map = maps[index];
+            Log() << "Compiling operating point " << index << " of map" << EOL;
+            RefineAndOptimize(map);
+            map.RenameCallbacks(GetMapCompilerOptions().sourceFunctionName, GetMapCompilerOptions().sinkFunctionName);
+            _profiler = { GetModule(), map.GetModel(), false }; // profiling, if enabled, covers only point 0
+
+            ContextGuard<LLVMContext> guard(_moduleEmitter);
+            CompileMap(map, _operatingPointFunctions[index]);
+        }
+
+        // Point 0 goes through the usual path, which also renames its predict out of the way,
+        // emits the dispatching predict in front of it, and emits the model API functions
+        return Compile(std::move(maps[0]));
+    }
+
     void IRMapCompiler::RefineAndOptimize(Map& map)
     {
         TransformContext context(this);
@@ -205,6 +324,190 @@ namespace model
         _moduleEmitter.EndFunction();
     }
 
+    void IRMapCompiler::EmitPredictBatchFunction(const Map& map)
+    {
+        auto& emitter = _moduleEmitter.GetIREmitter();
+
+        // Add a batched version of the predict function that takes densely-packed arrays of
+        // batchSize examples and loops over them inside the emitted module. This amortizes the
+        // per-call overhead of crossing the host boundary (and of reloading weights into cache)
+        // across the whole batch.
+        auto predictFunction = _moduleEmitter.GetFunction(GetPredictFunctionName());
+        emitters::NamedLLVMTypeList predictArgs;
+        for (auto arg = predictFunction->arg_begin(), end = predictFunction->arg_end(); arg != end; ++arg)
+        {
+            predictArgs.push_back({ arg->getName(), arg->getType() });
+        }
+
+        emitters::NamedLLVMTypeList args(predictArgs.begin(), predictArgs.end());
+        args.push_back({ "batchSize", emitter.Type(emitters::VariableType::Int32) });
+
+        auto functionName = GetPredictFunctionName() + "_batch";
+        auto function = _moduleEmitter.BeginFunction(functionName, emitter.Type(emitters::VariableType::Void), args);
+        function.IncludeInHeader();
+
+        // stops it from getting optimized away so it will always be in the JIT'd module.
+        function.GetFunction()->setLinkage(llvm::GlobalValue::LinkageTypes::ExternalLinkage);
+
+        // Grab the arguments positionally: context, then the input buffers, then the output
+        // buffers, then the batch size.
+        std::vector<emitters::LLVMValue> argValues;
+        for (auto& arg : function.GetFunction()->args())
+        {
+            argValues.push_back(&arg);
+        }
+
+        size_t numInputs = map.NumInputs();
+        size_t numOutputs = map.NumOutputs();
+        auto batchSize = argValues.back();
+        function.For(batchSize, [&](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar index) {
+            emitters::IRValueList arguments;
+            arguments.push_back(argValues[0]); // pass the context through
+            for (size_t i = 0; i < numInputs; ++i)
+            {
+                auto offset = index * static_cast<int>(map.GetInputSize(i));
+                arguments.push_back(fn.PointerOffset(argValues[i + 1], offset));
+            }
+            for (size_t i = 0; i < numOutputs; ++i)
+            {
+                auto offset = index * static_cast<int>(map.GetOutputSize(i));
+                arguments.push_back(fn.PointerOffset(argValues[numInputs + 1 + i], offset));
+            }
+            fn.Call(predictFunction, arguments);
+        });
+
+        function.Return();
+        _moduleEmitter.EndFunction();
+    }
+
+    void IRMapCompiler::EmitVariantDispatchFunction()
+    {
+        auto& emitter = _moduleEmitter.GetIREmitter();
+
+        // Add a predict that dispatches between the shape-specialized variants compiled into
+        // this module, selecting the one whose input size matches. Calls with a size matching
+        // no variant return without computing anything.
+        auto predictFunction = _moduleEmitter.GetFunction(GetPredictFunctionName());
+        emitters::NamedLLVMTypeList predictArgs;
+        for (auto arg = predictFunction->arg_begin(), end = predictFunction->arg_end(); arg != end; ++arg)
+        {
+            predictArgs.push_back({ arg->getName(), arg->getType() });
+        }
+
+        emitters::NamedLLVMTypeList args(predictArgs.begin(), predictArgs.end());
+        args.push_back({ "inputSize", emitter.Type(emitters::VariableType::Int32) });
+
+        auto functionName = GetPredictFunctionName() + "_variant";
+        auto function = _moduleEmitter.BeginFunction(functionName, emitter.Type(emitters::VariableType::Void), args);
+        function.IncludeInHeader();
+
+        // stops it from getting optimized away so it will always be in the JIT'd module.
+        function.GetFunction()->setLinkage(llvm::GlobalValue::LinkageTypes::ExternalLinkage);
+
+        // Grab the arguments positionally: the predict arguments, then the input size
+        std::vector<emitters::LLVMValue> argValues;
+        for (auto& arg : function.GetFunction()->args())
+        {
+            argValues.push_back(&arg);
+        }
+        auto inputSize = argValues.back();
+        emitters::IRValueList arguments(argValues.begin(), argValues.end() - 1);
+
+        for (const auto& variant : _predictVariants)
+        {
+            auto variantFunction = _moduleEmitter.GetFunction(variant.functionName);
+            auto isMatch = function.Comparison(emitters::TypedComparison::equals, inputSize, function.Literal(variant.inputSize));
+            function.If(isMatch, [&arguments, variantFunction](emitters::IRFunctionEmitter& fn) {
+                fn.Call(variantFunction, arguments);
+            });
+        }
+
+        function.Return();
+        _moduleEmitter.EndFunction();
+    }
+
+    void IRMapCompiler::EmitOperatingPointFunctions()
+    {
+        auto& emitter = _moduleEmitter.GetIREmitter();
+        auto numPoints = static_cast<int>(_operatingPointFunctions.size());
+
+        // The currently-selected operating point. A plain int32 global, zero-initialized so
+        // point 0 is the default: the dispatching predict reads it once per call, so a switch
+        // takes effect on the next inference, never mid-inference.
+        auto pointGlobal = _moduleEmitter.Global(emitters::VariableType::Int32, GetNamespacePrefix() + "_operatingPoint");
+
+        // <module>_SetOperatingPoint: select the point subsequent predict calls run.
+        // Out-of-range selections are ignored.
+        {
+            const emitters::NamedVariableTypeList parameters = { { "point", emitters::VariableType::Int32 } };
+            auto function = _moduleEmitter.BeginFunction(GetNamespacePrefix() + "_SetOperatingPoint", emitters::VariableType::Void, parameters);
+            function.IncludeInHeader();
+            auto point = function.GetFunctionArgument("point");
+            auto inRange = function.LogicalAnd(function.Comparison(emitters::TypedComparison::greaterThanOrEquals, point, function.Literal(0)),
+                                               function.Comparison(emitters::TypedComparison::lessThan, point, function.Literal(numPoints)));
+            function.If(inRange, [pointGlobal, point](emitters::IRFunctionEmitter& fn) {
+                fn.Store(pointGlobal, point);
+            });
+            function.Return();
+            _moduleEmitter.EndFunction();
+        }
+
+        // <module>_GetOperatingPoint: the point predict calls currently run
+        {
+            auto function = _moduleEmitter.BeginFunction(GetNamespacePrefix() + "_GetOperatingPoint", emitters::VariableType::Int32);
+            function.IncludeInHeader();
+            function.Return(function.Load(pointGlobal));
+            _moduleEmitter.EndFunction();
+        }
+
+        // Rename the predict compiled for point 0 out of the way and emit the public predict
+        // as a dispatcher on the selected point, so every existing entry point (including the
+        // batch and dispatch wrappers, which call through the public name) honors the selection
+        auto pointZeroFunction = _moduleEmitter.GetFunction(GetPredictFunctionName());
+        pointZeroFunction->setName(_operatingPointFunctions[0]);
+
+        emitters::NamedLLVMTypeList args;
+        for (auto arg = pointZeroFunction->arg_begin(), end = pointZeroFunction->arg_end(); arg != end; ++arg)
+        {
+            args.push_back({ arg->getName(), arg->getType() });
+        }
+
+        auto function = _moduleEmitter.BeginFunction(GetPredictFunctionName(), emitter.Type(emitters::VariableType::Void), args);
+        function.IncludeInHeader();
+        function.IncludeInPredictInterface();
+
+        std::vector<emitters::LLVMValue> argValues;
+        for (auto& arg : function.GetFunction()->args())
+        {
+            argValues.push_back(&arg);
+        }
+        emitters::IRValueList arguments(argValues.begin(), argValues.end());
+
+        if (numPoints == 1)
+        {
+            function.Call(pointZeroFunction, arguments);
+        }
+        else
+        {
+            auto currentPoint = function.Load(pointGlobal);
+            auto callPoint = [this, &arguments](int index) {
+                auto pointFunction = _moduleEmitter.GetFunction(_operatingPointFunctions[index]);
+                return [&arguments, pointFunction](emitters::IRFunctionEmitter& fn) {
+                    fn.Call(pointFunction, arguments);
+                };
+            };
+            auto dispatch = function.If(function.Comparison(emitters::TypedComparison::equals, currentPoint, function.Literal(1)), callPoint(1));
+            for (int index = 2; index < numPoints; ++index)
+            {
+                dispatch.ElseIf(function.Comparison(emitters::TypedComparison::equals, currentPoint, function.Literal(index)), callPoint(index));
+            }
+            dispatch.Else(callPoint(0)); // point 0, the default
+        }
+
+        function.Return();
+        _moduleEmitter.EndFunction();
+    }
+
     void IRMapCompiler::EmitModelAPIFunctions(const Map& map)
     {
         EmitGetInputSizeFunction(map);
@@ -217,9 +520,15 @@ namespace model
         EmitGetSinkOutputShapeFunction(map);
         EmitGetMetadataFunction(map);
         EmitPredictDispatchFunction(map);
+        EmitPredictBatchFunction(map);
 
         // Finish any profiling stuff we need to do and emit functions
         _profiler.EmitModelProfilerFunctions();
+
+        // Memory stats: the buffer accounting comes from the port variable allocator. When buffer
+        // reuse is off nothing is ever released, so the peak is just the total.
+        auto peakIntermediateMemory = GetPlannedPeakMemory() > 0 ? GetPlannedPeakMemory() : GetTotalBufferMemory();
+        _profiler.EmitMemoryStatsFunctions(GetTotalBufferMemory(), peakIntermediateMemory, GetNodeBufferMemory());
     }
 
     void IRMapCompiler::EmitGetInputSizeFunction(const Map& map)
@@ -654,8 +963,78 @@ namespace model
         return GetModule().EnsureEmitted(*pVar);
     }
 
+    void IRMapCompiler::FindGatedNodes(const Model& model)
+    {
+        _gatedNodes.clear();
+
+        // First find the nodes carrying live data: the ones that transitively depend on a model input.
+        // Source nodes without input ancestry (constants) don't count -- reading one doesn't provide a
+        // path around a gate.
+        std::unordered_set<const Node*> liveNodes;
+        auto livenessIter = model.GetNodeIterator();
+        while (livenessIter.IsValid())
+        {
+            auto node = livenessIter.Get();
+            bool live = dynamic_cast<const InputNodeBase*>(node) != nullptr;
+            for (const auto* inputPort : node->GetInputPorts())
+            {
+                live |= liveNodes.find(inputPort->GetReferencedPort().GetNode()) != liveNodes.end();
+            }
+            if (live)
+            {
+                liveNodes.insert(node);
+            }
+            livenessIter.Next();
+        }
+
+        // A node belongs to a gate's region if all of its live inputs arrive through the gate.
+        // Nodes with a live input from outside the region (such as a multiplexer reading the gate's
+        // condition) are the merge points, and stay unconditional. Regions of nested gates overlap,
+        // so a node accumulates every gate it is conditional on.
+        auto gateIter = model.GetNodeIterator();
+        while (gateIter.IsValid())
+        {
+            auto gate = dynamic_cast<const GateNodeBase*>(gateIter.Get());
+            if (gate != nullptr)
+            {
+                std::unordered_set<const Node*> region;
+                auto nodeIter = model.GetNodeIterator();
+                while (nodeIter.IsValid())
+                {
+                    auto node = nodeIter.Get();
+                    if (node != gate)
+                    {
+                        bool dependsOnGate = false;
+                        bool allThroughGate = true;
+                        for (const auto* inputPort : node->GetInputPorts())
+                        {
+                            auto source = inputPort->GetReferencedPort().GetNode();
+                            if (source == gate || region.find(source) != region.end())
+                            {
+                                dependsOnGate = true;
+                            }
+                            else if (liveNodes.find(source) != liveNodes.end())
+                            {
+                                allThroughGate = false;
+                            }
+                        }
+                        if (dependsOnGate && allThroughGate)
+                        {
+                            region.insert(node);
+                            _gatedNodes[node].push_back(gate);
+                        }
+                    }
+                    nodeIter.Next();
+                }
+            }
+            gateIter.Next();
+        }
+    }
+
     void IRMapCompiler::OnBeginCompileModel(const Model& model)
     {
+        FindGatedNodes(model);
+
         auto& currentFunction = GetModule().GetCurrentFunction();
         if (currentFunction.GetCurrentRegion() == nullptr) // TODO: put this check in GetCurrentFunction()
         {
@@ -673,9 +1052,39 @@ namespace model
     void IRMapCompiler::OnEndCompileModel(const Model& model)
     {
         auto& currentFunction = GetModule().GetCurrentFunction();
+        WaitForAllNodeTasks(currentFunction);
         _profiler.EndModel(currentFunction);
     }
 
+    void IRMapCompiler::WaitForNodeTasks(emitters::IRFunctionEmitter& function, const Node& node)
+    {
+        for (const auto* inputPort : node.GetInputPorts())
+        {
+            auto dependency = inputPort->GetReferencedPort().GetNode();
+            auto it = _nodeTasks.find(dependency);
+            if (it != _nodeTasks.end())
+            {
+                Log() << "Waiting for asynchronous task for node " << DiagnosticString(*dependency) << EOL;
+                it->second.Wait(function);
+                _nodeTasks.erase(it);
+            }
+        }
+    }
+
+    void IRMapCompiler::StartNodeTask(emitters::IRFunctionEmitter& function, const Node& node, emitters::LLVMFunction nodeFunction, const std::vector<emitters::LLVMValue>& arguments)
+    {
+        _nodeTasks.emplace(&node, function.StartAsyncTask(nodeFunction, arguments));
+    }
+
+    void IRMapCompiler::WaitForAllNodeTasks(emitters::IRFunctionEmitter& function)
+    {
+        for (auto& entry : _nodeTasks)
+        {
+            entry.second.Wait(function);
+        }
+        _nodeTasks.clear();
+    }
+
     void IRMapCompiler::OnBeginCompileNode(const Node& node)
     {
         auto& currentFunction = GetModule().GetCurrentFunction();
@@ -685,8 +1094,33 @@ namespace model
             currentFunction.AddRegion(currentFunction.GetCurrentBlock());
         }
 
+        // Tag any low-level profile regions created while compiling this node with the node's
+        // source layer (ancestor) id, so region totals in a refined, optimized model can be
+        // attributed back to the original layer.
+        auto ancestor = node.GetMetadata().HasEntry("ancestor") ? node.GetMetadata().GetEntry<std::string>("ancestor") : node.GetId().ToString();
+        GetModule().GetProfiler().SetCurrentRegionTag(ancestor);
+
+        // Apply the node's fast-math policy: nodes can opt their arithmetic into FMA contraction and
+        // reassociation (or out of it, for accumulation-sensitive computations) through the "useFastMath"
+        // entry in their "compileOptions" metadata
+        currentFunction.SetFastMathFlags(GetMapCompilerOptions(node).compilerSettings.useFastMath);
+
         _profiler.InitNode(currentFunction, node);
         _profiler.StartNode(currentFunction, node);
+
+        // If the node is conditional on one or more gates, wrap its code in a branch over the
+        // conjunction of the gate conditions (see `GateNodeBase`)
+        auto gatedNode = _gatedNodes.find(&node);
+        if (gatedNode != _gatedNodes.end())
+        {
+            emitters::LLVMValue condition = nullptr;
+            for (auto gate : gatedNode->second)
+            {
+                auto conditionValue = currentFunction.Load(EnsurePortEmitted(gate->GetConditionPort()));
+                condition = condition == nullptr ? conditionValue : currentFunction.LogicalAnd(condition, conditionValue);
+            }
+            _gatedRegionEmitter = std::make_unique<emitters::IRIfEmitter>(currentFunction, emitters::TypedComparison::notEquals, condition, currentFunction.Literal<bool>(false));
+        }
     }
 
     void IRMapCompiler::OnEndCompileNode(const Node& node)
@@ -694,7 +1128,15 @@ namespace model
         auto& currentFunction = GetModule().GetCurrentFunction();
         assert(currentFunction.GetCurrentRegion() != nullptr);
 
+        // Close the conditional branch around a gated node's code
+        if (_gatedRegionEmitter)
+        {
+            _gatedRegionEmitter->End();
+            _gatedRegionEmitter.reset();
+        }
+
         _profiler.EndNode(currentFunction, node);
+        GetModule().GetProfiler().SetCurrentRegionTag("");
 
         auto pCurBlock = currentFunction.GetCurrentBlock();
         if (pCurBlock != currentFunction.GetCurrentRegion()->End())
@@ -704,6 +1146,9 @@ namespace model
             currentFunction.GetCurrentRegion()->SetEnd(pCurBlock);
         }
 
+        // Restore the map-level fast-math policy in case this node overrode it
+        currentFunction.SetFastMathFlags(GetMapCompilerOptions().compilerSettings.useFastMath);
+
         Log() << "Finished compiling node " << DiagnosticString(node) << EOL;
     }
 
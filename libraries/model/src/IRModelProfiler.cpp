@@ -14,6 +14,10 @@
 #include <emitters/include/IRModuleEmitter.h>
 #include <emitters/include/LLVMUtilities.h>
 
+#include <llvm/IR/DataLayout.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+
 #include <algorithm>
 #include <functional>
 #include <iterator>
@@ -90,6 +94,11 @@ namespace model
     }
 
     void PerformanceCountersEmitter::End(emitters::IRFunctionEmitter& function, emitters::LLVMValue endTime)
+    {
+        End(function, _startTime, endTime);
+    }
+
+    void PerformanceCountersEmitter::End(emitters::IRFunctionEmitter& function, emitters::LLVMValue startTime, emitters::LLVMValue endTime)
     {
         assert(_performanceCountersPtr != nullptr);
 
@@ -97,7 +106,7 @@ namespace model
         auto& irBuilder = emitter.GetIRBuilder();
 
         // Compute time elapsed and increment total time counter
-        auto elapsedTime = function.Operator(emitters::TypedOperator::subtractFloat, endTime, _startTime);
+        auto elapsedTime = function.Operator(emitters::TypedOperator::subtractFloat, endTime, startTime);
         auto totalTimePtr = irBuilder.CreateInBoundsGEP(_performanceCountersPtr, { emitter.Literal(0), emitter.Literal(1) }, "accumTime");
         function.OperationAndUpdate(totalTimePtr, emitters::TypedOperator::addFloat, elapsedTime);
     }
@@ -141,6 +150,11 @@ namespace model
         _performanceCountersEmitter.End(function, endTime);
     }
 
+    void NodePerformanceEmitter::End(emitters::IRFunctionEmitter& function, emitters::LLVMValue startTime, emitters::LLVMValue endTime)
+    {
+        _performanceCountersEmitter.End(function, startTime, endTime);
+    }
+
     void NodePerformanceEmitter::Reset(emitters::IRFunctionEmitter& function)
     {
         _performanceCountersEmitter.Reset(function);
@@ -179,6 +193,12 @@ namespace model
             _module->DeclarePrintf();
             CreateStructTypes();
             AllocateNodeData();
+
+            // Sampling state: an interval of 1 (the default) instruments every invocation; larger
+            // intervals instrument every Nth one, making always-on profiling essentially free.
+            _profilingInterval = _module->Global(GetNamespacePrefix() + "_profilingInterval", 1);
+            _profilingActive = _module->Global(GetNamespacePrefix() + "_profilingActive", 1);
+            _profilingInvocationCount = _module->Global(GetNamespacePrefix() + "_profilingInvocationCount", 0);
         }
     }
 
@@ -207,7 +227,6 @@ namespace model
             return;
         }
 
-        auto startTime = CallGetCurrentTime(function);
         auto& emitter = _module->GetIREmitter();
         auto& irBuilder = emitter.GetIRBuilder();
 
@@ -216,7 +235,28 @@ namespace model
         _modelPerformanceCounters = { *_module, modelPerformanceCountersPtr, _performanceCountersType };
 
         _modelPerformanceCounters.Init(function);
-        _modelPerformanceCounters.Start(function, startTime);
+
+        // Update the invocation counter and decide whether this invocation is sampled. The start
+        // times live in stack slots so the matching End calls can read them from a separate block.
+        _modelStartTimeVar = function.Variable(emitters::VariableType::Double, "modelProfilerStartTime");
+        _nodeStartTimeVar = function.Variable(emitters::VariableType::Double, "nodeProfilerStartTime");
+
+        auto count = function.LocalScalar(function.Load(_profilingInvocationCount));
+        auto interval = function.LocalScalar(function.Load(_profilingInterval));
+        function.Store(_profilingInvocationCount, count + 1);
+        auto activeFlag = _profilingActive;
+        function.If((count % interval) == 0, [activeFlag](emitters::IRFunctionEmitter& fn) {
+                    fn.Store(activeFlag, fn.Literal(1));
+                })
+            .Else([activeFlag](emitters::IRFunctionEmitter& fn) {
+                fn.Store(activeFlag, fn.Literal(0));
+            });
+
+        function.If(function.Load(_profilingActive), [this](emitters::IRFunctionEmitter& fn) {
+            auto startTime = CallGetCurrentTime(fn);
+            fn.Store(_modelStartTimeVar, startTime);
+            _modelPerformanceCounters.Start(fn, startTime);
+        });
     }
 
     void ModelProfiler::EndModel(emitters::IRFunctionEmitter& function)
@@ -226,8 +266,10 @@ namespace model
             return;
         }
 
-        auto endTime = CallGetCurrentTime(function);
-        _modelPerformanceCounters.End(function, endTime);
+        function.If(function.Load(_profilingActive), [this](emitters::IRFunctionEmitter& fn) {
+            auto endTime = CallGetCurrentTime(fn);
+            _modelPerformanceCounters.End(fn, fn.Load(_modelStartTimeVar), endTime);
+        });
     }
 
     void ModelProfiler::InitNode(emitters::IRFunctionEmitter& function, const Node& node)
@@ -252,9 +294,12 @@ namespace model
         auto& performanceCounters = GetPerformanceCountersForNode(node);
         auto& typePerformanceCounters = GetTypePerformanceCountersForNode(node);
 
-        auto startTime = CallGetCurrentTime(function);
-        performanceCounters.Start(function, startTime);
-        typePerformanceCounters.Start(function, startTime);
+        function.If(function.Load(_profilingActive), [this, &performanceCounters, &typePerformanceCounters](emitters::IRFunctionEmitter& fn) {
+            auto startTime = CallGetCurrentTime(fn);
+            fn.Store(_nodeStartTimeVar, startTime);
+            performanceCounters.Start(fn, startTime);
+            typePerformanceCounters.Start(fn, startTime);
+        });
     }
 
     void ModelProfiler::EndNode(emitters::IRFunctionEmitter& function, const Node& node)
@@ -266,9 +311,12 @@ namespace model
         auto& performanceCounters = GetPerformanceCountersForNode(node);
         auto& typePerformanceCounters = GetTypePerformanceCountersForNode(node);
 
-        auto endTime = CallGetCurrentTime(function);
-        performanceCounters.End(function, endTime);
-        typePerformanceCounters.End(function, endTime);
+        function.If(function.Load(_profilingActive), [this, &performanceCounters, &typePerformanceCounters](emitters::IRFunctionEmitter& fn) {
+            auto startTime = fn.Load(_nodeStartTimeVar);
+            auto endTime = CallGetCurrentTime(fn);
+            performanceCounters.End(fn, startTime, endTime);
+            typePerformanceCounters.End(fn, startTime, endTime);
+        });
     }
 
     void ModelProfiler::EmitModelProfilerFunctions()
@@ -281,6 +329,8 @@ namespace model
         assert(_module != nullptr);
         assert(_model != nullptr);
 
+        EmitSetProfilingIntervalFunction();
+
         EmitGetModelPerformanceCountersFunction();
         EmitPrintModelProfilingInfoFunction();
         EmitResetModelProfilingInfoFunction();
@@ -429,6 +479,27 @@ namespace model
         _module->EndFunction();
     }
 
+    void ModelProfiler::EmitSetProfilingIntervalFunction()
+    {
+        const emitters::NamedVariableTypeList parameters = { { "interval", emitters::VariableType::Int32 } };
+        auto function = _module->BeginFunction(GetNamespacePrefix() + "_SetProfilingInterval", emitters::VariableType::Void, parameters);
+        function.IncludeInHeader();
+        function.IncludeInSwigInterface();
+
+        auto interval = function.LocalScalar(function.GetFunctionArgument("interval"));
+        auto intervalGlobal = _profilingInterval;
+
+        // Clamp to at least 1 so the sampling modulus is always valid.
+        function.If(interval < 1, [intervalGlobal](emitters::IRFunctionEmitter& fn) {
+                    fn.Store(intervalGlobal, fn.Literal(1));
+                })
+            .Else([intervalGlobal, interval](emitters::IRFunctionEmitter& fn) {
+                fn.Store(intervalGlobal, interval);
+            });
+
+        _module->EndFunction();
+    }
+
     void ModelProfiler::EmitResetModelProfilingInfoFunction()
     {
         auto& emitter = _module->GetIREmitter();
@@ -546,6 +617,110 @@ namespace model
         _module->EndFunction();
     }
 
+    void ModelProfiler::EmitMemoryStatsFunctions(size_t globalBufferBytes, size_t peakIntermediateBytes, const std::map<const Node*, size_t>& nodeBufferBytes)
+    {
+        if (!_profilingEnabled)
+        {
+            return;
+        }
+
+        assert(_module != nullptr);
+        assert(_model != nullptr);
+
+        auto& context = _module->GetLLVMContext();
+        auto int64Type = llvm::Type::getInt64Ty(context);
+
+        emitters::NamedLLVMTypeList statsFields = { { "globalBufferBytes", int64Type }, { "peakIntermediateBytes", int64Type }, { "peakStackScratchBytes", int64Type } };
+        _memoryStatsType = _module->GetOrCreateStruct(GetNamespacePrefix() + "_ModelMemoryStats", statsFields);
+        _module->IncludeTypeInHeader(_memoryStatsType->getName());
+        _memoryStatsArray = _module->GlobalArray(GetNamespacePrefix() + "_ModelMemoryStatsArray", _memoryStatsType, 1);
+
+        EmitGetMemoryStatsFunction(globalBufferBytes, peakIntermediateBytes);
+        EmitGetNodeMemoryUsageFunction(nodeBufferBytes);
+    }
+
+    void ModelProfiler::EmitGetMemoryStatsFunction(size_t globalBufferBytes, size_t peakIntermediateBytes)
+    {
+        auto& emitter = _module->GetIREmitter();
+        auto& irBuilder = emitter.GetIRBuilder();
+
+        auto function = _module->BeginFunction(GetNamespacePrefix() + "_GetMemoryStats", _memoryStatsType->getPointerTo());
+        function.IncludeInHeader();
+
+        // The values are compile-time constants, so the emitted function just fills in the struct and returns it
+        auto statsPtr = irBuilder.CreateInBoundsGEP(_memoryStatsArray, { function.Literal(0), function.Literal(0) });
+        auto globalBufferPtr = irBuilder.CreateInBoundsGEP(_memoryStatsType, statsPtr, { function.Literal(0), function.Literal(0) });
+        auto peakIntermediatePtr = irBuilder.CreateInBoundsGEP(_memoryStatsType, statsPtr, { function.Literal(0), function.Literal(1) });
+        auto peakScratchPtr = irBuilder.CreateInBoundsGEP(_memoryStatsType, statsPtr, { function.Literal(0), function.Literal(2) });
+
+        function.Store(globalBufferPtr, function.Literal<int64_t>(static_cast<int64_t>(globalBufferBytes)));
+        function.Store(peakIntermediatePtr, function.Literal<int64_t>(static_cast<int64_t>(peakIntermediateBytes)));
+        function.Store(peakScratchPtr, function.Literal<int64_t>(GetPeakStackScratchBytes()));
+        function.Return(statsPtr);
+        _module->EndFunction();
+    }
+
+    // TODO: return 0 if out of bounds (this is device-side code, and we may not be able to throw exceptions)
+    void ModelProfiler::EmitGetNodeMemoryUsageFunction(const std::map<const Node*, size_t>& nodeBufferBytes)
+    {
+        auto& emitter = _module->GetIREmitter();
+        auto& irBuilder = emitter.GetIRBuilder();
+        auto& context = _module->GetLLVMContext();
+        auto int64Type = llvm::Type::getInt64Ty(context);
+
+        // Build the per-node table in node-index order (the same order `GetNodeInfo` uses)
+        std::vector<int64_t> bufferBytes(_nodePerformanceCounters.size(), 0);
+        for (const auto& entry : _nodeIndices)
+        {
+            auto it = nodeBufferBytes.find(entry.first);
+            if (it != nodeBufferBytes.end())
+            {
+                bufferBytes[entry.second] = static_cast<int64_t>(it->second);
+            }
+        }
+        _nodeMemoryUsageArray = _module->GlobalArray(GetNamespacePrefix() + "_NodeMemoryUsageArray", bufferBytes);
+
+        const emitters::NamedVariableTypeList parameters = { { "nodeIndex", emitters::VariableType::Int32 } };
+        auto function = _module->BeginFunction(GetNamespacePrefix() + "_GetNodeMemoryUsage", int64Type, parameters);
+        function.IncludeInHeader();
+
+        auto args = function.Arguments();
+        auto nodeIndex = &(*args.begin());
+        auto bytesPtr = irBuilder.CreateInBoundsGEP(_nodeMemoryUsageArray, { function.Literal(0), nodeIndex });
+        function.Return(function.Load(bytesPtr));
+        _module->EndFunction();
+    }
+
+    int64_t ModelProfiler::GetPeakStackScratchBytes() const
+    {
+        auto llvmModule = _module->GetLLVMModule();
+        const auto& dataLayout = llvmModule->getDataLayout();
+
+        // The emitted code allocates all of its scratch memory in static allocas, so the largest
+        // static stack frame among the module's functions is a good proxy for peak scratch usage
+        int64_t peakBytes = 0;
+        for (auto& function : *llvmModule)
+        {
+            int64_t functionBytes = 0;
+            for (auto& block : function)
+            {
+                for (auto& instruction : block)
+                {
+                    if (auto allocaInst = llvm::dyn_cast<llvm::AllocaInst>(&instruction))
+                    {
+                        auto sizeInBits = allocaInst->getAllocationSizeInBits(dataLayout);
+                        if (sizeInBits.hasValue())
+                        {
+                            functionBytes += static_cast<int64_t>(sizeInBits.getValue() / 8);
+                        }
+                    }
+                }
+            }
+            peakBytes = std::max(peakBytes, functionBytes);
+        }
+        return peakBytes;
+    }
+
     NodePerformanceEmitter& ModelProfiler::GetPerformanceCountersForNode(const Node& node)
     {
         assert(_profilingEnabled);
@@ -561,6 +736,7 @@ namespace model
 
             NodePerformanceEmitter performanceCounters(*_module, &node, nodeInfoPtr, nodePerformanceCountersPtr, _nodeInfoType, _performanceCountersType);
             _nodePerformanceCounters[&node] = performanceCounters;
+            _nodeIndices[&node] = nodeIndex;
         }
 
         return _nodePerformanceCounters[&node];
@@ -11,7 +11,9 @@
 #include "OptimizeModelTransformation.h"
 #include "OutputNode.h"
 #include "RefineTransformation.h"
+#include "Submodel.h"
 
+#include <utilities/include/BinaryArchiver.h>
 #include <utilities/include/Exception.h>
 #include <utilities/include/StlVectorUtil.h>
 
@@ -196,6 +198,37 @@ namespace model
         return ComputeDoubleOutput(elements);
     }
 
+    void Map::SetInputBuffer(int index, const void* input)
+    {
+        if (index < 0 || static_cast<size_t>(index) >= NumInputs())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "input index out of range");
+        }
+        _borrowedInputs.resize(NumInputs(), nullptr);
+        _borrowedInputs[index] = input;
+    }
+
+    void Map::ComputeInto(void* output)
+    {
+        if (_borrowedInputs.size() < NumInputs())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "SetInputBuffer must be called for each input before calling ComputeInto");
+        }
+
+        // The interpreted path copies through the input nodes and output ports, so we can reuse
+        // the ComputeMultiple plumbing. Compiled maps override this with a zero-copy call.
+        std::vector<void*> inputs;
+        for (auto input : _borrowedInputs)
+        {
+            if (input == nullptr)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "SetInputBuffer must be called for each input before calling ComputeInto");
+            }
+            inputs.push_back(const_cast<void*>(input)); // ComputeMultiple only reads the input buffers
+        }
+        ComputeMultiple(inputs, { output });
+    }
+
     void Map::ComputeMultiple(const std::vector<void*>& inputs, const std::vector<void*>& outputs)
     {
         ContextGuard<> guard(_computeContext);
@@ -297,6 +330,111 @@ namespace model
         _model.Reset();
     }
 
+    uint64_t Map::ComputeHash() const
+    {
+        return utilities::HashArchivedObject(*this);
+    }
+
+    namespace
+    {
+        size_t GetPortTypeSize(Port::PortType type)
+        {
+            switch (type)
+            {
+            case Port::PortType::boolean:
+                return sizeof(bool);
+            case Port::PortType::integer:
+                return sizeof(int);
+            case Port::PortType::bigInt:
+                return sizeof(int64_t);
+            case Port::PortType::smallReal:
+                return sizeof(float);
+            case Port::PortType::real:
+                return sizeof(double);
+            default:
+                throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch);
+            }
+        }
+
+        // gets a node's runtime type name with any template arguments stripped off
+        // (e.g. "ConstantNode<float>" becomes "ConstantNode")
+        std::string GetUnqualifiedNodeTypeName(const Node& node)
+        {
+            auto name = node.GetRuntimeTypeName();
+            return name.substr(0, name.find('<'));
+        }
+
+        // estimates the number of multiply-accumulates a node performs from its port sizes
+        size_t EstimateMultiplyAccumulates(const Node& node)
+        {
+            const auto& inputs = node.GetInputPorts();
+            const auto& outputs = node.GetOutputPorts();
+            if (inputs.empty() || outputs.empty())
+            {
+                return 0;
+            }
+
+            auto typeName = GetUnqualifiedNodeTypeName(node);
+            if (typeName == "MatrixMatrixMultiplyNode" && inputs.size() >= 2)
+            {
+                // A (M x K) times B (K x N): one multiply-accumulate per element of A for each of B's columns
+                auto rhsSize = inputs[1]->GetMemoryLayout().GetActiveSize();
+                auto numColumns = static_cast<size_t>(rhsSize[rhsSize.NumDimensions() - 1]);
+                return inputs[0]->Size() * numColumns;
+            }
+            else if (typeName == "MatrixVectorMultiplyNode" || typeName == "MatrixVectorProductNode")
+            {
+                // one multiply-accumulate per matrix element
+                return inputs[0]->Size();
+            }
+            else if (typeName == "FullyConnectedLayerNode")
+            {
+                return inputs[0]->Size() * outputs[0]->Size();
+            }
+            else if (typeName == "DotProductNode")
+            {
+                return inputs[0]->Size();
+            }
+            return 0;
+        }
+    } // namespace
+
+    double MapMemoryFootprint::GetArithmeticIntensity() const
+    {
+        auto totalBytes = weightBytes + totalActivationBytes;
+        return totalBytes == 0 ? 0.0 : static_cast<double>(multiplyAccumulates) / totalBytes;
+    }
+
+    MapMemoryFootprint Map::ComputeMemoryFootprint(const Model& model)
+    {
+        MapMemoryFootprint footprint;
+        model.Visit([&footprint](const Node& node) {
+            size_t inputBytes = 0;
+            for (auto input : node.GetInputPorts())
+            {
+                inputBytes += input->Size() * GetPortTypeSize(input->GetType());
+            }
+
+            size_t outputBytes = 0;
+            for (auto output : node.GetOutputPorts())
+            {
+                outputBytes += output->Size() * GetPortTypeSize(output->GetType());
+            }
+
+            if (GetUnqualifiedNodeTypeName(node) == "ConstantNode")
+            {
+                footprint.weightBytes += outputBytes;
+            }
+            else
+            {
+                footprint.totalActivationBytes += outputBytes;
+                footprint.peakActivationBytes = std::max(footprint.peakActivationBytes, inputBytes + outputBytes);
+            }
+            footprint.multiplyAccumulates += EstimateMultiplyAccumulates(node);
+        });
+        return footprint;
+    }
+
     void Map::AddInput(const std::string& inputName, InputNodeBase* inputNode)
     {
         _inputNodes.push_back(inputNode);
@@ -801,6 +939,79 @@ namespace model
         return _outputNames[index];
     }
 
+    //
+    // ChainMaps
+    //
+    Map ChainMaps(const Map& first, const Map& second)
+    {
+        if (second.NumInputs() != first.NumOutputs())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Error: the second map must have one input for each of the first map's outputs");
+        }
+        for (size_t index = 0; index < second.NumInputs(); ++index)
+        {
+            const auto& secondInputPort = second.GetInput(index)->GetOutputPort();
+            const auto& firstOutputPort = first.GetOutput(index);
+            if (secondInputPort.GetType() != firstOutputPort.GetType() || secondInputPort.Size() != firstOutputPort.Size())
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::typeMismatch, "Error: the first map's outputs and the second map's inputs don't correspond in type and size");
+            }
+        }
+
+        TransformContext context;
+        ModelTransformer transformer;
+        auto newModel = transformer.CopyModel(first.GetModel(), context);
+
+        // Remember the copied versions of the first map's inputs and outputs before the
+        // transformer's correspondence tables are reused for the second copy
+        std::vector<std::pair<std::string, InputNodeBase*>> newInputs;
+        for (size_t index = 0; index < first.NumInputs(); ++index)
+        {
+            newInputs.emplace_back(first.GetInputName(index), transformer.GetCorrespondingInputNode(first.GetInput(index)));
+        }
+        std::vector<const OutputPortBase*> newFirstOutputs;
+        for (size_t index = 0; index < first.NumOutputs(); ++index)
+        {
+            newFirstOutputs.push_back(&transformer.GetCorrespondingOutputs(first.GetOutput(index)));
+        }
+
+        // The second map's submodel hangs off its input nodes: its free inputs are the ports that
+        // read those input nodes, each grafted onto the copied first-map output it corresponds to
+        std::vector<const InputPortBase*> secondInputs;
+        std::vector<const OutputPortBase*> onto;
+        second.GetModel().Visit([&](const Node& node) {
+            for (auto inputPort : node.GetInputPorts())
+            {
+                auto referencedPort = &inputPort->GetReferencedPort();
+                for (size_t index = 0; index < second.NumInputs(); ++index)
+                {
+                    if (referencedPort == &second.GetInput(index)->GetOutputPort())
+                    {
+                        secondInputs.push_back(inputPort);
+                        onto.push_back(newFirstOutputs[index]);
+                    }
+                }
+            }
+        });
+
+        std::vector<const OutputPortBase*> secondOutputs;
+        for (size_t index = 0; index < second.NumOutputs(); ++index)
+        {
+            secondOutputs.push_back(&second.GetOutput(index));
+        }
+
+        Submodel secondSubmodel(secondInputs, secondOutputs);
+        auto newSubmodel = transformer.CopySubmodelOnto(secondSubmodel, newModel, onto, context);
+
+        std::vector<std::pair<std::string, const OutputPortBase&>> newOutputs;
+        for (size_t index = 0; index < second.NumOutputs(); ++index)
+        {
+            newOutputs.emplace_back(second.GetOutputName(index), *newSubmodel.GetOutputs()[index]);
+        }
+
+        return Map(newModel, newInputs, newOutputs);
+    }
+
     //
     // MapSerializationContext
     //
@@ -18,12 +18,167 @@
 #include <utilities/include/Logger.h>
 #include <utilities/include/PropertyBag.h>
 
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
 namespace ell
 {
 namespace model
 {
     using namespace logging;
 
+    namespace
+    {
+        size_t GetVariableTypeSize(emitters::VariableType type)
+        {
+            switch (type)
+            {
+            case emitters::VariableType::Boolean:
+            case emitters::VariableType::Char8:
+            case emitters::VariableType::Byte:
+                return 1;
+            case emitters::VariableType::Int16:
+            case emitters::VariableType::Float16:
+                return 2;
+            case emitters::VariableType::Int32:
+            case emitters::VariableType::Float:
+                return 4;
+            case emitters::VariableType::Int64:
+            case emitters::VariableType::Double:
+            default:
+                return 8;
+            }
+        }
+
+        size_t GetPortBytes(const OutputPortBase& port)
+        {
+            return GetVariableTypeSize(PortTypeToVariableType(port.GetType())) * port.Size();
+        }
+
+        // Chooses a topological compile order that keeps peak live intermediate memory low.
+        // Greedy list scheduling: repeatedly pick the ready node with the best net effect on
+        // liveness -- the one that frees the most input bytes relative to the output bytes it
+        // allocates. Ties are broken by the original (dependency-preserving) order, so the
+        // schedule is deterministic and unaffected parts of the model keep their order.
+        std::vector<const Node*> ScheduleForMinimumLiveness(const std::vector<const Node*>& nodes)
+        {
+            auto getOutputBytes = [](const Node* node) {
+                size_t bytes = 0;
+                for (const auto* outputPort : node->GetOutputPorts())
+                {
+                    bytes += GetPortBytes(*outputPort);
+                }
+                return bytes;
+            };
+
+            std::unordered_map<const Node*, size_t> originalIndex;
+            std::unordered_map<const Node*, int> numPendingInputs;
+            std::unordered_map<const OutputPortBase*, int> numPendingConsumers;
+            for (size_t index = 0; index < nodes.size(); ++index)
+            {
+                const auto* node = nodes[index];
+                originalIndex[node] = index;
+                numPendingInputs[node] = static_cast<int>(node->GetInputPorts().size());
+                for (const auto* inputPort : node->GetInputPorts())
+                {
+                    ++numPendingConsumers[&inputPort->GetReferencedPort()];
+                }
+            }
+
+            std::vector<const Node*> ready;
+            for (const auto* node : nodes)
+            {
+                if (numPendingInputs[node] == 0)
+                {
+                    ready.push_back(node);
+                }
+            }
+
+            // The bytes that stop being needed once the given node has been compiled: the sizes
+            // of the input buffers for which this node is the only remaining consumer
+            auto getFreedBytes = [&numPendingConsumers](const Node* node) {
+                std::unordered_map<const OutputPortBase*, int> referenceCounts;
+                for (const auto* inputPort : node->GetInputPorts())
+                {
+                    ++referenceCounts[&inputPort->GetReferencedPort()];
+                }
+                size_t freed = 0;
+                for (const auto& reference : referenceCounts)
+                {
+                    if (numPendingConsumers[reference.first] == reference.second)
+                    {
+                        freed += GetPortBytes(*reference.first);
+                    }
+                }
+                return freed;
+            };
+
+            std::vector<const Node*> schedule;
+            schedule.reserve(nodes.size());
+            size_t liveBytes = 0;
+            size_t peakBytes = 0;
+            while (!ready.empty())
+            {
+                size_t bestPosition = 0;
+                auto bestDelta = std::numeric_limits<std::ptrdiff_t>::max();
+                for (size_t position = 0; position < ready.size(); ++position)
+                {
+                    const auto* candidate = ready[position];
+                    auto delta = static_cast<std::ptrdiff_t>(getOutputBytes(candidate)) - static_cast<std::ptrdiff_t>(getFreedBytes(candidate));
+                    if (delta < bestDelta || (delta == bestDelta && originalIndex[candidate] < originalIndex[ready[bestPosition]]))
+                    {
+                        bestDelta = delta;
+                        bestPosition = position;
+                    }
+                }
+
+                const auto* node = ready[bestPosition];
+                ready.erase(ready.begin() + bestPosition);
+                schedule.push_back(node);
+
+                // The node's outputs go live before its inputs can die, so count the peak in between
+                liveBytes += getOutputBytes(node);
+                peakBytes = std::max(peakBytes, liveBytes);
+                for (const auto* inputPort : node->GetInputPorts())
+                {
+                    const auto* referencedPort = &inputPort->GetReferencedPort();
+                    if (--numPendingConsumers[referencedPort] == 0)
+                    {
+                        liveBytes -= GetPortBytes(*referencedPort);
+                    }
+                }
+
+                for (const auto* outputPort : node->GetOutputPorts())
+                {
+                    for (const auto* consumerPort : outputPort->GetReferences())
+                    {
+                        if (--numPendingInputs[consumerPort->GetNode()] == 0)
+                        {
+                            ready.push_back(consumerPort->GetNode());
+                        }
+                    }
+                }
+            }
+
+            if (schedule.size() != nodes.size())
+            {
+                // shouldn't happen on a well-formed model, but fall back to the original order
+                return nodes;
+            }
+
+            Log() << "Memory-aware schedule peak live intermediate bytes: " << peakBytes << EOL;
+            return schedule;
+        }
+    } // namespace
+
+    namespace
+    {
+        // interned once; these lookups run per node per pass
+        const utilities::PropertyBagKey compileOptionsKey("compileOptions");
+    } // namespace
+
     MapCompiler::MapCompiler(const MapCompilerOptions& settings, const ModelOptimizerOptions& optimizerOptions) :
         _parameters(settings),
         _optimizerOptions(optimizerOptions)
@@ -39,9 +194,9 @@ namespace model
     MapCompilerOptions MapCompiler::GetMapCompilerOptions(const Model& model) const
     {
         auto result = GetMapCompilerOptions();
-        if (model.GetMetadata().HasEntry("compileOptions"))
+        if (auto options = model.GetMetadata().TryGetEntry<utilities::PropertyBag>(compileOptionsKey))
         {
-            return result.AppendOptions(model.GetMetadata().GetEntry<utilities::PropertyBag>("compileOptions"));
+            return result.AppendOptions(*options);
         }
         return result;
     }
@@ -49,9 +204,9 @@ namespace model
     MapCompilerOptions MapCompiler::GetMapCompilerOptions(const Node& node) const
     {
         auto result = GetMapCompilerOptions(*node.GetModel());
-        if (node.GetMetadata().HasEntry("compileOptions"))
+        if (auto options = node.GetMetadata().TryGetEntry<utilities::PropertyBag>(compileOptionsKey))
         {
-            return result.AppendOptions(node.GetMetadata().GetEntry<utilities::PropertyBag>("compileOptions"));
+            return result.AppendOptions(*options);
         }
         return result;
     }
@@ -64,10 +219,9 @@ namespace model
     ModelOptimizerOptions MapCompiler::GetModelOptimizerOptions(const Model& model) const
     {
         ModelOptimizerOptions options = GetModelOptimizerOptions();
-        if (model.GetMetadata().HasEntry("compileOptions"))
+        if (auto optionsMetadata = model.GetMetadata().TryGetEntry<utilities::PropertyBag>(compileOptionsKey))
         {
-            auto optionsMetadata = model.GetMetadata().GetEntry<utilities::PropertyBag>("compileOptions");
-            AppendMetadataToOptions(optionsMetadata, options);
+            AppendMetadataToOptions(*optionsMetadata, options);
         }
         return options;
     }
@@ -75,14 +229,23 @@ namespace model
     ModelOptimizerOptions MapCompiler::GetModelOptimizerOptions(const Node& node) const
     {
         ModelOptimizerOptions options = GetModelOptimizerOptions(*node.GetModel());
-        if (node.GetMetadata().HasEntry("compileOptions"))
+        auto perNodeOptions = _nodeOptimizerOptions.find(to_string(node.GetId()));
+        if (perNodeOptions != _nodeOptimizerOptions.end())
+        {
+            AppendMetadataToOptions(perNodeOptions->second.AsPropertyBag(), options);
+        }
+        if (auto optionsMetadata = node.GetMetadata().TryGetEntry<utilities::PropertyBag>(compileOptionsKey))
         {
-            auto optionsMetadata = node.GetMetadata().GetEntry<utilities::PropertyBag>("compileOptions");
-            AppendMetadataToOptions(optionsMetadata, options);
+            AppendMetadataToOptions(*optionsMetadata, options);
         }
         return options;
     }
 
+    void MapCompiler::SetNodeOptimizerOptions(const std::string& nodeId, const ModelOptimizerOptions& options)
+    {
+        _nodeOptimizerOptions[nodeId] = options;
+    }
+
     void MapCompiler::CompileMap(Map& map, const std::string& functionName)
     {
         using namespace std::string_literals;
@@ -108,18 +271,71 @@ namespace model
 
         pModuleEmitter->GetFunctionDeclaration(functionName).GetComments() = comments;
 
+        _stackAllocateBufferThreshold = GetMapCompilerOptions(map.GetModel()).stackAllocateBufferThreshold;
+        _reuseBuffers = GetMapCompilerOptions(map.GetModel()).reuseIntermediateBuffers;
+        if (_reuseBuffers && GetMapCompilerOptions(map.GetModel()).parallelizeBranches)
+        {
+            // Buffer reuse assumes a node's input buffers are dead as soon as the node has been
+            // compiled, which doesn't hold when node functions run as concurrent tasks
+            Log() << "Disabling intermediate buffer reuse because parallelizeBranches is enabled" << EOL;
+            _reuseBuffers = false;
+        }
+        if (_reuseBuffers)
+        {
+            ComputePortLiveness(map.GetModel());
+        }
+
         OnBeginCompileModel(map.GetModel());
         CompileNodes(map.GetModel());
         OnEndCompileModel(map.GetModel());
 
+        if (_reuseBuffers)
+        {
+            Log() << "Planned peak intermediate buffer memory: " << _plannedPeakMemory << " bytes" << EOL;
+        }
+
         pModuleEmitter->EndMapPredictFunction();
         Log() << "Finished 'predict' function" << EOL;
     }
 
     void MapCompiler::CompileNodes(Model& model)
     {
+        std::vector<const Node*> nodesToCompile;
+        model.Visit([&nodesToCompile](const Node& node) {
+            nodesToCompile.push_back(&node);
+        });
+
+        if (GetMapCompilerOptions(model).parallelizeBranches)
+        {
+            // Order the nodes by their depth in the graph (preserving dependency order), so that
+            // independent branches interleave and their asynchronously-dispatched node functions
+            // get a chance to overlap
+            std::unordered_map<const Node*, int> nodeDepths;
+            for (const auto* node : nodesToCompile)
+            {
+                int depth = 0;
+                for (const auto* inputPort : node->GetInputPorts())
+                {
+                    depth = std::max(depth, nodeDepths[inputPort->GetReferencedPort().GetNode()] + 1);
+                }
+                nodeDepths[node] = depth;
+            }
+            std::stable_sort(nodesToCompile.begin(), nodesToCompile.end(), [&nodeDepths](const Node* a, const Node* b) {
+                return nodeDepths[a] < nodeDepths[b];
+            });
+        }
+        else if (GetMapCompilerOptions(model).minimizeMemoryNodeOrder)
+        {
+            // Choose the topological order that keeps peak live intermediate memory low -- the order
+            // the buffer-reuse planner then works with. Incompatible with parallelizeBranches, which
+            // deliberately interleaves independent branches and so widens liveness.
+            nodesToCompile = ScheduleForMinimumLiveness(nodesToCompile);
+        }
+
         std::unordered_set<const Node*> visitedNodes;
-        model.Visit([this, &visitedNodes](const Node& node) {
+        for (const auto* nodeToCompile : nodesToCompile)
+        {
+            const auto& node = *nodeToCompile;
             for (const auto* inputPort : node.GetInputPorts())
             {
                 const auto* dependent = inputPort->GetReferencedPort().GetNode();
@@ -142,24 +358,175 @@ namespace model
 
             visitedNodes.insert(&node);
             Log() << "Now compiling node " << DiagnosticString(node) << EOL;
+            TryAllocateInPlace(*compilableNode);
             OnBeginCompileNode(node);
             compilableNode->CompileNode(*this);
             OnEndCompileNode(node);
+            if (_reuseBuffers)
+            {
+                ReleaseCompletedPortVariables(node);
+            }
+        }
+    }
+
+    void MapCompiler::TryAllocateInPlace(const CompilableNode& node)
+    {
+        if (!node.CanOperateInPlace())
+        {
+            return;
+        }
+
+        const auto& inputPorts = node.GetInputPorts();
+        const auto& outputPorts = node.GetOutputPorts();
+        if (inputPorts.size() != 1 || outputPorts.size() != 1)
+        {
+            return;
+        }
+
+        const auto& outputPort = *outputPorts[0];
+        const auto& referencedPort = inputPorts[0]->GetReferencedPort();
+        if (outputPort.GetType() != referencedPort.GetType() || outputPort.Size() != referencedPort.Size())
+        {
+            return;
+        }
+
+        // The input buffer must die with this node: no other consumers may read it
+        if (referencedPort.GetReferences().size() != 1)
+        {
+            return;
+        }
+
+        // Only plain global buffers can be aliased -- function arguments and initialized
+        // variables must keep their own storage.
+        auto pVar = GetVariableForPort(referencedPort);
+        if (pVar == nullptr || pVar->Scope() != emitters::VariableScope::global || pVar->HasInitValue() || pVar->IsLiteral())
+        {
+            return;
+        }
+
+        if (GetVariableForPort(outputPort) != nullptr)
+        {
+            return;
+        }
+
+        Log() << "Node " << DiagnosticString(node) << " will compute its output in place" << EOL;
+        SetVariableForPort(outputPort, pVar);
+    }
+
+    void MapCompiler::ComputePortLiveness(const Model& model)
+    {
+        _portLastUse.clear();
+        model.Visit([this](const Node& node) {
+            for (const auto* inputPort : node.GetInputPorts())
+            {
+                _portLastUse[&inputPort->GetReferencedPort()] = &node;
+            }
         });
     }
 
+    void MapCompiler::ReleaseCompletedPortVariables(const Node& node)
+    {
+        for (const auto* inputPort : node.GetInputPorts())
+        {
+            const auto& referencedPort = inputPort->GetReferencedPort();
+            auto lastUse = _portLastUse.find(&referencedPort);
+            if (lastUse == _portLastUse.end() || lastUse->second != &node)
+            {
+                continue;
+            }
+            _portLastUse.erase(lastUse); // so a port consumed twice by the same node is only released once
+
+            // Only plain global buffers can be recycled -- function arguments and initialized
+            // variables have meaning beyond the lifetime of the port's consumers.
+            auto pVar = GetVariableForPort(referencedPort);
+            if (pVar == nullptr || pVar->Scope() != emitters::VariableScope::global || pVar->HasInitValue() || pVar->IsLiteral())
+            {
+                continue;
+            }
+
+            // If the node computed its output in place, its input's buffer is still live
+            bool aliasedToOutput = false;
+            for (const auto* outputPort : node.GetOutputPorts())
+            {
+                if (GetVariableForPort(*outputPort) == pVar)
+                {
+                    aliasedToOutput = true;
+                    break;
+                }
+            }
+            if (!aliasedToOutput)
+            {
+                _freeVariablePool.push_back(pVar);
+                _currentPlannedMemory -= GetVariableTypeSize(pVar->Type()) * pVar->Dimension();
+            }
+        }
+    }
+
     emitters::Variable* MapCompiler::AllocatePortVariable(const OutputPortBase& port)
     {
         auto pModuleEmitter = GetModuleEmitter();
         assert(port.Size() != 0);
 
         emitters::VariableType varType = PortTypeToVariableType(port.GetType());
-        auto pVar = pModuleEmitter->Variables().AddVectorVariable(emitters::VariableScope::global, varType, port.Size());
+
+        // Small intermediates become allocas in the predict function instead of module globals,
+        // so LLVM can promote them to SSA values; their lifetime is the predict call, so they
+        // never go through the reuse pool
+        bool stackAllocate = _stackAllocateBufferThreshold > 0 && port.Size() <= static_cast<size_t>(_stackAllocateBufferThreshold);
+        if (_reuseBuffers && !stackAllocate)
+        {
+            // Look for a dead buffer we can reuse: the smallest one of the right type that's big enough
+            auto bestMatch = _freeVariablePool.end();
+            for (auto it = _freeVariablePool.begin(); it != _freeVariablePool.end(); ++it)
+            {
+                if ((*it)->Type() == varType && (*it)->Dimension() >= port.Size() &&
+                    (bestMatch == _freeVariablePool.end() || (*it)->Dimension() < (*bestMatch)->Dimension()))
+                {
+                    bestMatch = it;
+                }
+            }
+            if (bestMatch != _freeVariablePool.end())
+            {
+                auto pReused = *bestMatch;
+                _freeVariablePool.erase(bestMatch);
+                _currentPlannedMemory += GetVariableTypeSize(pReused->Type()) * pReused->Dimension();
+                if (_currentPlannedMemory > _plannedPeakMemory)
+                {
+                    _plannedPeakMemory = _currentPlannedMemory;
+                }
+                Log() << "Reusing buffer of size " << pReused->Dimension() << " for port " << port.GetName() << EOL;
+                SetVariableForPort(port, pReused);
+                return pReused;
+            }
+        }
+
+        auto scope = stackAllocate ? emitters::VariableScope::local : emitters::VariableScope::global;
+        if (stackAllocate)
+        {
+            Log() << "Stack-allocating buffer of size " << port.Size() << " for port " << port.GetName() << EOL;
+        }
+        auto pVar = pModuleEmitter->Variables().AddVectorVariable(scope, varType, port.Size());
         pModuleEmitter->AllocateVariable(*pVar);
+        RecordBufferAllocation(port, varType);
+        if (_reuseBuffers && !stackAllocate)
+        {
+            _currentPlannedMemory += GetVariableTypeSize(varType) * port.Size();
+            if (_currentPlannedMemory > _plannedPeakMemory)
+            {
+                _plannedPeakMemory = _currentPlannedMemory;
+            }
+        }
         SetVariableForPort(port, pVar);
         return pVar;
     }
 
+    void MapCompiler::RecordBufferAllocation(const OutputPortBase& port, emitters::VariableType varType)
+    {
+        auto bufferBytes = GetVariableTypeSize(varType) * port.Size();
+        _totalBufferMemory += bufferBytes;
+        _nodeBufferMemory[port.GetNode()] += bufferBytes;
+    }
+
     emitters::Variable* MapCompiler::GetOrAllocatePortVariable(const OutputPortBase& port)
     {
         emitters::Variable* pVar = GetVariableForPort(port);
@@ -33,7 +33,16 @@ namespace model
         sinkFunctionName = properties.GetOrParseEntry("sinkFunctionName", sinkFunctionName);
         verifyJittedModule = properties.GetOrParseEntry("verifyJittedModule", verifyJittedModule);
         profile = properties.GetOrParseEntry("profile", profile);
+        reuseIntermediateBuffers = properties.GetOrParseEntry("reuseIntermediateBuffers", reuseIntermediateBuffers);
+        parallelizeBranches = properties.GetOrParseEntry("parallelizeBranches", parallelizeBranches);
+        minimizeMemoryNodeOrder = properties.GetOrParseEntry("minimizeMemoryNodeOrder", minimizeMemoryNodeOrder);
+        stackAllocateBufferThreshold = properties.GetOrParseEntry("stackAllocateBufferThreshold", stackAllocateBufferThreshold);
         inlineNodes = properties.GetOrParseEntry("inlineNodes", inlineNodes);
+        parallelizeCostThreshold = properties.GetOrParseEntry("parallelizeCostThreshold", parallelizeCostThreshold);
+
+        // Also let the properties override the lower-level emitters settings, so nodes can adjust options
+        // such as "useFastMath" through their metadata
+        compilerSettings = compilerSettings.AppendOptions(properties);
     }
 } // namespace model
 } // namespace ell
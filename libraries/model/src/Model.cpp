@@ -15,6 +15,7 @@
 #include "SliceNode.h"
 #include "SpliceNode.h"
 
+#include <utilities/include/BinaryArchiver.h>
 #include <utilities/include/Logger.h>
 #include <utilities/include/StringUtil.h>
 
@@ -304,15 +305,59 @@ namespace model
         Visit(reset);
     }
 
+    uint64_t Model::ComputeHash() const
+    {
+        return utilities::HashArchivedObject(*this);
+    }
+
     Node* Model::AddExistingNode(std::unique_ptr<Node> node)
     {
-        std::shared_ptr<Node> sharedNode(std::move(node));
-        EnsureNodeHasUniqueId(*sharedNode);
-        sharedNode->SetModel(this);
-        sharedNode->UpdateInputPorts();
-        VerifyInputs(*sharedNode);
-        _data->idToNodeMap[sharedNode->GetId()] = sharedNode;
-        return sharedNode.get();
+        return RegisterNode(std::shared_ptr<Node>(std::move(node)));
+    }
+
+    Node* Model::AddArenaNode(Node* node)
+    {
+        // The node lives in the model's arena, so the deleter only runs the destructor --- the
+        // storage itself is released when the arena is destroyed.
+        return RegisterNode(std::shared_ptr<Node>(node, [](Node* n) { n->~Node(); }));
+    }
+
+    Node* Model::RegisterNode(std::shared_ptr<Node> node)
+    {
+        EnsureNodeHasUniqueId(*node);
+        node->SetModel(this);
+        node->UpdateInputPorts();
+        VerifyInputs(*node);
+        _data->idToNodeMap[node->GetId()] = node;
+        if (_data->visitOrderValid)
+        {
+            // the new node can only consume outputs that already exist, so appending it keeps the cached order topological
+            _data->visitOrder.push_back(node.get());
+        }
+        return node.get();
+    }
+
+    const std::vector<const Node*>& Model::GetVisitOrder() const
+    {
+        if (!_data->visitOrderValid)
+        {
+            _data->visitOrder.clear();
+            _data->visitOrder.reserve(_data->idToNodeMap.size());
+            auto iter = GetNodeIterator();
+            while (iter.IsValid())
+            {
+                _data->visitOrder.push_back(iter.Get());
+                iter.Next();
+            }
+            _data->visitOrderValid = true;
+        }
+        return _data->visitOrder;
+    }
+
+    void Model::InvalidateVisitOrder() const
+    {
+        _data->visitOrderValid = false;
+        _data->visitOrder.clear();
     }
 
     void Model::EnsureNodeHasUniqueId(Node& node)
@@ -7,6 +7,8 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "ModelEditor.h"
+#include "Model.h"
+#include "Node.h"
 
 namespace ell
 {
@@ -15,6 +17,12 @@ namespace model
 
     void ModelEditor::ResetInputPort(const InputPortBase* port, const OutputPortBase& newInput)
     {
+        // rewiring an existing edge can change the dependency order, so drop the model's cached order
+        if (auto model = port->GetNode()->GetModel())
+        {
+            model->InvalidateVisitOrder();
+        }
+
         // Luckily nothing is ever really const in the codebase. If that changes, this is UB
         const_cast<InputPortBase*>(port)->SetReferencedPort(&newInput);
     }
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ModelEnsemble.cpp (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ModelEnsemble.h"
+
+#include <utilities/include/Exception.h>
+
+#include <cstring>
+
+namespace ell
+{
+namespace model
+{
+    namespace
+    {
+        size_t GetPortTypeSize(Port::PortType type)
+        {
+            switch (type)
+            {
+            case Port::PortType::smallReal:
+                return sizeof(float);
+            case Port::PortType::real:
+                return sizeof(double);
+            case Port::PortType::integer:
+                return sizeof(int);
+            case Port::PortType::bigInt:
+                return sizeof(int64_t);
+            case Port::PortType::boolean:
+                return sizeof(bool);
+            default:
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Error: unsupported port type");
+            }
+        }
+    } // namespace
+
+    ModelEnsemble::ModelEnsemble(int numThreads)
+    {
+        if (numThreads < 1)
+        {
+            numThreads = 1;
+        }
+        _workers.reserve(numThreads);
+        for (int i = 0; i < numThreads; ++i)
+        {
+            _workers.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ModelEnsemble::~ModelEnsemble()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_queueMutex);
+            _done = true;
+        }
+        _wakeup.notify_all();
+        for (auto& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    void ModelEnsemble::AddModel(const std::string& name, std::shared_ptr<IRCompiledMap> map, int priority)
+    {
+        if (map == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::nullReference, "Error: map must not be null");
+        }
+
+        std::lock_guard<std::mutex> lock(_queueMutex);
+        if (_models.find(name) != _models.end())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Error: a model named '" + name + "' was already added");
+        }
+
+        auto& entry = _models[name];
+        entry.map = map;
+        entry.priority = priority;
+        entry.context = std::make_unique<IRCompiledMap::ExecutionContext>(map->CreateContext());
+        entry.inputByteSize = map->GetInputSize(0) * GetPortTypeSize(map->GetInput(0)->GetOutputPort().GetType());
+        entry.output.resize(map->GetOutputSize(0) * GetPortTypeSize(map->GetOutput(0).GetType()));
+    }
+
+    void ModelEnsemble::SubmitAsync(const std::string& name, const void* input, InvocationCallback callback)
+    {
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        auto iterator = _models.find(name);
+        if (iterator == _models.end())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Error: no model named '" + name + "' in the ensemble");
+        }
+
+        auto& entry = iterator->second;
+        Invocation invocation{ &entry, std::vector<char>(entry.inputByteSize), std::move(callback) };
+        std::memcpy(invocation.input.data(), input, entry.inputByteSize);
+        _pending.emplace(std::make_pair(entry.priority, _nextSequence++), std::move(invocation));
+        ++_activeInvocations;
+        lock.unlock();
+        _wakeup.notify_one();
+    }
+
+    void ModelEnsemble::WaitForPendingInvocations()
+    {
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        _drained.wait(lock, [this] { return _activeInvocations == 0; });
+    }
+
+    void ModelEnsemble::WorkerLoop()
+    {
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        for (;;)
+        {
+            _wakeup.wait(lock, [this] { return _done || !_pending.empty(); });
+            if (_pending.empty())
+            {
+                return; // done flag set and queue drained
+            }
+
+            auto node = _pending.extract(_pending.begin());
+            auto& invocation = node.mapped();
+            auto entry = invocation.entry;
+            lock.unlock();
+
+            {
+                // Serialize invocations of the same model: the map's state (and, with the shared
+                // runtime, the task queue the emitted modules share) supports one compute at a time
+                std::lock_guard<std::mutex> computeLock(entry->computeMutex);
+                entry->context->Compute(invocation.input.data(), entry->output.data());
+                if (invocation.callback)
+                {
+                    invocation.callback(entry->output.data());
+                }
+            }
+
+            lock.lock();
+            if (--_activeInvocations == 0)
+            {
+                _drained.notify_all();
+            }
+        }
+    }
+} // namespace model
+} // namespace ell
@@ -15,6 +15,7 @@
 #include <utilities/include/Exception.h>
 #include <utilities/include/StringUtil.h>
 #include <utilities/include/Logger.h>
+#include <utilities/include/PropertyBag.h>
 
 #include <algorithm>
 
@@ -604,23 +605,24 @@ namespace model
 
     void ModelTransformer::AssignNodeAncestor(const Node& ancestorNode)
     {
+        static const utilities::PropertyBagKey ancestorKey("ancestor");
         auto iter = _model.GetReverseNodeIterator();
         while (iter.IsValid())
         {
             auto node = const_cast<Node*>(iter.Get());
-            if (node->GetMetadata().HasEntry("ancestor"))
+            if (node->GetMetadata().HasEntry(ancestorKey))
             {
                 break;
             }
             else
             {
-                if (ancestorNode.GetMetadata().HasEntry("ancestor"))
+                if (auto ancestor = ancestorNode.GetMetadata().TryGetEntry<std::string>(ancestorKey))
                 {
-                    node->GetMetadata().SetEntry("ancestor", ancestorNode.GetMetadata().GetEntry<std::string>("ancestor"));
+                    node->GetMetadata().SetEntry(ancestorKey, *ancestor);
                 }
                 else
                 {
-                    node->GetMetadata().SetEntry("ancestor", ancestorNode.GetId().ToString());
+                    node->GetMetadata().SetEntry(ancestorKey, ancestorNode.GetId().ToString());
                 }
             }
             iter.Next();
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "OptimizeModelTransformation.h"
+#include "ParallelTransformationPipeline.h"
 #include "TransformationRegistry.h"
 
 namespace ell
@@ -15,14 +16,12 @@ namespace model
 {
     Submodel OptimizeModelTransformation::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
     {
-        Submodel result = submodel;
-        const auto& registry = TransformationRegistry::GetGlobalRegistry();
-
-        for (const auto& transformation : registry)
+        ParallelTransformationPipeline pipeline;
+        for (const auto& transformation : TransformationRegistry::GetGlobalRegistry())
         {
-            result = transformation->Transform(result, transformer, context);
+            pipeline.AddTransformation(transformation.get());
         }
-        return result;
+        return pipeline.Transform(submodel, transformer, context);
     }
 } // namespace model
 } // namespace ell
@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ParallelTransformationPipeline.cpp (model)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ParallelTransformationPipeline.h"
+#include "InputPort.h"
+#include "Node.h"
+#include "OutputPort.h"
+
+#include <utilities/include/TaskPool.h>
+
+#include <future>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ell
+{
+namespace model
+{
+    namespace
+    {
+        // union-find over the submodel's nodes, with path compression
+        class NodeComponents
+        {
+        public:
+            void AddNode(const Node* node)
+            {
+                _parents.emplace(node, node);
+            }
+
+            bool ContainsNode(const Node* node) const
+            {
+                return _parents.find(node) != _parents.end();
+            }
+
+            const Node* FindRoot(const Node* node)
+            {
+                auto root = node;
+                while (_parents[root] != root)
+                {
+                    root = _parents[root];
+                }
+                while (_parents[node] != root)
+                {
+                    node = std::exchange(_parents[node], root);
+                }
+                return root;
+            }
+
+            void MergeComponents(const Node* a, const Node* b)
+            {
+                _parents[FindRoot(a)] = FindRoot(b);
+            }
+
+        private:
+            std::unordered_map<const Node*, const Node*> _parents;
+        };
+    } // namespace
+
+    ParallelTransformationPipeline::ParallelTransformationPipeline(std::vector<const Transformation*> transformations) :
+        _transformations(std::move(transformations))
+    {
+    }
+
+    void ParallelTransformationPipeline::AddTransformation(const Transformation* transformation)
+    {
+        _transformations.push_back(transformation);
+    }
+
+    std::vector<Submodel> ParallelTransformationPipeline::PartitionSubmodel(const Submodel& submodel)
+    {
+        std::vector<const Node*> nodes;
+        submodel.Visit([&nodes](const Node& node) { nodes.push_back(&node); });
+
+        NodeComponents components;
+        for (auto node : nodes)
+        {
+            components.AddNode(node);
+        }
+        for (auto node : nodes)
+        {
+            for (auto input : node->GetInputPorts())
+            {
+                for (auto parentNode : input->GetParentNodes())
+                {
+                    if (components.ContainsNode(parentNode))
+                    {
+                        components.MergeComponents(node, parentNode);
+                    }
+                }
+            }
+        }
+
+        // group the nodes by component, in visitation order
+        std::unordered_map<const Node*, size_t> componentIndices;
+        std::vector<std::vector<const Node*>> componentNodes;
+        for (auto node : nodes)
+        {
+            auto root = components.FindRoot(node);
+            auto iter = componentIndices.find(root);
+            if (iter == componentIndices.end())
+            {
+                iter = componentIndices.emplace(root, componentNodes.size()).first;
+                componentNodes.emplace_back();
+            }
+            componentNodes[iter->second].push_back(node);
+        }
+
+        if (componentNodes.size() < 2)
+        {
+            return { submodel };
+        }
+
+        std::vector<Submodel> result;
+        for (const auto& component : componentNodes)
+        {
+            std::vector<const InputPortBase*> inputs;
+            for (auto input : submodel.GetInputs())
+            {
+                if (components.FindRoot(input->GetNode()) == components.FindRoot(component[0]))
+                {
+                    inputs.push_back(input);
+                }
+            }
+
+            std::vector<const OutputPortBase*> outputs;
+            if (!submodel.GetOutputs().empty())
+            {
+                for (auto output : submodel.GetOutputs())
+                {
+                    if (components.FindRoot(output->GetNode()) == components.FindRoot(component[0]))
+                    {
+                        outputs.push_back(output);
+                    }
+                }
+            }
+            else // a whole-model submodel: the component's outputs are the ports nothing consumes
+            {
+                for (auto node : component)
+                {
+                    if (node->GetDependentNodes().empty())
+                    {
+                        for (auto output : node->GetOutputPorts())
+                        {
+                            outputs.push_back(output);
+                        }
+                    }
+                }
+            }
+            result.emplace_back(inputs, outputs);
+        }
+        return result;
+    }
+
+    Submodel ParallelTransformationPipeline::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        auto regions = PartitionSubmodel(submodel);
+        if (regions.size() < 2)
+        {
+            return TransformRegion(submodel, transformer, context);
+        }
+
+        // copy each region to a private model and run the pipeline over it on a worker thread
+        auto& pool = utilities::TaskPool::GetDefault();
+        std::vector<std::future<Submodel>> futures;
+        for (const auto& region : regions)
+        {
+            futures.push_back(pool.Submit([this, &region, &context]() {
+                ModelTransformer regionTransformer;
+                auto regionCopy = regionTransformer.CopySubmodel(region, context);
+                return TransformRegion(regionCopy, regionTransformer, context);
+            }));
+        }
+
+        // merge the transformed regions into a single model, and record the correspondence between
+        // each region's original boundary outputs and their merged counterparts in the caller's transformer
+        Model mergedModel;
+        mergedModel.GetMetadata() = submodel.GetModel().GetMetadata();
+        std::vector<const InputPortBase*> mergedInputs;
+        std::vector<const OutputPortBase*> mergedOutputs;
+        for (size_t index = 0; index < regions.size(); ++index)
+        {
+            auto transformedRegion = futures[index].get();
+            ModelTransformer mergeTransformer;
+            auto mergedRegion = mergeTransformer.CopySubmodelOnto(transformedRegion, mergedModel, {}, context);
+            mergedInputs.insert(mergedInputs.end(), mergedRegion.GetInputs().begin(), mergedRegion.GetInputs().end());
+            mergedOutputs.insert(mergedOutputs.end(), mergedRegion.GetOutputs().begin(), mergedRegion.GetOutputs().end());
+
+            const auto& originalOutputs = regions[index].GetOutputs();
+            const auto& newOutputs = mergedRegion.GetOutputs();
+            for (size_t outputIndex = 0; outputIndex < originalOutputs.size(); ++outputIndex)
+            {
+                transformer.MapNodeOutput(*originalOutputs[outputIndex], *newOutputs[outputIndex]);
+            }
+        }
+        return { mergedInputs, mergedOutputs };
+    }
+
+    Submodel ParallelTransformationPipeline::TransformRegion(const Submodel& region, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        Submodel result = region;
+        for (auto transformation : _transformations)
+        {
+            result = transformation->Transform(result, transformer, context);
+        }
+        return result;
+    }
+} // namespace model
+} // namespace ell
@@ -269,7 +269,7 @@ namespace model
         return { _index, _ranges[0].ReferencedPort()->GetDoubleOutput(_ranges[0].GetStartIndex()) };
     }
 
-    PortElementsBase::Iterator::Iterator(const std::vector<PortRange>& ranges) :
+    PortElementsBase::Iterator::Iterator(const utilities::SmallVector<PortRange, 1>& ranges) :
         _ranges(ranges.begin(), ranges.end())
     {
     }
@@ -417,7 +417,12 @@ namespace model
 
     PortElementsBase::PortElementsBase(const std::vector<PortRange>& ranges)
     {
-        _ranges.insert(_ranges.end(), ranges.begin(), ranges.end());
+        _ranges.reserve(ranges.size());
+        for (const auto& range : ranges)
+        {
+            _ranges.push_back(range);
+        }
+        _isCanonical = false; // the given ranges may contain adjacent entries
         ComputeSize();
     }
 
@@ -432,6 +437,7 @@ namespace model
     void PortElementsBase::Reset(const PortElementsBase& other)
     {
         _ranges = other._ranges;
+        _isCanonical = other._isCanonical;
         ComputeSize();
     }
 
@@ -513,28 +519,38 @@ namespace model
 
     void PortElementsBase::Consolidate()
     {
+        // Ranges built up through AddRange are merged as they're added, so there's usually nothing to do
+        if (_isCanonical)
+        {
+            return;
+        }
+
         if (_ranges.size() > 1)
         {
-            // For each range, check if it's adjacent to the next one. If so, combine them
-            std::vector<PortRange> newRanges;
-            newRanges.push_back(_ranges[0]);
+            // For each range, check if it's adjacent to the previous one. If so, combine them in place
+            size_t writeIndex = 0;
             auto numRanges = _ranges.size();
             for (size_t index = 1; index < numRanges; ++index)
             {
                 const auto r = _ranges[index];
-                if (newRanges.back().IsAdjacent(r))
+                if (_ranges[writeIndex].IsAdjacent(r))
                 {
-                    newRanges.back().Append(r);
+                    _ranges[writeIndex].Append(r);
                 }
                 else
                 {
-                    newRanges.push_back(r);
+                    ++writeIndex;
+                    if (writeIndex != index)
+                    {
+                        _ranges[writeIndex] = r;
+                    }
                 }
             }
-            _ranges = newRanges;
+            _ranges.resize(writeIndex + 1);
 
             ComputeSize();
         }
+        _isCanonical = true;
     }
 
     bool PortElementsBase::operator==(const PortElementsBase& other) const
@@ -577,6 +593,7 @@ namespace model
         {
             _ranges.push_back(PortRangeFromArchivedProxy(archiver, rangeProxy));
         }
+        _isCanonical = false; // the archived ranges may contain adjacent entries
         ComputeSize();
     }
 
@@ -785,5 +802,9 @@ std::hash<ell::model::PortRange>::result_type std::hash<ell::model::PortRange>::
 
 std::hash<ell::model::PortElementsBase>::result_type std::hash<ell::model::PortElementsBase>::operator()(const argument_type& elements) const
 {
-    return ::ell::utilities::HashValue(elements.GetRanges());
+    const auto& ranges = elements.GetRanges();
+    size_t hash = 0;
+    ::ell::utilities::HashCombine(hash, ranges.size());
+    ::ell::utilities::HashRange(hash, ranges.begin(), ranges.end());
+    return hash;
 }
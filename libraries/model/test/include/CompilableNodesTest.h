@@ -46,6 +46,7 @@ void TestCompilableBinaryOperationNode2();
 void TestCompilableScalarBinaryPredicateNode();
 void TestCompilableBinaryPredicateNode();
 void TestCompilableMultiplexerNode();
+void TestCompilableGateNode();
 void TestCompilableTypeCastNode(size_t dimension);
 void TestReinterpretLayoutNode();
 void TestReorderDataNode1();
@@ -13,3 +13,4 @@ void TestMapComputeDataVector();
 void TestMapRefine();
 void TestMapSerialization();
 void TestMapClockNode();
+void TestMapMemoryFootprint();
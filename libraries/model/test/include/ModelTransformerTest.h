@@ -11,3 +11,4 @@ void TestCopySubmodel();
 void TestCopySubmodelOnto();
 void TestTransformSubmodelOnto();
 void TestTransformSubmodelInPlace();
+void TestParallelTransformationPipeline();
@@ -10,6 +10,7 @@
 void TestStaticModel();
 void TestNodeIterator();
 void TestReverseNodeIterator();
+void TestVisitOrderCache();
 
 void TestModelSerialization();
 void TestModelMetadata();
@@ -47,6 +47,7 @@
 #include <nodes/include/ExtremalValueNode.h>
 #include <nodes/include/FFTNode.h>
 #include <nodes/include/FullyConnectedLayerNode.h>
+#include <nodes/include/GateNode.h>
 #include <nodes/include/IRNode.h>
 #include <nodes/include/L2NormSquaredNode.h>
 #include <nodes/include/MatrixMatrixMultiplyCodeNode.h>
@@ -958,6 +959,33 @@ void TestCompilableMultiplexerNode()
     VerifyCompiledOutput(map, compiledMap, signal, "MultiplexerNode");
 }
 
+void TestCompilableGateNode()
+{
+    // An early-exit cascade: the "heavy" stage (here, just a square) runs only when the input is
+    // positive, and the multiplexer merges in a cheap default when it was skipped
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(1);
+    auto thresholdNode = model.AddNode<ConstantNode<double>>(0.0);
+    auto predicateNode = model.AddNode<BinaryPredicateNode<double>>(inputNode->output, thresholdNode->output, BinaryPredicateType::greater);
+    auto gateNode = model.AddNode<GateNode<double>>(inputNode->output, predicateNode->output);
+    auto squareNode = model.AddNode<UnaryOperationNode<double>>(gateNode->output, UnaryOperationType::square); // gated
+    auto defaultNode = model.AddNode<BinaryOperationNode<double>>(inputNode->output, inputNode->output, BinaryOperationType::subtract); // always zero, never skipped
+    auto combinedNode = model.AddNode<model::SpliceNode<double>>(std::vector<const model::OutputPortBase*>{ &defaultNode->output, &squareNode->output });
+    auto selectNode = model.AddNode<MultiplexerNode<double, bool>>(combinedNode->output, predicateNode->output);
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", selectNode->output } });
+
+    std::string name = "GateNode";
+    TestWithSerialization(map, name, [&](model::Map& map, int iteration) {
+        model::IRMapCompiler compiler;
+        auto compiledMap = compiler.Compile(map);
+
+        // compare output
+        std::vector<std::vector<double>> signal = { { 2 }, { -3 }, { 4 }, { -1 }, { 0 }, { 5 } };
+        std::vector<std::vector<double>> expected = { { 4 }, { 0 }, { 16 }, { 0 }, { 0 }, { 25 } };
+        VerifyCompiledOutputAndResult(map, compiledMap, signal, expected, utilities::FormatString("%s iteration %d", name.c_str(), iteration));
+    });
+}
+
 void TestCompilableTypeCastNode(size_t dimension)
 {
     model::Model model;
@@ -20,6 +20,8 @@
 #include <model/include/OutputNode.h>
 
 #include <nodes/include/ClockNode.h>
+#include <nodes/include/ConstantNode.h>
+#include <nodes/include/DotProductNode.h>
 #include <nodes/include/ExtremalValueNode.h>
 #include <nodes/include/MovingAverageNode.h>
 #include <nodes/include/SinkNode.h>
@@ -214,3 +216,24 @@ void TestMapClockNode()
     std::vector<nodes::TimeTickType> expectedLagValues = { lagThreshold, lagThreshold * 20 };
     testing::ProcessTest("Testing lag callbacks", testing::IsEqual(lagValues, expectedLagValues));
 }
+
+void TestMapMemoryFootprint()
+{
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(3);
+    auto constantNode = model.AddNode<nodes::ConstantNode<double>>(std::vector<double>{ 1.0, 2.0, 3.0 });
+    auto dotNode = model.AddNode<nodes::DotProductNode<double>>(inputNode->output, constantNode->output);
+    auto outputNode = model.AddNode<model::OutputNode<double>>(dotNode->output);
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", outputNode->output } });
+
+    auto footprint = map.GetMemoryFootprint();
+    testing::ProcessTest("Testing map memory footprint weight bytes", footprint.weightBytes == 3 * sizeof(double));
+    testing::ProcessTest("Testing map memory footprint MACs", footprint.multiplyAccumulates == 3);
+
+    // the dot product node reads both of its 3-element inputs and writes a single element
+    testing::ProcessTest("Testing map memory footprint peak activation", footprint.peakActivationBytes == 7 * sizeof(double));
+
+    // the input, dot product, and output nodes write 3 + 1 + 1 elements
+    testing::ProcessTest("Testing map memory footprint total activation", footprint.totalActivationBytes == 5 * sizeof(double));
+    testing::ProcessTest("Testing map memory footprint intensity", footprint.GetArithmeticIntensity() > 0);
+}
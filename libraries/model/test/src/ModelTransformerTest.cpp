@@ -13,6 +13,7 @@
 #include <model/include/InputNode.h>
 #include <model/include/Model.h>
 #include <model/include/OutputNode.h>
+#include <model/include/ParallelTransformationPipeline.h>
 
 #include <nodes/include/BinaryOperationNode.h>
 #include <nodes/include/UnaryOperationNode.h>
@@ -414,3 +415,40 @@ void TestTransformSubmodelInPlace_Modify()
     auto newNode1 = FindDebugNode(srcModel, 101);
     ProcessTest("TestTransformSubmodelInPlace_Modify", (srcModel.Size() == 2 * oldSize - 1) && ((&oldNode1->input.GetReferencedPort()) == (&newNode1->input.GetReferencedPort())));
 }
+
+void TestParallelTransformationPipeline()
+{
+    // a model with two disconnected chains: in1 -> out1, in2 -> out2
+    Model model;
+    auto in1 = model.AddNode<InputNode<double>>(3);
+    model.AddNode<OutputNode<double>>(in1->output);
+    auto in2 = model.AddNode<InputNode<double>>(2);
+    model.AddNode<OutputNode<double>>(in2->output);
+
+    auto regions = ParallelTransformationPipeline::PartitionSubmodel(Submodel(model));
+    ProcessTest("TestParallelTransformationPipeline partition", regions.size() == 2 && regions[0].GetOutputs().size() == 1 && regions[1].GetOutputs().size() == 1);
+
+    // a connected chain is a single region, returned as-is
+    auto chain = GetLinearDebugNodeModel(4);
+    auto chainRegions = ParallelTransformationPipeline::PartitionSubmodel(Submodel(chain));
+    ProcessTest("TestParallelTransformationPipeline single region", chainRegions.size() == 1);
+
+    // an empty pipeline copies the regions and merges them into one new model
+    TransformContext context;
+    ModelTransformer transformer;
+    ParallelTransformationPipeline pipeline;
+    auto result = pipeline.Transform(Submodel(model), transformer, context);
+    ProcessTest("TestParallelTransformationPipeline merge", result.GetModel().Size() == model.Size() && result.GetOutputs().size() == 2);
+    ProcessTest("TestParallelTransformationPipeline merged into new model", result.GetModel() != model);
+
+    // the caller's transformer knows where each region's boundary outputs ended up
+    bool mapped = true;
+    for (const auto& region : regions)
+    {
+        for (auto output : region.GetOutputs())
+        {
+            mapped &= (&transformer.GetCorrespondingOutputs(*output) != output);
+        }
+    }
+    ProcessTest("TestParallelTransformationPipeline output correspondence", mapped);
+}
@@ -550,6 +550,53 @@ void TestCustomRefine()
     testing::ProcessTest("testing custom refine function", model1.Size() == 4 && model2.Size() == 3);
 }
 
+void TestVisitOrderCache()
+{
+    // Create a simple computation model
+    model::Model model;
+    auto in = model.AddNode<model::InputNode<double>>(3);
+    auto maxAndArgMax = model.AddNode<nodes::ArgMaxNode<double>>(in->output);
+    auto minAndArgMin = model.AddNode<nodes::ArgMinNode<double>>(in->output);
+    auto condition = model.AddNode<nodes::ConstantNode<bool>>(true);
+    auto selector = model.AddNode<nodes::ValueSelectorNode<double>>(condition->output, maxAndArgMax->val, minAndArgMin->val);
+
+    auto getVisitOrder = [](const model::Model& m) {
+        std::vector<const model::Node*> order;
+        m.Visit([&](const model::Node& node) { order.push_back(&node); });
+        return order;
+    };
+    auto isTopological = [](const std::vector<const model::Node*>& order) {
+        std::unordered_set<const model::Node*> visited;
+        for (auto node : order)
+        {
+            for (auto parent : node->GetParentNodes())
+            {
+                if (visited.find(parent) == visited.end())
+                {
+                    return false;
+                }
+            }
+            visited.insert(node);
+        }
+        return true;
+    };
+
+    auto order1 = getVisitOrder(model);
+    auto order2 = getVisitOrder(model);
+    testing::ProcessTest("Testing repeated visits use the same order", order1 == order2);
+    testing::ProcessTest("Testing visit order is topological", order1.size() == model.Size() && isTopological(order1));
+
+    // adding a node appends it to the cached order
+    auto indexSelector = model.AddNode<nodes::ValueSelectorNode<int>>(condition->output, maxAndArgMax->argVal, minAndArgMin->argVal);
+    auto order3 = getVisitOrder(model);
+    testing::ProcessTest("Testing visit order after adding a node", order3.size() == model.Size() && order3.back() == indexSelector && isTopological(order3));
+
+    // rewiring an input invalidates the cached order, and the recomputed one is still topological
+    model::ModelEditor::ResetInputPort(&selector->condition, condition->output);
+    auto order4 = getVisitOrder(model);
+    testing::ProcessTest("Testing visit order after an edit", order4.size() == model.Size() && isTopological(order4));
+}
+
 void TestChangeInputForNode()
 {
     // Create a simple computation model
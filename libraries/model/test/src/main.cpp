@@ -35,6 +35,7 @@ int main()
         TestStaticModel();
         TestNodeIterator();
         TestReverseNodeIterator();
+        TestVisitOrderCache();
         TestModelSerialization();
         TestInputRouting();
 
@@ -56,6 +57,7 @@ int main()
         TestMapRefine();
         TestMapSerialization();
         TestMapClockNode();
+        TestMapMemoryFootprint();
 
         TestCustomRefine();
 
@@ -90,6 +92,7 @@ int main()
         TestCopySubmodelOnto();
         TestTransformSubmodelOnto();
         TestTransformSubmodelInPlace();
+        TestParallelTransformationPipeline();
 
         // Submodel tests
         TestSubmodels();
@@ -134,6 +134,7 @@ void TestIRCompiler()
     TestCompilableScalarBinaryPredicateNode();
     TestCompilableBinaryPredicateNode();
     TestCompilableMultiplexerNode();
+    TestCompilableGateNode();
     TestCompilableTypeCastNode(1);
     TestCompilableTypeCastNode(2);
     TestCompilableTypeCastNode(10);
@@ -135,6 +135,9 @@ namespace nodes
         ///
         emitters::IRLocalScalar Compile(emitters::IRLocalScalar a) const;
 
+        /// <summary> Indicates if the function can operate on vector types </summary>
+        bool CanUseVectorTypes() const { return true; }
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -205,6 +208,9 @@ namespace nodes
         emitters::LLVMValue Compile(emitters::IRFunctionEmitter& function, emitters::LLVMValue x) const override;
         using BroadcastUnaryFunctionType<ValueType>::Compile;
 
+        /// <summary> Indicates if the function can operate on vector types </summary>
+        bool CanUseVectorTypes() const { return true; }
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -338,6 +338,9 @@ namespace nodes
     protected:
         using BroadcastFunctionNode<ValueType, FunctionType>::GetFunction;
 
+        // Elementwise when the input and output agree on layout, so the buffers may be aliased
+        bool CanOperateInPlace() const override { return GetInputMemoryLayout() == GetOutputMemoryLayout(); }
+
         utilities::ArchiveVersion GetArchiveVersion() const override;
         bool CanReadArchiveVersion(const utilities::ArchiveVersion& version) const override;
         void WriteToArchive(utilities::Archiver& archiver) const override;
@@ -966,6 +969,37 @@ namespace nodes
         }
         emitters::LLVMValue pOutput = compiler.EnsurePortEmitted(GetOutput(), this->GetOutputPadding());
 
+        // If the function can operate on whole vectors and the data is laid out contiguously,
+        // process the buffer with explicit vector instructions instead of nested scalar loops
+        auto&& outputLayout = GetOutputMemoryLayout();
+        const int vectorSize = compilerSettings.vectorWidth;
+        if (compilerSettings.allowVectorInstructions && NumSecondaryInputs() == 0 && GetFunction().CanUseVectorTypes() &&
+            static_cast<int>(primaryInputSize) > 2 * vectorSize &&
+            inputLayout.IsCanonicalOrder() && !inputLayout.HasPadding() &&
+            outputLayout.IsCanonicalOrder() && !outputLayout.HasPadding())
+        {
+            const int size = static_cast<int>(primaryInputSize);
+            const int numFullBlocks = size / vectorSize;
+            const int numVectorElements = numFullBlocks * vectorSize;
+
+            auto vectorType = function.GetEmitter().VectorType(emitters::GetVariableType<ValueType>(), vectorSize);
+            auto vectorPointerType = vectorType->getPointerTo();
+            auto inputVector = function.CastPointer(pPrimaryInput, vectorPointerType);
+            auto outputVector = function.CastPointer(pOutput, vectorPointerType);
+            function.For(numFullBlocks, [inputVector, outputVector, &secondaryValues, this](emitters::IRFunctionEmitter& function, auto blockIndex) {
+                auto value = function.ValueAt(inputVector, blockIndex);
+                function.SetValueAt(outputVector, blockIndex, this->GetFunction().Compile(function, value, secondaryValues));
+            });
+            if (numVectorElements < size)
+            {
+                function.For(numVectorElements, size, [pPrimaryInput, pOutput, &secondaryValues, this](emitters::IRFunctionEmitter& function, auto i) {
+                    auto value = function.ValueAt(pPrimaryInput, i);
+                    function.SetValueAt(pOutput, i, this->GetFunction().Compile(function, value, secondaryValues));
+                });
+            }
+            return;
+        }
+
         // Call recursive function to emit nested loops
         // Note: We could just offset the input pointer at beginning instead of adding offset every time through the loop
         // Note: We can potentially fuse adjacent loops if memory is contiguous --- it can be done by preprocessing size/stride vectors
@@ -146,11 +146,17 @@ namespace nodes
         /// <returns> The name of this type. </returns>
         std::string GetRuntimeTypeName() const override { return GetTypeName(); }
 
+        /// <summary> Get the type of unary operation this node will perform </summary>
+        OperationType GetOperation() const { return _operation; }
+
     protected:
         using BroadcastOperationNode<ValueType, FunctionType>::GetOutput;
         using BroadcastOperationNode<ValueType, FunctionType>::MakeKernel;
         using KernelFunctionType = typename BroadcastOperationNode<ValueType, FunctionType>::KernelFunctionType;
 
+        // Elementwise when the input and output agree on layout, so the buffers may be aliased
+        bool CanOperateInPlace() const override { return this->GetInputMemoryLayout(0) == this->GetOutputMemoryLayout(); }
+
         KernelFunctionType GetKernelFunction() const override;
 
         void WriteToArchive(utilities::Archiver& archiver) const override;
@@ -16,6 +16,8 @@
 #include <model/include/Node.h>
 #include <model/include/OutputPort.h>
 
+#include <dsp/include/DCT.h>
+
 #include <math/include/Matrix.h>
 
 #include <utilities/include/TypeName.h>
@@ -78,8 +80,8 @@ namespace nodes
         // Output
         model::OutputPort<ValueType> _output;
 
-        // DCT Matrix
-        math::RowMatrix<ValueType> _dctCoeffs;
+        // DCT plan: holds the coefficient matrix, computed once, plus the fast small-size transform
+        dsp::DCTPlan<ValueType> _plan;
     };
 } // namespace nodes
 } // namespace ell
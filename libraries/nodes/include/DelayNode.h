@@ -155,6 +155,7 @@ namespace nodes
         //
         emitters::Variable* delayLineVar = function.GetModule().Variables().AddVariable<emitters::InitializedVectorVariable<ValueType>>(emitters::VariableScope::global, bufferSize);
         emitters::LLVMValue delayLine = function.GetModule().EnsureEmitted(*delayLineVar);
+        function.GetModule().RegisterModelStateVariable(delayLine);
 
         //
         // We implement a delay as a Shift Register
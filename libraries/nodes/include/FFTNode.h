@@ -79,6 +79,8 @@ namespace nodes
         // Emitting IR for FFT implemenations
         void EmitFFT_2(emitters::IRFunctionEmitter& function, emitters::LLVMValue input);
         void EmitFFT_4(emitters::IRFunctionEmitter& function, emitters::LLVMValue input);
+        void EmitFFT_8(emitters::IRFunctionEmitter& function, emitters::LLVMValue input);
+        void EmitRadix4FFT(emitters::IRFunctionEmitter& function, size_t length, emitters::LLVMValue input, emitters::LLVMValue scratch);
         void EmitFFT(emitters::IRFunctionEmitter& function, size_t length, emitters::LLVMValue input, emitters::LLVMValue scratch);
         void EmitRealFFT(emitters::IRFunctionEmitter& function, size_t length, emitters::LLVMValue input, emitters::LLVMValue scratch, emitters::LLVMValue complexInput);
 
@@ -89,6 +91,7 @@ namespace nodes
         // Hand-unrolled fixed-size versions
         emitters::LLVMFunction GetFFTFunction_2(emitters::IRModuleEmitter& moduleEmitter);
         emitters::LLVMFunction GetFFTFunction_4(emitters::IRModuleEmitter& moduleEmitter);
+        emitters::LLVMFunction GetFFTFunction_8(emitters::IRModuleEmitter& moduleEmitter);
 
         // Performing FFT (either by calling a function or emitting inline code)
         void DoFFT(emitters::IRFunctionEmitter& function, size_t length, emitters::LLVMValue input, emitters::LLVMValue scratch);
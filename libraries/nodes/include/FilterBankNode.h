@@ -91,6 +91,11 @@ namespace nodes
         // FilterBank
         const dsp::TriangleFilterBank& _filters;
         ValueType _offset;
+
+        // Streaming evaluator, initialized lazily on the first Compute so it picks up the filters
+        // after the node has been unarchived. Carries the previous frame's per-filter sums so that
+        // successive overlapping frames only pay for the spectral bins that changed.
+        mutable dsp::IncrementalFilterBankEvaluator<ValueType> _evaluator;
     };
 
     /// <summary>
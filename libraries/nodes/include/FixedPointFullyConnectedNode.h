@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FixedPointFullyConnectedNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <math/include/Matrix.h>
+
+#include <model/include/CompilableNode.h>
+#include <model/include/IRMapCompiler.h>
+#include <model/include/InputPort.h>
+#include <model/include/MapCompiler.h>
+#include <model/include/ModelTransformer.h>
+#include <model/include/Node.h>
+#include <model/include/OutputPort.h>
+
+#include <utilities/include/TypeName.h>
+
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A fully-connected layer computed in fixed-point (Q-format) integer arithmetic.
+    /// The weights are quantized to int16 at construction time, with shifts chosen from the
+    /// weights' range and the caller-supplied input calibration range, so targets without an FPU
+    /// replace the O(rows*columns) soft-float multiplies with integer MACs; only the input
+    /// quantization and output scaling touch floating point (one multiply per element). Inputs
+    /// are assumed to lie within the calibration range; values outside it lose accuracy. </summary>
+    template <typename ValueType>
+    class FixedPointFullyConnectedNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        FixedPointFullyConnectedNode();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="input"> The input vector (of size weights.NumColumns()). </param>
+        /// <param name="weights"> The full-precision weights, one output row per matrix row. </param>
+        /// <param name="inputRange"> The maximum absolute input value, from calibration; used to
+        /// choose the input quantization shift. </param>
+        FixedPointFullyConnectedNode(const model::OutputPort<ValueType>& input, const math::RowMatrix<ValueType>& weights, ValueType inputRange);
+
+        /// <summary> Constructor taking already-quantized weights (used when copying the node). </summary>
+        ///
+        /// <param name="input"> The input vector. </param>
+        /// <param name="weights"> The quantized weights, row-major (numOutputs x input.Size()). </param>
+        /// <param name="numOutputs"> The number of outputs (weight rows). </param>
+        /// <param name="weightShift"> The Q-format exponent the weights were scaled by. </param>
+        /// <param name="inputShift"> The Q-format exponent to scale inputs by. </param>
+        FixedPointFullyConnectedNode(const model::OutputPort<ValueType>& input, std::vector<short> weights, int numOutputs, int weightShift, int inputShift);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("FixedPointFullyConnectedNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+    protected:
+        void Compute() const override;
+        void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        void WriteToArchive(utilities::Archiver& archiver) const override;
+        void ReadFromArchive(utilities::Unarchiver& archiver) override;
+        bool HasState() const override { return true; } // Stored state: quantized weights and shifts
+
+    private:
+        void Copy(model::ModelTransformer& transformer) const override;
+
+        // Inputs
+        model::InputPort<ValueType> _input;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        // Quantized weights, row-major (numOutputs x numInputs), and the Q-format exponents
+        std::vector<short> _weights;
+        int _weightShift = 0;
+        int _inputShift = 0;
+        int _numOutputs = 0;
+    };
+
+    //
+    // Explicit instantiation declarations
+    //
+    extern template class FixedPointFullyConnectedNode<float>;
+    extern template class FixedPointFullyConnectedNode<double>;
+} // namespace nodes
+} // namespace ell
@@ -0,0 +1,407 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FusedBroadcastOperationNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "BroadcastOperationNodes.h"
+#include "NodeOperations.h"
+
+#include <model/include/CompilableCodeNode.h>
+#include <model/include/ModelTransformer.h>
+#include <model/include/PortMemoryLayout.h>
+
+#include <utilities/include/Exception.h>
+#include <utilities/include/TypeName.h>
+
+#include <value/include/Array.h>
+#include <value/include/Scalar.h>
+
+#include <value/include/loopnests/CodeGenerator.h>
+#include <value/include/loopnests/LoopNest.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A single scalar operation in a fused elementwise kernel. An argument refers to
+    /// the result of an earlier operation in the list when it is non-negative, and to one of the
+    /// node's inputs when it is negative (input i is encoded as -1-i). </summary>
+    struct FusedOperation
+    {
+        int arity = 0; // 1 = unary, 2 = binary
+        int operation = 0; // a UnaryOperationType or BinaryOperationType value, depending on arity
+        int argument1 = 0;
+        int argument2 = 0;
+    };
+
+    /// <summary> A node that evaluates a list of elementwise operations in a single pass over
+    /// the output, with the same broadcast semantics as the individual broadcast operation
+    /// nodes. Produced by the fusion transformation from chains of adjacent
+    /// `BroadcastUnaryOperationNode`s and `BroadcastBinaryOperationNode`s, so an n-deep chain
+    /// makes one trip through memory instead of n. </summary>
+    template <typename ValueType>
+    class FusedBroadcastOperationNode : public model::CompilableCodeNode
+    {
+    public:
+        /// @name Output Port
+        /// @{
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default constructor. </summary>
+        FusedBroadcastOperationNode();
+
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="inputs"> The inputs of the fused kernel. </param>
+        /// <param name="operations"> The operations to perform, in evaluation order. The result
+        /// of the last operation is the node's output. </param>
+        /// <param name="outputLayout"> The layout to use for the output. </param>
+        FusedBroadcastOperationNode(const std::vector<const model::OutputPortBase*>& inputs,
+                                    std::vector<FusedOperation> operations,
+                                    const model::PortMemoryLayout& outputLayout);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("FusedBroadcastOperationNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Get the list of operations this node will perform </summary>
+        const std::vector<FusedOperation>& GetOperations() const { return _operations; }
+
+    protected:
+        void Define(ell::value::FunctionDeclaration& fn) override;
+        void WriteToArchive(utilities::Archiver& archiver) const override;
+        void ReadFromArchive(utilities::Unarchiver& archiver) override;
+        bool HasState() const override { return true; } // stored state: the operation list
+
+    private:
+        using KernelFunctionType = std::function<void(const std::vector<value::Value>& args)>;
+
+        void Copy(model::ModelTransformer& transformer) const override;
+        void VerifyOperations() const;
+        model::PortMemoryLayout GetOutputMemoryLayout() const { return _output.GetMemoryLayout(); }
+        model::PortMemoryLayout GetInputMemoryLayout(int index) const { return GetInputPort(index)->GetMemoryLayout(); }
+        KernelFunctionType GetKernelFunction() const;
+        value::Scalar GetArgument(int argument, const std::vector<value::Array>& inputs, const std::vector<std::vector<value::Scalar>>& indices, const std::vector<value::Scalar>& results) const;
+
+        std::vector<std::unique_ptr<model::InputPort<ValueType>>> _inputPorts;
+        model::OutputPort<ValueType> _output;
+        std::vector<FusedOperation> _operations;
+    };
+} // namespace nodes
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace nodes
+{
+    namespace detail
+    {
+        inline value::Scalar ApplyFusedUnaryOperation(UnaryOperationType operation, value::Scalar x)
+        {
+            switch (operation)
+            {
+            case UnaryOperationType::abs:
+                return value::Abs(x);
+            case UnaryOperationType::exp:
+                return value::Exp(x);
+            case UnaryOperationType::log:
+                return value::Log(x);
+            case UnaryOperationType::sqrt:
+                return value::Sqrt(x);
+            case UnaryOperationType::tanh:
+                return value::Tanh(x);
+            case UnaryOperationType::square:
+                return value::Square(x);
+            case UnaryOperationType::sin:
+                return value::Sin(x);
+            case UnaryOperationType::cos:
+                return value::Cos(x);
+            default:
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Illegal operation");
+            }
+        }
+
+        inline value::Scalar ApplyFusedBinaryOperation(BinaryOperationType operation, value::Scalar a, value::Scalar b)
+        {
+            switch (operation)
+            {
+            case BinaryOperationType::add:
+                return value::Add(a, b);
+            case BinaryOperationType::subtract:
+                return value::Subtract(a, b);
+            case BinaryOperationType::multiply:
+                return value::Multiply(a, b);
+            case BinaryOperationType::divide:
+                return value::Divide(a, b);
+            case BinaryOperationType::modulo:
+                return value::Modulo(a, b);
+            default:
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Illegal operation");
+            }
+        }
+    } // namespace detail
+
+    template <typename ValueType>
+    FusedBroadcastOperationNode<ValueType>::FusedBroadcastOperationNode() :
+        CompilableCodeNode("FusedBroadcastOperationNode", {}, { &_output }),
+        _output(this, model::Node::defaultOutputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    FusedBroadcastOperationNode<ValueType>::FusedBroadcastOperationNode(const std::vector<const model::OutputPortBase*>& inputs,
+                                                                        std::vector<FusedOperation> operations,
+                                                                        const model::PortMemoryLayout& outputLayout) :
+        CompilableCodeNode("FusedBroadcastOperationNode", {}, { &_output }),
+        _output(this, model::Node::defaultOutputPortName, outputLayout),
+        _operations(std::move(operations))
+    {
+        auto canonicalOutputLayout = ComputeBroadcastedLayout(inputs);
+        VerifyLayoutsCompatible({ outputLayout, canonicalOutputLayout });
+
+        // Add 1 input port per port in the input list
+        int index = 0;
+        for (const auto& inputPort : inputs)
+        {
+            auto portName = std::string("input_") + std::to_string(index);
+            _inputPorts.emplace_back(std::make_unique<model::InputPort<ValueType>>(this, static_cast<const model::OutputPort<ValueType>&>(*inputPort), portName));
+            AddInputPort(_inputPorts.back().get());
+            ++index;
+        }
+
+        VerifyOperations();
+    }
+
+    template <typename ValueType>
+    void FusedBroadcastOperationNode<ValueType>::VerifyOperations() const
+    {
+        if (_operations.empty())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "FusedBroadcastOperationNode must have at least one operation");
+        }
+
+        const int numInputs = NumInputPorts();
+        for (int index = 0; index < static_cast<int>(_operations.size()); ++index)
+        {
+            const auto& op = _operations[index];
+            if (op.arity != 1 && op.arity != 2)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "FusedBroadcastOperationNode operations must be unary or binary");
+            }
+            for (auto argument : { op.argument1, op.argument2 })
+            {
+                bool validInput = argument < 0 && (-1 - argument) < numInputs;
+                bool validResult = argument >= 0 && argument < index;
+                if (!validInput && !validResult)
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "FusedBroadcastOperationNode operation argument out of range");
+                }
+                if (op.arity == 1)
+                {
+                    break; // only check argument1
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void FusedBroadcastOperationNode<ValueType>::Define(ell::value::FunctionDeclaration& fn)
+    {
+        using namespace value::loopnests;
+
+        (void)fn.Define([this](const std::vector<value::Value>& args) {
+            if (static_cast<int>(args.size()) != (this->NumInputPorts() + this->NumOutputPorts()))
+            {
+                throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState);
+            }
+
+            auto outputLayout = this->GetOutputMemoryLayout();
+            auto numDim = outputLayout.NumDimensions();
+
+            // Create the indices and ranges for the loop nest
+            std::vector<Index> indices;
+            std::vector<IndexRange> ranges;
+            for (int d = 0; d < numDim; ++d)
+            {
+                auto name = "i_" + std::to_string(d);
+                Index i(name);
+                indices.emplace_back(i);
+                int size = static_cast<int>(outputLayout.GetLogicalDimensionActiveSize()[d]);
+                ranges.push_back({ i, { 0, size } });
+            }
+
+            LoopNest loop(ranges);
+            auto kernel = value::loopnests::Kernel("kernel")
+                              .Inputs(args)
+                              .Indices(indices)
+                              .Define(GetKernelFunction());
+            loop.AddKernel(kernel);
+
+            CodeGenerator generator;
+            generator.Run(loop);
+        });
+    }
+
+    template <typename ValueType>
+    auto FusedBroadcastOperationNode<ValueType>::GetKernelFunction() const -> KernelFunctionType
+    {
+        // # args = # inputs + # outputs
+        // the rest are indices
+        return [this](const std::vector<value::Value>& args) {
+            if (static_cast<int>(args.size()) != GetOutputMemoryLayout().NumDimensions() + NumInputPorts() + 1)
+            {
+                throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState);
+            }
+
+            const int numInputs = this->NumInputPorts();
+            std::vector<value::Array> inputs;
+            auto it = args.begin();
+            for (int i = 0; i < numInputs; ++i)
+            {
+                inputs.push_back({ *it++ });
+            }
+            auto output = value::Array(*it++);
+            std::vector<std::vector<value::Scalar>> indices(numInputs);
+            std::vector<value::Scalar> outputIndices;
+            int dimension = 0;
+            for (; it != args.end(); ++it)
+            {
+                for (int i = 0; i < numInputs; ++i)
+                {
+                    indices[i].push_back(GetInputMemoryLayout(i).GetLogicalDimensionActiveSize(dimension) > 1 ? value::Scalar{ *it } : value::Scalar(0));
+                }
+                outputIndices.push_back({ *it });
+                ++dimension;
+            }
+
+            // Evaluate the operation list; all the intermediate results stay in registers
+            std::vector<value::Scalar> results;
+            for (const auto& op : _operations)
+            {
+                auto argument1 = GetArgument(op.argument1, inputs, indices, results);
+                if (op.arity == 1)
+                {
+                    results.push_back(detail::ApplyFusedUnaryOperation(static_cast<UnaryOperationType>(op.operation), argument1));
+                }
+                else
+                {
+                    auto argument2 = GetArgument(op.argument2, inputs, indices, results);
+                    results.push_back(detail::ApplyFusedBinaryOperation(static_cast<BinaryOperationType>(op.operation), argument1, argument2));
+                }
+            }
+            output(outputIndices) = results.back();
+        };
+    }
+
+    template <typename ValueType>
+    value::Scalar FusedBroadcastOperationNode<ValueType>::GetArgument(int argument, const std::vector<value::Array>& inputs, const std::vector<std::vector<value::Scalar>>& indices, const std::vector<value::Scalar>& results) const
+    {
+        if (argument < 0)
+        {
+            auto inputIndex = -1 - argument;
+            auto input = inputs[inputIndex]; // value::Array::operator() isn't const, so copy the (reference-like) Array object
+            return input(indices[inputIndex]);
+        }
+        return results[argument];
+    }
+
+    template <typename ValueType>
+    void FusedBroadcastOperationNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        std::vector<const model::OutputPortBase*> newInputs;
+        for (const auto& inputPort : _inputPorts)
+        {
+            const auto& newPort = transformer.GetCorrespondingInputs(*inputPort);
+            newInputs.emplace_back(&newPort);
+        }
+        auto newNode = transformer.AddNode<FusedBroadcastOperationNode<ValueType>>(newInputs, _operations, GetOutputMemoryLayout());
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void FusedBroadcastOperationNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        model::CompilableCodeNode::WriteToArchive(archiver);
+        int numInputs = static_cast<int>(_inputPorts.size());
+        archiver["numInputs"] << numInputs;
+        for (int index = 0; index < numInputs; ++index)
+        {
+            archiver[std::string("input_") + std::to_string(index)] << *_inputPorts[index];
+        }
+        archiver["outputLayout"] << GetOutputMemoryLayout();
+
+        std::vector<int> arities;
+        std::vector<std::string> operationNames;
+        std::vector<int> arguments1;
+        std::vector<int> arguments2;
+        for (const auto& op : _operations)
+        {
+            arities.push_back(op.arity);
+            operationNames.push_back(op.arity == 1 ? ToString(static_cast<UnaryOperationType>(op.operation)) : ToString(static_cast<BinaryOperationType>(op.operation)));
+            arguments1.push_back(op.argument1);
+            arguments2.push_back(op.argument2);
+        }
+        archiver["arities"] << arities;
+        archiver["operations"] << operationNames;
+        archiver["arguments1"] << arguments1;
+        archiver["arguments2"] << arguments2;
+    }
+
+    template <typename ValueType>
+    void FusedBroadcastOperationNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        model::CompilableCodeNode::ReadFromArchive(archiver);
+        int numInputs = 0;
+        archiver["numInputs"] >> numInputs;
+        _inputPorts.clear();
+        for (int index = 0; index < numInputs; ++index)
+        {
+            model::InputPort<ValueType> port;
+            auto portName = std::string("input_") + std::to_string(index);
+            archiver[portName] >> port;
+            _inputPorts.emplace_back(std::make_unique<model::InputPort<ValueType>>(this, port.GetReferencedPort(), portName));
+            AddInputPort(_inputPorts.back().get());
+        }
+        model::PortMemoryLayout outputLayout;
+        archiver["outputLayout"] >> outputLayout;
+        _output.SetMemoryLayout(outputLayout);
+
+        std::vector<int> arities;
+        std::vector<std::string> operationNames;
+        std::vector<int> arguments1;
+        std::vector<int> arguments2;
+        archiver["arities"] >> arities;
+        archiver["operations"] >> operationNames;
+        archiver["arguments1"] >> arguments1;
+        archiver["arguments2"] >> arguments2;
+        _operations.clear();
+        for (size_t index = 0; index < arities.size(); ++index)
+        {
+            int operation = arities[index] == 1 ? static_cast<int>(FromString<UnaryOperationType>(operationNames[index])) : static_cast<int>(FromString<BinaryOperationType>(operationNames[index]));
+            _operations.push_back({ arities[index], operation, arguments1[index], arguments2[index] });
+        }
+        VerifyOperations();
+    }
+} // namespace nodes
+} // namespace ell
+
+#pragma endregion implementation
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     GateNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/GateNodeBase.h>
+#include <model/include/IRMapCompiler.h>
+#include <model/include/MapCompiler.h>
+#include <model/include/ModelTransformer.h>
+#include <model/include/Node.h>
+#include <model/include/OutputPort.h>
+
+#include <utilities/include/Exception.h>
+
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that gates the execution of the part of the model downstream of it. </summary>
+    ///
+    /// The gate passes its input through unchanged. When the model is compiled, the nodes reachable
+    /// only through the gate (an early-exit cascade's expensive stage, for instance) are emitted
+    /// inside a branch on the gate's condition, so the whole region is skipped at runtime when the
+    /// condition is false. The output buffers of skipped nodes hold unspecified values: merge any
+    /// result the rest of the model reads through a `MultiplexerNode` selecting on the same
+    /// condition. When computing in the interpreter the gated nodes always run, which produces the
+    /// same observable outputs once the results pass through the merge.
+    template <typename ValueType>
+    class GateNode : public model::GateNodeBase
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* conditionPortName = "condition";
+        const model::InputPort<ValueType>& input = _input;
+        const model::InputPort<bool>& condition = _condition;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        GateNode();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="input"> The data to pass through the gate </param>
+        /// <param name="condition"> The condition controlling whether the nodes downstream of the gate execute </param>
+        GateNode(const model::OutputPort<ValueType>& input, const model::OutputPort<bool>& condition);
+
+        /// <summary> Gets the port holding the condition controlling the gated region. </summary>
+        ///
+        /// <returns> The condition port. </returns>
+        const model::InputPortBase& GetConditionPort() const override { return _condition; }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("GateNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+    protected:
+        void Compute() const override;
+        void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        bool ShouldCompileInline() const override { return true; }
+        void WriteToArchive(utilities::Archiver& archiver) const override;
+        void ReadFromArchive(utilities::Unarchiver& archiver) override;
+        bool HasState() const override { return false; }
+
+    private:
+        void Copy(model::ModelTransformer& transformer) const override;
+
+        model::InputPort<ValueType> _input;
+        model::InputPort<bool> _condition;
+        model::OutputPort<ValueType> _output;
+    };
+} // namespace nodes
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    GateNode<ValueType>::GateNode() :
+        GateNodeBase({ &_input, &_condition }, { &_output }),
+        _input(this, {}, defaultInputPortName),
+        _condition(this, {}, conditionPortName),
+        _output(this, defaultOutputPortName, 0){};
+
+    template <typename ValueType>
+    GateNode<ValueType>::GateNode(const model::OutputPort<ValueType>& input, const model::OutputPort<bool>& condition) :
+        GateNodeBase({ &_input, &_condition }, { &_output }),
+        _input(this, input, defaultInputPortName),
+        _condition(this, condition, conditionPortName),
+        _output(this, defaultOutputPortName, input.GetMemoryLayout())
+    {
+        if (condition.Size() != 1)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "GateNode: condition must be a scalar");
+        }
+    };
+
+    template <typename ValueType>
+    void GateNode<ValueType>::Compute() const
+    {
+        // The gate is a pass-through: the condition only affects which nodes the compiled code
+        // executes, not the gate's own value
+        _output.SetOutput(_input.GetValue());
+    }
+
+    template <typename ValueType>
+    void GateNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        const auto& newInput = transformer.GetCorrespondingInputs(_input);
+        const auto& newCondition = transformer.GetCorrespondingInputs(_condition);
+        auto newNode = transformer.AddNode<GateNode<ValueType>>(newInput, newCondition);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void GateNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        // The pass-through needs no code: alias the output to the input variable. The compiler
+        // reads the condition port when it emits the branches around the gated nodes.
+        emitters::Variable* inputVariable = compiler.GetVariableForPort(input.GetReferencedPort());
+        compiler.SetVariableForPort(output, inputVariable);
+    }
+
+    template <typename ValueType>
+    void GateNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[defaultInputPortName] << _input;
+        archiver[conditionPortName] << _condition;
+    }
+
+    template <typename ValueType>
+    void GateNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[defaultInputPortName] >> _input;
+        archiver[conditionPortName] >> _condition;
+        _output.SetMemoryLayout(_input.GetMemoryLayout());
+    }
+} // namespace nodes
+} // namespace ell
+
+#pragma endregion implementation
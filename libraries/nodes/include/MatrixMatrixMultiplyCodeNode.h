@@ -212,6 +212,33 @@ namespace nodes
         /// <returns> The name of this type. </returns>
         std::string GetRuntimeTypeName() const override { return GetTypeName(); }
 
+        /// <summary> Gets the number of rows of the left-hand input matrix (and of the output). </summary>
+        int GetM() const { return _m; }
+
+        /// <summary> Gets the number of columns of the right-hand input matrix (and of the output). </summary>
+        int GetN() const { return _n; }
+
+        /// <summary> Gets the inner dimension of the multiplication. </summary>
+        int GetK() const { return _k; }
+
+        /// <summary> Gets the row stride of the left-hand input matrix. </summary>
+        int GetMatrix1Stride() const { return _lda; }
+
+        /// <summary> Gets the row stride of the right-hand input matrix. </summary>
+        int GetMatrix2Stride() const { return _ldb; }
+
+        /// <summary> Gets the row stride of the output matrix. </summary>
+        int GetOutputMatrixStride() const { return _ldc; }
+
+        /// <summary> Indicates if the left-hand input matrix is transposed. </summary>
+        bool GetTranspose1() const { return _transpose1; }
+
+        /// <summary> Indicates if the right-hand input matrix is transposed. </summary>
+        bool GetTranspose2() const { return _transpose2; }
+
+        /// <summary> Indicates if the output matrix is transposed. </summary>
+        bool GetTransposeOutput() const { return _transposeOutput; }
+
     protected:
         void Define(value::FunctionDeclaration& fn) override;
         utilities::ArchiveVersion GetArchiveVersion() const override;
@@ -226,11 +253,9 @@ namespace nodes
         void ZeroMatrix(value::Matrix matrix) const;
 
         void ForLoopGEMM(const value::Matrix matA, const value::Matrix matB, value::Matrix matC);
-        void Gemm(const value::Matrix mat, const value::Matrix matB, value::Matrix matC);
-        void GemmFn(const value::Matrix mat, const value::Matrix matB, value::Matrix matC, int thread_num = 0);
-        void ParallelizeGemmCol(const value::Matrix matA, const value::Matrix matB, value::Matrix matC, int numThreads = 2);
-        void ParallelizeGemmRow(const value::Matrix matA, const value::Matrix matB, value::Matrix matC, int numThreads = 2);
+        void Gemm(const value::Matrix mat, const value::Matrix matB, value::Matrix matC, int numThreads = 1);
         void ELLCodeGEMM(const value::Matrix matA, const value::Matrix matB, value::Matrix matC);
+        value::Value GetPrepackedWeightsBuffer(int panelRows, int panelColumns, int stripeSize) const;
 
         // Inputs
         model::InputPort<ValueType> _input1;
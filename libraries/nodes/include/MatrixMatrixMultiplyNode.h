@@ -92,6 +92,33 @@ namespace nodes
         /// <returns> The name of this type. </returns>
         std::string GetRuntimeTypeName() const override { return GetTypeName(); }
 
+        /// <summary> Gets the number of rows of the left-hand input matrix (and of the output). </summary>
+        int GetM() const { return _m; }
+
+        /// <summary> Gets the number of columns of the right-hand input matrix (and of the output). </summary>
+        int GetN() const { return _n; }
+
+        /// <summary> Gets the inner dimension of the multiplication. </summary>
+        int GetK() const { return _k; }
+
+        /// <summary> Gets the row stride of the left-hand input matrix. </summary>
+        int GetMatrix1Stride() const { return _lda; }
+
+        /// <summary> Gets the row stride of the right-hand input matrix. </summary>
+        int GetMatrix2Stride() const { return _ldb; }
+
+        /// <summary> Gets the row stride of the output matrix. </summary>
+        int GetOutputMatrixStride() const { return _ldc; }
+
+        /// <summary> Indicates if the left-hand input matrix is transposed. </summary>
+        bool GetTranspose1() const { return _transpose1; }
+
+        /// <summary> Indicates if the right-hand input matrix is transposed. </summary>
+        bool GetTranspose2() const { return _transpose2; }
+
+        /// <summary> Indicates if the output matrix is transposed. </summary>
+        bool GetTransposeOutput() const { return _transposeOutput; }
+
     protected:
         void Compute() const override;
         void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
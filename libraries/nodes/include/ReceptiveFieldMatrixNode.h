@@ -348,6 +348,86 @@ namespace nodes
                     }
                 }
             }
+            else if ((dataOrder == std::array<int, 3>({ { 0, 1, 2 } })) && (stride == 1) && !inputLayout.HasPadding()) // row, column, channel order, unit stride
+            {
+                // Strength-reduced fill for stride-1 row-major input: the receptive field offsets
+                // (fy, fx) are compile-time constants, so each output row of the S matrix splits into
+                // known padding and interior ranges. The padding ranges become memsets and the interior
+                // becomes a branch-free copy, instead of a bounds check on every element.
+                for (int fy = 0; fy < filterWidth; ++fy)
+                {
+                    for (int fx = 0; fx < filterWidth; ++fx)
+                    {
+                        // range of output image rows/columns whose source entry lands inside the image
+                        const int firstValidRow = std::max(0, extraPadding - fy);
+                        const int endValidRow = std::min(outputHeight, inputHeight + extraPadding - fy);
+                        const int firstValidColumn = std::max(0, extraPadding - fx);
+                        const int endValidColumn = std::min(outputWidth, inputWidth + extraPadding - fx);
+                        const int interiorWidth = std::max(0, endValidColumn - firstValidColumn);
+
+                        // offsets from an output image location to its source entry in the input
+                        const int rowOffset = fy - extraPadding;
+                        const int columnOffset = fx - extraPadding;
+                        const int fBase = (fy * filterWidth + fx) * inputDepth;
+
+                        function.For(inputDepth, [=](emitters::IRFunctionEmitter& function, emitters::LLVMValue channelValue) {
+                            auto channel = function.LocalScalar(channelValue);
+
+                            // Points to the beginning of row f == fBase + channel of the output S matrix
+                            auto outputRowPtr = function.PointerOffset(outputMatrix, (channel + fBase) * numOutputColumns);
+
+                            // Zero out the output rows whose source rows fall above or below the image
+                            if (firstValidRow > 0)
+                            {
+                                function.MemorySet<ValueType>(outputRowPtr, 0, function.Literal<uint8_t>(0), firstValidRow * outputWidth);
+                            }
+                            if (endValidRow < outputHeight)
+                            {
+                                function.MemorySet<ValueType>(outputRowPtr, endValidRow * outputWidth, function.Literal<uint8_t>(0), (outputHeight - endValidRow) * outputWidth);
+                            }
+
+                            if (interiorWidth == 0)
+                            {
+                                // degenerate case: every source column falls outside the image
+                                function.MemorySet<ValueType>(outputRowPtr, firstValidRow * outputWidth, function.Literal<uint8_t>(0), (endValidRow - firstValidRow) * outputWidth);
+                                return;
+                            }
+
+                            function.For(firstValidRow, endValidRow, [=](emitters::IRFunctionEmitter& function, emitters::LLVMValue rowValue) {
+                                auto outputImageRow = function.LocalScalar(rowValue);
+                                auto rowStart = outputImageRow * outputWidth;
+
+                                // Zero out the edge columns whose source columns fall outside the image
+                                if (firstValidColumn > 0)
+                                {
+                                    function.MemorySet<ValueType>(outputRowPtr, rowStart, function.Literal<uint8_t>(0), firstValidColumn);
+                                }
+                                if (endValidColumn < outputWidth)
+                                {
+                                    function.MemorySet<ValueType>(outputRowPtr, rowStart + endValidColumn, function.Literal<uint8_t>(0), outputWidth - endValidColumn);
+                                }
+
+                                auto inputRowStart = (outputImageRow + rowOffset) * (inputWidth * inputDepth);
+                                if (inputDepth == 1)
+                                {
+                                    // single-channel input: the interior of the row is a contiguous copy
+                                    auto sourceOffset = inputRowStart + (firstValidColumn + columnOffset);
+                                    auto destinationOffset = rowStart + firstValidColumn;
+                                    function.MemoryCopy<ValueType>(inputVolume, sourceOffset, outputRowPtr, destinationOffset, function.Literal<int>(interiorWidth));
+                                }
+                                else
+                                {
+                                    function.For(firstValidColumn, endValidColumn, [=](emitters::IRFunctionEmitter& function, emitters::LLVMValue columnValue) {
+                                        auto outputImageColumn = function.LocalScalar(columnValue);
+                                        auto inputIndex = inputRowStart + ((outputImageColumn + columnOffset) * inputDepth) + channel;
+                                        function.SetValueAt(outputRowPtr, rowStart + outputImageColumn, function.ValueAt(inputVolume, inputIndex));
+                                    });
+                                }
+                            });
+                        });
+                    }
+                }
+            }
             else // Normal, single value-at-a-time method
             {
                 // The outer loop iterates over all d * k * k entries in the receptive field
@@ -18,8 +18,11 @@
 #include <model/include/Port.h>
 #include <model/include/PortMemoryLayout.h>
 
+#include <math/include/Matrix.h>
+
 #include <utilities/include/ArchiveVersion.h>
 #include <utilities/include/IArchivable.h>
+#include <utilities/include/MemoryLayout.h>
 
 #include <algorithm>
 #include <array>
@@ -135,7 +138,6 @@ namespace nodes
     private:
         void Copy(model::ModelTransformer& transformer) const override;
 
-        void ComputeDimensionLoop(const model::PortMemoryLayout& inputMemoryLayout, const model::PortMemoryLayout& outputMemoryLayout, int dimension, std::vector<int>& coordinates, std::vector<ValueType>& output) const;
 
         // Input
         model::InputPort<ValueType> _input;
@@ -413,35 +415,6 @@ namespace nodes
         transformer.MapNodeOutput(this->output, newNode->output);
     }
 
-    template <typename ValueType>
-    void ReorderDataNode<ValueType>::ComputeDimensionLoop(const model::PortMemoryLayout& inputMemoryLayout,
-                                                          const model::PortMemoryLayout& outputMemoryLayout,
-                                                          int dimension,
-                                                          std::vector<int>& coordinates,
-                                                          std::vector<ValueType>& output) const
-    {
-        if (dimension == inputMemoryLayout.NumDimensions() - 1) // last dimension
-        {
-            for (int index = 0; index < outputMemoryLayout.GetActiveSize(dimension); ++index)
-            {
-                coordinates[dimension] = index;
-
-                auto inputLocation = ReorderOutputToInputLocation(coordinates);
-                auto inputIndex = inputMemoryLayout.GetEntryOffset(inputLocation);
-                auto outputIndex = outputMemoryLayout.GetEntryOffset(coordinates);
-                output[outputIndex] = _input[inputIndex];
-            }
-        }
-        else
-        {
-            for (int index = 0; index < outputMemoryLayout.GetActiveSize(dimension); ++index)
-            {
-                coordinates[dimension] = index;
-                ComputeDimensionLoop(inputMemoryLayout, outputMemoryLayout, dimension + 1, coordinates, output);
-            }
-        }
-    }
-
     // TODO: for each dimension, loop over minimum of input and output interval. Then we don't have to check if the value is out-of-bounds
     template <typename ValueType>
     void ReorderDataNode<ValueType>::Compute() const
@@ -463,8 +436,44 @@ namespace nodes
             }
 
             std::vector<ValueType> output(outputSize, _paddingValue); // initialize to padding value
-            std::vector<int> coordinates(numDimensions);
-            ComputeDimensionLoop(inputMemoryLayout, outputMemoryLayout, 0, coordinates, output);
+            if (numDimensions == 2 && !inputMemoryLayout.HasPadding() && !outputMemoryLayout.HasPadding() &&
+                inputMemoryLayout.GetLogicalDimensionOrder() != outputMemoryLayout.GetLogicalDimensionOrder())
+            {
+                // The reorder is a pure 2D transpose, so view the ports as matrices and use the
+                // blocked layout-conversion copy from the math library instead of the general
+                // coordinate-by-coordinate loop.
+                auto inputValues = _input.GetValue();
+                const size_t numRows = inputMemoryLayout.GetLogicalDimensionActiveSize(0);
+                const size_t numColumns = inputMemoryLayout.GetLogicalDimensionActiveSize(1);
+                if (inputMemoryLayout.IsCanonicalOrder())
+                {
+                    math::ConstRowMatrixReference<ValueType> inputMatrix(inputValues.data(), numRows, numColumns);
+                    math::ColumnMatrixReference<ValueType> outputMatrix(output.data(), numRows, numColumns);
+                    outputMatrix.CopyFrom(inputMatrix);
+                }
+                else
+                {
+                    math::ConstColumnMatrixReference<ValueType> inputMatrix(inputValues.data(), numRows, numColumns);
+                    math::RowMatrixReference<ValueType> outputMatrix(output.data(), numRows, numColumns);
+                    outputMatrix.CopyFrom(inputMatrix);
+                }
+            }
+            else
+            {
+                // Walk the input and output in lockstep over the logical coordinate space of the
+                // output's active area. The iterators update their offsets incrementally, so there's
+                // no per-element coordinate permutation or multiplication.
+                auto inputValues = _input.GetValue();
+                auto logicalShape = outputMemoryLayout.GetLogicalDimensionActiveSize();
+                utilities::MemoryLayoutIterator inputIterator(inputMemoryLayout, logicalShape);
+                utilities::MemoryLayoutIterator outputIterator(outputMemoryLayout, logicalShape);
+                while (outputIterator.IsValid())
+                {
+                    output[outputIterator.GetOffset()] = inputValues[inputIterator.GetOffset()];
+                    inputIterator.Next();
+                    outputIterator.Next();
+                }
+            }
             _output.SetOutput(output);
         }
     }
@@ -489,15 +498,27 @@ namespace nodes
             ranges.push_back({ 0, outputMemoryLayout.GetActiveSize(dimensionIndex) });
         }
 
+        const auto compilerSettings = compiler.GetMapCompilerOptions(*this).compilerSettings;
         function.For(ranges,
                      [input,
                       output,
                       inputMemoryLayout,
                       outputMemoryLayout,
+                      compilerSettings,
                       this](emitters::IRFunctionEmitter& function, std::vector<emitters::IRLocalScalar> indices) {
                          auto inputLocation = ReorderOutputToInputLocation(indices);
                          auto inputIndex = model::EmitGetEntryOffset(function, inputLocation, inputMemoryLayout);
                          auto outputIndex = model::EmitGetEntryOffset(function, indices, outputMemoryLayout);
+                         if (compilerSettings.enablePrefetch)
+                         {
+                             // The input is read with a non-unit stride, so ask for the entry we'll need a few
+                             // iterations from now (prefetching past the end of the buffer is harmless)
+                             auto prefetchIndices = indices;
+                             prefetchIndices.back() = prefetchIndices.back() + compilerSettings.prefetchDistance;
+                             auto prefetchLocation = ReorderOutputToInputLocation(prefetchIndices);
+                             auto prefetchIndex = model::EmitGetEntryOffset(function, prefetchLocation, inputMemoryLayout);
+                             function.Prefetch(input, prefetchIndex);
+                         }
                          output[outputIndex] = input[inputIndex];
                      });
     }
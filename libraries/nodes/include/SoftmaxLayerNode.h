@@ -68,6 +68,10 @@ namespace nodes
     private:
         void Copy(model::ModelTransformer& transformer) const override;
 
+        // Fused implementation for contiguous layouts: a vectorized max-reduce pass, a single
+        // pass computing exp and the sum together, and a vectorized normalization pass
+        void CompileFusedLoops(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function);
+
         // Helper for generating nested loops to visit all input/output values
         template <typename FunctionType>
         void EmitComputeDimensionLoop(model::IRMapCompiler& compiler,
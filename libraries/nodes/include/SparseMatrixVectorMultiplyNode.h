@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrixVectorMultiplyNode.h (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/CompilableNode.h>
+#include <model/include/IRMapCompiler.h>
+#include <model/include/InputPort.h>
+#include <model/include/MapCompiler.h>
+#include <model/include/ModelTransformer.h>
+#include <model/include/Node.h>
+#include <model/include/OutputPort.h>
+
+#include <utilities/include/TypeName.h>
+
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that multiplies a constant sparse matrix with a vector. The matrix is
+    /// stored in compressed sparse row (CSR) form at construction time, so both Compute() and the
+    /// compiled code skip zero entries entirely: the work (and the weight storage) is proportional
+    /// to the number of nonzeros rather than rows*columns. Intended for the mostly-zero weight
+    /// matrices produced by pruning; for dense matrices, prefer `MatrixVectorMultiplyNode`, whose
+    /// contiguous inner loop is faster per element. </summary>
+    template <typename ValueType>
+    class SparseMatrixVectorMultiplyNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        const model::InputPort<ValueType>& input = _input;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default Constructor </summary>
+        SparseMatrixVectorMultiplyNode();
+
+        /// <summary> Constructor taking a dense matrix to compress. </summary>
+        ///
+        /// <param name="input"> The vector to multiply (of size numColumns). </param>
+        /// <param name="matrixValues"> The matrix entries, row-major (numRows x numColumns);
+        /// entries that are exactly zero are elided. </param>
+        /// <param name="numRows"> The number of rows in the matrix. </param>
+        /// <param name="numColumns"> The number of columns in the matrix. </param>
+        SparseMatrixVectorMultiplyNode(const model::OutputPort<ValueType>& input, const std::vector<ValueType>& matrixValues, size_t numRows, size_t numColumns);
+
+        /// <summary> Constructor taking an already-compressed matrix (used when copying the node). </summary>
+        ///
+        /// <param name="input"> The vector to multiply. </param>
+        /// <param name="rowOffsets"> The index of each row's first nonzero in `values`, plus a
+        /// final entry holding the total nonzero count (numRows + 1 entries). </param>
+        /// <param name="columnIndices"> The column of each nonzero entry. </param>
+        /// <param name="values"> The nonzero entries, in row order. </param>
+        /// <param name="numColumns"> The number of columns in the matrix. </param>
+        SparseMatrixVectorMultiplyNode(const model::OutputPort<ValueType>& input, std::vector<int> rowOffsets, std::vector<int> columnIndices, std::vector<ValueType> values, size_t numColumns);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("SparseMatrixVectorMultiplyNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+    protected:
+        void Compute() const override;
+        void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+        void WriteToArchive(utilities::Archiver& archiver) const override;
+        void ReadFromArchive(utilities::Unarchiver& archiver) override;
+        bool HasState() const override { return true; } // stored state: the compressed matrix
+
+    private:
+        void Copy(model::ModelTransformer& transformer) const override;
+
+        // Input
+        model::InputPort<ValueType> _input;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        // The matrix in CSR form: row r's nonzeros are values[rowOffsets[r] .. rowOffsets[r+1])
+        std::vector<int> _rowOffsets;
+        std::vector<int> _columnIndices;
+        std::vector<ValueType> _values;
+        size_t _numColumns = 0;
+    };
+
+    //
+    // Explicit instantiation declarations
+    //
+    extern template class SparseMatrixVectorMultiplyNode<float>;
+    extern template class SparseMatrixVectorMultiplyNode<double>;
+} // namespace nodes
+} // namespace ell
@@ -59,6 +59,7 @@ namespace nodes
         void WriteToArchive(utilities::Archiver& archiver) const override;
         void ReadFromArchive(utilities::Unarchiver& archiver) override;
         bool HasState() const override { return true; } // stored state: operation
+        bool CanOperateInPlace() const override { return true; } // elementwise: output[i] depends only on input[i]
         std::string GetRuntimeTypeName() const override { return GetTypeName(); }
 
     private:
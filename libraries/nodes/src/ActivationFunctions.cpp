@@ -13,14 +13,91 @@
 
 #include <emitters/include/IRLocalValue.h>
 #include <emitters/include/IRMath.h>
+#include <emitters/include/IRVectorUtilities.h>
 
 #include <value/include/Emittable.h>
 
 
+#include <cmath>
+#include <string>
+#include <vector>
+
 namespace ell
 {
 namespace nodes
 {
+    namespace
+    {
+        // Parameters for a tanh lookup table meeting a given absolute error tolerance.
+        // The table spans [-range, range]; beyond that, tanh is within the tolerance of the
+        // table endpoints. Half the tolerance budget goes to the clamped tails and half to the
+        // linear interpolation error, which is bounded by max|tanh''| * step^2 / 8 (max|tanh''| < 0.77).
+        struct TanhTableParameters
+        {
+            double range;
+            int numEntries;
+        };
+
+        TanhTableParameters GetTanhTableParameters(double tolerance)
+        {
+            const double tailTolerance = tolerance / 2;
+            const double interpolationTolerance = tolerance / 2;
+            double range = 0.5 * std::log(4.0 / tailTolerance); // >= atanh(1 - tailTolerance)
+            double step = std::sqrt(8.0 * interpolationTolerance / 0.77);
+            int numIntervals = static_cast<int>(std::ceil(2 * range / step));
+            return { range, numIntervals + 1 };
+        }
+
+        // Emits a branch-free tanh approximation: a clamped lookup into a precomputed table of
+        // tanh values, with linear interpolation between adjacent entries. The clamps compile to
+        // selects, so the loop around this code remains vectorizable and makes no libm calls.
+        template <typename ValueType>
+        emitters::IRLocalScalar CompileTanhApproximation(emitters::IRLocalScalar x)
+        {
+            auto function = x.function;
+            auto& module = function.GetModule();
+            auto parameters = GetTanhTableParameters(function.GetCompilerOptions().activationFunctionTolerance);
+            const int numEntries = parameters.numEntries;
+
+            std::vector<ValueType> tableValues(numEntries);
+            for (int index = 0; index < numEntries; ++index)
+            {
+                auto tableX = -parameters.range + (2 * parameters.range * index) / (numEntries - 1);
+                tableValues[index] = static_cast<ValueType>(std::tanh(tableX));
+            }
+            auto tableName = "tanhTable_" + utilities::GetTypeName<ValueType>() + "_" + std::to_string(numEntries);
+            auto table = module.ConstantArray(tableName, tableValues); // get-or-insert: shared by all uses in the module
+
+            const auto lowBound = function.LocalScalar(static_cast<ValueType>(-parameters.range));
+            const auto highBound = function.LocalScalar(static_cast<ValueType>(parameters.range));
+            const auto scale = function.LocalScalar(static_cast<ValueType>((numEntries - 1) / (2 * parameters.range)));
+            const auto maxIndex = function.LocalScalar<int>(numEntries - 2);
+
+            // Map x to a fractional table position in [0, numEntries - 1]
+            auto clampedX = function.LocalScalar(function.Select(x <= lowBound, lowBound, function.Select(x >= highBound, highBound, x)));
+            auto position = (clampedX - lowBound) * scale;
+            auto index = function.LocalScalar(function.CastValue<int>(position));
+            auto tableIndex = function.LocalScalar(function.Select(index > maxIndex, maxIndex, index));
+
+            // Interpolate between the bracketing table entries
+            auto fraction = position - function.LocalScalar(function.CastValue<ValueType>(tableIndex));
+            auto y0 = function.LocalScalar(function.ValueAt(table, tableIndex));
+            auto y1 = function.LocalScalar(function.ValueAt(table, tableIndex + function.LocalScalar<int>(1)));
+            return y0 + ((y1 - y0) * fraction);
+        }
+
+        // sigmoid(x) = (1 + tanh(x/2)) / 2; the tanh table error is halved, so the sigmoid
+        // approximation meets the same tolerance.
+        template <typename ValueType>
+        emitters::IRLocalScalar CompileSigmoidApproximation(emitters::IRLocalScalar x)
+        {
+            auto function = x.function;
+            const auto half = function.LocalScalar(static_cast<ValueType>(0.5));
+            const auto one = function.LocalScalar(static_cast<ValueType>(1));
+            auto tanhValue = CompileTanhApproximation<ValueType>(x * half);
+            return (tanhValue + one) * half;
+        }
+    } // end anonymous namespace
 
     //
     // Hard sigmoid activation function
@@ -136,6 +213,10 @@ namespace nodes
     template <typename ValueType>
     emitters::LLVMValue SigmoidActivationFunction<ValueType>::Compile(emitters::IRFunctionEmitter& function, emitters::LLVMValue xValue) const
     {
+        if (xValue->getType()->isVectorTy())
+        {
+            return emitters::VectorSigmoid<ValueType>(function, xValue);
+        }
         emitters::IRLocalScalar x{ function,xValue };
         return Compile(x).value;
     }
@@ -144,6 +225,10 @@ namespace nodes
     emitters::IRLocalScalar SigmoidActivationFunction<ValueType>::Compile(emitters::IRLocalScalar x) const
     {
         auto function = x.function;
+        if (function.GetCompilerOptions().approximateActivationFunctions)
+        {
+            return CompileSigmoidApproximation<ValueType>(x);
+        }
         const auto zero = emitters::IRLocalScalar(function, function.Literal(ValueType{ 0.0 }));
         const auto one = emitters::IRLocalScalar(function, function.Literal(static_cast<ValueType>(1.0)));
         auto a = one / (emitters::Exp(x * -one) + one);
@@ -165,7 +250,15 @@ namespace nodes
     template <typename ValueType>
     emitters::LLVMValue TanhActivationFunction<ValueType>::Compile(emitters::IRFunctionEmitter& function, emitters::LLVMValue xValue) const
     {
+        if (xValue->getType()->isVectorTy())
+        {
+            return emitters::VectorTanh<ValueType>(function, xValue);
+        }
         auto x = function.LocalScalar(xValue);
+        if (function.GetCompilerOptions().approximateActivationFunctions)
+        {
+            return CompileTanhApproximation<ValueType>(x);
+        }
         return emitters::Tanh<ValueType>(x);
     }
 
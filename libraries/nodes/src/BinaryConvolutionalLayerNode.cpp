@@ -110,21 +110,55 @@ namespace nodes
 
             auto input = function.LocalArray(realRow);
             auto output = function.LocalArray(packedOutput);
-            function.For(numCompleteBlocks, [storedElementNumBits, input, output](emitters::IRFunctionEmitter& function, emitters::LLVMValue i) {
-                auto blockIndex = function.LocalScalar(i);
 
-                // TODO: block-vectorize this:
-                auto blockValue = function.LocalScalar<PackedBitsType>(0);
-                for (int bitIndex = 0; bitIndex < storedElementNumBits; ++bitIndex)
-                {
-                    auto realValue = input[(blockIndex * storedElementNumBits) + bitIndex];
-                    auto cmp = realValue > static_cast<ValueType>(0);
-                    auto bitValue = function.LocalScalar(function.Select(cmp, function.Literal<PackedBitsType>(1), function.Literal<PackedBitsType>(0)));
-                    // blockValue = blockValue | ((realValue>0?1:0) << bitIndex);
-                    blockValue = blockValue | (bitValue << function.LocalScalar<PackedBitsType>(bitIndex));
-                }
-                output[blockIndex] = blockValue;
-            });
+            const auto& compilerSettings = function.GetCompilerOptions();
+            const int vectorSize = compilerSettings.vectorWidth;
+            if (compilerSettings.allowVectorInstructions && vectorSize > 1 && (storedElementNumBits % vectorSize == 0) && numCompleteBlocks > 0)
+            {
+                // Pack vectorSize values at a time: compare a vector of values against zero and
+                // bitcast the <N x i1> comparison result to an N-bit integer whose bit i is the
+                // sign bit of value i, then shift the partial masks into place
+                auto& emitter = function.GetEmitter();
+                auto vectorType = emitter.VectorType(emitters::GetVariableType<ValueType>(), vectorSize);
+                auto vectorPointerType = vectorType->getPointerTo();
+                auto maskType = llvm::IntegerType::get(function.GetModule().GetLLVMContext(), vectorSize);
+                auto packedBitsType = emitter.Type(emitters::GetVariableType<PackedBitsType>());
+                auto zeroVector = emitters::FillVector<ValueType>(function, vectorType, 0);
+                const int numChunks = storedElementNumBits / vectorSize;
+
+                auto inputVector = function.CastPointer(realRow, vectorPointerType);
+                function.For(numCompleteBlocks, [inputVector, output, vectorType, maskType, packedBitsType, zeroVector, numChunks, vectorSize](emitters::IRFunctionEmitter& function, emitters::LLVMValue i) {
+                    auto blockIndex = function.LocalScalar(i);
+                    auto& builder = function.GetEmitter().GetIRBuilder();
+
+                    auto blockValue = function.LocalScalar<PackedBitsType>(0);
+                    for (int chunk = 0; chunk < numChunks; ++chunk)
+                    {
+                        auto values = function.ValueAt(inputVector, (blockIndex * numChunks) + chunk);
+                        auto signMask = builder.CreateFCmpOGT(values, zeroVector);
+                        auto chunkBits = function.LocalScalar(builder.CreateZExt(builder.CreateBitCast(signMask, maskType), packedBitsType));
+                        blockValue = blockValue | (chunkBits << function.LocalScalar<PackedBitsType>(chunk * vectorSize));
+                    }
+                    output[blockIndex] = blockValue;
+                });
+            }
+            else
+            {
+                function.For(numCompleteBlocks, [storedElementNumBits, input, output](emitters::IRFunctionEmitter& function, emitters::LLVMValue i) {
+                    auto blockIndex = function.LocalScalar(i);
+
+                    auto blockValue = function.LocalScalar<PackedBitsType>(0);
+                    for (int bitIndex = 0; bitIndex < storedElementNumBits; ++bitIndex)
+                    {
+                        auto realValue = input[(blockIndex * storedElementNumBits) + bitIndex];
+                        auto cmp = realValue > static_cast<ValueType>(0);
+                        auto bitValue = function.LocalScalar(function.Select(cmp, function.Literal<PackedBitsType>(1), function.Literal<PackedBitsType>(0)));
+                        // blockValue = blockValue | ((realValue>0?1:0) << bitIndex);
+                        blockValue = blockValue | (bitValue << function.LocalScalar<PackedBitsType>(bitIndex));
+                    }
+                    output[blockIndex] = blockValue;
+                });
+            }
 
             // now do the last, partial, block
             if (numBlocks > numCompleteBlocks)
@@ -551,7 +585,7 @@ namespace nodes
     {
         // Get compiler settings
         const auto& compilerSettings = function.GetCompilerOptions();
-        const int vectorSize = compilerSettings.vectorWidth;
+        int vectorSize = compilerSettings.vectorWidth;
 
         // Get port variables
         emitters::LLVMValue pInput = compiler.EnsurePortEmitted(input);
@@ -596,6 +630,12 @@ namespace nodes
         const bool hasZeroPadding = predictors::neural::HasPadding(_inputPaddingParameters, predictors::neural::PaddingScheme::zeros);
 
         bool useVectorInstructions = compilerSettings.allowVectorInstructions;
+        // If a whole vector of blocks doesn't fit in the packed row, use a narrower vector
+        // rather than falling all the way back to the scalar popcount loop
+        while (vectorSize > 2 && packedRowSize / vectorSize == 0)
+        {
+            vectorSize /= 2;
+        }
         const int numVectorBlocks = useVectorInstructions ? packedRowSize / vectorSize : 0;
         if (numVectorBlocks == 0)
         {
@@ -695,7 +735,13 @@ namespace nodes
         const bool hasZeroPadding = predictors::neural::HasPadding(_inputPaddingParameters, predictors::neural::PaddingScheme::zeros);
 
         bool useVectorInstructions = compilerSettings.allowVectorInstructions;
-        const int vectorSize = compilerSettings.vectorWidth;
+        int vectorSize = compilerSettings.vectorWidth;
+        // If a whole vector of blocks doesn't fit in the packed row, use a narrower vector
+        // rather than falling all the way back to the scalar popcount loop
+        while (vectorSize > 2 && packedRowSize / vectorSize == 0)
+        {
+            vectorSize /= 2;
+        }
         const int numVectorBlocks = useVectorInstructions ? packedRowSize / vectorSize : 0;
         if (numVectorBlocks == 0)
         {
@@ -84,7 +84,11 @@ namespace nodes
         break;
         case ConvolutionMethod::winograd:
         {
-            auto convNode = transformer.AddNode<WinogradConvolutionNode<ValueType>>(*newInput, convInputLayout, convOutputLayout, weights, convParams.stride);
+            // The output tile size is selectable per layer: F(4x4, 3x3) saves more multiplies
+            // than F(2x2, 3x3), but needs more cache to win
+            const utilities::PropertyBag& metadata = this->GetMetadata();
+            auto tileSize = metadata.GetOrParseEntry<int>("winogradTileSize", 2);
+            auto convNode = transformer.AddNode<WinogradConvolutionNode<ValueType>>(*newInput, convInputLayout, convOutputLayout, weights, convParams.stride, tileSize);
             convOutput = &convNode->output;
         }
         break;
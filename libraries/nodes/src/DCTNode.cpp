@@ -20,8 +20,7 @@ namespace nodes
     DCTNode<ValueType>::DCTNode() :
         Node({ &_input }, { &_output }),
         _input(this, {}, defaultInputPortName),
-        _output(this, defaultOutputPortName, 0),
-        _dctCoeffs(0, 0)
+        _output(this, defaultOutputPortName, 0)
     {
     }
 
@@ -29,17 +28,16 @@ namespace nodes
     DCTNode<ValueType>::DCTNode(const model::OutputPort<ValueType>& input, size_t numFilters) :
         Node({ &_input }, { &_output }),
         _input(this, input, defaultInputPortName),
-        _output(this, defaultOutputPortName, numFilters),
-        _dctCoeffs(0, 0)
+        _output(this, defaultOutputPortName, numFilters)
     {
-        _dctCoeffs = dsp::GetDCTMatrix<ValueType>(numFilters, _input.Size());
+        _plan = dsp::DCTPlan<ValueType>(numFilters, _input.Size());
     }
 
     template <typename ValueType>
     void DCTNode<ValueType>::Compute() const
     {
         math::ColumnVector<ValueType> x(_input.GetValue());
-        auto result = dsp::DCT(_dctCoeffs, x);
+        auto result = _plan.Transform(x);
         _output.SetOutput(result.ToArray());
     };
 
@@ -47,7 +45,7 @@ namespace nodes
     void DCTNode<ValueType>::Copy(model::ModelTransformer& transformer) const
     {
         const auto& newInputs = transformer.GetCorrespondingInputs(_input);
-        auto newNode = transformer.AddNode<DCTNode<ValueType>>(newInputs, _dctCoeffs.NumRows());
+        auto newNode = transformer.AddNode<DCTNode<ValueType>>(newInputs, _plan.NumFilters());
         transformer.MapNodeOutput(output, newNode->output);
     }
 
@@ -55,7 +53,7 @@ namespace nodes
     bool DCTNode<ValueType>::Refine(model::ModelTransformer& transformer) const
     {
         const auto& newInputs = transformer.GetCorrespondingInputs(_input);
-        const auto& result = MatrixVectorProduct(newInputs, _dctCoeffs);
+        const auto& result = MatrixVectorProduct(newInputs, _plan.GetMatrix());
         transformer.MapNodeOutput(output, result);
         return true;
     }
@@ -65,7 +63,7 @@ namespace nodes
     {
         Node::WriteToArchive(archiver);
         archiver[defaultInputPortName] << _input;
-        archiver["numFilters"] << _dctCoeffs.NumRows();
+        archiver["numFilters"] << _plan.NumFilters();
     }
 
     template <typename ValueType>
@@ -75,7 +73,7 @@ namespace nodes
         Node::ReadFromArchive(archiver);
         archiver[defaultInputPortName] >> _input;
         archiver["numFilters"] >> numFilters;
-        _dctCoeffs = dsp::GetDCTMatrix<ValueType>(numFilters, _input.Size());
+        _plan = dsp::DCTPlan<ValueType>(numFilters, _input.Size());
         _output.SetSize(numFilters);
     }
 
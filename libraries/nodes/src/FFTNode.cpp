@@ -24,6 +24,7 @@
 
 #define USE_STORED_TWIDDLE_FACTORS 1
 #define USE_FIXED_SMALL_FFT 1
+#define USE_RADIX_4_FFT 1 // use radix-4 stages (half the recursion depth and passes over the data) when the length allows
 #define MAX_INLINE_FFT_SIZE 0 // 0 to disable inlining FFT code
 #define USE_REAL_FFT 0 // The real-valued FFT is slower than the complex one. Disable it for now.
 
@@ -175,6 +176,16 @@ namespace nodes
             return { function, function.Load(result) };
         }
 
+        template <typename ValueType>
+        inline emitters::IRLocalValue ComplexLiteral(emitters::IRFunctionEmitter& function, ValueType re, ValueType im)
+        {
+            auto& module = function.GetModule();
+            auto complexType = GetComplexType<ValueType>(module);
+            auto result = function.Variable(complexType, "c_lit");
+            function.FillStruct(result, { function.Literal<ValueType>(re), function.Literal<ValueType>(im) });
+            return { function, function.Load(result) };
+        }
+
         inline emitters::IRLocalValue ComplexAbs(emitters::IRLocalValue a)
         {
             if (!(a.value->getType()->isStructTy() && a.value->getType()->getNumContainedTypes() == 2))
@@ -218,6 +229,24 @@ namespace nodes
             return result;
         }
 
+        template <typename ValueType>
+        std::vector<std::complex<ValueType>> GetRadix4TwiddleFactors(size_t size)
+        {
+            // size == FFT length / 4
+            // Entry 3*k + (r-1) holds w^(r*k) for r in {1, 2, 3}, with w = e^(i*2*pi/length),
+            // so the three factors needed for each radix-4 butterfly are adjacent in memory
+            const auto pi = math::Constants<ValueType>::pi;
+            std::vector<std::complex<ValueType>> result(3 * size);
+            for (size_t k = 0; k < size; ++k)
+            {
+                for (size_t r = 1; r <= 3; ++r)
+                {
+                    result[3 * k + (r - 1)] = std::exp(std::complex<ValueType>(0, pi * k * r / (2 * size)));
+                }
+            }
+            return result;
+        }
+
         template <typename ValueType>
         std::string GetFFTFunctionName(size_t length)
         {
@@ -428,6 +457,146 @@ namespace nodes
         return function.GetFunction();
     }
 
+    template <typename ValueType>
+    void FFTNode<ValueType>::EmitFFT_8(emitters::IRFunctionEmitter& function, emitters::LLVMValue input)
+    {
+        // FFT of length 8, computed as two unrolled length-4 FFTs over the even- and odd-indexed
+        // entries, combined with the constant twiddle factors [1, s+is, i, -s+is] (s = sqrt(2)/2)
+        const auto s = static_cast<ValueType>(std::sqrt(2.0) / 2);
+
+        auto x0 = function.LocalScalar(function.ValueAt(input, 0));
+        auto x1 = function.LocalScalar(function.ValueAt(input, 1));
+        auto x2 = function.LocalScalar(function.ValueAt(input, 2));
+        auto x3 = function.LocalScalar(function.ValueAt(input, 3));
+        auto x4 = function.LocalScalar(function.ValueAt(input, 4));
+        auto x5 = function.LocalScalar(function.ValueAt(input, 5));
+        auto x6 = function.LocalScalar(function.ValueAt(input, 6));
+        auto x7 = function.LocalScalar(function.ValueAt(input, 7));
+
+        // length-4 FFT of the even-indexed entries {x0, x2, x4, x6}
+        auto x0px4 = detail::ComplexAdd(x0, x4);
+        auto x0mx4 = detail::ComplexSubtract(x0, x4);
+        auto x2px6 = detail::ComplexAdd(x2, x6);
+        auto x2mx6 = detail::ComplexSubtract(x2, x6);
+        auto e0 = detail::ComplexAdd(x0px4, x2px6);
+        auto e1 = detail::ComplexAdd(x0mx4, detail::TimesI<ValueType>(x2mx6));
+        auto e2 = detail::ComplexSubtract(x0px4, x2px6);
+        auto e3 = detail::ComplexSubtract(x0mx4, detail::TimesI<ValueType>(x2mx6));
+
+        // length-4 FFT of the odd-indexed entries {x1, x3, x5, x7}
+        auto x1px5 = detail::ComplexAdd(x1, x5);
+        auto x1mx5 = detail::ComplexSubtract(x1, x5);
+        auto x3px7 = detail::ComplexAdd(x3, x7);
+        auto x3mx7 = detail::ComplexSubtract(x3, x7);
+        auto o0 = detail::ComplexAdd(x1px5, x3px7);
+        auto o1 = detail::ComplexAdd(x1mx5, detail::TimesI<ValueType>(x3mx7));
+        auto o2 = detail::ComplexSubtract(x1px5, x3px7);
+        auto o3 = detail::ComplexSubtract(x1mx5, detail::TimesI<ValueType>(x3mx7));
+
+        // apply the twiddle factors to the odd half and combine
+        auto wo0 = o0;
+        auto wo1 = detail::ComplexMultiply(detail::ComplexLiteral<ValueType>(function, s, s), o1);
+        auto wo2 = detail::TimesI<ValueType>(o2);
+        auto wo3 = detail::ComplexMultiply(detail::ComplexLiteral<ValueType>(function, -s, s), o3);
+        function.SetValueAt(input, 0, detail::ComplexAdd(e0, wo0));
+        function.SetValueAt(input, 1, detail::ComplexAdd(e1, wo1));
+        function.SetValueAt(input, 2, detail::ComplexAdd(e2, wo2));
+        function.SetValueAt(input, 3, detail::ComplexAdd(e3, wo3));
+        function.SetValueAt(input, 4, detail::ComplexSubtract(e0, wo0));
+        function.SetValueAt(input, 5, detail::ComplexSubtract(e1, wo1));
+        function.SetValueAt(input, 6, detail::ComplexSubtract(e2, wo2));
+        function.SetValueAt(input, 7, detail::ComplexSubtract(e3, wo3));
+    }
+
+    template <typename ValueType>
+    emitters::LLVMFunction FFTNode<ValueType>::GetFFTFunction_8(emitters::IRModuleEmitter& module)
+    {
+        const auto length = 8;
+        auto functionName = detail::GetFFTFunctionName<ValueType>(length);
+        auto existingFunction = module.GetFunction(functionName);
+        if (existingFunction != nullptr)
+        {
+            return existingFunction;
+        }
+
+        emitters::IRFunctionEmitter function = detail::GetFFTFunctionEmitter<ValueType>(module, length);
+        {
+            auto arguments = function.Arguments().begin();
+            auto input = function.LocalScalar(&(*arguments++));
+
+            EmitFFT_8(function, input);
+        }
+        module.EndFunction();
+        return function.GetFunction();
+    }
+
+    // Radix-4 FFT stage: splits the input into quarters by index mod 4, transforms each quarter,
+    // and combines them with one pass of radix-4 butterflies. Compared with two levels of the
+    // radix-2 recursion this halves the number of passes over the data, and the twiddle factors
+    // come from a constant array in the module.
+    template <typename ValueType>
+    void FFTNode<ValueType>::EmitRadix4FFT(emitters::IRFunctionEmitter& function, size_t length, emitters::LLVMValue input, emitters::LLVMValue scratch)
+    {
+        auto& module = function.GetModule();
+        auto& emitter = module.GetIREmitter();
+        auto valueType = emitter.Type(emitters::GetVariableType<ValueType>());
+        auto complexType = detail::GetComplexType(module, valueType);
+        auto complexPtrType = complexType->getPointerTo();
+
+        assert(length % 4 == 0);
+        const int halfN = static_cast<int>(length / 2);
+        const int quarterN = static_cast<int>(length / 4);
+
+        // Sort the input into quarters by index mod 4: one deinterleave pass splits it into the
+        // even- and odd-indexed halves, and a second pass over each half splits those again.
+        // Afterwards the quarters hold the indices congruent to 0, 2, 1, and 3 (mod 4), in that order.
+        Deinterleave(function, input, halfN, scratch);
+        Deinterleave(function, input, quarterN, scratch);
+        Deinterleave(function, function.PointerOffset(input, halfN), quarterN, scratch);
+
+        auto part0 = input;
+        auto part2 = function.PointerOffset(input, quarterN);
+        auto part1 = function.PointerOffset(input, 2 * quarterN);
+        auto part3 = function.PointerOffset(input, 3 * quarterN);
+
+        if (quarterN > 1) // call recursive case if necessary
+        {
+            DoFFT(function, quarterN, part0, scratch);
+            DoFFT(function, quarterN, part1, scratch);
+            DoFFT(function, quarterN, part2, scratch);
+            DoFFT(function, quarterN, part3, scratch);
+        }
+
+        auto twiddleFactors = detail::GetRadix4TwiddleFactors<ValueType>(quarterN);
+        std::vector<ValueType> twiddleFactorsUnwrapped(twiddleFactors.size() * 2);
+        ValueType* dataPtr = reinterpret_cast<ValueType*>(twiddleFactors.data());
+        std::copy(dataPtr, dataPtr + twiddleFactorsUnwrapped.size(), twiddleFactorsUnwrapped.begin());
+        auto twiddleFactorsUnwrappedVar = module.ConstantArray(std::string("twiddles4_") + std::to_string(quarterN), twiddleFactorsUnwrapped); // TODO: encode type name in variable name
+        auto twiddleFactorsVar = function.CastPointer(twiddleFactorsUnwrappedVar, complexPtrType);
+
+        // X[k + j*N/4] = t0 + (i^j)*t1 + (i^2j)*t2 + (i^3j)*t3, with tr = w^(r*k) * part_r[k]
+        function.For(quarterN, [&input, &part0, &part1, &part2, &part3, &twiddleFactorsVar, quarterN](emitters::IRFunctionEmitter& function, auto k) {
+            auto w1 = function.LocalScalar(function.ValueAt(twiddleFactorsVar, k * 3));
+            auto w2 = function.LocalScalar(function.ValueAt(twiddleFactorsVar, (k * 3) + 1));
+            auto w3 = function.LocalScalar(function.ValueAt(twiddleFactorsVar, (k * 3) + 2));
+
+            auto t0 = function.LocalScalar(function.ValueAt(part0, k));
+            auto t1 = detail::ComplexMultiply(w1, function.LocalScalar(function.ValueAt(part1, k)));
+            auto t2 = detail::ComplexMultiply(w2, function.LocalScalar(function.ValueAt(part2, k)));
+            auto t3 = detail::ComplexMultiply(w3, function.LocalScalar(function.ValueAt(part3, k)));
+
+            auto sum02 = detail::ComplexAdd(t0, t2);
+            auto diff02 = detail::ComplexSubtract(t0, t2);
+            auto sum13 = detail::ComplexAdd(t1, t3);
+            auto diff13TimesI = detail::TimesI<ValueType>(detail::ComplexSubtract(t1, t3));
+
+            function.SetValueAt(input, k, detail::ComplexAdd(sum02, sum13));
+            function.SetValueAt(input, k + quarterN, detail::ComplexAdd(diff02, diff13TimesI));
+            function.SetValueAt(input, k + (2 * quarterN), detail::ComplexSubtract(sum02, sum13));
+            function.SetValueAt(input, k + (3 * quarterN), detail::ComplexSubtract(diff02, diff13TimesI));
+        });
+    }
+
     // Fixed-size FFT function implementation: size is known at compile time
     template <typename ValueType>
     void FFTNode<ValueType>::EmitFFT(emitters::IRFunctionEmitter& function, size_t length, emitters::LLVMValue input, emitters::LLVMValue scratch)
@@ -436,13 +605,28 @@ namespace nodes
         if (length == 2)
         {
             EmitFFT_2(function, input);
+            return;
         }
         if (length == 4)
         {
             EmitFFT_4(function, input);
+            return;
+        }
+        if (length == 8)
+        {
+            EmitFFT_8(function, input);
+            return;
         }
 #endif // USE_FIXED_SMALL_FFT
 
+#if (USE_RADIX_4_FFT)
+        if (length % 4 == 0)
+        {
+            EmitRadix4FFT(function, length, input, scratch);
+            return;
+        }
+#endif // USE_RADIX_4_FFT
+
         // TODO: assert(bitcount(length) == 1)  (i.e., length is a power of 2)
         auto& module = function.GetModule();
         auto& emitter = module.GetIREmitter();
@@ -505,6 +689,10 @@ namespace nodes
         {
             return GetFFTFunction_4(module);
         }
+        if (length == 8)
+        {
+            return GetFFTFunction_8(module);
+        }
 #endif // USE_FIXED_SMALL_FFT
 
         auto functionName = detail::GetFFTFunctionName<ValueType>(length);
@@ -41,8 +41,11 @@ namespace nodes
     void FilterBankNode<ValueType>::Compute() const
     {
         std::vector<ValueType> input = _input.GetValue();
-        auto output = _filters.FilterFrequencyMagnitudes(input);
-        _output.SetOutput(output);
+        if (!_evaluator.IsInitialized())
+        {
+            _evaluator = dsp::IncrementalFilterBankEvaluator<ValueType>(_filters);
+        }
+        _output.SetOutput(_evaluator.FilterFrequencyMagnitudes(input));
     };
 
     template <typename ValueType>
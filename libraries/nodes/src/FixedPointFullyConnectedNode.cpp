@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FixedPointFullyConnectedNode.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FixedPointFullyConnectedNode.h"
+
+#include <emitters/include/EmitterTypes.h>
+#include <emitters/include/IRLocalValue.h>
+
+#include <utilities/include/Exception.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ell
+{
+namespace nodes
+{
+    namespace
+    {
+        constexpr int maxQuantizedValue = 32767; // largest magnitude representable in int16
+
+        // Returns the largest shift s (clamped to 15) such that values in [-maxAbs, maxAbs],
+        // scaled by 2^s, stay within the int16 range. Negative shifts mean the range exceeds
+        // the representable magnitudes and values get divided down.
+        int GetQFormatShift(double maxAbs)
+        {
+            if (maxAbs <= 0)
+            {
+                return 15;
+            }
+            return std::min(15, static_cast<int>(std::floor(std::log2(maxQuantizedValue / maxAbs))));
+        }
+
+        template <typename ValueType>
+        std::vector<short> QuantizeWeights(const math::RowMatrix<ValueType>& weights, int shift)
+        {
+            const double scale = std::ldexp(1.0, shift);
+            std::vector<short> result(weights.NumRows() * weights.NumColumns());
+            size_t index = 0;
+            for (size_t row = 0; row < weights.NumRows(); ++row)
+            {
+                for (size_t column = 0; column < weights.NumColumns(); ++column)
+                {
+                    auto scaled = std::round(static_cast<double>(weights(row, column)) * scale);
+                    scaled = std::min<double>(std::max<double>(scaled, -maxQuantizedValue), maxQuantizedValue);
+                    result[index++] = static_cast<short>(scaled);
+                }
+            }
+            return result;
+        }
+    } // namespace
+
+    template <typename ValueType>
+    FixedPointFullyConnectedNode<ValueType>::FixedPointFullyConnectedNode() :
+        CompilableNode({ &_input }, { &_output }),
+        _input(this, {}, defaultInputPortName),
+        _output(this, defaultOutputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    FixedPointFullyConnectedNode<ValueType>::FixedPointFullyConnectedNode(const model::OutputPort<ValueType>& input, const math::RowMatrix<ValueType>& weights, ValueType inputRange) :
+        CompilableNode({ &_input }, { &_output }),
+        _input(this, input, defaultInputPortName),
+        _output(this, defaultOutputPortName, weights.NumRows()),
+        _numOutputs(static_cast<int>(weights.NumRows()))
+    {
+        if (input.Size() != weights.NumColumns())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Input size must match the number of weight columns");
+        }
+
+        double maxAbsWeight = 0;
+        for (size_t row = 0; row < weights.NumRows(); ++row)
+        {
+            for (size_t column = 0; column < weights.NumColumns(); ++column)
+            {
+                maxAbsWeight = std::max(maxAbsWeight, std::abs(static_cast<double>(weights(row, column))));
+            }
+        }
+        _weightShift = GetQFormatShift(maxAbsWeight);
+        _inputShift = GetQFormatShift(static_cast<double>(inputRange));
+        _weights = QuantizeWeights(weights, _weightShift);
+    }
+
+    template <typename ValueType>
+    FixedPointFullyConnectedNode<ValueType>::FixedPointFullyConnectedNode(const model::OutputPort<ValueType>& input, std::vector<short> weights, int numOutputs, int weightShift, int inputShift) :
+        CompilableNode({ &_input }, { &_output }),
+        _input(this, input, defaultInputPortName),
+        _output(this, defaultOutputPortName, numOutputs),
+        _weights(std::move(weights)),
+        _weightShift(weightShift),
+        _inputShift(inputShift),
+        _numOutputs(numOutputs)
+    {
+        if (_weights.size() != input.Size() * static_cast<size_t>(numOutputs))
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Weights size must equal input size times the number of outputs");
+        }
+    }
+
+    template <typename ValueType>
+    void FixedPointFullyConnectedNode<ValueType>::Compute() const
+    {
+        // Mirror the emitted arithmetic, including the truncating input quantization,
+        // so Compute() and the compiled code agree bit-for-bit.
+        auto inputValues = _input.GetValue();
+        const int numInputs = static_cast<int>(inputValues.size());
+        const auto inputScale = static_cast<ValueType>(std::ldexp(1.0, _inputShift));
+        const auto outputScale = static_cast<ValueType>(std::ldexp(1.0, -(_inputShift + _weightShift)));
+
+        std::vector<int> quantizedInput(numInputs);
+        for (int index = 0; index < numInputs; ++index)
+        {
+            quantizedInput[index] = static_cast<int>(inputValues[index] * inputScale);
+        }
+
+        std::vector<ValueType> output(_numOutputs);
+        for (int row = 0; row < _numOutputs; ++row)
+        {
+            int64_t accumulator = 0;
+            const short* weightsRow = _weights.data() + static_cast<size_t>(row) * numInputs;
+            for (int column = 0; column < numInputs; ++column)
+            {
+                accumulator += static_cast<int64_t>(static_cast<int>(weightsRow[column]) * quantizedInput[column]);
+            }
+            output[row] = static_cast<ValueType>(accumulator) * outputScale;
+        }
+        _output.SetOutput(output);
+    };
+
+    template <typename ValueType>
+    void FixedPointFullyConnectedNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        const auto& newInputs = transformer.GetCorrespondingInputs(_input);
+        auto newNode = transformer.AddNode<FixedPointFullyConnectedNode<ValueType>>(newInputs, _weights, _numOutputs, _weightShift, _inputShift);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void FixedPointFullyConnectedNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        auto& module = function.GetModule();
+        const int numInputs = static_cast<int>(input.Size());
+        const auto inputScale = static_cast<ValueType>(std::ldexp(1.0, _inputShift));
+        const auto outputScale = static_cast<ValueType>(std::ldexp(1.0, -(_inputShift + _weightShift)));
+
+        // Emit the quantized weights as constant data
+        llvm::GlobalVariable* weights = module.ConstantArray(compiler.GetGlobalName(*this, "weights"), _weights);
+
+        // Get input and output
+        emitters::LLVMValue pInput = compiler.EnsurePortEmitted(input);
+        emitters::LLVMValue pOutput = compiler.EnsurePortEmitted(output);
+
+        // Quantize the input once, up front, so the inner loops are all-integer
+        emitters::LLVMValue quantizedInput = function.Variable(emitters::VariableType::Int32, numInputs);
+        function.For(numInputs, [=](emitters::IRFunctionEmitter& function, emitters::LLVMValue indexVar) {
+            auto index = function.LocalScalar(indexVar);
+            auto inputVal = function.LocalScalar(function.ValueAt(pInput, index));
+            auto scaledVal = inputVal * function.LocalScalar(inputScale);
+            function.SetValueAt(quantizedInput, index, function.CastValue(scaledVal, emitters::VariableType::Int32));
+        });
+
+        // Allocate local variable to accumulate the dot products
+        emitters::LLVMValue accumulatorVar = function.Variable(emitters::VariableType::Int64, "accumulator");
+
+        // Loop over output rows, accumulating integer products; the only floating-point
+        // operation per output is the final scale back to ValueType
+        function.For(_numOutputs, [=](emitters::IRFunctionEmitter& function, emitters::LLVMValue rowVar) {
+            auto row = function.LocalScalar(rowVar);
+            function.StoreZero(accumulatorVar);
+            auto rowOffset = row * function.LocalScalar(numInputs);
+            function.For(numInputs, [=](emitters::IRFunctionEmitter& function, emitters::LLVMValue columnVar) {
+                auto column = function.LocalScalar(columnVar);
+                auto weightVal = function.LocalScalar(function.CastValue(function.ValueAt(weights, rowOffset + column), emitters::VariableType::Int32));
+                auto inputVal = function.LocalScalar(function.ValueAt(quantizedInput, column));
+                auto product = function.LocalScalar(function.CastValue(weightVal * inputVal, emitters::VariableType::Int64));
+                function.Store(accumulatorVar, function.LocalScalar(function.Load(accumulatorVar)) + product);
+            });
+            auto result = function.LocalScalar(function.CastValue(function.Load(accumulatorVar), emitters::GetVariableType<ValueType>()));
+            function.SetValueAt(pOutput, row, result * function.LocalScalar(outputScale));
+        });
+    }
+
+    template <typename ValueType>
+    void FixedPointFullyConnectedNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[defaultInputPortName] << _input;
+        archiver["weights"] << _weights;
+        archiver["weightShift"] << _weightShift;
+        archiver["inputShift"] << _inputShift;
+        archiver["numOutputs"] << _numOutputs;
+    }
+
+    template <typename ValueType>
+    void FixedPointFullyConnectedNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[defaultInputPortName] >> _input;
+        archiver["weights"] >> _weights;
+        archiver["weightShift"] >> _weightShift;
+        archiver["inputShift"] >> _inputShift;
+        archiver["numOutputs"] >> _numOutputs;
+        _output.SetSize(_numOutputs);
+    }
+
+    //
+    // Explicit instantiation definitions
+    //
+    template class FixedPointFullyConnectedNode<float>;
+    template class FixedPointFullyConnectedNode<double>;
+} // namespace nodes
+} // namespace ell
@@ -8,6 +8,8 @@
 
 #include "GRUNode.h"
 
+#include "ActivationFunctions.h"
+
 #include <math/include/MatrixOperations.h>
 
 #include <utilities/include/Exception.h>
@@ -120,35 +122,22 @@ namespace nodes
         math::MultiplyScaleAddUpdate(alpha, hiddenWeights, this->_hiddenState, beta, hstack);
 
         // the weights are stacked in 3 slices for (input, reset, hidden).
-        size_t slice1 = 0;
         size_t slice2 = hiddenUnits;
         size_t slice3 = 2 * hiddenUnits;
 
-        // input_gate = sigma(W_{ iz } x + b_{ iz } + W_{ hz } h + b_{ hz })
-        VectorType input_gate(hiddenUnits);
-        input_gate.CopyFrom(istack.GetSubVector(slice1, hiddenUnits));
-        input_gate += hstack.GetSubVector(slice1, hiddenUnits);
-        this->_recurrentActivation.Apply(input_gate);
-
-        // reset_gate = sigma(W_{ ir } x + b_{ ir } + W_{ hr } h + b_{ hr })
-        VectorType reset_gate(hiddenUnits);
-        reset_gate.CopyFrom(istack.GetSubVector(slice2, hiddenUnits));
-        reset_gate += hstack.GetSubVector(slice2, hiddenUnits);
-        this->_recurrentActivation.Apply(reset_gate);
-
-        // hidden_gate = tanh(W_{ in } x + b_{ in } + reset_gate * (W_{ hn } h + b_{ hn }))
-        VectorType hidden_gate(hiddenUnits);
-        hidden_gate.CopyFrom(hstack.GetSubVector(slice3, hiddenUnits));
-        ElementwiseMultiplySet(hidden_gate, reset_gate, hidden_gate);
-        hidden_gate += istack.GetSubVector(slice3, hiddenUnits);
-        this->_activation.Apply(hidden_gate);
-
-        // ht = (1 - input_gate) * hidden_gate + input_gate * h
-        //    = hidden_gate - input_gate * hidden_gate + input_gate * h
-        //    = hidden_gate + input_gate (h - hidden_gate )
-        this->_hiddenState -= hidden_gate;
-        ElementwiseMultiplySet(this->_hiddenState, input_gate, this->_hiddenState);
-        this->_hiddenState += hidden_gate;
+        // Compute all three gates and the state update in a single pass over the gate
+        // pre-activations, while they are still hot in the cache:
+        //   zt = sigma(istack[0] + hstack[0])
+        //   rt = sigma(istack[1] + hstack[1])
+        //   nt = tanh(istack[2] + rt * hstack[2])
+        //   ht = (1 - zt) * nt + zt * h = nt + zt * (h - nt)
+        for (size_t i = 0; i < hiddenUnits; ++i)
+        {
+            auto zt = this->_recurrentActivation.Apply(istack[i] + hstack[i]);
+            auto rt = this->_recurrentActivation.Apply(istack[slice2 + i] + hstack[slice2 + i]);
+            auto nt = this->_activation.Apply(istack[slice3 + i] + rt * hstack[slice3 + i]);
+            this->_hiddenState[i] = nt + zt * (this->_hiddenState[i] - nt);
+        }
 
         if (this->ShouldReset())
         {
@@ -190,6 +179,7 @@ namespace nodes
         emitters::IRModuleEmitter& module = function.GetModule();
         auto hiddenStateVariable = module.Variables().AddVectorVariable<ValueType>(emitters::VariableScope::global, hiddenUnits);
         auto hiddenStateValue = module.EnsureEmitted(*hiddenStateVariable);
+        module.RegisterModelStateVariable(hiddenStateValue);
         auto hiddenStatePointer = function.PointerOffset(hiddenStateValue, 0); // convert "global variable" to a pointer
         auto hiddenState = function.LocalArray(hiddenStatePointer);
         auto& prevHiddenState = hiddenState;
@@ -198,9 +188,6 @@ namespace nodes
         const size_t stackSize = hiddenUnits * 3;
         auto istack = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), stackSize));
         auto hstack = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), stackSize));
-        auto inputGate = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), hiddenUnits));
-        auto resetGate = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), hiddenUnits));
-        auto hiddenGate = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), hiddenUnits));
 
         auto alpha = static_cast<ValueType>(1.0); // GEMV scaling of the matrix multipication
         auto beta = static_cast<ValueType>(1.0); // GEMV scaling of the bias addition
@@ -221,34 +208,19 @@ namespace nodes
         auto hstack_slice1 = function.LocalArray(function.PointerOffset(hstack, function.LocalScalar(hiddenUnits)));
         auto hstack_slice2 = function.LocalArray(function.PointerOffset(hstack, function.LocalScalar(hiddenUnits * 2)));
 
-        // input_gate = sigma(W_{ iz } x + b_{ iz } + W_{ hz } h + b_{ hz })
-        function.For(hiddenUnits, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            inputGate[i] = istack_slice0[i] + hstack_slice0[i];
-        });
-        this->ApplyActivation(function, this->_recurrentActivation, inputGate, hiddenUnits);
-
-        // reset_gate = sigma(W_{ ir } x + b_{ ir } + W_{ hr } h + b_{ hr })
-        function.For(hiddenUnits, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            resetGate[i] = istack_slice1[i] + hstack_slice1[i];
-        });
-        this->ApplyActivation(function, this->_recurrentActivation, resetGate, hiddenUnits);
-
-        // hidden_gate = tanh(W_{ in } x + b_{ in } + reset_gate * (W_{ hn } h + b_{ hn }))
-        function.For(hiddenUnits, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            hiddenGate[i] = istack_slice2[i] + resetGate[i] * hstack_slice2[i];
-        });
-        this->ApplyActivation(function, this->_activation, hiddenGate, hiddenUnits);
-
-        //ht = (1 - input_gate) * hidden_gate + input_gate * h
-        //   = hidden_gate - input_gate * hidden_gate + input_gate * h
-        //   = hidden_gate + input_gate (h - hidden_gate )
-
-        function.For(outputSize, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            auto z_i = inputGate[i];
-            auto n_i = hiddenGate[i];
-            auto h_i = prevHiddenState[i];
-            auto newValue = n_i + z_i * (h_i - n_i);
-            hiddenState[i] = newValue;
+        // Emit all three gates and the state update in a single loop over the gate pre-activations,
+        // with the activations applied inline, instead of a separate pass per gate:
+        //   zt = sigma(istack[0] + hstack[0])
+        //   rt = sigma(istack[1] + hstack[1])
+        //   nt = tanh(istack[2] + rt * hstack[2])
+        //   ht = (1 - zt) * nt + zt * h = nt + zt * (h - nt)
+        auto recurrentActivationFunction = GetNodeActivationFunction(this->_recurrentActivation);
+        auto activationFunction = GetNodeActivationFunction(this->_activation);
+        function.For(hiddenUnits, [&](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
+            auto zt = fn.LocalScalar(recurrentActivationFunction->Compile(fn, istack_slice0[i] + hstack_slice0[i]));
+            auto rt = fn.LocalScalar(recurrentActivationFunction->Compile(fn, istack_slice1[i] + hstack_slice1[i]));
+            auto nt = fn.LocalScalar(activationFunction->Compile(fn, istack_slice2[i] + rt * hstack_slice2[i]));
+            hiddenState[i] = nt + zt * (prevHiddenState[i] - nt);
         });
 
         // Copy hidden state to the output.
@@ -86,6 +86,8 @@ namespace nodes
         // Allocate global variables to accumulate the previous input and output
         llvm::GlobalVariable* prevInput = module.GlobalArray("prevInput_"s + GetInternalStateIdentifier(), std::vector<ValueType>(bSize, 0.0));
         llvm::GlobalVariable* prevOutput = module.GlobalArray("prevOutput_"s + GetInternalStateIdentifier(), std::vector<ValueType>(aSize, 0.0));
+        module.RegisterModelStateVariable(prevInput);
+        module.RegisterModelStateVariable(prevOutput);
 
         // Allocate global constants for the A and B filter coefficients
         std::vector<ValueType> bCoeffValues = detail::GetFilterCoeffArray(_filter.GetFeedforwardCoefficients());
@@ -96,6 +98,8 @@ namespace nodes
         // Allocate global variable for current input and output indices
         llvm::GlobalVariable* xIndexVar = module.Global<int>("xIndex_"s + GetInternalStateIdentifier(), 0);
         llvm::GlobalVariable* yIndexVar = module.Global<int>("yIndex_"s + GetInternalStateIdentifier(), 0);
+        module.RegisterModelStateVariable(xIndexVar);
+        module.RegisterModelStateVariable(yIndexVar);
 
         // Get input
         emitters::LLVMValue pInput = compiler.EnsurePortEmitted(input);
@@ -115,9 +119,14 @@ namespace nodes
             auto xIndex = function.LocalScalar(function.Load(xIndexVar));
             function.SetValueAt(prevInput, xIndex, inputVal); // X[i] = x_t
 
+            // The filter loops have tiny trip counts (the filter order) and a loop-carried dependence on the
+            // accumulator, so ask for them to be fully unrolled instead of relying on LLVM's heuristics
+            emitters::LoopUnrollInfo filterLoopUnrollInfo;
+            filterLoopUnrollInfo.fullUnrollBelow = 16;
+
             // compute dot product X dot B
             auto bOffset = function.LocalScalar((int)bSize - 1) - xIndex;
-            function.For(bSize, [prevInput, bCoeffs, bOffset, yVar](emitters::IRFunctionEmitter& function, emitters::LLVMValue iVar) {
+            function.For((int)bSize, filterLoopUnrollInfo, [prevInput, bCoeffs, bOffset, yVar](emitters::IRFunctionEmitter& function, emitters::LLVMValue iVar) {
                 auto i = function.LocalScalar(iVar);
                 auto xVal = function.LocalScalar(function.ValueAt(prevInput, i));
                 auto bVal = function.LocalScalar(function.ValueAt(bCoeffs, bOffset + i));
@@ -127,7 +136,7 @@ namespace nodes
             // compute dot product Y dot A
             auto yIndex = function.LocalScalar(function.Load(yIndexVar));
             auto aOffset = function.LocalScalar((int)aSize) - yIndex;
-            function.For(aSize, [prevOutput, aCoeffs, aOffset, yVar](emitters::IRFunctionEmitter& function, emitters::LLVMValue jVar) {
+            function.For((int)aSize, filterLoopUnrollInfo, [prevOutput, aCoeffs, aOffset, yVar](emitters::IRFunctionEmitter& function, emitters::LLVMValue jVar) {
                 auto j = function.LocalScalar(jVar);
                 auto yVal = function.LocalScalar(function.ValueAt(prevOutput, j));
                 auto aVal = function.LocalScalar(function.ValueAt(aCoeffs, aOffset + j));
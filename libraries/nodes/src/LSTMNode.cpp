@@ -8,6 +8,8 @@
 
 #include "LSTMNode.h"
 
+#include "ActivationFunctions.h"
+
 #include <math/include/MatrixOperations.h>
 
 #include <utilities/include/Exception.h>
@@ -117,61 +119,32 @@ namespace nodes
         auto alpha = static_cast<ValueType>(1); // GEMV scale multiplication
         auto beta = static_cast<ValueType>(1); // GEMV scale bias
 
-        // W_i * x + b_i
-        VectorType istack(inputBias); // add input bias
-        math::MultiplyScaleAddUpdate(alpha, inputWeights, inputVector, beta, istack);
-
-        // Wh * h + b_h
-        VectorType hstack(hiddenBias); // add hidden bias
-        math::MultiplyScaleAddUpdate(alpha, hiddenWeights, this->_hiddenState, beta, hstack);
+        // stack = W_i * x + b_i + W_h * h + b_h, with both weight products fused into one pass
+        VectorType stack(inputBias); // add input bias
+        stack += hiddenBias; // add hidden bias
+        math::MultiplyScaleAddUpdate(alpha, inputWeights, inputVector, hiddenWeights, this->_hiddenState, beta, stack);
 
         // 4 slices of the vector representing the LSTM input, forget, cell, output layers.
-        auto slice1 = 0;
         auto slice2 = hiddenUnits;
         auto slice3 = 2 * hiddenUnits;
         auto slice4 = 3 * hiddenUnits;
 
-        // inputGate = sigma(W_{ii} x + b_{ii} + W_{hi} h + b_{hi})
-        VectorType inputGate(hiddenUnits);
-        inputGate.CopyFrom(istack.GetSubVector(slice1, hiddenUnits));
-        inputGate += hstack.GetSubVector(slice1, hiddenUnits);
-        this->_recurrentActivation.Apply(inputGate);
-
-        // forgetGate = sigma(W_{if} x + b_{if} + W_{hf} h + b_{hf})
-        VectorType forgetGate(hiddenUnits);
-        forgetGate.CopyFrom(istack.GetSubVector(slice2, hiddenUnits));
-        forgetGate += hstack.GetSubVector(slice2, hiddenUnits);
-        this->_recurrentActivation.Apply(forgetGate);
-
-        // cellGate = tanh(W_{ig} x + b_{ig} + W_{hg} h + b_{hg})
-        VectorType cellGate(hiddenUnits);
-        cellGate.CopyFrom(istack.GetSubVector(slice3, hiddenUnits));
-        cellGate += hstack.GetSubVector(slice3, hiddenUnits);
-        this->_activation.Apply(cellGate);
-
-        // outputGate = sigma(W_{io} x + b_{io} + W_{ho} h + b_{ho})
-        VectorType outputGate(hiddenUnits);
-        outputGate.CopyFrom(istack.GetSubVector(slice4, hiddenUnits));
-        outputGate += hstack.GetSubVector(slice4, hiddenUnits);
-        this->_recurrentActivation.Apply(outputGate);
-
-        // ct = ft * c + it * gt
-        for (size_t i = 0; i < hiddenUnits; i++)
+        // Compute all four gates and the state updates in a single pass over the stacked
+        // pre-activations, while they are still hot in the cache:
+        //   it = sigma(stack[0]), ft = sigma(stack[1]), gt = tanh(stack[2]), ot = sigma(stack[3])
+        //   ct = ft * c + it * gt
+        //   ht = ot * tanh(ct)
+        for (size_t i = 0; i < hiddenUnits; ++i)
         {
-            auto ft = forgetGate[i];
-            auto ct = this->_cellState[i];
-            auto it = inputGate[i];
-            auto gt = cellGate[i];
-            auto newValue = ft * ct + it * gt;
-            this->_cellState[i] = newValue;
+            auto it = this->_recurrentActivation.Apply(stack[i]);
+            auto ft = this->_recurrentActivation.Apply(stack[slice2 + i]);
+            auto gt = this->_activation.Apply(stack[slice3 + i]);
+            auto ot = this->_recurrentActivation.Apply(stack[slice4 + i]);
+            auto ct = ft * this->_cellState[i] + it * gt;
+            this->_cellState[i] = ct;
+            this->_hiddenState[i] = ot * this->_activation.Apply(ct);
         }
 
-        // ht = ot * tanh(ct)
-        VectorType temp(hiddenUnits);
-        temp.CopyFrom(this->_cellState);
-        this->_activation.Apply(temp);
-        ElementwiseMultiplySet(outputGate, temp, this->_hiddenState);
-
         if (this->ShouldReset())
         {
             const_cast<LSTMNode<ValueType>*>(this)->Reset();
@@ -219,6 +192,7 @@ namespace nodes
         emitters::IRModuleEmitter& module = function.GetModule();
         auto hiddenStateVariable = module.Variables().AddVectorVariable<ValueType>(emitters::VariableScope::global, hiddenUnits);
         auto hiddenStateValue = module.EnsureEmitted(*hiddenStateVariable);
+        module.RegisterModelStateVariable(hiddenStateValue);
         auto hiddenStatePointer = function.PointerOffset(hiddenStateValue, 0); // convert "global variable" to a pointer
         auto hiddenState = function.LocalArray(hiddenStatePointer);
         auto& prevHiddenState = hiddenState;
@@ -226,6 +200,7 @@ namespace nodes
         // Allocate global buffer for cell state
         auto cellStateVariable = module.Variables().AddVectorVariable<ValueType>(emitters::VariableScope::global, hiddenUnits);
         auto cellStateValue = module.EnsureEmitted(*cellStateVariable);
+        module.RegisterModelStateVariable(cellStateValue);
         auto cellStatePointer = function.PointerOffset(cellStateValue, 0); // convert "global variable" to a pointer
         auto cellState = function.LocalArray(cellStatePointer);
         auto& prevCellState = cellState;
@@ -234,10 +209,6 @@ namespace nodes
         const size_t stackSize = hiddenUnits * stackHeight;
         auto istack = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), stackSize));
         auto hstack = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), stackSize));
-        auto inputGate = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), hiddenUnits));
-        auto forgetGate = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), hiddenUnits));
-        auto cellGate = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), hiddenUnits));
-        auto outputGate = function.LocalArray(function.Variable(emitters::GetVariableType<ValueType>(), hiddenUnits));
 
         auto alpha = static_cast<ValueType>(1.0); // GEMV scaling of the matrix multipication
         auto beta = static_cast<ValueType>(1.0); // GEMV scaling of the bias addition
@@ -261,49 +232,24 @@ namespace nodes
         auto hstack_slice2 = function.LocalArray(function.PointerOffset(hstack, function.LocalScalar(hiddenUnits * 2)));
         auto hstack_slice3 = function.LocalArray(function.PointerOffset(hstack, function.LocalScalar(hiddenUnits * 3)));
 
-        // input_gate = sigma(W_{ iz } x + b_{ iz } + W_{ hz } h + b_{ hz })
-        function.For(hiddenUnits, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            inputGate[i] = istack_slice0[i] + hstack_slice0[i];
-        });
-        this->ApplyActivation(function, this->_recurrentActivation, inputGate, hiddenUnits);
-
-        // forget_gate = sigma(W_{if} x + b_{if} + W_{hf} h + b_{hf})
-        function.For(hiddenUnits, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            forgetGate[i] = istack_slice1[i] + hstack_slice1[i];
-        });
-        this->ApplyActivation(function, this->_recurrentActivation, forgetGate, hiddenUnits);
-
-        // cell_gate = tanh(W_{ig} x + b_{ig} + W_{hg} h + b_{hg})
-        function.For(hiddenUnits, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            cellGate[i] = istack_slice2[i] + hstack_slice2[i];
-        });
-        this->ApplyActivation(function, this->_activation, cellGate, hiddenUnits);
-
-        // output_gate = sigma(W_{io} x + b_{io} + W_{ho} h + b_{ho})
-        function.For(hiddenUnits, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            outputGate[i] = istack_slice3[i] + hstack_slice3[i];
-        });
-        this->ApplyActivation(function, this->_recurrentActivation, outputGate, hiddenUnits);
-
-        // cellState = forget_gate * cellState + input_gate * cell_gate
-        function.For(hiddenUnits, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            auto ft = forgetGate[i];
-            auto ct = prevCellState[i];
-            auto it = inputGate[i];
-            auto gt = cellGate[i];
-            auto newValue = ft * ct + it * gt;
-            cellState[i] = newValue;
-        });
-
-        // newHiddenState = output_gate * tanh(ct), we'll reuse inputGate local variable to compile tanh(ct)
-        function.MemoryCopy<ValueType>(cellState, inputGate, hiddenUnits);
-        this->ApplyActivation(function, this->_activation, inputGate, hiddenUnits);
-
-        function.For(hiddenUnits, [=](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
-            auto tan_ct = inputGate[i];
-            auto ot = outputGate[i];
-            auto newValue = ot * tan_ct;
-            hiddenState[i] = newValue;
+        // Emit all four gates and the state updates in a single loop over the gate pre-activations,
+        // with the activations applied inline, instead of a separate pass per gate:
+        //   it = sigma(istack[0] + hstack[0])
+        //   ft = sigma(istack[1] + hstack[1])
+        //   gt = tanh(istack[2] + hstack[2])
+        //   ot = sigma(istack[3] + hstack[3])
+        //   ct = ft * c + it * gt
+        //   ht = ot * tanh(ct)
+        auto recurrentActivationFunction = GetNodeActivationFunction(this->_recurrentActivation);
+        auto activationFunction = GetNodeActivationFunction(this->_activation);
+        function.For(hiddenUnits, [&](emitters::IRFunctionEmitter& fn, emitters::IRLocalScalar i) {
+            auto it = fn.LocalScalar(recurrentActivationFunction->Compile(fn, istack_slice0[i] + hstack_slice0[i]));
+            auto ft = fn.LocalScalar(recurrentActivationFunction->Compile(fn, istack_slice1[i] + hstack_slice1[i]));
+            auto gt = fn.LocalScalar(activationFunction->Compile(fn, istack_slice2[i] + hstack_slice2[i]));
+            auto ot = fn.LocalScalar(recurrentActivationFunction->Compile(fn, istack_slice3[i] + hstack_slice3[i]));
+            auto ct = ft * prevCellState[i] + it * gt;
+            cellState[i] = ct;
+            hiddenState[i] = ot * fn.LocalScalar(activationFunction->Compile(fn, ct));
         });
 
         // Copy hidden state to the output.
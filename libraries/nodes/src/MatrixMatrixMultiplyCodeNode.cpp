@@ -8,6 +8,7 @@
 
 #include <model/include/ModelTransformer.h>
 
+#include <nodes/include/ConstantNode.h>
 #include <nodes/include/MatrixMatrixMultiplyCodeNode.h>
 
 #include <utilities/include/ArchiveVersion.h>
@@ -217,7 +218,45 @@ namespace nodes
     }
 
     template <typename ValueType>
-    void MatrixMatrixMultiplyCodeNode<ValueType>::Gemm(value::Matrix A, value::Matrix B, value::Matrix C)
+    value::Value MatrixMatrixMultiplyCodeNode<ValueType>::GetPrepackedWeightsBuffer(int panelRows, int panelColumns, int stripeSize) const
+    {
+        // Prepacking is only valid when the B operand is an untransposed, densely-stored matrix
+        // whose contents are known at compile time
+        if (_transpose2 || _ldb != _n || panelColumns % stripeSize != 0)
+        {
+            return {};
+        }
+        auto weightsNode = dynamic_cast<const ConstantNode<ValueType>*>(_input2.GetReferencedPort().GetNode());
+        if (weightsNode == nullptr)
+        {
+            return {};
+        }
+        const auto& weights = weightsNode->GetValues();
+        if (static_cast<int>(weights.size()) != _k * _n)
+        {
+            return {};
+        }
+
+        // Lay the weights out panel-by-panel in the packed stripe order that PrepackedBLASTCopy
+        // expects, zero-padding boundary panels to the full panel size:
+        //     B ( k, j ) -> packed ( k / panelRows, j / panelColumns, (j % panelColumns) / stripeSize, k % panelRows, j % stripeSize )
+        int rowPanels = (_k + panelRows - 1) / panelRows;
+        int columnPanels = (_n + panelColumns - 1) / panelColumns;
+        utilities::MemoryLayout packedLayout{ utilities::MemoryShape{ rowPanels, columnPanels, panelColumns / stripeSize, panelRows, stripeSize } };
+        std::vector<ValueType> packedWeights(packedLayout.GetMemorySize(), static_cast<ValueType>(0));
+        for (int k = 0; k < _k; ++k)
+        {
+            for (int j = 0; j < _n; ++j)
+            {
+                auto offset = packedLayout.GetEntryOffset({ k / panelRows, j / panelColumns, (j % panelColumns) / stripeSize, k % panelRows, j % stripeSize });
+                packedWeights[offset] = weights[k * _n + j];
+            }
+        }
+        return StaticAllocate(UniqueName("PrepackedWeights"), packedWeights, packedLayout);
+    }
+
+    template <typename ValueType>
+    void MatrixMatrixMultiplyCodeNode<ValueType>::Gemm(value::Matrix A, value::Matrix B, value::Matrix C, int numThreads)
     {
         using namespace value;
 
@@ -275,21 +314,59 @@ namespace nodes
         auto kBlock = schedule.Split(k, kUnroll);
         auto jKernelOuter2 = schedule.Split(j, NumColumnsInKernel);
         auto jKernelOuter = schedule.Split(j, vectorSize);
+
+        // When multi-threading, partition the rows into one contiguous chunk of kernel blocks per
+        // thread, and hand the chunks to the schedule's Parallelize directive. The chunk split sits
+        // inside kCache, so the (shared) B cache is filled before the tasks fan out; the C kernel
+        // cache is thread-local (see ZeroInputReduceOutput), so the tasks don't share any cache buffers.
+        const bool parallelizeRows = numThreads > 1 && OutputRows >= 2 * NumRowsInKernel;
+        Index iThread;
+        if (parallelizeRows)
+        {
+            const int rowBlocks = (OutputRows + NumRowsInKernel - 1) / NumRowsInKernel;
+            const int blocksPerThread = (rowBlocks + numThreads - 1) / numThreads;
+            iThread = schedule.Split(i, blocksPerThread * NumRowsInKernel);
+        }
         auto iKernelOuter = schedule.Split(i, NumRowsInKernel);
 
         // Set the order
-        schedule.SetOrder({ jCache, kCache, iKernelOuter, jKernelOuter2, kBlock, k, i, jKernelOuter, j });
+        if (parallelizeRows)
+        {
+            schedule.SetOrder({ jCache, kCache, iThread, iKernelOuter, jKernelOuter2, kBlock, k, i, jKernelOuter, j });
+            schedule.Parallelize(iThread);
+        }
+        else
+        {
+            schedule.SetOrder({ jCache, kCache, iKernelOuter, jKernelOuter2, kBlock, k, i, jKernelOuter, j });
+        }
 
-        // Set up caching    
+        // Set up caching
         if ((OutputColumns > NumColumnsInKernel) && ((OutputColumns % NumColumnsInKernel) == 0))
         {
-            auto extraCacheBParams = std::make_tuple(NumColumnsInKernel, jKernelOuter2, BoundaryConditionHandling::ZeroPadding);
-            schedule.template Cache<BLASTCopy>(B,
-                                    { topLevelK, topLevelJ },
-                                    { innerDimensionBlock, columnBlock },
-                                    { kCache, jCache },
-                                    std::nullopt, // Order isn't used by BLASTCopy
-                                    extraCacheBParams);
+            // If this GEMM consumes the full B matrix and its contents are known at compile time
+            // (e.g. it holds the weights of a fully-connected layer), pack it into the cache layout
+            // now so the emitted code skips the runtime cache fill pass entirely
+            auto prepackedB = (OutputColumns == _n && InnerDimension == _k) ? GetPrepackedWeightsBuffer(innerDimensionBlock, columnBlock, NumColumnsInKernel) : Value{};
+            if (prepackedB.IsDefined())
+            {
+                auto extraPrepackedCacheBParams = std::make_tuple(NumColumnsInKernel, jKernelOuter2, prepackedB);
+                schedule.template Cache<PrepackedBLASTCopy>(B,
+                                        { topLevelK, topLevelJ },
+                                        { innerDimensionBlock, columnBlock },
+                                        { kCache, jCache },
+                                        std::nullopt, // Order isn't used by PrepackedBLASTCopy
+                                        extraPrepackedCacheBParams);
+            }
+            else
+            {
+                auto extraCacheBParams = std::make_tuple(NumColumnsInKernel, jKernelOuter2, BoundaryConditionHandling::ZeroPadding);
+                schedule.template Cache<BLASTCopy>(B,
+                                        { topLevelK, topLevelJ },
+                                        { innerDimensionBlock, columnBlock },
+                                        { kCache, jCache },
+                                        std::nullopt, // Order isn't used by BLASTCopy
+                                        extraCacheBParams);
+            }
         }
         auto extraZeroInputReduceOutputParams = std::make_tuple(vectorSize);
         schedule.template Cache<ZeroInputReduceOutput>(C,
@@ -308,97 +385,6 @@ namespace nodes
         nest.Run();
     }
 
-    template <typename ValueType>
-    void MatrixMatrixMultiplyCodeNode<ValueType>::GemmFn(value::Matrix A, value::Matrix B, value::Matrix C, int thread_num)
-    {
-        value::DeclareFunction("InnerMatMul" + std::to_string(thread_num))
-            .Parameters(A, B, C)
-            .Define([this](value::Matrix A, value::Matrix B, value::Matrix C) {
-                Gemm(A, B, C);
-            })(A, B, C);
-    }
-
-    template <typename ValueType>
-    void MatrixMatrixMultiplyCodeNode<ValueType>::ParallelizeGemmCol(Matrix A, Matrix B, Matrix C, int numThreads)
-    {    
-        const int columns = B.Columns() / numThreads; 
-        const int col_spill = B.Columns() % numThreads;
-
-        Parallelize(
-            numThreads,
-            std::tuple{ A, B, C },
-            [=](value::Scalar id, value::Matrix A, value::Matrix B, value::Matrix C) 
-            {
-                value::Scalar colStart = id * value::Scalar{columns};
-                int thread_seq = 0;
-
-                EmitterContext::IfContext IfCxt = If(id == thread_seq,
-                [&] {
-                        GemmFn(
-                            A,
-                            B.SubMatrix(value::Scalar{0}, colStart, (int)B.Rows(), columns),
-                            C.SubMatrix(value::Scalar{0}, colStart, (int)C.Rows(), columns),
-                            thread_seq);
-                });
-                
-                thread_seq++;
-
-                for(int i = thread_seq; i < numThreads; i++)
-                {
-                    IfCxt.ElseIf(id == i,
-                    [&] {
-                            int actualColumns = i==(numThreads-1) ? columns + col_spill : columns;
-                            
-                            GemmFn(
-                                A,
-                                B.SubMatrix(value::Scalar{0}, colStart, (int)B.Rows(), actualColumns),
-                                C.SubMatrix(value::Scalar{0}, colStart, (int)C.Rows(), actualColumns),
-                                i);
-                    });
-                }
-            }); 
-    }
-
-    template <typename ValueType>
-    void MatrixMatrixMultiplyCodeNode<ValueType>::ParallelizeGemmRow(Matrix A, Matrix B, Matrix C, int numThreads)
-    {    
-        const int rows = A.Rows() / numThreads;
-        const int row_spill = A.Rows() % numThreads;
-
-        Parallelize(
-            numThreads,
-            std::tuple{ A, B, C },
-            [=](value::Scalar id, value::Matrix A, value::Matrix B, value::Matrix C) 
-            {
-                value::Scalar rowStart = id * value::Scalar{rows};
-                int thread_seq = 0;
-
-                EmitterContext::IfContext IfCxt = If(id == thread_seq,
-                [&] {
-                        GemmFn(
-                            A.SubMatrix(rowStart, value::Scalar{0}, rows, (int)A.Columns()),
-                            B,
-                            C.SubMatrix(rowStart, value::Scalar{0}, rows, (int)C.Columns()),
-                            thread_seq);
-                });
-                
-                thread_seq++;
-
-                for(int i = thread_seq; i < numThreads; i++)
-                {
-                    IfCxt.ElseIf(id == i,
-                    [&] {
-                            int actualRows = i==(numThreads-1) ? rows + row_spill : rows;
-                            GemmFn(
-                                A.SubMatrix(rowStart, value::Scalar{0}, actualRows, (int)A.Columns()),
-                                B,
-                                C.SubMatrix(rowStart, value::Scalar{0}, actualRows, (int)C.Columns()),
-                                i);
-                    });
-                }
-        }); 
-    }
-
     template <typename ValueType>
     void MatrixMatrixMultiplyCodeNode<ValueType>::ELLCodeGEMM(const value::Matrix matA, const value::Matrix matB, value::Matrix matC)
     {
@@ -412,21 +398,10 @@ namespace nodes
         {
             numThreads = std::min(int(computationSize / double(minThreadLoad)) + 1, int(maxThreads));
         }
-        if (numThreads > 1)
-        {
-            if (matC.Rows() > matC.Columns())
-            {
-                ParallelizeGemmRow(matA, matB, matC, int(numThreads));
-            }
-            else
-            {
-                ParallelizeGemmCol(matA, matB, matC, int(numThreads));
-            }
-        }
-        else
-        {
-            Gemm(matA, matB, matC);
-        }
+        // Gemm parallelizes across row chunks through the schedule's Parallelize directive,
+        // which falls back to a sequential loop when parallelization is disabled in the
+        // compiler settings (or when there's only one chunk)
+        Gemm(matA, matB, matC, int(numThreads));
     }
 
     template <typename ValueType>
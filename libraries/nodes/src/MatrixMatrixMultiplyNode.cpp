@@ -22,74 +22,30 @@ namespace nodes
         //
         constexpr utilities::ArchiveVersion currentArchiveVersion = { utilities::ArchiveVersionNumbers::v2 };
 
+        math::MatrixTranspose TransposeFlag(bool transpose)
+        {
+            return transpose ? math::MatrixTranspose::transpose : math::MatrixTranspose::noTranspose;
+        }
+
         template <typename ValueType>
         void MatrixMatrixMultiply(bool transposeA, bool transposeB, bool transposeC, int m, int n, int k, const std::vector<ValueType>& matrixAValues, const std::vector<ValueType>& matrixBValues, std::vector<ValueType>& matrixCValues)
         {
+            // The input buffers are row-major; when an operand is flagged as transposed, its buffer
+            // holds the transpose of the logical operand, so the transpose flag passed to the multiply
+            // is flipped accordingly. No operand is ever copied.
+            math::ConstRowMatrixReference<ValueType> A(matrixAValues.data(), transposeA ? k : m, transposeA ? m : k);
+            math::ConstRowMatrixReference<ValueType> B(matrixBValues.data(), transposeB ? n : k, transposeB ? k : n);
+
             if (transposeC)
             {
                 // C' = B' * A'
                 math::RowMatrixReference<ValueType> Ct(matrixCValues.data(), n, m);
-
-                if (transposeA)
-                {
-                    math::ConstRowMatrixReference<ValueType> At(matrixAValues.data(), k, m);
-                    if (transposeB)
-                    {
-                        math::ConstRowMatrixReference<ValueType> Bt(matrixBValues.data(), n, k);
-                        math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), Bt, At, static_cast<ValueType>(0.0), Ct);
-                    }
-                    else
-                    {
-                        math::ConstColumnMatrixReference<ValueType> Bt(matrixBValues.data(), n, k);
-                        math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), Bt, At, static_cast<ValueType>(0.0), Ct);
-                    }
-                }
-                else
-                {
-                    math::ConstColumnMatrixReference<ValueType> At(matrixAValues.data(), k, m);
-                    if (transposeB)
-                    {
-                        math::ConstRowMatrixReference<ValueType> Bt(matrixBValues.data(), n, k);
-                        math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), Bt, At, static_cast<ValueType>(0.0), Ct);
-                    }
-                    else
-                    {
-                        math::ConstColumnMatrixReference<ValueType> Bt(matrixBValues.data(), n, k);
-                        math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), Bt, At, static_cast<ValueType>(0.0), Ct);
-                    }
-                }
+                math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), TransposeFlag(!transposeB), B, TransposeFlag(!transposeA), A, static_cast<ValueType>(0.0), Ct);
             }
-            else // not transposeC
+            else
             {
                 math::RowMatrixReference<ValueType> C(matrixCValues.data(), m, n);
-                if (transposeA)
-                {
-                    math::ConstColumnMatrixReference<ValueType> A(matrixAValues.data(), m, k);
-                    if (transposeB)
-                    {
-                        math::ConstColumnMatrixReference<ValueType> B(matrixBValues.data(), k, n);
-                        math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), A, B, static_cast<ValueType>(0.0), C);
-                    }
-                    else // not transposeB
-                    {
-                        math::ConstRowMatrixReference<ValueType> B(matrixBValues.data(), k, n);
-                        math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), A, B, static_cast<ValueType>(0.0), C);
-                    }
-                }
-                else // not transposeA
-                {
-                    math::ConstRowMatrixReference<ValueType> A(matrixAValues.data(), m, k);
-                    if (transposeB)
-                    {
-                        math::ConstColumnMatrixReference<ValueType> B(matrixBValues.data(), k, n);
-                        math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), A, B, static_cast<ValueType>(0.0), C);
-                    }
-                    else // not transposeB
-                    {
-                        math::ConstRowMatrixReference<ValueType> B(matrixBValues.data(), k, n);
-                        math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), A, B, static_cast<ValueType>(0.0), C);
-                    }
-                }
+                math::MultiplyScaleAddUpdate(static_cast<ValueType>(1.0), TransposeFlag(transposeA), A, TransposeFlag(transposeB), B, static_cast<ValueType>(0.0), C);
             }
         }
     } // namespace
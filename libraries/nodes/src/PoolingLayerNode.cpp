@@ -9,6 +9,8 @@
 #include "PoolingLayerNode.h"
 #include "ConstantNode.h"
 
+#include <emitters/include/IRVectorUtilities.h>
+
 #include <predictors/neural/include/MaxPoolingFunction.h>
 #include <predictors/neural/include/MeanPoolingFunction.h>
 
@@ -71,6 +73,73 @@ namespace nodes
             }
             return result;
         }
+
+        // Computes a pooling window that fully overlaps the input for `vectorSize` contiguous channels
+        // at once, using SIMD operations along the channel (minor) dimension. The window taps are
+        // unrolled at compile time and combined with a pairwise reduction tree to keep the dependency
+        // chain short --- for the ubiquitous 2x2-stride-2 case this produces the classic
+        // 4-load / 3-op form.
+        template <typename ValueType>
+        emitters::LLVMValue GetVectorPoolingWindowValue(emitters::IRFunctionEmitter& function,
+                                                        bool isMaxPooling,
+                                                        int windowRowBegin,
+                                                        int windowRowEnd,
+                                                        int windowColumnBegin,
+                                                        int windowColumnEnd,
+                                                        emitters::IRLocalScalar inputRow,
+                                                        emitters::IRLocalScalar inputColumn,
+                                                        emitters::IRLocalScalar inputChannel,
+                                                        emitters::LLVMValue inputBuffer,
+                                                        const model::MemoryShape& inputIncrement,
+                                                        llvm::VectorType* vectorType)
+        {
+            auto vectorPointerType = vectorType->getPointerTo();
+
+            // Load one vector of channel values per window tap (the channel dimension is contiguous)
+            std::vector<emitters::LLVMValue> tapValues;
+            for (int poolingRow = windowRowBegin; poolingRow < windowRowEnd; ++poolingRow)
+            {
+                for (int poolingColumn = windowColumnBegin; poolingColumn < windowColumnEnd; ++poolingColumn)
+                {
+                    auto poolingInputRow = inputRow + function.LocalScalar<int>(poolingRow);
+                    auto poolingInputColumn = inputColumn + function.LocalScalar<int>(poolingColumn);
+                    auto inputIndex = (poolingInputRow * function.LocalScalar<int>(inputIncrement[0])) + (poolingInputColumn * function.LocalScalar<int>(inputIncrement[1])) + inputChannel;
+                    auto tapPointer = function.CastPointer(function.PointerOffset(inputBuffer, inputIndex), vectorPointerType);
+                    tapValues.push_back(function.ValueAt(tapPointer, 0));
+                }
+            }
+
+            // Reduce the taps pairwise
+            while (tapValues.size() > 1)
+            {
+                std::vector<emitters::LLVMValue> reducedValues;
+                for (size_t index = 0; index + 1 < tapValues.size(); index += 2)
+                {
+                    if (isMaxPooling)
+                    {
+                        reducedValues.push_back(emitters::VectorMax<ValueType>(function, tapValues[index], tapValues[index + 1]));
+                    }
+                    else
+                    {
+                        reducedValues.push_back(function.Operator(emitters::GetAddForValueType<ValueType>(), tapValues[index], tapValues[index + 1]));
+                    }
+                }
+                if (tapValues.size() % 2 != 0)
+                {
+                    reducedValues.push_back(tapValues.back());
+                }
+                tapValues = std::move(reducedValues);
+            }
+
+            auto result = tapValues[0];
+            if (!isMaxPooling)
+            {
+                // Mean pooling: divide by the (static) number of cells in the full window
+                int numCells = (windowRowEnd - windowRowBegin) * (windowColumnEnd - windowColumnBegin);
+                result = function.Operator(emitters::TypedOperator::divideFloat, result, emitters::FillVector<ValueType>(function, vectorType, static_cast<ValueType>(numCells)));
+            }
+            return result;
+        }
     } // end anonymous namespace
 
     //
@@ -447,6 +516,15 @@ namespace nodes
         auto paddingValue = ell::predictors::neural::GetPaddingValue<ValueType>(this->GetLayer().GetLayerParameters().inputPaddingParameters.paddingScheme);
         FType poolingFunction{ function, windowSize * windowSize, paddingValue }; // Create the pooling function with a 'full' pooling window.
 
+        // When vector instructions are enabled, windows that fully overlap the input are pooled with
+        // SIMD max/add operations over the contiguous channel dimension, `vectorSize` channels at a time.
+        // Partial-overlap windows (the padding border) and any leftover channels use the scalar path.
+        const bool isMaxPooling = IsMaxPoolingFunction(poolingFunction);
+        const int vectorSize = function.GetCompilerOptions().vectorWidth;
+        const bool useVectorInstructions = function.GetCompilerOptions().allowVectorInstructions && (outputDepth >= vectorSize);
+        auto vectorType = function.GetEmitter().VectorType(emitters::GetVariableType<ValueType>(), vectorSize);
+        auto vectorPointerType = vectorType->getPointerTo();
+
         // These "window extent" variables indicate the amount that the pooling window extends to the left and right (or top/bottom) of the center pixel.
         //   posWindowExtent is always floor(windowSize/2)
         //   If the pooling window size is odd, negWindowExtent == -posWindowExtent,
@@ -482,6 +560,9 @@ namespace nodes
 
                 if (maxOutputRow > minOutputRow && maxOutputCol > minOutputCol)
                 {
+                    const int numWindowCells = (rowRegionBounds.windowBounds.end - rowRegionBounds.windowBounds.begin) * (columnRegionBounds.windowBounds.end - columnRegionBounds.windowBounds.begin);
+                    const bool hasFullWindow = (numWindowCells == windowSize * windowSize);
+                    const int numVectorChannels = (useVectorInstructions && hasFullWindow) ? (outputDepth / vectorSize) * vectorSize : 0;
                     // BUG: explicit by-ref captures of `usesPadding` and `negWindowExtent` are here to work around a GCC bug
                     function.For(minOutputRow, maxOutputRow, 1, [=, &outputIncrement, &usesPadding, &negWindowExtent, &poolingFunction](emitters::IRFunctionEmitter& function, emitters::LLVMValue loopIndex1) {
                         auto outputRow = function.LocalScalar(loopIndex1);
@@ -499,16 +580,33 @@ namespace nodes
                                 inputColumn = inputColumn + function.LocalScalar<int>(-negWindowExtent);
                             }
 
-                            function.For(outputDepth, [=, &outputIncrement, &poolingFunction, &inputRow, &inputColumn](emitters::IRFunctionEmitter& function, emitters::LLVMValue loopIndex3) {
-                                auto channel = function.LocalScalar(loopIndex3);
-                                // Get the pooled value
-                                auto pooledValue = GetPoolingWindowValue(function, rowRegionBounds.windowBounds.begin, rowRegionBounds.windowBounds.end, columnRegionBounds.windowBounds.begin, columnRegionBounds.windowBounds.end, inputRow, inputColumn, channel, inputBuffer, inputIncrement, poolingFunction);
-                                // and store it in the output
-                                auto outputIndex = (outputRow * function.LocalScalar<int>(outputIncrement[0])) +
-                                                   (outputColumn * function.LocalScalar<int>(outputIncrement[1])) +
-                                                   channel;
-                                function.SetValueAt(outputBuffer, outputIndex, pooledValue);
-                            });
+                            if (numVectorChannels > 0)
+                            {
+                                function.For(0, numVectorChannels, vectorSize, [=, &outputIncrement, &inputRow, &inputColumn](emitters::IRFunctionEmitter& function, emitters::LLVMValue loopIndex3) {
+                                    auto channel = function.LocalScalar(loopIndex3);
+                                    // Get the pooled values for a whole vector of channels
+                                    auto pooledValue = GetVectorPoolingWindowValue<ValueType>(function, isMaxPooling, rowRegionBounds.windowBounds.begin, rowRegionBounds.windowBounds.end, columnRegionBounds.windowBounds.begin, columnRegionBounds.windowBounds.end, inputRow, inputColumn, channel, inputBuffer, inputIncrement, vectorType);
+                                    // and store them in the output
+                                    auto outputIndex = (outputRow * function.LocalScalar<int>(outputIncrement[0])) +
+                                                       (outputColumn * function.LocalScalar<int>(outputIncrement[1])) +
+                                                       channel;
+                                    auto outputPointer = function.CastPointer(function.PointerOffset(outputBuffer, outputIndex), vectorPointerType);
+                                    function.SetValueAt(outputPointer, 0, pooledValue);
+                                });
+                            }
+                            if (numVectorChannels < outputDepth)
+                            {
+                                function.For(numVectorChannels, outputDepth, 1, [=, &outputIncrement, &poolingFunction, &inputRow, &inputColumn](emitters::IRFunctionEmitter& function, emitters::LLVMValue loopIndex3) {
+                                    auto channel = function.LocalScalar(loopIndex3);
+                                    // Get the pooled value
+                                    auto pooledValue = GetPoolingWindowValue(function, rowRegionBounds.windowBounds.begin, rowRegionBounds.windowBounds.end, columnRegionBounds.windowBounds.begin, columnRegionBounds.windowBounds.end, inputRow, inputColumn, channel, inputBuffer, inputIncrement, poolingFunction);
+                                    // and store it in the output
+                                    auto outputIndex = (outputRow * function.LocalScalar<int>(outputIncrement[0])) +
+                                                       (outputColumn * function.LocalScalar<int>(outputIncrement[1])) +
+                                                       channel;
+                                    function.SetValueAt(outputBuffer, outputIndex, pooledValue);
+                                });
+                            }
                         });
                     });
                 }
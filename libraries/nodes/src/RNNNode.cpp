@@ -126,16 +126,10 @@ namespace nodes
         auto alpha = static_cast<ValueType>(1); // GEMV scale multiplication
         auto beta = static_cast<ValueType>(1); // GEMV scale bias
 
-        // W_i * x + b_i
+        // W_{ ii } x + b_{ ii } + W_{ hi } h + b_{ hi }, with both weight products fused into one pass
         VectorType input_gate(inputBias); // add input bias
-        math::MultiplyScaleAddUpdate(alpha, inputWeights, inputVector, beta, input_gate);
-
-        // Wh * h + b_h
-        VectorType hidden_gate(hiddenBias); // add hidden bias
-        math::MultiplyScaleAddUpdate(alpha, hiddenWeights, this->_hiddenState, beta, hidden_gate);
-
-        // compute: W_{ ii } x + b_{ ii } +W_{ hi } h + b_{ hi }
-        input_gate += hidden_gate;
+        input_gate += hiddenBias; // add hidden bias
+        math::MultiplyScaleAddUpdate(alpha, inputWeights, inputVector, hiddenWeights, this->_hiddenState, beta, input_gate);
 
         // tanh(...)
         this->_activation.Apply(input_gate);
@@ -228,6 +222,7 @@ namespace nodes
         emitters::IRModuleEmitter& module = function.GetModule();
         auto hiddenStateVariable = module.Variables().AddVectorVariable<ValueType>(emitters::VariableScope::global, hiddenUnits);
         auto hiddenStateValue = module.EnsureEmitted(*hiddenStateVariable);
+        module.RegisterModelStateVariable(hiddenStateValue);
         auto hiddenStatePointer = function.PointerOffset(hiddenStateValue, 0); // convert "global variable" to a pointer
         auto hiddenState = function.LocalArray(hiddenStatePointer);
         auto& prevHiddenState = hiddenState;
@@ -280,6 +275,7 @@ namespace nodes
         emitters::IRModuleEmitter& module = function.GetModule();
         auto resetTrigger = compiler.EnsurePortEmitted(this->resetTrigger);
         auto lastSignal = module.Global<int>(compiler.GetGlobalName(*this, "lastSignal"), 0);
+        module.RegisterModelStateVariable(lastSignal);
         auto lastSignalValue = function.LocalScalar(function.Load(lastSignal));
         auto resetTriggerValue = function.LocalScalar(function.CastValue<int>(function.Load(resetTrigger)));
         function.If((resetTriggerValue == 0) && (lastSignalValue != 0), [resetFunctionName](emitters::IRFunctionEmitter& fn) {
@@ -10,6 +10,8 @@
 #include "BroadcastFunctionNode.h"
 #include "ConstantNode.h"
 
+#include <emitters/include/IRVectorUtilities.h>
+
 namespace ell
 {
 namespace nodes
@@ -127,6 +129,15 @@ namespace nodes
     template <typename ValueType>
     void SoftmaxLayerNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
     {
+        auto inputLayout = this->GetInputMemoryLayout();
+        auto outputLayout = this->GetOutputMemoryLayout();
+        if (inputLayout.IsCanonicalOrder() && !inputLayout.HasPadding() && outputLayout.IsCanonicalOrder() && !outputLayout.HasPadding())
+        {
+            // The logits are stored contiguously, so the passes can run over the flat buffers
+            CompileFusedLoops(compiler, function);
+            return;
+        }
+
         emitters::LLVMValue pInput = compiler.EnsurePortEmitted(input);
         emitters::LLVMValue pOutput = compiler.EnsurePortEmitted(output);
 
@@ -148,6 +159,94 @@ namespace nodes
         EmitComputeDimensionLoop(compiler, function, 0, this->GetOutputMemoryLayout(), pOutput, prevOutputDimensionOffset, normalizeOutput);
     }
 
+    template <typename ValueType>
+    void SoftmaxLayerNode<ValueType>::CompileFusedLoops(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        const int size = static_cast<int>(this->GetInputMemoryLayout().NumElements());
+        const int vectorSize = function.GetCompilerOptions().vectorWidth;
+        const bool vectorize = function.GetCompilerOptions().allowVectorInstructions && (size > 2 * vectorSize);
+        const int numFullBlocks = vectorize ? size / vectorSize : 0;
+        const int numVectorElements = numFullBlocks * vectorSize;
+
+        emitters::LLVMValue pInput = compiler.EnsurePortEmitted(input);
+        emitters::LLVMValue pOutput = compiler.EnsurePortEmitted(output);
+
+        auto valueType = emitters::GetVariableType<ValueType>();
+        auto vectorType = function.GetEmitter().VectorType(valueType, vectorSize);
+        auto vectorPointerType = vectorType->getPointerTo();
+
+        // Pass 1: max-reduce over the logits
+        auto maxValueVar = function.Variable(valueType, "softmaxMaxValue");
+        function.Store(maxValueVar, function.Literal(-(std::numeric_limits<ValueType>::max())));
+        if (vectorize)
+        {
+            auto inputVector = function.CastPointer(pInput, vectorPointerType);
+            auto vectorMaxVar = function.Variable(vectorType, "vecMaxAccum");
+            function.Store(vectorMaxVar, emitters::FillVector<ValueType>(function, vectorType, -(std::numeric_limits<ValueType>::max())));
+            function.For(numFullBlocks, [inputVector, vectorMaxVar](emitters::IRFunctionEmitter& function, auto blockIndex) {
+                auto value = function.ValueAt(inputVector, blockIndex);
+                function.Store(vectorMaxVar, emitters::VectorMax<ValueType>(function, function.Load(vectorMaxVar), value));
+            });
+            function.Store(maxValueVar, emitters::HorizontalVectorMax<ValueType>(function, function.Load(vectorMaxVar)));
+        }
+        if (numVectorElements < size)
+        {
+            function.For(numVectorElements, size, [pInput, maxValueVar](emitters::IRFunctionEmitter& function, auto i) {
+                auto value = function.LocalScalar(function.ValueAt(pInput, i));
+                auto currentMax = function.LocalScalar(function.Load(maxValueVar));
+                function.Store(maxValueVar, function.Select(value > currentMax, value, currentMax));
+            });
+        }
+        auto maxValue = function.Load(maxValueVar);
+
+        // Pass 2: compute exp(x - max) and accumulate the sum in the same pass
+        auto sumValueVar = function.Variable(valueType, "softmaxSumValue");
+        function.StoreZero(sumValueVar);
+        if (vectorize)
+        {
+            auto inputVector = function.CastPointer(pInput, vectorPointerType);
+            auto outputVector = function.CastPointer(pOutput, vectorPointerType);
+            auto maxVector = function.GetEmitter().GetIRBuilder().CreateVectorSplat(vectorSize, maxValue);
+            auto vectorSumVar = function.Variable(vectorType, "vecSumAccum");
+            function.Store(vectorSumVar, emitters::FillVector<ValueType>(function, vectorType, 0));
+            function.For(numFullBlocks, [inputVector, outputVector, maxVector, vectorSumVar](emitters::IRFunctionEmitter& function, auto blockIndex) {
+                auto shiftedValue = function.Operator(emitters::TypedOperator::subtractFloat, function.ValueAt(inputVector, blockIndex), maxVector);
+                auto eulerValue = emitters::VectorExp<ValueType>(function, shiftedValue);
+                function.SetValueAt(outputVector, blockIndex, eulerValue);
+                function.Store(vectorSumVar, function.Operator(emitters::TypedOperator::addFloat, function.Load(vectorSumVar), eulerValue));
+            });
+            function.Store(sumValueVar, emitters::HorizontalVectorSum<ValueType>(function, function.Load(vectorSumVar)));
+        }
+        if (numVectorElements < size)
+        {
+            function.For(numVectorElements, size, [pInput, pOutput, sumValueVar, maxValue](emitters::IRFunctionEmitter& function, auto i) {
+                auto shiftedValue = function.Operator(emitters::TypedOperator::subtractFloat, function.ValueAt(pInput, i), maxValue);
+                auto eulerValue = emitters::VectorExp<ValueType>(function, shiftedValue);
+                function.SetValueAt(pOutput, i, eulerValue);
+                function.OperationAndUpdate(sumValueVar, emitters::TypedOperator::addFloat, eulerValue);
+            });
+        }
+
+        // Pass 3: normalize by the reciprocal of the sum -- one divide instead of one per element
+        auto scale = function.Operator(emitters::TypedOperator::divideFloat, function.Literal(static_cast<ValueType>(1)), function.Load(sumValueVar));
+        if (vectorize)
+        {
+            auto outputVector = function.CastPointer(pOutput, vectorPointerType);
+            auto scaleVector = function.GetEmitter().GetIRBuilder().CreateVectorSplat(vectorSize, scale);
+            function.For(numFullBlocks, [outputVector, scaleVector](emitters::IRFunctionEmitter& function, auto blockIndex) {
+                auto value = function.ValueAt(outputVector, blockIndex);
+                function.SetValueAt(outputVector, blockIndex, function.Operator(emitters::GetMultiplyForValueType<ValueType>(), value, scaleVector));
+            });
+        }
+        if (numVectorElements < size)
+        {
+            function.For(numVectorElements, size, [pOutput, scale](emitters::IRFunctionEmitter& function, auto i) {
+                auto value = function.ValueAt(pOutput, i);
+                function.SetValueAt(pOutput, i, function.Operator(emitters::GetMultiplyForValueType<ValueType>(), value, scale));
+            });
+        }
+    }
+
     template <typename ValueType>
     template <typename FunctionType>
     void SoftmaxLayerNode<ValueType>::EmitComputeDimensionLoop(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function, size_t dimension, const model::PortMemoryLayout& inputLayout, const model::PortMemoryLayout& outputLayout, emitters::LLVMValue pInput, emitters::LLVMValue pOutput, emitters::LLVMValue prevInputDimensionOffset, emitters::LLVMValue prevOutputDimensionOffset, FunctionType& f) const
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrixVectorMultiplyNode.cpp (nodes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SparseMatrixVectorMultiplyNode.h"
+
+#include <emitters/include/EmitterTypes.h>
+#include <emitters/include/IRLocalValue.h>
+
+#include <utilities/include/Exception.h>
+
+namespace ell
+{
+namespace nodes
+{
+    template <typename ValueType>
+    SparseMatrixVectorMultiplyNode<ValueType>::SparseMatrixVectorMultiplyNode() :
+        CompilableNode({ &_input }, { &_output }),
+        _input(this, {}, defaultInputPortName),
+        _output(this, defaultOutputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    SparseMatrixVectorMultiplyNode<ValueType>::SparseMatrixVectorMultiplyNode(const model::OutputPort<ValueType>& input, const std::vector<ValueType>& matrixValues, size_t numRows, size_t numColumns) :
+        CompilableNode({ &_input }, { &_output }),
+        _input(this, input, defaultInputPortName),
+        _output(this, defaultOutputPortName, numRows),
+        _numColumns(numColumns)
+    {
+        if (input.Size() != numColumns)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Input size must match the number of matrix columns");
+        }
+        if (matrixValues.size() != numRows * numColumns)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Matrix size must equal numRows x numColumns");
+        }
+
+        // Compress to CSR, eliding entries that are exactly zero
+        _rowOffsets.reserve(numRows + 1);
+        _rowOffsets.push_back(0);
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            const ValueType* rowValues = matrixValues.data() + row * numColumns;
+            for (size_t column = 0; column < numColumns; ++column)
+            {
+                if (rowValues[column] != 0)
+                {
+                    _columnIndices.push_back(static_cast<int>(column));
+                    _values.push_back(rowValues[column]);
+                }
+            }
+            _rowOffsets.push_back(static_cast<int>(_values.size()));
+        }
+    }
+
+    template <typename ValueType>
+    SparseMatrixVectorMultiplyNode<ValueType>::SparseMatrixVectorMultiplyNode(const model::OutputPort<ValueType>& input, std::vector<int> rowOffsets, std::vector<int> columnIndices, std::vector<ValueType> values, size_t numColumns) :
+        CompilableNode({ &_input }, { &_output }),
+        _input(this, input, defaultInputPortName),
+        _output(this, defaultOutputPortName, rowOffsets.empty() ? 0 : rowOffsets.size() - 1),
+        _rowOffsets(std::move(rowOffsets)),
+        _columnIndices(std::move(columnIndices)),
+        _values(std::move(values)),
+        _numColumns(numColumns)
+    {
+        if (input.Size() != numColumns)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Input size must match the number of matrix columns");
+        }
+        if (_rowOffsets.empty() || _rowOffsets.back() != static_cast<int>(_values.size()) || _columnIndices.size() != _values.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Malformed CSR matrix");
+        }
+    }
+
+    template <typename ValueType>
+    void SparseMatrixVectorMultiplyNode<ValueType>::Compute() const
+    {
+        auto inputValues = _input.GetValue();
+        const int numRows = static_cast<int>(_output.Size());
+        std::vector<ValueType> result(numRows);
+        for (int row = 0; row < numRows; ++row)
+        {
+            ValueType sum = 0;
+            for (int index = _rowOffsets[row]; index < _rowOffsets[row + 1]; ++index)
+            {
+                sum += _values[index] * inputValues[_columnIndices[index]];
+            }
+            result[row] = sum;
+        }
+        _output.SetOutput(result);
+    };
+
+    template <typename ValueType>
+    void SparseMatrixVectorMultiplyNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        const auto& newInputs = transformer.GetCorrespondingInputs(_input);
+        auto newNode = transformer.AddNode<SparseMatrixVectorMultiplyNode<ValueType>>(newInputs, _rowOffsets, _columnIndices, _values, _numColumns);
+        transformer.MapNodeOutput(output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void SparseMatrixVectorMultiplyNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        auto& module = function.GetModule();
+        const int numRows = static_cast<int>(output.Size());
+
+        // Emit the compressed matrix as constant data
+        llvm::GlobalVariable* rowOffsets = module.ConstantArray(compiler.GetGlobalName(*this, "rowOffsets"), _rowOffsets);
+        llvm::GlobalVariable* columnIndices = module.ConstantArray(compiler.GetGlobalName(*this, "columnIndices"), _columnIndices);
+        llvm::GlobalVariable* values = module.ConstantArray(compiler.GetGlobalName(*this, "values"), _values);
+
+        // Get input and output
+        emitters::LLVMValue pInput = compiler.EnsurePortEmitted(input);
+        emitters::LLVMValue pOutput = compiler.EnsurePortEmitted(output);
+
+        emitters::LLVMValue accumulatorVar = function.Variable(emitters::GetVariableType<ValueType>(), "accumulator");
+
+        // Loop over rows, with the inner loop walking only that row's nonzeros
+        function.For(numRows, [=](emitters::IRFunctionEmitter& function, emitters::LLVMValue rowVar) {
+            auto row = function.LocalScalar(rowVar);
+            function.StoreZero(accumulatorVar);
+            auto begin = function.ValueAt(rowOffsets, row);
+            auto end = function.ValueAt(rowOffsets, row + 1);
+            function.For(begin, end, [=](emitters::IRFunctionEmitter& function, emitters::LLVMValue indexVar) {
+                auto index = function.LocalScalar(indexVar);
+                auto column = function.LocalScalar(function.ValueAt(columnIndices, index));
+                auto product = function.LocalScalar(function.ValueAt(values, index)) * function.LocalScalar(function.ValueAt(pInput, column));
+                function.Store(accumulatorVar, function.LocalScalar(function.Load(accumulatorVar)) + product);
+            });
+            function.SetValueAt(pOutput, row, function.Load(accumulatorVar));
+        });
+    }
+
+    template <typename ValueType>
+    void SparseMatrixVectorMultiplyNode<ValueType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Node::WriteToArchive(archiver);
+        archiver[defaultInputPortName] << _input;
+        archiver["rowOffsets"] << _rowOffsets;
+        archiver["columnIndices"] << _columnIndices;
+        archiver["values"] << _values;
+        archiver["numColumns"] << static_cast<int>(_numColumns);
+    }
+
+    template <typename ValueType>
+    void SparseMatrixVectorMultiplyNode<ValueType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Node::ReadFromArchive(archiver);
+        archiver[defaultInputPortName] >> _input;
+        archiver["rowOffsets"] >> _rowOffsets;
+        archiver["columnIndices"] >> _columnIndices;
+        archiver["values"] >> _values;
+        int numColumns = 0;
+        archiver["numColumns"] >> numColumns;
+        _numColumns = numColumns;
+        _output.SetSize(_rowOffsets.empty() ? 0 : _rowOffsets.size() - 1);
+    }
+
+    //
+    // Explicit instantiation definitions
+    //
+    template class SparseMatrixVectorMultiplyNode<float>;
+    template class SparseMatrixVectorMultiplyNode<double>;
+} // namespace nodes
+} // namespace ell
@@ -161,6 +161,25 @@ namespace nodes
         const auto rcdOrder = utilities::RowMajorTensorOrder;
         const auto drcOrder = utilities::ChannelMajorTensorOrder;
 
+        // 1x1 convolutions with unit stride and no padding are exactly a GEMM over the
+        // channel-minor input: the receptive field matrix is the input tensor viewed as a
+        // (rows*columns) x channels matrix, so multiply against it directly (transposed),
+        // with no receptive-field materialization or data rearrangement at all
+        if (filterSize == 1 && _stride == 1 && inputPadding == 0 && outputPadding == 0)
+        {
+            if (IsELLCodeTarget(transformer))
+            {
+                auto matrixMultNode = transformer.AddNode<MatrixMatrixMultiplyCodeNode<ValueType>>(weights, m, n, k, lda, false, newInput, k, true, ldc, true);
+                transformer.MapNodeOutput(this->output, matrixMultNode->output);
+            }
+            else
+            {
+                auto matrixMultNode = transformer.AddNode<MatrixMatrixMultiplyNode<ValueType>>(weights, m, n, k, lda, false, newInput, k, true, ldc, true);
+                transformer.MapNodeOutput(this->output, matrixMultNode->output);
+            }
+            return true;
+        }
+
         // Input data is in the canonical row-major order
         // `dataOrder` is the order the we're going to generate the receptive field matrix from
         bool useNewMethod = (_stride == 1 && inputPadding == filterSize / 2);
@@ -1093,7 +1093,8 @@ namespace nodes
                                                                 const model::PortMemoryLayout& inputMemoryLayout,
                                                                 const model::PortMemoryLayout& outputMemoryLayout,
                                                                 const ConstTensorReferenceType& filterWeights,
-                                                                int stride) :
+                                                                int stride,
+                                                                int tileSize) :
         CompilableNode({ &_input }, { &_output }),
         _input(this, input, defaultInputPortName),
         _output(this, defaultOutputPortName, outputMemoryLayout),
@@ -1102,7 +1103,7 @@ namespace nodes
     {
         using FilterOrder = typename WinogradConvolutionNode<ValueType>::FilterOrder;
 
-        _tileSize = 2;
+        _tileSize = tileSize;
         const int numFilters = outputMemoryLayout.GetLogicalDimensionActiveSize(2);
         const int numFilterChannels = static_cast<int>(filterWeights.NumChannels());
         const int filtersFirstThreshold = 4; // empirically determined
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BatchLoss.h (optimization)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Common.h"
+
+#include <math/include/Vector.h>
+
+namespace ell
+{
+namespace optimization
+{
+    /// <summary> Returns the sum of losses of a batch of scalar predictions, given the true scalar
+    /// outputs. The scalar loss is evaluated in a single tight loop, which keeps evaluation passes
+    /// over many examples out of the per-example call pattern. </summary>
+    ///
+    /// <param name="lossFunction"> The scalar loss function. </param>
+    /// <param name="predictions"> The predicted outputs. </param>
+    /// <param name="outputs"> The true outputs. </param>
+    ///
+    /// <returns> The sum of losses. </returns>
+    template <typename LossFunctionType, typename OutputType>
+    double BatchValue(const LossFunctionType& lossFunction, math::ConstRowVectorReference<double> predictions, math::ConstRowVectorReference<OutputType> outputs);
+
+    /// <summary> Returns the loss derivatives of a batch of scalar predictions, given the true
+    /// scalar outputs. </summary>
+    ///
+    /// <param name="lossFunction"> The scalar loss function. </param>
+    /// <param name="predictions"> The predicted outputs. </param>
+    /// <param name="outputs"> The true outputs. </param>
+    ///
+    /// <returns> A vector of loss derivatives. </returns>
+    template <typename LossFunctionType, typename OutputType>
+    math::RowVector<double> BatchDerivative(const LossFunctionType& lossFunction, math::ConstRowVectorReference<double> predictions, math::ConstRowVectorReference<OutputType> outputs);
+
+    /// <summary> Returns the sum of loss conjugates of a batch of scalar dual variables, given the
+    /// true scalar outputs. </summary>
+    ///
+    /// <param name="lossFunction"> The scalar loss function. </param>
+    /// <param name="duals"> The dual variables. </param>
+    /// <param name="outputs"> The true outputs. </param>
+    ///
+    /// <returns> The sum of loss conjugates. </returns>
+    template <typename LossFunctionType, typename OutputType>
+    double BatchConjugate(const LossFunctionType& lossFunction, math::ConstRowVectorReference<double> duals, math::ConstRowVectorReference<OutputType> outputs);
+} // namespace optimization
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace optimization
+{
+    template <typename LossFunctionType, typename OutputType>
+    double BatchValue(const LossFunctionType& lossFunction, math::ConstRowVectorReference<double> predictions, math::ConstRowVectorReference<OutputType> outputs)
+    {
+        DEBUG_CHECK(predictions.Size() == outputs.Size(), "predictions and outputs must have the same size");
+
+        double sum = 0;
+        for (size_t i = 0; i < predictions.Size(); ++i)
+        {
+            sum += lossFunction.Value(predictions[i], outputs[i]);
+        }
+        return sum;
+    }
+
+    template <typename LossFunctionType, typename OutputType>
+    math::RowVector<double> BatchDerivative(const LossFunctionType& lossFunction, math::ConstRowVectorReference<double> predictions, math::ConstRowVectorReference<OutputType> outputs)
+    {
+        DEBUG_CHECK(predictions.Size() == outputs.Size(), "predictions and outputs must have the same size");
+
+        math::RowVector<double> derivatives(predictions.Size());
+        for (size_t i = 0; i < predictions.Size(); ++i)
+        {
+            derivatives[i] = lossFunction.Derivative(predictions[i], outputs[i]);
+        }
+        return derivatives;
+    }
+
+    template <typename LossFunctionType, typename OutputType>
+    double BatchConjugate(const LossFunctionType& lossFunction, math::ConstRowVectorReference<double> duals, math::ConstRowVectorReference<OutputType> outputs)
+    {
+        DEBUG_CHECK(duals.Size() == outputs.Size(), "duals and outputs must have the same size");
+
+        double sum = 0;
+        for (size_t i = 0; i < duals.Size(); ++i)
+        {
+            sum += lossFunction.Conjugate(duals[i], outputs[i]);
+        }
+        return sum;
+    }
+} // namespace optimization
+} // namespace ell
+
+#pragma endregion implementation
@@ -12,6 +12,8 @@
 
 #include <math/include/Matrix.h>
 
+#include <memory>
+
 namespace ell
 {
 namespace optimization
@@ -32,9 +34,19 @@ namespace optimization
         /// <summary> Gets a reference to the elements that corresponds to a given index. </summary>
         ExampleType Get(size_t index) const override;
 
+        /// <summary> Returns the number of input features. </summary>
+        size_t NumFeatures() const { return _input.NumColumns(); }
+
+        /// <summary> Gets a contiguous reference to one column (feature) of the input matrix, for
+        /// feature-wise sweeps. The first call lazily materializes a column-major mirror of the
+        /// input matrix, so column access strides over adjacent elements instead of striding across
+        /// the full row pitch per element. </summary>
+        math::ConstColumnVectorReference<ElementType> GetInputColumn(size_t index) const;
+
     private:
         math::RowMatrix<ElementType> _input;
         math::RowMatrix<ElementType> _output;
+        mutable std::unique_ptr<math::ColumnMatrix<ElementType>> _inputColumns;
     };
 } // namespace optimization
 } // namespace ell
@@ -63,6 +75,17 @@ namespace optimization
     {
         return ExampleType(_input.GetRow(index), _output.GetRow(index));
     }
+
+    template <typename ElementType>
+    math::ConstColumnVectorReference<ElementType> MatrixDataset<ElementType>::GetInputColumn(size_t index) const
+    {
+        if (_inputColumns == nullptr)
+        {
+            _inputColumns = std::make_unique<math::ColumnMatrix<ElementType>>(_input.NumRows(), _input.NumColumns());
+            _inputColumns->CopyFrom(_input);
+        }
+        return _inputColumns->GetColumn(index);
+    }
 } // namespace optimization
 } // namespace ell
 
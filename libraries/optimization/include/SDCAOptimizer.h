@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "BatchLoss.h"
 #include "Common.h"
 #include "Expression.h"
 
@@ -16,6 +17,8 @@
 #include <numeric>
 #include <random>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 namespace ell
@@ -27,6 +30,13 @@ namespace optimization
     {
         double regularizationParameter;
         bool permuteData = true;
+
+        /// <summary> Number of threads that process examples concurrently. With more than one
+        /// thread, dual coordinate updates are applied to the shared solution without locks
+        /// (wild/hogwild style): each example's dual variables are owned by one thread, but
+        /// solution updates can interleave, so runs are not bit-reproducible and the duality gap
+        /// can decrease less per epoch than in the single-threaded case. </summary>
+        size_t numThreads = 1;
     };
 
     /// <summary> Information about the current solution found by SDCA. </summary>
@@ -113,7 +123,8 @@ namespace optimization
 
         void OneTimeSetup(std::shared_ptr<const DatasetType> examples, std::string randomSeedString);
         void InitializeDuals();
-        void Step(ExampleType example, ExampleInfo& exampleInfo);
+        void Step(const ExampleType& example, ExampleInfo& exampleInfo);
+        double GetEstimatedDualObjective();
 
         std::shared_ptr<const DatasetType> _examples;
         LossFunctionType _lossFunction;
@@ -127,10 +138,17 @@ namespace optimization
         mutable SDCASolutionInfo _solutionInfo;
         mutable bool _areObjectivesValid = false;
 
+        // running sum of loss conjugates, maintained incrementally as dual variables change
+        mutable double _conjugateSum = 0;
+        mutable bool _isConjugateSumValid = false;
+        bool _hasFullPrimalObjective = false;
+        size_t _epochsSinceFullObjective = 0;
+
         double _t = 0;
         double _lambda = 1.0;
         double _normalizedInverseLambda = 1.0;
         bool _permuteData = true;
+        size_t _numThreads = 1;
         bool _isInitialized = false;
     };
 
@@ -198,20 +216,66 @@ namespace optimization
             }
 
             // process each example
-            for (size_t index : permutation)
+            if (_numThreads == 1)
             {
-                Step(_examples->Get(index), _exampleInfo[index]);
+                for (size_t index : permutation)
+                {
+                    Step(_examples->Get(index), _exampleInfo[index]);
+                }
+            }
+            else
+            {
+                // the running conjugate sum cannot be maintained without synchronization, so
+                // invalidate it before the threads start
+                _isConjugateSumValid = false;
+
+                // wild/hogwild style: each thread owns a disjoint slice of the permutation, so each
+                // example's dual variables are touched by exactly one thread, but updates to the
+                // shared solution are applied without locks
+                size_t blockSize = (permutation.size() + _numThreads - 1) / _numThreads;
+                std::vector<std::thread> threads;
+                for (size_t threadIndex = 0; threadIndex < _numThreads; ++threadIndex)
+                {
+                    size_t blockBegin = std::min(threadIndex * blockSize, permutation.size());
+                    size_t blockEnd = std::min(blockBegin + blockSize, permutation.size());
+                    if (blockBegin == blockEnd)
+                    {
+                        break;
+                    }
+                    threads.emplace_back([this, &permutation, blockBegin, blockEnd] {
+                        for (size_t i = blockBegin; i < blockEnd; ++i)
+                        {
+                            size_t index = permutation[i];
+                            Step(_examples->Get(index), _exampleInfo[index]);
+                        }
+                    });
+                }
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
             }
 
             _areObjectivesValid = false;
             _solutionInfo.numEpochsPerformed++;
+            ++_epochsSinceFullObjective;
 
             // early exit
             if (earlyExitDualityGap > 0)
             {
-                if (GetSolutionInfo().DualityGap() <= earlyExitDualityGap)
+                // the dual objective is maintained incrementally, so bound the duality gap with the
+                // last fully computed primal objective and pay for a full sweep only when that bound
+                // says an exit is possible, or periodically to control drift
+                const size_t fullObjectiveInterval = 8;
+                bool gapMayHaveClosed = _hasFullPrimalObjective && (_solutionInfo.primalObjective - GetEstimatedDualObjective() <= earlyExitDualityGap);
+                if (!_hasFullPrimalObjective || gapMayHaveClosed || _epochsSinceFullObjective >= fullObjectiveInterval)
                 {
-                    break;
+                    _hasFullPrimalObjective = true;
+                    _epochsSinceFullObjective = 0;
+                    if (GetSolutionInfo().DualityGap() <= earlyExitDualityGap)
+                    {
+                        break;
+                    }
                 }
             }
         }
@@ -226,6 +290,8 @@ namespace optimization
         _t = 0;
         _w.Reset();
         _v.Reset();
+        _hasFullPrimalObjective = false;
+        _epochsSinceFullObjective = 0;
 
         InitializeDuals();
     }
@@ -236,12 +302,14 @@ namespace optimization
         _lambda = parameters.regularizationParameter;
         _normalizedInverseLambda = 1.0 / (_examples->Size() * parameters.regularizationParameter);
         _permuteData = parameters.permuteData;
+        _numThreads = std::max<size_t>(parameters.numThreads, 1);
     }
 
     template <typename SolutionType, typename LossFunctionType, typename RegularizerType>
     void SDCAOptimizer<SolutionType, LossFunctionType, RegularizerType>::SetLossFunction(LossFunctionType lossFunction)
     {
         _lossFunction = std::move(lossFunction);
+        _isConjugateSumValid = false;
     }
 
     template <typename SolutionType, typename LossFunctionType, typename RegularizerType>
@@ -258,19 +326,52 @@ namespace optimization
             double primalSum = 0;
             double dualSum = 0;
 
-            for (size_t i = 0; i < _examples->Size(); ++i)
+            if constexpr (std::is_same_v<typename SolutionType::AuxiliaryDoubleType, double>)
+            {
+                // scalar predictions and duals: gather them into batches, so each batch of losses
+                // and conjugates is evaluated in one tight loop
+                const size_t batchSize = 512;
+                math::RowVector<double> predictions(batchSize);
+                math::RowVector<double> duals(batchSize);
+                math::RowVector<double> outputs(batchSize);
+
+                size_t numExamples = _examples->Size();
+                for (size_t batchStart = 0; batchStart < numExamples; batchStart += batchSize)
+                {
+                    size_t currentBatchSize = std::min(batchSize, numExamples - batchStart);
+                    for (size_t i = 0; i < currentBatchSize; ++i)
+                    {
+                        auto example = _examples->Get(batchStart + i);
+                        predictions[i] = example.input * _w;
+                        outputs[i] = example.output;
+                        duals[i] = _exampleInfo[batchStart + i].dual;
+                    }
+
+                    auto batchOutputs = outputs.GetConstReference().GetSubVector(0, currentBatchSize);
+                    primalSum += BatchValue(_lossFunction, predictions.GetConstReference().GetSubVector(0, currentBatchSize), batchOutputs);
+                    dualSum += BatchConjugate(_lossFunction, duals.GetConstReference().GetSubVector(0, currentBatchSize), batchOutputs);
+                }
+            }
+            else
             {
-                auto example = _examples->Get(i);
+                for (size_t i = 0; i < _examples->Size(); ++i)
+                {
+                    auto example = _examples->Get(i);
 
-                auto prediction = example.input * _w;
-                primalSum += _lossFunction.Value(prediction, example.output);
+                    auto prediction = example.input * _w;
+                    primalSum += _lossFunction.Value(prediction, example.output);
 
-                dualSum += _lossFunction.Conjugate(_exampleInfo[i].dual, example.output);
+                    dualSum += _lossFunction.Conjugate(_exampleInfo[i].dual, example.output);
+                }
             }
 
             _solutionInfo.primalObjective = primalSum / _examples->Size() + _lambda * _regularizer.Value(_w);
             _solutionInfo.dualObjective = -dualSum / _examples->Size() - _lambda * _regularizer.Conjugate(_v);
 
+            // the exact conjugate sum was just computed, so refresh the running sum
+            _conjugateSum = dualSum;
+            _isConjugateSumValid = true;
+
             _areObjectivesValid = true;
         }
 
@@ -321,14 +422,17 @@ namespace optimization
     template <typename SolutionType, typename LossFunctionType, typename RegularizerType>
     void SDCAOptimizer<SolutionType, LossFunctionType, RegularizerType>::InitializeDuals()
     {
+        _conjugateSum = 0;
         for (size_t i = 0; i < _examples->Size(); ++i)
         {
             _w.InitializeAuxiliaryVariable(_exampleInfo[i].dual);
+            _conjugateSum += _lossFunction.Conjugate(_exampleInfo[i].dual, _examples->Get(i).output);
         }
+        _isConjugateSumValid = true;
     }
 
     template <typename SolutionType, typename LossFunctionType, typename RegularizerType>
-    void SDCAOptimizer<SolutionType, LossFunctionType, RegularizerType>::Step(ExampleType example, ExampleInfo& exampleInfo)
+    void SDCAOptimizer<SolutionType, LossFunctionType, RegularizerType>::Step(const ExampleType& example, ExampleInfo& exampleInfo)
     {
         const double tolerance = 1.0e-8;
         auto lipschitz = exampleInfo.norm2Squared * _normalizedInverseLambda;
@@ -342,6 +446,14 @@ namespace optimization
         prediction /= lipschitz;
         prediction += exampleInfo.dual;
 
+        // maintain the running conjugate sum; with multiple threads the sum is invalidated per
+        // epoch instead, since the unsynchronized additions would race
+        bool maintainConjugateSum = (_numThreads == 1 && _isConjugateSumValid);
+        if (maintainConjugateSum)
+        {
+            _conjugateSum -= _lossFunction.Conjugate(exampleInfo.dual, example.output);
+        }
+
         // dual' = ConjProx(1/lipschitz, prediction, output)
         // dual'' = (dual - dual') * (1/(lambda*N))    ---- lambda == L2 regularization parameter
         auto newDual = _lossFunction.ConjugateProx(1.0 / lipschitz, prediction, example.output); // ## perf: creates new vector
@@ -356,6 +468,28 @@ namespace optimization
 
         // dual = dual'
         exampleInfo.dual = newDual; // ## perf: vector copy
+
+        if (maintainConjugateSum)
+        {
+            _conjugateSum += _lossFunction.Conjugate(exampleInfo.dual, example.output);
+        }
+    }
+
+    template <typename SolutionType, typename LossFunctionType, typename RegularizerType>
+    double SDCAOptimizer<SolutionType, LossFunctionType, RegularizerType>::GetEstimatedDualObjective()
+    {
+        if (!_isConjugateSumValid)
+        {
+            // recompute the conjugate sum; this walks the duals but involves no predictions
+            _conjugateSum = 0;
+            for (size_t i = 0; i < _examples->Size(); ++i)
+            {
+                _conjugateSum += _lossFunction.Conjugate(_exampleInfo[i].dual, _examples->Get(i).output);
+            }
+            _isConjugateSumValid = true;
+        }
+
+        return -_conjugateSum / _examples->Size() - _lambda * _regularizer.Conjugate(_v);
     }
 
     template <typename SolutionType, typename LossFunctionType, typename RegularizerType>
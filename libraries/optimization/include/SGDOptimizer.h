@@ -26,6 +26,12 @@ namespace optimization
     {
         double regularizationParameter;
         std::string randomSeedString = "abc123";
+
+        /// <summary> Number of examples per update. With a batch size of one, the solution is
+        /// updated after every example. With a larger batch size, the gradients of a whole batch
+        /// are accumulated into a separate buffer and applied to the solution in one dense update,
+        /// which amortizes the solution and averaging bookkeeping over the batch. </summary>
+        size_t batchSize = 1;
     };
 
     /// <summary> Stochastic gradient descent optimizer. </summary>
@@ -55,15 +61,18 @@ namespace optimization
         const SolutionType& GetSolution() const { return _averagedW; }
 
     private:
-        void Step(ExampleType example);
+        void Step(const ExampleType& example);
+        void StepBatch(const std::vector<size_t>& permutation, size_t blockBegin, size_t blockEnd);
 
         std::shared_ptr<const DatasetType> _examples;
         LossFunctionType _lossFunction;
         std::default_random_engine _randomEngine;
         SolutionType _lastW;
         SolutionType _averagedW;
+        SolutionType _batchGradient;
         double _t = 0;
         double _lambda;
+        size_t _batchSize = 1;
     };
 
     /// <summary> Convenience function for constructing an SGD optimizer. </summary>
@@ -84,7 +93,8 @@ namespace optimization
     SGDOptimizer<SolutionType, LossFunctionType>::SGDOptimizer(std::shared_ptr<const DatasetType> examples, LossFunctionType lossFunction, SGDOptimizerParameters parameters) :
         _examples(examples),
         _lossFunction(std::move(lossFunction)),
-        _lambda(parameters.regularizationParameter)
+        _lambda(parameters.regularizationParameter),
+        _batchSize(std::max<size_t>(parameters.batchSize, 1))
     {
         if (examples.get() == nullptr || examples->Size() == 0)
         {
@@ -109,6 +119,7 @@ namespace optimization
         auto example = examples->Get(0);
         _lastW.Resize(example.input, example.output);
         _averagedW.Resize(example.input, example.output);
+        _batchGradient.Resize(example.input, example.output);
     }
 
     template <typename SolutionType, typename LossFunctionType>
@@ -124,15 +135,25 @@ namespace optimization
             std::shuffle(permutation.begin(), permutation.end(), _randomEngine);
 
             // process each example
-            for (size_t index : permutation)
+            if (_batchSize == 1)
+            {
+                for (size_t index : permutation)
+                {
+                    Step(_examples->Get(index));
+                }
+            }
+            else
             {
-                Step(_examples->Get(index));
+                for (size_t blockBegin = 0; blockBegin < permutation.size(); blockBegin += _batchSize)
+                {
+                    StepBatch(permutation, blockBegin, std::min(blockBegin + _batchSize, permutation.size()));
+                }
             }
         }
     }
 
     template <typename SolutionType, typename LossFunctionType>
-    void SGDOptimizer<SolutionType, LossFunctionType>::Step(ExampleType example)
+    void SGDOptimizer<SolutionType, LossFunctionType>::Step(const ExampleType& example)
     {
         const auto& x = example.input;
         const auto& y = example.output;
@@ -153,6 +174,31 @@ namespace optimization
         _averagedW = _averagedW * (1.0 - inverseT) + _lastW * inverseT;
     }
 
+    template <typename SolutionType, typename LossFunctionType>
+    void SGDOptimizer<SolutionType, LossFunctionType>::StepBatch(const std::vector<size_t>& permutation, size_t blockBegin, size_t blockEnd)
+    {
+        ++_t;
+        double inverseT = 1.0 / _t;
+        double batchSize = static_cast<double>(blockEnd - blockBegin);
+
+        // accumulate the average gradient of the batch into a separate buffer, so the solution and
+        // its running average are only touched once per batch
+        _batchGradient.Reset();
+        for (size_t i = blockBegin; i < blockEnd; ++i)
+        {
+            auto example = _examples->Get(permutation[i]);
+
+            auto p = example.input * _lastW;
+            auto derivative = _lossFunction.Derivative(p, example.output);
+            derivative *= -example.weight / (_lambda * _t * batchSize);
+            _batchGradient += Transpose(example.input) * derivative;
+        }
+
+        // apply the accumulated gradient in one dense update
+        _lastW = _lastW * (1.0 - inverseT) + _batchGradient * 1.0;
+        _averagedW = _averagedW * (1.0 - inverseT) + _lastW * inverseT;
+    }
+
     template <typename SolutionType, typename LossFunctionType>
     SGDOptimizer<SolutionType, LossFunctionType> MakeSGDOptimizer(std::shared_ptr<const typename SolutionType::DatasetType> examples, LossFunctionType lossFunction, SGDOptimizerParameters parameters)
     {
@@ -25,14 +25,20 @@ void TestConjugate(LossFunctionType loss, Range vRange, Range outputRange, Range
 template <typename LossFunctionType>
 void TestConjugateProx(LossFunctionType loss, Range thetaRange, Range zRange, Range outputRange, Range comparatorRange);
 
+/// <summary> Test that the batch loss functions are consistent with per-element evaluation </summary>
+template <typename LossFunctionType>
+void TestBatchLoss(LossFunctionType loss, Range predictionRange, Range outputRange);
+
 #pragma region implementation
 
 #include <testing/include/testing.h>
 
+#include <optimization/include/BatchLoss.h>
 #include <optimization/include/GoldenSectionSearch.h>
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 using namespace ell;
 using namespace ell::optimization;
@@ -161,4 +167,45 @@ void TestConjugateProx(LossFunctionType loss, Range thetaRange, Range zRange, Ra
     testing::ProcessTest("TestConjugateProx <" + lossName + ">", success);
 }
 
+template <typename LossFunctionType>
+void TestBatchLoss(LossFunctionType loss, Range predictionRange, Range outputRange)
+{
+    std::vector<double> predictionValues;
+    std::vector<double> outputValues;
+    for (double prediction = predictionRange.from; prediction <= predictionRange.to; prediction += predictionRange.increment)
+    {
+        for (double output = outputRange.from; output <= outputRange.to; output += outputRange.increment)
+        {
+            predictionValues.push_back(prediction);
+            outputValues.push_back(output);
+        }
+    }
+
+    math::RowVector<double> predictions(predictionValues);
+    math::RowVector<double> outputs(outputValues);
+
+    double valueSum = 0;
+    double conjugateSum = 0;
+    bool derivativesMatch = true;
+    auto derivatives = BatchDerivative(loss, predictions, outputs);
+    for (size_t i = 0; i < predictions.Size(); ++i)
+    {
+        valueSum += loss.Value(predictions[i], outputs[i]);
+        conjugateSum += loss.Conjugate(predictions[i], outputs[i]);
+        if (derivatives[i] != loss.Derivative(predictions[i], outputs[i]))
+        {
+            derivativesMatch = false;
+        }
+    }
+
+    bool success = (BatchValue(loss, predictions, outputs) == valueSum) &&
+                   (BatchConjugate(loss, predictions, outputs) == conjugateSum) &&
+                   derivativesMatch;
+
+    std::string lossName = typeid(LossFunctionType).name();
+    lossName = lossName.substr(lossName.find_last_of(":") + 1);
+
+    testing::ProcessTest("TestBatchLoss <" + lossName + ">", success);
+}
+
 #pragma endregion implementation
@@ -22,6 +22,10 @@ void TestSDCAClassificationConvergence(LossFunctionType lossFunction, Regularize
 template <typename LossFunctionType, typename RegularizerType>
 void TestSDCAReset(LossFunctionType lossFunction, RegularizerType regularizer);
 
+/// <summary> Tests that the SDCA duality gap tends to zero when examples are processed by multiple threads with lock-free updates.</summary>
+template <typename LossFunctionType, typename RegularizerType>
+void TestSDCAParallelConvergence(LossFunctionType lossFunction, RegularizerType regularizer, SDCAOptimizerParameters parameters, double earlyStopping, double biasVariance, double inputVariance, double outputVariance);
+
 #pragma region implementation
 
 #include "../include/RandomDataset.h"
@@ -156,6 +160,42 @@ void TestSDCAReset(LossFunctionType lossFunction, RegularizerType regularizer)
     testing::ProcessTest("TestSDCAReset <" + lossName + ", " + regularizerName + ">", vector1 == vector2 && vector1 == vector3);
 }
 
+// assert that the duality gap tends to zero despite lock-free parallel updates
+template <typename LossFunctionType, typename RegularizerType>
+void TestSDCAParallelConvergence(LossFunctionType lossFunction, RegularizerType regularizer, SDCAOptimizerParameters parameters, double earlyStopping, double biasVariance, double inputVariance, double outputVariance)
+{
+    size_t count = 500;
+    size_t size = 17;
+    size_t epochs = 100;
+
+    std::string randomSeedString = "GoodLuckMan";
+    std::seed_seq seed(randomSeedString.begin(), randomSeedString.end());
+    std::default_random_engine randomEngine(seed);
+
+    // create random solution
+    VectorSolution<double, true> solution(size);
+    std::normal_distribution<double> biasDistribution(0, biasVariance);
+    solution.GetBias() = biasDistribution(randomEngine);
+
+    std::uniform_int_distribution<int> vectorDistribution(-1, 1);
+    solution.GetVector().Generate([&]() { return vectorDistribution(randomEngine); });
+
+    // create random dataset
+    auto examples = GetRegressionDataset(count, inputVariance, outputVariance, solution, randomEngine);
+
+    // create optimizer
+    auto optimizer = MakeSDCAOptimizer<VectorSolution<double, true>>(examples, lossFunction, regularizer, parameters);
+    optimizer.Update(epochs, earlyStopping);
+    double dualityGap = optimizer.GetSolutionInfo().DualityGap();
+
+    std::string lossName = typeid(LossFunctionType).name();
+    lossName = lossName.substr(lossName.find_last_of(":") + 1);
+    std::string regularizerName = typeid(RegularizerType).name();
+    regularizerName = regularizerName.substr(regularizerName.find_last_of(":") + 1);
+
+    testing::ProcessTest("TestSDCAParallelConvergence <" + lossName + ", " + regularizerName + ">", dualityGap <= earlyStopping);
+}
+
 template <typename LossFunctionType>
 void TestGetSparseSolution(LossFunctionType lossFunction, double regularizationParameter)
 {
@@ -34,7 +34,7 @@ using namespace ell::optimization;
 
 /// <summary> Tests that biased and unbiased VectorSolution and biased and unbiased MatrixSolution all behave identically when given equivalent SGD optimization problems. </summary>
 template <typename RealType, typename LossFunctionType, typename RegularizerType>
-void TestSolutionEquivalenceSGD(double regularizationParameter);
+void TestSolutionEquivalenceSGD(double regularizationParameter, size_t batchSize = 1);
 
 /// <summary> Tests that biased and unbiased VectorSolution and biased and unbiased MatrixSolution all behave identically when given equivalent SDCA optimization problems. </summary>
 template <typename RealType, typename LossFunctionType, typename RegularizerType>
@@ -48,7 +48,7 @@ void TestMaskedMatrixSolution();
 
 // Run the SGD trainer with four different solution types and confirm that the result is identical
 template <typename RealType, typename LossFunctionType, typename RegularizerType>
-void TestSolutionEquivalenceSGD(double regularizationParameter)
+void TestSolutionEquivalenceSGD(double regularizationParameter, size_t batchSize)
 {
     std::string randomSeedString = "54321blastoff";
     std::seed_seq seed(randomSeedString.begin(), randomSeedString.end());
@@ -70,22 +70,22 @@ void TestSolutionEquivalenceSGD(double regularizationParameter)
     auto examples4 = GetRandomDataset<RealType, VectorVectorExampleType<RealType>, VectorRefVectorRefExampleType<RealType>>(numExamples, exampleSize, randomEngine, 0);
 
     // set up four equivalent optimizers
-    auto optimizer1 = MakeSGDOptimizer<VectorSolution<RealType>>(examples1, LossFunctionType{}, { regularizationParameter });
+    auto optimizer1 = MakeSGDOptimizer<VectorSolution<RealType>>(examples1, LossFunctionType{}, { regularizationParameter, "abc123", batchSize });
     optimizer1.Update();
     const auto& solution1 = optimizer1.GetSolution();
     const auto& vector1 = solution1.GetVector();
 
-    auto optimizer2 = MakeSGDOptimizer<VectorSolution<RealType, true>>(examples2, LossFunctionType{}, { regularizationParameter });
+    auto optimizer2 = MakeSGDOptimizer<VectorSolution<RealType, true>>(examples2, LossFunctionType{}, { regularizationParameter, "abc123", batchSize });
     optimizer2.Update();
     const auto& solution2 = optimizer2.GetSolution();
     const auto& vector2 = solution2.GetVector();
 
-    auto optimizer3 = MakeSGDOptimizer<MatrixSolution<RealType>>(examples3, MultivariateLoss<LossFunctionType>{}, { regularizationParameter });
+    auto optimizer3 = MakeSGDOptimizer<MatrixSolution<RealType>>(examples3, MultivariateLoss<LossFunctionType>{}, { regularizationParameter, "abc123", batchSize });
     optimizer3.Update();
     const auto& solution3 = optimizer3.GetSolution();
     const auto& vector3 = solution3.GetMatrix().GetColumn(0);
 
-    auto optimizer4 = MakeSGDOptimizer<MatrixSolution<RealType, true>>(examples4, MultivariateLoss<LossFunctionType>{}, { regularizationParameter });
+    auto optimizer4 = MakeSGDOptimizer<MatrixSolution<RealType, true>>(examples4, MultivariateLoss<LossFunctionType>{}, { regularizationParameter, "abc123", batchSize });
     optimizer4.Update();
     const auto& solution4 = optimizer4.GetSolution();
     const auto& vector4 = solution4.GetMatrix().GetColumn(0);
@@ -151,4 +151,16 @@ void TestMatrixDataset()
     // train an SGD optimizer on the example set
     auto optimizer = MakeSGDOptimizer<MatrixSolution<double>>(examples, MultivariateLoss<SquareLoss>{}, { 0.0001 });
     optimizer.Update();
+
+    // feature-wise access through the column-major mirror must agree with row-wise access
+    bool columnsMatch = true;
+    for (size_t j = 0; j < examples->NumFeatures(); ++j)
+    {
+        auto column = examples->GetInputColumn(j);
+        for (size_t i = 0; i < examples->Size(); ++i)
+        {
+            columnsMatch &= (column[i] == examples->Get(i).input[j]);
+        }
+    }
+    testing::ProcessTest("TestMatrixDataset columns", columnsMatch);
 }
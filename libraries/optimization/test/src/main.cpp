@@ -86,6 +86,16 @@ int main()
     TestConjugateProx(SmoothedHingeLoss{ 0.3 }, { 0.1, 0.1, 2.0 }, { -1.0, 2.0, 1.0 }, { -1.0, 2.0, 1.0 }, -1, 1);
     TestConjugateProx(SquaredHingeLoss{}, { 0.1, 0.1, 2.0 }, { -1.0, 2.0, 1.0 }, { -1.0, 2.0, 1.0 }, -10, 10);
 
+    // Test that the batch loss functions are consistent with per-element evaluation
+
+    TestBatchLoss(AbsoluteLoss{}, { -2.0, 0.1, 2.0 }, { -2.0, 0.1, 2.0 });
+    TestBatchLoss(HuberLoss{ 2.0 }, { -2.0, 0.1, 2.0 }, { -2.0, 0.1, 2.0 });
+    TestBatchLoss(SquareLoss{}, { -2.0, 0.1, 2.0 }, { -2.0, 0.1, 2.0 });
+    TestBatchLoss(HingeLoss{}, { -2.0, 0.1, 2.0 }, { -1.0, 2.0, 1.0 });
+    TestBatchLoss(LogisticLoss{}, { -2.0, 0.1, 2.0 }, { -1.0, 2.0, 1.0 });
+    TestBatchLoss(SmoothedHingeLoss{ 1.0 }, { -2.0, 0.1, 2.0 }, { -1.0, 2.0, 1.0 });
+    TestBatchLoss(SquaredHingeLoss{}, { -2.0, 0.1, 2.0 }, { -1.0, 2.0, 1.0 });
+
     // Test convergence of SDCA on a synthetic regression problem
 
     TestSDCARegressionConvergence(AbsoluteLoss{}, L2Regularizer{}, { .5, true }, 1.0e-4, 1.0, 1.0, 1.0);
@@ -106,6 +116,10 @@ int main()
     TestSDCARegressionConvergence(SquareLoss{}, MaxRegularizer{ 0 }, { .1, true }, 1.0e-4, 1.0, 1.0, 1.0);
     TestSDCARegressionConvergence(SquareLoss{}, MaxRegularizer{ 1 }, { 1, true }, 1.0e-4, 1.0, 1.0, 1.0);
 
+    // Test convergence of SDCA with lock-free parallel updates
+
+    TestSDCAParallelConvergence(SquareLoss{}, L2Regularizer{}, { .1, true, 4 }, 1.0e-3, 1.0, 1.0, 1.0);
+
     // Test convergence of SDCA on a synthetic classification problem
 
     TestSDCAClassificationConvergence(HingeLoss{}, L2Regularizer{}, { .1, true }, 1.0e-4, 1.0, 1.0, 3.0);
@@ -146,6 +160,10 @@ int main()
     TestSolutionEquivalenceSGD<double, SquareLoss, L2Regularizer>(1.0e+3);
     TestSolutionEquivalenceSGD<int, SquareLoss, L2Regularizer>(1.0e+3);
 
+    // the solution types must also behave identically with mini-batch updates
+    TestSolutionEquivalenceSGD<double, SquareLoss, L2Regularizer>(1.0e+3, 2);
+    TestSolutionEquivalenceSGD<double, LogisticLoss, L2Regularizer>(0.0001, 2);
+
     TestSolutionEquivalenceSGD<double, HingeLoss, L2Regularizer>(0.001);
     TestSolutionEquivalenceSGD<int, HingeLoss, L2Regularizer>(0.001);
 
@@ -0,0 +1,45 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AssignDataLayoutsTransformation.h (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/Transformation.h>
+
+#include <memory>
+
+namespace ell
+{
+namespace passes
+{
+    /// <summary> A transformation that assigns memory layouts globally over chains of
+    /// `ReorderDataCodeNode`s and layout-agnostic elementwise nodes, instead of keeping the
+    /// layout each node happened to pick locally. Each chain is solved with dynamic programming
+    /// under a memory-bandwidth cost model (a reorder reads its source and writes its target; an
+    /// elementwise op reads and writes its assigned layout), and is rebuilt with reorders only
+    /// where the assigned layouts actually change --- typically collapsing the
+    /// back-and-forth permutations imported models carry to at most one reorder per chain.
+    /// Enabled by the "assignDataLayouts" optimizer option. </summary>
+    class AssignDataLayoutsTransformation : public model::Transformation
+    {
+    public:
+        AssignDataLayoutsTransformation();
+        AssignDataLayoutsTransformation(AssignDataLayoutsTransformation&&);
+        ~AssignDataLayoutsTransformation();
+
+        /// <summary> Assign min-cost layouts over chains of reorder and elementwise nodes. </summary>
+        model::Submodel Transform(const model::Submodel& submodel, model::ModelTransformer& transformer, const ell::model::TransformContext& context) const override;
+
+        /// <summary> Returns the ID for this transformation </summary>
+        std::string GetRuntimeTypeName() const override { return { "AssignDataLayoutsTransformation" }; };
+
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+    };
+} // namespace passes
+} // namespace ell
@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     EliminateRedundantNodesTransformation.h (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/Transformation.h>
+
+namespace ell
+{
+namespace passes
+{
+    /// <summary> A transformation that removes redundant nodes: nodes whose outputs don't
+    /// contribute to the submodel's outputs (or to any output or sink node), and duplicate nodes
+    /// that compute the same function of the same inputs, which are merged into one. Duplicates
+    /// are found by structural comparison of the nodes' types, parameters, and (already-merged)
+    /// inputs, so chains of duplicated nodes collapse in a single pass. </summary>
+    class EliminateRedundantNodesTransformation : public model::Transformation
+    {
+    public:
+        /// <summary> Remove dead nodes and merge duplicate nodes. </summary>
+        model::Submodel Transform(const model::Submodel& submodel, model::ModelTransformer& transformer, const ell::model::TransformContext& context) const override;
+
+        /// <summary> Returns the ID for this transformation </summary>
+        std::string GetRuntimeTypeName() const override { return { "EliminateRedundantNodesTransformation" }; };
+    };
+} // namespace passes
+} // namespace ell
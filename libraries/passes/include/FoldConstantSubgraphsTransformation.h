@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FoldConstantSubgraphsTransformation.h (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/Transformation.h>
+
+namespace ell
+{
+namespace passes
+{
+    /// <summary> A transformation that evaluates constant-only subgraphs at compile time: any node
+    /// whose inputs are all (transitively) fed by constant nodes is computed once on the host, and
+    /// its outputs are replaced by constant nodes holding the computed values. Imported
+    /// preprocessing chains (normalization constant pipelines, reshaped weights) collapse to their
+    /// final values instead of being recomputed on device at every inference. </summary>
+    class FoldConstantSubgraphsTransformation : public model::Transformation
+    {
+    public:
+        /// <summary> Replace constant-only subgraphs with precomputed constant nodes. </summary>
+        model::Submodel Transform(const model::Submodel& submodel, model::ModelTransformer& transformer, const ell::model::TransformContext& context) const override;
+
+        /// <summary> Returns the ID for this transformation </summary>
+        std::string GetRuntimeTypeName() const override { return { "FoldConstantSubgraphsTransformation" }; };
+    };
+} // namespace passes
+} // namespace ell
@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FuseBroadcastOperationsTransformation.h (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/Transformation.h>
+
+namespace ell
+{
+namespace passes
+{
+    /// <summary> A transformation that collapses chains of adjacent elementwise operation nodes
+    /// (`BroadcastUnaryOperationNode` and `BroadcastBinaryOperationNode`) into single
+    /// `FusedBroadcastOperationNode`s that make one pass over the data, instead of one pass per
+    /// operation. Only fuses into inputs that have no other consumers. </summary>
+    class FuseBroadcastOperationsTransformation : public ell::model::Transformation
+    {
+    public:
+        /// <summary> Fuse chains of elementwise operations if possible. </summary>
+        model::Submodel Transform(const model::Submodel& submodel, model::ModelTransformer& transformer, const model::TransformContext& context) const override;
+
+        /// <summary> Returns the ID for this transformation </summary>
+        std::string GetRuntimeTypeName() const override { return "FuseBroadcastOperationsTransformation"; };
+    };
+} // namespace passes
+} // namespace ell
@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     OptimizeTypeCastsTransformation.h (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/Transformation.h>
+
+namespace ell
+{
+namespace passes
+{
+    /// <summary> A transformation that removes type-cast churn from imported models: casts to a
+    /// port's own type become pass-throughs, and a cast whose source is itself a cast is collapsed
+    /// into a single cast from the original value. Round trips through a wider type (float ->
+    /// double -> float) vanish exactly; round trips through a narrower floating-point type
+    /// (double -> float -> double) are removed too, which keeps the extra precision -- opt out
+    /// per node where the narrowing is intentional. Casts through integer types are left alone,
+    /// since those truncations are semantic. </summary>
+    class OptimizeTypeCastsTransformation : public model::Transformation
+    {
+    public:
+        /// <summary> Remove and collapse redundant type-cast nodes. </summary>
+        model::Submodel Transform(const model::Submodel& submodel, model::ModelTransformer& transformer, const ell::model::TransformContext& context) const override;
+
+        /// <summary> Returns the ID for this transformation </summary>
+        std::string GetRuntimeTypeName() const override { return { "OptimizeTypeCastsTransformation" }; };
+    };
+} // namespace passes
+} // namespace ell
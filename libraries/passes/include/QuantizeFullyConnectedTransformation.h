@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantizeFullyConnectedTransformation.h (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/Transformation.h>
+
+namespace ell
+{
+namespace passes
+{
+    /// <summary> A transformation that replaces `FullyConnectedLayerNode`s with fixed-point
+    /// `FixedPointFullyConnectedNode`s, for targets where soft-float multiplies dominate the cost.
+    /// Enabled by the "useFixedPointFullyConnected" optimizer option; the input calibration range
+    /// comes from the "fixedPointInputRange" option (overridable per node). </summary>
+    class QuantizeFullyConnectedTransformation : public model::Transformation
+    {
+    public:
+        /// <summary> Change `FullyConnectedLayerNode` to a fixed-point version if requested. </summary>
+        model::Submodel Transform(const model::Submodel& submodel, model::ModelTransformer& transformer, const ell::model::TransformContext& context) const override;
+
+        /// <summary> Returns the ID for this transformation </summary>
+        std::string GetRuntimeTypeName() const override { return { "QuantizeFullyConnectedTransformation" }; };
+    };
+} // namespace passes
+} // namespace ell
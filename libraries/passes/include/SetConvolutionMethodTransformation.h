@@ -14,7 +14,9 @@ namespace ell
 {
 namespace passes
 {
-    /// <summary> A transformation that sets the convolution algorithm for a `ConvolutionalLayerNode`. </summary>
+    /// <summary> A transformation that sets the convolution algorithm for a `ConvolutionalLayerNode`.
+    /// Depthwise-separable layers are routed to the direct spatial convolution path, which processes
+    /// the data channel-contiguously instead of unrolling it one channel at a time. </summary>
     class SetConvolutionMethodTransformation : public model::Transformation
     {
     public:
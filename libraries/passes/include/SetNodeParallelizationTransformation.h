@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SetNodeParallelizationTransformation.h (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/Transformation.h>
+
+namespace ell
+{
+namespace passes
+{
+    /// <summary> A transformation that estimates the arithmetic cost of the expensive compute nodes
+    /// (convolutions, matrix multiplies, pooling) and sets the per-node "parallelize" compile option
+    /// on the ones whose cost exceeds the threshold in `MapCompilerOptions`. Nodes that honor the
+    /// option then emit parallel loops for their inner computation. </summary>
+    class SetNodeParallelizationTransformation : public model::Transformation
+    {
+    public:
+        /// <summary> Set the "parallelize" compile option on nodes worth parallelizing. </summary>
+        model::Submodel Transform(const model::Submodel& submodel, model::ModelTransformer& transformer, const ell::model::TransformContext& context) const override;
+
+        /// <summary> Returns the ID for this transformation </summary>
+        std::string GetRuntimeTypeName() const override { return { "SetNodeParallelizationTransformation" }; };
+    };
+} // namespace passes
+} // namespace ell
@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparsifyMatrixMultiplyTransformation.h (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <model/include/Transformation.h>
+
+namespace ell
+{
+namespace passes
+{
+    /// <summary> A transformation that replaces `MatrixVectorMultiplyNode`s whose matrix is a
+    /// mostly-zero constant (as produced by pruning) with compressed-index
+    /// `SparseMatrixVectorMultiplyNode`s that skip the zeros entirely. Enabled by the
+    /// "sparsifyMatrixMultiply" optimizer option; matrices whose fraction of nonzeros exceeds
+    /// the "sparseDensityThreshold" option are left dense. </summary>
+    class SparsifyMatrixMultiplyTransformation : public model::Transformation
+    {
+    public:
+        /// <summary> Change `MatrixVectorMultiplyNode` to a sparse version where profitable. </summary>
+        model::Submodel Transform(const model::Submodel& submodel, model::ModelTransformer& transformer, const ell::model::TransformContext& context) const override;
+
+        /// <summary> Returns the ID for this transformation </summary>
+        std::string GetRuntimeTypeName() const override { return { "SparsifyMatrixMultiplyTransformation" }; };
+    };
+} // namespace passes
+} // namespace ell
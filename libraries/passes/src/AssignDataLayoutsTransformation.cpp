@@ -0,0 +1,302 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     AssignDataLayoutsTransformation.cpp (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "AssignDataLayoutsTransformation.h"
+
+#include <model/include/ModelTransformer.h>
+
+#include <nodes/include/BroadcastOperationNodes.h>
+#include <nodes/include/ReorderDataCodeNode.h>
+
+#include <utilities/include/Exception.h>
+#include <utilities/include/Logger.h>
+#include <utilities/include/StlVectorUtil.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace ell
+{
+
+using namespace model;
+using namespace nodes;
+using namespace utilities;
+using namespace utilities::logging;
+
+namespace passes
+{
+    namespace
+    {
+        template <typename Container, typename Function>
+        auto Transform(const Container& container, Function fn)
+        {
+            return TransformVector(container.begin(), container.end(), fn);
+        }
+
+        std::vector<const OutputPortBase*> GetReferencedPorts(const std::vector<const InputPortBase*>& inputs)
+        {
+            return Transform(inputs, [](auto input) { return &input->GetReferencedPort(); });
+        }
+
+        // The bandwidth cost of changing layouts: the reorder reads the source buffer and
+        // writes the target buffer
+        size_t TransitionCost(const PortMemoryLayout& from, const PortMemoryLayout& to)
+        {
+            return from == to ? 0 : from.GetMemorySize() + to.GetMemorySize();
+        }
+
+        // The bandwidth cost of running one elementwise op in the given layout: one read and
+        // one write of the buffer
+        size_t OperationCost(const PortMemoryLayout& layout)
+        {
+            return 2 * layout.GetMemorySize();
+        }
+
+        // A layout is safe to move elementwise work into only if it is a pure permutation of the
+        // data: no padding area whose contents depend on where in the chain the reorder runs
+        bool IsPermutationLayout(const PortMemoryLayout& layout)
+        {
+            return !layout.HasPadding();
+        }
+    } // namespace
+
+    struct AssignDataLayoutsTransformation::State
+    {
+        // One node in a chain: either a reorder (carries a target layout) or an elementwise op
+        template <typename ValueType>
+        struct ChainEntry
+        {
+            const ReorderDataCodeNode<ValueType>* reorderNode = nullptr;
+            const BroadcastUnaryOperationNode<ValueType>* opNode = nullptr;
+        };
+
+        template <typename ValueType>
+        bool TryAssignChainLayouts(const Node& nodeToProcess, ModelTransformer& transformer)
+        {
+            if (std::find(nodesToIgnore.begin(), nodesToIgnore.end(), nodeToProcess.GetId()) != nodesToIgnore.end())
+            {
+                Log() << "Node [id = " << nodeToProcess.GetId().ToString() << "] already absorbed into a layout-assigned chain" << EOL;
+                return true;
+            }
+
+            auto headNode = dynamic_cast<const ReorderDataCodeNode<ValueType>*>(&nodeToProcess);
+            if (headNode == nullptr)
+            {
+                return false;
+            }
+
+            // Gather the chain: reorder and elementwise nodes linked by single-consumer edges
+            std::vector<ChainEntry<ValueType>> chain;
+            int numReorders = 0;
+            int numOps = 0;
+            const Node* currentNode = headNode;
+            while (currentNode != nullptr)
+            {
+                if (auto reorderNode = dynamic_cast<const ReorderDataCodeNode<ValueType>*>(currentNode))
+                {
+                    if (!IsPermutationLayout(reorderNode->GetInputMemoryLayout()) ||
+                        !IsPermutationLayout(reorderNode->GetOutputMemoryLayout()) ||
+                        reorderNode->GetInputMemoryLayout().GetLogicalDimensionActiveSize() != reorderNode->GetOutputMemoryLayout().GetLogicalDimensionActiveSize())
+                    {
+                        break; // padding or cropping: not a pure permutation, stop the chain before it
+                    }
+                    chain.push_back({ reorderNode, nullptr });
+                    ++numReorders;
+                }
+                else if (auto opNode = dynamic_cast<const BroadcastUnaryOperationNode<ValueType>*>(currentNode))
+                {
+                    if (opNode->input.GetMemoryLayout() != opNode->output.GetMemoryLayout())
+                    {
+                        break; // the op relayouts internally; leave it alone
+                    }
+                    chain.push_back({ nullptr, opNode });
+                    ++numOps;
+                }
+                else
+                {
+                    break;
+                }
+
+                currentNode = currentNode->GetDependentNodes().size() == 1 ? currentNode->GetDependentNodes()[0] : nullptr;
+            }
+
+            // With fewer than two reorders there is nothing a global assignment can improve, and
+            // with no elementwise ops the existing reorder-chain collapsing already handles it
+            if (numReorders < 2 || numOps < 1)
+            {
+                return false;
+            }
+
+            // Drop trailing entries after the last reorder: ops already running in the final
+            // layout stay where they are
+            while (chain.back().reorderNode == nullptr)
+            {
+                chain.pop_back();
+            }
+
+            const auto& startLayout = headNode->GetInputMemoryLayout();
+            if (!IsPermutationLayout(startLayout))
+            {
+                return false;
+            }
+            auto endLayout = chain.back().reorderNode->GetOutputMemoryLayout();
+
+            // Candidate layouts: the chain's entry layout and each layout a reorder produces
+            std::vector<PortMemoryLayout> candidates{ startLayout };
+            for (const auto& entry : chain)
+            {
+                if (entry.reorderNode != nullptr)
+                {
+                    auto layout = entry.reorderNode->GetOutputMemoryLayout();
+                    if (std::find(candidates.begin(), candidates.end(), layout) == candidates.end())
+                    {
+                        candidates.push_back(layout);
+                    }
+                }
+            }
+            auto numCandidates = candidates.size();
+
+            // Collect the ops in chain order
+            std::vector<const BroadcastUnaryOperationNode<ValueType>*> ops;
+            for (const auto& entry : chain)
+            {
+                if (entry.opNode != nullptr)
+                {
+                    ops.push_back(entry.opNode);
+                }
+            }
+            auto numOpsInChain = ops.size();
+            if (numOpsInChain == 0)
+            {
+                return false; // all the ops followed the last reorder: a pure reorder chain remains
+            }
+
+            // Dynamic programming over the (linear) chain: cost[i][j] is the cheapest way to have
+            // op i run in candidate layout j, counting reorder traffic and op traffic
+            constexpr auto infiniteCost = std::numeric_limits<size_t>::max();
+            std::vector<std::vector<size_t>> cost(numOpsInChain, std::vector<size_t>(numCandidates, infiniteCost));
+            std::vector<std::vector<size_t>> parent(numOpsInChain, std::vector<size_t>(numCandidates, 0));
+            for (size_t j = 0; j < numCandidates; ++j)
+            {
+                cost[0][j] = TransitionCost(startLayout, candidates[j]) + OperationCost(candidates[j]);
+            }
+            for (size_t i = 1; i < numOpsInChain; ++i)
+            {
+                for (size_t j = 0; j < numCandidates; ++j)
+                {
+                    for (size_t k = 0; k < numCandidates; ++k)
+                    {
+                        auto total = cost[i - 1][k] + TransitionCost(candidates[k], candidates[j]) + OperationCost(candidates[j]);
+                        if (total < cost[i][j])
+                        {
+                            cost[i][j] = total;
+                            parent[i][j] = k;
+                        }
+                    }
+                }
+            }
+            size_t bestFinal = 0;
+            size_t bestCost = infiniteCost;
+            for (size_t j = 0; j < numCandidates; ++j)
+            {
+                auto total = cost[numOpsInChain - 1][j] + TransitionCost(candidates[j], endLayout);
+                if (total < bestCost)
+                {
+                    bestCost = total;
+                    bestFinal = j;
+                }
+            }
+            std::vector<size_t> assignment(numOpsInChain);
+            assignment[numOpsInChain - 1] = bestFinal;
+            for (size_t i = numOpsInChain - 1; i > 0; --i)
+            {
+                assignment[i - 1] = parent[i][assignment[i]];
+            }
+
+            // Rebuild the chain with the assigned layouts, emitting reorders only where the
+            // layout actually changes
+            auto paddingValue = headNode->GetPaddingValue();
+            const OutputPort<ValueType>* current = &transformer.GetCorrespondingInputs(headNode->input);
+            PortMemoryLayout currentLayout = startLayout;
+            for (size_t i = 0; i < numOpsInChain; ++i)
+            {
+                const auto& opLayout = candidates[assignment[i]];
+                if (opLayout != currentLayout)
+                {
+                    current = &nodes::ReorderDataWithCodeNode(*current, currentLayout, opLayout, paddingValue);
+                    currentLayout = opLayout;
+                }
+                auto newOpNode = transformer.AddNode<BroadcastUnaryOperationNode<ValueType>>(*current, currentLayout, ops[i]->GetOperation());
+                current = &newOpNode->output;
+            }
+            if (currentLayout != endLayout)
+            {
+                current = &nodes::ReorderDataWithCodeNode(*current, currentLayout, endLayout, paddingValue);
+            }
+
+            Log() << "Assigned layouts over a chain of " << numReorders << " reorder and " << numOpsInChain
+                  << " elementwise nodes starting at node [id = " << headNode->GetId().ToString() << "]" << EOL;
+
+            const auto* terminalNode = chain.back().reorderNode;
+            transformer.MapNodeOutput(terminalNode->output, *current);
+            for (const auto& entry : chain)
+            {
+                const Node* node = entry.reorderNode != nullptr ? static_cast<const Node*>(entry.reorderNode) : static_cast<const Node*>(entry.opNode);
+                nodesToIgnore.push_back(node->GetId());
+                if (node != headNode && node != terminalNode)
+                {
+                    transformer.DeleteNode(*node);
+                }
+            }
+            return true;
+        }
+
+        std::vector<model::Node::NodeId> nodesToIgnore;
+    };
+
+    AssignDataLayoutsTransformation::AssignDataLayoutsTransformation() :
+        _state(new AssignDataLayoutsTransformation::State)
+    {
+    }
+
+    AssignDataLayoutsTransformation::AssignDataLayoutsTransformation(AssignDataLayoutsTransformation&&) = default;
+
+    AssignDataLayoutsTransformation::~AssignDataLayoutsTransformation() = default;
+
+    model::Submodel AssignDataLayoutsTransformation::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        auto onto = GetReferencedPorts(submodel.GetInputs());
+        auto destModel = submodel.GetModel().ShallowCopy();
+        auto result = transformer.TransformSubmodelOnto(submodel, destModel, onto, context, [this, context](const Node& node, ModelTransformer& transformer) {
+            const model::MapCompiler* compiler = context.GetCompiler();
+            bool canOptimizeNode = true;
+            if (compiler)
+            {
+                model::ModelOptimizerOptions optimizerOptions = compiler->GetModelOptimizerOptions(node);
+                canOptimizeNode = optimizerOptions.GetEntry<bool>("assignDataLayouts", true);
+            }
+            if (canOptimizeNode)
+            {
+                if (_state->TryAssignChainLayouts<float>(node, transformer))
+                {
+                    return;
+                }
+                if (_state->TryAssignChainLayouts<double>(node, transformer))
+                {
+                    return;
+                }
+            }
+
+            transformer.CopyNode(node);
+        });
+
+        return result;
+    }
+} // namespace passes
+} // namespace ell
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     EliminateRedundantNodesTransformation.cpp (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "EliminateRedundantNodesTransformation.h"
+
+#include <model/include/InputNode.h>
+#include <model/include/ModelTransformer.h>
+#include <model/include/OutputNode.h>
+
+#include <utilities/include/Hash.h>
+#include <utilities/include/JsonArchiver.h>
+#include <utilities/include/Logger.h>
+#include <utilities/include/StringUtil.h>
+
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ell
+{
+namespace passes
+{
+    using namespace model;
+    using namespace utilities::logging;
+    using utilities::logging::Log;
+
+    namespace
+    {
+        // Nodes with side effects (or that define the model's interface) always count as live,
+        // and are never merged with a structurally identical twin
+        bool HasExternalEffects(const Node& node)
+        {
+            if (dynamic_cast<const InputNodeBase*>(&node) != nullptr || dynamic_cast<const OutputNodeBase*>(&node) != nullptr)
+            {
+                return true;
+            }
+            auto typeName = node.GetRuntimeTypeName();
+            return typeName.find("SinkNode") != std::string::npos || typeName.find("SourceNode") != std::string::npos;
+        }
+
+        bool IsNodeEnabled(const Node& node, const TransformContext& context)
+        {
+            auto compiler = context.GetCompiler();
+            if (compiler)
+            {
+                return compiler->GetModelOptimizerOptions(node).GetEntry<bool>("eliminateRedundantNodes", true);
+            }
+            return true;
+        }
+
+        // Returns the set of nodes whose outputs contribute to the submodel's outputs or to a
+        // node with external effects. Nodes that opted out of this transformation count as live,
+        // so the nodes they reference are always preserved.
+        std::unordered_set<const Node*> GetLiveNodes(const Submodel& submodel, const TransformContext& context)
+        {
+            std::vector<const Node*> nodesInOrder;
+            submodel.Visit([&nodesInOrder](const Node& node) {
+                nodesInOrder.push_back(&node);
+            });
+
+            std::unordered_set<const Node*> liveNodes;
+            for (auto output : submodel.GetOutputs())
+            {
+                liveNodes.insert(output->GetNode());
+            }
+
+            // Visit in reverse dependency order, so each node is seen after all its dependents
+            for (auto iter = nodesInOrder.rbegin(); iter != nodesInOrder.rend(); ++iter)
+            {
+                const Node* node = *iter;
+                if (HasExternalEffects(*node) || !IsNodeEnabled(*node, context))
+                {
+                    liveNodes.insert(node);
+                }
+                if (liveNodes.find(node) != liveNodes.end())
+                {
+                    for (auto input : node->GetInputPorts())
+                    {
+                        liveNodes.insert(input->GetReferencedPort().GetNode());
+                    }
+                }
+            }
+            return liveNodes;
+        }
+
+        // Returns a string that identifies the structure of a node: its type and parameters, with
+        // the node ids neutralized, plus the identities of its (already-transformed) inputs. Two
+        // nodes with the same signature compute the same function of the same values.
+        std::string GetNodeSignature(const Node& node, ModelTransformer& transformer)
+        {
+            std::stringstream buffer;
+            utilities::JsonArchiver archiver(buffer);
+            archiver << node;
+            auto state = buffer.str();
+
+            // Blank out this node's id and the referenced nodes' ids --- duplicated nodes differ
+            // only in their ids, and duplicated chains additionally in the upstream ids. Input
+            // identity comes from the corresponding ports in the new model instead, so chains
+            // whose upstream nodes have already been merged compare equal.
+            utilities::ReplaceAll(state, node.GetId().ToString(), "");
+
+            // Earlier transformations tag each node with its "ancestor" id, which differs between
+            // otherwise identical nodes --- neutralize it as well
+            if (auto ancestor = node.GetMetadata().TryGetEntry<std::string>("ancestor"))
+            {
+                utilities::ReplaceAll(state, *ancestor, "");
+            }
+
+            std::stringstream signature;
+            for (auto input : node.GetInputPorts())
+            {
+                const auto& referencedPort = input->GetReferencedPort();
+                utilities::ReplaceAll(state, referencedPort.GetNode()->GetId().ToString(), "");
+                signature << &transformer.GetCorrespondingOutputs(referencedPort) << ";";
+            }
+            signature << state;
+            return signature.str();
+        }
+    } // namespace
+
+    //
+    // EliminateRedundantNodesTransformation methods
+    //
+    Submodel EliminateRedundantNodesTransformation::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        auto liveNodes = GetLiveNodes(submodel, context);
+
+        // Keyed by a hash of the signature rather than the signature itself, so weight-heavy
+        // models don't keep a full serialized copy of every constant tensor in the map. A match
+        // is confirmed by recomputing the candidate's signature, so a hash collision can never
+        // merge two different nodes.
+        std::unordered_map<size_t, std::vector<const Node*>> uniqueNodes;
+
+        // Copy into a fresh model (as RefineTransformation does), so that skipped nodes really
+        // disappear instead of lingering in a shared node list
+        Model destModel;
+        destModel.GetMetadata() = submodel.GetModel().GetMetadata();
+        auto result = transformer.TransformSubmodelOnto(submodel, destModel, {}, context, [&](const Node& node, ModelTransformer& transformer) {
+            bool enabled = IsNodeEnabled(node, context);
+            if (liveNodes.find(&node) == liveNodes.end())
+            {
+                Log() << "Eliminating dead node " << node.GetId() << " (" << node.GetRuntimeTypeName() << ")" << std::endl;
+                return;
+            }
+
+            if (!enabled || HasExternalEffects(node))
+            {
+                transformer.CopyNode(node);
+                return;
+            }
+
+            auto signature = GetNodeSignature(node, transformer);
+            auto& candidates = uniqueNodes[utilities::HashValue(signature)];
+            const Node* match = nullptr;
+            for (auto candidate : candidates)
+            {
+                if (GetNodeSignature(*candidate, transformer) == signature)
+                {
+                    match = candidate;
+                    break;
+                }
+            }
+            if (match == nullptr)
+            {
+                candidates.push_back(&node);
+                transformer.CopyNode(node);
+                return;
+            }
+
+            // A structurally identical node has already been copied: reuse its outputs
+            Log() << "Merging duplicate node " << node.GetId() << " (" << node.GetRuntimeTypeName() << ") into node " << match->GetId() << std::endl;
+            auto originalPorts = match->GetOutputPorts();
+            auto duplicatePorts = node.GetOutputPorts();
+            for (size_t index = 0; index < duplicatePorts.size(); ++index)
+            {
+                transformer.MapNodeOutput(*duplicatePorts[index], transformer.GetCorrespondingOutputs(*originalPorts[index]));
+            }
+        });
+        return result;
+    }
+} // namespace passes
+} // namespace ell
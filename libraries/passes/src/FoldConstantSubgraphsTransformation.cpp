@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FoldConstantSubgraphsTransformation.cpp (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FoldConstantSubgraphsTransformation.h"
+
+#include <model/include/InputNode.h>
+#include <model/include/ModelTransformer.h>
+#include <model/include/OutputNode.h>
+
+#include <nodes/include/ConstantNode.h>
+
+#include <utilities/include/Exception.h>
+#include <utilities/include/Logger.h>
+
+#include <string>
+#include <unordered_set>
+
+namespace ell
+{
+namespace passes
+{
+    using namespace model;
+    using namespace utilities::logging;
+    using utilities::logging::Log;
+
+    namespace
+    {
+        bool IsConstantNode(const Node& node)
+        {
+            return node.GetRuntimeTypeName().find("ConstantNode") == 0;
+        }
+
+        // Nodes that define the model's interface, have side effects, or keep state between
+        // invocations don't compute a pure function of their inputs and can never be folded
+        bool CanFoldNode(const Node& node)
+        {
+            if (dynamic_cast<const InputNodeBase*>(&node) != nullptr || dynamic_cast<const OutputNodeBase*>(&node) != nullptr)
+            {
+                return false;
+            }
+            auto typeName = node.GetRuntimeTypeName();
+            for (auto statefulName : { "SinkNode", "SourceNode", "ClockNode", "BufferNode" })
+            {
+                if (typeName.find(statefulName) != std::string::npos)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool IsNodeEnabled(const Node& node, const TransformContext& context)
+        {
+            auto compiler = context.GetCompiler();
+            if (compiler)
+            {
+                return compiler->GetModelOptimizerOptions(node).GetEntry<bool>("foldConstantSubgraphs", true);
+            }
+            return true;
+        }
+
+        // Returns the nodes that compute a constant value: constant nodes themselves, plus any
+        // foldable node all of whose inputs come from constant-valued nodes
+        std::unordered_set<const Node*> GetConstantValuedNodes(const Submodel& submodel, const TransformContext& context)
+        {
+            std::unordered_set<const Node*> constantValuedNodes;
+            submodel.Visit([&](const Node& node) {
+                if (IsConstantNode(node))
+                {
+                    constantValuedNodes.insert(&node);
+                    return;
+                }
+
+                if (node.GetInputPorts().empty() || !CanFoldNode(node) || !IsNodeEnabled(node, context))
+                {
+                    return;
+                }
+
+                for (auto input : node.GetInputPorts())
+                {
+                    if (constantValuedNodes.find(input->GetReferencedPort().GetNode()) == constantValuedNodes.end())
+                    {
+                        return;
+                    }
+                }
+                constantValuedNodes.insert(&node);
+            });
+            return constantValuedNodes;
+        }
+
+        // Computes the port's value on the host (using the source model's Compute implementations)
+        // and maps the port to a new constant node holding the result
+        template <typename ValueType>
+        void FoldOutputPort(const OutputPortBase& port, ModelTransformer& transformer)
+        {
+            const auto& typedPort = static_cast<const OutputPort<ValueType>&>(port);
+            auto values = port.GetNode()->GetModel()->ComputeOutput(typedPort);
+            auto constantNode = transformer.AddNode<nodes::ConstantNode<ValueType>>(values, port.GetMemoryLayout());
+            transformer.MapNodeOutput(typedPort, constantNode->output);
+        }
+
+        void FoldNode(const Node& node, ModelTransformer& transformer)
+        {
+            for (auto port : node.GetOutputPorts())
+            {
+                switch (port->GetType())
+                {
+                case Port::PortType::boolean:
+                    FoldOutputPort<bool>(*port, transformer);
+                    break;
+                case Port::PortType::integer:
+                    FoldOutputPort<int>(*port, transformer);
+                    break;
+                case Port::PortType::bigInt:
+                    FoldOutputPort<int64_t>(*port, transformer);
+                    break;
+                case Port::PortType::smallReal:
+                    FoldOutputPort<float>(*port, transformer);
+                    break;
+                case Port::PortType::real:
+                    FoldOutputPort<double>(*port, transformer);
+                    break;
+                default:
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Unknown port type in constant subgraph");
+                }
+            }
+        }
+    } // namespace
+
+    //
+    // FoldConstantSubgraphsTransformation methods
+    //
+    Submodel FoldConstantSubgraphsTransformation::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        auto constantValuedNodes = GetConstantValuedNodes(submodel, context);
+
+        // Every constant-valued (non-constant) node is replaced by constant nodes holding its
+        // precomputed outputs; interior nodes of a folded chain become dead and are left for the
+        // redundant-node elimination that runs later
+        auto result = transformer.TransformSubmodelOnto(submodel, {}, context, [&](const Node& node, ModelTransformer& transformer) {
+            if (constantValuedNodes.find(&node) != constantValuedNodes.end() && !IsConstantNode(node))
+            {
+                Log() << "Folding constant node " << node.GetId() << " (" << node.GetRuntimeTypeName() << ")" << std::endl;
+                FoldNode(node, transformer);
+                return;
+            }
+            transformer.CopyNode(node);
+        });
+        return result;
+    }
+} // namespace passes
+} // namespace ell
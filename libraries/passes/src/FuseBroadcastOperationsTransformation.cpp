@@ -0,0 +1,237 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FuseBroadcastOperationsTransformation.cpp (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FuseBroadcastOperationsTransformation.h"
+
+#include <model/include/ModelTransformer.h>
+
+#include <nodes/include/BroadcastOperationNodes.h>
+#include <nodes/include/FusedBroadcastOperationNode.h>
+
+#include <utilities/include/StlVectorUtil.h>
+
+#include <vector>
+
+using namespace ell;
+using namespace ell::model;
+
+//
+// Implementation
+//
+namespace
+{
+template <typename Container, typename Function>
+auto Transform(const Container& container, Function fn)
+{
+    return utilities::TransformVector(container.begin(), container.end(), fn);
+}
+
+std::vector<const OutputPortBase*> GetReferencedPorts(const std::vector<const InputPortBase*>& inputs)
+{
+    return Transform(inputs, [](auto input) { return &input->GetReferencedPort(); });
+}
+
+// Collects the inputs and the operation list for a fused kernel, using the argument encoding of
+// `FusedOperation`: non-negative arguments refer to the results of earlier operations, negative
+// arguments to the kernel's inputs
+template <typename ValueType>
+struct FusedKernelBuilder
+{
+    std::vector<const OutputPortBase*> inputs;
+    std::vector<nodes::FusedOperation> operations;
+
+    int AddInput(const OutputPortBase& port)
+    {
+        for (int index = 0; index < static_cast<int>(inputs.size()); ++index)
+        {
+            if (inputs[index] == &port)
+            {
+                return -1 - index; // already an input; share it
+            }
+        }
+        inputs.push_back(&port);
+        return -1 - (static_cast<int>(inputs.size()) - 1);
+    }
+
+    // Appends the operations computing `port` (a port in the new model) if `mayFuse` and its
+    // source is an elementwise node; otherwise adds the port as a kernel input. Returns the
+    // argument encoding of the result.
+    int AddArgument(const OutputPortBase& port, bool mayFuse)
+    {
+        if (mayFuse)
+        {
+            auto sourceNode = port.GetNode();
+            if (auto unaryNode = dynamic_cast<const nodes::BroadcastUnaryOperationNode<ValueType>*>(sourceNode))
+            {
+                int argument = AddInput(unaryNode->GetInputPorts()[0]->GetReferencedPort());
+                operations.push_back({ 1, static_cast<int>(unaryNode->GetOperation()), argument, 0 });
+                return static_cast<int>(operations.size()) - 1;
+            }
+            if (auto binaryNode = dynamic_cast<const nodes::BroadcastBinaryOperationNode<ValueType>*>(sourceNode))
+            {
+                int argument1 = AddInput(binaryNode->GetInputPorts()[0]->GetReferencedPort());
+                int argument2 = AddInput(binaryNode->GetInputPorts()[1]->GetReferencedPort());
+                operations.push_back({ 2, static_cast<int>(binaryNode->GetOperation()), argument1, argument2 });
+                return static_cast<int>(operations.size()) - 1;
+            }
+            if (auto fusedNode = dynamic_cast<const nodes::FusedBroadcastOperationNode<ValueType>*>(sourceNode))
+            {
+                // Splice in the already-fused kernel, remapping its argument encodings into ours
+                std::vector<int> inputMap;
+                for (auto input : fusedNode->GetInputPorts())
+                {
+                    inputMap.push_back(AddInput(input->GetReferencedPort()));
+                }
+                const int resultOffset = static_cast<int>(operations.size());
+                for (auto op : fusedNode->GetOperations())
+                {
+                    op.argument1 = op.argument1 < 0 ? inputMap[-1 - op.argument1] : op.argument1 + resultOffset;
+                    op.argument2 = op.argument2 < 0 ? inputMap[-1 - op.argument2] : op.argument2 + resultOffset;
+                    operations.push_back(op);
+                }
+                return static_cast<int>(operations.size()) - 1;
+            }
+        }
+        return AddInput(port);
+    }
+};
+
+template <typename ValueType>
+bool IsElementwiseNode(const Node* node)
+{
+    return dynamic_cast<const nodes::BroadcastUnaryOperationNode<ValueType>*>(node) != nullptr ||
+           dynamic_cast<const nodes::BroadcastBinaryOperationNode<ValueType>*>(node) != nullptr ||
+           dynamic_cast<const nodes::FusedBroadcastOperationNode<ValueType>*>(node) != nullptr;
+}
+
+// An upstream result can be folded into the fused kernel if it's computed elementwise over the
+// same iteration space (or a broadcast subset of it)
+bool LayoutsAgree(const PortMemoryLayout& sourceLayout, const PortMemoryLayout& outputLayout)
+{
+    if (sourceLayout.NumDimensions() != outputLayout.NumDimensions())
+    {
+        return false;
+    }
+    for (int d = 0; d < outputLayout.NumDimensions(); ++d)
+    {
+        auto sourceSize = sourceLayout.GetLogicalDimensionActiveSize(d);
+        if (sourceSize != outputLayout.GetLogicalDimensionActiveSize(d) && sourceSize != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// returns 'true' if we handled the situation, else 'false'. If we return 'false', keep trying other ValueTypes
+template <typename ValueType>
+bool TryFuseBroadcastOperations(const model::Node& node, model::ModelTransformer& transformer)
+{
+    auto unaryNode = dynamic_cast<const nodes::BroadcastUnaryOperationNode<ValueType>*>(&node);
+    auto binaryNode = dynamic_cast<const nodes::BroadcastBinaryOperationNode<ValueType>*>(&node);
+    if (unaryNode == nullptr && binaryNode == nullptr)
+    {
+        return false;
+    }
+
+    const OutputPortBase& nodeOutput = *node.GetOutputPorts()[0];
+    auto outputLayout = nodeOutput.GetMemoryLayout();
+    if (outputLayout.HasPadding())
+    {
+        return false; // the fused kernel only writes active elements
+    }
+
+    // Decide, per input, whether the already-transformed source can be folded into the kernel.
+    // Fusing an input with other consumers would recompute it, so leave those alone.
+    auto inputPorts = node.GetInputPorts();
+    std::vector<const OutputPortBase*> newInputSources;
+    std::vector<bool> fusable;
+    bool anyFusable = false;
+    for (auto inputPort : inputPorts)
+    {
+        const auto& referencedPort = inputPort->GetReferencedPort();
+        const auto& newPort = transformer.GetCorrespondingOutputs(referencedPort);
+        bool canFuse = IsElementwiseNode<ValueType>(newPort.GetNode()) && referencedPort.GetNode()->GetDependentNodes().size() == 1 && LayoutsAgree(newPort.GetMemoryLayout(), outputLayout);
+        newInputSources.push_back(&newPort);
+        fusable.push_back(canFuse);
+        anyFusable |= canFuse;
+    }
+    if (!anyFusable)
+    {
+        return false; // nothing to fuse with; copy the node as-is (a later node may fuse into it)
+    }
+
+    FusedKernelBuilder<ValueType> builder;
+    std::vector<int> arguments;
+    for (size_t index = 0; index < newInputSources.size(); ++index)
+    {
+        arguments.push_back(builder.AddArgument(*newInputSources[index], fusable[index]));
+    }
+    if (unaryNode != nullptr)
+    {
+        builder.operations.push_back({ 1, static_cast<int>(unaryNode->GetOperation()), arguments[0], 0 });
+    }
+    else
+    {
+        builder.operations.push_back({ 2, static_cast<int>(binaryNode->GetOperation()), arguments[0], arguments[1] });
+    }
+
+    auto newNode = transformer.AddNode<nodes::FusedBroadcastOperationNode<ValueType>>(builder.inputs, builder.operations, outputLayout);
+    newNode->GetMetadata() = node.GetMetadata();
+    transformer.MapNodeOutput(nodeOutput, newNode->output);
+    return true;
+}
+
+void FuseBroadcastOperations(const model::Node& node, model::ModelTransformer& transformer)
+{
+    if (TryFuseBroadcastOperations<float>(node, transformer))
+    {
+        return;
+    }
+    if (TryFuseBroadcastOperations<double>(node, transformer))
+    {
+        return;
+    }
+    transformer.CopyNode(node);
+}
+} // namespace
+
+//
+// FuseBroadcastOperationsTransformation methods
+//
+namespace ell
+{
+namespace passes
+{
+    Submodel FuseBroadcastOperationsTransformation::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        auto compiler = context.GetCompiler();
+        if (!compiler)
+        {
+            return submodel;
+        }
+
+        auto onto = GetReferencedPorts(submodel.GetInputs());
+        auto destModel = submodel.GetModel().ShallowCopy();
+        auto result = transformer.TransformSubmodelOnto(submodel, destModel, onto, context, [compiler](const Node& node, ModelTransformer& transformer) {
+            bool canFuseNodes = compiler->GetModelOptimizerOptions(node).GetEntry<bool>("fuseBroadcastOperations", true);
+
+            if (canFuseNodes)
+            {
+                FuseBroadcastOperations(node, transformer);
+            }
+            else
+            {
+                transformer.CopyNode(node);
+            }
+        });
+
+        return result;
+    }
+} // namespace passes
+} // namespace ell
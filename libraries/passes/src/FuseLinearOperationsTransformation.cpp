@@ -11,6 +11,9 @@
 #include <model/include/ModelTransformer.h>
 
 #include <nodes/include/BroadcastFunctionNode.h>
+#include <nodes/include/ConstantNode.h>
+#include <nodes/include/MatrixMatrixMultiplyCodeNode.h>
+#include <nodes/include/MatrixMatrixMultiplyNode.h>
 
 #include <utilities/include/Exception.h>
 #include <utilities/include/StlVectorUtil.h>
@@ -208,6 +211,100 @@ LinearCoefficients<ValueType> GetCombinedLinearCoeffs(const nodes::BroadcastLine
     return coefficients;
 }
 
+// Attempts to fold a linear function with constant coefficients into the constant left-hand
+// matrix of the matrix multiply feeding its primary input. This is the shape a batch
+// normalization (or other per-channel scale/bias) layer takes after a convolutional layer has
+// been refined into an im2col-style matrix multiply: the multiply's rows are indexed by filter,
+// so scaling output channel f is the same as scaling row f of the weights. Any bias is kept as
+// a (cheaper) bias-only linear function node.
+// Returns 'true' if it folded the node, else 'false'.
+template <typename ValueType, typename MatrixMultiplyNodeType>
+bool TryFoldLinearFunctionIntoGemmWeights(const nodes::BroadcastLinearFunctionNode<ValueType>& node, model::ModelTransformer& transformer)
+{
+    // If the multiply's output is used elsewhere, we can't rewrite its weights
+    if (node.primaryInput.GetReferencedPort().GetNode()->GetDependentNodes().size() != 1)
+    {
+        return false;
+    }
+
+    const auto& primaryInputElements = transformer.GetCorrespondingInputs(node.primaryInput);
+    auto gemmNode = dynamic_cast<const MatrixMultiplyNodeType*>(primaryInputElements.GetNode());
+    if (gemmNode == nullptr)
+    {
+        return false;
+    }
+
+    // Only handle the layout the convolution refinement emits: untransposed row-major weights,
+    // output stored densely with the filter (row) index fastest-moving
+    const int m = gemmNode->GetM();
+    const int n = gemmNode->GetN();
+    const int k = gemmNode->GetK();
+    if (gemmNode->GetTranspose1() || !gemmNode->GetTransposeOutput() || gemmNode->GetMatrix1Stride() != k || gemmNode->GetOutputMatrixStride() != m)
+    {
+        return false;
+    }
+
+    // The function must broadcast over the fastest-moving dimension, with one coefficient per row
+    auto inputLayout = node.GetInputMemoryLayout();
+    int broadcastDimension = static_cast<int>(node.GetBroadcastDimension());
+    if (broadcastDimension != inputLayout.NumDimensions() - 1 || !inputLayout.IsCanonicalOrder() || inputLayout.GetLogicalDimensionActiveSize()[broadcastDimension] != m || inputLayout.GetMemorySize() != static_cast<size_t>(m) * n)
+    {
+        return false;
+    }
+
+    auto coeffNodes = GetConstantSecondaryInputNodes(node);
+    if (coeffNodes.scaleNode == nullptr || static_cast<int>(coeffNodes.scaleNode->GetValues().size()) != m)
+    {
+        return false; // nothing to fold into the weights
+    }
+
+    auto weightsNode = dynamic_cast<const nodes::ConstantNode<ValueType>*>(gemmNode->input1.GetReferencedPort().GetNode());
+    if (weightsNode == nullptr || static_cast<int>(weightsNode->GetValues().size()) != m * k)
+    {
+        return false;
+    }
+
+    const auto& scale = coeffNodes.scaleNode->GetValues();
+    auto newWeightsValues = weightsNode->GetValues();
+    for (int row = 0; row < m; ++row)
+    {
+        for (int column = 0; column < k; ++column)
+        {
+            newWeightsValues[row * k + column] *= scale[row];
+        }
+    }
+
+    const auto& newWeights = nodes::Constant(transformer, newWeightsValues);
+    auto newGemmNode = transformer.AddNode<MatrixMultiplyNodeType>(newWeights,
+                                                                   m,
+                                                                   n,
+                                                                   k,
+                                                                   gemmNode->GetMatrix1Stride(),
+                                                                   false,
+                                                                   gemmNode->input2.GetReferencedPort(),
+                                                                   gemmNode->GetMatrix2Stride(),
+                                                                   gemmNode->GetTranspose2(),
+                                                                   gemmNode->GetOutputMatrixStride(),
+                                                                   true);
+    if (coeffNodes.biasNode != nullptr)
+    {
+        const auto& scaleValues = nodes::Constant(transformer, std::vector<ValueType>{}); // signal there's no scale (scale = 1)
+        const auto& biasValues = nodes::Constant(transformer, coeffNodes.biasNode->GetValues());
+        auto newBiasNode = transformer.AddNode<nodes::BroadcastLinearFunctionNode<ValueType>>(newGemmNode->output,
+                                                                                              node.GetInputMemoryLayout(),
+                                                                                              scaleValues,
+                                                                                              biasValues,
+                                                                                              node.GetBroadcastDimension(),
+                                                                                              node.GetOutputMemoryLayout());
+        transformer.MapNodeOutput(node.output, newBiasNode->output);
+    }
+    else
+    {
+        transformer.MapNodeOutput(node.output, newGemmNode->output);
+    }
+    return true;
+}
+
 // returns 'true' if we handled the situation, else 'false'. If we return 'false', keep trying other ValueTypes
 template <typename ValueType>
 bool TryCombineLinearFunctionNodes(const model::Node& node, model::ModelTransformer& transformer)
@@ -220,6 +317,16 @@ bool TryCombineLinearFunctionNodes(const model::Node& node, model::ModelTransfor
 
     if (!CanCombineWithPrimaryInput(*thisNode))
     {
+        // The primary input isn't another linear function, but it may be a matrix multiply with
+        // constant weights (a refined convolution) that our coefficients can fold into
+        if (HasSimpleConstantSecondaryInputs(*thisNode))
+        {
+            if (TryFoldLinearFunctionIntoGemmWeights<ValueType, nodes::MatrixMatrixMultiplyNode<ValueType>>(*thisNode, transformer) ||
+                TryFoldLinearFunctionIntoGemmWeights<ValueType, nodes::MatrixMatrixMultiplyCodeNode<ValueType>>(*thisNode, transformer))
+            {
+                return true;
+            }
+        }
         return false;
     }
 
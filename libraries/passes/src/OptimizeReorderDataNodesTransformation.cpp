@@ -10,6 +10,7 @@
 
 #include <model/include/ModelTransformer.h>
 
+#include <nodes/include/ConstantNode.h>
 #include <nodes/include/ReorderDataCodeNode.h>
 
 #include <utilities/include/Exception.h>
@@ -37,6 +38,35 @@ namespace passes
         {
             return Transform(inputs, [](auto input) { return &input->GetReferencedPort(); });
         }
+
+        // Applies the layout permutation performed by a chain of ReorderDataNodes to a constant
+        // buffer at transform time. Every active entry is copied to its location in the output
+        // layout and the inactive (padding) area is filled with the padding value.
+        template <typename ValueType>
+        std::vector<ValueType> ReorderConstantData(const std::vector<ValueType>& values, const MemoryLayout& inputLayout, const MemoryLayout& outputLayout, ValueType paddingValue)
+        {
+            std::vector<ValueType> reorderedValues(outputLayout.GetMemorySize(), paddingValue);
+
+            auto logicalSize = inputLayout.GetLogicalDimensionActiveSize();
+            int numDimensions = logicalSize.NumDimensions();
+            std::vector<int> coordinates(numDimensions, 0);
+            for (bool done = false; !done;)
+            {
+                MemoryCoordinates logicalCoordinates(coordinates);
+                reorderedValues[outputLayout.GetLogicalEntryOffset(logicalCoordinates)] = values[inputLayout.GetLogicalEntryOffset(logicalCoordinates)];
+
+                // advance to the next logical coordinate in the active area
+                int dimension = numDimensions - 1;
+                while (dimension >= 0 && ++coordinates[dimension] == logicalSize[dimension])
+                {
+                    coordinates[dimension] = 0;
+                    --dimension;
+                }
+                done = dimension < 0;
+            }
+
+            return reorderedValues;
+        }
     } // namespace
 
     struct OptimizeReorderDataNodesTransformation::State
@@ -109,6 +139,21 @@ namespace passes
                     const auto& correspondingParentOutput = transformer.GetCorrespondingOutputs(*parentOutput);
                     transformer.MapNodeOutput(*finalOutputPort, correspondingParentOutput);
                 }
+                else if (auto constantNode = dynamic_cast<const ConstantNode<ValueType>*>(node.input.GetInputElement(0).ReferencedPort()->GetNode());
+                         constantNode != nullptr &&
+                         constantNode->GetValues().size() == inputLayout.GetMemorySize() &&
+                         inputLayout.GetLogicalDimensionActiveSize() == outputLayout.GetLogicalDimensionActiveSize())
+                {
+                    // if the chain permutes the output of a constant node, apply the permutation to the
+                    // constant's data at transform time instead of emitting a runtime copy
+                    auto reorderedValues = ReorderConstantData(constantNode->GetValues(), inputLayout, outputLayout, node.GetPaddingValue());
+                    const auto& foldedOutput = Constant(transformer, reorderedValues, outputLayout);
+                    transformer.MapNodeOutput(*finalOutputPort, foldedOutput);
+
+                    Log() << "ReorderDataNode chain permutes the output of ConstantNode [id = " << constantNode->GetId().ToString()
+                          << "]. Entire chain is being folded into a new ConstantNode [id = "
+                          << foldedOutput.GetNode()->GetId() << "]" << EOL;
+                }
                 else
                 {
                     // otherwise, create a new reorder node and use the input to the chain and map its output to the
@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     OptimizeTypeCastsTransformation.cpp (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "OptimizeTypeCastsTransformation.h"
+
+#include <model/include/ModelTransformer.h>
+
+#include <nodes/include/TypeCastNode.h>
+
+#include <utilities/include/Logger.h>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace ell
+{
+namespace passes
+{
+    using namespace model;
+    using namespace utilities::logging;
+    using utilities::logging::Log;
+
+    namespace
+    {
+        bool IsTypeCastNode(const Node& node)
+        {
+            return node.GetRuntimeTypeName().find("TypeCastNode") == 0;
+        }
+
+        bool IsNodeEnabled(const Node& node, const TransformContext& context)
+        {
+            auto compiler = context.GetCompiler();
+            if (compiler)
+            {
+                return compiler->GetModelOptimizerOptions(node).GetEntry<bool>("optimizeTypeCasts", true);
+            }
+            return true;
+        }
+
+        // A From -> To cast is exact when To can represent every value of From
+        template <typename From, typename To>
+        constexpr bool IsLosslessCast()
+        {
+            return std::is_same<From, To>::value ||
+                   std::is_same<From, bool>::value ||
+                   (std::is_same<From, int>::value && (std::is_same<To, std::int64_t>::value || std::is_same<To, double>::value)) ||
+                   (std::is_same<From, float>::value && std::is_same<To, double>::value);
+        }
+
+        // If `source` (in the new model) is itself the output of a cast from SourceValueType,
+        // hook the intermediate cast out of the chain: the node's output becomes a single cast
+        // from the original value (or that value itself, when the types match). The inner cast
+        // is left to be cleaned up as a dead node if nothing else reads it.
+        template <typename SourceValueType, typename InputValueType, typename OutputValueType>
+        bool TryCollapseCastChain(const nodes::TypeCastNode<InputValueType, OutputValueType>& node, const OutputPort<InputValueType>& source, ModelTransformer& transformer)
+        {
+            auto innerCast = dynamic_cast<const nodes::TypeCastNode<SourceValueType, InputValueType>*>(source.GetNode());
+            if (innerCast == nullptr)
+            {
+                return false;
+            }
+
+            // Collapsing re-reads the original value, so it must not undo a deliberate
+            // conversion: allow it when the inner cast was exact, or when it only moved between
+            // floating-point precisions (the churn this pass exists to remove). Casts through
+            // integer types are truncations and stay.
+            if (!(IsLosslessCast<SourceValueType, InputValueType>() || (std::is_floating_point<SourceValueType>::value && std::is_floating_point<InputValueType>::value)))
+            {
+                return false;
+            }
+
+            const auto& innerSource = innerCast->input.GetReferencedPort();
+            if constexpr (std::is_same<SourceValueType, OutputValueType>::value)
+            {
+                transformer.MapNodeOutput(node.output, innerSource);
+            }
+            else
+            {
+                auto newNode = transformer.AddNode<nodes::TypeCastNode<SourceValueType, OutputValueType>>(innerSource);
+                transformer.MapNodeOutput(node.output, newNode->output);
+            }
+            return true;
+        }
+
+        // Returns true if the node is a TypeCastNode<InputValueType, OutputValueType>; sets
+        // `optimized` if its output was mapped to something cheaper than a copy of the cast
+        template <typename InputValueType, typename OutputValueType>
+        bool TryOptimizeTypeCastNode(const Node& node, ModelTransformer& transformer, bool& optimized)
+        {
+            auto castNode = dynamic_cast<const nodes::TypeCastNode<InputValueType, OutputValueType>*>(&node);
+            if (castNode == nullptr)
+            {
+                return false;
+            }
+
+            const auto& source = transformer.GetCorrespondingInputs(castNode->input);
+            if constexpr (std::is_same<InputValueType, OutputValueType>::value)
+            {
+                // a cast to the port's own type: pass the source straight through
+                transformer.MapNodeOutput(castNode->output, source);
+                optimized = true;
+            }
+            else
+            {
+                optimized = TryCollapseCastChain<bool>(*castNode, source, transformer) ||
+                            TryCollapseCastChain<int>(*castNode, source, transformer) ||
+                            TryCollapseCastChain<std::int64_t>(*castNode, source, transformer) ||
+                            TryCollapseCastChain<float>(*castNode, source, transformer) ||
+                            TryCollapseCastChain<double>(*castNode, source, transformer);
+            }
+            return true;
+        }
+
+        template <typename InputValueType>
+        bool TryOptimizeTypeCastNodeFrom(const Node& node, ModelTransformer& transformer, bool& optimized)
+        {
+            return TryOptimizeTypeCastNode<InputValueType, bool>(node, transformer, optimized) ||
+                   TryOptimizeTypeCastNode<InputValueType, int>(node, transformer, optimized) ||
+                   TryOptimizeTypeCastNode<InputValueType, std::int64_t>(node, transformer, optimized) ||
+                   TryOptimizeTypeCastNode<InputValueType, float>(node, transformer, optimized) ||
+                   TryOptimizeTypeCastNode<InputValueType, double>(node, transformer, optimized);
+        }
+
+        bool TryOptimizeTypeCast(const Node& node, ModelTransformer& transformer)
+        {
+            bool optimized = false;
+            bool matched = TryOptimizeTypeCastNodeFrom<bool>(node, transformer, optimized) ||
+                           TryOptimizeTypeCastNodeFrom<int>(node, transformer, optimized) ||
+                           TryOptimizeTypeCastNodeFrom<std::int64_t>(node, transformer, optimized) ||
+                           TryOptimizeTypeCastNodeFrom<float>(node, transformer, optimized) ||
+                           TryOptimizeTypeCastNodeFrom<double>(node, transformer, optimized);
+            return matched && optimized;
+        }
+    } // namespace
+
+    //
+    // OptimizeTypeCastsTransformation methods
+    //
+    Submodel OptimizeTypeCastsTransformation::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        auto result = transformer.TransformSubmodelOnto(submodel, {}, context, [&](const Node& node, ModelTransformer& transformer) {
+            if (IsTypeCastNode(node) && IsNodeEnabled(node, context) && TryOptimizeTypeCast(node, transformer))
+            {
+                Log() << "Optimized type cast node " << node.GetId() << " (" << node.GetRuntimeTypeName() << ")" << std::endl;
+                return;
+            }
+            transformer.CopyNode(node);
+        });
+        return result;
+    }
+} // namespace passes
+} // namespace ell
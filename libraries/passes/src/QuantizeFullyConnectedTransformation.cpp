@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     QuantizeFullyConnectedTransformation.cpp (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "QuantizeFullyConnectedTransformation.h"
+
+#include <model/include/ModelTransformer.h>
+
+#include <nodes/include/FixedPointFullyConnectedNode.h>
+#include <nodes/include/FullyConnectedLayerNode.h>
+
+#include <utilities/include/Logger.h>
+#include <utilities/include/StlVectorUtil.h>
+
+#include <vector>
+
+namespace ell
+{
+namespace passes
+{
+    using namespace model;
+    using namespace utilities::logging;
+    using utilities::logging::Log;
+
+    namespace
+    {
+        template <typename Container, typename Function>
+        auto Transform(const Container& container, Function fn)
+        {
+            return utilities::TransformVector(container.begin(), container.end(), fn);
+        }
+
+        std::vector<const OutputPortBase*> GetReferencedPorts(const std::vector<const InputPortBase*>& inputs)
+        {
+            return Transform(inputs, [](auto input) { return &input->GetReferencedPort(); });
+        }
+
+        bool IsFullyConnectedLayerNode(const Node& node)
+        {
+            return (node.GetRuntimeTypeName().find("FullyConnectedLayerNode") == 0);
+        }
+
+        // returns 'true' if we handled the situation, else 'false'. If we return 'false', keep trying other ValueTypes.
+        template <typename ValueType>
+        bool TryQuantizeFullyConnected(const model::Node& node, model::ModelTransformer& transformer, double inputRange)
+        {
+            auto thisNode = dynamic_cast<const nodes::FullyConnectedLayerNode<ValueType>*>(&node);
+            if (thisNode == nullptr)
+            {
+                return false;
+            }
+
+            const auto& newInput = transformer.GetCorrespondingInputs(thisNode->input);
+            const auto& weights = thisNode->GetLayer().GetWeights();
+
+            // The fixed-point node multiplies the (unpadded) input vector directly against the
+            // weight rows, so bail out if the input isn't a plain contiguous vector
+            if (newInput.Size() != weights.NumColumns())
+            {
+                return false;
+            }
+
+            auto newNode = transformer.AddNode<nodes::FixedPointFullyConnectedNode<ValueType>>(newInput, weights, static_cast<ValueType>(inputRange));
+            newNode->GetMetadata() = node.GetMetadata();
+
+            Log() << "Quantized fully-connected layer to fixed point for node " << thisNode->GetId() << std::endl;
+            transformer.MapNodeOutput(thisNode->output, newNode->output);
+            return true;
+        }
+
+        void QuantizeFullyConnected(const model::Node& node, model::ModelTransformer& transformer, double inputRange)
+        {
+            if (TryQuantizeFullyConnected<float>(node, transformer, inputRange))
+            {
+                return;
+            }
+            if (TryQuantizeFullyConnected<double>(node, transformer, inputRange))
+            {
+                return;
+            }
+
+            transformer.CopyNode(node);
+        }
+    } // namespace
+
+    //
+    // QuantizeFullyConnectedTransformation methods
+    //
+    Submodel QuantizeFullyConnectedTransformation::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        // Replace any FullyConnectedLayerNodes that opted in, using an in-place transformation
+        auto onto = transformer.GetCorrespondingOutputs(GetReferencedPorts(submodel.GetInputs()));
+        model::Model destModel = submodel.GetModel().ShallowCopy();
+        auto result = transformer.TransformSubmodelOnto(submodel, destModel, onto, context, [context](const Node& node, ModelTransformer& transformer) {
+            bool useFixedPoint = false;
+            double inputRange = 1.0;
+            auto compiler = context.GetCompiler();
+            if (compiler)
+            {
+                auto options = compiler->GetModelOptimizerOptions(node);
+                useFixedPoint = options.GetEntry<bool>("useFixedPointFullyConnected", false);
+                inputRange = options.GetEntry<double>("fixedPointInputRange", inputRange);
+            }
+
+            if (useFixedPoint && IsFullyConnectedLayerNode(node))
+            {
+                QuantizeFullyConnected(node, transformer, inputRange);
+            }
+            else
+            {
+                transformer.CopyNode(node);
+            }
+        });
+        return result;
+    }
+} // namespace passes
+} // namespace ell
@@ -8,6 +8,9 @@
 
 #include "SetConvolutionMethodTransformation.h"
 
+#include <emitters/include/TargetDevice.h>
+
+#include <model/include/MapCompiler.h>
 #include <model/include/ModelTransformer.h>
 #include <model/include/RefineTransformation.h>
 
@@ -69,6 +72,24 @@ namespace passes
             }
         }
 
+        // Depthwise-separable layers (one channel per filter, one filter per input channel ---
+        // the MobileNet pattern) have a direct channel-major lowering via the simple method
+        // (`SpatialConvolutionNode`); the unrolled and diagonal paths would run them one channel
+        // at a time, with the full im2col overhead on each.
+        template <typename ValueType>
+        bool IsDepthwiseSeparable(const nodes::ConvolutionalLayerNode<ValueType>& node)
+        {
+            const auto& weights = node.GetLayer().GetWeights();
+            auto inputChannels = node.GetInputMemoryLayout().GetLogicalDimensionActiveSize(2);
+            auto outputChannels = node.GetOutputMemoryLayout().GetLogicalDimensionActiveSize(2);
+            return weights.NumChannels() == 1 && inputChannels == outputChannels;
+        }
+
+        bool HasDepthwiseSeparablePath(predictors::neural::ConvolutionMethod method)
+        {
+            return method == predictors::neural::ConvolutionMethod::simple || method == predictors::neural::ConvolutionMethod::winograd;
+        }
+
         bool IsMethodCompatible(predictors::neural::ConvolutionMethod method, const predictors::neural::ConvolutionalParameters& convolutionalParameters)
         {
             if (method == predictors::neural::ConvolutionMethod::winograd)
@@ -87,7 +108,7 @@ namespace passes
 
         // returns 'true' if we handled the situation, else 'false'. If we return 'false', keep trying other ValueTypes.
         template <typename ValueType>
-        bool TrySetConvolutionMethod(const model::Node& node, model::ModelTransformer& transformer, model::PreferredConvolutionMethod preferredMethod)
+        bool TrySetConvolutionMethod(const model::Node& node, model::ModelTransformer& transformer, model::PreferredConvolutionMethod preferredMethod, int winogradTileSize, const emitters::DeviceCapabilities& capabilities)
         {
             auto thisNode = dynamic_cast<const nodes::ConvolutionalLayerNode<ValueType>*>(&node);
             if (thisNode == nullptr)
@@ -95,13 +116,56 @@ namespace passes
                 return false;
             }
 
+            bool depthwiseSeparable = IsDepthwiseSeparable(*thisNode);
+
+            // Strided (downsampling) layers also prefer the direct simple path: the unrolled
+            // method materializes an im2col matrix stride^2 times larger than the useful output
+            bool strided = thisNode->GetLayer().GetConvolutionalParameters().stride > 1;
+
+            // 1x1 unit-stride (pointwise) layers are exactly a GEMM over the channel-minor
+            // input, which is what the unrolled path lowers them to --- with no
+            // receptive-field materialization, since the input already is the unrolled matrix
+            bool pointwise = thisNode->GetLayer().GetConvolutionalParameters().receptiveField == 1 && !strided;
+
+            // 3x3 unit-stride layers take the Winograd path on devices whose capabilities say the
+            // transformed-domain multiplies pay off: a SIMD unit with fused multiply-add, and
+            // enough L1 cache to hold the transformed tiles. On unknown devices the capability
+            // fields are zero and the method is left as it was.
+            bool winogradFriendly = thisNode->GetLayer().GetConvolutionalParameters().receptiveField == 3 &&
+                                    !strided &&
+                                    capabilities.simdRegisterBytes != 0 &&
+                                    capabilities.hasFusedMultiplyAdd &&
+                                    capabilities.l1DataCacheSize >= 32 * 1024;
+
+            if (preferredMethod == model::PreferredConvolutionMethod::automatic && !depthwiseSeparable && !strided && !pointwise && !winogradFriendly)
+            {
+                return false;
+            }
+
             const auto& newInput = transformer.GetCorrespondingInputs(thisNode->input);
             const auto& layer = thisNode->GetLayer();
 
             auto layerParameters = layer.GetLayerParameters();
             auto convolutionalParameters = layer.GetConvolutionalParameters();
 
-            auto method = GetConvolutionMethod(preferredMethod);
+            auto method = predictors::neural::ConvolutionMethod::simple;
+            if (preferredMethod != model::PreferredConvolutionMethod::automatic)
+            {
+                method = GetConvolutionMethod(preferredMethod);
+            }
+            else if (pointwise && !depthwiseSeparable)
+            {
+                method = predictors::neural::ConvolutionMethod::unrolled;
+            }
+            else if (winogradFriendly)
+            {
+                method = predictors::neural::ConvolutionMethod::winograd;
+            }
+            if (depthwiseSeparable && !HasDepthwiseSeparablePath(method))
+            {
+                Log() << "Selecting the direct depthwise-separable convolution path for node " << thisNode->GetId() << std::endl;
+                method = predictors::neural::ConvolutionMethod::simple;
+            }
             convolutionalParameters.method = method;
             if (!IsMethodCompatible(method, convolutionalParameters))
             {
@@ -113,24 +177,26 @@ namespace passes
             // TODO: just copy the node and modify its layer
             auto newNode = transformer.AddNode<nodes::ConvolutionalLayerNode<ValueType>>(newInput, newLayer);
             newNode->GetMetadata() = node.GetMetadata();
+            if (method == predictors::neural::ConvolutionMethod::winograd)
+            {
+                // Record the chosen output tile size, for `ConvolutionalLayerNode::Refine` to pick up
+                newNode->GetMetadata()["winogradTileSize"] = winogradTileSize;
+            }
 
             Log() << "Setting convolution method to " << static_cast<int>(method) << " for node " << thisNode->GetId() << std::endl;
             transformer.MapNodeOutput(thisNode->output, newNode->output);
             return true;
         }
 
-        void SetConvolutionMethod(const model::Node& node, model::ModelTransformer& transformer, model::PreferredConvolutionMethod preferredMethod)
+        void SetConvolutionMethod(const model::Node& node, model::ModelTransformer& transformer, model::PreferredConvolutionMethod preferredMethod, int winogradTileSize, const emitters::DeviceCapabilities& capabilities)
         {
-            if (preferredMethod != model::PreferredConvolutionMethod::automatic)
+            if (TrySetConvolutionMethod<float>(node, transformer, preferredMethod, winogradTileSize, capabilities))
             {
-                if (TrySetConvolutionMethod<float>(node, transformer, preferredMethod))
-                {
-                    return;
-                }
-                if (TrySetConvolutionMethod<double>(node, transformer, preferredMethod))
-                {
-                    return;
-                }
+                return;
+            }
+            if (TrySetConvolutionMethod<double>(node, transformer, preferredMethod, winogradTileSize, capabilities))
+            {
+                return;
             }
 
             transformer.CopyNode(node);
@@ -159,13 +225,28 @@ namespace passes
         model::Model destModel = result1.GetModel().ShallowCopy();
         auto result2 = transformer.TransformSubmodelOnto(result1, destModel, onto, context, [context](const Node& node, ModelTransformer& transformer) {
             model::PreferredConvolutionMethod preferredMethod = model::PreferredConvolutionMethod::automatic;
+            int winogradTileSize = 2;
+            emitters::DeviceCapabilities capabilities;
             auto compiler = context.GetCompiler();
             if (compiler)
             {
-                preferredMethod = compiler->GetModelOptimizerOptions(node).GetEntry<PreferredConvolutionMethod>("preferredConvolutionMethod", PreferredConvolutionMethod::automatic);
+                capabilities = emitters::GetDeviceCapabilities(compiler->GetMapCompilerOptions(node).compilerSettings.targetDevice);
+
+                auto options = compiler->GetModelOptimizerOptions(node);
+                preferredMethod = options.GetEntry<PreferredConvolutionMethod>("preferredConvolutionMethod", PreferredConvolutionMethod::automatic);
+                if (options.HasEntry("winogradTileSize"))
+                {
+                    winogradTileSize = options.GetEntry<int>("winogradTileSize", 2);
+                }
+                else if (capabilities.l2CacheSize >= 512 * 1024)
+                {
+                    // larger output tiles amortize the input/output transforms over more useful
+                    // work, at the cost of a bigger transformed working set
+                    winogradTileSize = 4;
+                }
             }
 
-            SetConvolutionMethod(node, transformer, preferredMethod);
+            SetConvolutionMethod(node, transformer, preferredMethod, winogradTileSize, capabilities);
         });
 
         // Finally, refine any ConvolutionalLayerNodes
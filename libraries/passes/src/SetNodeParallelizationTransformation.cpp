@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SetNodeParallelizationTransformation.cpp (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SetNodeParallelizationTransformation.h"
+
+#include <model/include/MapCompiler.h>
+#include <model/include/ModelTransformer.h>
+
+#include <nodes/include/MatrixMatrixMultiplyCodeNode.h>
+#include <nodes/include/MatrixMatrixMultiplyNode.h>
+#include <nodes/include/SimpleConvolutionNode.h>
+
+#include <utilities/include/Logger.h>
+#include <utilities/include/PropertyBag.h>
+#include <utilities/include/Unused.h>
+
+#include <cstdint>
+
+namespace ell
+{
+namespace passes
+{
+    using namespace model;
+    using utilities::logging::Log;
+
+    namespace
+    {
+        bool IsPoolingLayerNode(const Node& node)
+        {
+            return (node.GetRuntimeTypeName().find("PoolingLayerNode") == 0);
+        }
+
+        // Estimates the number of arithmetic ops the node performs per evaluation. Returns 'false' for
+        // node types we don't have an estimate for.
+        template <typename ValueType>
+        bool TryEstimateNodeCost(const Node& node, int64_t& cost)
+        {
+            if (auto gemmNode = dynamic_cast<const nodes::MatrixMatrixMultiplyNode<ValueType>*>(&node))
+            {
+                cost = 2ll * gemmNode->GetM() * gemmNode->GetN() * gemmNode->GetK();
+                return true;
+            }
+            if (auto gemmCodeNode = dynamic_cast<const nodes::MatrixMatrixMultiplyCodeNode<ValueType>*>(&node))
+            {
+                cost = 2ll * gemmCodeNode->GetM() * gemmCodeNode->GetN() * gemmCodeNode->GetK();
+                return true;
+            }
+            if (auto convNode = dynamic_cast<const nodes::SimpleConvolutionComputeNode<ValueType>*>(&node))
+            {
+                // Each filter weight contributes a multiply-accumulate at each output location
+                auto outputLayout = convNode->GetOutputMemoryLayout();
+                auto numOutputLocations = static_cast<int64_t>(outputLayout.GetLogicalDimensionActiveSize(0)) * outputLayout.GetLogicalDimensionActiveSize(1);
+                cost = 2 * numOutputLocations * static_cast<int64_t>(convNode->filterWeights.Size());
+                return true;
+            }
+            return false;
+        }
+
+        bool TryEstimateNodeCost(const Node& node, int64_t& cost)
+        {
+            if (TryEstimateNodeCost<float>(node, cost) || TryEstimateNodeCost<double>(node, cost))
+            {
+                return true;
+            }
+            if (IsPoolingLayerNode(node))
+            {
+                // Pooling touches each input element roughly once
+                cost = static_cast<int64_t>(node.GetInputPort(0)->Size());
+                return true;
+            }
+            return false;
+        }
+
+        void SetParallelizeOption(Node& node, bool parallelize)
+        {
+            auto nodeOptions = node.GetMetadata().GetEntry<utilities::PropertyBag>("compileOptions", utilities::PropertyBag{});
+            nodeOptions["parallelize"] = parallelize;
+            node.GetMetadata()["compileOptions"] = nodeOptions;
+        }
+    } // namespace
+
+    //
+    // SetNodeParallelizationTransformation methods
+    //
+    Submodel SetNodeParallelizationTransformation::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        UNUSED(transformer);
+        auto compiler = context.GetCompiler();
+        if (!compiler)
+        {
+            return submodel;
+        }
+
+        auto settings = compiler->GetMapCompilerOptions();
+        if (!settings.compilerSettings.parallelize)
+        {
+            return submodel;
+        }
+
+        // Only node-local metadata changes, so the submodel can be modified in place without
+        // copying or remapping any nodes
+        auto threshold = static_cast<int64_t>(settings.parallelizeCostThreshold);
+        submodel.Visit([threshold](const Node& node) {
+            int64_t cost = 0;
+            if (TryEstimateNodeCost(node, cost))
+            {
+                auto mutableNode = const_cast<Node*>(&node);
+                SetParallelizeOption(*mutableNode, cost >= threshold);
+                Log() << "Setting parallelize option to " << (cost >= threshold) << " for node " << node.GetId() << " (estimated cost " << cost << ")" << std::endl;
+            }
+        });
+        return submodel;
+    }
+} // namespace passes
+} // namespace ell
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparsifyMatrixMultiplyTransformation.cpp (passes)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SparsifyMatrixMultiplyTransformation.h"
+
+#include <model/include/ModelTransformer.h>
+
+#include <nodes/include/ConstantNode.h>
+#include <nodes/include/MatrixVectorMultiplyNode.h>
+#include <nodes/include/SparseMatrixVectorMultiplyNode.h>
+
+#include <utilities/include/Logger.h>
+#include <utilities/include/StlVectorUtil.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace ell
+{
+namespace passes
+{
+    using namespace model;
+    using namespace utilities::logging;
+    using utilities::logging::Log;
+
+    namespace
+    {
+        template <typename Container, typename Function>
+        auto Transform(const Container& container, Function fn)
+        {
+            return utilities::TransformVector(container.begin(), container.end(), fn);
+        }
+
+        std::vector<const OutputPortBase*> GetReferencedPorts(const std::vector<const InputPortBase*>& inputs)
+        {
+            return Transform(inputs, [](auto input) { return &input->GetReferencedPort(); });
+        }
+
+        bool IsMatrixVectorMultiplyNode(const Node& node)
+        {
+            return (node.GetRuntimeTypeName().find("MatrixVectorMultiplyNode") == 0);
+        }
+
+        // returns 'true' if we handled the situation, else 'false'. If we return 'false', keep trying other ValueTypes.
+        template <typename ValueType>
+        bool TrySparsifyMatrixMultiply(const model::Node& node, model::ModelTransformer& transformer, double densityThreshold)
+        {
+            auto thisNode = dynamic_cast<const nodes::MatrixVectorMultiplyNode<ValueType>*>(&node);
+            if (thisNode == nullptr)
+            {
+                return false;
+            }
+
+            // The matrix must be a constant we can inspect at compile time
+            const auto& newMatrix = transformer.GetCorrespondingInputs(thisNode->inputMatrix);
+            auto matrixNode = dynamic_cast<const nodes::ConstantNode<ValueType>*>(newMatrix.GetNode());
+            if (matrixNode == nullptr)
+            {
+                return false;
+            }
+
+            // The sparse node multiplies contiguous rows, so bail out if the matrix has a
+            // padded stride (its element count then exceeds rows x columns)
+            auto numRows = thisNode->output.Size();
+            auto numColumns = thisNode->inputVector.Size();
+            const auto& matrixValues = matrixNode->GetValues();
+            if (matrixValues.size() != numRows * numColumns)
+            {
+                return false;
+            }
+
+            auto numNonzeros = std::count_if(matrixValues.begin(), matrixValues.end(), [](ValueType value) { return value != 0; });
+            double density = static_cast<double>(numNonzeros) / static_cast<double>(matrixValues.size());
+            if (density > densityThreshold)
+            {
+                return false;
+            }
+
+            const auto& newVector = transformer.GetCorrespondingInputs(thisNode->inputVector);
+            auto newNode = transformer.AddNode<nodes::SparseMatrixVectorMultiplyNode<ValueType>>(newVector, matrixValues, numRows, numColumns);
+            newNode->GetMetadata() = node.GetMetadata();
+
+            Log() << "Sparsified matrix-vector multiply for node " << thisNode->GetId() << " (density " << density << ")" << std::endl;
+            transformer.MapNodeOutput(thisNode->output, newNode->output);
+            return true;
+        }
+
+        void SparsifyMatrixMultiply(const model::Node& node, model::ModelTransformer& transformer, double densityThreshold)
+        {
+            if (TrySparsifyMatrixMultiply<float>(node, transformer, densityThreshold))
+            {
+                return;
+            }
+            if (TrySparsifyMatrixMultiply<double>(node, transformer, densityThreshold))
+            {
+                return;
+            }
+
+            transformer.CopyNode(node);
+        }
+    } // namespace
+
+    //
+    // SparsifyMatrixMultiplyTransformation methods
+    //
+    Submodel SparsifyMatrixMultiplyTransformation::Transform(const Submodel& submodel, ModelTransformer& transformer, const TransformContext& context) const
+    {
+        // Replace any MatrixVectorMultiplyNodes that opted in, using an in-place transformation
+        auto onto = transformer.GetCorrespondingOutputs(GetReferencedPorts(submodel.GetInputs()));
+        model::Model destModel = submodel.GetModel().ShallowCopy();
+        auto result = transformer.TransformSubmodelOnto(submodel, destModel, onto, context, [context](const Node& node, ModelTransformer& transformer) {
+            bool sparsify = false;
+            double densityThreshold = 0.25;
+            auto compiler = context.GetCompiler();
+            if (compiler)
+            {
+                auto options = compiler->GetModelOptimizerOptions(node);
+                sparsify = options.GetEntry<bool>("sparsifyMatrixMultiply", false);
+                densityThreshold = options.GetEntry<double>("sparseDensityThreshold", densityThreshold);
+            }
+
+            if (sparsify && IsMatrixVectorMultiplyNode(node))
+            {
+                SparsifyMatrixMultiply(node, transformer, densityThreshold);
+            }
+            else
+            {
+                transformer.CopyNode(node);
+            }
+        });
+        return result;
+    }
+} // namespace passes
+} // namespace ell
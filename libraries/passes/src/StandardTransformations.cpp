@@ -6,11 +6,19 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "AssignDataLayoutsTransformation.h"
 #include "DetectLowPrecisionConvolutionTransformation.h"
+#include "EliminateRedundantNodesTransformation.h"
 #include "StandardTransformations.h"
+#include "FoldConstantSubgraphsTransformation.h"
+#include "FuseBroadcastOperationsTransformation.h"
 #include "FuseLinearOperationsTransformation.h"
 #include "OptimizeReorderDataNodesTransformation.h"
+#include "OptimizeTypeCastsTransformation.h"
+#include "QuantizeFullyConnectedTransformation.h"
 #include "SetConvolutionMethodTransformation.h"
+#include "SetNodeParallelizationTransformation.h"
+#include "SparsifyMatrixMultiplyTransformation.h"
 
 #include <model/include/RefineTransformation.h>
 
@@ -34,10 +42,21 @@ namespace passes
         if (!done)
         {
             registry.AddTransformation<DetectLowPrecisionConvolutionTransformation>();
+            registry.AddTransformation<QuantizeFullyConnectedTransformation>();
             registry.AddTransformation<SetConvolutionMethodTransformation>();
             registry.AddTransformation<model::RefineTransformation>();
+            registry.AddTransformation<SparsifyMatrixMultiplyTransformation>();
             registry.AddTransformation<FuseLinearOperationsTransformation>();
+            registry.AddTransformation<FuseBroadcastOperationsTransformation>();
+            registry.AddTransformation<AssignDataLayoutsTransformation>();
             registry.AddTransformation<OptimizeReorderDataNodesTransformation>();
+            registry.AddTransformation<OptimizeTypeCastsTransformation>();
+
+            // Fold before eliminating redundant nodes, so the interior of a folded constant chain
+            // (or of a collapsed cast chain) is cleaned up as dead nodes
+            registry.AddTransformation<FoldConstantSubgraphsTransformation>();
+            registry.AddTransformation<EliminateRedundantNodesTransformation>();
+            registry.AddTransformation<SetNodeParallelizationTransformation>();
             done = true;
         }
     }
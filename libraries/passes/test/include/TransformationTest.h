@@ -15,5 +15,14 @@
 void TestTransformations();
 
 void TestFuseLinearOperationsTransformation();
+void TestFuseLinearOperationsIntoMatrixMultiplyTransformation();
+void TestFuseBroadcastOperationsTransformation();
+void TestSparsifyMatrixMultiplyTransformation();
 void TestSetConvolutionMethodTransformation();
+void TestPerNodeConvolutionMethodTransformation();
 void TestOptimizeReorderDataNodesTransformation();
+void TestAssignDataLayoutsTransformation();
+void TestSetNodeParallelizationTransformation();
+void TestEliminateRedundantNodesTransformation();
+void TestFoldConstantSubgraphsTransformation();
+void TestOptimizeTypeCastsTransformation();
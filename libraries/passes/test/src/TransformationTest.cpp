@@ -8,19 +8,33 @@
 
 #include "TransformationTest.h"
 
+#include <passes/include/AssignDataLayoutsTransformation.h>
+#include <passes/include/EliminateRedundantNodesTransformation.h>
+#include <passes/include/FoldConstantSubgraphsTransformation.h>
+#include <passes/include/OptimizeTypeCastsTransformation.h>
+#include <passes/include/FuseBroadcastOperationsTransformation.h>
 #include <passes/include/FuseLinearOperationsTransformation.h>
 #include <passes/include/OptimizeReorderDataNodesTransformation.h>
 #include <passes/include/SetConvolutionMethodTransformation.h>
+#include <passes/include/SetNodeParallelizationTransformation.h>
+#include <passes/include/SparsifyMatrixMultiplyTransformation.h>
 
 #include <model/include/InputNode.h>
 #include <model/include/TransformContext.h>
 #include <model/include/Transformation.h>
 
+#include <nodes/include/BinaryOperationNode.h>
 #include <nodes/include/BroadcastFunctionNode.h>
+#include <nodes/include/BroadcastOperationNodes.h>
 #include <nodes/include/ConstantNode.h>
+#include <nodes/include/FusedBroadcastOperationNode.h>
 #include <nodes/include/ConvolutionalLayerNode.h>
 #include <nodes/include/MatrixMatrixMultiplyNode.h>
+#include <nodes/include/MatrixVectorMultiplyNode.h>
 #include <nodes/include/ReorderDataCodeNode.h>
+#include <nodes/include/SparseMatrixVectorMultiplyNode.h>
+#include <nodes/include/TypeCastNode.h>
+#include <nodes/include/UnaryOperationNode.h>
 
 #include <predictors/neural/include/ConvolutionalLayer.h>
 
@@ -29,6 +43,7 @@
 #include <utilities/include/JsonArchiver.h>
 
 #include <iostream>
+#include <numeric>
 
 #define PRINT_MODELS 0
 
@@ -128,8 +143,17 @@ model::Map GenerateLinearOpsTestModel(const model::PortMemoryLayout& inputLayout
 void TestTransformations()
 {
     TestFuseLinearOperationsTransformation();
+    TestFuseLinearOperationsIntoMatrixMultiplyTransformation();
+    TestFuseBroadcastOperationsTransformation();
+    TestSparsifyMatrixMultiplyTransformation();
     TestSetConvolutionMethodTransformation();
+    TestPerNodeConvolutionMethodTransformation();
     TestOptimizeReorderDataNodesTransformation();
+    TestAssignDataLayoutsTransformation();
+    TestSetNodeParallelizationTransformation();
+    TestEliminateRedundantNodesTransformation();
+    TestFoldConstantSubgraphsTransformation();
+    TestOptimizeTypeCastsTransformation();
 }
 
 void TestFuseLinearOperationsTransformation(std::vector<std::pair<bool, bool>> functionInfos)
@@ -228,6 +252,89 @@ void TestFuseLinearOperationsTransformation()
     TestFuseLinearOperationsTransformation({ linear, bias, bias });
 }
 
+void TestFuseLinearOperationsIntoMatrixMultiplyTransformation(bool hasBias)
+{
+    using ValueType = float;
+
+    // The shape a convolution takes after refinement: an im2col matrix multiply with constant
+    // weights, with the filter index as the fastest-moving output dimension
+    int numRows = 2;
+    int numColumns = 2;
+    int numChannels = 3;
+    int m = numChannels;
+    int n = numRows * numColumns;
+    int k = 5;
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<ValueType>>(k * n);
+    std::vector<ValueType> weightsValues(m * k);
+    std::generate(weightsValues.begin(), weightsValues.end(), Increment<ValueType>(1.0f, 0.25f));
+    auto weightsNode = model.AddNode<nodes::ConstantNode<ValueType>>(weightsValues);
+    auto matMultNode = model.AddNode<nodes::MatrixMatrixMultiplyNode<ValueType>>(weightsNode->output, m, n, k, k, false, inputNode->output, n, false, m, true);
+
+    model::PortMemoryLayout layout({ numRows, numColumns, numChannels });
+    model::MemoryShape coeffShape({ 1, 1, numChannels });
+    std::vector<ValueType> scaleValues(numChannels);
+    std::generate(scaleValues.begin(), scaleValues.end(), Increment<ValueType>(1.5f, 0.5f));
+    auto scaleNode = model.AddNode<nodes::ConstantNode<ValueType>>(scaleValues, coeffShape);
+    nodes::ConstantNode<ValueType>* biasNode = nullptr;
+    if (hasBias)
+    {
+        std::vector<ValueType> biasValues(numChannels);
+        std::generate(biasValues.begin(), biasValues.end(), Increment<ValueType>(2.0f));
+        biasNode = model.AddNode<nodes::ConstantNode<ValueType>>(biasValues, coeffShape);
+    }
+    else
+    {
+        biasNode = model.AddNode<nodes::ConstantNode<ValueType>>();
+    }
+    auto functionNode = model.AddNode<nodes::BroadcastLinearFunctionNode<ValueType>>(matMultNode->output, layout, scaleNode->output, biasNode->output, 2, layout);
+
+    model::Map map(model, { { "input", inputNode } }, { { "output", functionNode->output } });
+
+    // Generate test data and evaluate pre-optimization
+    std::vector<ValueType> testInput(k * n);
+    std::generate(testInput.begin(), testInput.end(), Increment<ValueType>(0.0f, 0.125f));
+    map.SetInputValue("input", testInput);
+    auto referenceOutput = map.ComputeOutput<ValueType>("output");
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    model::MapCompilerOptions settings;
+    model::ModelOptimizerOptions optimizerOptions;
+    optimizerOptions["fuseLinearFunctionNodes"] = true;
+    model::IRMapCompiler compiler(settings, optimizerOptions);
+    model::TransformContext context(&compiler);
+    FuseLinearOperationsTransformation fuseOps;
+    map.GetModel().GetMetadata().SetEntry("compileOptions", optimizerOptions.AsPropertyBag());
+    map.Transform(fuseOps, context);
+    map.Refine();
+    map.Prune();
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    // The scale is always folded into the weights; with a bias, a bias-only function node remains
+    auto newSize = map.GetModel().Size();
+    size_t expectedSize = hasBias ? 6 : 3;
+    testing::ProcessTest("Testing matrix multiply fold size", newSize == expectedSize);
+    testing::ProcessTest("Testing matrix multiply fold removed function node", hasBias || !HasNodeWithTypeName(map.GetModel(), nodes::BroadcastLinearFunctionNode<ValueType>::GetTypeName()));
+
+    // Evaluate model post-optimization
+    map.SetInputValue("input", testInput);
+    auto optimizedOutput = map.ComputeOutput<ValueType>("output");
+    testing::ProcessTest("Testing matrix multiply fold result", testing::IsEqual(referenceOutput, optimizedOutput, 1.0e-5f));
+}
+
+void TestFuseLinearOperationsIntoMatrixMultiplyTransformation()
+{
+    TestFuseLinearOperationsIntoMatrixMultiplyTransformation(false);
+    TestFuseLinearOperationsIntoMatrixMultiplyTransformation(true);
+}
+
 void TestSetConvolutionMethodTransformation(model::PreferredConvolutionMethod convolutionMethod, std::string expectedNodeTypeName)
 {
     using namespace predictors::neural;
@@ -291,6 +398,59 @@ void TestSetConvolutionMethodTransformation()
     TestSetConvolutionMethodTransformation(model::PreferredConvolutionMethod::unrolled, "UnrolledConvolutionNode<float>");
 }
 
+void TestPerNodeConvolutionMethodTransformation()
+{
+    using namespace predictors::neural;
+
+    using ElementType = float;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+    using Shape = typename Layer<ElementType>::Shape;
+
+    const size_t inputPaddingSize = 1;
+    const size_t outputPaddingSize = 0;
+    TensorType inputWithPadding(1 + 2 * inputPaddingSize, 2 + 2 * inputPaddingSize, 2);
+    inputWithPadding.Fill(0);
+
+    Shape outputShape = { 1 + 2 * outputPaddingSize, 2 + 2 * outputPaddingSize, 2 };
+
+    LayerParameters parameters{ inputWithPadding, ZeroPadding(inputPaddingSize), outputShape, ZeroPadding(outputPaddingSize) };
+    ConvolutionalParameters convolutionalParams{ 3, 1, ConvolutionMethod::automatic, 2 };
+
+    TensorType weights(convolutionalParams.receptiveField * outputShape.NumChannels(), convolutionalParams.receptiveField, inputWithPadding.NumChannels());
+    ConvolutionalLayer<ElementType> layer(parameters, convolutionalParams, weights);
+
+    // Create model
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<ElementType>>(inputWithPadding.Size());
+    auto computeNode = model.AddNode<nodes::ConvolutionalLayerNode<ElementType>>(inputNode->output, layer);
+
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", computeNode->output } });
+
+    model::MapCompilerOptions settings;
+    model::ModelOptimizerOptions optimizerOptions;
+    optimizerOptions["preferredConvolutionMethod"] = model::PreferredConvolutionMethod::unrolled;
+    model::IRMapCompiler compiler(settings, optimizerOptions);
+
+    // Override the global choice for this one node, the way a profile-guided method map would
+    model::ModelOptimizerOptions nodeOptions;
+    nodeOptions["preferredConvolutionMethod"] = model::PreferredConvolutionMethod::winograd;
+    compiler.SetNodeOptimizerOptions(to_string(computeNode->GetId()), nodeOptions);
+
+    model::TransformContext context(&compiler);
+    passes::SetConvolutionMethodTransformation setConvMethod;
+    map.Transform(setConvMethod, context);
+    map.Prune();
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    bool hasWinogradNode = HasNodeWithTypeName(map.GetModel(), "WinogradConvolutionNode<float>");
+    bool hasUnrolledNode = HasNodeWithTypeName(map.GetModel(), "UnrolledConvolutionNode<float>");
+    testing::ProcessTest("Testing per-node convolution method override", hasWinogradNode && !hasUnrolledNode);
+}
+
 void TestOptimizeReorderDataNodesTransformation1()
 {
     using ValueType = float;
@@ -369,7 +529,7 @@ void TestOptimizeReorderDataNodesTransformation2()
     PrintModel(map.GetModel());
 #endif
 
-    testing::ProcessTest("Testing OptimizeReorderDataNodesTransform2", oldSize == 5 && newSize == 4);
+    testing::ProcessTest("Testing OptimizeReorderDataNodesTransform2", oldSize == 5 && newSize == 3);
 }
 
 void TestOptimizeReorderDataNodesTransformation3()
@@ -414,7 +574,7 @@ void TestOptimizeReorderDataNodesTransformation3()
     PrintModel(map.GetModel());
 #endif
 
-    testing::ProcessTest("Testing OptimizeReorderDataNodesTransform3", oldSize == 5 && newSize == 5);
+    testing::ProcessTest("Testing OptimizeReorderDataNodesTransform3", oldSize == 5 && newSize == 4);
 }
 
 void TestOptimizeReorderDataNodesTransformation4()
@@ -460,7 +620,55 @@ void TestOptimizeReorderDataNodesTransformation4()
     PrintModel(map.GetModel());
 #endif
 
-    testing::ProcessTest("Testing OptimizeReorderDataNodesTransform4", oldSize == 9 && newSize == 4);
+    testing::ProcessTest("Testing OptimizeReorderDataNodesTransform4", oldSize == 9 && newSize == 3);
+}
+
+void TestOptimizeReorderDataNodesTransformation5()
+{
+    using ValueType = float;
+    constexpr int m = 4, n = 5, k = 6;
+
+    auto orderB = model::DimensionOrder{ 1, 0 };
+    auto outputLayout = model::PortMemoryLayout(model::MemoryShape{ m, n });
+
+    model::Model model;
+    auto inputMatrixNode = model.AddNode<model::InputNode<ValueType>>(model::MemoryShape{ m, k });
+
+    std::vector<ValueType> matrixBVals(k * n);
+    std::iota(matrixBVals.begin(), matrixBVals.end(), static_cast<ValueType>(0));
+    auto matrixBNode = model.AddNode<nodes::ConstantNode<ValueType>>(matrixBVals, model::MemoryShape{ k, n });
+    auto reorderedMatrixBNode = model.AddNode<nodes::ReorderDataCodeNode<ValueType>>(matrixBNode->output, orderB);
+
+    auto matMatMultNode = model.AddNode<nodes::MatrixMatrixMultiplyNode<ValueType>>(inputMatrixNode->output, reorderedMatrixBNode->output, outputLayout);
+
+    auto map = model::Map(model, { { "inputMatrix", inputMatrixNode } }, { { "output", matMatMultNode->output } });
+
+    // Transform model
+    passes::OptimizeReorderDataNodesTransformation optReorders;
+    map.Transform(optReorders);
+    map.Refine();
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    // the reorder should have been folded into a single column-major constant
+    auto constantNodes = map.GetModel().GetNodesByType<nodes::ConstantNode<ValueType>>();
+    bool ok = constantNodes.size() == 1;
+    if (ok)
+    {
+        // the folded constant holds the transposed data: entry (i, j) lives at offset j*k + i
+        const auto& foldedValues = constantNodes[0]->GetValues();
+        ok = foldedValues.size() == matrixBVals.size();
+        for (int i = 0; ok && i < k; ++i)
+        {
+            for (int j = 0; ok && j < n; ++j)
+            {
+                ok = foldedValues[j * k + i] == matrixBVals[i * n + j];
+            }
+        }
+    }
+    testing::ProcessTest("Testing OptimizeReorderDataNodesTransform5", ok);
 }
 
 void TestOptimizeReorderDataNodesTransformation()
@@ -469,4 +677,341 @@ void TestOptimizeReorderDataNodesTransformation()
     TestOptimizeReorderDataNodesTransformation2();
     TestOptimizeReorderDataNodesTransformation3();
     TestOptimizeReorderDataNodesTransformation4();
+    TestOptimizeReorderDataNodesTransformation5();
+}
+
+void TestAssignDataLayoutsTransformation()
+{
+    using ValueType = float;
+
+    // An elementwise op sandwiched between a permutation and its inverse: the global assignment
+    // should run the op in the original layout and drop both reorders
+    model::Model model;
+    model::PortMemoryLayout inputLayout({ 2, 3, 4 });
+    auto inputNode = model.AddNode<model::InputNode<ValueType>>(inputLayout);
+    auto reorder1Node = model.AddNode<nodes::ReorderDataCodeNode<ValueType>>(inputNode->output, model::DimensionOrder{ 2, 0, 1 });
+    auto absNode = model.AddNode<nodes::BroadcastUnaryOperationNode<ValueType>>(reorder1Node->output, reorder1Node->GetOutputMemoryLayout(), nodes::UnaryOperationType::abs);
+    auto reorder2Node = model.AddNode<nodes::ReorderDataCodeNode<ValueType>>(absNode->output, model::DimensionOrder{ 0, 1, 2 });
+
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", reorder2Node->output } });
+    auto oldSize = map.GetModel().Size();
+
+    std::vector<ValueType> testInput(inputLayout.GetMemorySize());
+    std::generate(testInput.begin(), testInput.end(), Increment<ValueType>(-10.5f));
+    map.SetInputValue("input", testInput);
+    auto referenceOutput = map.ComputeOutput<ValueType>("output");
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    passes::AssignDataLayoutsTransformation assignLayouts;
+    map.Transform(assignLayouts);
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    // Both reorders should be gone, leaving just the input and the elementwise op
+    auto newSize = map.GetModel().Size();
+    bool hasReorderNode = HasNodeWithTypeName(map.GetModel(), nodes::ReorderDataCodeNode<ValueType>::GetTypeName());
+    testing::ProcessTest("Testing AssignDataLayoutsTransformation node count", oldSize == 4 && newSize == 2 && !hasReorderNode);
+
+    map.SetInputValue("input", testInput);
+    auto optimizedOutput = map.ComputeOutput<ValueType>("output");
+    testing::ProcessTest("Testing AssignDataLayoutsTransformation result", testing::IsEqual(referenceOutput, optimizedOutput));
+}
+
+void TestSetNodeParallelizationTransformation()
+{
+    using ValueType = float;
+
+    // A large matrix multiply (above the cost threshold) feeding a small one (below it)
+    constexpr int largeDim = 8;
+    constexpr int smallM = 2;
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<ValueType>>(largeDim * largeDim);
+    std::vector<ValueType> largeWeights(largeDim * largeDim);
+    auto largeWeightsNode = model.AddNode<nodes::ConstantNode<ValueType>>(largeWeights);
+    auto largeMultNode = model.AddNode<nodes::MatrixMatrixMultiplyNode<ValueType>>(largeWeightsNode->output, largeDim, largeDim, largeDim, largeDim, false, inputNode->output, largeDim, false, largeDim, false);
+    std::vector<ValueType> smallWeights(smallM * largeDim);
+    auto smallWeightsNode = model.AddNode<nodes::ConstantNode<ValueType>>(smallWeights);
+    auto smallMultNode = model.AddNode<nodes::MatrixMatrixMultiplyNode<ValueType>>(smallWeightsNode->output, smallM, largeDim, largeDim, largeDim, false, largeMultNode->output, largeDim, false, largeDim, false);
+
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", smallMultNode->output } });
+
+    model::MapCompilerOptions settings;
+    settings.compilerSettings.parallelize = true;
+    settings.parallelizeCostThreshold = 1000; // large multiply: 2*8*8*8 = 1024 ops, small multiply: 2*2*8*8 = 256 ops
+    model::ModelOptimizerOptions optimizerOptions;
+    model::IRMapCompiler compiler(settings, optimizerOptions);
+    model::TransformContext context(&compiler);
+    passes::SetNodeParallelizationTransformation setParallelization;
+    map.Transform(setParallelization, context);
+
+    bool largeParallelized = false;
+    bool smallParallelized = true;
+    auto iter = map.GetModel().GetNodeIterator();
+    while (iter.IsValid())
+    {
+        auto node = iter.Get();
+        if (auto multNode = dynamic_cast<const nodes::MatrixMatrixMultiplyNode<ValueType>*>(node))
+        {
+            auto nodeOptions = node->GetMetadata().GetEntry<utilities::PropertyBag>("compileOptions", utilities::PropertyBag{});
+            auto parallelize = nodeOptions.GetEntry<bool>("parallelize", false);
+            (multNode->GetM() == largeDim ? largeParallelized : smallParallelized) = parallelize;
+        }
+        iter.Next();
+    }
+    testing::ProcessTest("Testing SetNodeParallelizationTransformation", largeParallelized && !smallParallelized);
+}
+
+void TestFuseBroadcastOperationsTransformation()
+{
+    using ValueType = float;
+    constexpr int size = 8;
+
+    // A chain of elementwise operations: sqrt(|x| + c)
+    model::Model model;
+    model::PortMemoryLayout layout({ size });
+    auto inputNode = model.AddNode<model::InputNode<ValueType>>(layout);
+    auto absNode = model.AddNode<nodes::BroadcastUnaryOperationNode<ValueType>>(inputNode->output, nodes::UnaryOperationType::abs);
+    std::vector<ValueType> biasValues(size, static_cast<ValueType>(2));
+    auto biasNode = model.AddNode<nodes::ConstantNode<ValueType>>(biasValues, layout);
+    auto addNode = model.AddNode<nodes::BroadcastBinaryOperationNode<ValueType>>(absNode->output, biasNode->output, nodes::BinaryOperationType::add);
+    auto sqrtNode = model.AddNode<nodes::BroadcastUnaryOperationNode<ValueType>>(addNode->output, nodes::UnaryOperationType::sqrt);
+
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", sqrtNode->output } });
+    auto oldSize = map.GetModel().Size();
+
+    std::vector<ValueType> testInput(size);
+    std::generate(testInput.begin(), testInput.end(), Increment<ValueType>(-3.5f));
+    map.SetInputValue("input", testInput);
+    auto referenceOutput = map.ComputeOutput<ValueType>("output");
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    model::MapCompilerOptions settings;
+    model::ModelOptimizerOptions optimizerOptions;
+    model::IRMapCompiler compiler(settings, optimizerOptions);
+    model::TransformContext context(&compiler);
+    passes::FuseBroadcastOperationsTransformation fuseBroadcastOperations;
+    map.Transform(fuseBroadcastOperations, context);
+    passes::EliminateRedundantNodesTransformation eliminateRedundantNodes; // clean up the fused-away nodes
+    map.Transform(eliminateRedundantNodes, context);
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    // The three operation nodes should have collapsed into a single fused node
+    auto newSize = map.GetModel().Size();
+    bool hasFusedNode = HasNodeWithTypeName(map.GetModel(), nodes::FusedBroadcastOperationNode<ValueType>::GetTypeName());
+    testing::ProcessTest("Testing FuseBroadcastOperationsTransformation node count", oldSize == 5 && newSize == 3 && hasFusedNode);
+
+    map.SetInputValue("input", testInput);
+    auto fusedOutput = map.ComputeOutput<ValueType>("output");
+    testing::ProcessTest("Testing FuseBroadcastOperationsTransformation result", testing::IsEqual(referenceOutput, fusedOutput));
+}
+
+void TestSparsifyMatrixMultiplyTransformation()
+{
+    using ValueType = float;
+    constexpr int numRows = 6;
+    constexpr int numColumns = 10;
+
+    // A matrix-vector multiply with a mostly-zero constant matrix, as pruning produces
+    std::vector<ValueType> matrixValues(numRows * numColumns, 0);
+    matrixValues[0 * numColumns + 2] = 1.5f;
+    matrixValues[1 * numColumns + 7] = -2.0f;
+    matrixValues[3 * numColumns + 0] = 0.5f;
+    matrixValues[3 * numColumns + 9] = 3.0f;
+    matrixValues[5 * numColumns + 4] = -1.0f;
+
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<ValueType>>(numColumns);
+    auto matrixNode = model.AddNode<nodes::ConstantNode<ValueType>>(matrixValues);
+    auto multiplyNode = model.AddNode<nodes::MatrixVectorMultiplyNode<ValueType>>(matrixNode->output, numRows, numColumns, numColumns, inputNode->output);
+
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", multiplyNode->output } });
+    auto oldSize = map.GetModel().Size();
+
+    std::vector<ValueType> testInput(numColumns);
+    std::generate(testInput.begin(), testInput.end(), Increment<ValueType>(-2.5f));
+    map.SetInputValue("input", testInput);
+    auto referenceOutput = map.ComputeOutput<ValueType>("output");
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    model::MapCompilerOptions settings;
+    model::ModelOptimizerOptions optimizerOptions;
+    optimizerOptions["sparsifyMatrixMultiply"] = true;
+    model::IRMapCompiler compiler(settings, optimizerOptions);
+    model::TransformContext context(&compiler);
+    passes::SparsifyMatrixMultiplyTransformation sparsifyMatrixMultiply;
+    map.Transform(sparsifyMatrixMultiply, context);
+    passes::EliminateRedundantNodesTransformation eliminateRedundantNodes; // clean up the now-dead weights constant
+    map.Transform(eliminateRedundantNodes, context);
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    // The multiply and its weights constant should have been replaced by a single sparse node
+    auto newSize = map.GetModel().Size();
+    bool hasSparseNode = HasNodeWithTypeName(map.GetModel(), nodes::SparseMatrixVectorMultiplyNode<ValueType>::GetTypeName());
+    bool hasDenseNode = HasNodeWithTypeName(map.GetModel(), nodes::MatrixVectorMultiplyNode<ValueType>::GetTypeName());
+    testing::ProcessTest("Testing SparsifyMatrixMultiplyTransformation node count", oldSize == 3 && newSize == 2 && hasSparseNode && !hasDenseNode);
+
+    map.SetInputValue("input", testInput);
+    auto sparseOutput = map.ComputeOutput<ValueType>("output");
+    testing::ProcessTest("Testing SparsifyMatrixMultiplyTransformation result", testing::IsEqual(referenceOutput, sparseOutput));
+}
+
+void TestEliminateRedundantNodesTransformation()
+{
+    using ValueType = float;
+    constexpr int size = 4;
+
+    // Two identical chains computing exp(|x|), plus an orphaned branch
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<ValueType>>(size);
+    auto abs1Node = model.AddNode<nodes::UnaryOperationNode<ValueType>>(inputNode->output, nodes::UnaryOperationType::abs);
+    auto abs2Node = model.AddNode<nodes::UnaryOperationNode<ValueType>>(inputNode->output, nodes::UnaryOperationType::abs);
+    auto exp1Node = model.AddNode<nodes::UnaryOperationNode<ValueType>>(abs1Node->output, nodes::UnaryOperationType::exp);
+    auto exp2Node = model.AddNode<nodes::UnaryOperationNode<ValueType>>(abs2Node->output, nodes::UnaryOperationType::exp);
+    model.AddNode<nodes::UnaryOperationNode<ValueType>>(inputNode->output, nodes::UnaryOperationType::cos); // dead
+    auto sumNode = model.AddNode<nodes::BinaryOperationNode<ValueType>>(exp1Node->output, exp2Node->output, nodes::BinaryOperationType::add);
+
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", sumNode->output } });
+    auto oldSize = map.GetModel().Size();
+
+    std::vector<ValueType> testInput(size);
+    std::generate(testInput.begin(), testInput.end(), Increment<ValueType>(-1.5f));
+    map.SetInputValue("input", testInput);
+    auto referenceOutput = map.ComputeOutput<ValueType>("output");
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    model::MapCompilerOptions settings;
+    model::ModelOptimizerOptions optimizerOptions;
+    model::IRMapCompiler compiler(settings, optimizerOptions);
+    model::TransformContext context(&compiler);
+    passes::EliminateRedundantNodesTransformation eliminateRedundantNodes;
+    map.Transform(eliminateRedundantNodes, context);
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    // The dead branch and the duplicated abs/exp chain should be gone
+    auto newSize = map.GetModel().Size();
+    testing::ProcessTest("Testing EliminateRedundantNodesTransformation node count", oldSize == 7 && newSize == 4);
+
+    map.SetInputValue("input", testInput);
+    auto optimizedOutput = map.ComputeOutput<ValueType>("output");
+    testing::ProcessTest("Testing EliminateRedundantNodesTransformation result", testing::IsEqual(referenceOutput, optimizedOutput));
+}
+
+void TestFoldConstantSubgraphsTransformation()
+{
+    using ValueType = float;
+    constexpr int size = 4;
+
+    // A constant-only chain (exp of the sum of two constants) feeding an add with the input
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<ValueType>>(size);
+    auto const1Node = model.AddNode<nodes::ConstantNode<ValueType>>(std::vector<ValueType>{ 0.5f, 1.0f, 1.5f, 2.0f });
+    auto const2Node = model.AddNode<nodes::ConstantNode<ValueType>>(std::vector<ValueType>{ -1.0f, 0.25f, 0.0f, 3.0f });
+    auto constSumNode = model.AddNode<nodes::BinaryOperationNode<ValueType>>(const1Node->output, const2Node->output, nodes::BinaryOperationType::add);
+    auto constExpNode = model.AddNode<nodes::UnaryOperationNode<ValueType>>(constSumNode->output, nodes::UnaryOperationType::exp);
+    auto sumNode = model.AddNode<nodes::BinaryOperationNode<ValueType>>(inputNode->output, constExpNode->output, nodes::BinaryOperationType::add);
+
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", sumNode->output } });
+    auto oldSize = map.GetModel().Size();
+
+    std::vector<ValueType> testInput(size);
+    std::generate(testInput.begin(), testInput.end(), Increment<ValueType>(-1.5f));
+    map.SetInputValue("input", testInput);
+    auto referenceOutput = map.ComputeOutput<ValueType>("output");
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    model::MapCompilerOptions settings;
+    model::ModelOptimizerOptions optimizerOptions;
+    model::IRMapCompiler compiler(settings, optimizerOptions);
+    model::TransformContext context(&compiler);
+    passes::FoldConstantSubgraphsTransformation foldConstantSubgraphs;
+    map.Transform(foldConstantSubgraphs, context);
+    passes::EliminateRedundantNodesTransformation eliminateRedundantNodes; // clean up the folded-away chain
+    map.Transform(eliminateRedundantNodes, context);
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    // The constant chain should have collapsed into a single precomputed constant
+    auto newSize = map.GetModel().Size();
+    bool hasUnaryNode = HasNodeWithTypeName(map.GetModel(), nodes::UnaryOperationNode<ValueType>::GetTypeName());
+    testing::ProcessTest("Testing FoldConstantSubgraphsTransformation node count", oldSize == 6 && newSize == 3 && !hasUnaryNode);
+
+    map.SetInputValue("input", testInput);
+    auto foldedOutput = map.ComputeOutput<ValueType>("output");
+    testing::ProcessTest("Testing FoldConstantSubgraphsTransformation result", testing::IsEqual(referenceOutput, foldedOutput));
+}
+
+void TestOptimizeTypeCastsTransformation()
+{
+    constexpr int size = 4;
+
+    // A float -> double -> float round trip (interface churn) feeding an add with the input
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<float>>(size);
+    auto toDoubleNode = model.AddNode<nodes::TypeCastNode<float, double>>(inputNode->output);
+    auto toFloatNode = model.AddNode<nodes::TypeCastNode<double, float>>(toDoubleNode->output);
+    auto sumNode = model.AddNode<nodes::BinaryOperationNode<float>>(inputNode->output, toFloatNode->output, nodes::BinaryOperationType::add);
+
+    auto map = model::Map(model, { { "input", inputNode } }, { { "output", sumNode->output } });
+    auto oldSize = map.GetModel().Size();
+
+    std::vector<float> testInput(size);
+    std::generate(testInput.begin(), testInput.end(), Increment<float>(0.25f));
+    map.SetInputValue("input", testInput);
+    auto referenceOutput = map.ComputeOutput<float>("output");
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    model::MapCompilerOptions settings;
+    model::ModelOptimizerOptions optimizerOptions;
+    model::IRMapCompiler compiler(settings, optimizerOptions);
+    model::TransformContext context(&compiler);
+    passes::OptimizeTypeCastsTransformation optimizeTypeCasts;
+    map.Transform(optimizeTypeCasts, context);
+    passes::EliminateRedundantNodesTransformation eliminateRedundantNodes; // clean up the bypassed casts
+    map.Transform(eliminateRedundantNodes, context);
+
+#if PRINT_MODELS
+    PrintModel(map.GetModel());
+#endif
+
+    // Both casts should be gone: the round trip through the wider type is exact
+    auto newSize = map.GetModel().Size();
+    bool hasCastNode = HasNodeWithTypeName(map.GetModel(), (nodes::TypeCastNode<float, double>::GetTypeName())) ||
+                       HasNodeWithTypeName(map.GetModel(), (nodes::TypeCastNode<double, float>::GetTypeName()));
+    testing::ProcessTest("Testing OptimizeTypeCastsTransformation node count", oldSize == 4 && newSize == 2 && !hasCastNode);
+
+    map.SetInputValue("input", testInput);
+    auto optimizedOutput = map.ComputeOutput<float>("output");
+    testing::ProcessTest("Testing OptimizeTypeCastsTransformation result", testing::IsEqual(referenceOutput, optimizedOutput));
 }
@@ -12,13 +12,17 @@
 #include "IPredictor.h"
 #include "SingleElementThresholdPredictor.h"
 
+#include <data/include/Dataset.h>
 #include <data/include/DenseDataVector.h>
 
 #include <utilities/include/IArchivable.h>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
+#include <limits>
+#include <mutex>
 #include <vector>
 
 namespace ell
@@ -198,6 +202,21 @@ namespace predictors
         /// <summary> Type of the data vector expected by this predictor type. </summary>
         using DataVectorType = data::FloatDataVector;
 
+        ForestPredictor() = default;
+
+        /// <summary> Copy constructor. Copies the forest but not the flattened traversal view,
+        /// which is rebuilt on first use (the mutex guarding the rebuild is not copyable). </summary>
+        ForestPredictor(const ForestPredictor& other);
+
+        /// <summary> Move constructor. </summary>
+        ForestPredictor(ForestPredictor&& other);
+
+        /// <summary> Copy assignment operator. </summary>
+        ForestPredictor& operator=(const ForestPredictor& other);
+
+        /// <summary> Move assignment operator. </summary>
+        ForestPredictor& operator=(ForestPredictor&& other);
+
         /// <summary> Query if this forest has no trees and a zero bias. </summary>
         ///
         /// <returns> true if the forest is trivial. </returns>
@@ -235,13 +254,27 @@ namespace predictors
         /// <returns> The number of edges. </returns>
         size_t NumEdges(size_t interiorNodeIndex) const;
 
-        /// <summary> Returns the output of the forest (including all trees and the bias term) for a given input. </summary>
+        /// <summary> Returns the output of the forest (including all trees and the bias term) for a given
+        /// input. Traversal uses a flattened breadth-first layout of the trees, which is rebuilt on the
+        /// first call after the forest changes. </summary>
         ///
         /// <param name="input"> The input vector. </param>
         ///
         /// <returns> The prediction. </returns>
         double Predict(const DataVectorType& input) const;
 
+        /// <summary> Returns the outputs of the forest for all of the examples in a dataset. The trees
+        /// are traversed one at a time over all of the examples, which keeps each tree's flattened
+        /// nodes in cache across examples. Within a tree, examples are advanced through the levels
+        /// in small interleaved groups, so the node loads of independent examples overlap instead of
+        /// each traversal stalling on its own chain of dependent loads. </summary>
+        ///
+        /// <param name="dataset"> The dataset. </param>
+        ///
+        /// <returns> A vector with one prediction per example, in dataset order. </returns>
+        template <typename ExampleType>
+        std::vector<double> Predict(const data::Dataset<ExampleType>& dataset) const;
+
         /// <summary> Returns the output of a given subtree for a given input. </summary>
         ///
         /// <param name="input"> The input vector. </param>
@@ -349,6 +382,24 @@ namespace predictors
         std::vector<size_t> _rootIndices;
         double _bias = 0.0;
         size_t _numEdges = 0;
+
+    private:
+        // Flattened traversal representation: the nodes of each tree are laid out breadth-first in
+        // contiguous arrays, so that walking a tree touches consecutive memory instead of chasing
+        // per-node edge vectors. The representation is rebuilt lazily by Predict after the forest
+        // changes, so it adds no cost during training. The rebuild is guarded by a mutex
+        // (double-checked on the atomic flag), so concurrent Predict calls on a shared predictor
+        // stay safe even when the view is stale.
+        void EnsureFlatView() const;
+        void RebuildFlatView() const;
+
+        mutable std::vector<SplitRuleType> _flatSplitRules;
+        mutable std::vector<size_t> _flatFirstEdges;
+        mutable std::vector<size_t> _flatTargets;
+        mutable std::vector<EdgePredictorType> _flatEdgePredictors;
+        mutable std::vector<size_t> _flatRootIndices;
+        mutable std::atomic<bool> _flatViewIsCurrent{ false };
+        mutable std::mutex _flatViewMutex;
     };
 
     /// <summary> A simple binary tree with single-input threshold rules and constant predictors in its edges. </summary>
@@ -393,6 +444,46 @@ namespace predictors
         _targetNodeIndex = targetNodeIndex;
     }
 
+    template <typename SplitRuleType, typename EdgePredictorType>
+    ForestPredictor<SplitRuleType, EdgePredictorType>::ForestPredictor(const ForestPredictor& other) :
+        _interiorNodes(other._interiorNodes),
+        _rootIndices(other._rootIndices),
+        _bias(other._bias),
+        _numEdges(other._numEdges)
+    {
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    ForestPredictor<SplitRuleType, EdgePredictorType>::ForestPredictor(ForestPredictor&& other) :
+        _interiorNodes(std::move(other._interiorNodes)),
+        _rootIndices(std::move(other._rootIndices)),
+        _bias(other._bias),
+        _numEdges(other._numEdges)
+    {
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    ForestPredictor<SplitRuleType, EdgePredictorType>& ForestPredictor<SplitRuleType, EdgePredictorType>::operator=(const ForestPredictor& other)
+    {
+        _interiorNodes = other._interiorNodes;
+        _rootIndices = other._rootIndices;
+        _bias = other._bias;
+        _numEdges = other._numEdges;
+        _flatViewIsCurrent = false;
+        return *this;
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    ForestPredictor<SplitRuleType, EdgePredictorType>& ForestPredictor<SplitRuleType, EdgePredictorType>::operator=(ForestPredictor&& other)
+    {
+        _interiorNodes = std::move(other._interiorNodes);
+        _rootIndices = std::move(other._rootIndices);
+        _bias = other._bias;
+        _numEdges = other._numEdges;
+        _flatViewIsCurrent = false;
+        return *this;
+    }
+
     template <typename SplitRuleType, typename EdgePredictorType>
     bool ForestPredictor<SplitRuleType, EdgePredictorType>::IsTrivial() const
     {
@@ -453,14 +544,175 @@ namespace predictors
     template <typename SplitRuleType, typename EdgePredictorType>
     double ForestPredictor<SplitRuleType, EdgePredictorType>::Predict(const DataVectorType& input) const
     {
+        EnsureFlatView();
+
         double output = _bias;
-        for (auto treeRootIndex : _rootIndices)
+        for (auto flatRootIndex : _flatRootIndices)
         {
-            output += Predict(input, treeRootIndex);
+            size_t nodeIndex = flatRootIndex;
+            do
+            {
+                // which way do we go?
+                int edgePosition = static_cast<int>(_flatSplitRules[nodeIndex].Predict(input));
+
+                // check for early eject
+                if (edgePosition < 0)
+                {
+                    break;
+                }
+
+                size_t edgeIndex = _flatFirstEdges[nodeIndex] + edgePosition;
+                output += _flatEdgePredictors[edgeIndex].Predict(input);
+
+                // follow the edge to the next node (zero marks a leaf, since the first root is never a target)
+                nodeIndex = _flatTargets[edgeIndex];
+            } while (nodeIndex != 0);
         }
         return output;
     }
 
+    template <typename SplitRuleType, typename EdgePredictorType>
+    template <typename ExampleType>
+    std::vector<double> ForestPredictor<SplitRuleType, EdgePredictorType>::Predict(const data::Dataset<ExampleType>& dataset) const
+    {
+        EnsureFlatView();
+
+        size_t numExamples = dataset.NumExamples();
+        std::vector<double> predictions(numExamples, _bias);
+
+        // Examples advanced together through each tree: each pass over a group moves every live
+        // example down one level, so the dependent node loads of different examples overlap
+        constexpr size_t groupSize = 8;
+
+        // Marks an example that has reached a leaf (or ejected early); distinct from every node
+        // index, including the first tree's root at index zero
+        constexpr size_t doneSentinel = std::numeric_limits<size_t>::max();
+
+        // process one tree at a time across all of the examples, so that the tree's flattened nodes
+        // stay in cache; per example, edges are visited in the same order as the single-example Predict
+        for (auto flatRootIndex : _flatRootIndices)
+        {
+            for (size_t groupStart = 0; groupStart < numExamples; groupStart += groupSize)
+            {
+                size_t numLanes = std::min(groupSize, numExamples - groupStart);
+
+                const ExampleType* examples[groupSize];
+                size_t nodeIndexes[groupSize];
+                for (size_t lane = 0; lane < numLanes; ++lane)
+                {
+                    examples[lane] = &dataset.GetExample(groupStart + lane);
+                    nodeIndexes[lane] = flatRootIndex;
+                }
+
+                size_t numActive = numLanes;
+                while (numActive > 0)
+                {
+                    for (size_t lane = 0; lane < numLanes; ++lane)
+                    {
+                        size_t nodeIndex = nodeIndexes[lane];
+                        if (nodeIndex == doneSentinel)
+                        {
+                            continue;
+                        }
+
+                        const auto& input = examples[lane]->GetDataVector();
+                        int edgePosition = static_cast<int>(_flatSplitRules[nodeIndex].Predict(input));
+                        if (edgePosition < 0)
+                        {
+                            nodeIndexes[lane] = doneSentinel;
+                            --numActive;
+                            continue;
+                        }
+
+                        size_t edgeIndex = _flatFirstEdges[nodeIndex] + edgePosition;
+                        predictions[groupStart + lane] += _flatEdgePredictors[edgeIndex].Predict(input);
+
+                        size_t targetIndex = _flatTargets[edgeIndex];
+                        if (targetIndex == 0)
+                        {
+                            nodeIndexes[lane] = doneSentinel;
+                            --numActive;
+                        }
+                        else
+                        {
+                            nodeIndexes[lane] = targetIndex;
+                        }
+                    }
+                }
+            }
+        }
+        return predictions;
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    void ForestPredictor<SplitRuleType, EdgePredictorType>::EnsureFlatView() const
+    {
+        // double-checked: the acquire load keeps the common already-built case lock-free, and the
+        // mutex makes concurrent first calls rebuild the view exactly once
+        if (!_flatViewIsCurrent.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(_flatViewMutex);
+            if (!_flatViewIsCurrent.load(std::memory_order_relaxed))
+            {
+                RebuildFlatView();
+            }
+        }
+    }
+
+    template <typename SplitRuleType, typename EdgePredictorType>
+    void ForestPredictor<SplitRuleType, EdgePredictorType>::RebuildFlatView() const
+    {
+        _flatSplitRules.clear();
+        _flatFirstEdges.clear();
+        _flatTargets.clear();
+        _flatEdgePredictors.clear();
+        _flatRootIndices.clear();
+
+        _flatSplitRules.reserve(_interiorNodes.size());
+        _flatFirstEdges.reserve(_interiorNodes.size());
+        _flatTargets.reserve(_numEdges);
+        _flatEdgePredictors.reserve(_numEdges);
+        _flatRootIndices.reserve(_rootIndices.size());
+
+        // visit the nodes of each tree breadth-first; nodes are assigned flat indices in the order
+        // in which they are enqueued, which equals the order in which they are processed
+        std::vector<size_t> originalIndexQueue;
+        originalIndexQueue.reserve(_interiorNodes.size());
+
+        for (auto treeRootIndex : _rootIndices)
+        {
+            _flatRootIndices.push_back(_flatSplitRules.size());
+
+            size_t queueHead = originalIndexQueue.size();
+            originalIndexQueue.push_back(treeRootIndex);
+            size_t nextFlatIndex = _flatSplitRules.size() + 1;
+
+            while (queueHead < originalIndexQueue.size())
+            {
+                const auto& interiorNode = _interiorNodes[originalIndexQueue[queueHead++]];
+
+                _flatSplitRules.push_back(interiorNode._splitRule);
+                _flatFirstEdges.push_back(_flatTargets.size());
+
+                for (const auto& edge : interiorNode._outgoingEdges)
+                {
+                    _flatEdgePredictors.push_back(edge.GetPredictor());
+                    if (edge.IsTargetInterior())
+                    {
+                        originalIndexQueue.push_back(edge.GetTargetNodeIndex());
+                        _flatTargets.push_back(nextFlatIndex++);
+                    }
+                    else
+                    {
+                        _flatTargets.push_back(0);
+                    }
+                }
+            }
+        }
+
+        _flatViewIsCurrent.store(true, std::memory_order_release);
+    }
+
     template <typename SplitRuleType, typename EdgePredictorType>
     double ForestPredictor<SplitRuleType, EdgePredictorType>::Predict(const DataVectorType& input, size_t interiorNodeIndex) const
     {
@@ -579,6 +831,7 @@ namespace predictors
         archiver["rootIndices"] >> _rootIndices;
         archiver["bias"] >> _bias;
         archiver["numEdges"] >> _numEdges;
+        _flatViewIsCurrent = false;
     }
 
     template <typename SplitRuleType, typename EdgePredictorType>
@@ -612,6 +865,9 @@ namespace predictors
         // increment global edge count
         _numEdges += numEdges;
 
+        // the flattened traversal layout no longer matches the forest
+        _flatViewIsCurrent = false;
+
         return interiorNodeIndex;
     }
 
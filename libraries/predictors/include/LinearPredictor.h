@@ -13,11 +13,13 @@
 #include <math/include/Vector.h>
 
 #include <data/include/AutoDataVector.h>
+#include <data/include/Dataset.h>
 
 #include <utilities/include/IArchivable.h>
 
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace ell
 {
@@ -96,6 +98,16 @@ namespace predictors
         /// <returns> The prediction. </returns>
         ElementType Predict(const DataVectorType& dataVector) const;
 
+        /// <summary> Returns the outputs of the predictor for all of the examples in a dataset. The
+        /// examples are processed in fixed-size blocks, each of which is evaluated with a single
+        /// matrix-vector product. </summary>
+        ///
+        /// <param name="dataset"> The dataset. </param>
+        ///
+        /// <returns> A vector with one prediction per example, in dataset order. </returns>
+        template <typename ExampleType>
+        std::vector<ElementType> Predict(const data::Dataset<ExampleType>& dataset) const;
+
         /// <summary> Returns a vector of dataVector elements weighted by the predictor weights. </summary>
         ///
         /// <param name="example"> The data vector. </param>
@@ -136,8 +148,10 @@ namespace predictors
 
 #include <data/include/DataVectorOperations.h>
 
+#include <math/include/MatrixOperations.h>
 #include <math/include/VectorOperations.h>
 
+#include <algorithm>
 #include <memory>
 
 namespace ell
@@ -190,6 +204,44 @@ namespace predictors
         return _w * dataVector + _b;
     }
 
+    template <typename ElementType>
+    template <typename ExampleType>
+    std::vector<ElementType> LinearPredictor<ElementType>::Predict(const data::Dataset<ExampleType>& dataset) const
+    {
+        const size_t blockSize = 64;
+        size_t numExamples = dataset.NumExamples();
+        std::vector<ElementType> predictions(numExamples);
+
+        // the block matrix and block prediction vector are reused for every block
+        math::RowMatrix<ElementType> examples(blockSize, _w.Size());
+        math::ColumnVector<ElementType> blockPredictions(blockSize);
+
+        size_t blockStart = 0;
+        while (blockStart < numExamples)
+        {
+            size_t currentBlockSize = std::min(blockSize, numExamples - blockStart);
+            for (size_t i = 0; i < currentBlockSize; ++i)
+            {
+                auto values = dataset.GetExample(blockStart + i).GetDataVector().ToArray(_w.Size());
+                for (size_t j = 0; j < values.size(); ++j)
+                {
+                    examples(i, j) = static_cast<ElementType>(values[j]);
+                }
+            }
+
+            auto examplesBlock = examples.GetSubMatrix(0, 0, currentBlockSize, _w.Size());
+            auto predictionsBlock = blockPredictions.GetSubVector(0, currentBlockSize);
+            math::MultiplyScaleAddUpdate(static_cast<ElementType>(1), examplesBlock, _w, static_cast<ElementType>(0), predictionsBlock);
+
+            for (size_t i = 0; i < currentBlockSize; ++i)
+            {
+                predictions[blockStart + i] = blockPredictions[i] + _b;
+            }
+            blockStart += currentBlockSize;
+        }
+        return predictions;
+    }
+
     template <typename ElementType>
     auto LinearPredictor<ElementType>::GetWeightedElements(const DataVectorType& dataVector) const -> DataVectorType
     {
@@ -124,6 +124,14 @@ namespace predictors
         /// <returns> The prediction. </returns>
         const std::vector<ElementType>& Predict(const std::vector<ElementType>& input) const;
 
+        /// <summary> Sets the number of worker threads the layers may use when computing. The
+        /// layers partition their output into disjoint blocks, so the prediction does not depend
+        /// on the thread count. One means single-threaded; zero means one thread per hardware
+        /// core. </summary>
+        ///
+        /// <param name="numThreads"> The number of worker threads. </param>
+        void SetComputeThreads(size_t numThreads);
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -237,6 +245,15 @@ namespace predictors
         return _output;
     }
 
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::SetComputeThreads(size_t numThreads)
+    {
+        for (auto& layer : _layers)
+        {
+            layer->SetComputeThreads(numThreads);
+        }
+    }
+
     template <typename ElementType>
     void NeuralNetworkPredictor<ElementType>::Compute() const
     {
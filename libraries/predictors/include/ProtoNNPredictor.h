@@ -118,6 +118,15 @@ namespace predictors
         /// <returns> The predicted label scores. </returns>
         math::ColumnVector<double> Predict(const std::vector<double>& inputVector) const;
 
+        /// <summary> Returns the label scores for a batch of examples, stored as the columns of a
+        /// matrix. The projection and the label embedding are each applied with a single
+        /// matrix-matrix product. </summary>
+        ///
+        /// <param name="inputs"> A matrix whose columns are the input vectors, with one row per input dimension. </param>
+        ///
+        /// <returns> A matrix whose columns are the predicted label scores, in input order. </returns>
+        math::ColumnMatrix<double> Predict(math::ConstColumnMatrixReference<double> inputs) const;
+
         /// <summary> Resets the projection predictor to the zero projection matrix. </summary>
         void Reset();
 
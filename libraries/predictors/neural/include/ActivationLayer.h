@@ -23,6 +23,7 @@ namespace predictors
         public:
             using LayerParameters = typename Layer<ElementType>::LayerParameters;
             using Layer<ElementType>::GetOutputMinusPadding;
+            using Layer<ElementType>::HasPaddingFreeIO;
             using ActivationType = Activation<ElementType>;
 
             /// <summary> Instantiates an instance of an activation layer. </summary>
@@ -117,6 +118,29 @@ namespace predictors
             auto output = GetOutputMinusPadding();
             auto input = _layerParameters.input;
 
+            // When the input and output are both padding-free contiguous slabs of the same shape,
+            // walk them as flat arrays so elementwise activations auto-vectorize. Channels vary
+            // fastest in memory, so the flat index advances in step with the k loop; the coordinate
+            // counters are kept alongside it for activations (such as parametric ReLU) that need them
+            if (HasPaddingFreeIO() && input.NumRows() == output.NumRows() && input.NumColumns() == output.NumColumns() && input.NumChannels() == output.NumChannels())
+            {
+                const ElementType* inputData = input.GetConstDataPointer();
+                ElementType* outputData = output.GetDataPointer();
+                size_t index = 0;
+                for (size_t i = 0; i < input.NumRows(); i++)
+                {
+                    for (size_t j = 0; j < input.NumColumns(); j++)
+                    {
+                        for (size_t k = 0; k < input.NumChannels(); k++)
+                        {
+                            outputData[index] = _activation.ApplyIndex(inputData[index], math::IntegerTriplet{ i, j, k });
+                            index++;
+                        }
+                    }
+                }
+                return;
+            }
+
             for (size_t i = 0; i < input.NumRows(); i++)
             {
                 for (size_t j = 0; j < input.NumColumns(); j++)
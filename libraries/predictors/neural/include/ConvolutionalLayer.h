@@ -10,6 +10,7 @@
 #include "Layer.h"
 
 #include <dsp/include/Convolution.h>
+#include <dsp/include/UnrolledConvolution.h>
 
 #include <math/include/Matrix.h>
 
@@ -48,6 +49,10 @@ namespace predictors
 
             /// <summary> Number of filters to batch at a time when using the Diagonal method. </summary>
             size_t numFiltersAtATime;
+
+            /// <summary> Number of worker threads to partition the filters across when computing. One means
+            /// single-threaded; zero means one thread per hardware core. </summary>
+            size_t numThreads = 1;
         };
 
         /// <summary> A layer in a neural network that implements a fully connected layer, meaning all nodes in this layer are connected to all
@@ -110,6 +115,16 @@ namespace predictors
             /// <returns> `true` if this layer represents a depthwise-separable convolution. </returns>
             bool IsDepthwiseSeparable() const;
 
+            /// <summary> Sets the number of worker threads that Compute may use, overriding the
+            /// thread count given in the convolutional parameters. </summary>
+            ///
+            /// <param name="numThreads"> The number of worker threads. </param>
+            void SetComputeThreads(size_t numThreads) override
+            {
+                Layer<ElementType>::SetComputeThreads(numThreads);
+                _convolutionalParameters.numThreads = numThreads;
+            }
+
         protected:
             void WriteToArchive(utilities::Archiver& archiver) const override;
             void ReadFromArchive(utilities::Unarchiver& archiver) override;
@@ -126,7 +141,9 @@ namespace predictors
             void ComputeUnrolledMethod();
             void ComputeWinogradMethod();
             void ComputeDiagonalMethod();
+            void ComputeParallelMethod();
             void ComputeDepthwiseSeparable();
+            bool CanComputeInParallel() const;
 
             using Layer<ElementType>::_layerParameters;
             using Layer<ElementType>::_output;
@@ -136,6 +153,9 @@ namespace predictors
 
             MatrixType _outputMatrix;
 
+            // scratch buffers for the unrolled method, reused across Compute calls
+            dsp::UnrolledConvolutionWorkspace<ElementType> _unrolledWorkspace;
+
             ConvolutionMethod _originalConvolutionMethod;
         };
 
@@ -172,6 +192,12 @@ namespace predictors
         {
             if (!IsDepthwiseSeparable())
             {
+                if (CanComputeInParallel())
+                {
+                    ComputeParallelMethod();
+                    return;
+                }
+
                 switch (_convolutionalParameters.method)
                 {
                 case ConvolutionMethod::simple:
@@ -217,8 +243,7 @@ namespace predictors
             auto& input = _layerParameters.input;
             auto stride = static_cast<int>(_convolutionalParameters.stride);
             const int numFilters = static_cast<int>(output.NumChannels());
-            auto result = dsp::Convolve2DUnrolled(input, _weights, numFilters, stride);
-            output.CopyFrom(result);
+            dsp::Convolve2DUnrolled(input, _weights, numFilters, stride, _unrolledWorkspace, output);
         }
 
         template <typename ElementType>
@@ -231,6 +256,35 @@ namespace predictors
             output.CopyFrom(result);
         }
 
+        template <typename ElementType>
+        bool ConvolutionalLayer<ElementType>::CanComputeInParallel() const
+        {
+            if (_convolutionalParameters.numThreads == 1)
+            {
+                return false;
+            }
+
+            // The parallel dispatcher partitions the filters across workers running the
+            // single-threaded simple, unrolled or winograd implementations
+            const auto method = _convolutionalParameters.method;
+            return method == ConvolutionMethod::simple || method == ConvolutionMethod::unrolled || method == ConvolutionMethod::winograd;
+        }
+
+        template <typename ElementType>
+        void ConvolutionalLayer<ElementType>::ComputeParallelMethod()
+        {
+            auto output = GetOutputMinusPadding();
+            auto& input = _layerParameters.input;
+            auto stride = static_cast<int>(_convolutionalParameters.stride);
+            const int numFilters = static_cast<int>(output.NumChannels());
+            const int numThreads = static_cast<int>(_convolutionalParameters.numThreads);
+
+            // The ConvolutionMethod values are kept in sync with dsp::ConvolutionMethodOption
+            auto method = static_cast<dsp::ConvolutionMethodOption>(_convolutionalParameters.method);
+            auto result = dsp::Convolve2DParallel(input, _weights, numFilters, stride, numThreads, method);
+            output.CopyFrom(result);
+        }
+
         template <typename ElementType>
         void ConvolutionalLayer<ElementType>::ComputeDiagonalMethod()
         {
@@ -336,6 +390,7 @@ namespace predictors
             archiver["stride"] << _convolutionalParameters.stride;
             archiver["method"] << static_cast<int>(_originalConvolutionMethod);
             archiver["numFiltersAtATime"] << static_cast<int>(_convolutionalParameters.numFiltersAtATime);
+            archiver["numThreads"] << static_cast<int>(_convolutionalParameters.numThreads);
 
             math::TensorArchiver::Write(_weights, "weights", archiver);
         }
@@ -353,6 +408,9 @@ namespace predictors
             int numFilters;
             archiver["numFiltersAtATime"] >> numFilters;
             _convolutionalParameters.numFiltersAtATime = static_cast<size_t>(numFilters);
+            int numThreads = 1;
+            archiver.OptionalProperty("numThreads", 1) >> numThreads;
+            _convolutionalParameters.numThreads = static_cast<size_t>(numThreads);
 
             math::TensorArchiver::Read(_weights, "weights", archiver);
             CalculateConvolutionMethod();
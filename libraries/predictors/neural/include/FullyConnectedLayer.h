@@ -95,6 +95,9 @@ namespace predictors
 
 #include <utilities/include/StringUtil.h>
 
+#include <future>
+#include <vector>
+
 namespace ell
 {
 namespace predictors
@@ -155,7 +158,35 @@ namespace predictors
                 }
             }
 
-            math::MultiplyScaleAddUpdate((ElementType)1.0f, _weights, _shapedInput, (ElementType)0.0f, _outputVector);
+            size_t numOutputs = _outputVector.Size();
+            size_t numThreads = std::min(this->GetComputeThreadCount(), numOutputs);
+            if (numThreads <= 1)
+            {
+                math::MultiplyScaleAddUpdate((ElementType)1.0f, _weights, _shapedInput, (ElementType)0.0f, _outputVector);
+            }
+            else
+            {
+                // each worker computes a contiguous block of output rows, so the result does not
+                // depend on the thread count
+                std::vector<std::future<void>> futures;
+                size_t blockSize = numOutputs / numThreads;
+                size_t remainder = numOutputs % numThreads;
+                size_t start = 0;
+                for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+                {
+                    size_t size = blockSize + (threadIndex < remainder ? 1 : 0);
+                    futures.push_back(std::async(std::launch::async, [this, start, size] {
+                        auto weightsBlock = _weights.GetSubMatrix(start, 0, size, _weights.NumColumns());
+                        auto outputBlock = _outputVector.GetSubVector(start, size);
+                        math::MultiplyScaleAddUpdate((ElementType)1.0f, weightsBlock, _shapedInput, (ElementType)0.0f, outputBlock);
+                    }));
+                    start += size;
+                }
+                for (auto& future : futures)
+                {
+                    future.get();
+                }
+            }
 
             // Reshape the output
             columnIndex = 0;
@@ -17,9 +17,11 @@
 
 #include <utilities/include/IArchivable.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <ostream>
+#include <thread>
 
 namespace ell
 {
@@ -231,6 +233,14 @@ namespace predictors
             ///           This is a no-op for this layer type. </summary>
             virtual void Compute(){};
 
+            /// <summary> Sets the number of worker threads that Compute may use. The output is
+            /// partitioned into disjoint blocks, so the result does not depend on the thread count.
+            /// One means single-threaded; zero means one thread per hardware core. Not every layer
+            /// type supports multithreaded computation, and the setting is not archived. </summary>
+            ///
+            /// <param name="numThreads"> The number of worker threads. </param>
+            virtual void SetComputeThreads(size_t numThreads) { _computeThreads = numThreads; }
+
             /// <summary> Resets the state of the layer </summary>
             virtual void Reset(){};
 
@@ -279,6 +289,14 @@ namespace predictors
             /// <returns> Read/write reference to the output tensor. </returns>
             TensorReferenceType GetOutputMinusPadding();
 
+            /// <summary> Indicates whether the input reference and the active area of the output are
+            /// each a single contiguous slab of memory, with any padding outside of them. When true,
+            /// elementwise Compute implementations can process the data as flat arrays instead of
+            /// re-deriving a padded offset per element. </summary>
+            ///
+            /// <returns> true if both views are contiguous. </returns>
+            bool HasPaddingFreeIO();
+
             /// <summary> Returns number of output rows minus padding. </summary>
             size_t NumOutputRowsMinusPadding() const { return _output.NumRows() - 2 * _layerParameters.outputPaddingParameters.paddingSize; }
 
@@ -295,8 +313,12 @@ namespace predictors
             // rather than doing them in place
             void AssignValues(ConstTensorReferenceType& input, TensorReferenceType& output);
 
+            /// <summary> Returns the number of worker threads Compute may use, resolving zero to the number of hardware cores. </summary>
+            size_t GetComputeThreadCount() const { return _computeThreads == 0 ? std::max<size_t>(std::thread::hardware_concurrency(), 1) : _computeThreads; }
+
             LayerParameters _layerParameters;
             TensorType _output;
+            size_t _computeThreads = 1;
         };
 
         /// <summary> A serialization context used during layer deserialization. Wraps an existing `SerializationContext`
@@ -548,11 +570,25 @@ namespace predictors
                                         { _output.NumRows() - 2 * padding, _output.NumColumns() - 2 * padding, _output.NumChannels() });
         }
 
+        template <typename ElementType>
+        bool Layer<ElementType>::HasPaddingFreeIO()
+        {
+            return _layerParameters.input.IsContiguous() && GetOutputMinusPadding().IsContiguous();
+        }
+
         template <typename ElementType>
         void Layer<ElementType>::AssignValues(ConstTensorReferenceType& input, TensorReferenceType& output)
         {
             DEBUG_THROW(input.NumRows() > output.NumRows() || input.NumColumns() > output.NumColumns() || input.NumChannels() > output.NumChannels(), utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "Input tensor must not exceed output tensor dimensions."));
 
+            // When both views are contiguous slabs of the same size, copy them as flat memory
+            // instead of deriving a padded offset per element
+            if (input.Size() == output.Size() && input.IsContiguous() && output.IsContiguous())
+            {
+                std::copy(input.GetConstDataPointer(), input.GetConstDataPointer() + input.Size(), output.GetDataPointer());
+                return;
+            }
+
             for (size_t i = 0; i < input.NumRows(); i++)
             {
                 for (size_t j = 0; j < input.NumColumns(); j++)
@@ -97,6 +97,7 @@ namespace predictors
 #pragma region implementation
 
 #include <algorithm>
+#include <future>
 
 namespace ell
 {
@@ -119,41 +120,69 @@ namespace predictors
             auto output = GetOutputMinusPadding();
             const size_t poolingWindowSize = _poolingParameters.poolingSize;
 
-            for (size_t row = 0; row < output.NumRows(); row++)
-            {
-                const size_t startRow = row * _poolingParameters.stride;
-                for (size_t column = 0; column < output.NumColumns(); column++)
+            // each output row only reads the input, so rows can be pooled concurrently; every
+            // element is computed the same way regardless of the thread count
+            auto computeRows = [&, this](size_t beginRow, size_t endRow) {
+                for (size_t row = beginRow; row < endRow; row++)
                 {
-                    const size_t startColumn = column * _poolingParameters.stride;
-                    std::vector<PoolingFunctionType<ElementType>> poolingValues(output.NumChannels());
-
-                    for (size_t pool_y = 0; pool_y < poolingWindowSize; pool_y++)
+                    const size_t startRow = row * _poolingParameters.stride;
+                    for (size_t column = 0; column < output.NumColumns(); column++)
                     {
-                        for (size_t pool_x = 0; pool_x < poolingWindowSize; pool_x++)
+                        const size_t startColumn = column * _poolingParameters.stride;
+                        std::vector<PoolingFunctionType<ElementType>> poolingValues(output.NumChannels());
+
+                        for (size_t pool_y = 0; pool_y < poolingWindowSize; pool_y++)
                         {
-                            for (size_t channel = 0; channel < output.NumChannels(); channel++)
+                            for (size_t pool_x = 0; pool_x < poolingWindowSize; pool_x++)
                             {
-                                // Account for when part of the pooling window falls beyond the pooling region.
-                                size_t inputRow = startRow + pool_y;
-                                size_t inputColumn = startColumn + pool_x;
-
-                                if ((inputRow < input.NumRows()) && (inputColumn < input.NumColumns()))
-                                {
-                                    poolingValues[channel].Accumulate(input(inputRow, inputColumn, channel));
-                                }
-                                else
+                                for (size_t channel = 0; channel < output.NumChannels(); channel++)
                                 {
-                                    poolingValues[channel].Accumulate(poolingValues[channel].GetValueAtPadding());
+                                    // Account for when part of the pooling window falls beyond the pooling region.
+                                    size_t inputRow = startRow + pool_y;
+                                    size_t inputColumn = startColumn + pool_x;
+
+                                    if ((inputRow < input.NumRows()) && (inputColumn < input.NumColumns()))
+                                    {
+                                        poolingValues[channel].Accumulate(input(inputRow, inputColumn, channel));
+                                    }
+                                    else
+                                    {
+                                        poolingValues[channel].Accumulate(poolingValues[channel].GetValueAtPadding());
+                                    }
                                 }
                             }
                         }
-                    }
 
-                    for (size_t channel = 0; channel < output.NumChannels(); channel++)
-                    {
-                        output(row, column, channel) = poolingValues[channel].GetValue();
+                        for (size_t channel = 0; channel < output.NumChannels(); channel++)
+                        {
+                            output(row, column, channel) = poolingValues[channel].GetValue();
+                        }
                     }
                 }
+            };
+
+            size_t numRows = output.NumRows();
+            size_t numThreads = std::min(this->GetComputeThreadCount(), numRows);
+            if (numThreads <= 1)
+            {
+                computeRows(0, numRows);
+            }
+            else
+            {
+                std::vector<std::future<void>> futures;
+                size_t blockSize = numRows / numThreads;
+                size_t remainder = numRows % numThreads;
+                size_t start = 0;
+                for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+                {
+                    size_t size = blockSize + (threadIndex < remainder ? 1 : 0);
+                    futures.push_back(std::async(std::launch::async, computeRows, start, start + size));
+                    start += size;
+                }
+                for (auto& future : futures)
+                {
+                    future.get();
+                }
             }
         }
 
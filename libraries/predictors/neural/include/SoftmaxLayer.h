@@ -24,6 +24,7 @@ namespace predictors
             using LayerParameters = typename Layer<ElementType>::LayerParameters;
             using Layer<ElementType>::GetOutputMinusPadding;
             using Layer<ElementType>::AssignValues;
+            using Layer<ElementType>::HasPaddingFreeIO;
 
             /// <summary> Instantiates an instance of a softmax layer. </summary>
             ///
@@ -87,11 +88,39 @@ namespace predictors
             auto output = GetOutputMinusPadding();
             auto& input = _layerParameters.input;
 
-            AssignValues(input, output);
-
             ElementType sum = 0;
             ElementType maxValue = std::numeric_limits<ElementType>::lowest();
 
+            // When the input and output are both padding-free contiguous slabs, run the three
+            // passes over flat arrays; the simple loops auto-vectorize, where the padded-offset
+            // arithmetic of the elementwise tensor indexing below does not
+            if (HasPaddingFreeIO())
+            {
+                const auto size = input.Size();
+                const ElementType* inputData = input.GetConstDataPointer();
+                ElementType* outputData = output.GetDataPointer();
+
+                for (size_t index = 0; index < size; index++)
+                {
+                    maxValue = std::max(maxValue, inputData[index]);
+                }
+
+                for (size_t index = 0; index < size; index++)
+                {
+                    ElementType eulerVal = std::exp(inputData[index] - maxValue);
+                    outputData[index] = eulerVal;
+                    sum += eulerVal;
+                }
+
+                for (size_t index = 0; index < size; index++)
+                {
+                    outputData[index] /= sum;
+                }
+                return;
+            }
+
+            AssignValues(input, output);
+
             // Find the max
             for (size_t i = 0; i < input.NumRows(); i++)
             {
@@ -10,6 +10,9 @@
 
 #include <math/include/MatrixOperations.h>
 
+#include <utilities/include/Exception.h>
+
+#include <cmath>
 #include <memory>
 
 namespace ell
@@ -86,6 +89,44 @@ namespace predictors
         return labels;
     }
 
+    math::ColumnMatrix<double> ProtoNNPredictor::Predict(math::ConstColumnMatrixReference<double> inputs) const
+    {
+        if (inputs.NumRows() != GetDimension())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "input matrix must have one row per input dimension");
+        }
+
+        // Projection of all of the inputs at once
+        auto numExamples = inputs.NumColumns();
+        math::ColumnMatrix<double> projectedInputs(GetProjectedDimension(), numExamples);
+        math::MultiplyScaleAddUpdate(1.0, _W, inputs, 0.0, projectedInputs);
+
+        // Similarity of each input to each prototype
+        auto numPrototypes = GetNumPrototypes();
+        math::ColumnMatrix<double> similarityToPrototypes(numPrototypes, numExamples);
+        auto prototypes = GetPrototypes();
+        auto gammaVal = GetGamma();
+
+        for (size_t j = 0; j < numExamples; j++)
+        {
+            auto projectedInput = projectedInputs.GetColumn(j);
+            for (size_t i = 0; i < numPrototypes; i++)
+            {
+                math::ColumnVector<double> prototype(prototypes.GetColumn(i).ToArray());
+                prototype -= projectedInput;
+                auto prototypeDistance = prototype.Norm2();
+                auto similarity = std::exp(-1 * gammaVal * gammaVal * prototypeDistance * prototypeDistance);
+                similarityToPrototypes(i, j) = similarity;
+            }
+        }
+
+        // Label scores of all of the inputs at once
+        math::ColumnMatrix<double> labels(GetNumLabels(), numExamples);
+        math::MultiplyScaleAddUpdate(1.0, GetLabelEmbeddings(), similarityToPrototypes, 0.0, labels);
+
+        return labels;
+    }
+
     void ProtoNNPredictor::WriteToArchive(utilities::Archiver& archiver) const
     {
         archiver["dim"] << _dimension;
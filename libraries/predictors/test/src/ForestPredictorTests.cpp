@@ -8,6 +8,8 @@
 
 #include <predictors/include/ForestPredictor.h>
 
+#include <data/include/Dataset.h>
+
 #include <testing/include/testing.h>
 
 using namespace ell;
@@ -64,4 +66,21 @@ void ForestPredictorTest()
     // test path generation
     auto edgeIndicator = forest.GetEdgeIndicatorVector(ExampleType{ 0.25, 0.7, 0.0 });
     testing::ProcessTest("Testing ForestPredictor, SetEdgeIndicatorVector()", testing::IsEqual(edgeIndicator, std::vector<bool>{ 1, 0, 0, 1, 0, 0, 0, 1 }));
+
+    // test dataset Predict: the interleaved batch traversal must match the single-example path,
+    // including for a number of examples that doesn't divide evenly into groups
+    std::vector<std::vector<double>> batchInputs{ { 0.18, 0.5, 0.0 }, { 0.25, 0.7, 0.0 }, { 0.5, 0.7, 1.0 }, { 0.2, 0.5, 0.0 } };
+    data::Dataset<data::DenseSupervisedExample> dataset;
+    for (int i = 0; i < 10; ++i)
+    {
+        dataset.AddExample(data::DenseSupervisedExample{ data::FloatDataVector(batchInputs[i % batchInputs.size()]), data::WeightLabel{ 1.0, 0.0 } });
+    }
+
+    auto batchPredictions = forest.Predict(dataset);
+    bool batchMatches = batchPredictions.size() == dataset.NumExamples();
+    for (size_t i = 0; i < batchPredictions.size(); ++i)
+    {
+        batchMatches &= testing::IsEqual(batchPredictions[i], forest.Predict(ExampleType(batchInputs[i % batchInputs.size()])), 1.0e-8);
+    }
+    testing::ProcessTest("Testing ForestPredictor, Predict(dataset)", batchMatches);
 }
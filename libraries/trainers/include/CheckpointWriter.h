@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CheckpointWriter.h (trainers)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <utilities/include/BinaryArchiver.h>
+#include <utilities/include/Files.h>
+#include <utilities/include/TaskPool.h>
+
+#include <future>
+#include <string>
+#include <utility>
+
+namespace ell
+{
+namespace trainers
+{
+    /// <summary> Writes periodic checkpoints of a predictor to disk without stalling the training
+    /// thread. `SaveCheckpoint` copies the predictor's state and hands the copy to a background
+    /// task that serializes it with a `BinaryArchiver`, so the cost on the training thread is just
+    /// the copy. At most one write is in flight at a time; saving a new checkpoint first waits for
+    /// the previous write to finish, so the training thread only stalls if checkpoints are
+    /// requested faster than they can be written. </summary>
+    ///
+    /// <typeparam name="PredictorType"> Type of the predictor being checkpointed. Must be copyable
+    /// and archivable. </typeparam>
+    template <typename PredictorType>
+    class CheckpointWriter
+    {
+    public:
+        /// <summary> Constructs an instance of CheckpointWriter. </summary>
+        ///
+        /// <param name="filenamePrefix"> The prefix of the checkpoint filenames. Checkpoint number
+        /// `n` is written to `<filenamePrefix>_<n>.bin`. </param>
+        /// <param name="async"> If `true` (the default), write checkpoints on a background thread.
+        /// If `false`, `SaveCheckpoint` writes the checkpoint before returning. </param>
+        CheckpointWriter(std::string filenamePrefix, bool async = true);
+
+        CheckpointWriter(const CheckpointWriter&) = delete;
+        CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+        /// <summary> Destructor. Waits for any write still in flight. </summary>
+        ~CheckpointWriter();
+
+        /// <summary> Saves a checkpoint of the given predictor. The predictor is copied before
+        /// this function returns, so the caller is free to keep training while the checkpoint is
+        /// written. </summary>
+        ///
+        /// <param name="predictor"> The predictor to checkpoint. </param>
+        void SaveCheckpoint(const PredictorType& predictor);
+
+        /// <summary> Waits until the checkpoint write in flight, if any, has finished. </summary>
+        void WaitForPendingWrite();
+
+        /// <summary> Gets the number of checkpoints saved so far. </summary>
+        ///
+        /// <returns> The number of checkpoints saved. </returns>
+        size_t NumCheckpoints() const { return _numCheckpoints; }
+
+        /// <summary> Gets the filename of the most recently saved checkpoint. Note that the write
+        /// may still be in flight; call `WaitForPendingWrite` before reading the file. </summary>
+        ///
+        /// <returns> The filename of the last checkpoint, or the empty string if no checkpoint has
+        /// been saved. </returns>
+        std::string GetLastCheckpointFilename() const;
+
+    private:
+        std::string GetCheckpointFilename(size_t checkpointIndex) const;
+        static void WriteCheckpoint(const PredictorType& predictor, const std::string& filename);
+
+        std::string _filenamePrefix;
+        bool _async;
+        size_t _numCheckpoints = 0;
+        std::future<void> _pendingWrite;
+    };
+} // namespace trainers
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace trainers
+{
+    template <typename PredictorType>
+    CheckpointWriter<PredictorType>::CheckpointWriter(std::string filenamePrefix, bool async) :
+        _filenamePrefix(std::move(filenamePrefix)),
+        _async(async)
+    {
+    }
+
+    template <typename PredictorType>
+    CheckpointWriter<PredictorType>::~CheckpointWriter()
+    {
+        WaitForPendingWrite();
+    }
+
+    template <typename PredictorType>
+    void CheckpointWriter<PredictorType>::SaveCheckpoint(const PredictorType& predictor)
+    {
+        WaitForPendingWrite();
+
+        auto filename = GetCheckpointFilename(_numCheckpoints);
+        if (_async)
+        {
+            // copy the predictor on this thread and let the background task serialize the copy
+            _pendingWrite = utilities::TaskPool::GetDefault().Submit([snapshot = predictor, filename]() {
+                WriteCheckpoint(snapshot, filename);
+            });
+        }
+        else
+        {
+            WriteCheckpoint(predictor, filename);
+        }
+        ++_numCheckpoints;
+    }
+
+    template <typename PredictorType>
+    void CheckpointWriter<PredictorType>::WaitForPendingWrite()
+    {
+        if (_pendingWrite.valid())
+        {
+            _pendingWrite.get();
+        }
+    }
+
+    template <typename PredictorType>
+    std::string CheckpointWriter<PredictorType>::GetLastCheckpointFilename() const
+    {
+        if (_numCheckpoints == 0)
+        {
+            return "";
+        }
+        return GetCheckpointFilename(_numCheckpoints - 1);
+    }
+
+    template <typename PredictorType>
+    std::string CheckpointWriter<PredictorType>::GetCheckpointFilename(size_t checkpointIndex) const
+    {
+        return _filenamePrefix + "_" + std::to_string(checkpointIndex) + ".bin";
+    }
+
+    template <typename PredictorType>
+    void CheckpointWriter<PredictorType>::WriteCheckpoint(const PredictorType& predictor, const std::string& filename)
+    {
+        auto stream = utilities::OpenBinaryOfstream(filename);
+        utilities::BinaryArchiver archiver(stream);
+        archiver.Archive(predictor);
+    }
+} // namespace trainers
+} // namespace ell
+
+#pragma endregion implementation
@@ -15,6 +15,8 @@
 
 #include <predictors/include/ForestPredictor.h>
 
+#include <utilities/include/Debug.h>
+#include <utilities/include/Exception.h>
 #include <utilities/include/OutputStreamImpostor.h>
 
 #include <iostream> // For std::cout in VERBOSE_MODE
@@ -32,6 +34,11 @@ namespace trainers
         double minSplitGain = 0.0;
         size_t maxSplitsPerRound = 0;
         size_t numRounds = 0;
+
+        /// <summary> Number of threads used to evaluate candidate split rules, in trainers that
+        /// support it. The candidates are independent, so the result does not depend on the thread
+        /// count. </summary>
+        size_t numThreads = 1;
     };
 
     /// <summary> Nontemplated base class for forest trainers, provides some reusable internal classes. </summary>
@@ -46,6 +53,7 @@ namespace trainers
 
             void Increment(const data::WeightLabel& weightLabel);
             Sums operator-(const Sums& other) const;
+            Sums operator+(const Sums& other) const;
             double GetMeanLabel() const;
             void Print(std::ostream& os) const;
         };
@@ -134,6 +142,14 @@ namespace trainers
         /// <returns> A const reference to the current predictor. </returns>
         const PredictorType& GetPredictor() const override { return _forest; };
 
+        /// <summary> Seeds the trainer with a previously trained forest, so that subsequent updates
+        /// extend the given forest instead of growing a new one from scratch. Call this before
+        /// SetDataset, so that the example metadata is initialized with the warm-start predictions.
+        /// </summary>
+        ///
+        /// <param name="forest"> The forest to extend. </param>
+        void SetWarmStart(const PredictorType& forest);
+
     protected:
         //
         // Private internal structs
@@ -241,6 +257,14 @@ namespace trainers
         }
     }
 
+    template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
+    void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::SetWarmStart(const PredictorType& forest)
+    {
+        DEBUG_THROW(_dataset.NumExamples() != 0, utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "can only call SetWarmStart before SetDataset"));
+
+        _forest = forest;
+    }
+
     template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
     void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::Update()
     {
@@ -14,8 +14,11 @@
 #include <predictors/include/ConstantPredictor.h>
 #include <predictors/include/SingleElementThresholdPredictor.h>
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <map>
 #include <random>
-#include <tuple>
 
 namespace ell
 {
@@ -68,7 +71,8 @@ namespace trainers
 
         double CalculateGain(const Sums& sums, const Sums& sums0, const Sums& sums1) const;
         std::vector<SplitRuleType> CallThresholdFinder(Range range);
-        std::tuple<Sums, size_t> EvaluateSplitRule(const SplitRuleType& splitRule, const Range& range) const;
+        std::vector<EvaluateSplitRuleResult> EvaluateSplitRules(const std::vector<SplitRuleType>& splitRuleCandidates, const Range& range) const;
+        void EvaluateSplitRuleGroup(const std::vector<SplitRuleType>& splitRuleCandidates, const std::vector<size_t>& group, const Range& range, std::vector<EvaluateSplitRuleResult>& results) const;
 
         // member variables
         LossFunctionType _lossFunction;
@@ -76,6 +80,7 @@ namespace trainers
         std::default_random_engine _random;
         size_t _thresholdFinderSampleSize;
         size_t _candidatesPerInput;
+        size_t _numThreads;
     };
 
     /// <summary> Makes a simple forest trainer. </summary>
@@ -92,6 +97,7 @@ namespace trainers
 
 #pragma region implementation
 
+#include <utilities/include/Exception.h>
 #include <utilities/include/RandomEngines.h>
 
 namespace ell
@@ -105,7 +111,8 @@ namespace trainers
         _thresholdFinder(thresholdFinder),
         _random(utilities::GetRandomEngine(parameters.randomSeed)),
         _thresholdFinderSampleSize(parameters.thresholdFinderSampleSize),
-        _candidatesPerInput(parameters.candidatesPerInput)
+        _candidatesPerInput(parameters.candidatesPerInput),
+        _numThreads(std::max<size_t>(parameters.numThreads, 1))
     {
     }
 
@@ -115,13 +122,12 @@ namespace trainers
         SplitCandidate bestSplitCandidate(nodeId, range, sums);
 
         auto splitRuleCandidates = CallThresholdFinder(range);
+        auto results = EvaluateSplitRules(splitRuleCandidates, range);
 
-        for (const auto& splitRuleCandidate : splitRuleCandidates)
+        for (size_t i = 0; i < splitRuleCandidates.size(); ++i)
         {
-            Sums sums0;
-            size_t size0;
-
-            std::tie(sums0, size0) = EvaluateSplitRule(splitRuleCandidate, range);
+            const Sums& sums0 = results[i].sums0;
+            size_t size0 = results[i].size0;
 
             Sums sums1 = sums - sums0;
             double gain = CalculateGain(sums, sums0, sums1);
@@ -130,7 +136,7 @@ namespace trainers
             if (gain > bestSplitCandidate.gain)
             {
                 bestSplitCandidate.gain = gain;
-                bestSplitCandidate.splitRule = splitRuleCandidate;
+                bestSplitCandidate.splitRule = splitRuleCandidates[i];
                 bestSplitCandidate.ranges.SplitChildRange(0, size0);
                 bestSplitCandidate.stats.SetChildSums({ sums0, sums1 });
             }
@@ -172,26 +178,118 @@ namespace trainers
     }
 
     template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
-    auto HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::EvaluateSplitRule(const SplitRuleType& splitRule, const Range& range) const -> std::tuple<Sums, size_t>
+    auto HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::EvaluateSplitRules(const std::vector<SplitRuleType>& splitRuleCandidates, const Range& range) const -> std::vector<EvaluateSplitRuleResult>
     {
-        Sums sums0;
-        size_t size0 = 0;
+        std::vector<EvaluateSplitRuleResult> results(splitRuleCandidates.size());
+
+        // group the candidates by input element, in increasing threshold order, so that all of
+        // the candidates for one input element are evaluated with a single bucketed pass over
+        // the examples
+        std::map<size_t, std::vector<size_t>> candidatesPerElement;
+        for (size_t i = 0; i < splitRuleCandidates.size(); ++i)
+        {
+            candidatesPerElement[splitRuleCandidates[i].GetElementIndex()].push_back(i);
+        }
+
+        std::vector<std::vector<size_t>> groups;
+        groups.reserve(candidatesPerElement.size());
+        for (auto& element : candidatesPerElement)
+        {
+            std::sort(element.second.begin(), element.second.end(), [&](size_t a, size_t b) {
+                return splitRuleCandidates[a].GetThreshold() < splitRuleCandidates[b].GetThreshold();
+            });
+            groups.push_back(std::move(element.second));
+        }
+
+        size_t numThreads = std::min(_numThreads, groups.size());
+        if (numThreads <= 1)
+        {
+            for (const auto& group : groups)
+            {
+                EvaluateSplitRuleGroup(splitRuleCandidates, group, range, results);
+            }
+            return results;
+        }
+
+        // the group evaluations only read the dataset and write to disjoint results, so the
+        // workers share nothing; each worker grabs the next unevaluated group
+        std::atomic<size_t> nextGroup{ 0 };
+        std::vector<std::future<void>> futures;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            futures.push_back(std::async(std::launch::async, [this, &splitRuleCandidates, &groups, &range, &results, &nextGroup] {
+                for (;;)
+                {
+                    size_t i = nextGroup++;
+                    if (i >= groups.size())
+                    {
+                        break;
+                    }
+                    EvaluateSplitRuleGroup(splitRuleCandidates, groups[i], range, results);
+                }
+            }));
+        }
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+
+        return results;
+    }
+
+    template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
+    void HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::EvaluateSplitRuleGroup(const std::vector<SplitRuleType>& splitRuleCandidates, const std::vector<size_t>& group, const Range& range, std::vector<EvaluateSplitRuleResult>& results) const
+    {
+        size_t elementIndex = splitRuleCandidates[group.front()].GetElementIndex();
+
+        // accumulate one sums bucket per threshold interval: bucket k holds the examples that
+        // fall between the thresholds of candidates group[k-1] and group[k]
+        std::vector<Sums> bucketSums(group.size() + 1);
+        std::vector<size_t> bucketSizes(group.size() + 1);
 
         auto exampleIterator = _dataset.GetExampleIterator(range.firstIndex, range.size);
         while (exampleIterator.IsValid())
         {
             const auto& example = exampleIterator.Get();
-            auto prediction = splitRule.Predict(example.GetDataVector());
-            if (prediction == 0)
+            const auto& dataVector = example.GetDataVector();
+            if (dataVector.PrefixLength() <= elementIndex)
             {
-                sums0.Increment(example.GetMetadata().weak);
-                ++size0;
+                throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange);
             }
+            double value = dataVector[elementIndex];
+
+            // binary search for the first candidate whose threshold admits the example into child 0
+            size_t low = 0;
+            size_t high = group.size();
+            while (low < high)
+            {
+                size_t mid = (low + high) / 2;
+                if (value <= splitRuleCandidates[group[mid]].GetThreshold())
+                {
+                    high = mid;
+                }
+                else
+                {
+                    low = mid + 1;
+                }
+            }
+
+            bucketSums[low].Increment(example.GetMetadata().weak);
+            ++bucketSizes[low];
             exampleIterator.Next();
         }
 
-        return std::make_tuple(sums0, size0);
-    };
+        // candidate group[k] admits into child 0 exactly the examples in buckets 0,...,k
+        Sums partialSums;
+        size_t partialSize = 0;
+        for (size_t k = 0; k < group.size(); ++k)
+        {
+            partialSums = partialSums + bucketSums[k];
+            partialSize += bucketSizes[k];
+            results[group[k]].sums0 = partialSums;
+            results[group[k]].size0 = partialSize;
+        }
+    }
 
     template <typename LossFunctionType, typename BoosterType, typename ThresholdFinderType>
     std::unique_ptr<ITrainer<predictors::SimpleForestPredictor>> MakeHistogramForestTrainer(const LossFunctionType& lossFunction, const BoosterType& booster, const ThresholdFinderType& thresholdFinder, const HistogramForestTrainerParameters& parameters)
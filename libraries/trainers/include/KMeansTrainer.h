@@ -32,8 +32,11 @@ namespace trainers
         /// <param name="dimension"> The input dimension. </param>
         /// <param name="numClusters"> The number of clusters. </param>
         /// <param name="iterations"> The number of iterations. </param>
+        /// <param name="numThreads"> The number of threads used to assign points to clusters. The
+        /// assignment is computed in fixed blocks of points, so the result does not depend on the
+        /// thread count. </param>
         ///
-        KMeansTrainer(size_t dimension, size_t numClusters, size_t iterations);
+        KMeansTrainer(size_t dimension, size_t numClusters, size_t iterations, size_t numThreads = 1);
 
         /// <summary> Constructs an instance of KMeansTrainer trainer </summary>
         ///
@@ -69,6 +72,9 @@ namespace trainers
         // Assign each point to the closest mean.
         double assignClosestCenter(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, math::VectorReference<size_t, math::VectorOrientation::column> clusterAssignment);
 
+        // Assign a block of points to their closest means and return the total distance of the block.
+        double assignClosestCenterBlock(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, math::VectorReference<size_t, math::VectorOrientation::column> clusterAssignment, const math::ColumnVector<double>& meanSqNorms, size_t blockStart, size_t blockSize);
+
         // Recompute the cluster means.
         void recomputeMeans(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, const math::ColumnVector<size_t> clusterAssignment);
 
@@ -89,6 +95,9 @@ namespace trainers
 
         // Number of clusters.
         size_t _numClusters = 0;
+
+        // Number of threads used to assign points to clusters.
+        size_t _numThreads = 1;
     };
 } // namespace trainers
 } // namespace ell
@@ -68,6 +68,9 @@ namespace trainers
 
         ///<summary>Whether to output diagnostic information to std::cout.</summary>
         bool verbose;
+
+        ///<summary>The number of threads used to compute the training objective; the result does not depend on the thread count</summary>
+        size_t numThreads = 1;
     };
 
 } // namespace trainers
@@ -74,6 +74,23 @@ namespace trainers
         /// <returns> Information on the trained predictor. </returns>
         SDCAPredictorInfo GetPredictorInfo() const { return _predictorInfo; }
 
+        /// <summary> Gets the dual variables, which can be stored and later used to warm-start a
+        /// new trainer. The variables appear in the dataset's current order, which differs from the
+        /// order in which the examples were provided if permutation is enabled. </summary>
+        ///
+        /// <returns> The dual variable of each example. </returns>
+        std::vector<double> GetDualVariables() const;
+
+        /// <summary> Warm-starts the trainer from dual variables stored during a previous training
+        /// session, instead of starting from zero. The predictor is reconstructed from the dual
+        /// variables, so subsequent updates continue from the previous solution. Call this after
+        /// SetDataset and before the first update; the dual variables must align with the examples
+        /// in the dataset (use zero for examples that were not part of the previous session).
+        /// </summary>
+        ///
+        /// <param name="dualVariables"> The dual variable of each example. </param>
+        void SetWarmStart(const std::vector<double>& dualVariables);
+
     private:
         struct TrainerMetadata
         {
@@ -132,6 +149,7 @@ namespace trainers
 
 #include <data/include/DataVectorOperations.h>
 
+#include <utilities/include/Exception.h>
 #include <utilities/include/RandomEngines.h>
 
 namespace ell
@@ -188,6 +206,45 @@ namespace trainers
         ComputeObjectives();
     }
 
+    template <typename LossFunctionType, typename RegularizerType>
+    std::vector<double> SDCATrainer<LossFunctionType, RegularizerType>::GetDualVariables() const
+    {
+        std::vector<double> dualVariables(_dataset.NumExamples());
+        for (size_t i = 0; i < _dataset.NumExamples(); ++i)
+        {
+            dualVariables[i] = _dataset.GetExample(i).GetMetadata().dualVariable;
+        }
+        return dualVariables;
+    }
+
+    template <typename LossFunctionType, typename RegularizerType>
+    void SDCATrainer<LossFunctionType, RegularizerType>::SetWarmStart(const std::vector<double>& dualVariables)
+    {
+        if (dualVariables.size() != _dataset.NumExamples())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "number of dual variables must match the number of examples");
+        }
+
+        // rebuild the dual vector sum from the given dual variables
+        _v.Reset();
+        _d = 0;
+        for (size_t i = 0; i < _dataset.NumExamples(); ++i)
+        {
+            auto& example = _dataset[i];
+            example.GetMetadata().dualVariable = dualVariables[i];
+            if (dualVariables[i] != 0)
+            {
+                ResizeTo(example.GetDataVector());
+                _v.Transpose() += (-dualVariables[i] * _inverseScaledRegularization) * example.GetDataVector();
+                _d += -dualVariables[i] * _inverseScaledRegularization;
+            }
+        }
+
+        // recover the primal solution from the dual vector sum
+        _regularizer.ConjugateGradient(_v, _d, _predictor.GetWeights(), _predictor.GetBias());
+        ComputeObjectives();
+    }
+
     template <typename LossFunctionType, typename RegularizerType>
     SDCATrainer<LossFunctionType, RegularizerType>::TrainerMetadata::TrainerMetadata(const data::WeightLabel& original) :
         weightLabel(original)
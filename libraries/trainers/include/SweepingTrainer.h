@@ -15,6 +15,8 @@
 
 #include <evaluators/include/Evaluator.h>
 
+#include <atomic>
+#include <future>
 #include <memory>
 #include <random>
 #include <string>
@@ -38,7 +40,10 @@ namespace trainers
         /// <summary> Constructs an instance of SweepingTrainer. </summary>
         ///
         /// <param name="evaluatingTrainers"> A vector of evaluating trainers. </param>
-        SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers);
+        /// <param name="numThreads"> The number of threads used to update the internal trainers.
+        /// The trainers are independent of each other, so the result does not depend on the thread
+        /// count. </param>
+        SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers, size_t numThreads = 1);
 
         /// <summary> Sets the trainer's dataset. </summary>
         ///
@@ -56,16 +61,18 @@ namespace trainers
     private:
         data::Dataset<ExampleType> _dataset;
         std::vector<EvaluatingTrainerType> _evaluatingTrainers;
+        size_t _numThreads = 1;
     };
 
     /// <summary> Makes an incremental trainer that runs multiple internal trainers and chooses the best performing predictor. </summary>
     ///
     /// <typeparam name="PredictorType"> Type of the predictor returned by this trainer. </typeparam>
     /// <param name="evaluatingTrainers"> A vector of evaluating trainers. </param>
+    /// <param name="numThreads"> The number of threads used to update the internal trainers. </param>
     ///
     /// <returns> A unique_ptr to a sweeping trainer. </returns>
     template <typename PredictorType>
-    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers);
+    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers, size_t numThreads = 1);
 } // namespace trainers
 } // namespace ell
 
@@ -76,8 +83,9 @@ namespace ell
 namespace trainers
 {
     template <typename PredictorType>
-    SweepingTrainer<PredictorType>::SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers) :
-        _evaluatingTrainers(std::move(evaluatingTrainers))
+    SweepingTrainer<PredictorType>::SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers, size_t numThreads) :
+        _evaluatingTrainers(std::move(evaluatingTrainers)),
+        _numThreads(std::max<size_t>(numThreads, 1))
     {
         assert(_evaluatingTrainers.size() > 0);
     }
@@ -86,14 +94,49 @@ namespace trainers
     void SweepingTrainer<PredictorType>::SetDataset(const data::AnyDataset& anyDataset)
     {
         _dataset = data::Dataset<ExampleType>(anyDataset);
+
+        // all of the internal trainers share the one loaded dataset
+        for (auto& evaluatingTrainer : _evaluatingTrainers)
+        {
+            evaluatingTrainer.SetDataset(anyDataset);
+        }
     }
 
     template <typename PredictorType>
     void SweepingTrainer<PredictorType>::Update()
     {
-        for (size_t i = 0; i < _evaluatingTrainers.size(); ++i)
+        size_t numThreads = std::min(_numThreads, _evaluatingTrainers.size());
+        if (numThreads <= 1)
         {
-            _evaluatingTrainers[i].Update();
+            for (size_t i = 0; i < _evaluatingTrainers.size(); ++i)
+            {
+                _evaluatingTrainers[i].Update();
+            }
+        }
+        else
+        {
+            // the internal trainers are independent of each other, so each worker just grabs the
+            // next trainer that hasn't been updated yet
+            std::atomic<size_t> nextTrainer{ 0 };
+            std::vector<std::future<void>> futures;
+            for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+            {
+                futures.push_back(std::async(std::launch::async, [this, &nextTrainer] {
+                    for (;;)
+                    {
+                        size_t i = nextTrainer++;
+                        if (i >= _evaluatingTrainers.size())
+                        {
+                            break;
+                        }
+                        _evaluatingTrainers[i].Update();
+                    }
+                }));
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
         }
     }
 
@@ -116,9 +159,9 @@ namespace trainers
     }
 
     template <typename PredictorType>
-    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers)
+    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers, size_t numThreads)
     {
-        return std::make_unique<SweepingTrainer<PredictorType>>(std::move(evaluatingTrainers));
+        return std::make_unique<SweepingTrainer<PredictorType>>(std::move(evaluatingTrainers), numThreads);
     }
 } // namespace trainers
 } // namespace ell
@@ -61,6 +61,33 @@ namespace trainers
         template <typename ExampleIteratorType>
         std::vector<predictors::SingleElementThresholdPredictor> GetThresholds(ExampleIteratorType exampleIterator) const;
     };
+
+    /// <summary> A threshold finder that places thresholds at approximately equally weighted
+    /// quantiles of each input element. The quantile sketch is built from the examples of the
+    /// first call and reused by all subsequent calls, so repeated split searches pay for the
+    /// sketch only once. </summary>
+    class QuantileThresholdFinder : public ThresholdFinder
+    {
+    public:
+        /// <summary> Constructs an instance of QuantileThresholdFinder. </summary>
+        ///
+        /// <param name="binsPerInput"> The number of quantile bins per input element; each input
+        /// element contributes at most binsPerInput-1 thresholds. </param>
+        QuantileThresholdFinder(size_t binsPerInput);
+
+        /// <summary> Returns a vector of SingleElementThresholdPredictor. </summary>
+        ///
+        /// <typeparam name="ExampleIteratorType"> Type of example iterator. </typeparam>
+        /// <param name="exampleIterator"> The example iterator, only used on the first call. </param>
+        ///
+        /// <returns> The thresholds. </returns>
+        template <typename ExampleIteratorType>
+        std::vector<predictors::SingleElementThresholdPredictor> GetThresholds(ExampleIteratorType exampleIterator) const;
+
+    private:
+        size_t _binsPerInput;
+        mutable std::vector<predictors::SingleElementThresholdPredictor> _thresholdCache;
+    };
 } // namespace trainers
 } // namespace ell
 
@@ -125,6 +152,41 @@ namespace trainers
 
         return thresholdPredictors;
     }
+
+    template <typename ExampleIteratorType>
+    std::vector<predictors::SingleElementThresholdPredictor> trainers::QuantileThresholdFinder::GetThresholds(ExampleIteratorType exampleIterator) const
+    {
+        if (!_thresholdCache.empty())
+        {
+            return _thresholdCache;
+        }
+
+        auto uniqueValuesResult = UniqueValues(exampleIterator);
+        double weightPerBin = uniqueValuesResult.totalWeight / _binsPerInput;
+
+        for (size_t j = 0; j < uniqueValuesResult.weightedValues.size(); ++j)
+        {
+            const auto& featureValues = uniqueValuesResult.weightedValues[j];
+
+            // emit a threshold wherever the accumulated weight crosses a bin boundary
+            double accumulatedWeight = 0;
+            double nextBinBoundary = weightPerBin;
+            for (size_t i = 0; i + 1 < featureValues.size(); ++i)
+            {
+                accumulatedWeight += featureValues[i].weight;
+                if (accumulatedWeight >= nextBinBoundary)
+                {
+                    _thresholdCache.push_back({ j, 0.5 * (featureValues[i].value + featureValues[i + 1].value) });
+                    while (nextBinBoundary <= accumulatedWeight)
+                    {
+                        nextBinBoundary += weightPerBin;
+                    }
+                }
+            }
+        }
+
+        return _thresholdCache;
+    }
 } // namespace trainers
 } // namespace ell
 
@@ -31,6 +31,14 @@ namespace trainers
         return difference;
     }
 
+    typename ForestTrainerBase::Sums ForestTrainerBase::Sums::operator+(const Sums& other) const
+    {
+        Sums sum;
+        sum.sumWeights = sumWeights + other.sumWeights;
+        sum.sumWeightedLabels = sumWeightedLabels + other.sumWeightedLabels;
+        return sum;
+    }
+
     double ForestTrainerBase::Sums::GetMeanLabel() const
     {
         if (sumWeights == 0)
@@ -10,17 +10,20 @@
 #include <math/include/MatrixOperations.h>
 #include <math/include/VectorOperations.h>
 
+#include <atomic>
 #include <cmath>
+#include <future>
 
 namespace ell
 {
 namespace trainers
 {
-    KMeansTrainer::KMeansTrainer(size_t dim, size_t numClusters, size_t iterations) :
+    KMeansTrainer::KMeansTrainer(size_t dim, size_t numClusters, size_t iterations, size_t numThreads) :
         _means(dim, numClusters),
         _isInitialized(false),
         _iterations(iterations),
-        _numClusters(numClusters) {}
+        _numClusters(numClusters),
+        _numThreads(std::max<size_t>(numThreads, 1)) {}
 
     KMeansTrainer::KMeansTrainer(size_t numClusters, size_t iters, math::ColumnMatrix<double> means) :
         _means(means),
@@ -120,15 +123,90 @@ namespace trainers
 
     double KMeansTrainer::assignClosestCenter(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, math::VectorReference<size_t, math::VectorOrientation::column> clusterAssignment)
     {
-        auto D = pairwiseDistance(X, _means);
+        const size_t blockSize = 4096;
+        auto n = X.NumColumns();
+
+        // squared norms of the means, shared by all blocks
+        math::ColumnVector<double> meanSqNorms(_numClusters);
+        for (size_t j = 0; j < _numClusters; ++j)
+        {
+            meanSqNorms[j] = _means.GetColumn(j).Norm2Squared();
+        }
+
+        size_t numBlocks = (n + blockSize - 1) / blockSize;
+        std::vector<double> blockDistances(numBlocks);
+
+        size_t numThreads = std::min(_numThreads, numBlocks);
+        if (numThreads <= 1)
+        {
+            for (size_t b = 0; b < numBlocks; ++b)
+            {
+                blockDistances[b] = assignClosestCenterBlock(X, clusterAssignment, meanSqNorms, b * blockSize, std::min(blockSize, n - b * blockSize));
+            }
+        }
+        else
+        {
+            // the blocks only read X and the means and write to disjoint parts of the assignment,
+            // so the workers share nothing; each worker grabs the next unassigned block
+            std::atomic<size_t> nextBlock{ 0 };
+            std::vector<std::future<void>> futures;
+            for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+            {
+                futures.push_back(std::async(std::launch::async, [&, this] {
+                    for (;;)
+                    {
+                        size_t b = nextBlock++;
+                        if (b >= numBlocks)
+                        {
+                            break;
+                        }
+                        blockDistances[b] = assignClosestCenterBlock(X, clusterAssignment, meanSqNorms, b * blockSize, std::min(blockSize, n - b * blockSize));
+                    }
+                }));
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        }
 
+        // reduce the block distances in block order, so the total does not depend on the thread count
         double totalDist = 0;
-        for (size_t i = 0; i < D.NumRows(); ++i)
+        for (size_t b = 0; b < numBlocks; ++b)
         {
-            auto dist = D.GetRow(i);
-            auto minElement = std::min_element(dist.GetDataPointer(), dist.GetDataPointer() + dist.Size());
-            clusterAssignment[i] = minElement - dist.GetDataPointer();
-            totalDist += *minElement;
+            totalDist += blockDistances[b];
+        }
+
+        return totalDist;
+    }
+
+    double KMeansTrainer::assignClosestCenterBlock(math::ConstMatrixReference<double, math::MatrixLayout::columnMajor> X, math::VectorReference<size_t, math::VectorOrientation::column> clusterAssignment, const math::ColumnVector<double>& meanSqNorms, size_t blockStart, size_t blockSize)
+    {
+        auto Xblock = X.GetSubMatrix(0, blockStart, X.NumRows(), blockSize);
+
+        // P_ij = -2 * X_i' * mu_j; adding ||X_i||^2 + ||mu_j||^2 gives the squared distance
+        math::ColumnMatrix<double> product(blockSize, _numClusters);
+        math::MultiplyScaleAddUpdate(-2.0, Xblock.Transpose(), _means, 0.0, product);
+
+        double totalDist = 0;
+        for (size_t i = 0; i < blockSize; ++i)
+        {
+            auto row = product.GetRow(i);
+
+            size_t closest = 0;
+            double closestDist = row[0] + meanSqNorms[0];
+            for (size_t j = 1; j < _numClusters; ++j)
+            {
+                double dist = row[j] + meanSqNorms[j];
+                if (dist < closestDist)
+                {
+                    closest = j;
+                    closestDist = dist;
+                }
+            }
+
+            clusterAssignment[blockStart + i] = closest;
+            totalDist += closestDist + Xblock.GetColumn(i).Norm2Squared();
         }
 
         return totalDist;
@@ -17,9 +17,11 @@
 
 #include <utilities/include/Unused.h>
 
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <ctime>
+#include <future>
 #include <iostream>
 
 namespace ell
@@ -140,8 +142,8 @@ namespace trainers
     math::ColumnMatrix<double> ProtoNNTrainer::SimilarityKernel(ConstColumnMatrixReference X, math::ColumnMatrixReference<double> WX, const double gamma, const size_t begin, const size_t end, bool recomputeWX)
     {
         assert(begin < end);
-        auto B = (_modelMap[ProtoNNParameterIndex::B])->GetData();
-        auto W = (_modelMap[ProtoNNParameterIndex::W])->GetData();
+        auto B = _modelMap.at(ProtoNNParameterIndex::B)->GetData();
+        auto W = _modelMap.at(ProtoNNParameterIndex::W)->GetData();
 
         auto wx = WX.GetSubMatrix(0, begin, WX.NumRows(), end - begin);
 
@@ -172,30 +174,16 @@ namespace trainers
         math::RowMatrix<double> wxb(wx.NumColumns(), B.NumColumns());
         math::MultiplyScaleAddUpdate(2 * gamma * gamma, wx.Transpose(), B, 0.0, wxb);
 
-        // repmat of bColNormSquare and scaling by -gamma * gamma
-        math::RowMatrix<double> gammaSquareCol(end - begin, 1);
-        gammaSquareCol.Fill(-gamma * gamma);
-        math::RowMatrix<double> bColNormSquareResized(gammaSquareCol.NumRows(), bColNormSquare.NumColumns());
-        // S1 = gammaSquareCol * bColSum;
-        math::MultiplyScaleAddUpdate(1.0, gammaSquareCol, bColNormSquare, 0.0, bColNormSquareResized);
-
-        // repmat of wxColNormSquare and scaling by -gamma * gamma
-        math::RowMatrix<double> gammaSquareRow(B.NumColumns(), 1);
-        gammaSquareRow.Fill(-gamma * gamma);
-        math::RowMatrix<double> wxColNormSquareResized(gammaSquareRow.NumRows(), wxColNormSquare.NumColumns());
-        // S2 = gammaSquareRow * wxColSum;
-        math::MultiplyScaleAddUpdate(1.0, gammaSquareRow, wxColNormSquare, 0.0, wxColNormSquareResized);
-
-        // D = wxb + bColNormSquareResized
-        math::RowMatrix<double> similarityMatrix(wxb.NumRows(), wxb.NumColumns());
-        math::ScaleAddSet(1.0, wxb, 1.0, bColNormSquareResized, similarityMatrix);
-
-        // D = D + wxColNormSquareResized'
-        math::RowMatrix<double> distance(similarityMatrix.NumRows(), similarityMatrix.NumColumns());
-        math::ScaleAddSet(1.0, similarityMatrix, 1.0, wxColNormSquareResized.Transpose(), distance);
-
-        // similarityMatrix = exp(D)
-        similarityMatrix = ProtoNNTrainerUtils::MatrixExp(distance);
+        // S_{ij} = exp(wxb_{ij} - gamma^2 * ||B_j||^2 - gamma^2 * ||WX_i||^2); the cross term is the
+        // single matrix product above and the squared norms are shared by all the batch entries
+        math::ColumnMatrix<double> similarityMatrix(wxb.NumRows(), wxb.NumColumns());
+        for (size_t i = 0; i < similarityMatrix.NumRows(); ++i)
+        {
+            for (size_t j = 0; j < similarityMatrix.NumColumns(); ++j)
+            {
+                similarityMatrix(i, j) = std::exp(wxb(i, j) + (-gamma * gamma) * bColNormSquare(0, j) + (-gamma * gamma) * wxColNormSquare(0, i));
+            }
+        }
 
         return similarityMatrix;
     }
@@ -209,7 +197,7 @@ namespace trainers
     {
         assert(end - begin == D.NumRows());
 
-        auto Z = (_modelMap[ProtoNNParameterIndex::Z])->GetData();
+        auto Z = _modelMap.at(ProtoNNParameterIndex::Z)->GetData();
 
         // residual = y - ZD'
         math::ColumnMatrix<double> ZD(Z.NumRows(), D.NumRows());
@@ -264,9 +252,9 @@ namespace trainers
         size_t batchSize = maxBatchSize;
         size_t numBatches = (n + batchSize - 1) / batchSize;
 
-        // Aggregate loss over the batches
-        for (size_t i = 0; i < numBatches; ++i)
-        {
+        // Each batch evaluates the kernel and the loss on a disjoint column range of the data
+        std::vector<double> batchLosses(numBatches);
+        auto processBatch = [&, this](size_t i) {
             size_t idx1 = (i * batchSize) % n;
             size_t idx2 = ((i + 1) * (batchSize) % n);
             if (idx2 <= idx1) idx2 = n;
@@ -277,7 +265,47 @@ namespace trainers
             auto D = SimilarityKernel(X, WX, gamma, idx1, idx2, recomputeWX);
             auto y = Y.GetSubMatrix(0, idx1, Y.NumRows(), idx2 - idx1);
 
-            objective += Loss(y, D);
+            batchLosses[i] = Loss(y, D);
+        };
+
+        size_t numThreads = std::min(std::max<size_t>(_parameters.numThreads, 1), numBatches);
+        if (numThreads <= 1)
+        {
+            for (size_t i = 0; i < numBatches; ++i)
+            {
+                processBatch(i);
+            }
+        }
+        else
+        {
+            // the batches only read the model parameters and write to disjoint columns of WX,
+            // so the workers share nothing; each worker grabs the next unprocessed batch
+            std::atomic<size_t> nextBatch{ 0 };
+            std::vector<std::future<void>> futures;
+            for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+            {
+                futures.push_back(std::async(std::launch::async, [&] {
+                    for (;;)
+                    {
+                        size_t i = nextBatch++;
+                        if (i >= numBatches)
+                        {
+                            break;
+                        }
+                        processBatch(i);
+                    }
+                }));
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        }
+
+        // reduce the batch losses in batch order, so the objective does not depend on the thread count
+        for (size_t i = 0; i < numBatches; ++i)
+        {
+            objective += batchLosses[i];
         }
 
         return objective;
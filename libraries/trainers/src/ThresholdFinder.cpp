@@ -40,5 +40,10 @@ namespace trainers
         }
         return current - begin + 1;
     }
+
+    QuantileThresholdFinder::QuantileThresholdFinder(size_t binsPerInput) :
+        _binsPerInput(std::max<size_t>(binsPerInput, 2))
+    {
+    }
 } // namespace trainers
 } // namespace ell
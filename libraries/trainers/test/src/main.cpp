@@ -12,10 +12,14 @@
 #include <functions/include/LogLoss.h>
 #include <functions/include/SquaredLoss.h>
 
+#include <trainers/include/CheckpointWriter.h>
 #include <trainers/include/MeanCalculator.h>
 #include <trainers/include/SDCATrainer.h>
 #include <trainers/include/SGDTrainer.h>
 
+#include <utilities/include/BinaryArchiver.h>
+#include <utilities/include/Files.h>
+
 #include <testing/include/testing.h>
 
 using namespace ell;
@@ -131,9 +135,44 @@ void TestMeanCalculator()
     testing::ProcessTest("TestMeanCalculator", mean == r);
 }
 
+void TestCheckpointWriter()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample({ { 1.0, 0.0, 2.0, 0.0, 3.0 }, { 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 4.0, 5.0, 6.0, 7.0 }, { 1.0, -1.0 } });
+    dataset.AddExample({ { 8.0, 0.0, 9.0 }, { 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 10.0 }, { 1.0, -1.0 } });
+
+    auto trainer = trainers::MakeSDCATrainer(functions::LogLoss(), functions::L2Regularizer(), { 1.0e-4, 1.0e-8, 20, false, "XYZ" });
+    trainer->SetDataset(dataset.GetAnyDataset());
+    trainer->Update();
+
+    trainers::CheckpointWriter<predictors::LinearPredictor<double>> checkpointWriter("checkpointTest");
+    checkpointWriter.SaveCheckpoint(trainer->GetPredictor());
+
+    // keep training while the first checkpoint is being written
+    trainer->Update();
+    checkpointWriter.SaveCheckpoint(trainer->GetPredictor());
+    checkpointWriter.WaitForPendingWrite();
+
+    testing::ProcessTest("TestCheckpointWriter filenames", checkpointWriter.NumCheckpoints() == 2 && checkpointWriter.GetLastCheckpointFilename() == "checkpointTest_1.bin");
+
+    // read the last checkpoint back and compare it with the live predictor
+    auto stream = utilities::OpenBinaryIfstream(checkpointWriter.GetLastCheckpointFilename());
+    utilities::SerializationContext context;
+    utilities::BinaryUnarchiver unarchiver(stream, context);
+    predictors::LinearPredictor<double> restored;
+    unarchiver.Unarchive(restored);
+
+    const auto& predictor = trainer->GetPredictor();
+    bool match = restored.GetBias() == predictor.GetBias() && restored.GetWeights() == predictor.GetWeights();
+    testing::ProcessTest("TestCheckpointWriter round trip", match);
+}
+
 int main()
 {
     TestSDCATrainer();
     TestSGDTrainer();
     TestMeanCalculator();
+    TestCheckpointWriter();
 }
@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ArenaAllocator.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> A simple bump allocator. Memory is carved out of large blocks in allocation order,
+    /// so objects allocated together end up adjacent in memory, and is released all at once when the
+    /// arena is destroyed --- individual allocations are never freed. Callers that place non-trivial
+    /// objects in the arena are responsible for running their destructors before the arena goes away. </summary>
+    class ArenaAllocator
+    {
+    public:
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="blockSize"> The size in bytes of the blocks the arena requests from the heap.
+        ///   Allocations larger than this get a dedicated block. </param>
+        explicit ArenaAllocator(size_t blockSize = defaultBlockSize);
+
+        ArenaAllocator(const ArenaAllocator&) = delete;
+        ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+        ArenaAllocator(ArenaAllocator&&) = default;
+        ArenaAllocator& operator=(ArenaAllocator&&) = default;
+
+        /// <summary> Allocates uninitialized storage from the arena. </summary>
+        ///
+        /// <param name="size"> The number of bytes to allocate. </param>
+        /// <param name="alignment"> The required alignment of the allocation. </param>
+        ///
+        /// <returns> A pointer to the storage, valid for the lifetime of the arena. </returns>
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        /// <summary> Gets the number of blocks the arena has requested from the heap. </summary>
+        ///
+        /// <returns> The number of blocks. </returns>
+        size_t GetNumBlocks() const { return _blocks.size(); }
+
+        /// <summary> Gets the total number of bytes handed out by `Allocate` (not counting alignment padding). </summary>
+        ///
+        /// <returns> The number of bytes allocated. </returns>
+        size_t GetBytesAllocated() const { return _bytesAllocated; }
+
+    private:
+        static constexpr size_t defaultBlockSize = 64 * 1024;
+
+        struct Block
+        {
+            std::unique_ptr<char[]> storage;
+            size_t size = 0;
+            size_t used = 0;
+        };
+
+        Block& AddBlock(size_t minSize);
+
+        std::vector<Block> _blocks;
+        size_t _blockSize;
+        size_t _bytesAllocated = 0;
+    };
+} // namespace utilities
+} // namespace ell
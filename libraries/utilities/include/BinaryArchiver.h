@@ -0,0 +1,346 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryArchiver.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Archiver.h"
+#include "Exception.h"
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    class MemoryMappedFile;
+
+    /// <summary> The tag byte that starts each entry in a binary archive. </summary>
+    enum class BinaryArchiverEntryType : uint8_t
+    {
+        scalar = 1,
+        array,
+        stringArray,
+        nullValue,
+        beginObject,
+        endObject,
+        beginObjectArray,
+        endObjectArray
+    };
+
+    /// <summary> The type code stored with each scalar or array entry in a binary archive. </summary>
+    enum class BinaryArchiverValueType : uint8_t
+    {
+        boolValue = 1,
+        charValue,
+        shortValue,
+        intValue,
+        unsignedIntValue,
+        int64Value,
+        uint64Value,
+        floatValue,
+        doubleValue,
+        stringValue
+    };
+
+    /// <summary> An archiver that encodes data as a compact tagged binary stream. Unlike the
+    /// text-based archivers, arrays of fundamental values (in particular, the weight tensors of
+    /// neural networks) are written as raw little-endian data, so archives are both much smaller
+    /// and much faster to read back. </summary>
+    class BinaryArchiver : public Archiver
+    {
+    public:
+        /// <summary> Default Constructor --- writes to standard output. </summary>
+        BinaryArchiver();
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="outputStream"> The stream to write data to. </param>
+        BinaryArchiver(std::ostream& outputStream);
+
+    protected:
+#define ARCHIVE_TYPE_OP(t) DECLARE_ARCHIVE_VALUE_OVERRIDE(t);
+        ARCHIVABLE_TYPES_LIST
+#undef ARCHIVE_TYPE_OP
+
+        void ArchiveValue(const char* name, const std::string& value) override;
+
+#define ARCHIVE_TYPE_OP(t) DECLARE_ARCHIVE_ARRAY_OVERRIDE(t);
+        ARCHIVABLE_TYPES_LIST
+#undef ARCHIVE_TYPE_OP
+
+        void ArchiveNull(const char* name) override;
+
+        void ArchiveArray(const char* name, const std::vector<std::string>& array) override;
+        void ArchiveArray(const char* name, const std::string& baseTypeName, const std::vector<const IArchivable*>& array) override;
+
+        void BeginArchiveObject(const char* name, const IArchivable& value) override;
+        void EndArchiveObject(const char* name, const IArchivable& value) override;
+
+        void EndArchiving() override;
+
+    private:
+        // Serialization
+        template <typename ValueType, IsFundamental<ValueType> concept = 0>
+        void WriteScalar(const char* name, const ValueType& value);
+
+        void WriteScalar(const char* name, const std::string& value);
+
+        template <typename ValueType>
+        void WriteArray(const char* name, const std::vector<ValueType>& array);
+
+        // Low-level output functions
+        void WriteSignature();
+        void WriteEntryHeader(BinaryArchiverEntryType entryType, const char* name);
+        void WriteByte(uint8_t value);
+        void WriteCount(uint64_t value);
+        void WriteStringData(const std::string& value);
+        void WriteRaw(const void* data, size_t numBytes);
+
+        std::ostream& _out;
+    };
+
+    /// <summary> An unarchiver that reads data encoded as a tagged binary stream. </summary>
+    class BinaryUnarchiver : public Unarchiver
+    {
+    public:
+        /// <summary> Default Constructor --- reads from standard input. </summary>
+        BinaryUnarchiver(SerializationContext context);
+
+        /// <summary> Constructor </summary>
+        ///
+        /// <param name="inputStream"> The stream to read data from. </summary>
+        BinaryUnarchiver(std::istream& inputStream, SerializationContext context);
+
+        /// <summary> Constructor --- reads from a memory-mapped file. Pages are faulted in on
+        /// demand by the operating system, so opening a large archive is cheap, and clean pages
+        /// are shared with other processes reading the same file. </summary>
+        ///
+        /// <param name="file"> The memory-mapped file to read data from. </param>
+        /// <param name="context"> The serialization context. </param>
+        BinaryUnarchiver(std::shared_ptr<MemoryMappedFile> file, SerializationContext context);
+
+        /// <summary> Indicates if a property with the given name is available to be read next </summary>
+        ///
+        /// <param name="name"> The name of the property </param>
+        ///
+        /// <returns> true if a property with the given name can be read next </returns>
+        bool HasNextPropertyName(const std::string& name) override;
+
+    protected:
+#define ARCHIVE_TYPE_OP(t) DECLARE_UNARCHIVE_VALUE_OVERRIDE(t);
+        ARCHIVABLE_TYPES_LIST
+#undef ARCHIVE_TYPE_OP
+
+        void UnarchiveValue(const char* name, std::string& value) override;
+
+        bool UnarchiveNull(const char* name) override;
+
+#define ARCHIVE_TYPE_OP(t) DECLARE_UNARCHIVE_ARRAY_OVERRIDE(t);
+        ARCHIVABLE_TYPES_LIST
+#undef ARCHIVE_TYPE_OP
+
+        void UnarchiveArray(const char* name, std::vector<std::string>& array) override;
+
+        void BeginUnarchiveArray(const char* name, const std::string& typeName) override;
+        bool BeginUnarchiveArrayItem(const std::string& typeName) override;
+        void EndUnarchiveArrayItem(const std::string& typeName) override;
+        void EndUnarchiveArray(const char* name, const std::string& typeName) override;
+
+        ArchivedObjectInfo BeginUnarchiveObject(const char* name, const std::string& typeName) override;
+        void EndUnarchiveObject(const char* name, const std::string& typeName) override;
+        void UnarchiveObjectAsPrimitive(const char* name, IArchivable& value) override;
+
+    private:
+        struct EntryHeader
+        {
+            BinaryArchiverEntryType entryType;
+            std::string name;
+        };
+
+        // Deserialization
+        template <typename ValueType, IsFundamental<ValueType> concept = 0>
+        void ReadScalar(const char* name, ValueType& value);
+
+        void ReadScalar(const char* name, std::string& value);
+
+        template <typename ValueType, IsFundamental<ValueType> concept = 0>
+        void ReadArray(const char* name, std::vector<ValueType>& array);
+
+        void ReadArray(const char* name, std::vector<std::string>& array);
+
+        // Low-level input functions
+        void ReadSignature();
+        EntryHeader ReadEntryHeader();
+        const EntryHeader& PeekEntryHeader();
+        EntryHeader MatchEntryHeader(BinaryArchiverEntryType entryType, const char* name);
+        void MatchValueType(BinaryArchiverValueType valueType);
+        uint8_t ReadByte();
+        uint64_t ReadCount();
+        std::string ReadStringData();
+        void ReadRaw(void* data, size_t numBytes);
+
+        std::istream& _in;
+        std::shared_ptr<MemoryMappedFile> _mappedFile;
+        const uint8_t* _mappedData = nullptr;
+        size_t _mappedSize = 0;
+        size_t _mappedOffset = 0;
+        EntryHeader _peekedHeader;
+        bool _hasPeekedHeader = false;
+    };
+
+    /// <summary> Computes a 64-bit content hash of an archivable object by streaming its binary
+    /// archive representation through an FNV-1a hash instead of storing it. Two objects with the
+    /// same archived state (structure and data) get the same hash. </summary>
+    ///
+    /// <param name="value"> The object to hash. </param>
+    ///
+    /// <returns> The hash of the object's archived state. </returns>
+    uint64_t HashArchivedObject(const IArchivable& value);
+} // namespace utilities
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> Gets the type code used to tag values of the given type in a binary archive. </summary>
+    template <typename ValueType>
+    constexpr BinaryArchiverValueType GetBinaryArchiverValueType()
+    {
+        if constexpr (std::is_same_v<ValueType, bool>)
+        {
+            return BinaryArchiverValueType::boolValue;
+        }
+        else if constexpr (std::is_same_v<ValueType, char>)
+        {
+            return BinaryArchiverValueType::charValue;
+        }
+        else if constexpr (std::is_same_v<ValueType, short>)
+        {
+            return BinaryArchiverValueType::shortValue;
+        }
+        else if constexpr (std::is_same_v<ValueType, int>)
+        {
+            return BinaryArchiverValueType::intValue;
+        }
+        else if constexpr (std::is_same_v<ValueType, unsigned int>)
+        {
+            return BinaryArchiverValueType::unsignedIntValue;
+        }
+        else if constexpr (std::is_same_v<ValueType, float>)
+        {
+            return BinaryArchiverValueType::floatValue;
+        }
+        else if constexpr (std::is_same_v<ValueType, double>)
+        {
+            return BinaryArchiverValueType::doubleValue;
+        }
+        else if constexpr (std::is_integral_v<ValueType> && std::is_signed_v<ValueType> && sizeof(ValueType) == 8)
+        {
+            // int64_t, and "long" on platforms where it isn't the same type as int64_t
+            return BinaryArchiverValueType::int64Value;
+        }
+        else if constexpr (std::is_integral_v<ValueType> && !std::is_signed_v<ValueType> && sizeof(ValueType) == 8)
+        {
+            // uint64_t, and "unsigned long" on platforms where it isn't the same type as uint64_t
+            return BinaryArchiverValueType::uint64Value;
+        }
+        else
+        {
+            static_assert(sizeof(ValueType) == 0, "type cannot be stored in a binary archive");
+        }
+    }
+
+    //
+    // Serialization
+    //
+    template <typename ValueType, IsFundamental<ValueType> concept>
+    void BinaryArchiver::WriteScalar(const char* name, const ValueType& value)
+    {
+        WriteEntryHeader(BinaryArchiverEntryType::scalar, name);
+        WriteByte(static_cast<uint8_t>(GetBinaryArchiverValueType<ValueType>()));
+        if constexpr (std::is_same_v<ValueType, bool>)
+        {
+            WriteByte(value ? 1 : 0);
+        }
+        else
+        {
+            WriteRaw(&value, sizeof(value));
+        }
+    }
+
+    template <typename ValueType>
+    void BinaryArchiver::WriteArray(const char* name, const std::vector<ValueType>& array)
+    {
+        WriteEntryHeader(BinaryArchiverEntryType::array, name);
+        WriteByte(static_cast<uint8_t>(GetBinaryArchiverValueType<ValueType>()));
+        WriteCount(array.size());
+        if constexpr (std::is_same_v<ValueType, bool>)
+        {
+            // std::vector<bool> is bit-packed, so it has to be written one element at a time
+            for (bool value : array)
+            {
+                WriteByte(value ? 1 : 0);
+            }
+        }
+        else
+        {
+            WriteRaw(array.data(), array.size() * sizeof(ValueType));
+        }
+    }
+
+    //
+    // Deserialization
+    //
+    template <typename ValueType, IsFundamental<ValueType> concept>
+    void BinaryUnarchiver::ReadScalar(const char* name, ValueType& value)
+    {
+        MatchEntryHeader(BinaryArchiverEntryType::scalar, name);
+        MatchValueType(GetBinaryArchiverValueType<ValueType>());
+        if constexpr (std::is_same_v<ValueType, bool>)
+        {
+            value = (ReadByte() != 0);
+        }
+        else
+        {
+            ReadRaw(&value, sizeof(value));
+        }
+    }
+
+    template <typename ValueType, IsFundamental<ValueType> concept>
+    void BinaryUnarchiver::ReadArray(const char* name, std::vector<ValueType>& array)
+    {
+        MatchEntryHeader(BinaryArchiverEntryType::array, name);
+        MatchValueType(GetBinaryArchiverValueType<ValueType>());
+        auto count = ReadCount();
+        if constexpr (std::is_same_v<ValueType, bool>)
+        {
+            array.resize(count);
+            for (uint64_t index = 0; index < count; ++index)
+            {
+                array[index] = (ReadByte() != 0);
+            }
+        }
+        else
+        {
+            array.resize(count);
+            ReadRaw(array.data(), count * sizeof(ValueType));
+        }
+    }
+} // namespace utilities
+} // namespace ell
+
+#pragma endregion implementation
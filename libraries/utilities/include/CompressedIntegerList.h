@@ -44,6 +44,18 @@ namespace utilities
             /// <returns> An size_t. </returns>
             size_t Get() const { return _value; }
 
+            /// <summary> Returns the number of entries immediately following the current one whose
+            /// values consecutively follow it (each exceeding its predecessor by exactly one). </summary>
+            ///
+            /// <returns> The run length. </returns>
+            size_t NumConsecutiveFollowing() const;
+
+            /// <summary> Advances the iterator past a number of consecutive entries, which must not
+            /// exceed the value returned by NumConsecutiveFollowing(). </summary>
+            ///
+            /// <param name="count"> The number of entries to skip. </param>
+            void SkipConsecutive(size_t count);
+
         private:
             // private ctor, can only be called from CompressedIntegerList class
             Iterator(const uint8_t* iter, const uint8_t* end);
@@ -56,6 +68,49 @@ namespace utilities
             size_t _iter_increment;
         };
 
+        /// <summary> A read-only forward iterator that decodes the list a block at a time into a
+        /// stack buffer, amortizing the variable-length decoding cost over `blockSize` entries. </summary>
+        class BlockIterator
+        {
+        public:
+            /// <summary> The maximum number of entries decoded per block. </summary>
+            static constexpr size_t blockSize = 64;
+
+            BlockIterator(const BlockIterator&) = default;
+
+            BlockIterator(BlockIterator&&) = default;
+
+            /// <summary> Query if the current block is non-empty. </summary>
+            ///
+            /// <returns> true if it succeeds, false if it fails. </returns>
+            bool IsValid() const { return _count > 0; }
+
+            /// <summary> Decodes the Next block of entries. </summary>
+            void Next();
+
+            /// <summary> Returns a pointer to the entries of the current block. </summary>
+            ///
+            /// <returns> A pointer to `Size()` decoded entries. </returns>
+            const size_t* Get() const { return _block; }
+
+            /// <summary> Returns the number of entries in the current block. </summary>
+            ///
+            /// <returns> The number of entries. </returns>
+            size_t Size() const { return _count; }
+
+        private:
+            // private ctor, can only be called from CompressedIntegerList class
+            BlockIterator(const uint8_t* iter, const uint8_t* end);
+            friend class CompressedIntegerList;
+
+            // members
+            const uint8_t* _iter;
+            const uint8_t* _end;
+            size_t _value;
+            size_t _count;
+            size_t _block[blockSize];
+        };
+
         /// <summary> Default Constructor. Constructs an empty list. </summary>
         CompressedIntegerList();
 
@@ -95,6 +150,19 @@ namespace utilities
         /// <returns> The iterator. </returns>
         Iterator GetIterator() const { return Iterator(_data.data(), _data.data() + _data.size()); }
 
+        /// <summary> Returns a `BlockIterator` that points to the first block of the list. </summary>
+        ///
+        /// <returns> The block iterator. </returns>
+        BlockIterator GetBlockIterator() const { return BlockIterator(_data.data(), _data.data() + _data.size()); }
+
+        /// <summary> Counts the entries this list has in common with another list. For lists that
+        /// represent the nonzero coordinates of binary vectors, this is the popcount of their
+        /// elementwise AND, which equals their dot product. </summary>
+        ///
+        /// <param name="other"> The other list. </param>
+        /// <returns> The number of entries that appear in both lists. </returns>
+        size_t CountIntersection(const CompressedIntegerList& other) const;
+
     private:
         std::vector<uint8_t> _data;
         size_t _last;
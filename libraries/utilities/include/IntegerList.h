@@ -43,6 +43,18 @@ namespace utilities
             /// <returns> An size_t. </returns>
             size_t Get() const { return *_begin; }
 
+            /// <summary> Returns the number of entries immediately following the current one whose
+            /// values consecutively follow it (each exceeding its predecessor by exactly one). </summary>
+            ///
+            /// <returns> The run length. </returns>
+            size_t NumConsecutiveFollowing() const;
+
+            /// <summary> Advances the iterator past a number of consecutive entries, which must not
+            /// exceed the value returned by NumConsecutiveFollowing(). </summary>
+            ///
+            /// <param name="count"> The number of entries to skip. </param>
+            void SkipConsecutive(size_t count) { _begin += count; }
+
         private:
             // private ctor, can only be called from IntegerList class.
             Iterator(const vector_iterator& begin, const vector_iterator& end);
@@ -53,6 +65,45 @@ namespace utilities
             vector_iterator _end;
         };
 
+        /// <summary> A read-only forward iterator that exposes the list a block at a time. Since the
+        /// list is stored uncompressed and contiguously, the whole list is a single block. </summary>
+        class BlockIterator
+        {
+        public:
+            BlockIterator(const BlockIterator&) = default;
+
+            BlockIterator(BlockIterator&&) = default;
+
+            /// <summary> Query if the current block is non-empty. </summary>
+            ///
+            /// <returns> true if it succeeds, false if it fails. </returns>
+            bool IsValid() const { return _begin < _end; }
+
+            /// <summary> Proceeds to the Next block of entries. </summary>
+            void Next() { _begin = _end; }
+
+            /// <summary> Returns a pointer to the entries of the current block. </summary>
+            ///
+            /// <returns> A pointer to `Size()` entries. </returns>
+            const size_t* Get() const { return _begin; }
+
+            /// <summary> Returns the number of entries in the current block. </summary>
+            ///
+            /// <returns> The number of entries. </returns>
+            size_t Size() const { return static_cast<size_t>(_end - _begin); }
+
+        private:
+            // private ctor, can only be called from IntegerList class.
+            BlockIterator(const size_t* begin, const size_t* end) :
+                _begin(begin),
+                _end(end) {}
+            friend class IntegerList;
+
+            // members
+            const size_t* _begin;
+            const size_t* _end;
+        };
+
         IntegerList() = default;
 
         IntegerList(IntegerList&& other) = default;
@@ -91,6 +142,11 @@ namespace utilities
         /// <returns> The iterator. </returns>
         Iterator GetIterator() const;
 
+        /// <summary> Gets a `BlockIterator` that points to the first block of the list. </summary>
+        ///
+        /// <returns> The block iterator. </returns>
+        BlockIterator GetBlockIterator() const { return BlockIterator(_list.data(), _list.data() + _list.size()); }
+
     private:
         // The list
         std::vector<size_t> _list;
@@ -14,6 +14,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <istream>
 #include <ostream>
@@ -85,6 +86,9 @@ namespace utilities
         void FinishPreviousLine();
         void SetEndOfLine(std::string endOfLine);
 
+        // arrays of fundamental values at least this long are written as base64-encoded raw data
+        static constexpr size_t bulkArrayThreshold = 16;
+
         std::ostream& _out;
         int _indent = 0;
         std::string _endOfPreviousLine;
@@ -169,6 +173,36 @@ namespace utilities
 
         /// <summary></summary>
         static std::string DecodeTypeName(const std::string& str);
+
+        /// <summary> Encodes a block of raw data as a base64 string. </summary>
+        static std::string EncodeBase64(const uint8_t* data, size_t size);
+
+        /// <summary> Decodes a base64 string into the raw data it encodes. </summary>
+        static std::vector<uint8_t> DecodeBase64(const std::string& text);
+    };
+
+    /// <summary> A stateful base64 decoder that processes its input incrementally, for decoding
+    /// data too large to hold as a single string. </summary>
+    class Base64Decoder
+    {
+    public:
+        /// <summary> Decodes a chunk of base64 text, appending the decoded bytes to `output`. </summary>
+        ///
+        /// <param name="text"> The chunk of base64 text to decode. </param>
+        /// <param name="size"> The number of characters in the chunk. </param>
+        /// <param name="output"> The vector to append the decoded bytes to. </param>
+        void Decode(const char* text, size_t size, std::vector<uint8_t>& output);
+
+        /// <summary> Finishes decoding, removing any padding bytes from the end of the output.
+        /// Throws if the input wasn't a whole number of base64 groups. </summary>
+        ///
+        /// <param name="output"> The vector holding the decoded bytes. </param>
+        void Finish(std::vector<uint8_t>& output);
+
+    private:
+        char _group[4] = {};
+        int _groupSize = 0;
+        int _numPadding = 0;
     };
 } // namespace utilities
 } // namespace ell
@@ -223,6 +257,18 @@ namespace utilities
     template <typename ValueType>
     void JsonArchiver::WriteArray(const char* name, const std::vector<ValueType>& array)
     {
+        if constexpr (std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, bool>)
+        {
+            if (array.size() >= bulkArrayThreshold)
+            {
+                // long arrays of fundamental values are written as a single base64-encoded string
+                // of their raw little-endian data, which is much faster to write and parse than
+                // element-by-element formatting (and round-trips floating-point values exactly)
+                WriteScalar(name, "base64:" + JsonUtilities::EncodeBase64(reinterpret_cast<const uint8_t*>(array.data()), array.size() * sizeof(ValueType)));
+                return;
+            }
+        }
+
         bool hasName = name != std::string("");
         auto indent = GetCurrentIndent();
         auto endOfLine = ",\n";
@@ -276,9 +322,9 @@ namespace utilities
         // eat a comma if it exists
         if (hasName)
         {
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
     }
@@ -299,9 +345,9 @@ namespace utilities
         // eat a comma if it exists
         if (hasName)
         {
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
     }
@@ -322,9 +368,9 @@ namespace utilities
         // eat a comma if it exists
         if (hasName)
         {
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
     }
@@ -346,9 +392,9 @@ namespace utilities
         // eat a comma if it exists
         if (hasName)
         {
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
     }
@@ -362,10 +408,59 @@ namespace utilities
             MatchFieldName(name);
         }
 
+        if constexpr (std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, bool>)
+        {
+            // a string in place of an array holds the base64-encoded raw data of a long array;
+            // plain JSON arrays are still accepted, so archives in the old format load unchanged.
+            // The encoded text is streamed through the tokenizer's buffer and decoded
+            // incrementally, so the transient memory used is bounded by the decoded data, not
+            // by the (larger) encoded text
+            if (_tokenizer.PeekNextTokenView() == "\"")
+            {
+                _tokenizer.MatchToken("\"");
+
+                const std::string prefix = "base64:";
+                std::string header;
+                Base64Decoder decoder;
+                std::vector<uint8_t> bytes;
+                _tokenizer.ReadStringBody([&](const char* data, size_t size) {
+                    while (header.size() < prefix.size() && size > 0)
+                    {
+                        header.push_back(*data++);
+                        --size;
+                    }
+                    decoder.Decode(data, size, bytes);
+                });
+                _tokenizer.MatchToken("\"");
+
+                if (header != prefix)
+                {
+                    throw utilities::DataFormatException(DataFormatErrors::badFormat, "Expected a base64-encoded array");
+                }
+                decoder.Finish(bytes);
+                if (bytes.size() % sizeof(ValueType) != 0)
+                {
+                    throw utilities::DataFormatException(DataFormatErrors::badFormat, "Base64-encoded array has the wrong size");
+                }
+                array.resize(bytes.size() / sizeof(ValueType));
+                std::memcpy(array.data(), bytes.data(), bytes.size());
+
+                // eat a comma if it exists
+                if (hasName)
+                {
+                    if (_tokenizer.PeekNextTokenView() == ",")
+                    {
+                        _tokenizer.ReadNextTokenView();
+                    }
+                }
+                return;
+            }
+        }
+
         _tokenizer.MatchToken("[");
         while (true)
         {
-            auto maybeEndArray = _tokenizer.PeekNextToken();
+            auto maybeEndArray = _tokenizer.PeekNextTokenView();
             if (maybeEndArray == "]")
             {
                 break;
@@ -375,9 +470,9 @@ namespace utilities
             Unarchive(obj);
             array.push_back(obj);
 
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
         _tokenizer.MatchToken("]");
@@ -385,9 +480,9 @@ namespace utilities
         // eat a comma if it exists
         if (hasName)
         {
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
     }
@@ -403,7 +498,7 @@ namespace utilities
         _tokenizer.MatchToken("[");
         while (true)
         {
-            auto maybeEndArray = _tokenizer.PeekNextToken();
+            auto maybeEndArray = _tokenizer.PeekNextTokenView();
             if (maybeEndArray == "]")
             {
                 break;
@@ -413,9 +508,9 @@ namespace utilities
             Unarchive(obj);
             array.push_back(obj);
 
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
         _tokenizer.MatchToken("]");
@@ -423,9 +518,9 @@ namespace utilities
         // eat a comma if it exists
         if (hasName)
         {
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
     }
@@ -581,6 +581,53 @@ namespace utilities
         DimensionOrder _dimensionOrder;
     };
 
+    /// <summary> An iterator over the active entries of a `MemoryLayout`. The entries are visited in
+    /// logical order (with the last logical dimension changing fastest), and the memory offset of the
+    /// current entry is maintained incrementally from precomputed per-dimension stride tables, so
+    /// advancing the iterator doesn't do any per-element multiplications the way repeated calls to
+    /// `GetLogicalEntryOffset` do. </summary>
+    class MemoryLayoutIterator
+    {
+    public:
+        /// <summary> Constructor for an iterator over the full active area of a layout. </summary>
+        ///
+        /// <param name="layout"> The layout to iterate over. </param>
+        MemoryLayoutIterator(const MemoryLayout& layout);
+
+        /// <summary> Constructor for an iterator over part of the active area of a layout. </summary>
+        ///
+        /// <param name="layout"> The layout to iterate over. </param>
+        /// <param name="logicalShape"> The logical shape of the region to visit, which must fit inside
+        ///   the layout's active area. </param>
+        MemoryLayoutIterator(const MemoryLayout& layout, const MemoryShape& logicalShape);
+
+        /// <summary> Indicates if the iterator is pointing at an entry. </summary>
+        ///
+        /// <returns> `false` if the iterator has moved past the last entry. </returns>
+        bool IsValid() const { return _valid; }
+
+        /// <summary> Advances the iterator to the next entry. </summary>
+        void Next();
+
+        /// <summary> Gets the offset of the current entry from the beginning of memory. </summary>
+        ///
+        /// <returns> The offset to the current entry. </returns>
+        size_t GetOffset() const { return _offset; }
+
+        /// <summary> Gets the logical coordinates of the current entry. </summary>
+        ///
+        /// <returns> The logical coordinates of the current entry. </returns>
+        MemoryCoordinates GetLogicalCoordinates() const { return { _coordinates }; }
+
+    private:
+        std::vector<int> _size; // the logical size of the visited region
+        std::vector<size_t> _stride; // the distance in memory between adjacent entries, per logical dimension
+        std::vector<size_t> _rewind; // the distance back to coordinate 0: (size - 1) * stride, per logical dimension
+        std::vector<int> _coordinates;
+        size_t _offset = 0;
+        bool _valid = true;
+    };
+
     /// <summary> Helper value to denote a scalar (degree 0) memory layout </summary>
     extern MemoryLayout ScalarLayout;
 
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MemoryMappedFile.h (utilities)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> A read-only memory mapping of an entire file. Pages are faulted in by the
+    /// operating system on first access and clean pages are shared across processes, so mapping a
+    /// file is cheap regardless of its size. </summary>
+    class MemoryMappedFile
+    {
+    public:
+        /// <summary> Constructor --- maps the given file into memory. </summary>
+        ///
+        /// <param name="filename"> The file to map. </param>
+        MemoryMappedFile(const std::string& filename);
+
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        /// <summary> Gets a pointer to the mapped file contents. </summary>
+        ///
+        /// <returns> A pointer to the first byte of the file. </returns>
+        const uint8_t* GetData() const { return static_cast<const uint8_t*>(_data); }
+
+        /// <summary> Gets the size of the mapped file. </summary>
+        ///
+        /// <returns> The file size, in bytes. </returns>
+        size_t GetSize() const { return _size; }
+
+    private:
+#ifdef WIN32
+        HANDLE _file = INVALID_HANDLE_VALUE;
+        HANDLE _mapping = nullptr;
+        void* _data = nullptr;
+#else
+        void* _data = nullptr;
+#endif
+        size_t _size = 0;
+    };
+} // namespace utilities
+} // namespace ell
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "TaskPool.h"
+
 #include <future>
 #include <thread>
 #include <vector>
@@ -82,9 +84,9 @@ namespace utilities
         _currentIndex(0),
         _endIndex(-1)
     {
-        // Fill the buffer with futures that are the result of calling std::async(transformFunction) on inIter
-        int maxTasks = MaxTasks == 0 ? std::thread::hardware_concurrency() : MaxTasks;
-        if (maxTasks == 0) // if std::thread::hardware_concurrency isn't implemented, use DEFAULT_MAX_TASKS tasks (maybe this should be 1)
+        // Fill the buffer with futures for tasks submitted to the shared task pool
+        int maxTasks = MaxTasks == 0 ? static_cast<int>(TaskPool::GetDefault().NumThreads()) : MaxTasks;
+        if (maxTasks == 0)
         {
             maxTasks = DEFAULT_MAX_TASKS;
         }
@@ -97,7 +99,7 @@ namespace utilities
                 break;
             }
 
-            _futures.emplace_back(std::async(std::launch::async, _transformFunction, _inIter.Get()));
+            _futures.emplace_back(TaskPool::GetDefault().Submit(_transformFunction, _inIter.Get()));
             _inIter.Next();
         }
     }
@@ -111,10 +113,10 @@ namespace utilities
         }
         _currentOutputValid = false;
 
-        // If necessary, create new std::future to handle next input
+        // If necessary, submit a new task to handle the next input
         if (_inIter.IsValid())
         {
-            _futures[_currentIndex] = std::async(std::launch::async, _transformFunction, _inIter.Get());
+            _futures[_currentIndex] = TaskPool::GetDefault().Submit(_transformFunction, _inIter.Get());
             _inIter.Next();
         }
         else
@@ -16,6 +16,7 @@
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace ell
@@ -23,6 +24,26 @@ namespace ell
 /// <summary> model namespace </summary>
 namespace utilities
 {
+    /// <summary> An interned handle for a `PropertyBag` key. Construct one once (the key name is
+    /// resolved in a process-wide table) and reuse it on hot paths, instead of rebuilding a
+    /// `std::string` key on every query. </summary>
+    class PropertyBagKey
+    {
+    public:
+        /// <summary> Constructor. Interns the key name. </summary>
+        ///
+        /// <param name="name"> The key name. </param>
+        explicit PropertyBagKey(const std::string& name);
+
+        /// <summary> Gets the key name. </summary>
+        ///
+        /// <returns> A reference to the interned key name, valid for the lifetime of the process. </returns>
+        const std::string& GetName() const { return *_name; }
+
+    private:
+        const std::string* _name;
+    };
+
     /// <summary> PropertyBag: A metadata class consisting of a string -> Variant map </summary>
     class PropertyBag : public IArchivable
     {
@@ -36,6 +57,13 @@ namespace utilities
         template <typename ValueType>
         void SetEntry(const std::string& key, ValueType value);
 
+        /// <summary> Adds a metadata entry for the given key. </summary>
+        ///
+        /// <param name="key"> The key to use for the metadata. </param>
+        /// <param name="value"> The value to set for the given key. </param>
+        template <typename ValueType>
+        void SetEntry(const PropertyBagKey& key, ValueType value);
+
         /// <summary> Get the metadata for a given key. </summary>
         ///
         /// <param name="key"> The key for the metadata. </param>
@@ -60,6 +88,34 @@ namespace utilities
         template <typename ValueType>
         const ValueType& GetEntry(const std::string& key, const ValueType& defaultValue) const;
 
+        /// <summary> Get the metadata for a given key. </summary>
+        ///
+        /// <param name="key"> The key for the metadata. </param>
+        ///
+        /// <returns> A const reference to the value for the given key. </returns>
+        template <typename ValueType>
+        const ValueType& GetEntry(const PropertyBagKey& key) const;
+
+        /// <summary> Get the metadata for a given key with a single map lookup, checking both
+        /// presence and type. </summary>
+        ///
+        /// <param name="key"> The key for the metadata. </param>
+        ///
+        /// <returns> A pointer to the value for the given key, or `nullptr` if the key isn't
+        /// present or doesn't hold a value of the requested type. </returns>
+        template <typename ValueType>
+        const ValueType* TryGetEntry(const std::string& key) const;
+
+        /// <summary> Get the metadata for a given key with a single map lookup, checking both
+        /// presence and type. </summary>
+        ///
+        /// <param name="key"> The key for the metadata. </param>
+        ///
+        /// <returns> A pointer to the value for the given key, or `nullptr` if the key isn't
+        /// present or doesn't hold a value of the requested type. </returns>
+        template <typename ValueType>
+        const ValueType* TryGetEntry(const PropertyBagKey& key) const;
+
         /// <summary> Get the typed metadata for a given key, parsing the value if it is stored as a string. </summary>
         ///
         /// <param name="key"> The key for the metadata. </param>
@@ -98,6 +154,13 @@ namespace utilities
         /// <returns> true if there is any metadata set for the given key. </returns>
         bool HasEntry(const std::string& key) const;
 
+        /// <summary> Checks if there is a metadata entry for the given key. </summary>
+        ///
+        /// <param name="key"> The key to check for. </param>
+        ///
+        /// <returns> true if there is any metadata set for the given key. </returns>
+        bool HasEntry(const PropertyBagKey& key) const { return HasEntry(key.GetName()); }
+
         /// <summary> Checks if the property bag is empty. </summary>
         ///
         /// <returns> true if there are no entries in the property bag. </returns>
@@ -162,7 +225,7 @@ namespace utilities
     template <typename ValueType>
     void PropertyBag::SetEntry(const std::string& key, ValueType value)
     {
-        _metadata[key] = Variant(value);
+        _metadata[key] = Variant(std::move(value));
     }
 
     template <>
@@ -171,6 +234,12 @@ namespace utilities
         _metadata[key] = Variant(std::string(value));
     }
 
+    template <typename ValueType>
+    void PropertyBag::SetEntry(const PropertyBagKey& key, ValueType value)
+    {
+        SetEntry(key.GetName(), std::move(value));
+    }
+
     template <typename ValueType>
     const ValueType& PropertyBag::GetEntry(const std::string& key) const
     {
@@ -189,6 +258,29 @@ namespace utilities
         return GetEntry<ValueType>(key);
     }
 
+    template <typename ValueType>
+    const ValueType& PropertyBag::GetEntry(const PropertyBagKey& key) const
+    {
+        return GetEntry<ValueType>(key.GetName());
+    }
+
+    template <typename ValueType>
+    const ValueType* PropertyBag::TryGetEntry(const std::string& key) const
+    {
+        auto keyIter = _metadata.find(key);
+        if (keyIter == _metadata.end() || !keyIter->second.IsType<ValueType>())
+        {
+            return nullptr;
+        }
+        return &(keyIter->second.GetValue<ValueType>());
+    }
+
+    template <typename ValueType>
+    const ValueType* PropertyBag::TryGetEntry(const PropertyBagKey& key) const
+    {
+        return TryGetEntry<ValueType>(key.GetName());
+    }
+
     template <typename ValueType>
     ValueType PropertyBag::GetOrParseEntry(const std::string& key, std::function<ValueType(const std::string&)> parse) const
     {
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstring> // for size_t
 #include <vector>
 
@@ -66,6 +68,75 @@ namespace utilities
         std::vector<T> _buffer;
         size_t _currentPos = 0;
     };
+
+    /// <summary> A lock-free fixed-capacity queue for exactly one producer thread and one consumer
+    /// thread, such as handing audio samples from a capture thread to a processing thread. Unlike
+    /// `RingBuffer`, items are not overwritten: pushes fail (or are truncated) when the buffer is
+    /// full, and pops fail (or are truncated) when it is empty. No operation blocks or allocates,
+    /// so the producer side is safe to call from a real-time thread. </summary>
+    template <typename T>
+    class SpscRingBuffer
+    {
+    public:
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="capacity"> The maximum number of items the buffer can hold. </param>
+        SpscRingBuffer(size_t capacity);
+
+        /// <summary> Get the capacity of the buffer. This is fixed at construction time and does not change. </summary>
+        ///
+        /// <returns> The capacity of the buffer. </returns>
+        size_t Capacity() const;
+
+        /// <summary> Get the number of items currently in the buffer. When the other thread is
+        /// actively pushing or popping, the result is a snapshot that may be stale by the time it
+        /// is used. </summary>
+        ///
+        /// <returns> The number of items in the buffer. </returns>
+        size_t Size() const;
+
+        /// <summary> Try to add an item to the buffer. Only the producer thread may call this. </summary>
+        ///
+        /// <param name="value"> The value to add. </param>
+        ///
+        /// <returns> `true` if the item was added, `false` if the buffer was full. </returns>
+        bool TryPush(const T& value);
+
+        /// <summary> Try to add a block of items to the buffer. Only the producer thread may call this. </summary>
+        ///
+        /// <param name="values"> Pointer to the items to add. </param>
+        /// <param name="count"> The number of items to add. </param>
+        ///
+        /// <returns> The number of items actually added, which is less than `count` if the buffer filled up. </returns>
+        size_t TryPush(const T* values, size_t count);
+
+        /// <summary> Try to remove an item from the buffer. Only the consumer thread may call this. </summary>
+        ///
+        /// <param name="value"> [out] The removed value. </param>
+        ///
+        /// <returns> `true` if an item was removed, `false` if the buffer was empty. </returns>
+        bool TryPop(T& value);
+
+        /// <summary> Try to remove a block of items from the buffer. Only the consumer thread may call this. </summary>
+        ///
+        /// <param name="values"> Pointer to the destination for the removed items. </param>
+        /// <param name="count"> The maximum number of items to remove. </param>
+        ///
+        /// <returns> The number of items actually removed, which is less than `count` if the buffer ran out. </returns>
+        size_t TryPop(T* values, size_t count);
+
+    private:
+        // the assumed cache line size -- the head and tail indices get a cache line each so that
+        // the producer and consumer threads don't invalidate each other's lines on every operation
+        static constexpr size_t cacheLineSize = 64;
+
+        // one slot is left unused so that a full buffer (head one slot behind tail) can be
+        // distinguished from an empty one (head equal to tail)
+        std::vector<T> _buffer;
+
+        alignas(cacheLineSize) std::atomic<size_t> _head{ 0 }; // index of the next slot to write; only the producer modifies this
+        alignas(cacheLineSize) std::atomic<size_t> _tail{ 0 }; // index of the next slot to read; only the consumer modifies this
+    };
 } // namespace utilities
 } // namespace ell
 
@@ -130,6 +201,79 @@ namespace utilities
     {
         std::fill(_buffer.begin(), _buffer.end(), val);
     }
+
+    //
+    // SpscRingBuffer class
+    //
+    template <typename T>
+    SpscRingBuffer<T>::SpscRingBuffer(size_t capacity) :
+        _buffer(capacity + 1)
+    {
+    }
+
+    template <typename T>
+    size_t SpscRingBuffer<T>::Capacity() const
+    {
+        return _buffer.size() - 1;
+    }
+
+    template <typename T>
+    size_t SpscRingBuffer<T>::Size() const
+    {
+        auto head = _head.load(std::memory_order_acquire);
+        auto tail = _tail.load(std::memory_order_acquire);
+        return (head + _buffer.size() - tail) % _buffer.size();
+    }
+
+    template <typename T>
+    bool SpscRingBuffer<T>::TryPush(const T& value)
+    {
+        return TryPush(&value, 1) == 1;
+    }
+
+    template <typename T>
+    size_t SpscRingBuffer<T>::TryPush(const T* values, size_t count)
+    {
+        auto bufferSize = _buffer.size();
+        auto head = _head.load(std::memory_order_relaxed); // only the producer writes _head
+        auto tail = _tail.load(std::memory_order_acquire);
+        auto numFree = (tail + bufferSize - head - 1) % bufferSize;
+        auto numToCopy = std::min(count, numFree);
+
+        // copy in up to two segments, in case the free space wraps around the end of the buffer
+        auto firstSegmentSize = std::min(numToCopy, bufferSize - head);
+        std::copy(values, values + firstSegmentSize, _buffer.data() + head);
+        std::copy(values + firstSegmentSize, values + numToCopy, _buffer.data());
+
+        // the release store makes the copied items visible to the consumer's acquire load
+        _head.store((head + numToCopy) % bufferSize, std::memory_order_release);
+        return numToCopy;
+    }
+
+    template <typename T>
+    bool SpscRingBuffer<T>::TryPop(T& value)
+    {
+        return TryPop(&value, 1) == 1;
+    }
+
+    template <typename T>
+    size_t SpscRingBuffer<T>::TryPop(T* values, size_t count)
+    {
+        auto bufferSize = _buffer.size();
+        auto tail = _tail.load(std::memory_order_relaxed); // only the consumer writes _tail
+        auto head = _head.load(std::memory_order_acquire);
+        auto numAvailable = (head + bufferSize - tail) % bufferSize;
+        auto numToCopy = std::min(count, numAvailable);
+
+        // copy in up to two segments, in case the available items wrap around the end of the buffer
+        auto firstSegmentSize = std::min(numToCopy, bufferSize - tail);
+        std::copy(_buffer.data() + tail, _buffer.data() + tail + firstSegmentSize, values);
+        std::copy(_buffer.data(), _buffer.data() + (numToCopy - firstSegmentSize), values + firstSegmentSize);
+
+        // the release store lets the producer reuse the popped slots
+        _tail.store((tail + numToCopy) % bufferSize, std::memory_order_release);
+        return numToCopy;
+    }
 } // namespace utilities
 } // namespace ell
 
@@ -0,0 +1,386 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SmallVector.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> A dynamically-sized array with inline storage for a small number of elements.
+    /// As long as the vector holds at most `InlineCapacity` elements, they live inside the vector
+    /// object itself and no heap allocation takes place; beyond that, it falls back to heap storage
+    /// like `std::vector`. Useful for containers that almost always hold one or two elements but
+    /// are created in large numbers. Note that, unlike `std::vector`, growing the vector moves the
+    /// elements, so iterators and element addresses are invalidated by any growing operation. </summary>
+    template <typename ElementType, size_t InlineCapacity>
+    class SmallVector
+    {
+    public:
+        using value_type = ElementType;
+        using iterator = ElementType*;
+        using const_iterator = const ElementType*;
+
+        SmallVector();
+        SmallVector(const SmallVector& other);
+        SmallVector(SmallVector&& other);
+        SmallVector& operator=(const SmallVector& other);
+        SmallVector& operator=(SmallVector&& other);
+        ~SmallVector();
+
+        /// <summary> Gets the number of elements in the vector. </summary>
+        ///
+        /// <returns> The number of elements. </returns>
+        size_t size() const { return _size; }
+
+        /// <summary> Indicates if the vector is empty. </summary>
+        ///
+        /// <returns> `true` if the vector holds no elements. </returns>
+        bool empty() const { return _size == 0; }
+
+        /// <summary> Gets the number of elements the vector can hold without reallocating. </summary>
+        ///
+        /// <returns> The current capacity. </returns>
+        size_t capacity() const { return _capacity; }
+
+        /// <summary> Gets an iterator pointing to the first element. </summary>
+        iterator begin() { return _data; }
+
+        /// <summary> Gets a const iterator pointing to the first element. </summary>
+        const_iterator begin() const { return _data; }
+
+        /// <summary> Gets an iterator pointing just past the last element. </summary>
+        iterator end() { return _data + _size; }
+
+        /// <summary> Gets a const iterator pointing just past the last element. </summary>
+        const_iterator end() const { return _data + _size; }
+
+        /// <summary> Accesses an element in the vector. </summary>
+        ///
+        /// <param name="index"> The index of the element. </param>
+        ///
+        /// <returns> A mutable reference to the element at the given index. </returns>
+        ElementType& operator[](size_t index) { return _data[index]; }
+
+        /// <summary> Accesses an element in the vector. </summary>
+        ///
+        /// <param name="index"> The index of the element. </param>
+        ///
+        /// <returns> A const reference to the element at the given index. </returns>
+        const ElementType& operator[](size_t index) const { return _data[index]; }
+
+        /// <summary> Accesses the first element. </summary>
+        ElementType& front() { return _data[0]; }
+
+        /// <summary> Accesses the first element. </summary>
+        const ElementType& front() const { return _data[0]; }
+
+        /// <summary> Accesses the last element. </summary>
+        ElementType& back() { return _data[_size - 1]; }
+
+        /// <summary> Accesses the last element. </summary>
+        const ElementType& back() const { return _data[_size - 1]; }
+
+        /// <summary> Ensures the vector can hold the given number of elements without reallocating. </summary>
+        ///
+        /// <param name="newCapacity"> The number of elements to reserve space for. </param>
+        void reserve(size_t newCapacity);
+
+        /// <summary> Adds an element at the end of the vector. </summary>
+        ///
+        /// <param name="value"> The value to add. </param>
+        void push_back(const ElementType& value);
+
+        /// <summary> Adds an element at the end of the vector. </summary>
+        ///
+        /// <param name="value"> The value to add. </param>
+        void push_back(ElementType&& value);
+
+        /// <summary> Constructs an element in place at the end of the vector. </summary>
+        ///
+        /// <param name="args"> The arguments to pass to the element's constructor. </param>
+        ///
+        /// <returns> A reference to the new element. </returns>
+        template <typename... Args>
+        ElementType& emplace_back(Args&&... args);
+
+        /// <summary> Removes the last element. </summary>
+        void pop_back();
+
+        /// <summary> Changes the number of elements in the vector, default-constructing or
+        /// destroying elements at the end as necessary. </summary>
+        ///
+        /// <param name="newSize"> The new number of elements. </param>
+        void resize(size_t newSize);
+
+        /// <summary> Removes all the elements from the vector. </summary>
+        void clear();
+
+    private:
+        ElementType* GetInlineData() { return reinterpret_cast<ElementType*>(_inlineStorage); }
+        bool UsingInlineStorage() const { return _data == reinterpret_cast<const ElementType*>(_inlineStorage); }
+        void SetCapacity(size_t newCapacity);
+        void DestroyElements();
+
+        alignas(ElementType) char _inlineStorage[InlineCapacity * sizeof(ElementType)];
+        ElementType* _data;
+        size_t _size = 0;
+        size_t _capacity = InlineCapacity;
+    };
+
+    /// <summary> Equality operator. </summary>
+    ///
+    /// <returns> `true` if the vectors hold equal elements in the same order. </returns>
+    template <typename ElementType, size_t InlineCapacity>
+    bool operator==(const SmallVector<ElementType, InlineCapacity>& a, const SmallVector<ElementType, InlineCapacity>& b);
+
+    /// <summary> Inequality operator. </summary>
+    ///
+    /// <returns> `true` if the vectors differ in size or hold different elements. </returns>
+    template <typename ElementType, size_t InlineCapacity>
+    bool operator!=(const SmallVector<ElementType, InlineCapacity>& a, const SmallVector<ElementType, InlineCapacity>& b);
+} // namespace utilities
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace utilities
+{
+    template <typename ElementType, size_t InlineCapacity>
+    SmallVector<ElementType, InlineCapacity>::SmallVector() :
+        _data(GetInlineData())
+    {
+        static_assert(InlineCapacity > 0, "SmallVector requires a nonzero inline capacity");
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    SmallVector<ElementType, InlineCapacity>::SmallVector(const SmallVector& other) :
+        SmallVector()
+    {
+        reserve(other._size);
+        for (const auto& element : other)
+        {
+            ::new (static_cast<void*>(_data + _size)) ElementType(element);
+            ++_size;
+        }
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    SmallVector<ElementType, InlineCapacity>::SmallVector(SmallVector&& other) :
+        SmallVector()
+    {
+        if (other.UsingInlineStorage())
+        {
+            for (auto& element : other)
+            {
+                ::new (static_cast<void*>(_data + _size)) ElementType(std::move(element));
+                ++_size;
+            }
+            other.clear();
+        }
+        else
+        {
+            // steal the other vector's heap storage
+            _data = other._data;
+            _size = other._size;
+            _capacity = other._capacity;
+            other._data = other.GetInlineData();
+            other._size = 0;
+            other._capacity = InlineCapacity;
+        }
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    SmallVector<ElementType, InlineCapacity>& SmallVector<ElementType, InlineCapacity>::operator=(const SmallVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other._size);
+            for (const auto& element : other)
+            {
+                ::new (static_cast<void*>(_data + _size)) ElementType(element);
+                ++_size;
+            }
+        }
+        return *this;
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    SmallVector<ElementType, InlineCapacity>& SmallVector<ElementType, InlineCapacity>::operator=(SmallVector&& other)
+    {
+        if (this != &other)
+        {
+            DestroyElements();
+            if (!UsingInlineStorage())
+            {
+                ::operator delete(_data);
+            }
+            _data = GetInlineData();
+            _size = 0;
+            _capacity = InlineCapacity;
+
+            if (other.UsingInlineStorage())
+            {
+                for (auto& element : other)
+                {
+                    ::new (static_cast<void*>(_data + _size)) ElementType(std::move(element));
+                    ++_size;
+                }
+                other.clear();
+            }
+            else
+            {
+                _data = other._data;
+                _size = other._size;
+                _capacity = other._capacity;
+                other._data = other.GetInlineData();
+                other._size = 0;
+                other._capacity = InlineCapacity;
+            }
+        }
+        return *this;
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    SmallVector<ElementType, InlineCapacity>::~SmallVector()
+    {
+        DestroyElements();
+        if (!UsingInlineStorage())
+        {
+            ::operator delete(_data);
+        }
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    void SmallVector<ElementType, InlineCapacity>::reserve(size_t newCapacity)
+    {
+        if (newCapacity > _capacity)
+        {
+            SetCapacity(newCapacity);
+        }
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    void SmallVector<ElementType, InlineCapacity>::push_back(const ElementType& value)
+    {
+        emplace_back(value);
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    void SmallVector<ElementType, InlineCapacity>::push_back(ElementType&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    template <typename... Args>
+    ElementType& SmallVector<ElementType, InlineCapacity>::emplace_back(Args&&... args)
+    {
+        if (_size == _capacity)
+        {
+            SetCapacity(_capacity * 2);
+        }
+        auto newElement = ::new (static_cast<void*>(_data + _size)) ElementType(std::forward<Args>(args)...);
+        ++_size;
+        return *newElement;
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    void SmallVector<ElementType, InlineCapacity>::pop_back()
+    {
+        assert(_size > 0);
+        --_size;
+        _data[_size].~ElementType();
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    void SmallVector<ElementType, InlineCapacity>::resize(size_t newSize)
+    {
+        while (_size > newSize)
+        {
+            pop_back();
+        }
+        if (newSize > _size)
+        {
+            reserve(newSize);
+            while (_size < newSize)
+            {
+                ::new (static_cast<void*>(_data + _size)) ElementType();
+                ++_size;
+            }
+        }
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    void SmallVector<ElementType, InlineCapacity>::clear()
+    {
+        DestroyElements();
+        _size = 0;
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    void SmallVector<ElementType, InlineCapacity>::SetCapacity(size_t newCapacity)
+    {
+        auto newData = static_cast<ElementType*>(::operator new(newCapacity * sizeof(ElementType)));
+        for (size_t index = 0; index < _size; ++index)
+        {
+            ::new (static_cast<void*>(newData + index)) ElementType(std::move(_data[index]));
+            _data[index].~ElementType();
+        }
+        if (!UsingInlineStorage())
+        {
+            ::operator delete(_data);
+        }
+        _data = newData;
+        _capacity = newCapacity;
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    void SmallVector<ElementType, InlineCapacity>::DestroyElements()
+    {
+        for (size_t index = 0; index < _size; ++index)
+        {
+            _data[index].~ElementType();
+        }
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    bool operator==(const SmallVector<ElementType, InlineCapacity>& a, const SmallVector<ElementType, InlineCapacity>& b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (size_t index = 0; index < a.size(); ++index)
+        {
+            if (!(a[index] == b[index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename ElementType, size_t InlineCapacity>
+    bool operator!=(const SmallVector<ElementType, InlineCapacity>& a, const SmallVector<ElementType, InlineCapacity>& b)
+    {
+        return !(a == b);
+    }
+} // namespace utilities
+} // namespace ell
+
+#pragma endregion implementation
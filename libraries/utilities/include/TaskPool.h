@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     TaskPool.h (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> Options for configuring a `TaskPool`. </summary>
+    struct TaskPoolOptions
+    {
+        /// <summary> The number of worker threads, or `0` to use one thread per hardware core. </summary>
+        int numThreads = 0;
+
+        /// <summary> If `true`, pin each worker thread to a core, which avoids migration-induced
+        /// cache misses on machines where the pool's threads are the dominant workload. </summary>
+        bool pinThreadsToCores = false;
+    };
+
+    /// <summary> A work-stealing pool of worker threads for running host-side tasks. Each worker has
+    /// its own task queue; submitted tasks are distributed over the queues round-robin, and an idle
+    /// worker steals from the back of another worker's queue. Submitted functions must not block
+    /// waiting for tasks submitted later, but may themselves submit new tasks. </summary>
+    class TaskPool
+    {
+    public:
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="options"> The options to use for this pool. </param>
+        TaskPool(const TaskPoolOptions& options = {});
+
+        ~TaskPool();
+
+        TaskPool(const TaskPool&) = delete;
+        TaskPool& operator=(const TaskPool&) = delete;
+
+        /// <summary> Gets the process-wide shared pool, created on first use. </summary>
+        ///
+        /// <returns> A reference to the default pool. </returns>
+        static TaskPool& GetDefault();
+
+        /// <summary> Gets the number of worker threads in the pool. </summary>
+        ///
+        /// <returns> The number of worker threads. </returns>
+        size_t NumThreads() const { return _threads.size(); }
+
+        /// <summary> Submits a function to be run on a worker thread. </summary>
+        ///
+        /// <param name="function"> The function to run. </param>
+        /// <param name="args"> The arguments to pass to the function. </param>
+        ///
+        /// <returns> A future holding the function's result. </returns>
+        template <typename FunctionType, typename... ArgTypes>
+        auto Submit(FunctionType&& function, ArgTypes&&... args) -> std::future<std::invoke_result_t<std::decay_t<FunctionType>, std::decay_t<ArgTypes>...>>;
+
+        /// <summary> Calls a function on each index in the range [begin, end), distributing chunks of
+        /// the range over the worker threads, and blocks until all the calls have finished. </summary>
+        ///
+        /// <param name="begin"> The first index. </param>
+        /// <param name="end"> One past the last index. </param>
+        /// <param name="function"> The function to call with each index. </param>
+        template <typename FunctionType>
+        void ParallelFor(int begin, int end, FunctionType function);
+
+        /// <summary> Maps a function over each index in the range [begin, end) and reduces the mapped
+        /// values to a single result, computing partial reductions on the worker threads. The reduce
+        /// function must be associative and commutative. Blocks until the result is available. </summary>
+        ///
+        /// <param name="begin"> The first index. </param>
+        /// <param name="end"> One past the last index. </param>
+        /// <param name="initialValue"> The value to start the reduction with. </param>
+        /// <param name="mapFunction"> The function to call with each index to get the value to reduce. </param>
+        /// <param name="reduceFunction"> The function used to combine two values. </param>
+        ///
+        /// <returns> The reduction of the initial value and all the mapped values. </returns>
+        template <typename ValueType, typename MapFunctionType, typename ReduceFunctionType>
+        ValueType ParallelReduce(int begin, int end, ValueType initialValue, MapFunctionType mapFunction, ReduceFunctionType reduceFunction);
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        void WorkerLoop(int workerIndex);
+        void Enqueue(std::function<void()> task);
+        bool TryGetTask(int workerIndex, std::function<void()>& task);
+        int GetNumChunks(int numItems) const;
+
+        std::vector<std::unique_ptr<WorkerQueue>> _queues;
+        std::vector<std::thread> _threads;
+        std::atomic<size_t> _nextQueue{ 0 };
+        std::atomic<int> _numPendingTasks{ 0 };
+        std::mutex _mutex;
+        std::condition_variable _workAvailable;
+        bool _shutdown = false;
+    };
+} // namespace utilities
+} // namespace ell
+
+#pragma region implementation
+
+namespace ell
+{
+namespace utilities
+{
+    template <typename FunctionType, typename... ArgTypes>
+    auto TaskPool::Submit(FunctionType&& function, ArgTypes&&... args) -> std::future<std::invoke_result_t<std::decay_t<FunctionType>, std::decay_t<ArgTypes>...>>
+    {
+        using ResultType = std::invoke_result_t<std::decay_t<FunctionType>, std::decay_t<ArgTypes>...>;
+
+        // the packaged_task is shared because std::function requires its target to be copyable
+        auto task = std::make_shared<std::packaged_task<ResultType()>>(
+            std::bind(std::forward<FunctionType>(function), std::forward<ArgTypes>(args)...));
+        auto result = task->get_future();
+        Enqueue([task] { (*task)(); });
+        return result;
+    }
+
+    template <typename FunctionType>
+    void TaskPool::ParallelFor(int begin, int end, FunctionType function)
+    {
+        if (end <= begin)
+        {
+            return;
+        }
+
+        const int numItems = end - begin;
+        const int numChunks = GetNumChunks(numItems);
+        std::vector<std::future<void>> futures;
+        futures.reserve(numChunks);
+        for (int chunk = 0; chunk < numChunks; ++chunk)
+        {
+            const int chunkBegin = begin + (static_cast<int64_t>(numItems) * chunk) / numChunks;
+            const int chunkEnd = begin + (static_cast<int64_t>(numItems) * (chunk + 1)) / numChunks;
+            futures.push_back(Submit([function, chunkBegin, chunkEnd] {
+                for (int index = chunkBegin; index < chunkEnd; ++index)
+                {
+                    function(index);
+                }
+            }));
+        }
+
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+    }
+
+    template <typename ValueType, typename MapFunctionType, typename ReduceFunctionType>
+    ValueType TaskPool::ParallelReduce(int begin, int end, ValueType initialValue, MapFunctionType mapFunction, ReduceFunctionType reduceFunction)
+    {
+        if (end <= begin)
+        {
+            return initialValue;
+        }
+
+        const int numItems = end - begin;
+        const int numChunks = GetNumChunks(numItems);
+        std::vector<std::future<ValueType>> futures;
+        futures.reserve(numChunks);
+        for (int chunk = 0; chunk < numChunks; ++chunk)
+        {
+            const int chunkBegin = begin + (static_cast<int64_t>(numItems) * chunk) / numChunks;
+            const int chunkEnd = begin + (static_cast<int64_t>(numItems) * (chunk + 1)) / numChunks;
+            futures.push_back(Submit([mapFunction, reduceFunction, chunkBegin, chunkEnd] {
+                auto partialResult = mapFunction(chunkBegin);
+                for (int index = chunkBegin + 1; index < chunkEnd; ++index)
+                {
+                    partialResult = reduceFunction(partialResult, mapFunction(index));
+                }
+                return partialResult;
+            }));
+        }
+
+        auto result = initialValue;
+        for (auto& future : futures)
+        {
+            result = reduceFunction(result, future.get());
+        }
+        return result;
+    }
+} // namespace utilities
+} // namespace ell
+
+#pragma endregion implementation
@@ -8,10 +8,13 @@
 
 #pragma once
 
+#include <deque>
+#include <functional>
 #include <initializer_list>
 #include <istream>
 #include <stack>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace ell
@@ -33,37 +36,61 @@ namespace utilities
         /// <returns> The next token, or the empty string if the end of file is reached. </returns>
         std::string ReadNextToken();
 
-        /// <summary> Returns a token back to the input stream. </summary>
+        /// <summary> Gets the next token from the input stream as a view into the tokenizer's
+        /// buffer, without allocating. The view is only valid until the next call that reads from
+        /// the stream. </summary>
+        ///
+        /// <returns> The next token, or an empty view if the end of file is reached. </returns>
+        std::string_view ReadNextTokenView();
+
+        /// <summary> Reads the contents of the string currently being parsed in buffer-sized
+        /// chunks, calling `processChunk` with each chunk. Stops before the closing string
+        /// delimiter, which is left in the stream as the next token. Call after matching the
+        /// opening delimiter; use this instead of `ReadNextToken` for strings too large to hold
+        /// in the tokenizer's buffer. </summary>
+        ///
+        /// <param name="processChunk"> A callable invoked with each chunk of string data. </param>
+        void ReadStringBody(const std::function<void(const char*, size_t)>& processChunk);
+
+        /// <summary> Returns a token back to the input stream. Tokens that don't point into the
+        /// tokenizer's buffer are copied, so the argument doesn't need to outlive the call. </summary>
         ///
         /// <param name="token"> The token to return to the stream. </param>
-        void PutBackToken(std::string token);
+        void PutBackToken(std::string_view token);
 
         /// <summary> Matches the next token from the input stream. Returns 'false' if token doesn't match. </summary>
         ///
         /// <param name="token"> The token to match. </param>
-        bool TryMatchToken(std::string token);
+        bool TryMatchToken(std::string_view token);
 
         /// <summary> Matches the next token from the input stream. Returns 'false' if token doesn't match. </summary>
         ///
         /// <param name="token"> The token to match. </param>
         /// <param name="readToek"> The token actually read. </param>
-        bool TryMatchToken(std::string token, std::string& readToken);
+        bool TryMatchToken(std::string_view token, std::string& readToken);
 
         /// <summary> Matches the next token from the input stream. Throws an exception if token doesn't match. </summary>
         ///
         /// <param name="token"> The token to match. </param>
-        void MatchToken(std::string token);
+        void MatchToken(std::string_view token);
 
         /// <summary> Matches the next token from the input stream. Throws an exception if token doesn't match. </summary>
         ///
         /// <param name="token"> The token to match. </param>
-        void MatchTokens(const std::initializer_list<std::string>& tokens);
+        void MatchTokens(const std::initializer_list<std::string_view>& tokens);
 
         /// <summary> Gets the next token from the input stream without consuming it. </summary>
         ///
         /// <returns> The next token, or the empty string if the end of file is reached. </returns>
         std::string PeekNextToken();
 
+        /// <summary> Gets the next token from the input stream without consuming it, as a view
+        /// into the tokenizer's buffer. The view is only valid until the next call that reads from
+        /// the stream. </summary>
+        ///
+        /// <returns> The next token, or an empty view if the end of file is reached. </returns>
+        std::string_view PeekNextTokenView();
+
         /// <summary> Consumes entire stream, printing tokens as they're read. For debugging. </summary>
         ///
         /// <param name="os"> The stream to print the tokens to. </param>
@@ -78,13 +105,15 @@ namespace utilities
         int GetNextCharacter();
         void UngetCharacter();
         void ReadData();
+        bool IsInTextBuffer(std::string_view token) const;
 
         std::vector<char> _textBuffer;
         std::vector<char>::iterator _tokenStart;
         std::vector<char>::iterator _currentPosition;
         std::vector<char>::iterator _bufferEnd;
 
-        std::stack<std::string> _peekedTokens;
+        std::vector<std::string_view> _peekedTokens;
+        std::deque<std::string> _putBackTokenStorage; // owns copies of put-back tokens that don't point into the buffer
 
         char _currentStringDelimiter = '\0'; // '\0' if we're not currently parsing a string
     };
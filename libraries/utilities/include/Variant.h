@@ -16,9 +16,11 @@
 #include "TypeName.h"
 #include "Unused.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <new>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -78,13 +80,15 @@ namespace utilities
         Variant(const Variant& other);
 
         /// <summary> Move constructor. </summary>
-        Variant(Variant&& other) = default;
+        Variant(Variant&& other) noexcept;
+
+        ~Variant() override;
 
         /// <summary> Copy assignment operator. </summary>
         Variant& operator=(const Variant& other);
 
         /// <summary> Move assignment operator. </summary>
-        Variant& operator=(Variant&& other) = default;
+        Variant& operator=(Variant&& other) noexcept;
 
         /// <summary> Assignment operator from basic (non-variant) types. </summary>
         template <typename ValueType, IsNotVariant<ValueType> concept = true>
@@ -250,18 +254,29 @@ namespace utilities
         template <typename ValueType, typename... Args>
         friend Variant MakeVariant(Args&&... args);
 
-        Variant(std::type_index type, std::unique_ptr<VariantDetail::VariantBase> variantValue);
         void RegisterArchivableVariantTypes(VariantTypeRegistry& registry);
         template <typename ValueType>
         void RegisterArchivableVariantType(VariantTypeRegistry& registry);
         template <typename ValueType>
         void RegisterArchivableVariantVectorType(VariantTypeRegistry& registry);
 
-        VariantDetail::VariantBase* GetBasePointer() { return _value.get(); }
-        const VariantDetail::VariantBase* GetBasePointer() const { return _value.get(); }
+        // values whose VariantDerived wrapper fits in the inline buffer are stored there
+        // (without a heap allocation); larger values are stored on the heap
+        static constexpr size_t inlineStorageSize = 64;
+
+        template <typename DerivedType, typename... Args>
+        void ConstructValue(Args&&... args);
+        void DestroyValue();
+        void CopyValueFrom(const Variant& other); // requires that this variant holds no value
+        void MoveValueFrom(Variant&& other); // requires that this variant holds no value
+
+        VariantDetail::VariantBase* GetBasePointer() { return _value; }
+        const VariantDetail::VariantBase* GetBasePointer() const { return _value; }
 
         std::type_index _type;
-        std::unique_ptr<VariantDetail::VariantBase> _value;
+        std::aligned_storage_t<inlineStorageSize, alignof(std::max_align_t)> _storage;
+        VariantDetail::VariantBase* _value = nullptr; // points into _storage when the value is stored inline
+        bool _isInline = false;
     };
 
     /// <summary> Convenience function to create a Variant </summary>
@@ -357,6 +372,9 @@ namespace utilities
         protected:
             VariantBase(std::type_index type);
             virtual std::unique_ptr<VariantBase> Clone() const = 0;
+            virtual VariantBase* CloneInto(void* buffer) const = 0; // placement-copy into a small-value buffer
+            virtual VariantBase* MoveInto(void* buffer) = 0; // placement-move into a small-value buffer
+            virtual bool CanStoreInline(size_t bufferSize, size_t bufferAlignment) const = 0;
             virtual std::string ToString() const = 0;
             virtual std::string GetStoredTypeName() const = 0;
             virtual bool IsPrimitiveType() const = 0;
@@ -414,12 +432,21 @@ namespace utilities
             /// <param name="val"> Value to wrap in a variant </param>
             VariantDerived(const ValueType& val);
 
+            /// <summary> Move constructor </summary>
+            ///
+            /// <param name="val"> Value to move into a variant </param>
+            VariantDerived(ValueType&& val);
+
         protected:
             ValueType& GetValue() { return _value; }
             const ValueType& GetValue() const { return _value; }
             void SetValue(const ValueType& value);
+            void SetValue(ValueType&& value);
 
             std::unique_ptr<VariantBase> Clone() const override;
+            VariantBase* CloneInto(void* buffer) const override;
+            VariantBase* MoveInto(void* buffer) override;
+            bool CanStoreInline(size_t bufferSize, size_t bufferAlignment) const override;
             std::string ToString() const override;
             std::string GetStoredTypeName() const override;
             bool IsPrimitiveType() const override { return std::is_fundamental<ValueType>::value; }
@@ -733,9 +760,9 @@ namespace utilities
             auto thisPtr = dynamic_cast<VariantDetail::VariantDerived<std::decay_t<ValueType>>*>(this);
             if (thisPtr == nullptr)
             {
-                throw InputException(InputExceptionErrors::typeMismatch, std::string{ "VariantBase::SetValue called with wrong type. Type: " + TypeName<ValueType>::GetName() });
+                throw InputException(InputExceptionErrors::typeMismatch, std::string{ "VariantBase::SetValue called with wrong type. Type: " + TypeName<std::decay_t<ValueType>>::GetName() });
             }
-            thisPtr->SetValue(value);
+            thisPtr->SetValue(std::forward<ValueType>(value));
         }
 
         //
@@ -757,12 +784,26 @@ namespace utilities
         {
         }
 
+        template <typename ValueType>
+        VariantDerived<ValueType>::VariantDerived(ValueType&& val) :
+            VariantBase(typeid(ValueType)),
+            _value(std::move(val)),
+            _typeName(TypeName<ValueType>::GetName())
+        {
+        }
+
         template <typename ValueType>
         void VariantDerived<ValueType>::SetValue(const ValueType& value)
         {
             _value = value;
         }
 
+        template <typename ValueType>
+        void VariantDerived<ValueType>::SetValue(ValueType&& value)
+        {
+            _value = std::move(value);
+        }
+
         template <typename ValueType>
         std::unique_ptr<VariantBase> VariantDerived<ValueType>::Clone() const
         {
@@ -770,6 +811,24 @@ namespace utilities
             return std::unique_ptr<VariantBase>(ptr);
         }
 
+        template <typename ValueType>
+        VariantBase* VariantDerived<ValueType>::CloneInto(void* buffer) const
+        {
+            return new (buffer) VariantDerived<ValueType>(_value);
+        }
+
+        template <typename ValueType>
+        VariantBase* VariantDerived<ValueType>::MoveInto(void* buffer)
+        {
+            return new (buffer) VariantDerived<ValueType>(std::move(_value));
+        }
+
+        template <typename ValueType>
+        bool VariantDerived<ValueType>::CanStoreInline(size_t bufferSize, size_t bufferAlignment) const
+        {
+            return sizeof(VariantDerived<ValueType>) <= bufferSize && alignof(VariantDerived<ValueType>) <= bufferAlignment;
+        }
+
         template <typename ValueType>
         std::string VariantDerived<ValueType>::ToString() const
         {
@@ -872,9 +931,7 @@ namespace utilities
     Variant::Variant() :
         _type(std::type_index(typeid(ValueType)))
     {
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(Default);
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        _value = std::unique_ptr<VariantDetail::VariantBase>(basePtr);
+        ConstructValue<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(Default);
     }
 
     template <typename ValueType, IsNotVariant<ValueType> concept>
@@ -882,9 +939,7 @@ namespace utilities
         _type(std::type_index(typeid(ValueType)))
     {
         static_assert(!std::is_same<std::decay_t<ValueType>, Variant>(), "Can't make a Variant of a Variant");
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(std::forward<ValueType>(value));
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        _value = std::unique_ptr<VariantDetail::VariantBase>(basePtr);
+        ConstructValue<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(std::forward<ValueType>(value));
     }
 
     template <typename ValueType>
@@ -918,9 +973,9 @@ namespace utilities
     template <typename ValueType>
     void Variant::SetValue(ValueType&& value)
     {
-        if (!TrySetValue(value))
+        if (!TrySetValue(std::forward<ValueType>(value)))
         {
-            throw InputException(InputExceptionErrors::typeMismatch, std::string{ "Variant::SetValue called with wrong type. Type: " + TypeName<ValueType>::GetName() });
+            throw InputException(InputExceptionErrors::typeMismatch, std::string{ "Variant::SetValue called with wrong type. Type: " + TypeName<std::decay_t<ValueType>>::GetName() });
         }
     }
 
@@ -932,7 +987,7 @@ namespace utilities
             return false;
         }
 
-        _value->SetValue(value);
+        _value->SetValue(std::forward<ValueType>(value));
         return true;
     }
 
@@ -942,9 +997,7 @@ namespace utilities
         static_assert(!std::is_same<std::decay_t<ValueType>, Variant>(), "Can't make a Variant of a Variant");
 
         _type = std::type_index(typeid(ValueType));
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(std::forward<ValueType>(value));
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        _value = std::unique_ptr<VariantDetail::VariantBase>(basePtr);
+        ConstructValue<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(std::forward<ValueType>(value));
     }
 
     template <typename ValueType>
@@ -1060,14 +1113,8 @@ namespace utilities
     {
         if (IsSameTypeAs(other))
         {
-            if (other._value)
-            {
-                _value = other._value->Clone();
-            }
-            else
-            {
-                _value = nullptr;
-            }
+            DestroyValue();
+            CopyValueFrom(other);
             return true;
         }
 
@@ -1100,9 +1147,7 @@ namespace utilities
     {
         static_assert(!std::is_same<std::decay_t<ValueType>, Variant>(), "Can't make a Variant of a Variant");
         _type = std::type_index(typeid(ValueType));
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(std::forward<ValueType>(value));
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        _value = std::unique_ptr<VariantDetail::VariantBase>(basePtr);
+        ConstructValue<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(std::forward<ValueType>(value));
         return *this;
     }
 
@@ -1129,12 +1174,29 @@ namespace utilities
         });
     }
 
+    template <typename DerivedType, typename... Args>
+    void Variant::ConstructValue(Args&&... args)
+    {
+        DestroyValue();
+        if constexpr (sizeof(DerivedType) <= inlineStorageSize && alignof(DerivedType) <= alignof(std::max_align_t))
+        {
+            _value = new (&_storage) DerivedType(std::forward<Args>(args)...);
+            _isInline = true;
+        }
+        else
+        {
+            _value = new DerivedType(std::forward<Args>(args)...);
+            _isInline = false;
+        }
+    }
+
     template <typename ValueType, typename... Args>
     Variant MakeVariant(Args&&... args)
     {
-        auto derivedPtr = new VariantDetail::VariantDerived<std::decay_t<ValueType>>(std::forward<Args>(args)...);
-        auto basePtr = static_cast<VariantDetail::VariantBase*>(derivedPtr);
-        return Variant(std::type_index(typeid(ValueType)), std::unique_ptr<VariantDetail::VariantBase>(basePtr));
+        Variant variant;
+        variant._type = std::type_index(typeid(ValueType));
+        variant.ConstructValue<VariantDetail::VariantDerived<std::decay_t<ValueType>>>(std::forward<Args>(args)...);
+        return variant;
     }
 
     //
@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ArenaAllocator.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ArenaAllocator.h"
+
+namespace ell
+{
+namespace utilities
+{
+    ArenaAllocator::ArenaAllocator(size_t blockSize) :
+        _blockSize(blockSize)
+    {
+    }
+
+    void* ArenaAllocator::Allocate(size_t size, size_t alignment)
+    {
+        if (!_blocks.empty())
+        {
+            auto& block = _blocks.back();
+            void* candidate = block.storage.get() + block.used;
+            size_t space = block.size - block.used;
+            if (std::align(alignment, size, candidate, space) != nullptr)
+            {
+                block.used = static_cast<char*>(candidate) - block.storage.get() + size;
+                _bytesAllocated += size;
+                return candidate;
+            }
+        }
+
+        // the current block (if any) is full; start a new one
+        auto& block = AddBlock(size + alignment);
+        void* result = block.storage.get();
+        size_t space = block.size;
+        std::align(alignment, size, result, space); // can't fail: the block was sized to fit
+        block.used = static_cast<char*>(result) - block.storage.get() + size;
+        _bytesAllocated += size;
+        return result;
+    }
+
+    ArenaAllocator::Block& ArenaAllocator::AddBlock(size_t minSize)
+    {
+        Block block;
+        block.size = minSize > _blockSize ? minSize : _blockSize;
+        block.storage = std::make_unique<char[]>(block.size);
+        _blocks.push_back(std::move(block));
+        return _blocks.back();
+    }
+} // namespace utilities
+} // namespace ell
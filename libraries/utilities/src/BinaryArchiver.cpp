@@ -0,0 +1,446 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     BinaryArchiver.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BinaryArchiver.h"
+#include "Archiver.h"
+#include "IArchivable.h"
+#include "MemoryMappedFile.h"
+#include "Unused.h"
+
+#include <cstring>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+namespace ell
+{
+namespace utilities
+{
+    namespace
+    {
+        // The signature at the start of every binary archive: a magic string followed by a format version byte.
+        // Values and arrays are stored in little-endian byte order, which is the native order of all of ELL's targets.
+        const char binaryArchiveMagic[] = { 'E', 'L', 'L', 'B' };
+        const uint8_t binaryArchiveFormatVersion = 1;
+    } // namespace
+
+    //
+    // Serialization
+    //
+    BinaryArchiver::BinaryArchiver() :
+        _out(std::cout)
+    {
+        WriteSignature();
+    }
+
+    BinaryArchiver::BinaryArchiver(std::ostream& outputStream) :
+        _out(outputStream)
+    {
+        WriteSignature();
+    }
+
+#define ARCHIVE_TYPE_OP(t) IMPLEMENT_ARCHIVE_VALUE(BinaryArchiver, t);
+    ARCHIVABLE_TYPES_LIST
+#undef ARCHIVE_TYPE_OP
+
+    // strings
+    void BinaryArchiver::ArchiveValue(const char* name, const std::string& value)
+    {
+        WriteScalar(name, value);
+    }
+
+    void BinaryArchiver::WriteScalar(const char* name, const std::string& value)
+    {
+        WriteEntryHeader(BinaryArchiverEntryType::scalar, name);
+        WriteByte(static_cast<uint8_t>(BinaryArchiverValueType::stringValue));
+        WriteStringData(value);
+    }
+
+    void BinaryArchiver::ArchiveNull(const char* name)
+    {
+        WriteEntryHeader(BinaryArchiverEntryType::nullValue, name);
+    }
+
+    // IArchivable
+    void BinaryArchiver::BeginArchiveObject(const char* name, const IArchivable& value)
+    {
+        // objects that archive as primitives get the same representation as regular objects ---
+        // in a binary format there is nothing to save by special-casing them
+        WriteEntryHeader(BinaryArchiverEntryType::beginObject, name);
+        WriteStringData(GetArchivedTypeName(value));
+        int32_t version = static_cast<int32_t>(GetArchiveVersion(value).versionNumber);
+        WriteRaw(&version, sizeof(version));
+    }
+
+    void BinaryArchiver::EndArchiveObject(const char* name, const IArchivable& value)
+    {
+        UNUSED(name, value);
+        WriteEntryHeader(BinaryArchiverEntryType::endObject, "");
+    }
+
+    void BinaryArchiver::EndArchiving()
+    {
+        _out.flush();
+    }
+
+//
+// Arrays
+//
+#define ARCHIVE_TYPE_OP(t) IMPLEMENT_ARCHIVE_ARRAY(BinaryArchiver, t);
+    ARCHIVABLE_TYPES_LIST
+#undef ARCHIVE_TYPE_OP
+
+    void BinaryArchiver::ArchiveArray(const char* name, const std::vector<std::string>& array)
+    {
+        WriteEntryHeader(BinaryArchiverEntryType::stringArray, name);
+        WriteCount(array.size());
+        for (const auto& item : array)
+        {
+            WriteStringData(item);
+        }
+    }
+
+    void BinaryArchiver::ArchiveArray(const char* name, const std::string& baseTypeName, const std::vector<const IArchivable*>& array)
+    {
+        WriteEntryHeader(BinaryArchiverEntryType::beginObjectArray, name);
+        WriteStringData(baseTypeName);
+        for (const auto& item : array)
+        {
+            Archive(*item);
+        }
+        WriteEntryHeader(BinaryArchiverEntryType::endObjectArray, "");
+    }
+
+    //
+    // Low-level output functions
+    //
+    void BinaryArchiver::WriteSignature()
+    {
+        WriteRaw(binaryArchiveMagic, sizeof(binaryArchiveMagic));
+        WriteByte(binaryArchiveFormatVersion);
+    }
+
+    void BinaryArchiver::WriteEntryHeader(BinaryArchiverEntryType entryType, const char* name)
+    {
+        WriteByte(static_cast<uint8_t>(entryType));
+        WriteStringData(name == nullptr ? "" : name);
+    }
+
+    void BinaryArchiver::WriteByte(uint8_t value)
+    {
+        WriteRaw(&value, sizeof(value));
+    }
+
+    void BinaryArchiver::WriteCount(uint64_t value)
+    {
+        WriteRaw(&value, sizeof(value));
+    }
+
+    void BinaryArchiver::WriteStringData(const std::string& value)
+    {
+        uint32_t length = static_cast<uint32_t>(value.size());
+        WriteRaw(&length, sizeof(length));
+        WriteRaw(value.data(), value.size());
+    }
+
+    void BinaryArchiver::WriteRaw(const void* data, size_t numBytes)
+    {
+        _out.write(static_cast<const char*>(data), numBytes);
+    }
+
+    //
+    // Deserialization
+    //
+    BinaryUnarchiver::BinaryUnarchiver(SerializationContext context) :
+        Unarchiver(std::move(context)),
+        _in(std::cin)
+    {
+        ReadSignature();
+    }
+
+    BinaryUnarchiver::BinaryUnarchiver(std::istream& inputStream, SerializationContext context) :
+        Unarchiver(std::move(context)),
+        _in(inputStream)
+    {
+        ReadSignature();
+    }
+
+    BinaryUnarchiver::BinaryUnarchiver(std::shared_ptr<MemoryMappedFile> file, SerializationContext context) :
+        Unarchiver(std::move(context)),
+        _in(std::cin),
+        _mappedFile(std::move(file)),
+        _mappedData(_mappedFile->GetData()),
+        _mappedSize(_mappedFile->GetSize())
+    {
+        ReadSignature();
+    }
+
+#define ARCHIVE_TYPE_OP(t) IMPLEMENT_UNARCHIVE_VALUE(BinaryUnarchiver, t);
+    ARCHIVABLE_TYPES_LIST
+#undef ARCHIVE_TYPE_OP
+
+    // strings
+    void BinaryUnarchiver::UnarchiveValue(const char* name, std::string& value)
+    {
+        ReadScalar(name, value);
+    }
+
+    void BinaryUnarchiver::ReadScalar(const char* name, std::string& value)
+    {
+        MatchEntryHeader(BinaryArchiverEntryType::scalar, name);
+        MatchValueType(BinaryArchiverValueType::stringValue);
+        value = ReadStringData();
+    }
+
+    void BinaryUnarchiver::ReadArray(const char* name, std::vector<std::string>& array)
+    {
+        MatchEntryHeader(BinaryArchiverEntryType::stringArray, name);
+        auto count = ReadCount();
+        array.resize(count);
+        for (uint64_t index = 0; index < count; ++index)
+        {
+            array[index] = ReadStringData();
+        }
+    }
+
+    bool BinaryUnarchiver::UnarchiveNull(const char* name)
+    {
+        const auto& header = PeekEntryHeader();
+        if (header.entryType == BinaryArchiverEntryType::nullValue && header.name == name)
+        {
+            ReadEntryHeader();
+            return true;
+        }
+        return false;
+    }
+
+    // IArchivable
+    ArchivedObjectInfo BinaryUnarchiver::BeginUnarchiveObject(const char* name, const std::string& typeName)
+    {
+        UNUSED(typeName);
+        MatchEntryHeader(BinaryArchiverEntryType::beginObject, name);
+        auto encodedTypeName = ReadStringData();
+        if (encodedTypeName == "")
+        {
+            throw utilities::DataFormatException(DataFormatErrors::badFormat, "Binary archive is invalid, expecting a non empty object type name");
+        }
+        int32_t version = 0;
+        ReadRaw(&version, sizeof(version));
+        return { encodedTypeName, version };
+    }
+
+    void BinaryUnarchiver::UnarchiveObjectAsPrimitive(const char* name, IArchivable& value)
+    {
+        // objects that archive as primitives are stored just like regular objects
+        BeginUnarchiveObject(name, "");
+        UnarchiveObject(name, value);
+        EndUnarchiveObject(name, "");
+    }
+
+    bool BinaryUnarchiver::HasNextPropertyName(const std::string& name)
+    {
+        return PeekEntryHeader().name == name;
+    }
+
+    void BinaryUnarchiver::EndUnarchiveObject(const char* name, const std::string& typeName)
+    {
+        UNUSED(name, typeName);
+        MatchEntryHeader(BinaryArchiverEntryType::endObject, "");
+    }
+
+//
+// Arrays
+//
+#define ARCHIVE_TYPE_OP(t) IMPLEMENT_UNARCHIVE_ARRAY(BinaryUnarchiver, t);
+    ARCHIVABLE_TYPES_LIST
+#undef ARCHIVE_TYPE_OP
+
+    void BinaryUnarchiver::UnarchiveArray(const char* name, std::vector<std::string>& array)
+    {
+        ReadArray(name, array);
+    }
+
+    void BinaryUnarchiver::BeginUnarchiveArray(const char* name, const std::string& typeName)
+    {
+        UNUSED(typeName);
+        MatchEntryHeader(BinaryArchiverEntryType::beginObjectArray, name);
+        ReadStringData(); // the base type name of the array elements
+    }
+
+    bool BinaryUnarchiver::BeginUnarchiveArrayItem(const std::string& typeName)
+    {
+        UNUSED(typeName);
+        return PeekEntryHeader().entryType != BinaryArchiverEntryType::endObjectArray;
+    }
+
+    void BinaryUnarchiver::EndUnarchiveArrayItem(const std::string& typeName)
+    {
+        UNUSED(typeName);
+    }
+
+    void BinaryUnarchiver::EndUnarchiveArray(const char* name, const std::string& typeName)
+    {
+        UNUSED(name, typeName);
+        MatchEntryHeader(BinaryArchiverEntryType::endObjectArray, "");
+    }
+
+    //
+    // Low-level input functions
+    //
+    void BinaryUnarchiver::ReadSignature()
+    {
+        char magic[sizeof(binaryArchiveMagic)];
+        ReadRaw(magic, sizeof(magic));
+        if (std::memcmp(magic, binaryArchiveMagic, sizeof(magic)) != 0)
+        {
+            throw utilities::DataFormatException(DataFormatErrors::badFormat, "Input is not a binary archive");
+        }
+        auto formatVersion = ReadByte();
+        if (formatVersion != binaryArchiveFormatVersion)
+        {
+            throw utilities::DataFormatException(DataFormatErrors::badFormat, "Unsupported binary archive format version: " + std::to_string(formatVersion));
+        }
+    }
+
+    BinaryUnarchiver::EntryHeader BinaryUnarchiver::ReadEntryHeader()
+    {
+        if (_hasPeekedHeader)
+        {
+            _hasPeekedHeader = false;
+            return std::move(_peekedHeader);
+        }
+
+        EntryHeader header;
+        header.entryType = static_cast<BinaryArchiverEntryType>(ReadByte());
+        header.name = ReadStringData();
+        return header;
+    }
+
+    const BinaryUnarchiver::EntryHeader& BinaryUnarchiver::PeekEntryHeader()
+    {
+        if (!_hasPeekedHeader)
+        {
+            _peekedHeader = ReadEntryHeader();
+            _hasPeekedHeader = true;
+        }
+        return _peekedHeader;
+    }
+
+    BinaryUnarchiver::EntryHeader BinaryUnarchiver::MatchEntryHeader(BinaryArchiverEntryType entryType, const char* name)
+    {
+        auto header = ReadEntryHeader();
+        if (header.entryType != entryType)
+        {
+            throw utilities::DataFormatException(DataFormatErrors::badFormat, "Unexpected entry type in binary archive while reading '" + std::string(name) + "'");
+        }
+        if (header.name != name)
+        {
+            throw utilities::DataFormatException(DataFormatErrors::badFormat, "Unexpected entry name in binary archive: expected '" + std::string(name) + "', got '" + header.name + "'");
+        }
+        return header;
+    }
+
+    void BinaryUnarchiver::MatchValueType(BinaryArchiverValueType valueType)
+    {
+        auto storedValueType = static_cast<BinaryArchiverValueType>(ReadByte());
+        if (storedValueType != valueType)
+        {
+            throw utilities::DataFormatException(DataFormatErrors::badFormat, "Unexpected value type in binary archive");
+        }
+    }
+
+    uint8_t BinaryUnarchiver::ReadByte()
+    {
+        uint8_t value = 0;
+        ReadRaw(&value, sizeof(value));
+        return value;
+    }
+
+    uint64_t BinaryUnarchiver::ReadCount()
+    {
+        uint64_t value = 0;
+        ReadRaw(&value, sizeof(value));
+        return value;
+    }
+
+    std::string BinaryUnarchiver::ReadStringData()
+    {
+        uint32_t length = 0;
+        ReadRaw(&length, sizeof(length));
+        std::string value(length, '\0');
+        ReadRaw(&value[0], length);
+        return value;
+    }
+
+    void BinaryUnarchiver::ReadRaw(void* data, size_t numBytes)
+    {
+        if (_mappedData != nullptr)
+        {
+            if (numBytes > _mappedSize - _mappedOffset)
+            {
+                throw utilities::DataFormatException(DataFormatErrors::badFormat, "Unexpected end of binary archive");
+            }
+            std::memcpy(data, _mappedData + _mappedOffset, numBytes);
+            _mappedOffset += numBytes;
+            return;
+        }
+
+        _in.read(static_cast<char*>(data), numBytes);
+        if (_in.gcount() != static_cast<std::streamsize>(numBytes))
+        {
+            throw utilities::DataFormatException(DataFormatErrors::badFormat, "Unexpected end of binary archive");
+        }
+    }
+
+    //
+    // Content hashing
+    //
+    namespace
+    {
+        // a stream buffer that discards the bytes written to it, keeping only a running FNV-1a hash
+        class HashingStreamBuf : public std::streambuf
+        {
+        public:
+            uint64_t GetHash() const { return _hash; }
+
+        protected:
+            int_type overflow(int_type ch) override
+            {
+                if (ch != traits_type::eof())
+                {
+                    UpdateHash(static_cast<uint8_t>(ch));
+                }
+                return ch;
+            }
+
+            std::streamsize xsputn(const char* data, std::streamsize count) override
+            {
+                for (std::streamsize index = 0; index < count; ++index)
+                {
+                    UpdateHash(static_cast<uint8_t>(data[index]));
+                }
+                return count;
+            }
+
+        private:
+            void UpdateHash(uint8_t byte) { _hash = (_hash ^ byte) * 0x100000001b3ull; }
+
+            uint64_t _hash = 0xcbf29ce484222325ull;
+        };
+    } // namespace
+
+    uint64_t HashArchivedObject(const IArchivable& value)
+    {
+        HashingStreamBuf hashBuf;
+        std::ostream stream(&hashBuf);
+        BinaryArchiver archiver(stream);
+        archiver.Archive(value);
+        return hashBuf.GetHash();
+    }
+} // namespace utilities
+} // namespace ell
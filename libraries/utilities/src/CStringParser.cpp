@@ -39,6 +39,87 @@ namespace utilities
         return std::isdigit(c) != 0;
     }
 
+    namespace
+    {
+        // powers of ten that are exactly representable as doubles
+        const double exactPowersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+        const int maxExactPowerOfTen = 22;
+        const uint64_t maxExactMantissa = (uint64_t{ 1 } << 53);
+
+        // Branch-reduced conversion for common decimal formats: an optional sign, up to 19 digits
+        // with an optional decimal point, and an optional exponent. When the mantissa fits in 53
+        // bits and the scaling power of ten is exactly representable, a single multiply or divide
+        // is correctly rounded, so the result is bit-identical to strtod. Anything else (hex, inf,
+        // nan, very long mantissas, extreme exponents) is left to the strtod fallback.
+        bool TryParseFloatFast(const char*& pStr, double& value)
+        {
+            const char* p = pStr;
+            bool negative = (*p == '-');
+            if (*p == '-' || *p == '+')
+            {
+                ++p;
+            }
+
+            uint64_t mantissa = 0;
+            int numDigits = 0;
+            int exponent = 0;
+
+            while (IsDigit(*p))
+            {
+                mantissa = 10 * mantissa + static_cast<uint64_t>(*p - '0');
+                ++numDigits;
+                ++p;
+            }
+            if (*p == '.')
+            {
+                ++p;
+                while (IsDigit(*p))
+                {
+                    mantissa = 10 * mantissa + static_cast<uint64_t>(*p - '0');
+                    ++numDigits;
+                    --exponent;
+                    ++p;
+                }
+            }
+            if (numDigits == 0 || numDigits > 19 || mantissa > maxExactMantissa)
+            {
+                return false;
+            }
+
+            if (*p == 'e' || *p == 'E')
+            {
+                ++p;
+                bool exponentNegative = (*p == '-');
+                if (*p == '-' || *p == '+')
+                {
+                    ++p;
+                }
+                if (!IsDigit(*p))
+                {
+                    return false;
+                }
+                int explicitExponent = 0;
+                while (IsDigit(*p) && explicitExponent <= maxExactPowerOfTen)
+                {
+                    explicitExponent = 10 * explicitExponent + (*p - '0');
+                    ++p;
+                }
+                exponent += exponentNegative ? -explicitExponent : explicitExponent;
+            }
+
+            if (exponent < -maxExactPowerOfTen || exponent > maxExactPowerOfTen)
+            {
+                return false;
+            }
+
+            double result = static_cast<double>(mantissa);
+            result = exponent < 0 ? result / exactPowersOfTen[-exponent] : result * exactPowersOfTen[exponent];
+            value = negative ? -result : result;
+            pStr = p;
+            return true;
+        }
+    } // namespace
+
     template <typename ValueType, typename ParseFunctionType>
     ParseResult ParseFloat(const char* pStr, char*& pEnd, ParseFunctionType parse, ValueType& value)
     {
@@ -106,6 +187,12 @@ namespace utilities
     // wrapper for std::strtod
     inline ParseResult cParse(const char* pStr, char*& pEnd, double& value)
     {
+        const char* p = pStr;
+        if (TryParseFloatFast(p, value))
+        {
+            pEnd = const_cast<char*>(p);
+            return ParseResult::success;
+        }
         return ParseFloat(pStr, pEnd, std::strtod, value);
     }
 
@@ -181,6 +268,41 @@ namespace utilities
         return ParseInt(pStr, pEnd, std::strtoul, value);
     }
 
+    ParseResult ParseFloatSequence(const char*& pStr, std::vector<double>& values)
+    {
+        for (;;)
+        {
+            TrimLeadingWhitespace(pStr);
+            if (IsEndOfString(*pStr))
+            {
+                return ParseResult::endOfString;
+            }
+            if (*pStr == '#' || (*pStr == '/' && *(pStr + 1) == '/'))
+            {
+                return ParseResult::beginComment;
+            }
+
+            double value;
+            if (!TryParseFloatFast(pStr, value))
+            {
+                char* pEnd = nullptr;
+                if (ParseFloat(pStr, pEnd, std::strtod, value) != ParseResult::success)
+                {
+                    return ParseResult::badFormat;
+                }
+                pStr = pEnd;
+            }
+
+            // each number must end at whitespace, the end of the string, or a comment
+            if (!(IsWhitespace(*pStr) || IsEndOfString(*pStr) || *pStr == '#' || *pStr == '/'))
+            {
+                return ParseResult::badFormat;
+            }
+
+            values.push_back(value);
+        }
+    }
+
     template <typename ValueType>
     ParseResult Parse(const char*& pStr, ValueType& value)
     {
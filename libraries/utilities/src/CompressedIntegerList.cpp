@@ -44,6 +44,87 @@ namespace utilities
         _value += delta;
     }
 
+    size_t CompressedIntegerList::Iterator::NumConsecutiveFollowing() const
+    {
+        // a delta of one is always encoded as the single byte 0x01, so a run of consecutive
+        // values is a run of 0x01 bytes
+        const uint8_t* current = _iter + _iter_increment;
+        size_t count = 0;
+        while (current < _end && *current == 0x01)
+        {
+            ++count;
+            ++current;
+        }
+        return count;
+    }
+
+    void CompressedIntegerList::Iterator::SkipConsecutive(size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // each skipped entry is a single 0x01 byte
+        _iter += _iter_increment + count - 1;
+        _iter_increment = 1;
+        _value += count;
+    }
+
+    void CompressedIntegerList::BlockIterator::Next()
+    {
+        size_t count = 0;
+        size_t value = _value;
+        const uint8_t* iter = _iter;
+
+        // Fast path: while a full word remains, decode each delta with a single unaligned load
+        // and a mask instead of a per-length branch
+        while (count < blockSize && _end - iter >= 8)
+        {
+            uint64_t raw;
+            std::memcpy(&raw, iter, 8);
+            uint8_t first_val = static_cast<uint8_t>(raw);
+            size_t total_bytes = size_t{ 1 } << (first_val >> 6);
+            uint64_t rest = (raw >> 8) & ((uint64_t{ 1 } << (8 * (total_bytes - 1))) - 1);
+            value += static_cast<size_t>((rest << 6) | (first_val & 0x3f));
+            _block[count++] = value;
+            iter += total_bytes;
+        }
+
+        // Tail: decode the last few entries one byte-count at a time
+        while (count < blockSize && iter < _end)
+        {
+            uint8_t first_val = *iter;
+            size_t total_bytes = size_t{ 1 } << (first_val >> 6);
+            size_t delta = 0;
+            if (total_bytes == 1)
+            {
+                delta = first_val;
+            }
+            else
+            {
+                std::memcpy(&delta, iter + 1, total_bytes - 1);
+                delta = (delta << 6) | (first_val & 0x3f);
+            }
+            value += delta;
+            _block[count++] = value;
+            iter += total_bytes;
+        }
+
+        _iter = iter;
+        _value = value;
+        _count = count;
+    }
+
+    CompressedIntegerList::BlockIterator::BlockIterator(const uint8_t* iter, const uint8_t* end) :
+        _iter(iter),
+        _end(end),
+        _value(0),
+        _count(0)
+    {
+        Next();
+    }
+
     CompressedIntegerList::Iterator::Iterator(const uint8_t* iter, const uint8_t* end) :
         _iter(iter),
         _end(end),
@@ -135,6 +216,51 @@ namespace utilities
         ++_size;
     }
 
+    size_t CompressedIntegerList::CountIntersection(const CompressedIntegerList& other) const
+    {
+        size_t count = 0;
+        auto thisIterator = GetBlockIterator();
+        auto otherIterator = other.GetBlockIterator();
+        size_t i = 0;
+        size_t j = 0;
+        while (thisIterator.IsValid() && otherIterator.IsValid())
+        {
+            const size_t* thisBlock = thisIterator.Get();
+            const size_t* otherBlock = otherIterator.Get();
+            size_t thisCount = thisIterator.Size();
+            size_t otherCount = otherIterator.Size();
+            while (i < thisCount && j < otherCount)
+            {
+                if (thisBlock[i] < otherBlock[j])
+                {
+                    ++i;
+                }
+                else if (otherBlock[j] < thisBlock[i])
+                {
+                    ++j;
+                }
+                else
+                {
+                    ++count;
+                    ++i;
+                    ++j;
+                }
+            }
+
+            if (i == thisCount)
+            {
+                thisIterator.Next();
+                i = 0;
+            }
+            if (j == otherCount)
+            {
+                otherIterator.Next();
+                j = 0;
+            }
+        }
+        return count;
+    }
+
     void CompressedIntegerList::Reset()
     {
         _data.resize(0);
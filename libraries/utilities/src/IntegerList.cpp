@@ -21,6 +21,18 @@ namespace utilities
     {
     }
 
+    size_t IntegerList::Iterator::NumConsecutiveFollowing() const
+    {
+        auto current = _begin;
+        size_t count = 0;
+        while (current + 1 < _end && *(current + 1) == *current + 1)
+        {
+            ++count;
+            ++current;
+        }
+        return count;
+    }
+
     void IntegerList::Reserve(size_t size)
     {
         _list.reserve(size);
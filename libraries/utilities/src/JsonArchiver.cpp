@@ -12,6 +12,7 @@
 #include "TypeTraits.h"
 #include "Unused.h"
 
+#include <array>
 #include <cctype>
 #include <cstdlib>
 #include <iomanip>
@@ -249,9 +250,9 @@ namespace utilities
         _tokenizer.MatchToken("\"");
 
         int version = 0;
-        if (_tokenizer.PeekNextToken() == ",")
+        if (_tokenizer.PeekNextTokenView() == ",")
         {
-            _tokenizer.ReadNextToken(); // eat the comma
+            _tokenizer.ReadNextTokenView(); // eat the comma
 
             MatchFieldName("_version");
             _tokenizer.MatchToken("\"");
@@ -259,9 +260,9 @@ namespace utilities
             // parse it
             version = std::stoi(versionString);
             _tokenizer.MatchToken("\"");
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken(); // eat the comma
+                _tokenizer.ReadNextTokenView(); // eat the comma
             }
         }
         return { encodedTypeName, version };
@@ -280,9 +281,9 @@ namespace utilities
         // eat a comma if it exists
         if (hasName)
         {
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
     }
@@ -334,9 +335,9 @@ namespace utilities
         // eat a comma if it exists
         if (hasName)
         {
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
     }
@@ -368,7 +369,7 @@ namespace utilities
     bool JsonUnarchiver::BeginUnarchiveArrayItem(const std::string& typeName)
     {
         UNUSED(typeName);
-        auto maybeEndArray = _tokenizer.PeekNextToken();
+        auto maybeEndArray = _tokenizer.PeekNextTokenView();
         if (maybeEndArray == "]")
         {
             return false;
@@ -382,9 +383,9 @@ namespace utilities
     void JsonUnarchiver::EndUnarchiveArrayItem(const std::string& typeName)
     {
         UNUSED(typeName);
-        if (_tokenizer.PeekNextToken() == ",")
+        if (_tokenizer.PeekNextTokenView() == ",")
         {
-            _tokenizer.ReadNextToken();
+            _tokenizer.ReadNextTokenView();
         }
     }
 
@@ -396,9 +397,9 @@ namespace utilities
         // eat a comma if it exists
         if (hasName)
         {
-            if (_tokenizer.PeekNextToken() == ",")
+            if (_tokenizer.PeekNextTokenView() == ",")
             {
-                _tokenizer.ReadNextToken();
+                _tokenizer.ReadNextTokenView();
             }
         }
     }
@@ -411,13 +412,13 @@ namespace utilities
             return false;
         }
 
-        auto s = _tokenizer.PeekNextToken();
+        auto s = _tokenizer.PeekNextTokenView();
         if (s != key)
         {
             found = s;
             return false;
         }
-        _tokenizer.ReadNextToken();
+        _tokenizer.ReadNextTokenView();
 
         _tokenizer.MatchTokens({ "\"", ":" });
         return true;
@@ -529,5 +530,121 @@ namespace utilities
     {
         return str;
     }
+
+    namespace
+    {
+        // the url-safe variant of the base64 alphabet: '+' and '/' would get escaped by EncodeString
+        const char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    }
+
+    std::string JsonUtilities::EncodeBase64(const uint8_t* data, size_t size)
+    {
+        std::string result;
+        result.reserve(4 * ((size + 2) / 3));
+
+        size_t index = 0;
+        for (; index + 3 <= size; index += 3)
+        {
+            uint32_t group = (static_cast<uint32_t>(data[index]) << 16) | (static_cast<uint32_t>(data[index + 1]) << 8) | data[index + 2];
+            result.push_back(base64Alphabet[(group >> 18) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 12) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 6) & 0x3f]);
+            result.push_back(base64Alphabet[group & 0x3f]);
+        }
+
+        auto remainder = size - index;
+        if (remainder == 1)
+        {
+            uint32_t group = static_cast<uint32_t>(data[index]) << 16;
+            result.push_back(base64Alphabet[(group >> 18) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 12) & 0x3f]);
+            result.push_back('=');
+            result.push_back('=');
+        }
+        else if (remainder == 2)
+        {
+            uint32_t group = (static_cast<uint32_t>(data[index]) << 16) | (static_cast<uint32_t>(data[index + 1]) << 8);
+            result.push_back(base64Alphabet[(group >> 18) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 12) & 0x3f]);
+            result.push_back(base64Alphabet[(group >> 6) & 0x3f]);
+            result.push_back('=');
+        }
+        return result;
+    }
+
+    std::vector<uint8_t> JsonUtilities::DecodeBase64(const std::string& text)
+    {
+        Base64Decoder decoder;
+        std::vector<uint8_t> result;
+        result.reserve(3 * (text.size() / 4));
+        decoder.Decode(text.data(), text.size(), result);
+        decoder.Finish(result);
+        return result;
+    }
+
+    void Base64Decoder::Decode(const char* text, size_t size, std::vector<uint8_t>& output)
+    {
+        static const auto decodeTable = [] {
+            std::array<int8_t, 256> table;
+            table.fill(-1);
+            for (int value = 0; value < 64; ++value)
+            {
+                table[static_cast<uint8_t>(base64Alphabet[value])] = static_cast<int8_t>(value);
+            }
+            return table;
+        }();
+
+        for (size_t index = 0; index < size; ++index)
+        {
+            _group[_groupSize++] = text[index];
+            if (_groupSize < 4)
+            {
+                continue;
+            }
+            _groupSize = 0;
+
+            if (_numPadding > 0)
+            {
+                throw utilities::DataFormatException(DataFormatErrors::badFormat, "Base64 padding can only appear at the end of the data");
+            }
+
+            uint32_t group = 0;
+            for (auto ch : _group)
+            {
+                if (ch == '=')
+                {
+                    ++_numPadding;
+                    group <<= 6;
+                    continue;
+                }
+                if (_numPadding > 0) // a non-padding character after padding within the group
+                {
+                    throw utilities::DataFormatException(DataFormatErrors::badFormat, "Base64 padding can only appear at the end of the data");
+                }
+                auto value = decodeTable[static_cast<uint8_t>(ch)];
+                if (value < 0)
+                {
+                    throw utilities::DataFormatException(DataFormatErrors::badFormat, "Invalid character in base64 data");
+                }
+                group = (group << 6) | static_cast<uint32_t>(value);
+            }
+            output.push_back(static_cast<uint8_t>((group >> 16) & 0xff));
+            output.push_back(static_cast<uint8_t>((group >> 8) & 0xff));
+            output.push_back(static_cast<uint8_t>(group & 0xff));
+        }
+    }
+
+    void Base64Decoder::Finish(std::vector<uint8_t>& output)
+    {
+        if (_groupSize != 0)
+        {
+            throw utilities::DataFormatException(DataFormatErrors::badFormat, "Base64 data has the wrong length");
+        }
+        if (_numPadding > 2)
+        {
+            throw utilities::DataFormatException(DataFormatErrors::badFormat, "Base64 data has too much padding");
+        }
+        output.resize(output.size() - _numPadding);
+    }
 } // namespace utilities
 } // namespace ell
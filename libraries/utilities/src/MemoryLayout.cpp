@@ -344,9 +344,8 @@ namespace utilities
 
     size_t MemoryLayout::GetFirstEntryOffset() const
     {
-        const auto numDimensions = NumDimensions();
-        MemoryCoordinates firstEntry(std::vector<int>(numDimensions, 0));
-        return GetEntryOffset(firstEntry);
+        // the entry at physical coordinates {0,0,0...} is just the data offset
+        return GetDataOffset();
     }
 
     MemoryCoordinates MemoryLayout::GetPhysicalCoordinatesFromOffset(size_t index) const
@@ -387,7 +386,8 @@ namespace utilities
 
     size_t MemoryLayout::GetLogicalDimensionIncrement(size_t index) const
     {
-        return ReversePermute(_increment, _dimensionOrder)[index];
+        // look up the one increment directly instead of building the full permuted shape
+        return _increment[GetPhysicalDimension(static_cast<int>(index))];
     }
 
     size_t MemoryLayout::GetLogicalEntryOffset(const MemoryCoordinates& logicalCoordinates) const
@@ -611,6 +611,54 @@ namespace utilities
         return ss.str();
     }
 
+    //
+    // MemoryLayoutIterator
+    //
+    MemoryLayoutIterator::MemoryLayoutIterator(const MemoryLayout& layout) :
+        MemoryLayoutIterator(layout, layout.GetLogicalDimensionActiveSize())
+    {}
+
+    MemoryLayoutIterator::MemoryLayoutIterator(const MemoryLayout& layout, const MemoryShape& logicalShape) :
+        _offset(layout.GetFirstEntryOffset())
+    {
+        const int numDimensions = layout.NumDimensions();
+        if (logicalShape.NumDimensions() != numDimensions)
+        {
+            throw InputException(InputExceptionErrors::invalidArgument, "Must have the same number of dimensions.");
+        }
+
+        _size.resize(numDimensions);
+        _stride.resize(numDimensions);
+        _rewind.resize(numDimensions);
+        _coordinates.resize(numDimensions, 0);
+        for (int dimension = 0; dimension < numDimensions; ++dimension)
+        {
+            _size[dimension] = logicalShape[dimension];
+            _stride[dimension] = layout.GetLogicalDimensionIncrement(dimension);
+            _rewind[dimension] = _size[dimension] > 0 ? (_size[dimension] - 1) * _stride[dimension] : 0;
+            if (_size[dimension] <= 0)
+            {
+                _valid = false; // an empty region has no entries to visit
+            }
+        }
+    }
+
+    void MemoryLayoutIterator::Next()
+    {
+        // increment the fastest-changing logical dimension, carrying into slower ones as they fill up
+        for (int dimension = static_cast<int>(_size.size()) - 1; dimension >= 0; --dimension)
+        {
+            if (++_coordinates[dimension] < _size[dimension])
+            {
+                _offset += _stride[dimension];
+                return;
+            }
+            _coordinates[dimension] = 0;
+            _offset -= _rewind[dimension];
+        }
+        _valid = false;
+    }
+
     bool Equal(const DimensionVector& shape1, const DimensionVector& shape2)
     {
         auto size = shape1.NumDimensions();
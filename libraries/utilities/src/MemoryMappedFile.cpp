@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MemoryMappedFile.cpp (utilities)
+//  Authors:  Ofer Dekel
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MemoryMappedFile.h"
+#include "Exception.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ell
+{
+namespace utilities
+{
+    MemoryMappedFile::MemoryMappedFile(const std::string& filename)
+    {
+#ifdef WIN32
+        _file = ::CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error opening file " + filename);
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(_file, &fileSize))
+        {
+            ::CloseHandle(_file);
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error mapping file " + filename);
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+
+        if (_size > 0)
+        {
+            _mapping = ::CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            _data = _mapping != nullptr ? ::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (_data == nullptr)
+            {
+                if (_mapping != nullptr)
+                {
+                    ::CloseHandle(_mapping);
+                }
+                ::CloseHandle(_file);
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error mapping file " + filename);
+            }
+        }
+#else
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error opening file " + filename);
+        }
+
+        struct stat fileInfo;
+        if (::fstat(fd, &fileInfo) != 0)
+        {
+            ::close(fd);
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error mapping file " + filename);
+        }
+        _size = static_cast<size_t>(fileInfo.st_size);
+
+        if (_size > 0)
+        {
+            _data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (_data == MAP_FAILED)
+            {
+                ::close(fd);
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error mapping file " + filename);
+            }
+
+            // the first pass over a mapped file is typically sequential
+            ::madvise(_data, _size, MADV_SEQUENTIAL);
+        }
+        ::close(fd);
+#endif
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+#ifdef WIN32
+        if (_data != nullptr)
+        {
+            ::UnmapViewOfFile(_data);
+            ::CloseHandle(_mapping);
+        }
+        ::CloseHandle(_file);
+#else
+        if (_data != nullptr && _data != MAP_FAILED)
+        {
+            ::munmap(_data, _size);
+        }
+#endif
+    }
+} // namespace utilities
+} // namespace ell
@@ -10,10 +10,33 @@
 #include "Exception.h"
 #include "TypeTraits.h"
 
+#include <mutex>
+#include <unordered_set>
+
 namespace ell
 {
 namespace utilities
 {
+    namespace
+    {
+        // Interns a key name in a process-wide table, returning a stable reference to it
+        const std::string& InternKeyName(const std::string& name)
+        {
+            static std::mutex mutex;
+            static std::unordered_set<std::string> keyNames;
+            std::lock_guard<std::mutex> lock(mutex);
+            return *(keyNames.insert(name).first);
+        }
+    } // namespace
+
+    //
+    // PropertyBagKey
+    //
+    PropertyBagKey::PropertyBagKey(const std::string& name) :
+        _name(&InternKeyName(name))
+    {
+    }
+
     //
     // KeyValue
     //
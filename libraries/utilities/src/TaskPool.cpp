@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     TaskPool.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "TaskPool.h"
+
+#include <algorithm>
+
+#if defined(WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace ell
+{
+namespace utilities
+{
+    namespace
+    {
+        // the number of worker threads to use when std::thread::hardware_concurrency isn't implemented
+        constexpr int defaultNumThreads = 8;
+
+        void PinThreadToCore(std::thread& thread, int coreIndex)
+        {
+#if defined(WIN32)
+            SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1) << coreIndex);
+#elif defined(__linux__)
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(coreIndex % CPU_SETSIZE, &cpuSet);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet);
+#else
+            // thread affinity isn't supported on this platform
+            (void)thread;
+            (void)coreIndex;
+#endif
+        }
+    } // namespace
+
+    TaskPool::TaskPool(const TaskPoolOptions& options)
+    {
+        int numThreads = options.numThreads;
+        if (numThreads <= 0)
+        {
+            numThreads = static_cast<int>(std::thread::hardware_concurrency());
+        }
+        if (numThreads <= 0)
+        {
+            numThreads = defaultNumThreads;
+        }
+
+        _queues.reserve(numThreads);
+        for (int index = 0; index < numThreads; ++index)
+        {
+            _queues.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        _threads.reserve(numThreads);
+        for (int index = 0; index < numThreads; ++index)
+        {
+            _threads.emplace_back([this, index] { WorkerLoop(index); });
+            if (options.pinThreadsToCores)
+            {
+                PinThreadToCore(_threads.back(), index);
+            }
+        }
+    }
+
+    TaskPool::~TaskPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _shutdown = true;
+        }
+        _workAvailable.notify_all();
+        for (auto& thread : _threads)
+        {
+            thread.join();
+        }
+    }
+
+    TaskPool& TaskPool::GetDefault()
+    {
+        static TaskPool pool;
+        return pool;
+    }
+
+    void TaskPool::WorkerLoop(int workerIndex)
+    {
+        std::function<void()> task;
+        while (true)
+        {
+            if (TryGetTask(workerIndex, task))
+            {
+                task();
+                task = nullptr;
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            _workAvailable.wait(lock, [this] { return _shutdown || _numPendingTasks.load() > 0; });
+            if (_shutdown && _numPendingTasks.load() == 0) // drain any remaining tasks before exiting
+            {
+                return;
+            }
+        }
+    }
+
+    void TaskPool::Enqueue(std::function<void()> task)
+    {
+        auto& queue = *_queues[_nextQueue++ % _queues.size()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        ++_numPendingTasks;
+        {
+            // taking the lock before notifying prevents a waiter that just found no work
+            // from missing the wakeup
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+        _workAvailable.notify_one();
+    }
+
+    bool TaskPool::TryGetTask(int workerIndex, std::function<void()>& task)
+    {
+        // check our own queue first, then try to steal from the back of the other workers' queues
+        const auto numQueues = _queues.size();
+        for (size_t attempt = 0; attempt < numQueues; ++attempt)
+        {
+            auto& queue = *_queues[(workerIndex + attempt) % numQueues];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty())
+            {
+                if (attempt == 0)
+                {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+                else
+                {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                --_numPendingTasks;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int TaskPool::GetNumChunks(int numItems) const
+    {
+        // a few chunks per worker lets the stealing even out chunks that take different amounts of time
+        return std::min(numItems, static_cast<int>(NumThreads()) * 4);
+    }
+} // namespace utilities
+} // namespace ell
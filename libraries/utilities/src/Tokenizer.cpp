@@ -10,6 +10,7 @@
 #include "Exception.h"
 #include "Files.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <istream>
@@ -37,30 +38,39 @@ namespace utilities
     }
 
     std::string Tokenizer::ReadNextToken()
+    {
+        return std::string(ReadNextTokenView());
+    }
+
+    std::string_view Tokenizer::ReadNextTokenView()
     {
         if (!_peekedTokens.empty())
         {
-            auto temp = _peekedTokens.top();
-            _peekedTokens.pop();
-            return temp;
+            auto token = _peekedTokens.back();
+            _peekedTokens.pop_back();
+            return token;
         }
 
+        // No put-back tokens are outstanding anymore, so any copies made for them can be
+        // discarded (any views previously handed out have expired by now)
+        _putBackTokenStorage.clear();
+
         const char escapeChar = '\\';
-        std::string token;
+        ptrdiff_t tokenStartOffset = 0; // offset of the token's first character, relative to _tokenStart
 
-        // eat whitespace and add first char
+        // eat whitespace and find the first char
         while (IsValid())
         {
             auto result = GetNextCharacter();
             if (result == EOF)
             {
                 _tokenStart = _currentPosition;
-                return token;
+                return {};
             }
             auto ch = static_cast<char>(result);
             if (!std::isspace(ch))
             {
-                token.push_back(ch);
+                tokenStartOffset = (_currentPosition - 1) - _tokenStart;
                 auto isParsingString = _currentStringDelimiter != '\0';
                 auto isStringDelimiter = _stringDelimiters.find(ch) != std::string::npos;
                 if (isParsingString) // we're in the middle of parsing a string: probably because we just read in a quotation mark last time
@@ -69,6 +79,7 @@ namespace utilities
                     {
                         assert(_currentStringDelimiter == ch);
                         _currentStringDelimiter = '\0';
+                        std::string_view token(&*(_currentPosition - 1), 1);
                         _tokenStart = _currentPosition;
                         return token; // return the end-delimiter
                     }
@@ -88,13 +99,14 @@ namespace utilities
                     }
                     else
                     {
+                        std::string_view token(&*(_currentPosition - 1), 1);
                         _tokenStart = _currentPosition;
                         return token; // we did hit a token-stop char. Return it.
                     }
                 }
             }
         }
-        // At this point, the first char of a token will be in the token string
+        // At this point, the first char of a token is in the buffer at _tokenStart + tokenStartOffset
 
         // If we're in read-string mode, read until we get an unescaped string delimiter that matches the current string delimiter
         bool prevEscaped = false;
@@ -125,29 +137,88 @@ namespace utilities
                 break;
             }
 
-            token.push_back(ch);
             prevEscaped = !prevEscaped && ch == escapeChar;
         }
 
+        auto tokenBegin = _tokenStart + tokenStartOffset;
+        auto tokenLength = static_cast<size_t>(_currentPosition - tokenBegin);
+        std::string_view token = tokenLength == 0 ? std::string_view{} : std::string_view(&*tokenBegin, tokenLength);
         _tokenStart = _currentPosition;
         return token;
     }
 
+    void Tokenizer::ReadStringBody(const std::function<void(const char*, size_t)>& processChunk)
+    {
+        assert(_currentStringDelimiter != '\0');
+        assert(_peekedTokens.empty());
+
+        const char escapeChar = '\\';
+        bool prevEscaped = false;
+        while (true)
+        {
+            if (_currentPosition == _bufferEnd)
+            {
+                // nothing before the current position needs preserving across the refill
+                _tokenStart = _currentPosition;
+                ReadData();
+                if (_currentPosition == _bufferEnd) // end of input
+                {
+                    break;
+                }
+            }
+
+            // scan the buffered characters for the closing delimiter
+            auto chunkStart = _currentPosition;
+            bool hitDelimiter = false;
+            while (_currentPosition != _bufferEnd)
+            {
+                auto ch = *_currentPosition;
+                if (!prevEscaped && ch == _currentStringDelimiter)
+                {
+                    hitDelimiter = true;
+                    break;
+                }
+                prevEscaped = !prevEscaped && ch == escapeChar;
+                ++_currentPosition;
+            }
+
+            if (_currentPosition != chunkStart)
+            {
+                processChunk(&*chunkStart, static_cast<size_t>(_currentPosition - chunkStart));
+            }
+            if (hitDelimiter)
+            {
+                break;
+            }
+        }
+        _tokenStart = _currentPosition;
+    }
+
     std::string Tokenizer::PeekNextToken()
+    {
+        return std::string(PeekNextTokenView());
+    }
+
+    std::string_view Tokenizer::PeekNextTokenView()
     {
         if (!_peekedTokens.empty())
         {
-            return _peekedTokens.top();
+            return _peekedTokens.back();
         }
 
-        auto token = ReadNextToken();
-        PutBackToken(token);
-        return token;
+        PutBackToken(ReadNextTokenView());
+        return _peekedTokens.back();
     }
 
-    void Tokenizer::PutBackToken(std::string token)
+    void Tokenizer::PutBackToken(std::string_view token)
     {
-        _peekedTokens.push(token);
+        if (!IsInTextBuffer(token))
+        {
+            // copy tokens that don't point into our buffer so they stay valid until they're re-read
+            _putBackTokenStorage.push_back(std::string(token));
+            token = _putBackTokenStorage.back();
+        }
+        _peekedTokens.push_back(token);
     }
 
     void Tokenizer::PrintTokens(std::ostream& os)
@@ -161,38 +232,37 @@ namespace utilities
         }
     }
 
-    bool Tokenizer::TryMatchToken(std::string token)
+    bool Tokenizer::TryMatchToken(std::string_view token)
     {
-        auto nextToken = PeekNextToken();
-        if (nextToken != token)
+        if (PeekNextTokenView() != token)
         {
             return false;
         }
-        ReadNextToken();
+        ReadNextTokenView();
         return true;
     }
 
-    bool Tokenizer::TryMatchToken(std::string token, std::string& readToken)
+    bool Tokenizer::TryMatchToken(std::string_view token, std::string& readToken)
     {
-        readToken = PeekNextToken();
+        readToken = PeekNextTokenView();
         if (readToken != token)
         {
             return false;
         }
-        ReadNextToken();
+        ReadNextTokenView();
         return true;
     }
 
-    void Tokenizer::MatchToken(std::string token)
+    void Tokenizer::MatchToken(std::string_view token)
     {
         std::string readToken;
         if (!TryMatchToken(token, readToken))
         {
-            throw InputException(InputExceptionErrors::badStringFormat, std::string{ "Failed to match token " } + token + ", got: " + readToken);
+            throw InputException(InputExceptionErrors::badStringFormat, std::string{ "Failed to match token " } + std::string(token) + ", got: " + readToken);
         }
     }
 
-    void Tokenizer::MatchTokens(const std::initializer_list<std::string>& tokens)
+    void Tokenizer::MatchTokens(const std::initializer_list<std::string_view>& tokens)
     {
         for (const auto& token : tokens)
         {
@@ -205,6 +275,12 @@ namespace utilities
         return static_cast<bool>(_in) || !_textBuffer.empty() || !_peekedTokens.empty();
     }
 
+    bool Tokenizer::IsInTextBuffer(std::string_view token) const
+    {
+        const char* data = token.data();
+        return data >= _textBuffer.data() && data < _textBuffer.data() + _textBuffer.size();
+    }
+
     int Tokenizer::GetNextCharacter()
     {
         if (_currentPosition == _bufferEnd)
@@ -231,28 +307,49 @@ namespace utilities
     void Tokenizer::ReadData()
     {
         // Allocate textBuffer if it's empty
-        auto oldLength = _bufferEnd - _tokenStart;
-        auto oldOffset = _currentPosition - _tokenStart;
         if (_textBuffer.empty())
         {
             _textBuffer.resize(BUFFER_SIZE, '\0');
-            _bufferEnd = _textBuffer.end();
+            _tokenStart = _textBuffer.begin();
+            _currentPosition = _textBuffer.begin();
+            _bufferEnd = _textBuffer.begin();
         }
-        else
+
+        // The preserved region starts at the earliest outstanding put-back token that points into
+        // the buffer, or at the start of the current token if there is none
+        auto keepStart = _tokenStart;
+        for (const auto& token : _peekedTokens)
         {
-            // move data from currentPosition to end to the beginning of the buffer
-            std::copy(_tokenStart, _bufferEnd, _textBuffer.begin());
+            if (IsInTextBuffer(token))
+            {
+                auto tokenBegin = _textBuffer.begin() + (token.data() - _textBuffer.data());
+                keepStart = std::min(keepStart, tokenBegin);
+            }
         }
 
-        auto newPtr = _textBuffer.data() + oldLength;
-        auto maxLength = _textBuffer.size() - oldLength;
+        auto keepLength = _bufferEnd - keepStart;
+        auto shift = keepStart - _textBuffer.begin();
+        if (shift > 0)
+        {
+            // move the preserved region to the beginning of the buffer, rebasing anything that points into it
+            std::copy(keepStart, _bufferEnd, _textBuffer.begin());
+            _tokenStart -= shift;
+            _currentPosition -= shift;
+            for (auto& token : _peekedTokens)
+            {
+                if (IsInTextBuffer(token))
+                {
+                    token = std::string_view(token.data() - shift, token.size());
+                }
+            }
+        }
 
         // read into buffer
+        auto newPtr = _textBuffer.data() + keepLength;
+        auto maxLength = _textBuffer.size() - keepLength;
         _in.read(newPtr, maxLength);
         auto amountRead = _in.gcount();
-        _bufferEnd = _textBuffer.begin() + oldLength + amountRead;
-        _tokenStart = _textBuffer.begin();
-        _currentPosition = _tokenStart + oldOffset;
+        _bufferEnd = _textBuffer.begin() + keepLength + amountRead;
     }
 } // namespace utilities
 } // namespace ell
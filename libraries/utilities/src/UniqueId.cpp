@@ -12,12 +12,11 @@ namespace ell
 {
 namespace utilities
 {
-    size_t UniqueId::_nextId = 1000;
+    std::atomic<size_t> UniqueId::_nextId{ 1000 };
 
     UniqueId::UniqueId()
     {
-        _id = std::to_string(_nextId);
-        ++_nextId;
+        _id = std::to_string(_nextId.fetch_add(1));
     }
 
     UniqueId::UniqueId(const std::string& idString)
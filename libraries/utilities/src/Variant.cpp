@@ -19,36 +19,105 @@ namespace utilities
     Variant::Variant() :
         _type(std::type_index(typeid(void)))
     {
-        _value = nullptr;
     }
 
     Variant::Variant(const Variant& other) :
         _type(other._type)
     {
-        if (other._value)
+        CopyValueFrom(other);
+    }
+
+    Variant::Variant(Variant&& other) noexcept :
+        _type(other._type)
+    {
+        MoveValueFrom(std::move(other));
+        other._type = std::type_index(typeid(void));
+    }
+
+    Variant::~Variant()
+    {
+        DestroyValue();
+    }
+
+    Variant& Variant::operator=(const Variant& other)
+    {
+        if (this != &other)
         {
-            _value = other._value->Clone();
+            _type = other._type;
+            DestroyValue();
+            CopyValueFrom(other);
         }
-        else
+        return *this;
+    }
+
+    Variant& Variant::operator=(Variant&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _type = other._type;
+            DestroyValue();
+            MoveValueFrom(std::move(other));
+            other._type = std::type_index(typeid(void));
+        }
+        return *this;
+    }
+
+    void Variant::DestroyValue()
+    {
+        if (_value != nullptr)
         {
+            if (_isInline)
+            {
+                _value->~VariantBase();
+            }
+            else
+            {
+                delete _value;
+            }
             _value = nullptr;
+            _isInline = false;
         }
     }
 
-    Variant::Variant(std::type_index type, std::unique_ptr<VariantDetail::VariantBase> variantValue) :
-        _type(type)
+    void Variant::CopyValueFrom(const Variant& other)
     {
-        _value = std::move(variantValue);
+        if (other._value == nullptr)
+        {
+            return;
+        }
+
+        if (other._value->CanStoreInline(inlineStorageSize, alignof(std::max_align_t)))
+        {
+            _value = other._value->CloneInto(&_storage);
+            _isInline = true;
+        }
+        else
+        {
+            _value = other._value->Clone().release();
+            _isInline = false;
+        }
     }
 
-    Variant& Variant::operator=(const Variant& other)
+    void Variant::MoveValueFrom(Variant&& other)
     {
-        if (other._value != _value)
+        if (other._value == nullptr)
         {
-            _type = other._type;
-            _value = other._value->Clone();
+            return;
+        }
+
+        if (other._isInline)
+        {
+            _value = other._value->MoveInto(&_storage);
+            _isInline = true;
+            other.DestroyValue();
+        }
+        else
+        {
+            // steal the heap-allocated value
+            _value = other._value;
+            _isInline = false;
+            other._value = nullptr;
         }
-        return *this;
     }
 
     std::string Variant::ToString() const
@@ -138,14 +207,14 @@ namespace utilities
         if (type == "void")
         {
             _type = std::type_index(typeid(void));
-            _value = nullptr;
+            DestroyValue();
         }
         else
         {
             registry.SetVariantType(*this, type);
             archiver["value"] >> *_value;
 
-            if (_value.get() == nullptr)
+            if (_value == nullptr)
             {
                 throw utilities::DataFormatException(DataFormatErrors::badFormat, "Archive format is invalid, expecting a non empty value");
             }
@@ -15,6 +15,7 @@ void TestDimensionOrder();
 void TestMemoryLayoutCtors();
 void TestMemoryLayoutSlice();
 void TestMemoryLayoutHash();
+void TestMemoryLayoutIterator();
 void TestScalarLayout();
 void TestInflateMemoryLayout();
 void TestInflateNullMemoryLayout();
@@ -11,5 +11,6 @@
 namespace ell
 {
 void TestPropertyBag();
+void TestPropertyBagKeys();
 void TestRecursivePropertyBag();
 }
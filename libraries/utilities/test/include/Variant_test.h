@@ -22,5 +22,6 @@ void TestParsePortElementsProxyVariant();
 void TestParseObjVariant();
 
 void TestVariantToString();
+void TestVariantMove();
 void TestVariantArchive();
 } // namespace ell
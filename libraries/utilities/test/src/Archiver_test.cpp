@@ -9,6 +9,7 @@
 #include "Archiver_test.h"
 
 #include <utilities/include/Archiver.h>
+#include <utilities/include/BinaryArchiver.h>
 #include <utilities/include/IArchivable.h>
 #include <utilities/include/JsonArchiver.h>
 #include <utilities/include/UniqueId.h>
@@ -336,6 +337,33 @@ void TestUnarchiver()
         testing::ProcessTest(name + "Deserialize array check", testing::IsEqual(structVector[1].c, newStructVector[1].c));
     }
 
+    {
+        // arrays long enough to take the bulk-encoded path in archivers that have one
+        std::vector<double> bigDoubleVector(100);
+        std::vector<int> bigIntVector(100);
+        for (int i = 0; i < 100; ++i)
+        {
+            bigDoubleVector[i] = 0.5 * i - 25.0;
+            bigIntVector[i] = 3 * i - 50;
+        }
+
+        std::stringstream strstream;
+        {
+            ArchiverType archiver(strstream);
+            archiver.Archive("bigDoubleVec", bigDoubleVector);
+            archiver.Archive("bigIntVec", bigIntVector);
+        }
+
+        UnarchiverType unarchiver(strstream, context);
+        std::vector<double> newBigDoubleVector;
+        std::vector<int> newBigIntVector;
+        unarchiver.Unarchive("bigDoubleVec", newBigDoubleVector);
+        unarchiver.Unarchive("bigIntVec", newBigIntVector);
+
+        testing::ProcessTest(name + "Deserialize large array check", testing::IsEqual(bigDoubleVector, newBigDoubleVector));
+        testing::ProcessTest(name + "Deserialize large array check", testing::IsEqual(bigIntVector, newBigIntVector));
+    }
+
     {
         auto stringVal = std::string{ "Hi there! Here's a tab character: \t, as well as some 'quoted' text." };
         std::stringstream strstream;
@@ -359,6 +387,28 @@ void TestJsonArchiver()
 void TestJsonUnarchiver()
 {
     TestUnarchiver<utilities::JsonArchiver, utilities::JsonUnarchiver>();
+
+    {
+        // an array whose base64 encoding is bigger than the tokenizer's buffer, to exercise the streaming decode path
+        std::vector<double> hugeVector(150000);
+        for (int i = 0; i < 150000; ++i)
+        {
+            hugeVector[i] = 0.25 * i - 1000.0;
+        }
+
+        std::stringstream strstream;
+        {
+            utilities::JsonArchiver archiver(strstream);
+            archiver.Archive("hugeVec", hugeVector);
+        }
+
+        utilities::SerializationContext context;
+        utilities::JsonUnarchiver unarchiver(strstream, context);
+        std::vector<double> newHugeVector;
+        unarchiver.Unarchive("hugeVec", newHugeVector);
+
+        testing::ProcessTest("Deserialize huge bulk-encoded array check", testing::IsEqual(hugeVector, newHugeVector));
+    }
 }
 
 void TestXmlArchiver()
@@ -370,4 +420,14 @@ void TestXmlUnarchiver()
 {
     TestUnarchiver<utilities::XmlArchiver, utilities::XmlUnarchiver>();
 }
+
+void TestBinaryArchiver()
+{
+    TestArchiver<utilities::BinaryArchiver>();
+}
+
+void TestBinaryUnarchiver()
+{
+    TestUnarchiver<utilities::BinaryArchiver, utilities::BinaryUnarchiver>();
+}
 } // namespace ell
@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ArenaAllocator_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ArenaAllocator_test.h"
+
+#include <utilities/include/ArenaAllocator.h>
+
+#include <testing/include/testing.h>
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace ell
+{
+using namespace utilities;
+
+void TestArenaAllocatorBasic()
+{
+    ArenaAllocator arena(1024);
+
+    // small allocations should come out of a single block, adjacent and aligned
+    auto a = static_cast<char*>(arena.Allocate(16, 8));
+    auto b = static_cast<char*>(arena.Allocate(16, 8));
+    testing::ProcessTest("ArenaAllocator alignment", reinterpret_cast<uintptr_t>(a) % 8 == 0 && reinterpret_cast<uintptr_t>(b) % 8 == 0);
+    testing::ProcessTest("ArenaAllocator adjacency", b == a + 16);
+    testing::ProcessTest("ArenaAllocator block count", arena.GetNumBlocks() == 1);
+
+    // an allocation larger than the block size gets a dedicated block
+    arena.Allocate(4096, 8);
+    testing::ProcessTest("ArenaAllocator oversized allocation", arena.GetNumBlocks() == 2);
+
+    // filling up blocks adds new ones, and every allocation stays writable
+    std::vector<char*> pointers;
+    for (int index = 0; index < 100; ++index)
+    {
+        auto p = static_cast<char*>(arena.Allocate(100, 32));
+        testing::ProcessTest("ArenaAllocator alignment (32)", reinterpret_cast<uintptr_t>(p) % 32 == 0);
+        p[0] = static_cast<char>(index);
+        p[99] = static_cast<char>(index);
+        pointers.push_back(p);
+    }
+    bool ok = true;
+    for (int index = 0; index < 100; ++index)
+    {
+        ok &= (pointers[index][0] == static_cast<char>(index)) && (pointers[index][99] == static_cast<char>(index));
+    }
+    testing::ProcessTest("ArenaAllocator allocations stay valid", ok);
+    testing::ProcessTest("ArenaAllocator bytes allocated", arena.GetBytesAllocated() == 16 + 16 + 4096 + 100 * 100);
+}
+
+namespace
+{
+    struct Counted
+    {
+        explicit Counted(int& counter) :
+            counter(counter) { ++counter; }
+        ~Counted() { --counter; }
+        int& counter;
+        double payload[4] = { 0 };
+    };
+} // namespace
+
+void TestArenaAllocatorObjects()
+{
+    int liveObjects = 0;
+    {
+        ArenaAllocator arena;
+
+        // place objects in the arena and destroy them via a destructor-only deleter, the way
+        // Model does with its nodes
+        std::vector<std::shared_ptr<Counted>> objects;
+        for (int index = 0; index < 1000; ++index)
+        {
+            auto storage = arena.Allocate(sizeof(Counted), alignof(Counted));
+            auto object = new (storage) Counted(liveObjects);
+            objects.emplace_back(object, [](Counted* p) { p->~Counted(); });
+        }
+        testing::ProcessTest("ArenaAllocator object construction", liveObjects == 1000);
+        objects.clear();
+        testing::ProcessTest("ArenaAllocator object destruction", liveObjects == 0);
+    }
+    testing::ProcessTest("ArenaAllocator object destruction after arena teardown", liveObjects == 0);
+}
+} // namespace ell
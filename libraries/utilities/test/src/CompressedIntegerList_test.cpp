@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompressedIntegerList_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CompressedIntegerList_test.h"
+
+#include <utilities/include/CompressedIntegerList.h>
+#include <utilities/include/IntegerList.h>
+
+#include <testing/include/testing.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace ell
+{
+using namespace utilities;
+
+namespace
+{
+    // values whose deltas exercise all four encoded delta widths
+    std::vector<size_t> GetTestValues()
+    {
+        std::vector<size_t> values;
+        size_t value = 0;
+        for (int index = 0; index < 200; ++index)
+        {
+            value += 1 + (index % 3) * 37; // 1-byte deltas
+            values.push_back(value);
+        }
+        value += 1000; // 2-byte delta
+        values.push_back(value);
+        value += 100000; // 4-byte delta
+        values.push_back(value);
+        value += 0x100000000ULL; // 8-byte delta
+        values.push_back(value);
+        return values;
+    }
+
+    template <typename ListType>
+    std::vector<size_t> GetValuesViaBlockIterator(const ListType& list)
+    {
+        std::vector<size_t> result;
+        auto blockIterator = list.GetBlockIterator();
+        while (blockIterator.IsValid())
+        {
+            const size_t* block = blockIterator.Get();
+            size_t count = blockIterator.Size();
+            result.insert(result.end(), block, block + count);
+            blockIterator.Next();
+        }
+        return result;
+    }
+} // namespace
+
+void TestCompressedIntegerListBlockIterator()
+{
+    auto values = GetTestValues();
+    CompressedIntegerList list;
+    for (auto value : values)
+    {
+        list.Append(value);
+    }
+
+    testing::ProcessTest("CompressedIntegerList::BlockIterator values", GetValuesViaBlockIterator(list) == values);
+
+    CompressedIntegerList emptyList;
+    testing::ProcessTest("CompressedIntegerList::BlockIterator on empty list", !emptyList.GetBlockIterator().IsValid());
+}
+
+void TestIntegerListBlockIterator()
+{
+    auto values = GetTestValues();
+    IntegerList list;
+    for (auto value : values)
+    {
+        list.Append(value);
+    }
+
+    testing::ProcessTest("IntegerList::BlockIterator values", GetValuesViaBlockIterator(list) == values);
+
+    IntegerList emptyList;
+    testing::ProcessTest("IntegerList::BlockIterator on empty list", !emptyList.GetBlockIterator().IsValid());
+}
+
+void TestCompressedIntegerListCountIntersection()
+{
+    CompressedIntegerList evens;
+    CompressedIntegerList multiplesOfThree;
+    for (size_t value = 0; value < 1000; ++value)
+    {
+        if (value % 2 == 0)
+        {
+            evens.Append(value);
+        }
+        if (value % 3 == 0)
+        {
+            multiplesOfThree.Append(value);
+        }
+    }
+
+    // common entries are the multiples of 6: 0, 6, ..., 996
+    testing::ProcessTest("CompressedIntegerList::CountIntersection", evens.CountIntersection(multiplesOfThree) == 167);
+    testing::ProcessTest("CompressedIntegerList::CountIntersection is symmetric", multiplesOfThree.CountIntersection(evens) == 167);
+
+    CompressedIntegerList emptyList;
+    testing::ProcessTest("CompressedIntegerList::CountIntersection with empty list", evens.CountIntersection(emptyList) == 0);
+}
+} // namespace ell
@@ -222,6 +222,60 @@ void TestMemoryLayoutHash()
     testing::ProcessTest("std::hash<DimensionVector> 3", ok);
 }
 
+void TestMemoryLayoutIterator()
+{
+    // the incrementally-updated offsets must match GetLogicalEntryOffset on a padded,
+    // non-canonically-ordered layout
+    MemoryLayout layout({ 7, 5, 3 }, { 1, 2, 0 }, ChannelMajorTensorOrder);
+    auto logicalSize = layout.GetLogicalDimensionActiveSize();
+
+    bool ok = true;
+    size_t count = 0;
+    MemoryLayoutIterator iterator(layout);
+    for (int i = 0; i < logicalSize[0] && ok; ++i)
+    {
+        for (int j = 0; j < logicalSize[1] && ok; ++j)
+        {
+            for (int k = 0; k < logicalSize[2] && ok; ++k)
+            {
+                ok &= iterator.IsValid();
+                ok &= testing::IsEqual(iterator.GetOffset(), layout.GetLogicalEntryOffset({ i, j, k }));
+                ok &= testing::IsEqual(iterator.GetLogicalCoordinates(), MemoryCoordinates({ i, j, k }));
+                ++count;
+                iterator.Next();
+            }
+        }
+    }
+    ok &= !iterator.IsValid();
+    ok &= testing::IsEqual(count, layout.NumElements());
+    testing::ProcessTest("MemoryLayoutIterator full iteration", ok);
+
+    // an iterator restricted to a sub-region visits just that region
+    MemoryLayoutIterator subIterator(layout, { 2, 2, 2 });
+    ok = true;
+    for (int i = 0; i < 2 && ok; ++i)
+    {
+        for (int j = 0; j < 2 && ok; ++j)
+        {
+            for (int k = 0; k < 2 && ok; ++k)
+            {
+                ok &= subIterator.IsValid();
+                ok &= testing::IsEqual(subIterator.GetOffset(), layout.GetLogicalEntryOffset({ i, j, k }));
+                subIterator.Next();
+            }
+        }
+    }
+    ok &= !subIterator.IsValid();
+    testing::ProcessTest("MemoryLayoutIterator sub-region iteration", ok);
+
+    // a scalar (0-dimensional) layout has exactly one entry
+    MemoryLayoutIterator scalarIterator(ScalarLayout);
+    ok = scalarIterator.IsValid() && scalarIterator.GetOffset() == 0u;
+    scalarIterator.Next();
+    ok &= !scalarIterator.IsValid();
+    testing::ProcessTest("MemoryLayoutIterator scalar iteration", ok);
+}
+
 void TestScalarLayout()
 {
     bool ok = true;
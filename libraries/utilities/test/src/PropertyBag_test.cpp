@@ -101,6 +101,29 @@ void TestPropertyBag()
     testing::ProcessTest("Deserialize PropertyBag", testing::IsEqual(metadata3.GetEntry<double>("e"), 5.0));
 }
 
+void TestPropertyBagKeys()
+{
+    PropertyBag metadata;
+
+    PropertyBagKey aKey("a");
+    testing::ProcessTest("PropertyBagKey::GetName", testing::IsEqual(aKey.GetName(), "a"));
+
+    // keys with the same name share one interned copy
+    PropertyBagKey aKey2(std::string("a"));
+    testing::ProcessTest("PropertyBagKey interning", testing::IsTrue(&aKey.GetName() == &aKey2.GetName()));
+
+    testing::ProcessTest("PropertyBag::HasEntry with key", testing::IsFalse(metadata.HasEntry(aKey)));
+    testing::ProcessTest("PropertyBag::TryGetEntry on missing key", testing::IsTrue(metadata.TryGetEntry<int>(aKey) == nullptr));
+
+    metadata.SetEntry(aKey, 42);
+    testing::ProcessTest("PropertyBag::SetEntry with key", testing::IsTrue(metadata.HasEntry("a")));
+    testing::ProcessTest("PropertyBag::GetEntry with key", testing::IsEqual(metadata.GetEntry<int>(aKey), 42));
+
+    auto entry = metadata.TryGetEntry<int>(aKey);
+    testing::ProcessTest("PropertyBag::TryGetEntry", testing::IsTrue(entry != nullptr && *entry == 42));
+    testing::ProcessTest("PropertyBag::TryGetEntry with wrong type", testing::IsTrue(metadata.TryGetEntry<std::string>(aKey) == nullptr));
+}
+
 void TestRecursivePropertyBag()
 {
     PropertyBag inner;
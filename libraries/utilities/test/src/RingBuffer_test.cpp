@@ -13,6 +13,9 @@
 
 #include <testing/include/testing.h>
 
+#include <numeric>
+#include <thread>
+
 
 namespace ell
 {
@@ -51,4 +54,51 @@ namespace ell
         testing::ProcessTest("TestRingBuffer is empty", testing::IsEqual(ToArray(buffer), std::vector<float>({ 6, 5, 4, 3, 2 })));
 
     }
+
+    void TestSpscRingBuffer()
+    {
+        SpscRingBuffer<int> buffer(4);
+
+        testing::ProcessTest("TestSpscRingBuffer capacity", buffer.Capacity() == 4 && buffer.Size() == 0);
+
+        int value = 0;
+        testing::ProcessTest("TestSpscRingBuffer pop from empty", !buffer.TryPop(value));
+
+        testing::ProcessTest("TestSpscRingBuffer push", buffer.TryPush(1) && buffer.TryPush(2) && buffer.Size() == 2);
+
+        std::vector<int> block{ 3, 4, 5 };
+        testing::ProcessTest("TestSpscRingBuffer truncated bulk push", buffer.TryPush(block.data(), block.size()) == 2);
+        testing::ProcessTest("TestSpscRingBuffer push to full", !buffer.TryPush(5));
+
+        std::vector<int> popped(3);
+        testing::ProcessTest("TestSpscRingBuffer bulk pop", buffer.TryPop(popped.data(), popped.size()) == 3 && testing::IsEqual(popped, { 1, 2, 3 }));
+        testing::ProcessTest("TestSpscRingBuffer pop", buffer.TryPop(value) && value == 4 && buffer.Size() == 0);
+
+        // pass a known sequence between a producer and a consumer thread in small blocks and
+        // verify it arrives intact and in order
+        const int numItems = 100000;
+        std::vector<int> sent(numItems);
+        std::iota(sent.begin(), sent.end(), 0);
+        std::vector<int> received;
+        received.reserve(numItems);
+
+        SpscRingBuffer<int> queue(64);
+        std::thread producer([&sent, &queue] {
+            size_t numSent = 0;
+            while (numSent < sent.size())
+            {
+                numSent += queue.TryPush(sent.data() + numSent, std::min<size_t>(17, sent.size() - numSent));
+            }
+        });
+
+        std::vector<int> chunk(23);
+        while (received.size() < numItems)
+        {
+            auto numPopped = queue.TryPop(chunk.data(), chunk.size());
+            received.insert(received.end(), chunk.begin(), chunk.begin() + numPopped);
+        }
+        producer.join();
+
+        testing::ProcessTest("TestSpscRingBuffer threaded transfer", testing::IsEqual(sent, received));
+    }
 } // namespace ell
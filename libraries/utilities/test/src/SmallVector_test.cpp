@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SmallVector_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SmallVector_test.h"
+
+#include <utilities/include/SmallVector.h>
+
+#include <testing/include/testing.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace ell
+{
+using namespace utilities;
+
+void TestSmallVectorBasic()
+{
+    SmallVector<int, 2> v;
+    testing::ProcessTest("SmallVector empty", v.empty() && v.size() == 0 && v.capacity() == 2);
+
+    v.push_back(1);
+    v.push_back(2);
+    testing::ProcessTest("SmallVector push_back", v.size() == 2 && v[0] == 1 && v[1] == 2 && v.front() == 1 && v.back() == 2);
+
+    // while within the inline capacity, the elements live inside the vector object
+    auto inlineAddress = reinterpret_cast<const char*>(&v[0]);
+    testing::ProcessTest("SmallVector inline storage", inlineAddress >= reinterpret_cast<const char*>(&v) && inlineAddress < reinterpret_cast<const char*>(&v + 1));
+
+    v.pop_back();
+    testing::ProcessTest("SmallVector pop_back", v.size() == 1 && v.back() == 1);
+
+    v.clear();
+    testing::ProcessTest("SmallVector clear", v.empty());
+
+    int sum = 0;
+    v.push_back(3);
+    v.push_back(4);
+    for (auto x : v)
+    {
+        sum += x;
+    }
+    testing::ProcessTest("SmallVector iteration", sum == 7);
+
+    SmallVector<int, 2> w;
+    w.push_back(3);
+    w.push_back(4);
+    testing::ProcessTest("SmallVector equality", v == w && !(v != w));
+    w.back() = 5;
+    testing::ProcessTest("SmallVector inequality", v != w);
+}
+
+void TestSmallVectorGrowth()
+{
+    SmallVector<std::string, 1> v;
+    for (int i = 0; i < 100; ++i)
+    {
+        v.push_back(std::to_string(i));
+    }
+    bool ok = v.size() == 100;
+    for (int i = 0; i < 100; ++i)
+    {
+        ok = ok && v[static_cast<size_t>(i)] == std::to_string(i);
+    }
+    testing::ProcessTest("SmallVector growth past inline capacity", ok);
+
+    v.resize(10);
+    testing::ProcessTest("SmallVector shrinking resize", v.size() == 10 && v.back() == "9");
+    v.resize(12);
+    testing::ProcessTest("SmallVector growing resize", v.size() == 12 && v.back().empty());
+}
+
+void TestSmallVectorCopyAndMove()
+{
+    SmallVector<std::string, 2> small;
+    small.push_back("a");
+    SmallVector<std::string, 2> big;
+    for (int i = 0; i < 10; ++i)
+    {
+        big.push_back(std::to_string(i));
+    }
+
+    auto smallCopy = small;
+    auto bigCopy = big;
+    testing::ProcessTest("SmallVector copy", smallCopy == small && bigCopy == big);
+
+    auto smallMoved = std::move(smallCopy);
+    auto bigMoved = std::move(bigCopy);
+    testing::ProcessTest("SmallVector move", smallMoved == small && bigMoved == big && smallCopy.empty() && bigCopy.empty());
+
+    // move-only element types work too
+    SmallVector<std::unique_ptr<int>, 1> pointers;
+    pointers.emplace_back(std::make_unique<int>(1));
+    pointers.emplace_back(std::make_unique<int>(2));
+    auto movedPointers = std::move(pointers);
+    testing::ProcessTest("SmallVector move-only elements", movedPointers.size() == 2 && *movedPointers[0] == 1 && *movedPointers[1] == 2);
+
+    big = small;
+    testing::ProcessTest("SmallVector copy assignment", big == small);
+    small = std::move(smallMoved);
+    testing::ProcessTest("SmallVector move assignment", small.size() == 1 && small[0] == "a");
+}
+} // namespace ell
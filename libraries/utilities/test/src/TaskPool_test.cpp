@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     TaskPool_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "TaskPool_test.h"
+
+#include <utilities/include/TaskPool.h>
+
+#include <testing/include/testing.h>
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+namespace ell
+{
+using namespace utilities;
+
+void TestTaskPoolSubmit()
+{
+    TaskPool pool({ 4, false });
+
+    auto sum = pool.Submit([](int a, int b) { return a + b; }, 3, 4);
+    testing::ProcessTest("TaskPool::Submit with arguments", sum.get() == 7);
+
+    const int numTasks = 100;
+    std::atomic<int> counter{ 0 };
+    std::vector<std::future<void>> futures;
+    for (int index = 0; index < numTasks; ++index)
+    {
+        futures.push_back(pool.Submit([&counter] { ++counter; }));
+    }
+    for (auto& future : futures)
+    {
+        future.get();
+    }
+    testing::ProcessTest("TaskPool::Submit runs all tasks", counter.load() == numTasks);
+}
+
+void TestTaskPoolParallelFor()
+{
+    TaskPool pool({ 4, false });
+
+    const int size = 10000;
+    std::vector<int> values(size);
+    pool.ParallelFor(0, size, [&values](int index) { values[index] = 2 * index; });
+
+    bool ok = true;
+    for (int index = 0; index < size; ++index)
+    {
+        ok &= (values[index] == 2 * index);
+    }
+    testing::ProcessTest("TaskPool::ParallelFor", ok);
+
+    // an empty range is a no-op
+    pool.ParallelFor(5, 5, [&values](int index) { values[index] = -1; });
+    testing::ProcessTest("TaskPool::ParallelFor empty range", values[5] == 10);
+}
+
+void TestTaskPoolParallelReduce()
+{
+    TaskPool pool({ 4, false });
+
+    const int size = 10000;
+    auto sum = pool.ParallelReduce(0, size, 0, [](int index) { return index; }, [](int a, int b) { return a + b; });
+    testing::ProcessTest("TaskPool::ParallelReduce", sum == (size * (size - 1)) / 2);
+
+    auto emptySum = pool.ParallelReduce(5, 5, 42, [](int index) { return index; }, [](int a, int b) { return a + b; });
+    testing::ProcessTest("TaskPool::ParallelReduce empty range", emptySum == 42);
+}
+} // namespace ell
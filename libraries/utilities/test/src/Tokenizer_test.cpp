@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Tokenizer_test.cpp (utilities)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tokenizer_test.h"
+
+#include <utilities/include/Tokenizer.h>
+
+#include <testing/include/testing.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+using namespace utilities;
+
+void TestTokenizer()
+{
+    std::stringstream stream("{ \"a\": [1, 22]}");
+    Tokenizer tokenizer(stream, ",:{}[]'\"");
+
+    std::vector<std::string> expected{ "{", "\"", "a", "\"", ":", "[", "1", ",", "22", "]", "}" };
+    bool ok = true;
+    for (const auto& token : expected)
+    {
+        ok &= (tokenizer.ReadNextTokenView() == token);
+    }
+    testing::ProcessTest("Tokenizer::ReadNextTokenView", ok);
+    testing::ProcessTest("Tokenizer::ReadNextTokenView at end of stream", tokenizer.ReadNextTokenView().empty());
+}
+
+void TestTokenizerPutBack()
+{
+    std::stringstream stream("[alpha, beta]");
+    Tokenizer tokenizer(stream, ",:{}[]'\"");
+
+    testing::ProcessTest("Tokenizer::PeekNextTokenView", tokenizer.PeekNextTokenView() == "[" && tokenizer.ReadNextTokenView() == "[");
+
+    // put back a view that points into the buffer
+    auto token = tokenizer.ReadNextTokenView();
+    tokenizer.PutBackToken(token);
+    testing::ProcessTest("Tokenizer::PutBackToken with a buffer view", tokenizer.ReadNextTokenView() == "alpha");
+
+    // put back a caller-owned string; the tokenizer must copy it
+    {
+        std::string owned = "gamma";
+        tokenizer.PutBackToken(owned);
+    }
+    testing::ProcessTest("Tokenizer::PutBackToken with an owned string", tokenizer.ReadNextTokenView() == "gamma");
+
+    testing::ProcessTest("Tokenizer::TryMatchToken", tokenizer.TryMatchToken(",") && !tokenizer.TryMatchToken("}") && tokenizer.TryMatchToken("beta"));
+    tokenizer.MatchToken("]");
+}
+
+void TestTokenizerLongStream()
+{
+    // enough tokens to force several internal buffer refills (the buffer is 1 MB)
+    const int numItems = 300000;
+    std::stringstream stream;
+    stream << "[";
+    for (int index = 0; index < numItems; ++index)
+    {
+        if (index > 0)
+        {
+            stream << ", ";
+        }
+        stream << "\"item" << index << "\"";
+    }
+    stream << "]";
+
+    Tokenizer tokenizer(stream, ",:{}[]'\"");
+    tokenizer.MatchToken("[");
+    bool ok = true;
+    for (int index = 0; index < numItems; ++index)
+    {
+        if (index > 0)
+        {
+            ok &= tokenizer.TryMatchToken(",");
+        }
+        // peek, put the token back, and re-read it, to exercise put-back across refills
+        auto peeked = std::string(tokenizer.PeekNextTokenView());
+        tokenizer.MatchToken("\"");
+        auto token = tokenizer.ReadNextTokenView();
+        ok &= (peeked == "\"");
+        ok &= (token == "item" + std::to_string(index));
+        tokenizer.MatchToken("\"");
+    }
+    tokenizer.MatchToken("]");
+    testing::ProcessTest("Tokenizer long stream", ok);
+    testing::ProcessTest("Tokenizer long stream end", tokenizer.ReadNextTokenView().empty());
+}
+} // namespace ell
@@ -16,7 +16,9 @@
 #include <testing/include/testing.h>
 
 #include <iostream>
+#include <numeric>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace ell
@@ -178,6 +180,37 @@ void TestVariantToString()
     testing::ProcessTest("Variant ToString", v4.ToString() == "0");
 }
 
+void TestVariantMove()
+{
+    // small value: stored inline
+    utilities::Variant v1(5);
+    utilities::Variant v2(std::move(v1));
+    testing::ProcessTest("Variant move ctor value", v2.IsType<int>() && v2.GetValue<int>() == 5);
+    testing::ProcessTest("Variant move ctor empties source", v1.IsEmpty());
+
+    // large value: stored on the heap and stolen by the move
+    std::vector<double> bigVector(1000);
+    std::iota(bigVector.begin(), bigVector.end(), 0.0);
+    utilities::Variant v3(bigVector);
+    utilities::Variant v4 = std::move(v3);
+    testing::ProcessTest("Variant move assignment value", v4.GetValue<std::vector<double>>() == bigVector);
+    testing::ProcessTest("Variant move assignment empties source", v3.IsEmpty());
+
+    // copies are independent of their source
+    utilities::Variant v5(std::string("hello"));
+    utilities::Variant v6 = v5;
+    v5.SetValue(std::string("goodbye"));
+    testing::ProcessTest("Variant copy is independent", v6.GetValue<std::string>() == "hello" && v5.GetValue<std::string>() == "goodbye");
+
+    // self-assignment is a no-op
+    v6 = static_cast<utilities::Variant&>(v6);
+    testing::ProcessTest("Variant self-assignment", v6.GetValue<std::string>() == "hello");
+
+    // assigning over an existing value replaces it
+    v6 = std::move(v4);
+    testing::ProcessTest("Variant move assignment over existing value", v6.GetValue<std::vector<double>>() == bigVector);
+}
+
 void TestVariantArchive()
 {
     // Serialization
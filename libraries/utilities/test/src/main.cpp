@@ -6,7 +6,9 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "ArenaAllocator_test.h"
 #include "Archiver_test.h"
+#include "CompressedIntegerList_test.h"
 #include "Files_test.h"
 #include "Format_test.h"
 #include "FunctionUtils_test.h"
@@ -16,6 +18,9 @@
 #include "ObjectArchive_test.h"
 #include "PropertyBag_test.h"
 #include "RingBuffer_test.h"
+#include "SmallVector_test.h"
+#include "TaskPool_test.h"
+#include "Tokenizer_test.h"
 #include "TunableParameters_test.h"
 #include "TypeFactory_test.h"
 #include "TypeName_test.h"
@@ -44,7 +49,32 @@ int main(int argc, char* argv[])
     {
         std::string basePath = ell::utilities::GetDirectoryPath(argv[0]);
 
+        // ArenaAllocator tests
+        TestArenaAllocatorBasic();
+        TestArenaAllocatorObjects();
+
         TestRingBuffer();
+        TestSpscRingBuffer();
+
+        // SmallVector tests
+        TestSmallVectorBasic();
+        TestSmallVectorGrowth();
+        TestSmallVectorCopyAndMove();
+
+        // CompressedIntegerList tests
+        TestCompressedIntegerListBlockIterator();
+        TestIntegerListBlockIterator();
+        TestCompressedIntegerListCountIntersection();
+
+        // TaskPool tests
+        TestTaskPoolSubmit();
+        TestTaskPoolParallelFor();
+        TestTaskPoolParallelReduce();
+
+        // Tokenizer tests
+        TestTokenizer();
+        TestTokenizerPutBack();
+        TestTokenizerLongStream();
 
         // Format tests
         TestMatchFormat();
@@ -64,6 +94,7 @@ int main(int argc, char* argv[])
         TestMemoryLayoutCtors();
         TestMemoryLayoutSlice();
         TestMemoryLayoutHash();
+        TestMemoryLayoutIterator();
         TestScalarLayout();
         TestInflateMemoryLayout();
         TestInflateNullMemoryLayout();
@@ -79,6 +110,7 @@ int main(int argc, char* argv[])
         TestVariantToString();
         TestVariantParseSimple();
         TestParseVectorVaraint();
+        TestVariantMove();
         TestVariantArchive();
 
         // Verison number tests
@@ -92,6 +124,9 @@ int main(int argc, char* argv[])
         TestXmlArchiver();
         TestXmlUnarchiver();
 
+        TestBinaryArchiver();
+        TestBinaryUnarchiver();
+
         // ObjectArchive tests
         TestGetTypeDescription();
         TestGetObjectArchive();
@@ -117,6 +152,7 @@ int main(int argc, char* argv[])
 
         // PropertyBag tests
         TestPropertyBag();
+        TestPropertyBagKeys();
         TestRecursivePropertyBag();
 
         // TunableParameters
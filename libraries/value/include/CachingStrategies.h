@@ -38,6 +38,14 @@ namespace value
         void HandleCachingImpl(LoopNest&) override;
     };
 
+    // Caches a small compile-time-sized tile in a function-local buffer whose accesses are all
+    // fully unrolled with constant indices, so LLVM can promote the tile to registers. The tile
+    // must evenly divide the cached matrix; keep it small enough to fit the target's register file.
+    class RegisterBlockCache : public CachingProvider
+    {
+        void HandleCachingImpl(LoopNest&) override;
+    };
+
     class BLASTCopy : public CachingProvider
     {
     public:
@@ -46,6 +54,18 @@ namespace value
         Value _rawCache;
     };
 
+    // Variant of BLASTCopy for inputs whose contents are known at compile time. The caller
+    // supplies a constant buffer already holding every panel of the input in the BLASTCopy
+    // packed layout (zero-padded to full panels), so no cache fill kernel is emitted -- only
+    // the view-initialization kernel that points the inner kernels at the current panel.
+    class PrepackedBLASTCopy : public CachingProvider
+    {
+    public:
+        void HandleCachingImpl(LoopNest&) override;
+
+        Value _rawCache;
+    };
+
     class GeneralCachingStrategy : public CachingProvider
     {
     public:
@@ -56,8 +76,10 @@ namespace value
     using SubMatrixCopyInCopyOutCache = CachingStrategyType<CopyInputCopyOutput>;
     using SubMatrixCopyIn = CachingStrategyType<CopyInputNoOutput>;
     using ZeroInputCopyOutMatrixCache = CachingStrategyType<ZeroInputReduceOutput>;
+    using RegisterBlockMatrixCache = CachingStrategyType<RegisterBlockCache>;
 
     using BLASTCopyCache = CachingStrategyType<BLASTCopy>;
+    using PrepackedBLASTCopyCache = CachingStrategyType<PrepackedBLASTCopy>;
 
 } // namespace value
 } // namespace ell
@@ -79,6 +79,8 @@ namespace value
 
         void PrefetchImpl(Value data, PrefetchType type, PrefetchLocality locality) override;
 
+        void SetNonTemporalStoresImpl(bool enabled) override;
+
         void ParallelizeImpl(int numTasks, std::vector<Value> captured, std::function<void(Scalar, std::vector<Value>)> fn) override;
 
         void DebugBreakImpl() override;
@@ -15,6 +15,7 @@
 #include <forward_list>
 #include <functional>
 #include <iosfwd>
+#include <mutex>
 #include <sstream>
 #include <stack>
 #include <string>
@@ -78,6 +79,8 @@ namespace value
 
         void PrefetchImpl(Value data, PrefetchType type, PrefetchLocality locality) override;
 
+        void SetNonTemporalStoresImpl(bool enabled) override;
+
         void ParallelizeImpl(int numTasks, std::vector<Value> captured, std::function<void(Scalar, std::vector<Value>)> fn) override;
 
         void DebugBreakImpl() override;
@@ -97,6 +100,7 @@ namespace value
 
         void DeclareFunction(FunctionDeclaration decl);
         std::ostream& WriteFunctionSignature(std::ostream& stream, FunctionDeclaration decl);
+        std::string CanonicalizeFunctionCode(std::string code, const std::string& fnName) const;
 
         std::ostream& Out();
         std::ostream& Global();
@@ -154,7 +158,9 @@ namespace value
         std::ostringstream _expressionStream;
         std::reference_wrapper<std::ostream> _stream;
         std::reference_wrapper<std::ostream> _outputStream;
+        mutable std::recursive_mutex _mutex;
         std::unordered_map<FunctionDeclaration, DefinedFunction> _definedFunctions;
+        std::unordered_map<std::string, std::string> _memoizedFunctionNames;
         std::map<std::string, std::pair<Emittable, MemoryLayout>> _globals;
         std::forward_list<ValueImpl> _globalsList;
         std::unordered_set<std::string> _declaredFunctions;
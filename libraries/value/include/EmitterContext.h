@@ -291,6 +291,11 @@ namespace value
 
         void Prefetch(Value data, PrefetchType type, PrefetchLocality locality);
 
+        /// <summary> Runs the provided function with the non-temporal store hint enabled: stores emitted
+        /// while it runs may bypass the cache, for output data that is written once and not re-read </summary>
+        /// <param name="fn"> The function whose stores should be treated as non-temporal </param>
+        void NonTemporalStores(std::function<void()> fn);
+
         /// <summary> Runs the provided function, in parallel if possible </summary>
         /// <param name="numTasks"> The number of tasks that should be created </param>
         /// <param name="captured"> A list of values to be used inside the function </param>
@@ -378,6 +383,8 @@ namespace value
 
         virtual void PrefetchImpl(Value data, PrefetchType type, PrefetchLocality locality) = 0;
 
+        virtual void SetNonTemporalStoresImpl(bool enabled) = 0;
+
         virtual void ParallelizeImpl(int numTasks, std::vector<Value> captured, std::function<void(Scalar, std::vector<Value>)> fn) = 0;
 
         virtual void DebugBreakImpl() = 0;
@@ -704,6 +711,21 @@ namespace value
     template <typename ViewType>
     void Prefetch(ViewType view, PrefetchType type = PrefetchType::Read, PrefetchLocality locality = PrefetchLocality::None);
 
+    /// <summary> Prefetches the memory the given number of elements past the beginning of the view,
+    /// for fetching ahead of the current position from inside a loop </summary>
+    /// <param name="view"> The view whose memory should be prefetched </param>
+    /// <param name="elementsAhead"> The distance, in elements, past the beginning of the view to prefetch </param>
+    /// <param name="type"> Specifies whether the fetched data will be read or written </param>
+    /// <param name="locality"> The temporal locality of the fetched data </param>
+    template <typename ViewType>
+    void Prefetch(ViewType view, Scalar elementsAhead, PrefetchType type = PrefetchType::Read, PrefetchLocality locality = PrefetchLocality::None);
+
+    /// <summary> Runs the given function with the non-temporal store hint enabled: stores emitted while
+    /// it runs may bypass the cache. Use for output data that is written once and not re-read (final
+    /// outputs, cached panels being flushed), so streaming writes don't displace useful cache lines </summary>
+    /// <param name="fn"> The function whose stores should be treated as non-temporal </param>
+    void NonTemporalStores(std::function<void()> fn);
+
     /// <summary> Returns a unique name based on the prefix provided </summary>
     /// <param name="prefix"> The prefix for the unique name desired </param>
     /// <returns> A unique name for the current EmitterContext instance </returns>
@@ -778,6 +800,12 @@ namespace value
         GetContext().Prefetch(detail::GetValue(view), type, locality);
     }
 
+    template <typename ViewType>
+    void Prefetch(ViewType view, Scalar elementsAhead, PrefetchType type, PrefetchLocality locality)
+    {
+        GetContext().Prefetch(detail::GetValue(view).Offset(elementsAhead), type, locality);
+    }
+
     template <typename ViewType>
     ViewType AsFullView(ViewType view)
     {
@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LoopNestAutotuner.h (value)
+//  Authors:  Kern Handa, Mason Remy
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <emitters/include/CompilerOptions.h>
+
+#include <utilities/include/IArchivable.h>
+#include <utilities/include/MemoryLayout.h>
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace value
+{
+    /// <summary> One point in the schedule search space for a loop nest: the split factor chosen for
+    /// each tunable loop, the loop order to use, and the caching strategy to apply. The autotuner
+    /// enumerates these; the kernel-defining callback interprets them when it builds its schedule. </summary>
+    struct LoopNestSchedule : public utilities::IArchivable
+    {
+        /// <summary> The split factor chosen for each tunable loop, in the order the kernel declares
+        /// them. A factor less than 2 means "don't split that loop". </summary>
+        std::vector<int> splitSizes;
+
+        /// <summary> The loop order to use, outermost first, as a permutation of the kernel's tunable
+        /// loops. Empty means "keep the declared order". </summary>
+        std::vector<int> loopOrder;
+
+        /// <summary> The name of a caching strategy from CachingStrategies.h (e.g. "CopyInputCopyOutput",
+        /// "BLASTCopy"), or the empty string for no caching. </summary>
+        std::string cachingStrategy;
+
+        /// <summary> Gets the name of this type. </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return "LoopNestSchedule"; }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+    protected:
+        void WriteToArchive(utilities::Archiver& archiver) const override;
+        void ReadFromArchive(utilities::Unarchiver& archiver) override;
+    };
+
+    /// <summary> The schedule search space the autotuner explores: candidate split factors for each
+    /// tunable loop, candidate loop orders, and candidate caching strategies. The autotuner times the
+    /// full cross product, so keep the per-dimension candidate lists short. </summary>
+    struct LoopNestSearchSpace
+    {
+        /// <summary> For each tunable loop, the list of split factors to try. </summary>
+        std::vector<std::vector<int>> splitSizes;
+
+        /// <summary> The loop orders to try. An empty list means "only the declared order". </summary>
+        std::vector<std::vector<int>> loopOrders;
+
+        /// <summary> The caching strategies to try. An empty list means "no caching". </summary>
+        std::vector<std::string> cachingStrategies;
+    };
+
+    /// <summary> The result of a tuning run: the best schedule found, how fast it ran, and whether it
+    /// came from the persisted tuning cache instead of a fresh search. </summary>
+    struct LoopNestTuningResult
+    {
+        /// <summary> The best schedule found (or loaded from the cache). </summary>
+        LoopNestSchedule schedule;
+
+        /// <summary> The best candidate's measured time, in seconds. Zero when the schedule came from the cache. </summary>
+        double timeInSeconds = 0.0;
+
+        /// <summary> The number of candidates compiled and timed. Zero when the schedule came from the cache. </summary>
+        int candidatesTimed = 0;
+
+        /// <summary> True if the schedule was loaded from the tuning cache rather than searched for. </summary>
+        bool fromCache = false;
+    };
+
+    /// <summary> A search driver that finds a good schedule for a loop nest kernel by enumerating
+    /// candidate schedules, JIT-compiling and timing each one on the host, and optionally persisting
+    /// the winner to a tuning cache keyed by (kernel, shape, target). </summary>
+    ///
+    /// The caller supplies a callback that defines the kernel for a given `LoopNestSchedule` --
+    /// typically by building a `LoopNest` over locally-allocated data, applying the schedule's splits,
+    /// order, and caching strategy via `Schedule`, and calling `Run()`. The callback is invoked once
+    /// per candidate inside a fresh `LLVMContext`.
+    class LoopNestAutotuner
+    {
+    public:
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="kernelName"> The name of the kernel being tuned (used in the cache key and in
+        ///   the generated function names). </param>
+        /// <param name="shape"> The problem shape being tuned for (used in the cache key). </param>
+        /// <param name="compilerOptions"> The compiler options to compile the candidates with. </param>
+        LoopNestAutotuner(std::string kernelName, utilities::MemoryShape shape, const emitters::CompilerOptions& compilerOptions = {});
+
+        /// <summary> Sets how often each candidate is run. The reported time is the minimum over the
+        /// timing runs, after the warmup runs. </summary>
+        ///
+        /// <param name="warmupRuns"> The number of untimed warmup runs per candidate. </param>
+        /// <param name="timingRuns"> The number of timed runs per candidate. </param>
+        void SetTimingRuns(int warmupRuns, int timingRuns);
+
+        /// <summary> Sets the tuning cache file. When set, `Tune` first looks the key up in the cache
+        /// and skips the search on a hit, and records the best schedule on a miss. </summary>
+        ///
+        /// <param name="filename"> The path of the cache file. An empty string disables caching. </param>
+        void SetCacheFilename(std::string filename);
+
+        /// <summary> Gets the key the tuned schedule is stored under: the kernel name, the problem
+        /// shape, and the target triple. </summary>
+        ///
+        /// <returns> The cache key for this (kernel, shape, target) combination. </returns>
+        std::string GetCacheKey() const;
+
+        /// <summary> Searches the given space for the fastest schedule. </summary>
+        ///
+        /// <param name="searchSpace"> The search space to enumerate. </param>
+        /// <param name="emitKernel"> The callback that defines the kernel for a candidate schedule. </param>
+        ///
+        /// <returns> The best schedule found, with its measured time. </returns>
+        LoopNestTuningResult Tune(const LoopNestSearchSpace& searchSpace, std::function<void(const LoopNestSchedule&)> emitKernel) const;
+
+        /// <summary> Loads a previously-saved schedule from a tuning cache file. </summary>
+        ///
+        /// <param name="filename"> The path of the cache file. </param>
+        /// <param name="key"> The cache key to look up. </param>
+        ///
+        /// <returns> The stored schedule, or `std::nullopt` if the file or key doesn't exist. </returns>
+        static std::optional<LoopNestSchedule> LoadSchedule(const std::string& filename, const std::string& key);
+
+        /// <summary> Saves a schedule to a tuning cache file, replacing any existing entry with the same key. </summary>
+        ///
+        /// <param name="filename"> The path of the cache file. </param>
+        /// <param name="key"> The cache key to store the schedule under. </param>
+        /// <param name="schedule"> The schedule to store. </param>
+        static void SaveSchedule(const std::string& filename, const std::string& key, const LoopNestSchedule& schedule);
+
+    private:
+        std::vector<LoopNestSchedule> EnumerateCandidates(const LoopNestSearchSpace& searchSpace) const;
+        double TimeCandidate(const std::string& functionName, const LoopNestSchedule& schedule, const std::function<void(const LoopNestSchedule&)>& emitKernel) const;
+
+        std::string _kernelName;
+        utilities::MemoryShape _shape;
+        emitters::CompilerOptions _compilerOptions;
+        std::string _cacheFilename;
+        int _warmupRuns = 1;
+        int _timingRuns = 10;
+    };
+} // namespace value
+} // namespace ell
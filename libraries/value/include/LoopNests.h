@@ -77,6 +77,19 @@ namespace value
         /// <returns> The index which represents the outer loop, now unrolled </returns>
         Index Unroll(Index index, int factor);
 
+        /// <summary> Vectorizes the loop represented by the index: its iterations are emitted as one
+        /// straight-line block of contiguous operations, sized to be packed into SIMD instructions.
+        /// The loop should already be split to the vector width </summary>
+        /// <param name="index"> Represents the loop to vectorize </param>
+        void Vectorize(Index index);
+
+        /// <summary> Splits the loop represented by the index by the vector width and vectorizes the
+        /// width-sized inner loop. Any boundary iterations are emitted as a scalar epilogue loop </summary>
+        /// <param name="index"> Represents the loop to vectorize </param>
+        /// <param name="width"> The vector width, in elements </param>
+        /// <returns> The index which represents the outer loop </returns>
+        Index Vectorize(Index index, int width);
+
         void Cache(std::unique_ptr<CachingProvider> provider);
 
         template <typename CachingStrategyType>
@@ -147,6 +160,7 @@ namespace value
         LoopNest& DoImpl(std::function<void(Args...)> fn, std::vector<Index> kernelOuterIndices, std::string kernelId);
 
         friend void swap(LoopNest& nest1, LoopNest& nest2) noexcept;
+        friend LoopNest Fuse(const LoopNest& nest1, const LoopNest& nest2, const std::vector<Index>& dependentIndices1, const std::vector<Index>& dependentIndices2);
         friend class Schedule;
 
         std::unique_ptr<LoopNestImpl> _impl;
@@ -154,6 +168,25 @@ namespace value
     };
 
     LoopNest Using(std::initializer_list<ViewAdapter> inputs, ArgumentType argType);
+
+    /// <summary> Fuses two loop nests into one, so a consumer nest's kernels run inside the producer
+    /// nest's loops instead of in a separate pass over the data. Indices present in only one of the
+    /// nests become dependent indices for the other nest's kernels: the first nest's kernels run on
+    /// the first iteration of indices only in the second nest, and the second nest's kernels run on
+    /// the last iteration of indices only in the first nest (e.g., after a reduction finishes) </summary>
+    /// <param name="nest1"> The producer loop nest; its kernels run first within the fused nest </param>
+    /// <param name="nest2"> The consumer loop nest; its kernels run after the producer's </param>
+    /// <returns> A new loop nest containing the kernels of both nests </returns>
+    LoopNest Fuse(const LoopNest& nest1, const LoopNest& nest2);
+
+    /// <summary> Fuses two loop nests into one, with explicitly-given dependent indices in addition
+    /// to the ones inferred from indices present in only one of the nests </summary>
+    /// <param name="nest1"> The producer loop nest; its kernels run first within the fused nest </param>
+    /// <param name="nest2"> The consumer loop nest; its kernels run after the producer's </param>
+    /// <param name="dependentIndices1"> Indices whose first iteration the first nest's kernels are restricted to </param>
+    /// <param name="dependentIndices2"> Indices whose last iteration the second nest's kernels are restricted to </param>
+    /// <returns> A new loop nest containing the kernels of both nests </returns>
+    LoopNest Fuse(const LoopNest& nest1, const LoopNest& nest2, const std::vector<Index>& dependentIndices1, const std::vector<Index>& dependentIndices2);
 } // namespace value
 } // namespace ell
 
@@ -203,6 +203,9 @@ namespace value
             void Unroll(Index index);
             [[maybe_unused]] SplitIndex Unroll(Index index, int factor);
 
+            void Vectorize(Index index);
+            [[maybe_unused]] SplitIndex Vectorize(Index index, int width);
+
             [[maybe_unused]] SplitIndex Split(Index index, int size);
 
             void SetLoopOrder(const std::vector<Index>& order);
@@ -228,6 +231,8 @@ namespace value
 
             bool IsUnrolled(const Index& index) const;
 
+            bool IsVectorized(const Index& index) const;
+
             /// <summary> See if an Index is used as a parameter to a kernel </summary>
             bool IsUsed(const Index& index, const std::vector<ScheduledKernel>& activeKernels) const;
 
@@ -261,6 +266,7 @@ namespace value
             std::vector<RenameAction> _renameActions;
             std::vector<Index> _parallelizedIndices;
             std::vector<Index> _unrolledIndices;
+            std::vector<Index> _vectorizedIndices;
             std::string _name = UniqueName("LoopNest");
         };
 
@@ -352,6 +352,83 @@ namespace value
         underlyingNest.RenameVariable(_value, cacheRef, _atIndices, { kernel2, kernel3 });
     } // namespace value
 
+    void RegisterBlockCache::HandleCachingImpl(LoopNest& nest)
+    {
+        ValidateInputDimensionality(_value, _shape, _order);
+
+        // The tile lives in a function-local buffer and every access to it uses a compile-time
+        // constant index, so the copy-in / compute / copy-out code is straight-line with no loops
+        // over the tile. Once the loop-nest kernels are folded together, SROA / mem2reg can promote
+        // the whole tile to registers, which is the point of this strategy -- keep the innermost
+        // accumulator tile out of memory entirely. Keep the tile no bigger than the register file.
+        const int tileRows = _shape[0];
+        const int tileColumns = _shape[1];
+
+        auto inputMatrix = Matrix(_value);
+        if (static_cast<int>(inputMatrix.Rows()) % tileRows != 0 || static_cast<int>(inputMatrix.Columns()) % tileColumns != 0)
+        {
+            // Boundary tiles would need per-element bounds checks in fully-unrolled code, which
+            // defeats register promotion, so require the tile to evenly divide the matrix
+            throw InputException(InputExceptionErrors::invalidSize, "The register block size must evenly divide the cached matrix");
+        }
+
+        auto canonicalLayout = MemoryLayout{ _shape };
+        auto orderedLayout = canonicalLayout.ReorderedCopy(_order);
+
+        auto cacheName = UniqueName("registerBlockCache");
+        auto cacheValue = Allocate(_value.GetBaseType(), orderedLayout);
+        cacheValue.SetName(cacheName);
+        auto cacheRef = cacheValue.Reference();
+        cacheRef.SetName(cacheName + "Ref");
+
+        auto copyInKernel = loopnests::Kernel(cacheName + "_Init_Kernel")
+                                .Inputs(_value, cacheRef)
+                                .Indices(_kernelIndices)
+                                .Define([orderedLayout, tileRows, tileColumns](value::Matrix input, value::Value cacheRef, value::Scalar i, value::Scalar j) {
+                                    Matrix cacheMatrix = cacheRef.Dereference();
+                                    for (int tileRow = 0; tileRow < tileRows; ++tileRow)
+                                    {
+                                        for (int tileColumn = 0; tileColumn < tileColumns; ++tileColumn)
+                                        {
+                                            cacheMatrix(tileRow, tileColumn) = input(i + tileRow, j + tileColumn);
+                                        }
+                                    }
+
+                                    // Update cacheRef so that the global (i, j) indices used by the
+                                    // inner kernels land on the right tile entries
+                                    auto offsetCacheValue = cacheMatrix.GetValue().Offset({ -1 * i, -1 * j });
+                                    offsetCacheValue.SetLayout(orderedLayout);
+                                    cacheRef = offsetCacheValue.Reference();
+                                });
+
+        auto copyOutKernel = loopnests::Kernel(cacheName + "_CopyOut_Kernel")
+                                 .Inputs(_value, cacheRef)
+                                 .Indices(_kernelIndices)
+                                 .Define([orderedLayout, tileRows, tileColumns](value::Matrix output, value::Value cacheRef, value::Scalar i, value::Scalar j) {
+                                     auto cacheTmpOffset = cacheRef.Dereference().Offset({ i, j });
+                                     cacheTmpOffset.SetLayout(orderedLayout);
+                                     cacheRef = cacheTmpOffset.Reference();
+                                     auto cacheMatrix = value::Matrix(cacheRef.Dereference());
+
+                                     // The tile being flushed is final output that won't be re-read here,
+                                     // so hint that the stores can stream past the cache
+                                     NonTemporalStores([&] {
+                                         for (int tileRow = 0; tileRow < tileRows; ++tileRow)
+                                         {
+                                             for (int tileColumn = 0; tileColumn < tileColumns; ++tileColumn)
+                                             {
+                                                 output(i + tileRow, j + tileColumn) = cacheMatrix(tileRow, tileColumn);
+                                             }
+                                         }
+                                     });
+                                 });
+
+        auto& underlyingNest = nest.GetUnderlyingLoopNest();
+        underlyingNest.AddKernel(copyInKernel, loopnests::CodePositionConstraints{ loopnests::LoopFragmentType::prologue, _atIndices, {} });
+        underlyingNest.AddKernel(copyOutKernel, loopnests::CodePositionConstraints{ loopnests::LoopFragmentType::epilogue, _atIndices, {} });
+        underlyingNest.RenameVariable(_value, cacheRef, _atIndices, { copyInKernel, copyOutKernel });
+    }
+
     void BLASTCopy::HandleCachingImpl(LoopNest& nest)
     {
         /* BLAS T COPY:
@@ -592,6 +669,93 @@ namespace value
         underlyingNest.RenameVariable(_value, cacheRef, _atIndices, { cacheFillKernel, viewInitKernel });
     }
 
+    void PrepackedBLASTCopy::HandleCachingImpl(LoopNest& nest)
+    {
+        /* PREPACKED BLAS T COPY:
+        Same cache layout as BLASTCopy, but the input contents are known at compile time and the
+        caller has already laid out every M' x N' panel of the input in the packed stripe order
+        inside one constant buffer:
+
+            packed ( i / M', j / N', (j % N') / stripeSize, i % M', j % stripeSize ) = input ( i, j )
+
+        Boundary panels are zero-padded to the full panel size, so every panel has the same layout
+        and no boundary-condition handling is needed. There is no cache fill kernel -- the only
+        runtime work left is positioning the view pointer for the current stripe, so each
+        invocation skips the packing pass entirely.
+        */
+
+        ValidateInputDimensionality(_value, _shape, _order);
+
+        // get the stripe size, stripe splitting index, and prepacked constant buffer from extras
+        auto extraParams = std::any_cast<std::tuple<int, Index, Value>>(_extra);
+        int stripeSize;
+        Index stripeSplitIndex;
+        Value packedBuffer;
+        std::tie(stripeSize, stripeSplitIndex, packedBuffer) = extraParams;
+
+        if (_shape[1] % stripeSize != 0)
+        {
+            // The base 5D packed layout can only represent the full cache if the number of cache
+            // columns is a multiple of the stripe size (same restriction as BLASTCopy)
+            throw InputException(InputExceptionErrors::invalidSize, "The number of cache columns must be a multiple of the cache stripe size");
+        }
+
+        auto inputMatrix = Matrix(_value);
+        int inputRows = inputMatrix.Rows();
+        int inputCols = inputMatrix.Columns();
+        int rowPanels = RoundUpToMultiple(inputRows, _shape[0]) / _shape[0];
+        int columnPanels = RoundUpToMultiple(inputCols, _shape[1]) / _shape[1];
+
+        // Lift the packed buffer into a 5D array:
+        // The first two dimensions identify which cached panel to use
+        // The next dimension identifies the cached column block inside of that panel
+        // The last two dimensions identify the element inside of that cached submatrix block
+        auto packedLayout = MemoryLayout{ MemoryShape{ rowPanels, columnPanels, _shape[1] / stripeSize, _shape[0], stripeSize } };
+        if (packedBuffer.GetLayout() != packedLayout)
+        {
+            throw InputException(InputExceptionErrors::invalidSize, "The prepacked buffer does not match the panel layout implied by the cache shape");
+        }
+
+        auto cacheViewLayout = MemoryLayout{ { _shape[0], stripeSize }, RowMajorMatrixOrder };
+
+        auto cacheName = UniqueName("PrepackedBLASTCopyCache");
+        _rawCache = packedBuffer;
+        Array packedCache(_rawCache);
+
+        auto cacheRef = _rawCache.Reference();
+        cacheRef.SetLayout(cacheViewLayout);
+        cacheRef.SetName(cacheName + "_Ref");
+
+        auto& underlyingNest = nest.GetUnderlyingLoopNest();
+
+        std::vector<Index> viewInitKernelIndices;
+        viewInitKernelIndices.assign(_kernelIndices.begin(), _kernelIndices.end());
+        viewInitKernelIndices.push_back(stripeSplitIndex);
+        auto viewInitKernel = loopnests::Kernel(cacheName + "_View_Init_Kernel")
+                                  .Inputs(packedCache, cacheRef)
+                                  .Indices(viewInitKernelIndices)
+                                  .Define([shape = _shape, stripeSize, packedLayout, cacheViewLayout](value::Array cache, value::Value cacheRef, value::Scalar i, value::Scalar j, value::Scalar jStripe) {
+                                      // To set up the view for the kernel to use, we need to set up the cacheRef reference
+                                      // so that a kernel indexing with (i, j) winds up in the right spot, pointing into the
+                                      // packed row-major submatrix that is the
+                                      // (i / M', j / N', (jStripe % N') / stripeSize, ALL, ALL) slice of the packed buffer.
+                                      // Every panel is a full M' x N' block, so there are no boundary layouts to switch between.
+                                      auto cacheView = cache.GetValue();
+                                      cacheView.SetLayout(packedLayout);
+                                      auto cacheStripe = jStripe % shape[1];
+                                      auto indexedCacheView = cacheView.Offset({ i / shape[0], j / shape[1], cacheStripe / stripeSize, 0, 0 });
+
+                                      // Re-View the indexed cache as a 2-D matrix so we can position the offset pointer for use in the inner kernels
+                                      indexedCacheView.SetLayout(cacheViewLayout);
+                                      auto offsetIndexedCacheView = indexedCacheView.Offset({ -1 * i, -1 * jStripe });
+                                      offsetIndexedCacheView.SetLayout(cacheViewLayout);
+                                      cacheRef.SetLayout(cacheViewLayout);
+                                      cacheRef = offsetIndexedCacheView.Reference();
+                                  });
+        underlyingNest.AddKernel(viewInitKernel, loopnests::CodePositionConstraints{ loopnests::LoopFragmentType::prologue, { stripeSplitIndex }, {} });
+        underlyingNest.RenameVariable(_value, cacheRef, _atIndices, { viewInitKernel });
+    }
+
    // namespace value
 
   
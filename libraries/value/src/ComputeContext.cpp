@@ -1429,15 +1429,30 @@ namespace value
     void ComputeContext::PrefetchImpl(Value, PrefetchType, PrefetchLocality)
     {}
 
+    void ComputeContext::SetNonTemporalStoresImpl(bool)
+    {}
+
     void ComputeContext::ParallelizeImpl(int numTasks, std::vector<Value> captured, std::function<void(Scalar, std::vector<Value>)> fn)
     {
         ThreadIds.Clear();
 
+        // Interpret the tasks on a bounded pool of worker threads, rather than one thread per
+        // task: launching thousands of threads for a large parallelized loop costs more than the
+        // parallelism buys back, and the default std::async policy is free to run everything
+        // deferred (i.e., serially). Each worker interprets a strided subset of the task indices.
+        const int maxWorkers = static_cast<int>(std::thread::hardware_concurrency());
+        const int numWorkers = std::max(1, std::min(numTasks, maxWorkers));
+
         std::vector<std::future<void>> futures;
-        futures.reserve(numTasks);
-        for (int i = 0; i < numTasks; ++i)
+        futures.reserve(numWorkers);
+        for (int worker = 0; worker < numWorkers; ++worker)
         {
-            futures.push_back(std::async(fn, Scalar{ i }, captured));
+            futures.push_back(std::async(std::launch::async, [worker, numWorkers, numTasks, &captured, &fn] {
+                for (int taskIndex = worker; taskIndex < numTasks; taskIndex += numWorkers)
+                {
+                    fn(Scalar{ taskIndex }, captured);
+                }
+            }));
         }
         for (auto& future : futures)
         {
@@ -45,6 +45,12 @@ namespace value
             _context._promotedConstantStack.pop();
         }
 
+        std::string GetCode() const { return _sstr.str(); }
+
+        // Throw away the code written so far instead of flushing it to the expression
+        // stream (used when an identical definition has already been emitted)
+        void Discard() { _discard = true; }
+
     private:
         struct StreamGuard
         {
@@ -62,9 +68,12 @@ namespace value
                 _context._context._stream = _oldStream;
                 _context._context._indent = _oldIndent;
 
-                // write our contents directly to the expression stream because the old stream
-                // might point to someone else's stream
-                _context._context._expressionStream << _context._sstr.str();
+                if (!_context._discard)
+                {
+                    // write our contents directly to the expression stream because the old stream
+                    // might point to someone else's stream
+                    _context._context._expressionStream << _context._sstr.str();
+                }
             }
 
         private:
@@ -75,6 +84,7 @@ namespace value
 
         CppEmitterContext& _context;
         std::stringstream _sstr;
+        bool _discard = false;
         StreamGuard _guard;
     };
 
@@ -383,6 +393,8 @@ namespace value
 
     void CppEmitterContext::DeclareFunction(FunctionDeclaration decl)
     {
+        std::lock_guard lock{ _mutex };
+
         auto [it, inserted] = _declaredFunctions.emplace(decl.GetFunctionName());
         if (!inserted)
         {
@@ -422,6 +434,70 @@ namespace value
         return stream;
     }
 
+    std::string CppEmitterContext::CanonicalizeFunctionCode(std::string code, const std::string& fnName) const
+    {
+        // Rewrite the emitted definition into a form that is invariant under the names the
+        // emitter generated for it, so that two functions performing the same operations on
+        // the same types and layouts canonicalize to the same string. Two substitutions are
+        // needed: the function's own name (which also prefixes its function-scoped globals),
+        // and the numeric suffixes handed out by UniqueName, which depend on global counter
+        // state rather than on the function being emitted. Suffixes are renumbered per stem
+        // in order of first appearance; names of other emitted functions are left untouched,
+        // since their (hash-decorated) suffixes are meaningful.
+        for (size_t pos = 0; (pos = code.find(fnName, pos)) != std::string::npos;)
+        {
+            code.replace(pos, fnName.size(), "$fn");
+            pos += 3;
+        }
+
+        auto isIdentifierChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+
+        std::string result;
+        result.reserve(code.size());
+        std::map<std::string, int> suffixCounters;
+        std::unordered_map<std::string, std::string> renamedTokens;
+        for (size_t pos = 0; pos < code.size();)
+        {
+            char c = code[pos];
+            if (!std::isalpha(static_cast<unsigned char>(c)) && c != '_')
+            {
+                result.push_back(c);
+                ++pos;
+                continue;
+            }
+
+            auto end = pos;
+            while (end < code.size() && isIdentifierChar(code[end]))
+            {
+                ++end;
+            }
+            auto token = code.substr(pos, end - pos);
+            pos = end;
+
+            auto underscore = token.find_last_of('_');
+            bool hasNumericSuffix = underscore != std::string::npos &&
+                                    underscore + 1 < token.size() &&
+                                    std::all_of(token.begin() + underscore + 1, token.end(), [](char c) {
+                                        return std::isdigit(static_cast<unsigned char>(c));
+                                    });
+            if (!hasNumericSuffix || _declaredFunctions.find(token) != _declaredFunctions.end())
+            {
+                result += token;
+                continue;
+            }
+
+            auto [it, inserted] = renamedTokens.try_emplace(token);
+            if (inserted)
+            {
+                auto stem = token.substr(0, underscore);
+                it->second = stem + "_$" + std::to_string(suffixCounters[stem]++);
+            }
+            result += it->second;
+        }
+
+        return result;
+    }
+
     EmitterContext::DefinedFunction
     CppEmitterContext::CreateFunctionImpl(FunctionDeclaration decl, DefinedFunction fn)
     {
@@ -431,16 +507,22 @@ namespace value
             throw InputException(InputExceptionErrors::invalidArgument, "Specified function is an intrinsic");
         }
 
-        if (auto it = _definedFunctions.find(decl); it != _definedFunctions.end())
         {
-            return it->second;
+            std::lock_guard lock{ _mutex };
+            if (auto it = _definedFunctions.find(decl); it != _definedFunctions.end())
+            {
+                return it->second;
+            }
         }
 
-        DeclareFunction(decl);
-
         const auto& argValues = decl.GetParameterTypes();
         const auto& fnName = decl.GetFunctionName();
 
+        // The name of the function whose definition ends up being called. This is usually
+        // this function's own name, but if an identical definition has already been emitted
+        // under a different name, calls are redirected there and this definition is dropped.
+        std::string calleeName = fnName;
+
         {
             FunctionScope scope(*this, fnName);
 
@@ -474,12 +556,31 @@ namespace value
 
             Out() << "} \n"
                   << std::endl;
+
+            std::lock_guard lock{ _mutex };
+            if (decl.IsPublic())
+            {
+                // Public functions are part of the module's interface and always keep
+                // their own definition; only internal helpers get deduplicated
+                DeclareFunction(decl);
+            }
+            else if (auto [memoIt, inserted] = _memoizedFunctionNames.try_emplace(CanonicalizeFunctionCode(scope.GetCode(), fnName), fnName); inserted)
+            {
+                DeclareFunction(decl);
+            }
+            else
+            {
+                // A definition identical up to generated names has already been emitted --
+                // drop this one and call the existing function instead
+                calleeName = memoIt->second;
+                scope.Discard();
+            }
         }
 
-        DefinedFunction returnFn = [this, decl](std::vector<Value> args) -> std::optional<Value> {
+        DefinedFunction returnFn = [this, decl, calleeName](std::vector<Value> args) -> std::optional<Value> {
             const auto& argValues = decl.GetParameterTypes();
             const auto& returnValue = decl.GetReturnType();
-            const auto& fnName = decl.GetFunctionName();
+            const auto& fnName = calleeName;
 
             if (!std::equal(args.begin(),
                             args.end(),
@@ -539,6 +640,7 @@ namespace value
             return fnReturnValue;
         };
 
+        std::lock_guard lock{ _mutex };
         _definedFunctions[decl] = returnFn;
 
         return returnFn;
@@ -552,6 +654,7 @@ namespace value
             return true;
         }
 
+        std::lock_guard lock{ _mutex };
         return _definedFunctions.find(decl) != _definedFunctions.end();
     }
 
@@ -1058,9 +1161,12 @@ namespace value
             return IntrinsicCall(func, args);
         }
 
-        if (auto it = _definedFunctions.find(func); it != _definedFunctions.end())
         {
-            return it->second(args);
+            std::lock_guard lock{ _mutex };
+            if (auto it = _definedFunctions.find(func); it != _definedFunctions.end())
+            {
+                return it->second(args);
+            }
         }
 
         return EmitExternalCall(func, args);
@@ -1450,6 +1556,11 @@ namespace value
         // no-op for now
     }
 
+    void CppEmitterContext::SetNonTemporalStoresImpl(bool)
+    {
+        // no portable way to express non-temporal stores in standard C++ -- treat as a no-op hint
+    }
+
     void CppEmitterContext::ParallelizeImpl(int numTasks, std::vector<Value> captured, std::function<void(Scalar, std::vector<Value>)> fn)
     {
         auto futuresName = UniqueName("futures");
@@ -273,6 +273,13 @@ namespace value
         PrefetchImpl(data, type, locality);
     }
 
+    void EmitterContext::NonTemporalStores(std::function<void()> fn)
+    {
+        SetNonTemporalStoresImpl(true);
+        fn();
+        SetNonTemporalStoresImpl(false);
+    }
+
     void EmitterContext::Parallelize(int numTasks, std::vector<Value> captured, std::function<void(Scalar, std::vector<Value>)> fn)
     {
         if (numTasks == 0) return;
@@ -518,6 +525,11 @@ namespace value
         GetContext().DebugPrint(message);
     }
 
+    void NonTemporalStores(std::function<void()> fn)
+    {
+        GetContext().NonTemporalStores(std::move(fn));
+    }
+
     void Parallelize(int numTasks, std::vector<Value> captured, std::function<void(Scalar, std::vector<Value>)> fn)
     {
         GetContext().Parallelize(numTasks, captured, fn);
@@ -799,6 +799,10 @@ namespace value
                                            layout.GetMemorySize(),
                                            (flags & AllocateFlags::ThreadLocal) == AllocateFlags::ThreadLocal);
 
+        // Uninitialized globals hold values that persist across invocations (sample buffers,
+        // recurrent hidden state), so register them as model state for stream sessions.
+        _emitter.RegisterModelStateVariable(global);
+
         auto dereferencedGlobal = _emitter.GetIREmitter().PointerOffset(global, _emitter.GetIREmitter().Literal(0));
 
         Emittable emittable{ dereferencedGlobal };
@@ -1650,6 +1654,11 @@ namespace value
         fnEmitter.Call(prefetchFn, { llvmData, llvmType, llvmLocality, llvmCacheType });
     }
 
+    void LLVMContext::SetNonTemporalStoresImpl(bool enabled)
+    {
+        GetFunctionEmitter().GetEmitter().SetNonTemporalStoreHint(enabled);
+    }
+
     void LLVMContext::ParallelizeImpl(int numTasks, std::vector<Value> captured, std::function<void(Scalar, std::vector<Value>)> fn)
     {
         auto& fnEmitter = GetFunctionEmitter();
@@ -0,0 +1,298 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LoopNestAutotuner.cpp (value)
+//  Authors:  Kern Handa, Mason Remy
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LoopNestAutotuner.h"
+#include "EmitterContext.h"
+#include "FunctionDeclaration.h"
+#include "LLVMContext.h"
+
+#include <emitters/include/IRExecutionEngine.h>
+#include <emitters/include/IRModuleEmitter.h>
+
+#include <utilities/include/Exception.h>
+#include <utilities/include/JsonArchiver.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <utility>
+
+namespace ell
+{
+namespace value
+{
+    namespace
+    {
+        // Returns every way of picking one element from each of the candidate lists.
+        // An empty set of lists yields a single empty pick, so unconstrained dimensions
+        // of the search space collapse to one candidate instead of zero.
+        std::vector<std::vector<int>> CartesianProduct(const std::vector<std::vector<int>>& candidateLists)
+        {
+            std::vector<std::vector<int>> result{ {} };
+            for (const auto& candidates : candidateLists)
+            {
+                if (candidates.empty())
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument,
+                                                    "Each tunable loop must have at least one candidate split size");
+                }
+
+                std::vector<std::vector<int>> expanded;
+                expanded.reserve(result.size() * candidates.size());
+                for (const auto& partial : result)
+                {
+                    for (auto candidate : candidates)
+                    {
+                        auto pick = partial;
+                        pick.push_back(candidate);
+                        expanded.push_back(std::move(pick));
+                    }
+                }
+                result = std::move(expanded);
+            }
+            return result;
+        }
+    } // namespace
+
+    //
+    // LoopNestSchedule
+    //
+
+    void LoopNestSchedule::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        archiver["splitSizes"] << splitSizes;
+        archiver["loopOrder"] << loopOrder;
+        archiver["cachingStrategy"] << cachingStrategy;
+    }
+
+    void LoopNestSchedule::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        archiver["splitSizes"] >> splitSizes;
+        archiver["loopOrder"] >> loopOrder;
+        archiver["cachingStrategy"] >> cachingStrategy;
+    }
+
+    //
+    // LoopNestAutotuner
+    //
+
+    LoopNestAutotuner::LoopNestAutotuner(std::string kernelName, utilities::MemoryShape shape, const emitters::CompilerOptions& compilerOptions) :
+        _kernelName(std::move(kernelName)),
+        _shape(std::move(shape)),
+        _compilerOptions(compilerOptions)
+    {
+    }
+
+    void LoopNestAutotuner::SetTimingRuns(int warmupRuns, int timingRuns)
+    {
+        if (warmupRuns < 0 || timingRuns < 1)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument,
+                                            "Need a non-negative number of warmup runs and at least one timing run");
+        }
+        _warmupRuns = warmupRuns;
+        _timingRuns = timingRuns;
+    }
+
+    void LoopNestAutotuner::SetCacheFilename(std::string filename)
+    {
+        _cacheFilename = std::move(filename);
+    }
+
+    std::string LoopNestAutotuner::GetCacheKey() const
+    {
+        std::string shapeString;
+        for (int dimension = 0; dimension < _shape.NumDimensions(); ++dimension)
+        {
+            if (dimension > 0)
+            {
+                shapeString += "x";
+            }
+            shapeString += std::to_string(_shape[dimension]);
+        }
+
+        auto triple = _compilerOptions.targetDevice.triple;
+        if (triple.empty())
+        {
+            triple = "host";
+        }
+        return _kernelName + "_" + shapeString + "_" + triple;
+    }
+
+    LoopNestTuningResult LoopNestAutotuner::Tune(const LoopNestSearchSpace& searchSpace, std::function<void(const LoopNestSchedule&)> emitKernel) const
+    {
+        if (!_cacheFilename.empty())
+        {
+            if (auto cached = LoadSchedule(_cacheFilename, GetCacheKey()))
+            {
+                LoopNestTuningResult result;
+                result.schedule = *cached;
+                result.fromCache = true;
+                return result;
+            }
+        }
+
+        auto candidates = EnumerateCandidates(searchSpace);
+
+        LoopNestTuningResult result;
+        auto bestTime = std::numeric_limits<double>::max();
+        int candidateIndex = 0;
+        for (const auto& candidate : candidates)
+        {
+            auto functionName = _kernelName + "_candidate" + std::to_string(candidateIndex);
+            auto time = TimeCandidate(functionName, candidate, emitKernel);
+            if (time < bestTime)
+            {
+                bestTime = time;
+                result.schedule = candidate;
+            }
+            ++candidateIndex;
+        }
+        result.timeInSeconds = bestTime;
+        result.candidatesTimed = static_cast<int>(candidates.size());
+
+        if (!_cacheFilename.empty())
+        {
+            SaveSchedule(_cacheFilename, GetCacheKey(), result.schedule);
+        }
+        return result;
+    }
+
+    std::vector<LoopNestSchedule> LoopNestAutotuner::EnumerateCandidates(const LoopNestSearchSpace& searchSpace) const
+    {
+        auto loopOrders = searchSpace.loopOrders;
+        if (loopOrders.empty())
+        {
+            loopOrders.push_back({}); // keep the declared order
+        }
+        auto cachingStrategies = searchSpace.cachingStrategies;
+        if (cachingStrategies.empty())
+        {
+            cachingStrategies.push_back(""); // no caching
+        }
+
+        std::vector<LoopNestSchedule> candidates;
+        for (const auto& splitSizes : CartesianProduct(searchSpace.splitSizes))
+        {
+            for (const auto& loopOrder : loopOrders)
+            {
+                for (const auto& cachingStrategy : cachingStrategies)
+                {
+                    LoopNestSchedule candidate;
+                    candidate.splitSizes = splitSizes;
+                    candidate.loopOrder = loopOrder;
+                    candidate.cachingStrategy = cachingStrategy;
+                    candidates.push_back(std::move(candidate));
+                }
+            }
+        }
+        return candidates;
+    }
+
+    double LoopNestAutotuner::TimeCandidate(const std::string& functionName, const LoopNestSchedule& schedule, const std::function<void(const LoopNestSchedule&)>& emitKernel) const
+    {
+        // Emit the candidate into a module of its own, so the candidates can't interfere
+        // with each other (or with whatever context the caller is running under)
+        emitters::IRModuleEmitter moduleEmitter(functionName + "_module", _compilerOptions);
+        ContextGuard<LLVMContext> guard(moduleEmitter);
+
+        auto functionDeclaration = DeclareFunction(functionName);
+        functionDeclaration.Define([&] { emitKernel(schedule); });
+
+        emitters::IRExecutionEngine engine(std::move(moduleEmitter), true);
+        auto functionAddress = engine.ResolveFunctionAddress(functionDeclaration.GetFunctionName());
+        auto kernel = reinterpret_cast<void (*)()>(functionAddress);
+
+        for (int run = 0; run < _warmupRuns; ++run)
+        {
+            kernel();
+        }
+
+        // Report the minimum over the timing runs --- it's the least noisy estimate of
+        // how fast this schedule can go on an otherwise-busy machine
+        auto bestTime = std::numeric_limits<double>::max();
+        for (int run = 0; run < _timingRuns; ++run)
+        {
+            auto start = std::chrono::steady_clock::now();
+            kernel();
+            auto end = std::chrono::steady_clock::now();
+            auto time = std::chrono::duration<double>(end - start).count();
+            bestTime = std::min(bestTime, time);
+        }
+        return bestTime;
+    }
+
+    std::optional<LoopNestSchedule> LoopNestAutotuner::LoadSchedule(const std::string& filename, const std::string& key)
+    {
+        std::ifstream stream(filename);
+        if (!stream.is_open())
+        {
+            return std::nullopt;
+        }
+
+        std::vector<std::string> keys;
+        std::vector<LoopNestSchedule> schedules;
+        utilities::SerializationContext context;
+        utilities::JsonUnarchiver unarchiver(stream, context);
+        unarchiver["keys"] >> keys;
+        unarchiver["schedules"] >> schedules;
+
+        for (size_t index = 0; index < keys.size() && index < schedules.size(); ++index)
+        {
+            if (keys[index] == key)
+            {
+                return schedules[index];
+            }
+        }
+        return std::nullopt;
+    }
+
+    void LoopNestAutotuner::SaveSchedule(const std::string& filename, const std::string& key, const LoopNestSchedule& schedule)
+    {
+        std::vector<std::string> keys;
+        std::vector<LoopNestSchedule> schedules;
+        {
+            std::ifstream stream(filename);
+            if (stream.is_open())
+            {
+                utilities::SerializationContext context;
+                utilities::JsonUnarchiver unarchiver(stream, context);
+                unarchiver["keys"] >> keys;
+                unarchiver["schedules"] >> schedules;
+            }
+        }
+
+        bool replaced = false;
+        for (size_t index = 0; index < keys.size() && index < schedules.size(); ++index)
+        {
+            if (keys[index] == key)
+            {
+                schedules[index] = schedule;
+                replaced = true;
+                break;
+            }
+        }
+        if (!replaced)
+        {
+            keys.push_back(key);
+            schedules.push_back(schedule);
+        }
+
+        std::ofstream stream(filename);
+        if (!stream.is_open())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument,
+                                            "Unable to open tuning cache file " + filename + " for writing");
+        }
+        utilities::JsonArchiver archiver(stream);
+        archiver["keys"] << keys;
+        archiver["schedules"] << schedules;
+    }
+} // namespace value
+} // namespace ell
@@ -129,6 +129,12 @@ namespace value
             _nest->Unroll(index);
         }
 
+        void Vectorize(Index index)
+        {
+            EnsureCreated();
+            _nest->Vectorize(index);
+        }
+
         void SetOrder(std::vector<Index> indices)
         {
             EnsureCreated();
@@ -146,6 +152,14 @@ namespace value
             return *_nest;
         }
 
+        void SetUnderlyingLoopNest(loopnests::LoopNest nest)
+        {
+            _nest = std::move(nest);
+
+            // keep the index ranges in sync, so kernels added later see the fused iteration space
+            _ranges = _nest->GetLoopIndexRanges();
+        }
+
     private:
         std::vector<std::pair<Value, ArgumentType>> _arguments;
         std::vector<loopnests::IndexRange> _ranges;
@@ -159,6 +173,19 @@ namespace value
         return LoopNest{}.Using(inputs, argType);
     }
 
+    LoopNest Fuse(const LoopNest& nest1, const LoopNest& nest2)
+    {
+        return Fuse(nest1, nest2, {}, {});
+    }
+
+    LoopNest Fuse(const LoopNest& nest1, const LoopNest& nest2, const std::vector<Index>& dependentIndices1, const std::vector<Index>& dependentIndices2)
+    {
+        LoopNest result;
+        result._impl->SetUnderlyingLoopNest(
+            loopnests::Fuse(nest1.GetUnderlyingLoopNest(), nest2.GetUnderlyingLoopNest(), dependentIndices1, dependentIndices2));
+        return result;
+    }
+
     //
     // LoopNest
     //
@@ -302,6 +329,20 @@ namespace value
         return outer;
     }
 
+    void Schedule::Vectorize(Index index)
+    {
+        _impl.get().Vectorize(index);
+    }
+
+    Index Schedule::Vectorize(Index index, int width)
+    {
+        // Unlike Unroll and Parallelize, mark the *inner* loop created by the split: it's the
+        // width-sized, stride-1 loop whose iterations become the lanes of the vector operations
+        auto outer = Split(index, width);
+        Vectorize(index);
+        return outer;
+    }
+
     void Schedule::Cache(std::unique_ptr<CachingProvider> provider)
     {
         provider->HandleCaching(_nest.get());
@@ -42,7 +42,10 @@ namespace value
             auto loopIndex = schedule.CurrentLoopIndex();
 
             bool isParallelized = loopNest.IsParallelized(loopIndex);
-            bool isUnrolled = loopNest.IsUnrolled(loopIndex);
+            // Vectorized indices are emitted fully unrolled: the iterations form a width-wide
+            // straight-line block of contiguous operations, which the SLP vectorizer packs into
+            // vector instructions (boundary ranges get their own, narrower, block)
+            bool isUnrolled = loopNest.IsUnrolled(loopIndex) || loopNest.IsVectorized(loopIndex);
             assert(!(isParallelized && isUnrolled) && "An index cannot be both unrolled and parallelized");
 
             const int startInt = r.start.Get<int>();
@@ -108,7 +111,10 @@ namespace value
             auto loopIndex = schedule.CurrentLoopIndex();
 
             bool isParallelized = loopNest.IsParallelized(loopIndex);
-            bool isUnrolled = loopNest.IsUnrolled(loopIndex);
+            // Vectorized indices are emitted fully unrolled: the iterations form a width-wide
+            // straight-line block of contiguous operations, which the SLP vectorizer packs into
+            // vector instructions (boundary ranges get their own, narrower, block)
+            bool isUnrolled = loopNest.IsUnrolled(loopIndex) || loopNest.IsVectorized(loopIndex);
             assert(!(isParallelized && isUnrolled) && "An index cannot be both unrolled and parallelized");
 
             const int startInt = r.start.Get<int>();
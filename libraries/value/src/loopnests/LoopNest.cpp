@@ -632,6 +632,20 @@ namespace value
             return result;
         }
 
+        void LoopNest::Vectorize(Index index)
+        {
+            _vectorizedIndices.push_back(index);
+        }
+
+        // Note: unlike Unroll and Parallelize, this marks the inner loop created by the split ---
+        // that's the width-sized, stride-1 loop whose iterations become the vector lanes
+        SplitIndex LoopNest::Vectorize(Index index, int width)
+        {
+            auto result = Split(index, width);
+            Vectorize(result.inner);
+            return result;
+        }
+
         void LoopNest::SetLoopOrder(const std::vector<Index>& order)
         {
             if (order.size() != _loopSequence.size())
@@ -728,6 +742,11 @@ namespace value
             return std::find(_unrolledIndices.begin(), _unrolledIndices.end(), index) != _unrolledIndices.end();
         }
 
+        bool LoopNest::IsVectorized(const Index& index) const
+        {
+            return std::find(_vectorizedIndices.begin(), _vectorizedIndices.end(), index) != _vectorizedIndices.end();
+        }
+
         const std::vector<RenameAction>& LoopNest::GetRenameActions() const
         {
             return _renameActions;
@@ -173,10 +173,6 @@ namespace value
 
             for (auto r : ranges)
             {
-#if 1
-                std::function<void(Scalar)> codegenFn = GetCodegenFnNew(r, state, schedule);
-                GenerateLoopRangeNew(r, state, schedule, codegenFn);
-#else
                 std::function<void(Scalar)> codegenFn = GetCodegenFnNew(r, state, schedule);
                 const int startInt = r.start.Get<int>();
                 const int stopInt = r.stop.Get<int>();
@@ -185,19 +181,21 @@ namespace value
 
                 if (numIterations == 0)
                 {
-                    // throw?
+                    continue;
                 }
                 else if (numIterations == 1)
                 {
-                    // TODO: set initial value of index variable (at least in loop-nest-printing case)
-                    // SetLoopIndexValue(loopIndex, r.start);
+                    // Peel single-iteration partitions (first/last fragments and end boundaries):
+                    // emit the body directly with a constant index instead of wrapping it in a
+                    // one-trip loop. The constant index lets the kernel predicates for this
+                    // partition fold at emit time (see GetCodegenFnNew), so the peeled code and
+                    // the remaining steady-state loops are free of predicate checks.
                     codegenFn(r.start);
                 }
                 else
                 {
                     GenerateLoopRangeNew(r, state, schedule, codegenFn);
                 }
-#endif
             }
 
             // set the loop index state to be "done"
@@ -367,7 +365,18 @@ namespace value
 
                 // Note: it's important that this code not be moved outside of the `codegenFn` lambda, otherwise Compute will incorrectly use old info for subsequent ranges
                 auto newState = state;
-                newState.loopIndices.insert_or_assign(loopIndex, LoopIndexSymbolTableEntry{ loopIndex, index, Range(startInt, stopInt, stepInt), LoopIndexState::inProgress });
+
+                // When the index is an emit-time constant (a peeled partition or an unrolled loop
+                // body), record just the iteration being emitted instead of the whole partition
+                // range. Predicates testing this index then simplify to compile-time constants,
+                // so no predicate checks get emitted into the code for this iteration.
+                Range loopIndexRange{ startInt, stopInt, stepInt };
+                if (index.GetValue().IsConstant())
+                {
+                    const int indexVal = index.Get<int>();
+                    loopIndexRange = { indexVal, std::min(indexVal + stepInt, stopInt), stepInt };
+                }
+                newState.loopIndices.insert_or_assign(loopIndex, LoopIndexSymbolTableEntry{ loopIndex, index, loopIndexRange, LoopIndexState::inProgress });
 
                 // define vars for all kernels
                 std::vector<ScheduledKernel> kernels;
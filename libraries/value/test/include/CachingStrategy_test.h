@@ -15,6 +15,9 @@ namespace value
     class Scalar;
 }
 
+// Register blocking tests
+value::Scalar RegisterBlockCache_ValidateOutput_Test1();
+
 // Simple Blas TCOPY tests
 value::Scalar BLASTCOPY_ValidateOutput_Test1();
 value::Scalar BLASTCOPY_ValidateOutput_Test2();
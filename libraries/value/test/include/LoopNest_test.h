@@ -69,6 +69,7 @@ value::Scalar LoopNest_Parallelized_test1();
 value::Scalar LoopNest_Parallelized_test2();
 
 value::Scalar LoopNest_Unrolled_test1();
+value::Scalar LoopNest_Unrolled_test2();
 
 value::Scalar LoopNest_DebugDump_test1();
 value::Scalar LoopNest_DebugDump_test2();
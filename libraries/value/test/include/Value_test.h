@@ -35,6 +35,7 @@ value::Scalar Parallelized_test3();
 value::Scalar Prefetch_test1();
 
 value::Scalar Prefetch_parallelized_test1();
+value::Scalar NonTemporalStores_test1();
 value::Scalar Fma_test1();
 value::Scalar Fma_test2();
 value::Scalar Fma_test3();
@@ -6168,4 +6168,53 @@ Scalar GeneralCachingStrategy_ProgressiveBLASNCopy_ValidateMemory_BoundaryCondit
     return smallBlockResult + largeBlockResult;
 }
 
+Scalar RegisterBlockCache_ValidateOutput_Test1()
+{
+    const int N = 8;
+    const int blockRows = 2;
+    const int blockColumns = 4;
+
+    auto A = MakeIncrementingMatrix<int>(N, N, "A");
+    auto B = MakeIncrementingMatrix<int>(N, N, "B");
+    auto C = MakeMatrix<int>(N, N, "C");
+    auto expectedC = MakeMatrix<int>(N, N, "expectedC");
+
+    For(expectedC, [&](Scalar row, Scalar column) {
+        ForRange(N, [&](Scalar inner) {
+            expectedC(row, column) += A(row, inner) * B(inner, column);
+        });
+    });
+
+    Index i("i"), j("j"), k("k");
+    auto nest = Using({ A, B }, ArgumentType::Input)
+                    .Using({ C }, ArgumentType::Output)
+                    .ForAll(i, 0, N)
+                    .ForAll(j, 0, N)
+                    .ForAll(k, 0, N)
+                    .Do([](Matrix A, Matrix B, Matrix C, Scalar i, Scalar j, Scalar k) {
+                        C(i, j) += A(i, k) * B(k, j);
+                    });
+
+    auto& schedule = nest.GetSchedule();
+
+    auto iBlock = schedule.Split(i, blockRows);
+    auto jBlock = schedule.Split(j, blockColumns);
+
+    schedule.SetOrder({ iBlock, jBlock, k, i, j });
+
+    // Accumulate each (blockRows x blockColumns) tile of C in a register block that is copied
+    // in before the tile's k loop and copied back out after it
+    schedule.Cache<RegisterBlockCache>(C,
+                                       { iBlock, jBlock },
+                                       { blockRows, blockColumns },
+                                       { iBlock, jBlock });
+
+#if 0 // DEBUGGING
+    DebugDump(nest.GetUnderlyingLoopNest());
+#endif
+    nest.Run();
+
+    return VerifySame(C, expectedC);
+}
+
 } // namespace ell
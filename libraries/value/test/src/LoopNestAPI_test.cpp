@@ -265,6 +265,72 @@ Scalar LoopNest_api_Unrolled_test1()
     return matrix(2, 3) - 19; // will return 0 if calculation is correct
 }
 
+Scalar LoopNest_api_Vectorized_test1()
+{
+    auto matrix = MakeMatrix<int>(4, 6);
+    Index i("i"), j("j");
+
+    auto nest = Using({ matrix }, ArgumentType::Output)
+                    .ForAll(i, 0, 4)
+                    .ForAll(j, 0, 6)
+                    .Do(loopnest_kernel);
+
+    auto& schedule = nest.GetSchedule();
+
+    schedule.Vectorize(j, 4); // 6 isn't a multiple of 4, so a scalar boundary loop gets emitted too
+
+    nest.Run();
+
+    return matrix(2, 3) - 19; // will return 0 if calculation is correct
+}
+
+Scalar LoopNest_api_Fuse_test1()
+{
+    const int N = 4;
+    auto A = MakeIncrementingMatrix<int>(N, N, "A");
+    auto B = MakeIncrementingMatrix<int>(N, N, "B");
+    auto C = MakeMatrix<int>(N, N, "C");
+    auto D = MakeMatrix<int>(N, N, "D");
+
+    auto expected = MakeMatrix<int>(N, N, "expected");
+    ForRange(N, [&](Scalar i) {
+        ForRange(N, [&](Scalar j) {
+            ForRange(N, [&](Scalar k) {
+                expected(i, j) += A(i, k) * B(k, j);
+            });
+            expected(i, j) += 1;
+        });
+    });
+
+    Index i("i"), j("j"), k("k");
+    auto matmul = Using({ A, B }, ArgumentType::Input)
+                      .Using({ C }, ArgumentType::Output)
+                      .ForAll(i, 0, N)
+                      .ForAll(j, 0, N)
+                      .ForAll(k, 0, N)
+                      .Do([](Matrix A, Matrix B, Matrix C, Scalar i, Scalar j, Scalar k) {
+                          C(i, j) += A(i, k) * B(k, j);
+                      });
+
+    auto addOne = Using({ C }, ArgumentType::Input)
+                      .Using({ D }, ArgumentType::Output)
+                      .ForAll(i, 0, N)
+                      .ForAll(j, 0, N)
+                      .Do([](Matrix C, Matrix D, Scalar i, Scalar j) {
+                          D(i, j) = C(i, j) + 1;
+                      });
+
+    // The consumer kernel gets an implicit Last(k) dependency, since k only appears in the
+    // producer. Ordering the j loop innermost puts the consumer inside the final k iteration,
+    // right after the reduction for each C(i, j) finishes
+    auto fused = Fuse(matmul, addOne);
+    fused.GetSchedule().SetOrder({ i, k, j });
+
+    fused.Run();
+
+    return VerifySame(D, expected);
+}
+
 Scalar LoopNest_api_SetOrder_test1()
 {
     auto matrix = MakeMatrix<int>(4, 5);
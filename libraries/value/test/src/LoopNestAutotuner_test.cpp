@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LoopNestAutotuner_test.cpp (value)
+//  Authors:  Kern Handa, Mason Remy
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LoopNestAutotuner_test.h"
+#include "LoopNest_kernels.h"
+
+#include <value/include/LoopNestAutotuner.h>
+#include <value/include/LoopNests.h>
+#include <value/include/Matrix.h>
+#include <value/include/Value.h>
+
+#include <testing/include/testing.h>
+
+#include <cstdio>
+#include <string>
+
+using namespace ell::utilities;
+using namespace ell::value;
+
+namespace ell
+{
+void LoopNestAutotuner_test1()
+{
+    const int N = 32;
+    auto emitKernel = [=](const LoopNestSchedule& schedule) {
+        auto matrix = MakeMatrix<int>(N, N);
+        Index i("i"), j("j");
+        auto nest = Using({ matrix }, ArgumentType::Output)
+                        .ForAll(i, 0, N)
+                        .ForAll(j, 0, N)
+                        .Do(loopnest_kernel);
+        if (!schedule.splitSizes.empty() && schedule.splitSizes[0] >= 2)
+        {
+            nest.GetSchedule().Split(i, schedule.splitSizes[0]);
+        }
+        nest.Run();
+    };
+
+    LoopNestAutotuner autotuner("LoopNestAutotunerTest", MemoryShape{ N, N });
+    autotuner.SetTimingRuns(1, 3);
+
+    LoopNestSearchSpace searchSpace;
+    searchSpace.splitSizes = { { 2, 4 } };
+    auto result = autotuner.Tune(searchSpace, emitKernel);
+
+    testing::ProcessTest("Testing autotuner candidate count", result.candidatesTimed == 2);
+    testing::ProcessTest("Testing autotuner schedule comes from the search space",
+                         result.schedule.splitSizes.size() == 1 && (result.schedule.splitSizes[0] == 2 || result.schedule.splitSizes[0] == 4));
+    testing::ProcessTest("Testing autotuner ran a search", !result.fromCache && result.timeInSeconds >= 0);
+
+    // Round-trip the winner through the tuning cache
+    const std::string cacheFilename = "autotunerTestCache.json";
+    LoopNestAutotuner::SaveSchedule(cacheFilename, autotuner.GetCacheKey(), result.schedule);
+    auto loaded = LoopNestAutotuner::LoadSchedule(cacheFilename, autotuner.GetCacheKey());
+    testing::ProcessTest("Testing tuning cache round trip",
+                         loaded.has_value() && loaded->splitSizes == result.schedule.splitSizes &&
+                             loaded->loopOrder == result.schedule.loopOrder &&
+                             loaded->cachingStrategy == result.schedule.cachingStrategy);
+    testing::ProcessTest("Testing tuning cache miss", !LoopNestAutotuner::LoadSchedule(cacheFilename, "someOtherKernel_32x32_host").has_value());
+
+    // A second tuning run should hit the cache instead of searching again
+    autotuner.SetCacheFilename(cacheFilename);
+    auto cachedResult = autotuner.Tune(searchSpace, emitKernel);
+    testing::ProcessTest("Testing tuning cache hit",
+                         cachedResult.fromCache && cachedResult.candidatesTimed == 0 &&
+                             cachedResult.schedule.splitSizes == result.schedule.splitSizes);
+
+    std::remove(cacheFilename.c_str());
+}
+} // namespace ell
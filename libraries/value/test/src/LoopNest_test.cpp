@@ -2383,6 +2383,47 @@ Scalar LoopNest_Unrolled_test1()
     return matrix(2, 3) - 19; // will return 0 if calculation is correct
 }
 
+Scalar LoopNest_Unrolled_test2()
+{
+    // Unrolled loop with peeled first/last kernels: the predicates should fold away at
+    // emit time, leaving straight-line code
+    const int N = 8;
+    auto input = MakeIncrementingVector<int>(N, "input"); // 0, 1, ..., 7
+    auto result = MakeVector<int>(1);
+    Index k("k");
+
+    LoopNest loop({ { k, { 0, N } } });
+
+    auto initKernel = Kernel("init")
+                          .Inputs(result.GetValue())
+                          .Indices(k)
+                          .Define([](Vector result, Scalar k) {
+                              result(0) = 0;
+                          });
+    auto bodyKernel = Kernel("body")
+                          .Inputs(input.GetValue(), result.GetValue())
+                          .Indices(k)
+                          .Define([](Vector input, Vector result, Scalar k) {
+                              result(0) += input(k);
+                          });
+    auto finalKernel = Kernel("final")
+                           .Inputs(result.GetValue())
+                           .Indices(k)
+                           .Define([](Vector result, Scalar k) {
+                               result(0) *= 2;
+                           });
+
+    loop.AddKernel(initKernel, { First(k) });
+    loop.AddKernel(bodyKernel, LoopNest::ConstraintType::predicate);
+    loop.AddKernel(finalKernel, { Last(k) });
+    loop.Unroll(k);
+
+    CodeGenerator generator;
+    generator.Run(loop);
+
+    return result(0) - 2 * (N * (N - 1) / 2); // will return 0 if calculation is correct
+}
+
 Scalar LoopNest_DebugDump_test1()
 {
     auto matrix = MakeMatrix<int>(4, 5);
@@ -807,6 +807,31 @@ Scalar Prefetch_parallelized_test1()
     return ok;
 }
 
+// Like prefetches, the non-temporal store hint has no effect on the behavior of the program, only
+// on its performance characteristics, so this test just makes sure that the code compiles/runs and
+// that stores emitted under the hint (and stores after it) behave normally
+Scalar NonTemporalStores_test1()
+{
+    constexpr int VectorSize = 16;
+    auto v = MakeVector<int>(VectorSize);
+
+    NonTemporalStores([&] {
+        ForRange(VectorSize, [&](Scalar i) {
+            v[i] = i * 2;
+        });
+    });
+
+    // prefetch a cache line ahead, for good measure
+    Prefetch(v, Scalar{ 8 }, PrefetchType::Read, PrefetchLocality::None);
+
+    Scalar ok = Allocate<int>(ScalarLayout);
+    ForRange(VectorSize, [&](Scalar i) {
+        If(v[i] != i * 2, [&] { ok = 1; });
+    });
+
+    return ok;
+}
+
 Scalar Fma_test1()
 {
     Scalar ok = Allocate<int>(ScalarLayout);
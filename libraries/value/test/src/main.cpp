@@ -9,6 +9,7 @@
 #include "CachingStrategy_test.h"
 #include "Functions_test.h"
 #include "LoopNestAPI_test.h"
+#include "LoopNestAutotuner_test.h"
 #include "LoopNest_convolution_test.h"
 #include "LoopNest_test.h"
 #include "Matrix_test.h"
@@ -415,6 +416,7 @@ int main()
         ADD_TEST_FUNCTION(RefMatrixReferenceTest);
 
         ADD_TEST_FUNCTION(Prefetch_parallelized_test1);
+        ADD_TEST_FUNCTION(NonTemporalStores_test1);
         ADD_TEST_FUNCTION(Fma_test1);
         ADD_TEST_FUNCTION(Fma_test2);
         ADD_TEST_FUNCTION(Fma_test3);
@@ -475,6 +477,7 @@ int main()
         ADD_TEST_FUNCTION(LoopNest_Parallelized_test2);
 
         ADD_TEST_FUNCTION(LoopNest_Unrolled_test1);
+        ADD_TEST_FUNCTION(LoopNest_Unrolled_test2);
 
         ADD_TEST_FUNCTION(LoopNest_DebugDump_test1);
         ADD_TEST_FUNCTION(LoopNest_DebugDump_test2);
@@ -489,6 +492,8 @@ int main()
         ADD_TEST_FUNCTION(LoopNest_api_Parallelized_test1);
         ADD_TEST_FUNCTION(LoopNest_api_Parallelized_test2);
         ADD_TEST_FUNCTION(LoopNest_api_Unrolled_test1);
+        ADD_TEST_FUNCTION(LoopNest_api_Vectorized_test1);
+        ADD_TEST_FUNCTION(LoopNest_api_Fuse_test1);
         ADD_TEST_FUNCTION(LoopNest_api_SetOrder_test1);
         // ADD_TEST_FUNCTION(LoopNest_api_CachedMatrix_test1); // Fails
         ADD_TEST_FUNCTION(GotoBLASGemmWithRefDeref);
@@ -510,6 +515,8 @@ int main()
         ADD_TEST_FUNCTION(SplitLargerThanSizeBoundaryTest);
         ADD_TEST_FUNCTION(TwoSplitsLargerThanSizeBoundaryTest);
 
+        ADD_TEST_FUNCTION(RegisterBlockCache_ValidateOutput_Test1);
+
         ADD_TEST_FUNCTION(BLASTCOPY_ValidateOutput_Test1);
         ADD_TEST_FUNCTION(BLASTCOPY_ValidateOutput_Test2);
 
@@ -660,6 +667,16 @@ int main()
             RunTest(name, fn);
         }
 
+        // The autotuner creates its own contexts and JIT engines, so it doesn't go through RunTest
+        try
+        {
+            LoopNestAutotuner_test1();
+        }
+        catch (const std::exception& e)
+        {
+            testing::ProcessTest(std::string{ "LoopNestAutotuner_test1 failed with exception, " } + e.what(), false);
+        }
+
 #undef ADD_TEST_FUNCTION
     }
     catch (const std::exception& exception)
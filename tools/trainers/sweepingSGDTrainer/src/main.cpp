@@ -35,9 +35,11 @@
 
 #include <nodes/include/LinearPredictorNode.h>
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <thread>
 
 using namespace ell;
 
@@ -104,8 +106,9 @@ int main(int argc, char* argv[])
             evaluatingTrainers.push_back(trainers::MakeEvaluatingTrainer(std::move(SGDTrainer), evaluators.back()));
         }
 
-        // create meta trainer
-        auto trainer = trainers::MakeSweepingTrainer(std::move(evaluatingTrainers));
+        // create meta trainer; the sweep points are independent, so train them concurrently
+        size_t numThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        auto trainer = trainers::MakeSweepingTrainer(std::move(evaluatingTrainers), numThreads);
 
         // train
         if (trainerArguments.verbose) std::cout << "Training ..." << std::endl;
@@ -22,6 +22,9 @@ struct ApplyArguments
 
     /// <summary> Instead of raw output, report a summary. </summary>
     bool summarize = false;
+
+    /// <summary> The number of worker threads to score with (1 means single-threaded streaming). </summary>
+    int numThreads = 1;
 };
 
 /// <summary> Parsed command line arguments for the apply executable. </summary>
@@ -25,6 +25,13 @@ void ParsedApplyArguments::AddArgs(utilities::CommandLineParser& parser)
         "s",
         "Aggregate and summarize map output.",
         false);
+
+    parser.AddOption(
+        numThreads,
+        "numThreads",
+        "th",
+        "The number of worker threads to score with. 1 streams the dataset on a single thread; other values preload the dataset and score it in parallel, with 0 meaning one thread per hardware core. Not used in summarization mode.",
+        1);
 }
 
 utilities::CommandLineParseResult ParsedApplyArguments::PostProcess(const utilities::CommandLineParser& parser)
@@ -12,6 +12,7 @@
 #include <utilities/include/Exception.h>
 #include <utilities/include/Files.h>
 #include <utilities/include/OutputStreamImpostor.h>
+#include <utilities/include/TaskPool.h>
 
 #include <data/include/DataVector.h>
 #include <data/include/DataVectorOperations.h>
@@ -30,9 +31,11 @@
 #include <model/include/Map.h>
 #include <model/include/OutputNode.h>
 
+#include <future>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace ell;
 
@@ -60,9 +63,8 @@ int main(int argc, char* argv[])
         // load map
         auto map = common::LoadMap(mapLoadArguments);
 
-        // get data iterator
+        // open data stream
         auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto exampleIterator = common::GetAutoSupervisedExampleIterator(stream);
 
         // get output stream
         auto& outputStream = dataSaveArguments.outputDataStream;
@@ -70,6 +72,7 @@ int main(int argc, char* argv[])
         // output summarization mode
         if (applyArguments.summarize)
         {
+            auto exampleIterator = common::GetAutoSupervisedExampleIterator(stream);
             model::Map map2;
             if (applyArguments.inputMapFilename2 != "")
             {
@@ -111,9 +114,55 @@ int main(int argc, char* argv[])
             outputStream << "std:\t" << v << '\n';
         }
 
+        // batch scoring mode: preload the dataset and score it on worker threads
+        else if (applyArguments.numThreads != 1)
+        {
+            auto dataset = common::GetDataset(stream);
+            auto numExamples = dataset.NumExamples();
+            auto results = std::vector<data::FloatDataVector>(numExamples);
+
+            // Pin the workers to cores: they're the only work this process does, and pinning
+            // avoids migration-induced cache misses on long scoring runs
+            utilities::TaskPoolOptions poolOptions;
+            poolOptions.numThreads = applyArguments.numThreads;
+            poolOptions.pinThreadsToCores = true;
+            utilities::TaskPool pool(poolOptions);
+
+            // One contiguous chunk of rows per worker; each worker owns a copy of the map,
+            // since map state is mutated during Compute
+            const auto numChunks = pool.NumThreads();
+            std::vector<std::future<void>> futures;
+            futures.reserve(numChunks);
+            for (size_t chunk = 0; chunk < numChunks; ++chunk)
+            {
+                auto begin = numExamples * chunk / numChunks;
+                auto end = numExamples * (chunk + 1) / numChunks;
+                futures.push_back(pool.Submit([&map, &dataset, &results, begin, end]() {
+                    auto workerMap = map;
+                    for (size_t index = begin; index < end; ++index)
+                    {
+                        results[index] = workerMap.Compute<data::FloatDataVector>(dataset.GetExample(index).GetDataVector());
+                    }
+                }));
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+
+            // write the mapped dataset in input order
+            for (size_t index = 0; index < numExamples; ++index)
+            {
+                auto mappedExample = data::DenseSupervisedExample(std::move(results[index]), dataset.GetExample(index).GetMetadata());
+                mappedExample.Print(outputStream);
+                outputStream << '\n';
+            }
+        }
+
         // output new dataset mode
         else
         {
+            auto exampleIterator = common::GetAutoSupervisedExampleIterator(stream);
             while (exampleIterator.IsValid())
             {
                 auto example = exampleIterator.Get();
@@ -35,6 +35,8 @@ struct CompileArguments
     bool outputCompiledMap = false;
     std::string outputDirectory;
     std::string outputFilenameBase;
+    std::string cacheDirectory;
+    int parallelCodegenTasks = 0;
     bool verbose = false;
 
     // model-generation options
@@ -91,6 +91,20 @@ void ParsedCompileArguments::AddArgs(utilities::CommandLineParser& parser)
         "Base filename for compiled model files (if none specified, use the input model filename)",
         "");
 
+    parser.AddOption(
+        parallelCodegenTasks,
+        "parallelCodegenTasks",
+        "pct",
+        "Split the model module into this many per-function partitions and run LLVM codegen for them in parallel, writing one object/assembly file per partition for the linker to combine (0: emit a single file serially)",
+        0);
+
+    parser.AddOption(
+        cacheDirectory,
+        "cacheDirectory",
+        "cd",
+        "Directory used to cache compiled artifacts, keyed by the map contents and the compilation options; when the same map is compiled again with the same options, the cached files are copied instead of recompiling",
+        "");
+
     parser.AddDocumentationString("");
     parser.AddDocumentationString("Misc options");
     parser.AddOption(
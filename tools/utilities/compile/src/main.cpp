@@ -24,13 +24,17 @@
 
 #include <utilities/include/CommandLineParser.h>
 #include <utilities/include/Exception.h>
+#include <utilities/include/Files.h>
+#include <utilities/include/Hash.h>
 #include <utilities/include/Logger.h>
 #include <utilities/include/MillisecondTimer.h>
 
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace ell;
 using namespace utilities::logging;
@@ -93,7 +97,107 @@ std::string GetObjExtension(model::IRCompiledMap& map)
     return ".o";
 }
 
-void ProduceMapOutput(ParsedCompileArguments& compileArguments, common::ParsedMapCompilerArguments& mapCompilerArguments, common::MapLoadArguments& mapLoadArguments, model::Map& map)
+// Returns the machine code files written for the given extension: a single file normally, or one
+// file per partition when parallel codegen is enabled
+std::vector<std::string> GetMachineCodeFilenames(const CompileArguments& compileArguments, const std::string& baseFilename, const std::string& extension)
+{
+    std::vector<std::string> filenames;
+    if (compileArguments.parallelCodegenTasks > 1)
+    {
+        for (int index = 0; index < compileArguments.parallelCodegenTasks; ++index)
+        {
+            filenames.push_back(baseFilename + "." + std::to_string(index) + extension);
+        }
+    }
+    else
+    {
+        filenames.push_back(baseFilename + extension);
+    }
+    return filenames;
+}
+
+// Returns the files ProduceMapOutput writes for the given set of output flags
+std::vector<std::string> GetOutputFilenames(const CompileArguments& compileArguments, const std::string& baseFilename)
+{
+    std::vector<std::string> filenames;
+    if (compileArguments.outputMapWithOptions)
+    {
+        filenames.push_back(baseFilename + "_options.ell");
+    }
+    if (compileArguments.outputRefinedMap)
+    {
+        filenames.push_back(baseFilename + "_refined.ell");
+    }
+    if (compileArguments.outputCompiledMap)
+    {
+        filenames.push_back(baseFilename + "_compiled.ell");
+    }
+    if (compileArguments.outputHeader)
+    {
+        filenames.push_back(baseFilename + ".h");
+    }
+    if (compileArguments.outputIr)
+    {
+        filenames.push_back(baseFilename + ".ll");
+    }
+    if (compileArguments.outputBitcode)
+    {
+        filenames.push_back(baseFilename + ".bc");
+    }
+    if (compileArguments.outputAssembly)
+    {
+        auto assemblyFilenames = GetMachineCodeFilenames(compileArguments, baseFilename, ".s");
+        filenames.insert(filenames.end(), assemblyFilenames.begin(), assemblyFilenames.end());
+    }
+    if (compileArguments.outputObjectCode)
+    {
+        auto objectFilenames = GetMachineCodeFilenames(compileArguments, baseFilename, ".o");
+        filenames.insert(filenames.end(), objectFilenames.begin(), objectFilenames.end());
+    }
+    if (compileArguments.outputSwigInterface)
+    {
+        filenames.push_back(baseFilename + ".i.h");
+        filenames.push_back(baseFilename + ".i");
+    }
+    return filenames;
+}
+
+// Computes the cache key for a compilation: a hash of the map's contents combined with the
+// command-line arguments that affect the generated code. Options that only determine where
+// files end up (or how chatty we are) are left out, so compiling the same map to a different
+// directory still hits the cache.
+std::string GetCacheKey(const model::Map& map, int argc, char* argv[])
+{
+    size_t seed = 0;
+    utilities::HashCombine(seed, map.ComputeHash());
+    for (int index = 1; index < argc; ++index)
+    {
+        std::string argument = argv[index];
+        if (argument == "--cacheDirectory" || argument == "-cd" || argument == "--outputDirectory" || argument == "-od")
+        {
+            ++index; // skip the option's value as well
+            continue;
+        }
+        if (argument == "--verbose" || argument == "-v")
+        {
+            continue;
+        }
+        utilities::HashCombine(seed, argument);
+    }
+
+    std::stringstream keyStream;
+    keyStream << std::hex << std::setw(2 * sizeof(size_t)) << std::setfill('0') << seed;
+    return keyStream.str();
+}
+
+void CopyBinaryFile(const std::string& fromFilename, const std::string& toFilename)
+{
+    auto inStream = utilities::OpenBinaryIfstream(fromFilename);
+    auto outStream = utilities::OpenBinaryOfstream(toFilename);
+    outStream << inStream.rdbuf();
+}
+
+void ProduceMapOutput(ParsedCompileArguments& compileArguments, common::ParsedMapCompilerArguments& mapCompilerArguments, common::MapLoadArguments& mapLoadArguments, model::Map& map, const std::string& cacheKey)
 {
     std::stringstream timingOutput;
 
@@ -111,6 +215,40 @@ void ProduceMapOutput(ParsedCompileArguments& compileArguments, common::ParsedMa
         baseFilename = utilities::JoinPaths(outputDirectory, utilities::GetFileName(baseFilename));
     }
 
+    auto outputFilenames = GetOutputFilenames(compileArguments, baseFilename);
+    std::string cacheEntryDirectory;
+    if (!cacheKey.empty())
+    {
+        cacheEntryDirectory = utilities::JoinPaths(compileArguments.cacheDirectory, cacheKey);
+
+        // if every requested output is already in the cache entry, copy it out and skip compilation
+        bool allCached = !outputFilenames.empty();
+        for (const auto& outputFilename : outputFilenames)
+        {
+            if (!utilities::IsFileReadable(utilities::JoinPaths(cacheEntryDirectory, utilities::GetFileName(outputFilename))))
+            {
+                allCached = false;
+                break;
+            }
+        }
+
+        if (allCached)
+        {
+            TimingOutputCollector timer(timingOutput, "Time to copy cached output files", compileArguments.verbose);
+            for (const auto& outputFilename : outputFilenames)
+            {
+                CopyBinaryFile(utilities::JoinPaths(cacheEntryDirectory, utilities::GetFileName(outputFilename)), outputFilename);
+            }
+            timer.Stop();
+
+            if (compileArguments.verbose)
+            {
+                std::cout << timingOutput.str();
+            }
+            return;
+        }
+    }
+
     model::MapCompilerOptions settings = mapCompilerArguments.GetMapCompilerOptions(baseFilename);
     settings.compilerSettings.modelFile = ell::utilities::GetFileName(inputFilename);
 
@@ -138,6 +276,13 @@ void ProduceMapOutput(ParsedCompileArguments& compileArguments, common::ParsedMa
     auto optimizerOptions = mapCompilerArguments.GetModelOptimizerOptions();
 
     model::IRMapCompiler compiler(settings, optimizerOptions);
+
+    // Apply measured per-layer convolution choices, if a method map was given
+    for (const auto& entry : mapCompilerArguments.GetConvolutionMethodMap())
+    {
+        compiler.SetNodeOptimizerOptions(entry.first, entry.second);
+    }
+
     TimingOutputCollector timer(timingOutput, "Time to compile map", compileArguments.verbose);
 
     auto compiledMap = compiler.Compile(map);
@@ -168,12 +313,26 @@ void ProduceMapOutput(ParsedCompileArguments& compileArguments, common::ParsedMa
         if (compileArguments.outputAssembly)
         {
             TimingOutputCollector timer(timingOutput, "Time to save assembly code", compileArguments.verbose);
-            compiledMap.WriteCode(baseFilename + ".s", emitters::ModuleOutputFormat::assembly);
+            if (compileArguments.parallelCodegenTasks > 1)
+            {
+                compiledMap.WriteCodeParallel(baseFilename, emitters::ModuleOutputFormat::assembly, compileArguments.parallelCodegenTasks);
+            }
+            else
+            {
+                compiledMap.WriteCode(baseFilename + ".s", emitters::ModuleOutputFormat::assembly);
+            }
         }
         if (compileArguments.outputObjectCode)
         {
             TimingOutputCollector timer(timingOutput, "Time to save object code", compileArguments.verbose);
-            compiledMap.WriteCode(baseFilename + GetObjExtension(compiledMap), emitters::ModuleOutputFormat::objectCode);
+            if (compileArguments.parallelCodegenTasks > 1)
+            {
+                compiledMap.WriteCodeParallel(baseFilename, emitters::ModuleOutputFormat::objectCode, compileArguments.parallelCodegenTasks);
+            }
+            else
+            {
+                compiledMap.WriteCode(baseFilename + GetObjExtension(compiledMap), emitters::ModuleOutputFormat::objectCode);
+            }
         }
     }
     if (compileArguments.outputSwigInterface)
@@ -183,6 +342,21 @@ void ProduceMapOutput(ParsedCompileArguments& compileArguments, common::ParsedMa
         compiledMap.WriteCode(baseFilename + ".i", emitters::ModuleOutputFormat::swigInterface);
     }
 
+    if (!cacheEntryDirectory.empty())
+    {
+        TimingOutputCollector timer(timingOutput, "Time to populate cache entry", compileArguments.verbose);
+        utilities::EnsureDirectoryExists(compileArguments.cacheDirectory);
+        utilities::EnsureDirectoryExists(cacheEntryDirectory);
+        for (const auto& outputFilename : outputFilenames)
+        {
+            if (utilities::IsFileReadable(outputFilename))
+            {
+                CopyBinaryFile(outputFilename, utilities::JoinPaths(cacheEntryDirectory, utilities::GetFileName(outputFilename)));
+            }
+        }
+        timer.Stop();
+    }
+
     if (compileArguments.verbose)
     {
         std::cout << timingOutput.str();
@@ -238,7 +412,14 @@ int main(int argc, char* argv[])
         TimingOutputCollector timer(timingOutput, "Time to load map", compileArguments.verbose);
         auto map = common::LoadMap(mapLoadArguments);
         timer.Stop();
-        ProduceMapOutput(compileArguments, mapCompilerArguments, mapLoadArguments, map);
+
+        std::string cacheKey;
+        if (!compileArguments.cacheDirectory.empty())
+        {
+            TimingOutputCollector timer(timingOutput, "Time to hash map", compileArguments.verbose);
+            cacheKey = GetCacheKey(map, argc, argv);
+        }
+        ProduceMapOutput(compileArguments, mapCompilerArguments, mapLoadArguments, map, cacheKey);
 
         if (compileArguments.verbose)
         {
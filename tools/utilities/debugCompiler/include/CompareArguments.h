@@ -29,6 +29,10 @@ struct CompareArguments
     bool writeReport = true;
     bool writeGraph = true;
     bool writePrediction = true;
+
+    // comparison options
+    double sampleRatio = 1;
+    bool parallel = true;
 };
 
 /// <summary> Arguments for parsed print. </summary>
@@ -38,7 +38,9 @@ public:
     /// <summary> Constructor </summary>
     ///
     /// <param name="outputDirectory"> The directory the output files will be written to. </param>
-    ModelComparison(std::string outputDirectory);
+    /// <param name="sampleRatio"> The fraction of each layer's elements to compare (1 = compare every element). </param>
+    /// <param name="parallel"> Indicates whether to run the reference model and the per-layer statistics on worker threads. </param>
+    ModelComparison(std::string outputDirectory, double sampleRatio = 1, bool parallel = true);
 
     /// <summary> Compares the "reference" output vs. compiled otuput of a map. </summary>
     ///
@@ -99,6 +101,13 @@ private:
         std::vector<int> offset;
         std::vector<float> referenceData;
         std::vector<float> compiledData;
+
+        // comparison results, filled in by ComputeLayerStatistics
+        VectorStatistics referenceStats;
+        VectorStatistics compiledStats;
+        VectorStatistics diffStats;
+        float absDiffSum = 0;
+        bool hasStats = false;
     };
 
     void AddDebugOutputNode(model::ModelTransformer& transformer, const model::Node& node);
@@ -108,8 +117,9 @@ private:
     void SetUpReferenceMap(model::Map& map);
     void CreateGraph(const model::Model& model);
     void AddStyles();
+    void ComputeLayerStatistics(LayerCaptureData& layerData);
     void WriteModelInfo(std::ostream& outputStream, const std::vector<float>& reference, const std::vector<float>& compiled, bool writePrediction);
-    void WriteNodeRow(std::ostream& outputStream, std::string id, std::string name, const std::vector<float>& reference, const std::vector<float>& compiled, const LayerCaptureData& layerData);
+    void WriteNodeRow(std::ostream& outputStream, std::string id, std::string name, const LayerCaptureData& layerData);
     void WriteNodeDetail(std::ostream& outputStream, const model::Node* node);
     void WriteStatsRow(std::ostream& outputStream, const VectorStatistics& refStats, const VectorStatistics& compiledStats, const VectorStatistics& diffStats, float sumAbsDiff);
     template <typename ValueType>
@@ -123,7 +133,8 @@ private:
     std::vector<float> _outputReference;
     std::vector<float> _outputCompiled;
     std::string _outputDirectory;
-    bool _runningCompiled;
+    double _sampleRatio;
+    bool _parallel;
     std::vector<LayerCaptureData> _layerOutputData;
     size_t _nextIndex;
     double _minError;
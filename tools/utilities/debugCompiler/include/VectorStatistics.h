@@ -87,6 +87,12 @@ std::vector<ValueType> Abs(const std::vector<ValueType>& vec);
 /// <summary> Returns tensor with each element converted to the absolute value of the original.</summary>
 template <typename TensorType>
 ell::math::ChannelColumnRowTensor<typename TensorType::TensorElementType> Abs(const TensorType& tensor);
+
+/// <summary> Returns a deterministic strided sample of roughly ratio * vec.size() elements of vec.
+/// A ratio of 1 (or more) returns the full vector. The same stride is used on every call with the
+/// same arguments, so samples from two vectors of the same length stay element-aligned.</summary>
+template <typename ValueType>
+std::vector<ValueType> Sample(const std::vector<ValueType>& vec, double ratio);
 } // namespace ell
 
 #pragma region implementation
@@ -236,6 +242,25 @@ ell::math::ChannelColumnRowTensor<typename TensorType::TensorElementType> Abs(co
     result.Transform([](auto x) { return std::abs(x); });
     return result;
 }
+
+template <typename ValueType>
+std::vector<ValueType> Sample(const std::vector<ValueType>& vec, double ratio)
+{
+    if (ratio >= 1 || vec.empty())
+    {
+        return vec;
+    }
+
+    auto stride = static_cast<size_t>(std::min(1.0 / std::max(ratio, 0.0), static_cast<double>(vec.size())));
+    std::vector<ValueType> result;
+    result.reserve(vec.size() / stride + 1);
+    for (size_t index = 0; index < vec.size(); index += stride)
+    {
+        result.push_back(vec[index]);
+    }
+
+    return result;
+}
 } // namespace ell
 
 #pragma endregion implementation
@@ -21,5 +21,9 @@ void ParsedCompareArguments::AddArgs(utilities::CommandLineParser& parser)
     parser.AddOption(writeReport, "report", "", "Generate markdown report", true);
     parser.AddOption(writeGraph, "graph", "", "Write DGML graph", true);
     parser.AddOption(writePrediction, "pred", "", "Write prediction to report", true);
+
+    parser.AddDocumentationString("Comparison options");
+    parser.AddOption(sampleRatio, "sampleRatio", "sr", "Fraction of each layer's elements to compare (1 = compare every element)", 1.0);
+    parser.AddOption(parallel, "parallel", "", "Run the reference model and the per-layer statistics on worker threads", true);
 }
 } // namespace ell
@@ -19,7 +19,9 @@
 #include <utilities/include/TypeAliases.h>
 #include <utilities/include/Files.h>
 #include <utilities/include/Graph.h>
+#include <utilities/include/TaskPool.h>
 
+#include <future>
 #include <sstream>
 #include <string>
 
@@ -232,10 +234,11 @@ std::vector<float> GetMapOutput(model::Map& map, const std::vector<float>& input
 //
 // ModelComparison implementation
 //
-ModelComparison::ModelComparison(std::string outputDirectory)
+ModelComparison::ModelComparison(std::string outputDirectory, double sampleRatio, bool parallel)
 {
     _outputDirectory = outputDirectory;
-    _runningCompiled = false;
+    _sampleRatio = sampleRatio;
+    _parallel = parallel;
     _addingReference = false;
     _minError = 0;
     _maxError = 0;
@@ -343,10 +346,6 @@ void ModelComparison::Compare(std::vector<float>& input, model::Map& reference,
     // build the graph
     CreateGraph(compiledMap.GetModel());
 
-    // Compute reference output
-    _runningCompiled = false;
-    _outputReference = GetMapOutput(_referenceMap, input);
-
     // Gather the reference model DebugSinkNode outputs
     std::vector<const ell::model::OutputPortBase*> referenceOutputs;
     for (size_t i = 0, length = _layerOutputData.size(); i < length; i++)
@@ -358,13 +357,29 @@ void ModelComparison::Compare(std::vector<float>& input, model::Map& reference,
         }
     }
 
-    // Now the normal reference.Compute will skip my DebugSinkNodes, so now I have to do another VisitSubmodel to gather that output.
-    // This will cause the DebugSinkNode Sink function to fire which will call AddLayer below.
-    auto compute = [](const model::Node& node) { node.Compute(); };
-    _referenceMap.GetModel().VisitSubmodel(referenceOutputs, compute);
+    // Compute the reference output. The normal reference.Compute will skip my DebugSinkNodes, so I
+    // have to do another VisitSubmodel to gather that output. This will cause the DebugSinkNode Sink
+    // function to fire which will call AddLayer below.
+    auto computeReference = [this, &input, &referenceOutputs]() {
+        _outputReference = GetMapOutput(_referenceMap, input);
+        auto compute = [](const model::Node& node) { node.Compute(); };
+        _referenceMap.GetModel().VisitSubmodel(referenceOutputs, compute);
+    };
+
+    // The reference interpreter and the jitted compiled model touch disjoint state (AddLayer routes
+    // each callback by label into disjoint fields), so the reference work can run on the task pool
+    // while this thread runs the compiled model.
+    std::future<void> referenceResult;
+    if (_parallel)
+    {
+        referenceResult = utilities::TaskPool::GetDefault().Submit(computeReference);
+    }
+    else
+    {
+        computeReference();
+    }
 
     // Compute compiled output
-    _runningCompiled = true;
     _outputCompiled = GetMapOutput(compiledMap, input);
 
     // The reference model is run a second time to gather the per-node outputs. We
@@ -376,6 +391,11 @@ void ModelComparison::Compare(std::vector<float>& input, model::Map& reference,
     // We should fix this eventually to collect per-node and overall outputs during the same run
     // of the reference model.
     auto temp = GetMapOutput(compiledMap, input);
+
+    if (referenceResult.valid())
+    {
+        referenceResult.get();
+    }
 }
 
 void ModelComparison::SaveOutput(std::string name, const std::vector<float>& reference, const std::vector<float>& compiled)
@@ -413,6 +433,23 @@ void ModelComparison::WriteReport(std::ostream& outputStream, std::string modelN
     }
     outputStream << std::endl;
 
+    // Compute the per-layer statistics (and write the per-layer csv files) up front; the layers
+    // are independent of each other, so the work is distributed over the task pool.
+    if (_parallel)
+    {
+        auto& pool = utilities::TaskPool::GetDefault();
+        pool.ParallelFor(0, static_cast<int>(_layerOutputData.size()), [this](int index) {
+            ComputeLayerStatistics(_layerOutputData[index]);
+        });
+    }
+    else
+    {
+        for (auto& layerData : _layerOutputData)
+        {
+            ComputeLayerStatistics(layerData);
+        }
+    }
+
     WriteModelInfo(outputStream, _outputReference, _outputCompiled, writePrediction);
     for (auto& layerData : _layerOutputData)
     {
@@ -420,7 +457,7 @@ void ModelComparison::WriteReport(std::ostream& outputStream, std::string modelN
         {
             std::string id = layerData.compiledNodeId;
             std::string label = layerData.compiledNodeLabel;
-            WriteNodeRow(outputStream, id, label, layerData.referenceData, layerData.compiledData, layerData);
+            WriteNodeRow(outputStream, id, label, layerData);
         }
         else
         {
@@ -452,14 +489,17 @@ void ModelComparison::WriteModelInfo(std::ostream& outputStream, const std::vect
         return;
     }
 
-    SaveOutput("Compare_Overall", reference, compiled);
+    // Compare a strided sample of the output when a sample ratio less than 1 was requested
+    auto referenceValues = Sample(reference, _sampleRatio);
+    auto compiledValues = Sample(compiled, _sampleRatio);
+    SaveOutput("Compare_Overall", referenceValues, compiledValues);
 
     outputStream << "## Overall model" << std::endl;
 
-    VectorStatistics refStats(reference);
-    VectorStatistics compiledStats(compiled);
-    VectorStatistics diffStats(Abs(Subtract(reference, compiled)));
-    float absDiffSum = VectorStatistics::Diff(reference, compiled);
+    VectorStatistics refStats(referenceValues);
+    VectorStatistics compiledStats(compiledValues);
+    VectorStatistics diffStats(Abs(Subtract(referenceValues, compiledValues)));
+    float absDiffSum = VectorStatistics::Diff(referenceValues, compiledValues);
 
     outputStream << "````" << std::endl;
     bool writeCategoryName = false;
@@ -486,31 +526,53 @@ void ModelComparison::WriteModelInfo(std::ostream& outputStream, const std::vect
     outputStream << "````" << std::endl;
 }
 
-void ModelComparison::WriteNodeRow(std::ostream& outputStream, std::string id, std::string name, const std::vector<float>& reference, const std::vector<float>& compiled, const LayerCaptureData& layerData)
+void ModelComparison::ComputeLayerStatistics(LayerCaptureData& layerData)
 {
-    if (compiled.size() == 0)
+    if (layerData.compiledNodeLabel == "" || layerData.compiledData.size() == 0)
     {
         // Layer was pruned from compiled model
         return;
     }
 
-    SaveOutput("Compare_" + name, reference, compiled);
-
-    outputStream << "## " << name << std::endl;
-
     // Get mem layout, extract relevant part, get subtensor
-    math::ChannelColumnRowTensor<float> refTensor(layerData.stride[0], layerData.stride[1], layerData.stride[2], reference);
-    math::ChannelColumnRowTensor<float> compiledTensor(layerData.stride[0], layerData.stride[1], layerData.stride[2], compiled);
-    math::ChannelColumnRowTensor<float> diffTensor(layerData.stride[0], layerData.stride[1], layerData.stride[2], Abs(Subtract(reference, compiled)));
+    math::ChannelColumnRowTensor<float> refTensor(layerData.stride[0], layerData.stride[1], layerData.stride[2], layerData.referenceData);
+    math::ChannelColumnRowTensor<float> compiledTensor(layerData.stride[0], layerData.stride[1], layerData.stride[2], layerData.compiledData);
 
     auto validRefTensor = refTensor.GetSubTensor(layerData.offset[0], layerData.offset[1], layerData.offset[2], layerData.size[0], layerData.size[1], layerData.size[2]);
     auto validCompiledTensor = compiledTensor.GetSubTensor(layerData.offset[0], layerData.offset[1], layerData.offset[2], layerData.size[0], layerData.size[1], layerData.size[2]);
 
-    VectorStatistics refStats(validRefTensor);
-    VectorStatistics compiledStats(validCompiledTensor);
-    VectorStatistics diffStats(Abs(Subtract(validRefTensor, validCompiledTensor)));
+    // Compare a strided sample of the valid elements when a sample ratio less than 1 was requested
+    auto referenceValues = Sample(validRefTensor.ToArray(), _sampleRatio);
+    auto compiledValues = Sample(validCompiledTensor.ToArray(), _sampleRatio);
+
+    if (_sampleRatio >= 1)
+    {
+        // keep the full raw buffers in the csv files, as before
+        SaveOutput("Compare_" + layerData.compiledNodeLabel, layerData.referenceData, layerData.compiledData);
+    }
+    else
+    {
+        SaveOutput("Compare_" + layerData.compiledNodeLabel, referenceValues, compiledValues);
+    }
+
+    layerData.referenceStats = VectorStatistics(referenceValues);
+    layerData.compiledStats = VectorStatistics(compiledValues);
+    layerData.diffStats = VectorStatistics(Abs(Subtract(referenceValues, compiledValues)));
+    layerData.absDiffSum = VectorStatistics::Diff(referenceValues, compiledValues);
+    layerData.hasStats = true;
+}
+
+void ModelComparison::WriteNodeRow(std::ostream& outputStream, std::string id, std::string name, const LayerCaptureData& layerData)
+{
+    if (!layerData.hasStats)
+    {
+        // Layer was pruned from compiled model
+        return;
+    }
+
+    outputStream << "## " << name << std::endl;
 
-    float absDiffSum = VectorStatistics::Diff(validRefTensor, validCompiledTensor);
+    float absDiffSum = layerData.absDiffSum;
     if (!_hasMinMax)
     {
         _minError = _maxError = absDiffSum;
@@ -535,7 +597,7 @@ void ModelComparison::WriteNodeRow(std::ostream& outputStream, std::string id, s
         outputStream << "output size = " << layerData.size << ", datasize = " << layerData.stride << ", offset = " << layerData.offset << std::endl;
     }
 
-    WriteStatsRow(outputStream, refStats, compiledStats, diffStats, absDiffSum);
+    WriteStatsRow(outputStream, layerData.referenceStats, layerData.compiledStats, layerData.diffStats, absDiffSum);
     outputStream << "````" << std::endl;
 
     if (id != "")
@@ -644,44 +706,29 @@ void ModelComparison::AddStyles()
 template <typename ValueType>
 void ModelComparison::AddLayer(const char* label, const ValueType* output)
 {
+    // Each callback is routed by its label: reference and compiled sink nodes have distinct
+    // labels (node ids are unique across the clones), so the reference and compiled models can
+    // safely deliver their outputs from different threads.
     std::string id(label);
     size_t size = GetOutputSize(id);
     std::vector<float> data(output, output + size);
-    if (_runningCompiled)
+    for (auto& layerData : _layerOutputData)
     {
-        bool found = false;
-        for (auto& layerData : _layerOutputData)
+        if (layerData.referenceNodeLabel == id)
         {
-            std::string compiledId = _nodeMap[layerData.referenceNodeLabel];
-            if (compiledId == id)
-            {
-                found = true;
-                layerData.compiledData = { data.begin(), data.end() };
-                break;
-            }
-        }
-        if (!found)
-        {
-            std::cout << "### Error: could not find LayerCaptureData for compiled layer " << id << std::endl;
+            layerData.referenceData = { data.begin(), data.end() };
+            return;
         }
     }
-    else
+    for (auto& layerData : _layerOutputData)
     {
-        bool found = false;
-        for (auto& layerData : _layerOutputData)
-        {
-            if (layerData.referenceNodeLabel == id)
-            {
-                layerData.referenceData = { data.begin(), data.end() };
-                found = true;
-                break;
-            }
-        }
-        if (!found)
+        if (layerData.compiledNodeLabel == id)
         {
-            std::cout << "### Error: could not find LayerCaptureData for reference layer " << id << std::endl;
+            layerData.compiledData = { data.begin(), data.end() };
+            return;
         }
     }
+    std::cout << "### Error: could not find LayerCaptureData for layer " << id << std::endl;
 }
 
 void ModelComparison::CreateGraph(const model::Model& model)
@@ -151,7 +151,7 @@ int main(int argc, char* argv[])
 
         auto pluginArgs = commandLineParser.GetPassthroughArgs();
         auto input = GetInputData<TestDataType>(map, compareArguments, pluginArgs);
-        ModelComparison comparison(compareArguments.outputDirectory);
+        ModelComparison comparison(compareArguments.outputDirectory, compareArguments.sampleRatio, compareArguments.parallel);
 
         model::MapCompilerOptions settings = compileArguments.GetMapCompilerOptions("");
         model::ModelOptimizerOptions optimizerOptions;
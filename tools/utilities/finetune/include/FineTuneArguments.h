@@ -67,6 +67,7 @@ struct FineTuneArguments
     bool multiClass = true;
     std::string dataFormat;
     int maxCacheEntries = 8;
+    std::string cacheDirectory;
 
     // Node selection
     int numPrefixNodesToSkip = 0;
@@ -12,11 +12,18 @@
 
 #include <model/include/OutputPort.h>
 
+#include <cstdint>
+#include <string>
 #include <unordered_map>
 
 namespace ell
 {
 /// <summary> Caches the results from running a dataset through a model. </summary>
+///
+/// In addition to the in-memory LRU cache, entries can optionally be persisted to a cache
+/// directory on disk, keyed by a hash of the node id and the dataset, so later finetune runs on
+/// the same model and dataset can read back previously-computed activations instead of
+/// recomputing them. (Node ids are stable across runs because they're serialized with the model.)
 class ModelOutputDataCache
 {
 public:
@@ -27,11 +34,24 @@ public:
     void RemoveCachedData(const ell::model::OutputPortBase* port);
     void SetCachedData(const ell::model::OutputPortBase* port, UnlabeledDataContainer data);
 
+    /// <summary> Persists cache entries to (and reads them back from) the given directory. </summary>
+    ///
+    /// <param name="cacheDirectory"> The directory to keep cache files in (created if necessary). </param>
+    /// <param name="datasetHash"> A hash of the dataset the cached outputs were computed from,
+    ///     used as part of the cache key so stale entries from a different dataset are never returned. </param>
+    void EnableDiskCache(const std::string& cacheDirectory, uint64_t datasetHash);
+
+    /// <summary> Computes a hash of a dataset's contents, for use with EnableDiskCache. </summary>
+    static uint64_t GetDatasetHash(const UnlabeledDataContainer& dataset);
+
     // ??
     const ell::model::OutputPortBase* FindNearestCachedOutputPort(const ell::model::OutputPortBase* output);
 
 private:
     void RemoveLeastRecentlyUsedEntry();
+    std::string GetCacheFilePath(const ell::model::OutputPortBase* port) const;
+    bool LoadFromDisk(const ell::model::OutputPortBase* port) const;
+    void WriteToDisk(const ell::model::OutputPortBase* port, const UnlabeledDataContainer& data) const;
 
     struct CacheEntry
     {
@@ -41,5 +61,7 @@ private:
     mutable std::unordered_map<const ell::model::OutputPortBase*, CacheEntry> _cache;
     mutable int64_t _currentGeneration = 0;
     int _maxCacheSize = 0;
+    std::string _cacheDirectory;
+    uint64_t _datasetHash = 0;
 };
 } // namespace ell
@@ -232,6 +232,8 @@ void InitArguments(utilities::CommandLineParser& parser, FineTuneArguments& args
 
     parser.AddOption(args.dataFormat, "format", "", "Dataset format (GSDF, CIFAR, MNIST; default: guess)", "");
 
+    parser.AddOption(args.cacheDirectory, "cacheDir", "", "Directory to persist cached node outputs in, so later runs on the same model and dataset can skip recomputing them (blank: don't persist)", "");
+
     parser.AddDocumentationString("");
     parser.AddDocumentationString("Node selection");
     parser.AddOption(args.numPrefixNodesToSkip, "skipStart", "", "Number of nodes in the beginning of the model to skip", 0);
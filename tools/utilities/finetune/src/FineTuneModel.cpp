@@ -241,6 +241,10 @@ FineTuningResult FineTuneNodesInSubmodel(const Submodel& submodel,
     std::vector<FineTuningLayerResult> layerResults;
 
     ModelOutputDataCache dataCache(args.maxCacheEntries);
+    if (!args.cacheDirectory.empty())
+    {
+        dataCache.EnableDiskCache(args.cacheDirectory, ModelOutputDataCache::GetDatasetHash(GetDatasetInputs(trainingData)));
+    }
 
     bool didModifyAnyNodes = false;
     auto problemParams = args.GetFineTuneProblemParameters();
@@ -11,10 +11,51 @@
 #include <model/include/InputPort.h>
 
 #include <utilities/include/Exception.h>
+#include <utilities/include/Files.h>
+#include <utilities/include/Hash.h>
 #include <utilities/include/Logger.h>
 
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace ell
 {
+namespace
+{
+    // cache file layout: header followed by rowCount * rowSize floats, row-major
+    struct CacheFileHeader
+    {
+        uint32_t magic; // 'ELLC'
+        uint32_t version;
+        uint64_t rowCount;
+        uint64_t rowSize;
+    };
+
+    constexpr uint32_t cacheFileMagic = 0x454c4c43; // 'ELLC'
+    constexpr uint32_t cacheFileVersion = 1;
+
+    UnlabeledDataContainer ReadCacheEntry(const float* elements, uint64_t rowCount, uint64_t rowSize)
+    {
+        UnlabeledDataContainer result;
+        std::vector<float> row(rowSize);
+        for (uint64_t rowIndex = 0; rowIndex < rowCount; ++rowIndex)
+        {
+            std::memcpy(row.data(), elements + rowIndex * rowSize, rowSize * sizeof(float));
+            result.Add({ row });
+        }
+        return result;
+    }
+} // namespace
+
 using namespace ell::model;
 
 ModelOutputDataCache::ModelOutputDataCache() :
@@ -29,11 +70,19 @@ ModelOutputDataCache::ModelOutputDataCache(int maxCacheSize) :
 
 bool ModelOutputDataCache::HasCachedData(const ell::model::OutputPortBase* port) const
 {
-    return _cache.find(port) != _cache.end();
+    if (_cache.find(port) != _cache.end())
+    {
+        return true;
+    }
+    return !_cacheDirectory.empty() && utilities::FileExists(GetCacheFilePath(port));
 }
 
 const UnlabeledDataContainer& ModelOutputDataCache::GetCachedData(const ell::model::OutputPortBase* port) const
 {
+    if (_cache.find(port) == _cache.end())
+    {
+        LoadFromDisk(port); // throws if the entry isn't on disk either
+    }
     ++_currentGeneration;
     _cache.at(port).generation = _currentGeneration;
     return _cache.at(port).data;
@@ -52,9 +101,128 @@ void ModelOutputDataCache::SetCachedData(const ell::model::OutputPortBase* port,
         RemoveLeastRecentlyUsedEntry();
     }
 
+    if (!_cacheDirectory.empty() && !utilities::FileExists(GetCacheFilePath(port)))
+    {
+        WriteToDisk(port, data);
+    }
     _cache[port] = { _currentGeneration, data };
 }
 
+void ModelOutputDataCache::EnableDiskCache(const std::string& cacheDirectory, uint64_t datasetHash)
+{
+    utilities::EnsureDirectoryExists(cacheDirectory);
+    _cacheDirectory = cacheDirectory;
+    _datasetHash = datasetHash;
+}
+
+uint64_t ModelOutputDataCache::GetDatasetHash(const UnlabeledDataContainer& dataset)
+{
+    size_t seed = 0;
+    utilities::HashCombine(seed, dataset.Size());
+    for (const auto& row : dataset)
+    {
+        auto size = row.Size();
+        utilities::HashCombine(seed, size);
+        for (size_t index = 0; index < size; ++index)
+        {
+            utilities::HashCombine(seed, row[index]);
+        }
+    }
+    return static_cast<uint64_t>(seed);
+}
+
+std::string ModelOutputDataCache::GetCacheFilePath(const ell::model::OutputPortBase* port) const
+{
+    size_t portHash = 0;
+    utilities::HashCombine(portHash, port->GetNode()->GetId().ToString());
+    utilities::HashCombine(portHash, port->GetName());
+
+    std::stringstream filename;
+    filename << std::hex << portHash << "_" << _datasetHash << ".bin";
+    return utilities::JoinPaths(_cacheDirectory, filename.str());
+}
+
+bool ModelOutputDataCache::LoadFromDisk(const ell::model::OutputPortBase* port) const
+{
+    using namespace logging;
+    if (_cacheDirectory.empty())
+    {
+        throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "No cached data for port");
+    }
+
+    auto path = GetCacheFilePath(port);
+    Log() << "Reading cached data from " << path << EOL;
+
+#if !defined(_WIN32)
+    // map the file and read the rows straight out of the page cache
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "No cached data for port");
+    }
+    struct stat fileInfo;
+    fstat(fd, &fileInfo);
+    auto fileSize = static_cast<size_t>(fileInfo.st_size);
+    auto mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        throw utilities::InputException(utilities::InputExceptionErrors::badData, "Couldn't map cache file " + path);
+    }
+
+    auto header = reinterpret_cast<const CacheFileHeader*>(mapping);
+    if (fileSize < sizeof(CacheFileHeader) || header->magic != cacheFileMagic || header->version != cacheFileVersion ||
+        fileSize != sizeof(CacheFileHeader) + header->rowCount * header->rowSize * sizeof(float))
+    {
+        munmap(mapping, fileSize);
+        throw utilities::InputException(utilities::InputExceptionErrors::badData, "Malformed cache file " + path);
+    }
+
+    auto elements = reinterpret_cast<const float*>(header + 1);
+    auto data = ReadCacheEntry(elements, header->rowCount, header->rowSize);
+    munmap(mapping, fileSize);
+#else
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+    {
+        throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "No cached data for port");
+    }
+    CacheFileHeader header;
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!stream || header.magic != cacheFileMagic || header.version != cacheFileVersion)
+    {
+        throw utilities::InputException(utilities::InputExceptionErrors::badData, "Malformed cache file " + path);
+    }
+    std::vector<float> elements(header.rowCount * header.rowSize);
+    stream.read(reinterpret_cast<char*>(elements.data()), elements.size() * sizeof(float));
+    if (!stream)
+    {
+        throw utilities::InputException(utilities::InputExceptionErrors::badData, "Malformed cache file " + path);
+    }
+    auto data = ReadCacheEntry(elements.data(), header.rowCount, header.rowSize);
+#endif
+
+    _cache[port] = { _currentGeneration, std::move(data) };
+    return true;
+}
+
+void ModelOutputDataCache::WriteToDisk(const ell::model::OutputPortBase* port, const UnlabeledDataContainer& data) const
+{
+    using namespace logging;
+    auto path = GetCacheFilePath(port);
+    Log() << "Writing cached data to " << path << EOL;
+
+    CacheFileHeader header{ cacheFileMagic, cacheFileVersion, data.Size(), data.IsEmpty() ? 0 : data[0].Size() };
+    std::ofstream stream(path, std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    std::vector<float> row;
+    for (uint64_t rowIndex = 0; rowIndex < header.rowCount; ++rowIndex)
+    {
+        row = data[rowIndex].ToArray();
+        stream.write(reinterpret_cast<const char*>(row.data()), row.size() * sizeof(float));
+    }
+}
+
 void ModelOutputDataCache::RemoveLeastRecentlyUsedEntry()
 {
     using namespace logging;
@@ -10,13 +10,17 @@
 #include "DataUtils.h"
 #include "ModelUtils.h"
 
+#include <model/include/IRCompiledMap.h>
 #include <model/include/Map.h>
 
 #include <passes/include/StandardTransformations.h>
 
 #include <utilities/include/Logger.h>
 #include <utilities/include/MemoryLayout.h>
+#include <utilities/include/TaskPool.h>
 
+#include <algorithm>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -325,18 +329,63 @@ DataContainerType TransformDataInputsWithModelImpl(const DataContainerType& data
     auto map = GetMapForModel(output, compile, compiler);
 
     auto inputSize = map->GetInputSize(0);
-    DataContainerType result;
-    for (size_t i = 0; i < dataset.Size(); ++i)
+    auto numExamples = dataset.Size();
+
+    // Compute all the predictions, sharding the examples over worker threads when the map is
+    // compiled. A compiled map's compute function isn't reentrant, so each shard gets its own
+    // clone of the jitted map.
+    std::vector<std::vector<ElementType>> predictions(numExamples);
+    auto computeRange = [&dataset, &predictions, inputSize](Map& workerMap, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            auto example = dataset[i];
+            const auto& exampleData = GetInput(example);
+            std::vector<ElementType> input = CastVector<ElementType>(exampleData.ToArray());
+            if (input.size() != inputSize)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "dataset has wrong number of elements -- expected " + std::to_string(inputSize) + ", but got " + std::to_string(input.size()));
+            }
+            predictions[i] = workerMap.template Compute<ElementType>(input);
+        }
+    };
+
+    auto compiledMap = dynamic_cast<IRCompiledMap*>(map.get());
+    auto& pool = utilities::TaskPool::GetDefault();
+    auto numShards = std::min(pool.NumThreads(), numExamples);
+    if (compiledMap != nullptr && numShards > 1)
     {
-        auto example = dataset[i];
-        const auto& exampleData = GetInput(example);
-        std::vector<ElementType> input = CastVector<ElementType>(exampleData.ToArray());
-        if (input.size() != inputSize)
+        // cloning the jitted map isn't concurrency-safe, so make all the clones up front
+        std::vector<IRCompiledMap> workerMaps;
+        workerMaps.reserve(numShards);
+        for (size_t shard = 0; shard < numShards; ++shard)
+        {
+            workerMaps.push_back(compiledMap->Clone());
+        }
+
+        auto shardSize = (numExamples + numShards - 1) / numShards;
+        std::vector<std::future<void>> futures;
+        for (size_t shard = 0; shard < numShards; ++shard)
         {
-            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "dataset has wrong number of elements -- expected " + std::to_string(inputSize) + ", but got " + std::to_string(input.size()));
+            auto begin = shard * shardSize;
+            auto end = std::min(begin + shardSize, numExamples);
+            futures.push_back(pool.Submit([&computeRange, &workerMaps, shard, begin, end]() {
+                computeRange(workerMaps[shard], begin, end);
+            }));
         }
-        auto pred = map->template Compute<ElementType>(input);
-        AddExample(result, pred, GetOutput(example));
+        for (auto& future : futures)
+        {
+            future.get(); // rethrows any exception from the worker
+        }
+    }
+    else
+    {
+        computeRange(*map, 0, numExamples);
+    }
+
+    DataContainerType result;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        AddExample(result, predictions[i], GetOutput(dataset[i]));
     }
     return result;
 }
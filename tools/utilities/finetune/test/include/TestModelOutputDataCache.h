@@ -14,4 +14,5 @@ void TestModelOutputDataCache();
 // Individual tests
 void TestModelOutputDataCache_CreateAndPopulate();
 void TestModelOutputDataCache_FindNearestCachedOutput();
+void TestModelOutputDataCache_DiskCache();
 void TestModelOutputDataCache_TransformWithCache();
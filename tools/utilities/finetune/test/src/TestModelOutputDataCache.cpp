@@ -20,6 +20,7 @@
 #include <testing/include/testing.h>
 
 #include <utilities/include/Exception.h>
+#include <utilities/include/Files.h>
 
 // stl
 #include <algorithm>
@@ -87,6 +88,7 @@ void TestModelOutputDataCache()
 {
     FailOnException(TestModelOutputDataCache_CreateAndPopulate);
     FailOnException(TestModelOutputDataCache_FindNearestCachedOutput);
+    FailOnException(TestModelOutputDataCache_DiskCache);
 }
 
 void TestModelOutputDataCache_CreateAndPopulate()
@@ -143,3 +145,36 @@ void TestModelOutputDataCache_FindNearestCachedOutput()
 
     ProcessTest("Testing FindNearestCachedOutput", cache.FindNearestCachedOutputPort(outputPorts[3]) == outputPorts[1]);
 }
+
+void TestModelOutputDataCache_DiskCache()
+{
+    auto model = GetLinearTestModel();
+    auto data = GetTestDataset();
+    auto outputPorts = GetModelOutputPorts(model);
+    auto datasetHash = ModelOutputDataCache::GetDatasetHash(data);
+    auto cacheDirectory = utilities::JoinPaths(utilities::GetWorkingDirectory(), "finetune_disk_cache_test");
+
+    ModelOutputDataCache cache;
+    cache.EnableDiskCache(cacheDirectory, datasetHash);
+    cache.SetCachedData(outputPorts[1], data);
+
+    // a fresh cache with the same directory and dataset hash should see the persisted entry
+    ModelOutputDataCache freshCache;
+    freshCache.EnableDiskCache(cacheDirectory, datasetHash);
+    ProcessTest("Testing HasCachedData from disk", freshCache.HasCachedData(outputPorts[1]));
+    ProcessTest("Testing HasCachedData from disk for absent entry", !freshCache.HasCachedData(outputPorts[2]));
+    ProcessTest("Testing FindNearestCachedOutput from disk", freshCache.FindNearestCachedOutputPort(outputPorts[3]) == outputPorts[1]);
+
+    auto& readBack = freshCache.GetCachedData(outputPorts[1]);
+    bool dataMatches = readBack.Size() == data.Size();
+    for (size_t index = 0; dataMatches && index < data.Size(); ++index)
+    {
+        dataMatches = readBack[index] == data[index];
+    }
+    ProcessTest("Testing GetCachedData from disk round-trip", dataMatches);
+
+    // a cache keyed by a different dataset hash shouldn't see the entry
+    ModelOutputDataCache otherDatasetCache;
+    otherDatasetCache.EnableDiskCache(cacheDirectory, datasetHash + 1);
+    ProcessTest("Testing disk entries are keyed by dataset hash", !otherDatasetCache.HasCachedData(outputPorts[1]));
+}
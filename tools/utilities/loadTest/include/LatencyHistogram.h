@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LatencyHistogram.h (loadTest)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ell
+{
+/// <summary>
+/// A histogram of latency samples with logarithmically-spaced buckets (in the style of HDR
+/// histograms): each power-of-two range of values is divided into a fixed number of linear
+/// sub-buckets, so recording is O(1), memory use is small and independent of the number of
+/// samples, and the relative error of any reported percentile is bounded by the sub-bucket
+/// width (under 2%). Values are recorded in milliseconds and bucketed at microsecond
+/// granularity.
+/// </summary>
+class LatencyHistogram
+{
+public:
+    /// <summary> Records a latency sample. </summary>
+    ///
+    /// <param name="milliseconds"> The observed latency, in milliseconds. </param>
+    void Record(double milliseconds);
+
+    /// <summary> Gets the number of samples recorded. </summary>
+    int64_t Count() const { return _count; }
+
+    /// <summary> Gets the smallest recorded sample, in milliseconds. </summary>
+    double Min() const { return _min; }
+
+    /// <summary> Gets the largest recorded sample, in milliseconds. </summary>
+    double Max() const { return _max; }
+
+    /// <summary> Gets the mean of the recorded samples, in milliseconds. </summary>
+    double Mean() const;
+
+    /// <summary> Gets the given percentile of the recorded samples, in milliseconds. </summary>
+    ///
+    /// <param name="percentile"> The percentile to look up, in the range (0, 100]. </param>
+    ///
+    /// <returns> The approximate latency at that percentile (accurate to within a sub-bucket). </returns>
+    double Percentile(double percentile) const;
+
+    /// <summary> Resets the histogram to its empty state. </summary>
+    void Reset();
+
+private:
+    size_t BucketIndex(int64_t microseconds) const;
+    double BucketValue(size_t index) const; // representative value (bucket midpoint), in milliseconds
+
+    static constexpr int subBucketBits = 6;
+    static constexpr int64_t subBucketCount = int64_t{ 1 } << subBucketBits;
+
+    std::vector<int64_t> _buckets;
+    int64_t _count = 0;
+    double _total = 0;
+    double _min = 0;
+    double _max = 0;
+};
+} // namespace ell
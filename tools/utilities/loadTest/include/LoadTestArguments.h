@@ -0,0 +1,35 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LoadTestArguments.h (loadTest)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <utilities/include/CommandLineParser.h>
+
+#include <string>
+
+namespace ell
+{
+/// <summary> Arguments for loadTest tool. </summary>
+struct LoadTestArguments
+{
+    std::string outputFilename;
+    std::string rates; // comma-separated list of target rates (inferences/second); 0 means unthrottled
+    double testDuration = 10; // seconds to run at each rate
+    int numWarmUpIterations = 10;
+};
+
+/// <summary> Arguments for parsed loadTest. </summary>
+struct ParsedLoadTestArguments : public LoadTestArguments
+    , public utilities::ParsedArgSet
+{
+    /// <summary> Adds the arguments. </summary>
+    ///
+    /// <param name="parser"> [in,out] The parser. </param>
+    void AddArgs(utilities::CommandLineParser& parser) override;
+};
+} // namespace ell
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LatencyHistogram.cpp (loadTest)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ell
+{
+void LatencyHistogram::Record(double milliseconds)
+{
+    auto microseconds = std::max(int64_t{ 0 }, static_cast<int64_t>(std::llround(milliseconds * 1000)));
+    auto index = BucketIndex(microseconds);
+    if (index >= _buckets.size())
+    {
+        _buckets.resize(index + 1, 0);
+    }
+    ++_buckets[index];
+
+    if (_count == 0 || milliseconds < _min)
+    {
+        _min = milliseconds;
+    }
+    if (_count == 0 || milliseconds > _max)
+    {
+        _max = milliseconds;
+    }
+    ++_count;
+    _total += milliseconds;
+}
+
+double LatencyHistogram::Mean() const
+{
+    return _count == 0 ? 0 : _total / _count;
+}
+
+double LatencyHistogram::Percentile(double percentile) const
+{
+    if (_count == 0)
+    {
+        return 0;
+    }
+
+    auto rank = static_cast<int64_t>(std::ceil((percentile / 100.0) * _count));
+    rank = std::max(int64_t{ 1 }, std::min(rank, _count));
+
+    int64_t cumulative = 0;
+    for (size_t index = 0; index < _buckets.size(); ++index)
+    {
+        cumulative += _buckets[index];
+        if (cumulative >= rank)
+        {
+            return BucketValue(index);
+        }
+    }
+    return _max;
+}
+
+void LatencyHistogram::Reset()
+{
+    _buckets.clear();
+    _count = 0;
+    _total = 0;
+    _min = 0;
+    _max = 0;
+}
+
+size_t LatencyHistogram::BucketIndex(int64_t microseconds) const
+{
+    // Values below subBucketCount are recorded exactly; above that, each power-of-two range
+    // is divided into subBucketCount/2 linear sub-buckets (the top half of a row of
+    // subBucketCount slots, since the bottom half aliases the previous row).
+    if (microseconds < subBucketCount)
+    {
+        return static_cast<size_t>(microseconds);
+    }
+
+    int shift = 0;
+    auto value = microseconds;
+    while (value >= subBucketCount)
+    {
+        value >>= 1;
+        ++shift;
+    }
+    return static_cast<size_t>(shift) * subBucketCount + static_cast<size_t>(microseconds >> shift);
+}
+
+double LatencyHistogram::BucketValue(size_t index) const
+{
+    auto shift = static_cast<int64_t>(index) / subBucketCount;
+    auto mantissa = static_cast<int64_t>(index) % subBucketCount;
+    auto lowerBound = mantissa << shift;
+    auto width = int64_t{ 1 } << shift;
+    return (lowerBound + width / 2.0) / 1000.0;
+}
+} // namespace ell
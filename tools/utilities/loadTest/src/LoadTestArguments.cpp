@@ -0,0 +1,44 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     LoadTestArguments.cpp (loadTest)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LoadTestArguments.h"
+
+namespace ell
+{
+void ParsedLoadTestArguments::AddArgs(utilities::CommandLineParser& parser)
+{
+    parser.AddOption(
+        outputFilename,
+        "outputFilename",
+        "of",
+        "File for test output ('<cout>' for stdout, blank or '<null>' for no output)",
+        "<cout>",
+        "-");
+
+    parser.AddOption(
+        rates,
+        "rates",
+        "r",
+        "Comma-separated list of target request rates, in inferences/second ('0' for an unthrottled closed loop)",
+        "0");
+
+    parser.AddOption(
+        testDuration,
+        "duration",
+        "d",
+        "Number of seconds to run at each rate",
+        10.0);
+
+    parser.AddOption(
+        numWarmUpIterations,
+        "warmUp",
+        "wu",
+        "Number of warm-up iterations to run before measuring",
+        10);
+}
+} // namespace ell
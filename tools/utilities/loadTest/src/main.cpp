@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     main.cpp (loadTest)
+//  Authors:  Chuck Jacobs
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LatencyHistogram.h"
+#include "LoadTestArguments.h"
+
+#include "../../profile/include/ReplaceSourceAndSinkNodesTransformation.h"
+
+#include <common/include/LoadModel.h>
+#include <common/include/MapCompilerArguments.h>
+#include <common/include/MapLoadArguments.h>
+
+#include <model/include/IRCompiledMap.h>
+#include <model/include/IRMapCompiler.h>
+#include <model/include/Map.h>
+
+#include <passes/include/StandardTransformations.h>
+
+#include <utilities/include/CommandLineParser.h>
+#include <utilities/include/Exception.h>
+#include <utilities/include/OutputStreamImpostor.h>
+#include <utilities/include/RandomEngines.h>
+#include <utilities/include/StringUtil.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ell;
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double MillisecondsBetween(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/// <summary> The result of driving the map at one target rate. </summary>
+struct LoadTestResult
+{
+    double targetRate = 0; // inferences/second requested (0 == unthrottled)
+    double achievedRate = 0; // inferences/second actually completed
+    LatencyHistogram latencies;
+};
+} // namespace
+
+template <typename InputType, utilities::IsIntegral<InputType> = true>
+std::vector<InputType> GetInputVector(const model::MemoryShape& inputShape)
+{
+    auto inputSize = inputShape.NumElements();
+    std::vector<InputType> result(inputSize);
+    auto engine = utilities::GetRandomEngine("123");
+    std::uniform_int_distribution<InputType> dist(0, 255);
+    for (int index = 0; index < inputSize; ++index)
+    {
+        result[index] = dist(engine);
+    }
+    return result;
+}
+
+template <typename InputType, utilities::IsFloatingPoint<InputType> = true>
+std::vector<InputType> GetInputVector(const model::MemoryShape& inputShape)
+{
+    auto inputSize = inputShape.NumElements();
+    std::vector<InputType> result(inputSize);
+    auto engine = utilities::GetRandomEngine("123");
+    std::uniform_real_distribution<InputType> dist(0, std::nextafter(255, std::numeric_limits<InputType>::max()));
+    for (int index = 0; index < inputSize; ++index)
+    {
+        result[index] = dist(engine);
+    }
+    return result;
+}
+
+void ReplaceSourceAndSinkNodes(model::Map& map)
+{
+    map.RemoveInputs();
+    ReplaceSourceAndSinkNodesTransformation replaceTransformation;
+    map.Transform(replaceTransformation);
+    map.Prune();
+
+    // now put back inputs
+    auto inputNodes = map.GetModel().GetNodesByType<model::InputNodeBase>();
+    int index = 1;
+    for (auto node : inputNodes)
+    {
+        map.AddInput("input_" + std::to_string(index), node);
+        ++index;
+    }
+}
+
+std::vector<double> ParseRates(const std::string& rates)
+{
+    std::vector<double> result;
+    for (const auto& token : utilities::Split(rates, ','))
+    {
+        result.push_back(std::stod(token));
+    }
+    return result;
+}
+
+utilities::OutputStreamImpostor GetOutputStream(const std::string& filename)
+{
+    if (filename == "" || filename == "<null>")
+    {
+        return { utilities::OutputStreamImpostor::StreamType::null };
+    }
+    if (filename == "<cout>")
+    {
+        return { utilities::OutputStreamImpostor::StreamType::cout };
+    }
+    return { filename };
+}
+
+//
+// Load generation
+//
+
+// Drives the map at the given target rate (inferences/second; 0 means "as fast as possible") for
+// the given duration. Requests are scheduled open-loop on a fixed cadence, and each latency is
+// measured from the request's *scheduled* start time, so when the model can't keep up the queueing
+// delay shows up in the recorded latencies instead of being silently absorbed (the
+// coordinated-omission problem with closed-loop measurement).
+template <typename InputType, typename OutputType>
+LoadTestResult RunAtRate(model::IRCompiledMap& map, const std::vector<InputType>& input, double targetRate, double durationSeconds)
+{
+    LoadTestResult result;
+    result.targetRate = targetRate;
+
+    auto startTime = Clock::now();
+    auto endTime = startTime + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(durationSeconds));
+    auto interval = targetRate > 0 ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetRate)) : Clock::duration::zero();
+    auto scheduledStart = startTime;
+
+    int64_t numCompleted = 0;
+    auto now = startTime;
+    while (now < endTime)
+    {
+        if (targetRate > 0 && Clock::now() < scheduledStart)
+        {
+            std::this_thread::sleep_until(scheduledStart);
+        }
+
+        auto output = map.Compute<OutputType>(input);
+        now = Clock::now();
+
+        result.latencies.Record(MillisecondsBetween(scheduledStart, now));
+        ++numCompleted;
+        scheduledStart = targetRate > 0 ? scheduledStart + interval : now;
+    }
+
+    result.achievedRate = numCompleted / (MillisecondsBetween(startTime, now) / 1000.0);
+    return result;
+}
+
+void WriteResults(const std::vector<LoadTestResult>& results, std::ostream& out)
+{
+    out << "target_rate\tachieved_rate\tcount\tmean_ms\tp50_ms\tp90_ms\tp95_ms\tp99_ms\tp99.9_ms\tmax_ms" << std::endl;
+    out << std::fixed << std::setprecision(3);
+    for (const auto& result : results)
+    {
+        out << result.targetRate << "\t"
+            << result.achievedRate << "\t"
+            << result.latencies.Count() << "\t"
+            << result.latencies.Mean() << "\t"
+            << result.latencies.Percentile(50) << "\t"
+            << result.latencies.Percentile(90) << "\t"
+            << result.latencies.Percentile(95) << "\t"
+            << result.latencies.Percentile(99) << "\t"
+            << result.latencies.Percentile(99.9) << "\t"
+            << result.latencies.Max() << std::endl;
+    }
+}
+
+template <typename InputType, typename OutputType>
+void RunLoadTest(model::Map& map, const LoadTestArguments& testArguments, const common::MapCompilerArguments& mapCompilerArguments)
+{
+    auto outputStream = GetOutputStream(testArguments.outputFilename);
+
+    ReplaceSourceAndSinkNodes(map);
+
+    std::vector<InputType> input = GetInputVector<InputType>(map.GetInputShape());
+
+    // Initialize the transformation registry
+    passes::AddStandardTransformationsToRegistry();
+
+    // Compile map
+    model::MapCompilerOptions settings = mapCompilerArguments.GetMapCompilerOptions("");
+    settings.profile = false;
+    settings.compilerSettings.profile = false;
+
+    model::ModelOptimizerOptions optimizerOptions;
+    optimizerOptions["fuseLinearFunctionNodes"] = true;
+    model::IRMapCompiler compiler(settings, optimizerOptions);
+
+    std::cout << "Compiling model" << std::endl;
+    auto compiledMap = compiler.Compile(map);
+
+    // Warm up the system by evaluating the model some number of times
+    for (int iter = 0; iter < testArguments.numWarmUpIterations; ++iter)
+    {
+        auto output = compiledMap.Compute<OutputType>(input);
+    }
+
+    std::vector<LoadTestResult> results;
+    for (auto rate : ParseRates(testArguments.rates))
+    {
+        if (rate > 0)
+        {
+            std::cout << "Running at " << rate << " inferences/second for " << testArguments.testDuration << " seconds" << std::endl;
+        }
+        else
+        {
+            std::cout << "Running unthrottled for " << testArguments.testDuration << " seconds" << std::endl;
+        }
+        results.push_back(RunAtRate<InputType, OutputType>(compiledMap, input, rate, testArguments.testDuration));
+    }
+
+    WriteResults(results, outputStream);
+}
+
+template <typename InputType>
+void RunLoadTest(model::Map& map, const LoadTestArguments& testArguments, const common::MapCompilerArguments& mapCompilerArguments)
+{
+    switch (map.GetOutputType())
+    {
+    case model::Port::PortType::smallReal:
+        RunLoadTest<InputType, model::ValueType<model::Port::PortType::smallReal>>(map, testArguments, mapCompilerArguments);
+        break;
+    case model::Port::PortType::real:
+        RunLoadTest<InputType, model::ValueType<model::Port::PortType::real>>(map, testArguments, mapCompilerArguments);
+        break;
+    case model::Port::PortType::integer:
+        RunLoadTest<InputType, model::ValueType<model::Port::PortType::integer>>(map, testArguments, mapCompilerArguments);
+        break;
+    case model::Port::PortType::bigInt:
+        RunLoadTest<InputType, model::ValueType<model::Port::PortType::bigInt>>(map, testArguments, mapCompilerArguments);
+        break;
+    default:
+        throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Model has an unsupported output type");
+    }
+}
+
+void RunLoadTest(model::Map& map, const LoadTestArguments& testArguments, const common::MapCompilerArguments& mapCompilerArguments)
+{
+    switch (map.GetInputType())
+    {
+    case model::Port::PortType::smallReal:
+        RunLoadTest<model::ValueType<model::Port::PortType::smallReal>>(map, testArguments, mapCompilerArguments);
+        break;
+    case model::Port::PortType::real:
+        RunLoadTest<model::ValueType<model::Port::PortType::real>>(map, testArguments, mapCompilerArguments);
+        break;
+    case model::Port::PortType::integer:
+        RunLoadTest<model::ValueType<model::Port::PortType::integer>>(map, testArguments, mapCompilerArguments);
+        break;
+    case model::Port::PortType::bigInt:
+        RunLoadTest<model::ValueType<model::Port::PortType::bigInt>>(map, testArguments, mapCompilerArguments);
+        break;
+    default:
+        throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Model has an unsupported input type");
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // create a command line parser
+        utilities::CommandLineParser commandLineParser(argc, argv);
+
+        // add arguments to the command line parser
+        common::ParsedMapLoadArguments mapLoadArguments;
+        commandLineParser.AddOptionSet(mapLoadArguments);
+        ParsedLoadTestArguments testArguments;
+        commandLineParser.AddOptionSet(testArguments);
+        commandLineParser.AddDocumentationString("Code generation options");
+        common::ParsedMapCompilerArguments compileArguments;
+        commandLineParser.AddOptionSet(compileArguments);
+        commandLineParser.Parse();
+
+        // if no input specified, print help and exit
+        if (!mapLoadArguments.HasInputFilename())
+        {
+            std::cout << commandLineParser.GetHelpString() << std::endl;
+            return 0;
+        }
+
+        // load map file
+        auto map = common::LoadMap(mapLoadArguments);
+        RunLoadTest(map, testArguments, compileArguments);
+    }
+    catch (const utilities::CommandLineParserPrintHelpException& exception)
+    {
+        std::cout << exception.GetHelpText() << std::endl;
+        return 0;
+    }
+    catch (const utilities::CommandLineParserErrorException& exception)
+    {
+        std::cerr << "Command line parse error:" << std::endl;
+        for (const auto& error : exception.GetParseErrors())
+        {
+            std::cerr << error.GetMessage() << std::endl;
+        }
+        return 1;
+    }
+    catch (const utilities::LogicException& exception)
+    {
+        std::cerr << "runtime error: " << exception.GetMessage() << std::endl;
+        return 1;
+    }
+
+    // the end
+    return 0;
+}
@@ -10,13 +10,89 @@
 ####################################################################################################
 
 import argparse
-import subprocess
-import platform
 import os
+import platform
+import queue
+import re
+import subprocess
+import threading
 import timing_aggregator
 
 script_path = os.path.dirname(os.path.realpath(__file__))
 
+def find_runners(base_dir=script_path):
+    """Finds the per-implementation Runner executables built in this timing directory.
+    Returns a list of (implementation_name, executable_path) tuples"""
+    runner_name = "Runner.exe" if platform.system() == "Windows" else "Runner"
+    runners = []
+    for entry in sorted(os.listdir(base_dir)):
+        model_dir = os.path.join(base_dir, entry)
+        if not os.path.isdir(model_dir):
+            continue
+        build_dir = os.path.join(model_dir, "build_{}".format(entry))
+        for candidate in [os.path.join(build_dir, "Release", runner_name), os.path.join(build_dir, runner_name)]:
+            if os.path.isfile(candidate):
+                runners.append((entry, candidate))
+                break
+    return runners
+
+def get_available_cores():
+    if hasattr(os, "sched_getaffinity"):
+        return sorted(os.sched_getaffinity(0))
+    return list(range(os.cpu_count() or 1))
+
+def run_pinned(executable, core):
+    """Runs one timing executable, pinned to the given core where the platform supports it"""
+    preexec = None
+    if core is not None and hasattr(os, "sched_setaffinity"):
+        preexec = lambda: os.sched_setaffinity(0, {core})
+    results = subprocess.run([executable], stdout=subprocess.PIPE, cwd=os.path.dirname(executable), preexec_fn=preexec)
+    return results.stdout.decode("utf-8").splitlines()
+
+def run_comparison(runners, count, cores):
+    """Runs each implementation `count` times. Repetitions are interleaved across implementations
+    (A, B, C, A, B, C, ...) so slow thermal drift hits every implementation evenly instead of
+    biasing whichever happened to run last, and independent cases run concurrently when more
+    than one core is given, each pinned to its own core"""
+    jobs = [(index, name, exe) for index in range(count) for (name, exe) in runners]
+    output_lines = [None] * len(jobs)
+    job_queue = queue.Queue()
+    for position, job in enumerate(jobs):
+        job_queue.put((position, job))
+
+    def worker(core):
+        while True:
+            try:
+                position, (index, name, exe) = job_queue.get_nowait()
+            except queue.Empty:
+                return
+            output_lines[position] = run_pinned(exe, core)
+            print("{} repetition {}/{} complete".format(name, index + 1, count))
+
+    threads = [threading.Thread(target=worker, args=(core,)) for core in cores]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    accumulated = []
+    for lines in output_lines:
+        accumulated.extend(lines or [])
+    return accumulated
+
+def get_case_context(case_dir=script_path):
+    """Derives the (node, data type, shape) identification of this timing directory from its
+    path (timing directories are laid out as <outdir>/<data_type>/<shape>)"""
+    case_dir = os.path.normpath(case_dir)
+    shape = os.path.basename(case_dir)
+    data_type = os.path.basename(os.path.dirname(case_dir))
+    context = {"node": "gemm"}
+    if re.match(r"^\d+x\d+$", shape):
+        context["shape"] = shape
+    if data_type in ["float", "double"]:
+        context["data_type"] = data_type
+    return context
+
 def run():
     platform_run_script = "run_all.sh"
     if platform.system() == "Windows":
@@ -29,13 +105,26 @@ def run():
 if __name__ == "__main__":
     parser = argparse.ArgumentParser()
     parser.add_argument("-c", "--count", default=1, type=int)
+    parser.add_argument("-j", "--jobs", default=1, type=int, help="Number of timing cases to run concurrently, each pinned to its own core")
+    parser.add_argument("--cores", nargs="*", type=int, default=None, help="Specific (e.g. isolated) core ids to pin timing runs to. Defaults to the process affinity set")
+    parser.add_argument("--json", default=None, help="Also write the aggregated results to this file as JSON")
     args = parser.parse_args()
 
-    accumulated_result_lines = []
-    print("Running {} time(s)...".format(args.count))
-    for i in range(args.count):
-        accumulated_result_lines.extend(run())
-        print("{}/{} complete".format(i + 1, args.count))
-    
+    runners = find_runners()
+    if runners:
+        cores = args.cores if args.cores else get_available_cores()
+        cores = cores[:max(1, args.jobs)]
+        print("Running {} implementation(s) x {} repetition(s) on core(s) {}...".format(len(runners), args.count, cores))
+        accumulated_result_lines = run_comparison(runners, args.count, cores)
+    else:
+        # no built Runner executables found; fall back to the single-process run_all script
+        accumulated_result_lines = []
+        print("Running {} time(s)...".format(args.count))
+        for i in range(args.count):
+            accumulated_result_lines.extend(run())
+            print("{}/{} complete".format(i + 1, args.count))
+
     results_dict = timing_aggregator.parse_output(accumulated_result_lines)
-    timing_aggregator.print_results(results_dict)
\ No newline at end of file
+    timing_aggregator.print_results(results_dict)
+    if args.json:
+        timing_aggregator.write_json(results_dict, args.json, get_case_context())
@@ -11,6 +11,7 @@
 
 import re
 import argparse
+import json
 import operator
 
 class TimingResult:
@@ -84,12 +85,39 @@ def print_results(results_dict, include_raw_results=True, include_statistics=Tru
         for (key, ratio) in ratios_list:
             print("{} : {}".format(key, ratio))
 
+def results_to_records(results_dict, context={}):
+    """Flattens timing results into a list of per-implementation records, each merged with the
+    given context (node, data type, shape, ...) so records from many cases can be concatenated
+    into one result matrix"""
+    records = []
+    for key in sorted(results_dict):
+        result = results_dict[key]
+        record = dict(context)
+        record["implementation"] = result.key
+        record["count"] = result.count
+        record["average"] = result.average
+        if result.count > 0:
+            record["min"] = result.result_range[0]
+            record["max"] = result.result_range[1]
+        record["times"] = result.result_values
+        records.append(record)
+    return records
+
+def write_json(results_dict, filename, context={}):
+    with open(filename, 'w') as f:
+        json.dump(results_to_records(results_dict, context), f, indent=2)
+        f.write("\n")
+    print("Wrote {} result record(s) to {}".format(len(results_dict), filename))
+
 if __name__ == "__main__":
     parser = argparse.ArgumentParser()
     parser.add_argument("-f", "--file", required=True)
+    parser.add_argument("-j", "--json", default=None, help="Also write the results to this file as JSON")
     args = parser.parse_args()
 
     with open(args.file, 'r') as f:
         lines = f.readlines()
     results_dict = parse_output(lines)
     print_results(results_dict)
+    if args.json:
+        write_json(results_dict, args.json)
@@ -35,14 +35,14 @@ def partition_list(input_list, max_partition_size):
     return partitions
 
 
-def profile_and_optimize_models_segmented(segment_size, model_path, temp_dir, output_path, ell_root, ell_build_root, all_profile_options, models, target, platform_regex, parallel_build_count, parallel_run_count, include_exercise_models, logging_args):
+def profile_and_optimize_models_segmented(segment_size, model_path, temp_dir, output_path, ell_root, ell_build_root, all_profile_options, models, target, platform_regex, parallel_build_count, parallel_run_count, run_batch_size, include_exercise_models, logging_args):
     # partition the models by segment_size
     model_partitions = partition_list(models, segment_size)
     for model_partition in model_partitions:
-        profile_and_optimize_models(model_path, temp_dir, output_path, ell_root, ell_build_root, all_profile_options, model_partition, target, platform_regex, parallel_build_count, parallel_run_count, include_exercise_models, logging_args)
+        profile_and_optimize_models(model_path, temp_dir, output_path, ell_root, ell_build_root, all_profile_options, model_partition, target, platform_regex, parallel_build_count, parallel_run_count, run_batch_size, include_exercise_models, logging_args)
 
 
-def profile_and_optimize_models(model_path, temp_dir, output_path, ell_root, ell_build_root, all_profile_options, models, target, platform_regex, parallel_build_count, parallel_run_count, include_exercise_models, logging_args):
+def profile_and_optimize_models(model_path, temp_dir, output_path, ell_root, ell_build_root, all_profile_options, models, target, platform_regex, parallel_build_count, parallel_run_count, run_batch_size, include_exercise_models, logging_args):
     os.makedirs(temp_dir, exist_ok=True)
     os.makedirs(output_path, exist_ok=True)
     all_profiler_data = profile_builder.build_model_profilers(model_path=model_path,
@@ -65,6 +65,7 @@ def profile_and_optimize_models(model_path, temp_dir, output_path, ell_root, ell
                                                                                             target=target,
                                                                                             platform_regex=platform_regex,
                                                                                             parallel_run=parallel_run_count,
+                                                                                            batch_size=run_batch_size,
                                                                                             logging_args=args)
 
     merged_model_paths = { profiler_data.model_tag : profiler_data.model_path for profiler_data in all_profiler_data }
@@ -117,5 +118,6 @@ if __name__ == "__main__":
                                           platform_regex=args.platform_regex,
                                           parallel_build_count=args.parallel_build,
                                           parallel_run_count=args.parallel_run,
+                                          run_batch_size=args.batch_size,
                                           include_exercise_models=args.include_exercise_models,
                                           logging_args=args)
@@ -187,7 +187,7 @@ class BuildJob():
 def build_model_profilers(model_path, output_path, ell_root, ell_build_root, all_profile_options, models=None, target="pi3", parallel_count=1, include_exercise_models=False):
     os.makedirs(output_path, exist_ok=True)
     all_profiler_data = optimizer_util.make_profiler_data(model_path, output_path, all_profile_options, models)
-    build_jobs = [BuildJob(profiler_data, ell_root, ell_build_root, target) for profiler_data in all_profiler_data]
+    build_jobs = [BuildJob(profiler_data, ell_root, ell_build_root, target, include_exercise_models=include_exercise_models) for profiler_data in all_profiler_data]
     values = [dask.delayed(job.run)() for job in build_jobs]
     if len(build_jobs) < parallel_count:
         parallel_count = len(build_jobs)
@@ -14,6 +14,7 @@ import sys
 import argparse
 import os
 import shutil
+import tempfile
 from dask import compute, delayed
 import dask.multiprocessing
 
@@ -90,7 +91,119 @@ class RemoteProfileRunner:
             global_logger.error("### Caught exception while running remote command: {}: {}\n{}".format(errorType, value, traceback))
 
 
-def run_profilers_with_profiler_data(all_profiler_data, output_path, cluster_address, ipaddress, api_key, password, username="pi", target="pi3", platform_regex=None, parallel_run=24, logging_args=None):
+class BatchedProfileRunner:
+    """Deploys and runs a batch of built candidate profilers in a single round-trip to one device.
+    The candidates are staged into per-candidate subdirectories, copied over together, built and
+    run one after another by a generated batch script, and all of the reports are copied back in
+    one pass, so the per-deployment overhead (machine claim, ssh setup, file transfer) is paid
+    once per batch instead of once per candidate."""
+
+    batch_script_name = "run_batch.sh"
+
+    def __init__(self, batch_profiler_data, cluster, fallback_ip_address, username, password, output_path_root, platform_re=None, ignore_extensions=[".ll", ".bc"], logging_args=None):
+        self.batch_profiler_data = batch_profiler_data
+        self.cluster = cluster
+        self.fallback_ip_address = fallback_ip_address
+        self.username = username
+        self.password = password
+        self.output_path_root = output_path_root
+        self.platform_re = platform_re
+        self.machine = None
+        self.ipaddress = None
+        self.ignore_extensions = ignore_extensions
+        self.logging_args = logging_args
+        self.friendly_name = "optimization profiler batch : {} candidates".format(len(batch_profiler_data))
+
+    def make_staging_dir(self, copyback_files):
+        # Stage each candidate's built files into a subdirectory of a common staging directory,
+        # and generate a script at the root that builds and runs each candidate in turn. The
+        # reports get copied up to the batch root under unique names so a single copy-back pass
+        # can retrieve all of them.
+        staging_dir = tempfile.mkdtemp(prefix="profiler_batch_")
+        script_lines = ["#!/bin/bash", ""]
+        for profiler_data in self.batch_profiler_data:
+            subdir_name = os.path.basename(profiler_data.built_profilers_path)
+            subdir_path = os.path.join(staging_dir, subdir_name)
+            os.makedirs(subdir_path)
+            source_dir_files = os.listdir(profiler_data.built_profilers_path)
+            ignore_files = [filename for filename in source_dir_files if True in [filename.endswith(ext) for ext in self.ignore_extensions]]
+            ignore_files.extend(copyback_files)
+            for filename in source_dir_files:
+                if filename not in ignore_files:
+                    shutil.copy(os.path.join(profiler_data.built_profilers_path, filename), os.path.join(subdir_path, filename))
+
+            script_lines.append("cd {}".format(subdir_name))
+            script_lines.append("chmod u+x ./{}".format(profiler_data.command.split(" ")[0]))
+            script_lines.append("./{}".format(profiler_data.command))
+            for copyback_file in copyback_files:
+                script_lines.append("if [[ -f {0} ]] ; then cp {0} ../{1}_{0} ; fi".format(copyback_file, subdir_name))
+            script_lines.append("cd ..")
+            script_lines.append("")
+
+        script_path = os.path.join(staging_dir, self.batch_script_name)
+        with open(script_path, "w", newline="\n") as script_file:
+            script_file.write("\n".join(script_lines))
+        return staging_dir
+
+    def run(self):
+        copyback_files = ["profile_report_noopt.txt", "profile_report_opt.txt"]
+        if self.cluster:
+            self.machine = self.cluster.wait_for_free_machine(self.friendly_name, rePlatform=self.platform_re)
+            self.ipaddress = self.machine.ip_address
+        else:
+            self.ipaddress = self.fallback_ip_address
+
+        staging_dir = self.make_staging_dir(copyback_files)
+        batch_copyback_dir = tempfile.mkdtemp(prefix="profiler_batch_results_")
+        batch_copyback_files = ["{}_{}".format(os.path.basename(profiler_data.built_profilers_path), copyback_file)
+                                for profiler_data in self.batch_profiler_data
+                                for copyback_file in copyback_files]
+
+        runner = remoterunner.RemoteRunner(ipaddress=self.ipaddress,
+                                           username=self.username,
+                                           password=self.password,
+                                           source_dir=staging_dir,
+                                           target_dir=remote_working_directory,
+                                           copyback_files=batch_copyback_files,
+                                           copyback_dir=batch_copyback_dir,
+                                           command=self.batch_script_name,
+                                           start_clean=True,
+                                           cleanup=True,
+                                           logfile=self.logging_args)
+        try:
+            runner.run_command()
+            if self.cluster:
+                self.cluster.unlock(self.ipaddress)
+
+            # Dispatch the copied-back reports to the same per-candidate locations and names
+            # that the unbatched runner produces
+            batch_results = []
+            for profiler_data in self.batch_profiler_data:
+                subdir_name = os.path.basename(profiler_data.built_profilers_path)
+                candidate_output_path = os.path.join(self.output_path_root, profiler_data.model_tag)
+                os.makedirs(candidate_output_path, exist_ok=True)
+                profile_files = []
+                for copyback_file in copyback_files:
+                    src_path = os.path.join(batch_copyback_dir, "{}_{}".format(subdir_name, copyback_file))
+                    if not os.path.isfile(src_path):
+                        global_logger.error("Missing report {} for candidate {}".format(copyback_file, profiler_data.friendly_name))
+                        continue
+                    shutil.copy(src_path, os.path.join(profiler_data.built_profilers_path, copyback_file))
+                    dst_name = "{}_{}_{}".format(profiler_data.model_name, profiler_data.profile_options.to_short_string(), copyback_file)
+                    dst_path = os.path.join(candidate_output_path, dst_name)
+                    shutil.copy(src_path, dst_path)
+                    profile_files.append(dst_path)
+                batch_results.append((profiler_data, profile_files))
+            return batch_results
+        except:
+            errorType, value, traceback = sys.exc_info()
+            global_logger.error("### Caught exception while running remote batch: {}: {}\n{}".format(errorType, value, traceback))
+        finally:
+            shutil.rmtree(staging_dir, ignore_errors=True)
+            shutil.rmtree(batch_copyback_dir, ignore_errors=True)
+
+
+def run_profilers_with_profiler_data(all_profiler_data, output_path, cluster_address, ipaddress, api_key, password, username="pi", target="pi3", platform_regex=None, parallel_run=24, batch_size=1, logging_args=None):
     if not platform_regex:
         if target in default_platform_regex:
             platform_regex = default_platform_regex[target]
@@ -98,9 +211,6 @@ def run_profilers_with_profiler_data(all_profiler_data, output_path, cluster_add
             global_logger.error("Platform regex not specified and no default platform regex for {} exists in {}.".format(target, default_platform_regex))
             return
 
-    if len(all_profiler_data) < parallel_run:
-        parallel_run = len(all_profiler_data)
-
     cluster = None
     if cluster_address:
         cluster = picluster.PiBoardTable(cluster_address, api_key)
@@ -108,21 +218,48 @@ def run_profilers_with_profiler_data(all_profiler_data, output_path, cluster_add
         global_logger.info("Cluster not specified, using device with ip {} for testing and setting parallel run count to 1".format(ipaddress))
         parallel_run = 1
 
-    global_logger.info("Running {} profiles".format(len(all_profiler_data)))
-    runners = [RemoteProfileRunner(profiler_data,
-                                    cluster,
-                                    ipaddress,
-                                    username,
-                                    password,
-                                    os.path.join(output_path, profiler_data.model_tag),
-                                    platform_regex,
-                                    logging_args=logging_args)
-                                    for profiler_data in all_profiler_data]
-    values = [delayed(runner.run)() for runner in runners]
-    results = compute(*values, scheduler="threads", num_workers=parallel_run)
+    if batch_size > 1:
+        # Group the candidates into batches and deploy each batch to a device in a single
+        # round-trip, instead of paying the deployment overhead once per candidate
+        batches = [all_profiler_data[index : index + batch_size] for index in range(0, len(all_profiler_data), batch_size)]
+        if len(batches) < parallel_run:
+            parallel_run = len(batches)
+        global_logger.info("Running {} profiles in {} batches of up to {}".format(len(all_profiler_data), len(batches), batch_size))
+        runners = [BatchedProfileRunner(batch,
+                                        cluster,
+                                        ipaddress,
+                                        username,
+                                        password,
+                                        output_path,
+                                        platform_regex,
+                                        logging_args=logging_args)
+                                        for batch in batches]
+        values = [delayed(runner.run)() for runner in runners]
+        batch_results = compute(*values, scheduler="threads", num_workers=parallel_run)
+        results = []
+        for batch_result in batch_results:
+            if batch_result is None:
+                global_logger.error("Batch run failure detected")
+            else:
+                results.extend(batch_result)
+    else:
+        if len(all_profiler_data) < parallel_run:
+            parallel_run = len(all_profiler_data)
+        global_logger.info("Running {} profiles".format(len(all_profiler_data)))
+        runners = [RemoteProfileRunner(profiler_data,
+                                        cluster,
+                                        ipaddress,
+                                        username,
+                                        password,
+                                        os.path.join(output_path, profiler_data.model_tag),
+                                        platform_regex,
+                                        logging_args=logging_args)
+                                        for profiler_data in all_profiler_data]
+        values = [delayed(runner.run)() for runner in runners]
+        results = compute(*values, scheduler="threads", num_workers=parallel_run)
+        if None in results:
+            global_logger.error("Run failures detected, results = {}".format(results))
     global_logger.info("Done running profiling")
-    if None in results:
-        global_logger.error("Run failures detected, results = {}".format(results))
     tag_to_profile_options_and_files_dict = {}
     for result in results:
         if result:
@@ -137,15 +274,27 @@ def run_profilers_with_profiler_data(all_profiler_data, output_path, cluster_add
     return tag_to_profile_options_and_files_dict
 
 
-def run_profilers(input_path, model_path, models, output_path, all_profile_options, cluster, ipaddress, api_key, password, username="pi", target="pi3", platform_regex=None, parallel_run=24, logging_args=None):
+def run_profilers(input_path, model_path, models, output_path, all_profile_options, cluster, ipaddress, api_key, password, username="pi", target="pi3", platform_regex=None, parallel_run=24, batch_size=1, logging_args=None):
     os.makedirs(output_path, exist_ok=True)
     all_profiler_data = optimizer_util.make_profiler_data(model_path, input_path, all_profile_options, models)
-    run_profilers_with_profiler_data(all_profiler_data, output_path, target, platform_regex, parallel_run, logging_args)
+    run_profilers_with_profiler_data(all_profiler_data=all_profiler_data,
+                                     output_path=output_path,
+                                     cluster_address=cluster,
+                                     ipaddress=ipaddress,
+                                     api_key=api_key,
+                                     password=password,
+                                     username=username,
+                                     target=target,
+                                     platform_regex=platform_regex,
+                                     parallel_run=parallel_run,
+                                     batch_size=batch_size,
+                                     logging_args=logging_args)
 
 
 def add_profile_runner_args(arg_parser):
     arg_parser.add_argument("--platform_regex", help="Regex to match test platform name on. Defaults = {}".format(default_platform_regex))
     arg_parser.add_argument("--parallel_run", help="The maximum number of profile operations to run in parallel. Also the maximum number of devices to attempt to claim.", default=24, type=int)
+    arg_parser.add_argument("--batch_size", help="The number of candidate profilers to deploy and run per device round-trip. Batching amortizes the deployment overhead (machine claim, ssh setup, file transfer) over several candidates.", default=8, type=int)
     arg_parser.add_argument("--cluster", help="http address of the cluster server that controls access to the target devices", default=os.getenv("RPI_CLUSTER"))
     arg_parser.add_argument("--ipaddress", help="The address of the target device if you don't have a cluster")
     arg_parser.add_argument("--apikey", help="The ApiKey to use for the cluster", default=os.getenv("RPI_APIKEY"))
@@ -177,4 +326,5 @@ if __name__ == "__main__":
                   target=args.target,
                   platform_regex=args.platform_regex,
                   parallel_run=args.parallel_run,
+                  batch_size=args.batch_size,
                   logging_args=args)
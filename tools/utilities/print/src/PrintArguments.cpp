@@ -20,6 +20,7 @@ void ParsedPrintArguments::AddArgs(utilities::CommandLineParser& parser)
     parser.AddOption(compile, "compile", "c", "If true, the model is compiled before being printed", false);
     parser.AddOption(includeNodeId, "includeNodeId", "incid", "Include the node id in the print", false);
     parser.AddOption(nodeDetails, "nodeDetails", "", "Include node details", true);
+    parser.AddOption(summarize, "summarize", "s", "Print a summary of the model's memory footprint and arithmetic intensity", false);
 }
 
 utilities::CommandLineParseResult ParsedPrintArguments::PostProcess(const utilities::CommandLineParser& parser)
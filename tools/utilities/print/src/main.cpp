@@ -132,6 +132,17 @@ int main(int argc, char* argv[])
         {
             PrintModel(model, out, { printArguments.includeNodeId, printArguments.nodeDetails });
         }
+
+        if (printArguments.summarize)
+        {
+            auto footprint = model::Map::ComputeMemoryFootprint(model);
+            out << "\n";
+            out << "Weight bytes: " << footprint.weightBytes << "\n";
+            out << "Peak activation bytes: " << footprint.peakActivationBytes << "\n";
+            out << "Total activation bytes: " << footprint.totalActivationBytes << "\n";
+            out << "Multiply-accumulates: " << footprint.multiplyAccumulates << "\n";
+            out << "Arithmetic intensity (MACs/byte): " << footprint.GetArithmeticIntensity() << "\n";
+        }
     }
     catch (const utilities::CommandLineParserPrintHelpException& exception)
     {
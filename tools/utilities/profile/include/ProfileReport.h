@@ -19,10 +19,12 @@
 using ELL_ProfileRegionInfo = ell::emitters::ProfileRegionInfo;
 using ELL_NodeInfo = ell::model::NodeInfo;
 using ELL_PerformanceCounters = ell::model::PerformanceCounters;
+using ELL_ModelMemoryStats = ell::model::ModelMemoryStats;
 
 #endif // COMPILED_ELL_PROFILER
 
 #include <iomanip>
+#include <istream>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -37,9 +39,43 @@ enum class ProfileOutputFormat
     json
 };
 
+//
+// Summary statistics over per-iteration time samples
+//
+struct ProfileTimingStats
+{
+    double mean = 0;
+    double stdDev = 0;
+    double median = 0;
+    double percentile95 = 0;
+    double percentile99 = 0;
+    int count = 0;
+};
+
+// Per-node (or whole-model) timing distribution
+struct NodeTimingInfo
+{
+    std::string name;
+    std::string type;
+    ProfileTimingStats stats;
+};
+
+// Computes mean, stddev (sample), median, and tail percentiles from a set of time samples
+ProfileTimingStats ComputeTimingStats(std::vector<double> samples);
+
 std::string EncodeJSONString(const std::string& str);
 
 void WriteUserComment(const std::string& comment, ProfileOutputFormat format, std::ostream& out);
 void WriteModelStatistics(const ELL_PerformanceCounters* modelStats, ProfileOutputFormat format, std::ostream& out);
+void WriteModelMemoryStats(const ELL_ModelMemoryStats* memoryStats, ProfileOutputFormat format, std::ostream& out);
 void WriteNodeStatistics(std::vector<std::pair<ELL_NodeInfo, ELL_PerformanceCounters>>& nodeInfo, std::vector<std::pair<ELL_NodeInfo, ELL_PerformanceCounters>>& nodeTypeInfo, ProfileOutputFormat format, std::ostream& out);
 void WriteRegionStatistics(std::vector<ELL_ProfileRegionInfo>& regions, ProfileOutputFormat format, std::ostream& out);
+void WriteNodeTimingStatistics(const std::vector<NodeTimingInfo>& nodeTimings, ProfileOutputFormat format, std::ostream& out);
+
+// Reading and writing timing-stats files (one tab-separated line per node), for comparing two profile runs
+void WriteNodeTimingFile(const std::vector<NodeTimingInfo>& nodeTimings, std::ostream& out);
+std::vector<NodeTimingInfo> ReadNodeTimingFile(std::istream& in);
+
+// Compares two profile runs node-by-node with Welch's t-test, flagging deltas whose t statistic
+// exceeds the given threshold (2.0 corresponds roughly to 95% confidence)
+void WriteTimingComparison(const std::vector<NodeTimingInfo>& baseline, const std::vector<NodeTimingInfo>& current, double significanceThreshold, std::ostream& out);
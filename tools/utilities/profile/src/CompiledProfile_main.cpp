@@ -13,12 +13,17 @@
 
 #include <algorithm>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <random>
 #include <string>
 #include <vector>
 #include <random>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 struct ProfileArguments
 {
     std::string outputFilename;
@@ -26,8 +31,24 @@ struct ProfileArguments
     ProfileOutputFormat outputFormat;
     int numIterations;
     int numWarmUpIterations;
+    std::string statsOutputFilename; // if set, write per-node timing stats here
+    std::string baselineStatsFilename; // if set, compare against the stats in this file
 };
 
+// Pins the measurement thread to the core it is currently running on, so samples aren't
+// perturbed by migrations between cores. Returns false on platforms without affinity support.
+bool PinThreadToCurrentCore()
+{
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(sched_getcpu(), &cpuSet);
+    return sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0;
+#else
+    return false;
+#endif
+}
+
 //
 // Test-data-related
 //
@@ -56,6 +77,13 @@ void WriteModelStatistics(ProfileOutputFormat format, std::ostream& out)
     WriteModelStatistics(modelStats, format, out);
 }
 
+void WriteModelMemoryStats(ProfileOutputFormat format, std::ostream& out)
+{
+    // get the compile-time memory stats baked into the model
+    auto memoryStats = ELL_GetMemoryStats();
+    WriteModelMemoryStats(memoryStats, format, out);
+}
+
 void WriteNodeStatistics(ProfileOutputFormat format, std::ostream& out)
 {
     // Gather node statistics
@@ -140,6 +168,12 @@ void ProfileModel(const ProfileArguments& profileArguments, InputType lowDataVal
     ELL_PredictWrapper wrapper;
 #endif
 
+    // Pin the thread before any timing, so warmup and measurement run on the same core
+    if (!PinThreadToCurrentCore())
+    {
+        std::cerr << "Warning: couldn't pin the measurement thread to a core; timings may be noisier" << std::endl;
+    }
+
     // Warm up the system by evaluating the model some number of times
     for (int iter = 0; iter < profileArguments.numWarmUpIterations; ++iter)
     {
@@ -151,7 +185,14 @@ void ProfileModel(const ProfileArguments& profileArguments, InputType lowDataVal
     }
     ResetProfilingInfo();
 
-    // Now evaluate the model and record the profiling info
+    // Now evaluate the model and record the profiling info. The node counters only accumulate
+    // totals, so take the per-iteration difference of each node's total time to build up a
+    // distribution of samples per node (and for the model as a whole).
+    auto numNodes = ELL_GetNumNodes();
+    std::vector<double> previousNodeTimes(numNodes, 0.0);
+    std::vector<std::vector<double>> nodeSamples(numNodes);
+    double previousModelTime = 0;
+    std::vector<double> modelSamples;
     for (int iter = 0; iter < profileArguments.numIterations; ++iter)
     {
         // Exercise the model
@@ -160,7 +201,25 @@ void ProfileModel(const ProfileArguments& profileArguments, InputType lowDataVal
 #else
         ELL_Predict(nullptr, input.data(), output.data());
 #endif
+
+        for (int nodeIndex = 0; nodeIndex < numNodes; ++nodeIndex)
+        {
+            auto nodeTotalTime = ELL_GetNodePerformanceCounters(nodeIndex)->totalTime;
+            nodeSamples[nodeIndex].push_back(nodeTotalTime - previousNodeTimes[nodeIndex]);
+            previousNodeTimes[nodeIndex] = nodeTotalTime;
+        }
+        auto modelTotalTime = ELL_GetModelPerformanceCounters()->totalTime;
+        modelSamples.push_back(modelTotalTime - previousModelTime);
+        previousModelTime = modelTotalTime;
+    }
+
+    std::vector<NodeTimingInfo> nodeTimings;
+    for (int nodeIndex = 0; nodeIndex < numNodes; ++nodeIndex)
+    {
+        auto info = ELL_GetNodeInfo(nodeIndex);
+        nodeTimings.push_back({ (const char*)(info->nodeName), (const char*)(info->nodeType), ComputeTimingStats(std::move(nodeSamples[nodeIndex])) });
     }
+    nodeTimings.push_back({ "<model>", "Model", ComputeTimingStats(std::move(modelSamples)) });
 
     auto format = profileArguments.outputFormat;
 
@@ -172,8 +231,10 @@ void ProfileModel(const ProfileArguments& profileArguments, InputType lowDataVal
             WriteUserComment(comment, format, profileOutputStream);
         }
         WriteNodeStatistics(format, profileOutputStream);
+        WriteNodeTimingStatistics(nodeTimings, format, profileOutputStream);
         WriteRegionStatistics(format, profileOutputStream);
         WriteModelStatistics(format, profileOutputStream);
+        WriteModelMemoryStats(format, profileOutputStream);
     }
     else
     {
@@ -185,11 +246,38 @@ void ProfileModel(const ProfileArguments& profileArguments, InputType lowDataVal
         }
         WriteNodeStatistics(format, profileOutputStream);
         profileOutputStream << ",\n";
+        WriteNodeTimingStatistics(nodeTimings, format, profileOutputStream);
+        profileOutputStream << ",\n";
         WriteRegionStatistics(format, profileOutputStream);
         profileOutputStream << ",\n";
         WriteModelStatistics(format, profileOutputStream);
+        profileOutputStream << ",\n";
+        WriteModelMemoryStats(format, profileOutputStream);
         profileOutputStream << "}\n";
     }
+
+    // Save the timing stats for use as a future baseline, if requested
+    if (!profileArguments.statsOutputFilename.empty())
+    {
+        std::ofstream statsStream(profileArguments.statsOutputFilename);
+        WriteNodeTimingFile(nodeTimings, statsStream);
+    }
+
+    // Compare against a previously-saved baseline, if requested
+    if (!profileArguments.baselineStatsFilename.empty())
+    {
+        std::ifstream baselineStream(profileArguments.baselineStatsFilename);
+        if (!baselineStream)
+        {
+            std::cerr << "Error: couldn't open baseline stats file " << profileArguments.baselineStatsFilename << std::endl;
+        }
+        else
+        {
+            auto baseline = ReadNodeTimingFile(baselineStream);
+            const double significanceThreshold = 2.0; // roughly 95% confidence
+            WriteTimingComparison(baseline, nodeTimings, significanceThreshold, profileOutputStream);
+        }
+    }
 }
 
 int main(int argc, char* argv[])
@@ -199,6 +287,8 @@ int main(int argc, char* argv[])
 
     int numIterations = 20;
     int numWarmUpIterations = 10;
+    std::string statsOutputFilename;
+    std::string baselineStatsFilename;
     if (argc > 1)
     {
         numIterations = atoi(argv[1]);
@@ -207,13 +297,24 @@ int main(int argc, char* argv[])
     {
         numWarmUpIterations = atoi(argv[2]);
     }
+    if (argc > 3)
+    {
+        statsOutputFilename = argv[3];
+    }
+    if (argc > 4)
+    {
+        baselineStatsFilename = argv[4];
+    }
 
     std::cout << "Profiling model with " << numWarmUpIterations << " warm-up iterations and " << numIterations << " timed iterations" << std::endl;
+    std::cout << "Usage: " << argv[0] << " [numIterations [numWarmUpIterations [statsOutputFile [baselineStatsFile]]]]" << std::endl;
 
     // add arguments to the command line parser
     ProfileArguments profileArguments;
     profileArguments.numWarmUpIterations = numWarmUpIterations;
     profileArguments.numIterations = numIterations;
+    profileArguments.statsOutputFilename = statsOutputFilename;
+    profileArguments.baselineStatsFilename = baselineStatsFilename;
     profileArguments.outputFormat = ProfileOutputFormat::text;
     ProfileModel<InputType, OutputType>(profileArguments, 0.0f, 1.0f);
 
@@ -9,8 +9,10 @@
 #include "ProfileReport.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <iomanip>
+#include <map>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -91,6 +93,23 @@ void WriteModelStatistics(const ELL_PerformanceCounters* modelStats, ProfileOutp
     }
 }
 
+void WriteModelMemoryStats(const ELL_ModelMemoryStats* memoryStats, ProfileOutputFormat format, std::ostream& out)
+{
+    if (format == ProfileOutputFormat::text)
+    {
+        out << "\nModel memory" << std::endl;
+        out << "Global buffers: " << memoryStats->globalBufferBytes << " bytes\tpeak intermediate: " << memoryStats->peakIntermediateBytes << " bytes\tpeak stack scratch: " << memoryStats->peakStackScratchBytes << " bytes" << std::endl;
+    }
+    else // json
+    {
+        out << "\"model_memory\": {\n";
+        out << "  \"global_buffer_bytes\": " << memoryStats->globalBufferBytes << ",\n";
+        out << "  \"peak_intermediate_bytes\": " << memoryStats->peakIntermediateBytes << ",\n";
+        out << "  \"peak_stack_scratch_bytes\": " << memoryStats->peakStackScratchBytes << "\n";
+        out << "}";
+    }
+}
+
 void WriteNodeStatistics(std::vector<std::pair<ELL_NodeInfo, ELL_PerformanceCounters>>& nodeInfo, std::vector<std::pair<ELL_NodeInfo, ELL_PerformanceCounters>>& nodeTypeInfo, ProfileOutputFormat format, std::ostream& out)
 {
     // Write node statistics
@@ -180,15 +199,22 @@ void WriteRegionStatistics(std::vector<ELL_ProfileRegionInfo>& regions, ProfileO
             out.precision(5);
 
             size_t maxNameLength = 0;
+            bool haveHardwareCounters = false;
             for (const auto& info : regions)
             {
                 maxNameLength = std::max(maxNameLength, std::strlen((const char*)(info.name)));
+                haveHardwareCounters |= (info.cacheMisses != 0 || info.branchMisses != 0);
             }
 
             out << "\nRegion statistics" << std::endl;
             for (const auto& info : regions)
             {
-                out << "Region[" << info.name << "]:\t" << std::setw(maxNameLength) << std::left << "\ttime: " << info.totalTime << " ms\tcount: " << info.count << "\n";
+                out << "Region[" << info.name << "]:\t" << std::setw(maxNameLength) << std::left << "\ttime: " << info.totalTime << " ms\tcount: " << info.count;
+                if (haveHardwareCounters)
+                {
+                    out << "\tcache misses: " << info.cacheMisses << "\tbranch misses: " << info.branchMisses;
+                }
+                out << "\n";
             }
 
             out << "\n\n";
@@ -205,6 +231,8 @@ void WriteRegionStatistics(std::vector<ELL_ProfileRegionInfo>& regions, ProfileO
                 << "\"" << EncodeJSONString((const char*)(info.name)) << "\",\n";
             out << "    \"total_time\": " << info.totalTime << ",\n";
             out << "    \"average_time\": " << info.totalTime / info.count << ",\n";
+            out << "    \"cache_misses\": " << info.cacheMisses << ",\n";
+            out << "    \"branch_misses\": " << info.branchMisses << ",\n";
             out << "    \"count\": " << info.count << "\n";
             out << "  }";
             bool isLast = (&info == &regions.back());
@@ -218,6 +246,180 @@ void WriteRegionStatistics(std::vector<ELL_ProfileRegionInfo>& regions, ProfileO
     }
 }
 
+static double GetPercentile(const std::vector<double>& sortedSamples, double percentile)
+{
+    auto n = sortedSamples.size();
+    auto index = static_cast<size_t>(std::ceil(percentile * n));
+    index = index > 0 ? index - 1 : 0;
+    index = std::min(index, n - 1);
+    return sortedSamples[index];
+}
+
+ProfileTimingStats ComputeTimingStats(std::vector<double> samples)
+{
+    ProfileTimingStats stats;
+    if (samples.empty())
+    {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    auto n = samples.size();
+    stats.count = static_cast<int>(n);
+
+    double sum = 0;
+    for (auto sample : samples)
+    {
+        sum += sample;
+    }
+    stats.mean = sum / n;
+
+    double sumSquaredDeviations = 0;
+    for (auto sample : samples)
+    {
+        sumSquaredDeviations += (sample - stats.mean) * (sample - stats.mean);
+    }
+    stats.stdDev = n > 1 ? std::sqrt(sumSquaredDeviations / (n - 1)) : 0;
+
+    stats.median = GetPercentile(samples, 0.5);
+    stats.percentile95 = GetPercentile(samples, 0.95);
+    stats.percentile99 = GetPercentile(samples, 0.99);
+    return stats;
+}
+
+void WriteNodeTimingStatistics(const std::vector<NodeTimingInfo>& nodeTimings, ProfileOutputFormat format, std::ostream& out)
+{
+    if (format == ProfileOutputFormat::text)
+    {
+        if (nodeTimings.empty())
+        {
+            return;
+        }
+        std::ios::fmtflags savedFlags(out.flags());
+        out << std::fixed;
+        out.precision(5);
+
+        size_t maxNameLength = 0;
+        for (const auto& timing : nodeTimings)
+        {
+            maxNameLength = std::max(maxNameLength, timing.name.size());
+        }
+
+        out << "\nNode timing distributions (per iteration)" << std::endl;
+        for (const auto& timing : nodeTimings)
+        {
+            const auto& stats = timing.stats;
+            out << std::setw(maxNameLength) << std::left << timing.name << "\tmean: " << stats.mean << " ms\tstddev: " << stats.stdDev << " ms\tmedian: " << stats.median << " ms\tp95: " << stats.percentile95 << " ms\tp99: " << stats.percentile99 << " ms\tcount: " << stats.count << "\n";
+        }
+
+        out.flags(savedFlags);
+    }
+    else // json
+    {
+        out << "\"node_timing_statistics\": [\n";
+        for (const auto& timing : nodeTimings)
+        {
+            const auto& stats = timing.stats;
+            out << "  {\n";
+            out << "    \"name\": "
+                << "\"" << EncodeJSONString(timing.name) << "\",\n";
+            out << "    \"type\": "
+                << "\"" << EncodeJSONString(timing.type) << "\",\n";
+            out << "    \"mean\": " << stats.mean << ",\n";
+            out << "    \"stddev\": " << stats.stdDev << ",\n";
+            out << "    \"median\": " << stats.median << ",\n";
+            out << "    \"p95\": " << stats.percentile95 << ",\n";
+            out << "    \"p99\": " << stats.percentile99 << ",\n";
+            out << "    \"count\": " << stats.count << "\n";
+            out << "  }";
+            bool isLast = (&timing == &nodeTimings.back());
+            if (!isLast)
+            {
+                out << ",";
+            }
+            out << "\n";
+        }
+        out << "]";
+    }
+}
+
+void WriteNodeTimingFile(const std::vector<NodeTimingInfo>& nodeTimings, std::ostream& out)
+{
+    out.precision(9);
+    for (const auto& timing : nodeTimings)
+    {
+        const auto& stats = timing.stats;
+        out << timing.name << "\t" << timing.type << "\t" << stats.mean << "\t" << stats.stdDev << "\t" << stats.median << "\t" << stats.percentile95 << "\t" << stats.percentile99 << "\t" << stats.count << "\n";
+    }
+}
+
+std::vector<NodeTimingInfo> ReadNodeTimingFile(std::istream& in)
+{
+    std::vector<NodeTimingInfo> result;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        std::stringstream lineStream(line);
+        NodeTimingInfo timing;
+        std::getline(lineStream, timing.name, '\t');
+        std::getline(lineStream, timing.type, '\t');
+        lineStream >> timing.stats.mean >> timing.stats.stdDev >> timing.stats.median >> timing.stats.percentile95 >> timing.stats.percentile99 >> timing.stats.count;
+        if (!lineStream.fail())
+        {
+            result.push_back(timing);
+        }
+    }
+    return result;
+}
+
+void WriteTimingComparison(const std::vector<NodeTimingInfo>& baseline, const std::vector<NodeTimingInfo>& current, double significanceThreshold, std::ostream& out)
+{
+    std::map<std::string, const NodeTimingInfo*> baselineByName;
+    for (const auto& timing : baseline)
+    {
+        baselineByName[timing.name] = &timing;
+    }
+
+    std::ios::fmtflags savedFlags(out.flags());
+    out << std::fixed;
+    out.precision(5);
+
+    out << "\nComparison against baseline (|t| > " << significanceThreshold << " flagged)" << std::endl;
+    int numSignificant = 0;
+    for (const auto& timing : current)
+    {
+        auto baselineIter = baselineByName.find(timing.name);
+        if (baselineIter == baselineByName.end())
+        {
+            out << timing.name << "\tnot in baseline\n";
+            continue;
+        }
+
+        const auto& oldStats = baselineIter->second->stats;
+        const auto& newStats = timing.stats;
+        double delta = newStats.mean - oldStats.mean;
+        double percentDelta = oldStats.mean != 0 ? 100.0 * delta / oldStats.mean : 0;
+
+        // Welch's t statistic for the difference of the two means
+        double standardError = std::sqrt((oldStats.stdDev * oldStats.stdDev) / oldStats.count + (newStats.stdDev * newStats.stdDev) / newStats.count);
+        double t = standardError != 0 ? delta / standardError : 0;
+        bool significant = std::abs(t) > significanceThreshold;
+        if (significant)
+        {
+            ++numSignificant;
+        }
+
+        out << timing.name << "\tbase: " << oldStats.mean << " ms\tnew: " << newStats.mean << " ms\tdelta: " << delta << " ms (" << percentDelta << "%)\tt: " << t << (significant ? (delta > 0 ? "\t** SLOWER **" : "\t** FASTER **") : "") << "\n";
+    }
+    out << numSignificant << " node(s) with statistically significant changes\n";
+
+    out.flags(savedFlags);
+}
+
 void fun()
 {
     // this hack allows us to resolve printf which is used by compiled_model.o
@@ -134,6 +134,13 @@ void WriteModelStatistics(model::IRCompiledMap& map, ProfileOutputFormat format,
     WriteModelStatistics(modelStats, format, out);
 }
 
+void WriteModelMemoryStats(model::IRCompiledMap& map, ProfileOutputFormat format, std::ostream& out)
+{
+    // get the compile-time memory stats baked into the module
+    auto memoryStats = map.GetMemoryStats();
+    WriteModelMemoryStats(memoryStats, format, out);
+}
+
 void WriteNodeStatistics(model::IRCompiledMap& map, ProfileOutputFormat format, std::ostream& out)
 {
     // Gather node statistics
@@ -363,6 +370,7 @@ void ProfileModel(model::Map& map, const ProfileArguments& profileArguments, con
         WriteNodeStatistics(compiledMap, format, profileOutputStream);
         WriteRegionStatistics(compiledMap, format, profileOutputStream);
         WriteModelStatistics(compiledMap, format, profileOutputStream);
+        WriteModelMemoryStats(compiledMap, format, profileOutputStream);
     }
     else
     {
@@ -377,6 +385,8 @@ void ProfileModel(model::Map& map, const ProfileArguments& profileArguments, con
         WriteRegionStatistics(compiledMap, format, profileOutputStream);
         profileOutputStream << ",\n";
         WriteModelStatistics(compiledMap, format, profileOutputStream);
+        profileOutputStream << ",\n";
+        WriteModelMemoryStats(compiledMap, format, profileOutputStream);
         profileOutputStream << "}\n";
     }
 }
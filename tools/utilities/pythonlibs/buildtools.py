@@ -224,7 +224,7 @@ class EllBuildTools:
     def compile(self, model_file, func_name, model_name, target, output_dir, skip_ellcode=False,
                 use_blas=False, fuse_linear_ops=True, optimize_reorder_data_nodes=True, profile=False, llvm_format="bc",
                 optimize=True, parallelize=True, vectorize=True, debug=False, is_model_file=False, swig=True,
-                header=False, objext=".o", global_value_alignment=32, extra_options=[]):
+                header=False, objext=".o", global_value_alignment=32, cache_dir=None, extra_options=[]):
         file_arg = "-imf" if is_model_file else "-imap"
         format_flag = {
             "bc": "--bitcode",
@@ -278,6 +278,9 @@ class EllBuildTools:
         if skip_ellcode:
             args.append("--skip_ellcode")
 
+        if cache_dir:
+            args += ["-cd", cache_dir]
+
         args += extra_options
 
         # Save the parameters passed to compile. This is used for archiving purposes.
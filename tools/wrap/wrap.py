@@ -92,6 +92,13 @@ class ModuleBuilder:
             "default": None,
             "help": "the output directory"
         },
+        "cache_dir":
+        {
+            "short": "cd",
+            "default": None,
+            "help": "a directory where the compile tool caches its output, keyed by the model contents \
+and the compilation options; recompiling an unchanged model reuses the cached files"
+        },
         "verbose":
         {
             "short": "v",
@@ -208,6 +215,7 @@ If '0' or 'g', opt is not run (default '3')",
         self.objext = "o"
         self.logger = None
         self.skip_ellcode = False
+        self.cache_dir = None
 
     def str2bool(self, v):
         return v.lower() in ("yes", "true", "t", "1")
@@ -270,6 +278,7 @@ The supported target platforms are:
         self.output_dir = args.outdir
         if self.output_dir is None:
             self.output_dir = self.target
+        self.cache_dir = args.cache_dir
         if os.path.isfile(self.output_dir + ".py"):
             raise Exception("You have a python module named '{}', which will conflict with the --outdir of '{}'. \
 Please specify a different outdir.".format(self.output_dir + ".py", self.output_dir))
@@ -407,6 +416,7 @@ Please specify a different outdir.".format(self.output_dir + ".py", self.output_
             header=self.cpp_header,
             objext="." + self.objext,
             global_value_alignment=self.global_value_alignment,
+            cache_dir=self.cache_dir,
             extra_options=self.compile_args)
         self.stop_timer("compile")
         if self.swig: